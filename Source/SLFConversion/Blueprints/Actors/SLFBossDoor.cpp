@@ -330,6 +330,30 @@ void ASLFBossDoor::BeginPlay()
 	// - During boss fight: still blocks exit
 	// - After boss defeated: player can interact to exit
 	SetFogGateCollision(true);
+
+	// Dungeon entrances are fast travel destinations on the world map
+	if (bIsDungeonEntrance)
+	{
+		if (USLFMapMarkerSubsystem* Markers = USLFMapMarkerSubsystem::Get(this))
+		{
+			FSLFMapMarkerDesc Desc;
+			Desc.Source = this;
+			Desc.Channels = ESLFMapMarkerChannel::WorldMap;
+			Desc.Kind = ESLFMapMarkerKind::DungeonEntrance;
+			Desc.bStatic = true;
+			MapMarker = Markers->RegisterMarker(Desc);
+		}
+	}
+}
+
+void ASLFBossDoor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USLFMapMarkerSubsystem* Markers = USLFMapMarkerSubsystem::Get(this))
+	{
+		Markers->UnregisterMarker(MapMarker);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASLFBossDoor::SetFogGateCollision(bool bEnableCollision)
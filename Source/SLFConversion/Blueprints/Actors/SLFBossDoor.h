@@ -16,6 +16,7 @@
 #include "Components/BillboardComponent.h"
 #include "Interfaces/SLFInteractableInterface.h"
 #include "Animation/AnimMontage.h"
+#include "Components/SLFMapMarkerSubsystem.h"
 #include "SLFBossDoor.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnBossDoorSealed);
@@ -213,6 +214,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** Set collision on the fog gate mesh */
 	void SetFogGateCollision(bool bEnableCollision);
@@ -223,4 +225,7 @@ protected:
 
 	FTimerHandle DungeonEntranceTimerHandle;
 	TWeakObjectPtr<AActor> DungeonEntrancePlayer;
+
+	/** World map marker registry entry (dungeon entrances only) */
+	FSLFMapMarkerHandle MapMarker;
 };
@@ -14,6 +14,7 @@
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
+#include "Utilities/SLFNiagaraOneShotSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 
 AB_BaseProjectile::AB_BaseProjectile()
@@ -168,8 +169,8 @@ void AB_BaseProjectile::OnTriggerOverlap(
 	// Spawn hit effect
 	if (HitEffect)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(),
+		USLFNiagaraOneShotSubsystem::SpawnOneShot(
+			this,
 			HitEffect,
 			GetActorLocation(),
 			GetActorRotation()
@@ -24,6 +24,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraComponent.h"
+#include "Utilities/SLFNiagaraOneShotSubsystem.h"
 #include "Animation/AnimInstance.h"
 #include "SLFEnums.h"
 #include "Interfaces/BPI_Projectile.h"
@@ -33,6 +34,155 @@
 #include "Blueprints/Actors/SLFContainer.h"
 #include "TimerManager.h"
 #include "Widgets/W_TargetExecutionIndicator.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Animation/AnimSequenceBase.h"
+#include "Animation/BlendSpace.h"
+#include "NiagaraSystem.h"
+#include "Sound/SoundBase.h"
+#include "UObject/UnrealType.h"
+
+DECLARE_STATS_GROUP(TEXT("SLF Soft Assets"), STATGROUP_SLFSoftAssets, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sync Loads Avoided"), STAT_SLFSoftPlaySyncLoadsAvoided, STATGROUP_SLFSoftAssets);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Deferred Plays Fired"), STAT_SLFSoftPlayDeferredFired, STATGROUP_SLFSoftAssets);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Deferred Plays Dropped (Stale)"), STAT_SLFSoftPlayDroppedStale, STATGROUP_SLFSoftAssets);
+
+namespace
+{
+	bool IsWarmUpAssetClass(const UClass* Class)
+	{
+		return Class && (Class->IsChildOf(USoundBase::StaticClass()) || Class->IsChildOf(UNiagaraSystem::StaticClass()));
+	}
+
+	/** Visit every property value of a struct or class instance, static array elements included */
+	template <typename FuncType>
+	void ForEachPropertyValue(const UStruct* Struct, const void* Container, FuncType&& Func)
+	{
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ++ArrayIndex)
+			{
+				Func(*It, It->ContainerPtrToValuePtr<void>(Container, ArrayIndex));
+			}
+		}
+	}
+
+	/** Soft sound / Niagara references in a property value, including inside structs, arrays, sets and map values */
+	void CollectSoftEffectPaths(const FProperty* Property, const void* Value, TSet<FSoftObjectPath>& OutPaths)
+	{
+		if (const FSoftObjectProperty* SoftProperty = CastField<FSoftObjectProperty>(Property))
+		{
+			if (IsWarmUpAssetClass(SoftProperty->PropertyClass))
+			{
+				const FSoftObjectPath& Path = SoftProperty->GetPropertyValue(Value).ToSoftObjectPath();
+				if (!Path.IsNull())
+				{
+					OutPaths.Add(Path);
+				}
+			}
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			ForEachPropertyValue(StructProperty->Struct, Value, [&OutPaths](const FProperty* Inner, const void* InnerValue)
+			{
+				CollectSoftEffectPaths(Inner, InnerValue, OutPaths);
+			});
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper Helper(ArrayProperty, Value);
+			for (int32 i = 0; i < Helper.Num(); i++)
+			{
+				CollectSoftEffectPaths(ArrayProperty->Inner, Helper.GetRawPtr(i), OutPaths);
+			}
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			FScriptSetHelper Helper(SetProperty, Value);
+			for (FScriptSetHelper::FIterator It = Helper.CreateIterator(); It; ++It)
+			{
+				CollectSoftEffectPaths(SetProperty->ElementProp, Helper.GetElementPtr(It), OutPaths);
+			}
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			FScriptMapHelper Helper(MapProperty, Value);
+			for (FScriptMapHelper::FIterator It = Helper.CreateIterator(); It; ++It)
+			{
+				CollectSoftEffectPaths(MapProperty->ValueProp, Helper.GetValuePtr(It), OutPaths);
+			}
+		}
+	}
+
+	/**
+	 * Animations hard-referenced by a property value: montage/sequence fields and anim graph nodes
+	 * (sequence players, blend space players). Referenced objects are not walked, except blend spaces
+	 * whose samples are added.
+	 */
+	void CollectAnimations(const FProperty* Property, const void* Value, TSet<UAnimSequenceBase*>& OutAnimations)
+	{
+		if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+		{
+			UObject* Object = ObjectProperty->GetObjectPropertyValue(Value);
+			if (UAnimSequenceBase* Animation = Cast<UAnimSequenceBase>(Object))
+			{
+				OutAnimations.Add(Animation);
+			}
+			else if (const UBlendSpace* BlendSpace = Cast<UBlendSpace>(Object))
+			{
+				for (const FBlendSample& Sample : BlendSpace->GetBlendSamples())
+				{
+					if (Sample.Animation)
+					{
+						OutAnimations.Add(Sample.Animation);
+					}
+				}
+			}
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			ForEachPropertyValue(StructProperty->Struct, Value, [&OutAnimations](const FProperty* Inner, const void* InnerValue)
+			{
+				CollectAnimations(Inner, InnerValue, OutAnimations);
+			});
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper Helper(ArrayProperty, Value);
+			for (int32 i = 0; i < Helper.Num(); i++)
+			{
+				CollectAnimations(ArrayProperty->Inner, Helper.GetRawPtr(i), OutAnimations);
+			}
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			FScriptSetHelper Helper(SetProperty, Value);
+			for (FScriptSetHelper::FIterator It = Helper.CreateIterator(); It; ++It)
+			{
+				CollectAnimations(SetProperty->ElementProp, Helper.GetElementPtr(It), OutAnimations);
+			}
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			FScriptMapHelper Helper(MapProperty, Value);
+			for (FScriptMapHelper::FIterator It = Helper.CreateIterator(); It; ++It)
+			{
+				CollectAnimations(MapProperty->ValueProp, Helper.GetValuePtr(It), OutAnimations);
+			}
+		}
+	}
+
+	void CollectObjectAnimations(const UObject* Object, TSet<UAnimSequenceBase*>& OutAnimations)
+	{
+		if (Object)
+		{
+			ForEachPropertyValue(Object->GetClass(), Object, [&OutAnimations](const FProperty* Property, const void* Value)
+			{
+				CollectAnimations(Property, Value, OutAnimations);
+			});
+		}
+	}
+}
 
 ASLFBaseCharacter::ASLFBaseCharacter()
 {
@@ -180,6 +330,26 @@ void ASLFBaseCharacter::BeginPlay()
 	Cache_Location = GetActorLocation();
 	Cache_Rotation = GetActorRotation();
 	bMeshInitialized = true;
+
+	// Preload notify sounds/effects so the first footstep or hit does not wait on a load:
+	// the anim graph's animations, this character's animation properties and WarmUpAnimations
+	TSet<UAnimSequenceBase*> Animations;
+	for (UAnimSequenceBase* Animation : WarmUpAnimations)
+	{
+		if (Animation)
+		{
+			Animations.Add(Animation);
+		}
+	}
+	CollectObjectAnimations(this, Animations);
+	if (GetMesh())
+	{
+		CollectObjectAnimations(GetMesh()->GetAnimInstance(), Animations);
+	}
+	if (Animations.Num() > 0)
+	{
+		WarmUpNotifyAssets(Animations.Array());
+	}
 }
 
 void ASLFBaseCharacter::Tick(float DeltaTime)
@@ -208,27 +378,17 @@ void ASLFBaseCharacter::PlaySoftSoundAtLocation_Implementation(
 	AActor* InOwner,
 	UInitialActiveSoundParams* InitialParams)
 {
-	if (SoundBase.IsValid())
-	{
-		USoundBase* Sound = SoundBase.Get();
-		if (Sound)
-		{
-			UGameplayStatics::PlaySoundAtLocation(
-				this, Sound, Location, Rotation, Volume, Pitch, StartTime,
-				Attenuation, Concurrency, InOwner);
-		}
-	}
-	else if (!SoundBase.IsNull())
-	{
-		// Async load
-		SoundBase.LoadSynchronous();
-		if (USoundBase* Sound = SoundBase.Get())
-		{
-			UGameplayStatics::PlaySoundAtLocation(
-				this, Sound, Location, Rotation, Volume, Pitch, StartTime,
-				Attenuation, Concurrency, InOwner);
-		}
-	}
+	FSoftPlayRequest Request;
+	Request.Kind = ESoftPlayKind::Sound;
+	Request.Location = Location;
+	Request.Rotation = Rotation;
+	Request.Volume = Volume;
+	Request.Pitch = Pitch;
+	Request.StartTime = StartTime;
+	Request.Attenuation = Attenuation;
+	Request.Concurrency = Concurrency;
+	Request.SoundOwner = InOwner;
+	PlaySoftAsset(SoundBase.ToSoftObjectPath(), Request);
 }
 
 void ASLFBaseCharacter::GetHomingPositionComponent_Implementation(USceneComponent*& Component)
@@ -633,18 +793,13 @@ void ASLFBaseCharacter::PlaySoftNiagaraOneshotAtLocationReplicated_Implementatio
 	bool bAutoActivate,
 	bool bPreCullCheck)
 {
-	if (VFXSystem.IsNull())
-	{
-		return;
-	}
-
-	UNiagaraSystem* System = VFXSystem.LoadSynchronous();
-	if (System)
-	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(), System, Location, Rotation,
-			FVector(1.0f), bAutoDestroy, bAutoActivate);
-	}
+	FSoftPlayRequest Request;
+	Request.Kind = ESoftPlayKind::NiagaraAtLocation;
+	Request.Location = Location;
+	Request.Rotation = Rotation;
+	Request.bAutoDestroy = bAutoDestroy;
+	Request.bAutoActivate = bAutoActivate;
+	PlaySoftAsset(VFXSystem.ToSoftObjectPath(), Request);
 }
 
 void ASLFBaseCharacter::PlaySoftNiagaraLoopingReplicated_Implementation(
@@ -657,34 +812,21 @@ void ASLFBaseCharacter::PlaySoftNiagaraLoopingReplicated_Implementation(
 	bool bPreCullCheck,
 	double DurationValue)
 {
-	if (VFXSystem.IsNull() || !GetMesh())
+	if (!GetMesh())
 	{
 		return;
 	}
 
-	UNiagaraSystem* System = VFXSystem.LoadSynchronous();
-	if (System)
-	{
-		UNiagaraComponent* NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAttached(
-			System, GetMesh(), AttachSocket,
-			Location, Rotation, EAttachLocation::KeepRelativeOffset,
-			bAutoDestroy, bAutoActivate);
-
-		// Handle duration for looping systems - set timer to deactivate (IMPLEMENTED)
-		if (NiagaraComp && DurationValue > 0.0)
-		{
-			FTimerHandle DeactivateTimerHandle;
-			FTimerDelegate DeactivateDelegate;
-			DeactivateDelegate.BindLambda([NiagaraComp]()
-			{
-				if (IsValid(NiagaraComp))
-				{
-					NiagaraComp->Deactivate();
-				}
-			});
-			GetWorld()->GetTimerManager().SetTimer(DeactivateTimerHandle, DeactivateDelegate, DurationValue, false);
-		}
-	}
+	FSoftPlayRequest Request;
+	Request.Kind = ESoftPlayKind::NiagaraAttached;
+	Request.AttachSocket = AttachSocket;
+	Request.Location = Location;
+	Request.Rotation = Rotation;
+	Request.bAutoDestroy = bAutoDestroy;
+	Request.bAutoActivate = bAutoActivate;
+	Request.Duration = DurationValue;
+	Request.bLooping = true;
+	PlaySoftAsset(VFXSystem.ToSoftObjectPath(), Request);
 }
 
 void ASLFBaseCharacter::PlaySoftNiagaraOneshotReplicated_Implementation(
@@ -696,21 +838,230 @@ void ASLFBaseCharacter::PlaySoftNiagaraOneshotReplicated_Implementation(
 	bool bAutoActivate,
 	bool bPreCullCheck)
 {
-	if (VFXSystem.IsNull() || !GetMesh())
+	if (!GetMesh())
+	{
+		return;
+	}
+
+	FSoftPlayRequest Request;
+	Request.Kind = ESoftPlayKind::NiagaraAttached;
+	Request.AttachSocket = AttachSocket;
+	Request.Location = Location;
+	Request.Rotation = Rotation;
+	Request.bAutoDestroy = bAutoDestroy;
+	Request.bAutoActivate = bAutoActivate;
+	PlaySoftAsset(VFXSystem.ToSoftObjectPath(), Request);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// SOFT ASSET PLAYBACK
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void ASLFBaseCharacter::PlaySoftAsset(const FSoftObjectPath& Path, const FSoftPlayRequest& Request)
+{
+	if (Path.IsNull() || !GetWorld())
 	{
 		return;
 	}
 
-	UNiagaraSystem* System = VFXSystem.LoadSynchronous();
-	if (System)
+	if (UObject* Loaded = Path.ResolveObject())
+	{
+		ExecuteSoftPlay(Loaded, Request);
+		return;
+	}
+
+	if (!bDeferSoftAssetPlayback)
+	{
+		ExecuteSoftPlay(Path.TryLoad(), Request);
+		return;
+	}
+
+	// Queue first: the completion delegate can fire inside RequestAsyncLoad
+	const bool bLoadInFlight = PendingSoftPlays.Contains(Path);
+	PendingSoftPlays.FindOrAdd(Path).Add_GetRef(Request).RequestTime = GetWorld()->GetTimeSeconds();
+	if (bLoadInFlight)
+	{
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Path,
+		FStreamableDelegate::CreateWeakLambda(this, [this, Path]()
+		{
+			OnSoftPlayAssetLoaded(Path);
+		}));
+	if (!Handle.IsValid())
+	{
+		// No load was issued (bad path): do not leave this request waiting for a completion that never comes
+		if (PendingSoftPlays.Remove(Path) > 0)
+		{
+			ExecuteSoftPlay(Path.TryLoad(), Request);
+		}
+		return;
+	}
+
+	// Counted once per issued load; requests that join it above are not extra sync loads
+	INC_DWORD_STAT(STAT_SLFSoftPlaySyncLoadsAvoided);
+	SoftAssetHandles.Add(Path, Handle);
+}
+
+void ASLFBaseCharacter::OnSoftPlayAssetLoaded(FSoftObjectPath Path)
+{
+	TArray<FSoftPlayRequest> Requests;
+	if (!PendingSoftPlays.RemoveAndCopyValue(Path, Requests) || !GetWorld())
+	{
+		return;
+	}
+
+	UObject* Asset = Path.ResolveObject();
+	if (!Asset)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[BaseCharacter] Soft asset failed to load: %s"), *Path.ToString());
+		SoftAssetHandles.Remove(Path);
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (const FSoftPlayRequest& Request : Requests)
+	{
+		const double Age = Now - Request.RequestTime;
+		FSoftPlayRequest LateRequest = Request;
+		if (!ResolveDeferredSoftPlay(Age, SoftPlayStalenessWindow, Request.bLooping, LateRequest.Duration))
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("[BaseCharacter] Dropped stale play of %s (%.3fs old)"), *Path.ToString(), Age);
+			INC_DWORD_STAT(STAT_SLFSoftPlayDroppedStale);
+			continue;
+		}
+
+		ExecuteSoftPlay(Asset, LateRequest);
+		INC_DWORD_STAT(STAT_SLFSoftPlayDeferredFired);
+	}
+}
+
+bool ASLFBaseCharacter::ResolveDeferredSoftPlay(double Age, float StalenessWindow, bool bLooping, double& InOutDuration)
+{
+	if (!bLooping)
+	{
+		return Age <= StalenessWindow;
+	}
+
+	// A looping effect (e.g. a status effect aura) still matters when late, for what is left of it
+	if (InOutDuration > 0.0)
+	{
+		if (Age >= InOutDuration)
+		{
+			return false;
+		}
+		InOutDuration -= Age;
+	}
+	return true;
+}
+
+void ASLFBaseCharacter::ExecuteSoftPlay(UObject* Asset, const FSoftPlayRequest& Request)
+{
+	switch (Request.Kind)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAttached(
-			System, GetMesh(), AttachSocket,
-			Location, Rotation, EAttachLocation::KeepRelativeOffset,
-			bAutoDestroy, bAutoActivate);
+	case ESoftPlayKind::Sound:
+		if (USoundBase* Sound = Cast<USoundBase>(Asset))
+		{
+			UGameplayStatics::PlaySoundAtLocation(
+				this, Sound, Request.Location, Request.Rotation, Request.Volume, Request.Pitch, Request.StartTime,
+				Request.Attenuation.Get(), Request.Concurrency.Get(), Request.SoundOwner.Get());
+		}
+		break;
+
+	case ESoftPlayKind::NiagaraAtLocation:
+		if (UNiagaraSystem* System = Cast<UNiagaraSystem>(Asset))
+		{
+			// Fire-and-forget one-shots (footsteps, hits) reuse pooled components
+			if (Request.bAutoDestroy && Request.bAutoActivate)
+			{
+				USLFNiagaraOneShotSubsystem::SpawnOneShot(this, System, Request.Location, Request.Rotation);
+			}
+			else
+			{
+				UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+					GetWorld(), System, Request.Location, Request.Rotation,
+					FVector(1.0f), Request.bAutoDestroy, Request.bAutoActivate);
+			}
+		}
+		break;
+
+	case ESoftPlayKind::NiagaraAttached:
+		if (UNiagaraSystem* System = Cast<UNiagaraSystem>(Asset))
+		{
+			if (!GetMesh())
+			{
+				break;
+			}
+
+			UNiagaraComponent* NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAttached(
+				System, GetMesh(), Request.AttachSocket,
+				Request.Location, Request.Rotation, EAttachLocation::KeepRelativeOffset,
+				Request.bAutoDestroy, Request.bAutoActivate);
+
+			// Handle duration for looping systems - set timer to deactivate (IMPLEMENTED)
+			if (NiagaraComp && Request.Duration > 0.0)
+			{
+				FTimerHandle DeactivateTimerHandle;
+				FTimerDelegate DeactivateDelegate;
+				DeactivateDelegate.BindLambda([NiagaraComp]()
+				{
+					if (IsValid(NiagaraComp))
+					{
+						NiagaraComp->Deactivate();
+					}
+				});
+				GetWorld()->GetTimerManager().SetTimer(DeactivateTimerHandle, DeactivateDelegate, Request.Duration, false);
+			}
+		}
+		break;
 	}
 }
 
+int32 ASLFBaseCharacter::WarmUpNotifyAssets(const TArray<UAnimSequenceBase*>& Animations)
+{
+	TSet<FSoftObjectPath> Paths;
+	for (const UAnimSequenceBase* Animation : Animations)
+	{
+		if (!Animation)
+		{
+			continue;
+		}
+
+		for (const FAnimNotifyEvent& Event : Animation->Notifies)
+		{
+			const UObject* NotifyObject = Event.Notify
+				? static_cast<const UObject*>(Event.Notify.Get())
+				: static_cast<const UObject*>(Event.NotifyStateClass.Get());
+			if (!NotifyObject)
+			{
+				continue;
+			}
+
+			ForEachPropertyValue(NotifyObject->GetClass(), NotifyObject, [&Paths](const FProperty* Property, const void* Value)
+			{
+				CollectSoftEffectPaths(Property, Value, Paths);
+			});
+		}
+	}
+
+	if (Paths.Num() == 0)
+	{
+		return 0;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths.Array());
+	if (Handle.IsValid())
+	{
+		WarmUpHandles.Add(Handle);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[BaseCharacter] %s: warming up %d notify sounds/effects from %d animations"),
+		*GetName(), Paths.Num(), Animations.Num());
+	return Paths.Num();
+}
+
 void ASLFBaseCharacter::EnableRagdoll_Implementation()
 {
 	if (GetMesh())
@@ -1155,6 +1506,12 @@ void ASLFBaseCharacter::SRV_SpawnNiagaraOneshotLocation_Implementation(
 		return;
 	}
 
+	if (bAutoDestroy && bAutoActivate)
+	{
+		USLFNiagaraOneShotSubsystem::SpawnOneShot(this, VFXSystem, Location, Rotation);
+		return;
+	}
+
 	UNiagaraFunctionLibrary::SpawnSystemAtLocation(
 		GetWorld(),
 		VFXSystem,
@@ -37,7 +37,9 @@ class UAC_CombatManager;
 class UNiagaraSystem;
 class UCameraShakeBase;
 class UAnimMontage;
+class UAnimSequenceBase;
 class AB_PickupItem;
+struct FStreamableHandle;
 
 // ═══════════════════════════════════════════════════════════════════════════════
 // EVENT DISPATCHERS: 3/3 migrated
@@ -216,6 +218,45 @@ public:
 	UFUNCTION()
 	void OnDoorMovementComplete();
 
+	// ═══════════════════════════════════════════════════════════════════
+	// SOFT ASSET PLAYBACK
+	// ═══════════════════════════════════════════════════════════════════
+
+	/**
+	 * When a soft sound / Niagara system passed to PlaySoft* is not resident, request an
+	 * async load and play once it arrives instead of loading synchronously on the game thread
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character|Soft Assets")
+	bool bDeferSoftAssetPlayback = true;
+
+	/** Deferred plays whose load took longer than this (seconds) are dropped rather than played late */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character|Soft Assets", meta = (ClampMin = "0.0"))
+	float SoftPlayStalenessWindow = 0.25f;
+
+	/**
+	 * Extra animations whose notify sounds and effects are warmed up at BeginPlay. The anim graph's
+	 * sequences / blend spaces and this character's own animation properties are found automatically;
+	 * montages picked at runtime from data assets (actions, hit reactions) must be listed here.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character|Soft Assets")
+	TArray<TObjectPtr<UAnimSequenceBase>> WarmUpAnimations;
+
+	/**
+	 * Async-load every sound and Niagara system soft-referenced by the notifies of Animations
+	 * (e.g. AN_FootstepTrace's per-surface maps). The assets stay resident while this character lives.
+	 * @return Number of assets requested
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Character|Soft Assets")
+	int32 WarmUpNotifyAssets(const TArray<UAnimSequenceBase*>& Animations);
+
+	/**
+	 * Staleness rule for a deferred play that waited Age seconds for its load. One-shots older than
+	 * StalenessWindow are dropped; looping plays survive while any of their Duration (0 = unbounded)
+	 * is left, and InOutDuration is reduced to the remainder.
+	 * @return false if the play should be dropped
+	 */
+	static bool ResolveDeferredSoftPlay(double Age, float StalenessWindow, bool bLooping, double& InOutDuration);
+
 	// ═══════════════════════════════════════════════════════════════════
 	// EVENT DISPATCHERS: 3/3 migrated
 	// ═══════════════════════════════════════════════════════════════════
@@ -460,4 +501,51 @@ protected:
 
 	UFUNCTION()
 	void OnRotationLerpFinished();
+
+private:
+	enum class ESoftPlayKind : uint8
+	{
+		Sound,
+		NiagaraAtLocation,
+		NiagaraAttached
+	};
+
+	/** Arguments of one PlaySoft* call, kept until its asset is loaded */
+	struct FSoftPlayRequest
+	{
+		ESoftPlayKind Kind = ESoftPlayKind::Sound;
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+		double RequestTime = 0.0;
+
+		// Sound
+		double Volume = 1.0;
+		double Pitch = 1.0;
+		double StartTime = 0.0;
+		TWeakObjectPtr<USoundAttenuation> Attenuation;
+		TWeakObjectPtr<USoundConcurrency> Concurrency;
+		TWeakObjectPtr<AActor> SoundOwner;
+
+		// Niagara
+		FName AttachSocket;
+		bool bAutoDestroy = true;
+		bool bAutoActivate = true;
+		double Duration = 0.0;
+
+		/** Looping effects are played late (with the remaining duration) instead of dropped when stale */
+		bool bLooping = false;
+	};
+
+	/** Play now when the asset is resident, otherwise load synchronously or defer (bDeferSoftAssetPlayback) */
+	void PlaySoftAsset(const FSoftObjectPath& Path, const FSoftPlayRequest& Request);
+
+	void ExecuteSoftPlay(UObject* Asset, const FSoftPlayRequest& Request);
+	void OnSoftPlayAssetLoaded(FSoftObjectPath Path);
+
+	/** Requests waiting for an in-flight load, per asset */
+	TMap<FSoftObjectPath, TArray<FSoftPlayRequest>> PendingSoftPlays;
+
+	/** Handles of loaded/warmed-up assets, kept so they are not collected between plays */
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> SoftAssetHandles;
+	TArray<TSharedPtr<FStreamableHandle>> WarmUpHandles;
 };
@@ -12,6 +12,7 @@
 #include "SLFProjectileBase.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "NiagaraFunctionLibrary.h"
+#include "Utilities/SLFNiagaraOneShotSubsystem.h"
 #include "NiagaraComponent.h"
 #include "Components/SphereComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -211,7 +212,7 @@ void ASLFProjectileBase::OnProjectileHit_Implementation(AActor* HitActor, const
 			if (HitEffect)
 			{
 				FVector SpawnLocation = HitResult.ImpactPoint.IsZero() ? HitActor->GetActorLocation() : FVector(HitResult.ImpactPoint);
-				UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, HitEffect, SpawnLocation);
+				USLFNiagaraOneShotSubsystem::SpawnOneShot(this, HitEffect, SpawnLocation);
 			}
 
 			// Destroy projectile after hit
@@ -262,7 +263,7 @@ void ASLFProjectileBase::OnProjectileHit_Implementation(AActor* HitActor, const
 			if (HitEffect)
 			{
 				FVector SpawnLocation = HitResult.ImpactPoint.IsZero() ? HitActor->GetActorLocation() : FVector(HitResult.ImpactPoint);
-				UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, HitEffect, SpawnLocation);
+				USLFNiagaraOneShotSubsystem::SpawnOneShot(this, HitEffect, SpawnLocation);
 			}
 
 			SetLifeSpan(DestroyDelay);
@@ -280,7 +281,7 @@ void ASLFProjectileBase::OnProjectileHit_Implementation(AActor* HitActor, const
 	if (HitEffect)
 	{
 		FVector SpawnLocation = HitResult.ImpactPoint.IsZero() ? GetActorLocation() : FVector(HitResult.ImpactPoint);
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, HitEffect, SpawnLocation);
+		USLFNiagaraOneShotSubsystem::SpawnOneShot(this, HitEffect, SpawnLocation);
 	}
 
 	SetLifeSpan(DestroyDelay);
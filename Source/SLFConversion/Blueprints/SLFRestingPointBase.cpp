@@ -206,6 +206,27 @@ void ASLFRestingPointBase::BeginPlay()
 	{
 		InteractionText = FText::FromString(TEXT("Discover Resting Point"));
 	}
+
+	// Placed rest points show on the world map whether discovered or not
+	if (USLFMapMarkerSubsystem* Markers = USLFMapMarkerSubsystem::Get(this))
+	{
+		FSLFMapMarkerDesc Desc;
+		Desc.Source = this;
+		Desc.Channels = ESLFMapMarkerChannel::WorldMap;
+		Desc.Kind = ESLFMapMarkerKind::RestPoint;
+		Desc.bStatic = true;
+		MapMarker = Markers->RegisterMarker(Desc);
+	}
+}
+
+void ASLFRestingPointBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USLFMapMarkerSubsystem* Markers = USLFMapMarkerSubsystem::Get(this))
+	{
+		Markers->UnregisterMarker(MapMarker);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -30,6 +30,7 @@
 #include "Components/PointLightComponent.h"
 #include "NiagaraComponent.h"
 #include "GameplayTagContainer.h"
+#include "Components/SLFMapMarkerSubsystem.h"
 #include "SLFRestingPointBase.generated.h"
 
 // Forward declarations
@@ -77,6 +78,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void OnConstruction(const FTransform& Transform) override;
@@ -254,4 +256,7 @@ protected:
 	/** Called when stand-up montage ends — fully releases the player */
 	UFUNCTION()
 	void OnStandUpMontageEnded(UAnimMontage* Montage, bool bInterrupted);
+
+	/** World map marker registry entry (W_WorldMap reads placed points from the registry) */
+	FSLFMapMarkerHandle MapMarker;
 };
@@ -29,6 +29,7 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraFunctionLibrary.h"
+#include "Utilities/SLFNiagaraOneShotSubsystem.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
 #include "Engine/AssetManager.h"
@@ -247,8 +248,8 @@ void UAC_CombatManager::HandleProjectileDamage_Implementation(double IncomingDam
 	// Spawn hit effect
 	if (IsValid(ProjectileHitEffect))
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(),
+		USLFNiagaraOneShotSubsystem::SpawnOneShot(
+			this,
 			ProjectileHitEffect,
 			Owner->GetActorLocation(),
 			FRotator::ZeroRotator);
@@ -332,8 +333,8 @@ void UAC_CombatManager::HandleIncomingWeaponDamage_Implementation(AActor* Weapon
 				// Spawn perfect guard effect
 				if (IsValid(PerfectGuardEffect))
 				{
-					UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-						GetWorld(),
+					USLFNiagaraOneShotSubsystem::SpawnOneShot(
+						this,
 						PerfectGuardEffect,
 						HitInfo.ImpactPoint,
 						HitInfo.ImpactNormal.Rotation());
@@ -375,8 +376,8 @@ void UAC_CombatManager::HandleIncomingWeaponDamage_Implementation(AActor* Weapon
 				// Spawn guard effect
 				if (IsValid(GuardEffect))
 				{
-					UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-						GetWorld(),
+					USLFNiagaraOneShotSubsystem::SpawnOneShot(
+						this,
 						GuardEffect,
 						HitInfo.ImpactPoint,
 						HitInfo.ImpactNormal.Rotation());
@@ -65,16 +65,8 @@ void UAC_InventoryManager::GetAmountOfItem_Implementation(UPrimaryDataAsset* Ite
 		return;
 	}
 
-	// Search through items for matching asset
-	for (const auto& ItemEntry : Items)
-	{
-		if (ItemEntry.Value == Item)
-		{
-			OutAmount = 1; // Items map stores asset, count tracked elsewhere
-			OutSuccess = true;
-			return;
-		}
-	}
+	OutAmount = InventoryStore.GetCount(Item);
+	OutSuccess = OutAmount > 0;
 }
 
 /**
@@ -93,15 +85,8 @@ void UAC_InventoryManager::GetStoredAmountOfItem_Implementation(UPrimaryDataAsse
 		return;
 	}
 
-	for (const auto& ItemEntry : StoredItems)
-	{
-		if (ItemEntry.Value == Item)
-		{
-			OutAmount = 1;
-			OutSuccess = true;
-			return;
-		}
-	}
+	OutAmount = StorageStore.GetCount(Item);
+	OutSuccess = OutAmount > 0;
 }
 
 /**
@@ -112,14 +97,8 @@ void UAC_InventoryManager::GetAmountOfItemWithTag_Implementation(const FGameplay
 	UE_LOG(LogTemp, Log, TEXT("UAC_InventoryManager::GetAmountOfItemWithTag - Tag: %s"),
 		*Tag.ToString());
 
-	OutAmount = 0;
-	OutSuccess = false;
-
-	if (UPrimaryDataAsset** FoundItem = Items.Find(Tag))
-	{
-		OutAmount = 1;
-		OutSuccess = true;
-	}
+	OutAmount = InventoryStore.GetCountMatchingTag(Tag);
+	OutSuccess = OutAmount > 0;
 }
 
 /**
@@ -150,7 +129,7 @@ void UAC_InventoryManager::GetOverallCountForItem_Implementation(UPrimaryDataAss
  */
 int32 UAC_InventoryManager::GetTotalInventoryItemsCount_Implementation()
 {
-	int32 Count = Items.Num();
+	int32 Count = InventoryStore.GetTotalCount();
 	UE_LOG(LogTemp, Log, TEXT("UAC_InventoryManager::GetTotalInventoryItemsCount - %d"), Count);
 	return Count;
 }
@@ -160,7 +139,7 @@ int32 UAC_InventoryManager::GetTotalInventoryItemsCount_Implementation()
  */
 int32 UAC_InventoryManager::GetTotalStorageItemsCount_Implementation()
 {
-	int32 Count = StoredItems.Num();
+	int32 Count = StorageStore.GetTotalCount();
 	UE_LOG(LogTemp, Log, TEXT("UAC_InventoryManager::GetTotalStorageItemsCount - %d"), Count);
 	return Count;
 }
@@ -178,14 +157,7 @@ bool UAC_InventoryManager::HasItem_Implementation(UPrimaryDataAsset* Item)
 		return false;
 	}
 
-	for (const auto& ItemEntry : Items)
-	{
-		if (ItemEntry.Value == Item)
-		{
-			return true;
-		}
-	}
-	return false;
+	return InventoryStore.FindByAsset(Item).IsValid();
 }
 
 /**
@@ -249,21 +221,22 @@ void UAC_InventoryManager::AddItem_Implementation(UPrimaryDataAsset* Item, int32
 		return;
 	}
 
-	// Create tag from item name
-	FGameplayTag ItemTag = FGameplayTag::RequestGameplayTag(FName(*Item->GetName()));
-
-	// Add to items map
-	Items.Add(ItemTag, Item);
+	const bool bExisted = InventoryStore.FindByAsset(Item).IsValid();
+	const int32 NewCount = AddToContainer(InventoryStore, Items, Item, Count);
 
 	// Broadcast events
-	OnInventoryUpdated.Broadcast();
-	OnItemAmountUpdated.Broadcast(Item, Count);
+	NotifyItemAmountUpdated(Item, NewCount);
+	NotifyInventoryUpdated();
 
 	if (TriggerLootUi)
 	{
 		FSLFItemInfo ItemInfo;
-		ItemInfo.ItemTag = ItemTag;
-		OnItemLooted.Broadcast(ItemInfo, Count, false);
+		if (UPDA_Item* ItemData = Cast<UPDA_Item>(Item))
+		{
+			ItemInfo = ItemData->ItemInformation;
+		}
+		ItemInfo.ItemTag = FSLFInventoryStore::GetItemKeyTag(Item);
+		OnItemLooted.Broadcast(ItemInfo, Count, bExisted);
 	}
 }
 
@@ -280,23 +253,14 @@ void UAC_InventoryManager::RemoveItem_Implementation(UPrimaryDataAsset* Item, in
 		return;
 	}
 
-	// Find and remove item
-	FGameplayTag TagToRemove;
-	for (const auto& ItemEntry : Items)
+	if (!InventoryStore.FindByAsset(Item).IsValid())
 	{
-		if (ItemEntry.Value == Item)
-		{
-			TagToRemove = ItemEntry.Key;
-			break;
-		}
+		return;
 	}
 
-	if (TagToRemove.IsValid())
-	{
-		Items.Remove(TagToRemove);
-		OnInventoryUpdated.Broadcast();
-		OnItemAmountUpdated.Broadcast(Item, 0);
-	}
+	const int32 NewCount = RemoveFromContainer(InventoryStore, Items, Item, Count);
+	NotifyItemAmountUpdated(Item, NewCount);
+	NotifyInventoryUpdated();
 }
 
 /**
@@ -315,18 +279,10 @@ bool UAC_InventoryManager::RemoveItemWithTag_Implementation(const FGameplayTag&
 
 	// ═══════════════════════════════════════════════════════════════════
 	// PASS 1: Dry run - Check if we have enough BEFORE modifying anything
-	// In this implementation, Items is TMap<FGameplayTag, UPrimaryDataAsset*>
-	// Each entry is a single item (no stacks), so we count matching entries
+	// Stack counts come from the store's tag index (exact tag is O(1))
 	// ═══════════════════════════════════════════════════════════════════
-	int32 TotalAvailable = 0;
-	for (const auto& ItemEntry : Items)
-	{
-		UPDA_Item* ItemData = Cast<UPDA_Item>(ItemEntry.Value);
-		if (ItemData && ItemData->ItemInformation.ItemTag.MatchesTag(Tag))
-		{
-			TotalAvailable++;
-		}
-	}
+	TArray<FSLFInventoryHandle> Matches;
+	const int32 TotalAvailable = InventoryStore.GetCountMatchingTag(Tag, &Matches);
 
 	if (TotalAvailable < Count)
 	{
@@ -338,36 +294,32 @@ bool UAC_InventoryManager::RemoveItemWithTag_Implementation(const FGameplayTag&
 	// ═══════════════════════════════════════════════════════════════════
 	// PASS 2: Commit - Actually remove (we verified we have enough)
 	// ═══════════════════════════════════════════════════════════════════
-	TArray<FGameplayTag> TagsToRemove;
+	FSLFInventoryBatchScope Batch(this);
 	int32 RemainingToRemove = Count;
 
-	for (const auto& ItemEntry : Items)
+	for (const FSLFInventoryHandle& Handle : Matches)
 	{
 		if (RemainingToRemove <= 0)
 		{
 			break;
 		}
 
-		UPDA_Item* ItemData = Cast<UPDA_Item>(ItemEntry.Value);
-		if (ItemData && ItemData->ItemInformation.ItemTag.MatchesTag(Tag))
+		const FSLFInventoryEntry* Entry = InventoryStore.Get(Handle);
+		if (!Entry)
 		{
-			TagsToRemove.Add(ItemEntry.Key);
-			RemainingToRemove--;
-			UE_LOG(LogTemp, Log, TEXT("  Removing: %s"), *ItemData->GetName());
+			continue;
 		}
-	}
 
-	// Remove the found items
-	for (const FGameplayTag& TagToRemove : TagsToRemove)
-	{
-		if (UPrimaryDataAsset** ItemPtr = Items.Find(TagToRemove))
-		{
-			OnItemAmountUpdated.Broadcast(*ItemPtr, 0);
-		}
-		Items.Remove(TagToRemove);
+		UPrimaryDataAsset* ItemAsset = Entry->Item;
+		const int32 Taken = FMath::Min(RemainingToRemove, Entry->Count);
+		const int32 NewCount = RemoveFromContainer(InventoryStore, Items, ItemAsset, Taken);
+		RemainingToRemove -= Taken;
+		UE_LOG(LogTemp, Log, TEXT("  Removing: %d x %s"), Taken, *ItemAsset->GetName());
+
+		NotifyItemAmountUpdated(ItemAsset, NewCount);
 	}
 
-	OnInventoryUpdated.Broadcast();
+	NotifyInventoryUpdated();
 	return true;
 }
 
@@ -384,20 +336,10 @@ void UAC_InventoryManager::RemoveStoredItem_Implementation(UPrimaryDataAsset* It
 		return;
 	}
 
-	FGameplayTag TagToRemove;
-	for (const auto& ItemEntry : StoredItems)
+	if (StorageStore.FindByAsset(Item).IsValid())
 	{
-		if (ItemEntry.Value == Item)
-		{
-			TagToRemove = ItemEntry.Key;
-			break;
-		}
-	}
-
-	if (TagToRemove.IsValid())
-	{
-		StoredItems.Remove(TagToRemove);
-		OnInventoryUpdated.Broadcast();
+		RemoveFromContainer(StorageStore, StoredItems, Item, Count);
+		NotifyInventoryUpdated();
 	}
 }
 
@@ -427,40 +369,22 @@ void UAC_InventoryManager::RemoveItemAtSlot_Implementation(UW_InventorySlot* Slo
 		return;
 	}
 
-	// Calculate new count
-	int32 CurrentCount = Slot->Count;
-	int32 NewCount = CurrentCount - Count;
+	// Store count is authoritative; the slot only mirrors it
+	const int32 NewCount = RemoveFromContainer(InventoryStore, Items, SlotItem, Count);
 
 	if (NewCount <= 0)
 	{
 		// Remove item completely
 		Slot->EventClearSlot(true);  // TriggerShift = true to reorganize slots
-
-		// Remove from Items map
-		FGameplayTag ItemTag;
-		for (const auto& Entry : Items)
-		{
-			if (Entry.Value == SlotItem)
-			{
-				ItemTag = Entry.Key;
-				break;
-			}
-		}
-		if (ItemTag.IsValid())
-		{
-			Items.Remove(ItemTag);
-		}
-
-		OnItemAmountUpdated.Broadcast(SlotItem, 0);
 	}
 	else
 	{
 		// Update count
 		Slot->EventChangeAmount(NewCount);
-		OnItemAmountUpdated.Broadcast(SlotItem, NewCount);
 	}
 
-	OnInventoryUpdated.Broadcast();
+	NotifyItemAmountUpdated(SlotItem, NewCount);
+	NotifyInventoryUpdated();
 }
 
 /**
@@ -486,29 +410,12 @@ void UAC_InventoryManager::RemoveItemAtStorageSlot_Implementation(UW_InventorySl
 		return;
 	}
 
-	// Calculate new count
-	int32 CurrentCount = Slot->Count;
-	int32 NewCount = CurrentCount - Count;
+	const int32 NewCount = RemoveFromContainer(StorageStore, StoredItems, SlotItem, Count);
 
 	if (NewCount <= 0)
 	{
 		// Remove item completely
 		Slot->EventClearSlot(true);
-
-		// Remove from StoredItems map
-		FGameplayTag ItemTag;
-		for (const auto& Entry : StoredItems)
-		{
-			if (Entry.Value == SlotItem)
-			{
-				ItemTag = Entry.Key;
-				break;
-			}
-		}
-		if (ItemTag.IsValid())
-		{
-			StoredItems.Remove(ItemTag);
-		}
 	}
 	else
 	{
@@ -516,129 +423,25 @@ void UAC_InventoryManager::RemoveItemAtStorageSlot_Implementation(UW_InventorySl
 		Slot->EventChangeAmount(NewCount);
 	}
 
-	OnInventoryUpdated.Broadcast();
+	NotifyInventoryUpdated();
 }
 
 /**
  * GetItemsForEquipmentSlot - Get items that can equip to slot
  *
  * Filters inventory items based on equipment slot compatibility.
- * First checks explicit EquipSlots tags, then falls back to Category/SubCategory matching.
+ * Items with explicit EquipSlots tags match by tag; items without them fall back
+ * to Category/SubCategory matching (see FSLFInventoryStore::GetSlotFamily).
  */
 TArray<UPrimaryDataAsset*> UAC_InventoryManager::GetItemsForEquipmentSlot_Implementation(const FGameplayTag& EquipmentSlotTag)
 {
-	UE_LOG(LogTemp, Log, TEXT("UAC_InventoryManager::GetItemsForEquipmentSlot - Slot: %s, Items in inventory: %d"),
-		*EquipmentSlotTag.ToString(), Items.Num());
-
-	// Parse slot type from tag (e.g., "Right Hand Weapon 1" from full tag path)
-	FString SlotTagStr = EquipmentSlotTag.ToString();
-	bool bIsRightHand = SlotTagStr.Contains(TEXT("Right Hand"));
-	bool bIsLeftHand = SlotTagStr.Contains(TEXT("Left Hand"));
-	bool bIsHead = SlotTagStr.Contains(TEXT("Head"));
-	bool bIsArmor = SlotTagStr.Contains(TEXT("Armor"));
-	bool bIsGloves = SlotTagStr.Contains(TEXT("Gloves"));
-	bool bIsGreaves = SlotTagStr.Contains(TEXT("Greaves"));
-	bool bIsTrinket = SlotTagStr.Contains(TEXT("Trinket"));
-	bool bIsToolSlot = SlotTagStr.Contains(TEXT("Tool"));
-	// Note: Arrow/Bullet slots removed - bp_only uses Tool slots for all consumables/projectiles
-
+	// Explicit EquipSlots and the Category/SubCategory fallback are both answered
+	// from the store's equip-slot indexes, so cost is O(matches)
 	TArray<UPrimaryDataAsset*> Result;
+	InventoryStore.GetForEquipSlot(EquipmentSlotTag, Result);
 
-	// Filter items that can equip to this slot
-	for (const auto& ItemEntry : Items)
-	{
-		if (UPDA_Item* ItemData = Cast<UPDA_Item>(ItemEntry.Value))
-		{
-			bool bMatches = false;
-
-			// First check explicit EquipSlots tags
-			if (ItemData->ItemInformation.EquipmentDetails.EquipSlots.Num() > 0)
-			{
-				bMatches = ItemData->ItemInformation.EquipmentDetails.EquipSlots.HasTag(EquipmentSlotTag);
-			}
-			else
-			{
-				// Fallback: Match by Category/SubCategory since EquipSlots are empty
-				ESLFItemCategory Category = ItemData->ItemInformation.Category.Category;
-				ESLFItemSubCategory SubCategory = ItemData->ItemInformation.Category.SubCategory;
-
-				UE_LOG(LogTemp, Log, TEXT("[AC_InventoryManager]   Checking %s: Category=%d, SubCat=%d"),
-					*ItemData->GetName(),
-					static_cast<int32>(Category),
-					static_cast<int32>(SubCategory));
-
-				// Right Hand slots: Weapons, Swords, Katanas, Axes, Maces, Staffs
-				if (bIsRightHand)
-				{
-					bMatches = (Category == ESLFItemCategory::Weapons) ||
-					           (Category == ESLFItemCategory::Abilities) ||  // Abilities category used for weapons in test data
-					           (SubCategory == ESLFItemSubCategory::Sword) ||
-					           (SubCategory == ESLFItemSubCategory::Katana) ||
-					           (SubCategory == ESLFItemSubCategory::Axe) ||
-					           (SubCategory == ESLFItemSubCategory::Mace) ||
-					           (SubCategory == ESLFItemSubCategory::Staff);
-				}
-				// Left Hand slots: Shields AND Weapons (for dual-wielding)
-				else if (bIsLeftHand)
-				{
-					bMatches = (Category == ESLFItemCategory::Shields) ||
-					           (Category == ESLFItemCategory::Weapons) ||
-					           (SubCategory == ESLFItemSubCategory::Sword) ||
-					           (SubCategory == ESLFItemSubCategory::Katana) ||
-					           (SubCategory == ESLFItemSubCategory::Axe) ||
-					           (SubCategory == ESLFItemSubCategory::Mace) ||
-					           (SubCategory == ESLFItemSubCategory::Staff);
-				}
-				// Head slot: Head subcategory OR Armor category with Head subcategory
-				else if (bIsHead)
-				{
-					bMatches = (SubCategory == ESLFItemSubCategory::Head) ||
-					           (Category == ESLFItemCategory::Armor && SubCategory == ESLFItemSubCategory::Head);
-				}
-				// Armor/Chest slot: Chest subcategory OR Armor category
-				else if (bIsArmor)
-				{
-					bMatches = (SubCategory == ESLFItemSubCategory::Chest) ||
-					           (Category == ESLFItemCategory::Armor && SubCategory == ESLFItemSubCategory::Chest);
-				}
-				// Gloves/Arms slot
-				else if (bIsGloves)
-				{
-					bMatches = (SubCategory == ESLFItemSubCategory::Arms) ||
-					           (Category == ESLFItemCategory::Armor && SubCategory == ESLFItemSubCategory::Arms);
-				}
-				// Greaves/Legs slot
-				else if (bIsGreaves)
-				{
-					bMatches = (SubCategory == ESLFItemSubCategory::Legs) ||
-					           (Category == ESLFItemCategory::Armor && SubCategory == ESLFItemSubCategory::Legs);
-				}
-				// Trinket slots: Talismans
-				else if (bIsTrinket)
-				{
-					bMatches = (SubCategory == ESLFItemSubCategory::Talismans);
-				}
-				// Tool slots: Tools category, flasks, AND projectiles (bp_only uses Tool slots for everything)
-				else if (bIsToolSlot)
-				{
-					bMatches = (Category == ESLFItemCategory::Tools) ||
-					           (SubCategory == ESLFItemSubCategory::Flasks) ||
-					           (SubCategory == ESLFItemSubCategory::Projectiles);
-				}
-			}
-
-			if (bMatches)
-			{
-				Result.Add(ItemData);
-				UE_LOG(LogTemp, Log, TEXT("[AC_InventoryManager]   MATCH: %s (Category=%d, SubCat=%d)"),
-					*ItemData->GetName(),
-					static_cast<int32>(ItemData->ItemInformation.Category.Category),
-					static_cast<int32>(ItemData->ItemInformation.Category.SubCategory));
-			}
-		}
-	}
-
-	UE_LOG(LogTemp, Log, TEXT("UAC_InventoryManager::GetItemsForEquipmentSlot - Found %d matching items"), Result.Num());
+	UE_LOG(LogTemp, Log, TEXT("UAC_InventoryManager::GetItemsForEquipmentSlot - Slot: %s, Found %d matching items"),
+		*EquipmentSlotTag.ToString(), Result.Num());
 	return Result;
 }
 
@@ -655,9 +458,8 @@ void UAC_InventoryManager::AddItemToStorage_Implementation(UPrimaryDataAsset* It
 		return;
 	}
 
-	FGameplayTag ItemTag = FGameplayTag::RequestGameplayTag(FName(*ItemAsset->GetName()));
-	StoredItems.Add(ItemTag, ItemAsset);
-	OnInventoryUpdated.Broadcast();
+	AddToContainer(StorageStore, StoredItems, ItemAsset, Amount);
+	NotifyInventoryUpdated();
 }
 
 /**
@@ -685,6 +487,8 @@ void UAC_InventoryManager::AddItemAtSlotToStorage_Implementation(UW_InventorySlo
 		return;
 	}
 
+	FSLFInventoryBatchScope Batch(this);
+
 	// Add to storage
 	AddItemToStorage(SlotItem, Amount);
 
@@ -719,6 +523,8 @@ void UAC_InventoryManager::RetrieveItemAtSlotFromStorage_Implementation(UW_Inven
 		return;
 	}
 
+	FSLFInventoryBatchScope Batch(this);
+
 	// Add to inventory
 	AddItem(SlotItem, Amount, false);  // false = don't trigger loot UI
 
@@ -756,8 +562,14 @@ void UAC_InventoryManager::SerializeInventoryStorageCurrencyData_Implementation(
 
 	TArray<FInstancedStruct> DataToSave;
 
-	// Convert inventory items to save format
-	// Each item would be an FInstancedStruct containing FSLFInventoryItemsSaveInfo
+	// Convert inventory items to save format (one FSLFInventoryItemsSaveInfo per stack)
+	TArray<FSLFInventoryItemsSaveInfo> SaveItems;
+	GetItemsSaveInfo(ESLFInventorySlotType::InventorySlot, SaveItems);
+	DataToSave.Reserve(SaveItems.Num());
+	for (const FSLFInventoryItemsSaveInfo& SaveInfo : SaveItems)
+	{
+		DataToSave.Add(FInstancedStruct::Make<FSLFInventoryItemsSaveInfo>(SaveInfo));
+	}
 
 	FGameplayTag SaveTag = FGameplayTag::RequestGameplayTag(FName("SoulslikeFramework.Save.Inventory"));
 	OnSaveRequested.Broadcast(SaveTag, DataToSave);
@@ -771,18 +583,21 @@ void UAC_InventoryManager::InitializeLoadedInventory_Implementation(const TArray
 	UE_LOG(LogTemp, Log, TEXT("UAC_InventoryManager::InitializeLoadedInventory - %d items"),
 		LoadedInventoryItems.Num());
 
+	FSLFInventoryBatchScope Batch(this);
+	InventoryStore.Reset();
 	Items.Empty();
 
 	for (const FSLFInventoryItemsSaveInfo& SavedItem : LoadedInventoryItems)
 	{
-		if (IsValid(Cast<UPrimaryDataAsset>(SavedItem.Item)))
+		if (UPrimaryDataAsset* ItemAsset = Cast<UPrimaryDataAsset>(SavedItem.Item))
 		{
-			FGameplayTag ItemTag = FGameplayTag::RequestGameplayTag(FName(*SavedItem.Item->GetName()));
-			Items.Add(ItemTag, Cast<UPrimaryDataAsset>(SavedItem.Item));
+			// Older saves wrote Amount = 0 for tag-only entries
+			const int32 NewCount = AddToContainer(InventoryStore, Items, ItemAsset, FMath::Max(1, SavedItem.Amount));
+			NotifyItemAmountUpdated(ItemAsset, NewCount);
 		}
 	}
 
-	OnInventoryUpdated.Broadcast();
+	NotifyInventoryUpdated();
 }
 
 /**
@@ -822,15 +637,27 @@ void UAC_InventoryManager::GetItemsForCategory_Implementation(ESLFItemCategory I
 	OutStackableItems.Empty();
 	OutNonStackableItems.Empty();
 
-	const TMap<FGameplayTag, UPrimaryDataAsset*>& SourceItems =
-		(Type == ESLFInventorySlotType::StorageSlot) ? StoredItems : Items;
+	const FSLFInventoryStore& Store = (Type == ESLFInventorySlotType::StorageSlot) ? StorageStore : InventoryStore;
 
-	for (const auto& ItemEntry : SourceItems)
+	TArray<FSLFInventoryHandle> Handles;
+	Store.GetByCategory(ItemCategory, Handles);
+
+	for (const FSLFInventoryHandle& Handle : Handles)
 	{
-		if (IsValid(ItemEntry.Value))
+		const FSLFInventoryEntry* Entry = Store.Get(Handle);
+		if (!Entry)
+		{
+			continue;
+		}
+
+		const UPDA_Item* ItemData = Cast<UPDA_Item>(Entry->Item);
+		if (ItemData && ItemData->ItemInformation.MaxAmount <= 1)
+		{
+			OutNonStackableItems.Add(Entry->Item);
+		}
+		else
 		{
-			// Filter by category - would need to check ItemInfo
-			OutStackableItems.Add(ItemEntry.Key, ItemEntry.Value);
+			OutStackableItems.Add(Entry->ItemTag, Entry->Item);
 		}
 	}
 }
@@ -989,18 +816,18 @@ void UAC_InventoryManager::InitializeLoadedStorage_Implementation(const TArray<F
 	UE_LOG(LogTemp, Log, TEXT("UAC_InventoryManager::InitializeLoadedStorage - %d items"),
 		LoadedStorageItems.Num());
 
+	StorageStore.Reset();
 	StoredItems.Empty();
 
 	for (const FSLFInventoryItemsSaveInfo& SavedItem : LoadedStorageItems)
 	{
-		if (IsValid(Cast<UPrimaryDataAsset>(SavedItem.Item)))
+		if (UPrimaryDataAsset* ItemAsset = Cast<UPrimaryDataAsset>(SavedItem.Item))
 		{
-			FGameplayTag ItemTag = FGameplayTag::RequestGameplayTag(FName(*SavedItem.Item->GetName()));
-			StoredItems.Add(ItemTag, Cast<UPrimaryDataAsset>(SavedItem.Item));
+			AddToContainer(StorageStore, StoredItems, ItemAsset, FMath::Max(1, SavedItem.Amount));
 		}
 	}
 
-	OnInventoryUpdated.Broadcast();
+	NotifyInventoryUpdated();
 }
 
 /**
@@ -1017,6 +844,132 @@ void UAC_InventoryManager::ReplenishItem_Implementation(UPrimaryDataAsset* Item)
 		return;
 	}
 
-	// Check if item is rechargeable and replenish to max
-	OnItemAmountUpdated.Broadcast(Item, 1);
+	// Only items the player already holds are refilled - replenishing never grants new items
+	int32 NewCount = InventoryStore.GetCount(InventoryStore.FindByAsset(Item));
+	if (NewCount <= 0)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("UAC_InventoryManager::ReplenishItem - %s not held, nothing to refill"), *Item->GetName());
+		return;
+	}
+
+	// Rechargeable items (flasks) refill to MaxAmount
+	const UPDA_Item* ItemData = Cast<UPDA_Item>(Item);
+	if (ItemData && ItemData->ItemInformation.bRechargeable && NewCount < ItemData->ItemInformation.MaxAmount)
+	{
+		NewCount = AddToContainer(InventoryStore, Items, Item, ItemData->ItemInformation.MaxAmount - NewCount);
+	}
+
+	NotifyItemAmountUpdated(Item, NewCount);
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// INVENTORY STORE
+// ═══════════════════════════════════════════════════════════════════════
+
+FSLFInventoryHandle UAC_InventoryManager::GetItemHandle(UPrimaryDataAsset* Item, ESLFInventorySlotType Type) const
+{
+	const FSLFInventoryStore& Store = (Type == ESLFInventorySlotType::StorageSlot) ? StorageStore : InventoryStore;
+	return Store.FindByAsset(Item);
+}
+
+void UAC_InventoryManager::GetItemsSaveInfo(ESLFInventorySlotType Type, TArray<FSLFInventoryItemsSaveInfo>& OutItems) const
+{
+	const FSLFInventoryStore& Store = (Type == ESLFInventorySlotType::StorageSlot) ? StorageStore : InventoryStore;
+
+	OutItems.Reset(Store.Num());
+	Store.ForEach([&OutItems](FSLFInventoryHandle, const FSLFInventoryEntry& Entry)
+	{
+		FSLFInventoryItemsSaveInfo& SaveInfo = OutItems.AddDefaulted_GetRef();
+		SaveInfo.Item = Entry.Item;
+		SaveInfo.Amount = Entry.Count;
+	});
+}
+
+int32 UAC_InventoryManager::AddToContainer(FSLFInventoryStore& Store, TMap<FGameplayTag, UPrimaryDataAsset*>& View, UPrimaryDataAsset* Item, int32 Count)
+{
+	int32 NewCount = 0;
+	const FSLFInventoryHandle Handle = Store.Add(Item, Count, NewCount);
+	if (const FSLFInventoryEntry* Entry = Store.Get(Handle))
+	{
+		View.Add(Entry->ItemTag, Item);
+	}
+	return NewCount;
+}
+
+int32 UAC_InventoryManager::RemoveFromContainer(FSLFInventoryStore& Store, TMap<FGameplayTag, UPrimaryDataAsset*>& View, UPrimaryDataAsset* Item, int32 Count)
+{
+	const FSLFInventoryHandle Handle = Store.FindByAsset(Item);
+	const FSLFInventoryEntry* Entry = Store.Get(Handle);
+	if (!Entry)
+	{
+		return 0;
+	}
+
+	const FGameplayTag ItemTag = Entry->ItemTag;
+	const int32 NewCount = Store.Remove(Handle, Count);
+	if (NewCount <= 0)
+	{
+		UPrimaryDataAsset** Viewed = View.Find(ItemTag);
+		if (Viewed && *Viewed == Item)
+		{
+			// Another held item may share the tag - keep the view pointing at it
+			if (const FSLFInventoryEntry* Survivor = Store.Get(Store.FindByTag(ItemTag)))
+			{
+				*Viewed = Survivor->Item;
+			}
+			else
+			{
+				View.Remove(ItemTag);
+			}
+		}
+	}
+	return NewCount;
+}
+
+void UAC_InventoryManager::BeginInventoryBatch()
+{
+	++BatchDepth;
+}
+
+void UAC_InventoryManager::EndInventoryBatch()
+{
+	if (BatchDepth <= 0 || --BatchDepth > 0)
+	{
+		return;
+	}
+
+	// Move out first - listeners may start a new batch
+	TMap<UPrimaryDataAsset*, int32> AmountUpdates = MoveTemp(BatchAmountUpdates);
+	const bool bInventoryUpdated = bBatchInventoryUpdated;
+	BatchAmountUpdates.Reset();
+	bBatchInventoryUpdated = false;
+
+	for (const TPair<UPrimaryDataAsset*, int32>& Update : AmountUpdates)
+	{
+		OnItemAmountUpdated.Broadcast(Update.Key, Update.Value);
+	}
+	if (bInventoryUpdated)
+	{
+		OnInventoryUpdated.Broadcast();
+	}
+}
+
+void UAC_InventoryManager::NotifyItemAmountUpdated(UPrimaryDataAsset* Item, int32 NewCount)
+{
+	if (BatchDepth > 0)
+	{
+		BatchAmountUpdates.Add(Item, NewCount);
+		return;
+	}
+	OnItemAmountUpdated.Broadcast(Item, NewCount);
+}
+
+void UAC_InventoryManager::NotifyInventoryUpdated()
+{
+	if (BatchDepth > 0)
+	{
+		bBatchInventoryUpdated = true;
+		return;
+	}
+	OnInventoryUpdated.Broadcast();
 }
@@ -13,6 +13,7 @@
 #include "SLFEnums.h"
 #include "SLFGameTypes.h"
 #include "SLFPrimaryDataAssets.h"
+#include "SLFInventoryStore.h"
 
 #include "AC_InventoryManager.generated.h"
 
@@ -59,8 +60,10 @@ public:
 	int32 SlotsPerRow;
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Runtime")
 	AActor* OwnerActor;
+	/** Tag -> asset view of InventoryStore (kept for Blueprint/save compatibility; counts live in the store) */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Runtime")
 	TMap<FGameplayTag, UPrimaryDataAsset*> Items;
+	/** Tag -> asset view of StorageStore */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Runtime")
 	TMap<FGameplayTag, UPrimaryDataAsset*> StoredItems;
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Runtime")
@@ -202,4 +205,70 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "AC_InventoryManager")
 	void ReplenishItem(UPrimaryDataAsset* Item);
 	virtual void ReplenishItem_Implementation(UPrimaryDataAsset* Item);
+
+	// ═══════════════════════════════════════════════════════════════════════
+	// INVENTORY STORE (counted + indexed backing for Items/StoredItems)
+	// ═══════════════════════════════════════════════════════════════════════
+
+	const FSLFInventoryStore& GetInventoryStore() const { return InventoryStore; }
+	const FSLFInventoryStore& GetStorageStore() const { return StorageStore; }
+
+	/** Stable handle for an item in inventory (or storage) */
+	UFUNCTION(BlueprintCallable, Category = "AC_InventoryManager")
+	FSLFInventoryHandle GetItemHandle(UPrimaryDataAsset* Item, ESLFInventorySlotType Type) const;
+
+	/** Build save entries with real stack counts */
+	UFUNCTION(BlueprintCallable, Category = "AC_InventoryManager")
+	void GetItemsSaveInfo(ESLFInventorySlotType Type, TArray<FSLFInventoryItemsSaveInfo>& OutItems) const;
+
+	/**
+	 * Coalesce change notifications until the matching EndInventoryBatch.
+	 * OnItemAmountUpdated fires once per touched item with its final count,
+	 * OnInventoryUpdated fires once. Batches nest.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AC_InventoryManager")
+	void BeginInventoryBatch();
+	UFUNCTION(BlueprintCallable, Category = "AC_InventoryManager")
+	void EndInventoryBatch();
+
+protected:
+	/** Add/remove on a store and keep its tag view in sync. Return the new stack count. */
+	int32 AddToContainer(FSLFInventoryStore& Store, TMap<FGameplayTag, UPrimaryDataAsset*>& View, UPrimaryDataAsset* Item, int32 Count);
+	int32 RemoveFromContainer(FSLFInventoryStore& Store, TMap<FGameplayTag, UPrimaryDataAsset*>& View, UPrimaryDataAsset* Item, int32 Count);
+
+	void NotifyItemAmountUpdated(UPrimaryDataAsset* Item, int32 NewCount);
+	void NotifyInventoryUpdated();
+
+	UPROPERTY()
+	FSLFInventoryStore InventoryStore;
+	UPROPERTY()
+	FSLFInventoryStore StorageStore;
+
+	int32 BatchDepth = 0;
+	bool bBatchInventoryUpdated = false;
+	TMap<UPrimaryDataAsset*, int32> BatchAmountUpdates;
+};
+
+/** RAII helper around UAC_InventoryManager::BeginInventoryBatch/EndInventoryBatch */
+struct FSLFInventoryBatchScope
+{
+	explicit FSLFInventoryBatchScope(UAC_InventoryManager* InManager)
+		: Manager(InManager)
+	{
+		if (Manager)
+		{
+			Manager->BeginInventoryBatch();
+		}
+	}
+
+	~FSLFInventoryBatchScope()
+	{
+		if (Manager)
+		{
+			Manager->EndInventoryBatch();
+		}
+	}
+
+private:
+	UAC_InventoryManager* Manager;
 };
@@ -24,6 +24,7 @@
 #include "Interfaces/BPI_Enemy.h"
 #include "Interfaces/BPI_ExecutionIndicator.h"
 #include "NiagaraFunctionLibrary.h"
+#include "Utilities/SLFNiagaraOneShotSubsystem.h"
 #include "NiagaraSystem.h"
 #include "Animation/AnimInstance.h"
 #include "UObject/ConstructorHelpers.h"
@@ -316,14 +317,11 @@ void UAICombatManagerComponent::HandleIncomingWeaponDamage_AI_Implementation(
 	// Spawn hit effects (blood VFX)
 	if (HitVFX)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+		USLFNiagaraOneShotSubsystem::SpawnOneShot(
 			this,
 			HitVFX,
 			HitResult.ImpactPoint,
-			HitResult.ImpactNormal.Rotation(),
-			FVector(1.0f),
-			true,
-			true
+			HitResult.ImpactNormal.Rotation()
 		);
 		UE_LOG(LogTemp, Log, TEXT("[AICombatManager] Spawned blood VFX at %s"), *HitResult.ImpactPoint.ToString());
 	}
@@ -14,6 +14,7 @@
 #include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraFunctionLibrary.h"
+#include "Utilities/SLFNiagaraOneShotSubsystem.h"
 #include "Camera/CameraShakeBase.h"
 #include "Components/StatManagerComponent.h"
 #include "Components/StatusEffectManagerComponent.h"
@@ -146,7 +147,7 @@ void UCombatManagerComponent::HandleIncomingWeaponDamage_Implementation(
 			if (PerfectGuardEffect)
 			{
 				// Spawn perfect guard VFX
-				UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, PerfectGuardEffect, HitResult.ImpactPoint);
+				USLFNiagaraOneShotSubsystem::SpawnOneShot(this, PerfectGuardEffect, HitResult.ImpactPoint);
 			}
 			return;
 		}
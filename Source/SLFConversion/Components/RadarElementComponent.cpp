@@ -52,23 +52,30 @@ void URadarElementComponent::RemoveTrackedElement_Implementation()
 	UE_LOG(LogRadarElement, Verbose, TEXT("RemoveTrackedElement for %s"),
 		GetOwner() ? *GetOwner()->GetName() : TEXT("nullptr"));
 
-	if (!MarkerWidget)
+	if (!MarkerWidget && !RadarMarker.IsValid())
 	{
 		return;
 	}
 
-	// Get player controller
+	// Unregister from RadarManager
 	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
-	if (!IsValid(PC))
+	if (IsValid(PC))
 	{
-		return;
+		if (URadarManagerComponent* RadarManager = PC->FindComponentByClass<URadarManagerComponent>())
+		{
+			RadarManager->StopTrackElement(this);
+			UE_LOG(LogRadarElement, Verbose, TEXT("  -> Unregistered from RadarManager"));
+		}
 	}
 
-	// Unregister from RadarManager
-	if (URadarManagerComponent* RadarManager = PC->FindComponentByClass<URadarManagerComponent>())
+	// Controller already gone (level teardown) - drop the registry entry directly
+	if (RadarMarker.IsValid())
 	{
-		RadarManager->StopTrackElement(this);
-		UE_LOG(LogRadarElement, Verbose, TEXT("  -> Unregistered from RadarManager"));
+		if (USLFMapMarkerSubsystem* Markers = USLFMapMarkerSubsystem::Get(this))
+		{
+			Markers->UnregisterMarker(RadarMarker);
+		}
+		RadarMarker.Reset();
 	}
 
 	MarkerWidget = nullptr;
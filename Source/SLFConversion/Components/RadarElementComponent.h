@@ -11,6 +11,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Engine/Texture2D.h"
+#include "Components/SLFMapMarkerSubsystem.h"
 #include "RadarElementComponent.generated.h"
 
 // Forward declarations
@@ -41,10 +42,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Config|Icon")
 	FVector2D IconSize;
 
-	/** Reference to the created marker widget (W_Radar_TrackedElement) */
+	/** Reference to the created marker widget (W_Radar_TrackedElement) - unused now that the radar draws markers from the registry */
 	UPROPERTY(BlueprintReadWrite, Category = "Default")
 	UW_Radar_TrackedElement* MarkerWidget;
 
+	/** Registry entry drawn by the radar's marker layer (set by URadarManagerComponent::StartTrackElement) */
+	FSLFMapMarkerHandle RadarMarker;
+
 	// ═══════════════════════════════════════════════════════════════════
 	// FUNCTIONS: 3/3 migrated (excluding ExecuteUbergraph)
 	// ═══════════════════════════════════════════════════════════════════
@@ -14,6 +14,8 @@
 #include "Widgets/W_Radar.h"
 #include "Widgets/W_Radar_TrackedElement.h"
 #include "Widgets/W_Radar_Cardinal.h"
+#include "Widgets/SLFMarkerLayer.h"
+#include "Components/SLFMapMarkerSubsystem.h"
 #include "Camera/CameraComponent.h"
 #include "Blueprint/UserWidget.h"
 #include "TimerManager.h"
@@ -150,35 +152,37 @@ UW_Radar_TrackedElement* URadarManagerComponent::StartTrackElement_Implementatio
 	}
 
 	// Check if already tracking this element
-	if (UW_Radar_TrackedElement** ExistingWidget = TrackedElementWidgets.Find(Element))
+	if (Element->RadarMarker.IsValid())
 	{
 		UE_LOG(LogTemp, Log, TEXT("[RadarManager] StartTrackElement: Element already tracked"));
-		return *ExistingWidget;
+		return nullptr;
 	}
 
-	// Add to tracked list
-	TrackedElements.AddUnique(Element);
-
-	UE_LOG(LogTemp, Log, TEXT("[RadarManager] StartTrackElement: Now tracking %d elements"), TrackedElements.Num());
-
-	// Create widget marker via RadarWidget
-	if (RadarWidget)
+	USLFMapMarkerSubsystem* Markers = USLFMapMarkerSubsystem::Get(this);
+	if (!Markers)
 	{
-		// Get icon from RadarElementComponent
-		TSoftObjectPtr<UTexture2D> ElementIcon = Element->Icon;
-		FLinearColor ElementTint = Element->IconTint;
-		FVector2D ElementSize = Element->IconSize;
+		return nullptr;
+	}
 
-		// Create tracked element widget
-		UW_Radar_TrackedElement* NewMarker = RadarWidget->AddTrackedElement(ElementIcon, ElementTint, ElementSize);
-		if (NewMarker)
-		{
-			TrackedElementWidgets.Add(Element, NewMarker);
-			UE_LOG(LogTemp, Log, TEXT("[RadarManager] Created marker widget for tracked element"));
-			return NewMarker;
-		}
+	// Register the owner with the marker registry - UpdateTrackedElements draws the
+	// tracked elements' markers in one pass, so there is no per-element widget
+	FSLFMapMarkerDesc Desc;
+	Desc.Source = Element->GetOwner();
+	Desc.Channels = ESLFMapMarkerChannel::Radar;
+	Desc.Kind = ESLFMapMarkerKind::RadarElement;
+	Desc.Icon = Element->Icon;
+	Desc.Tint = Element->IconTint;
+	Desc.Size = FVector2f(Element->IconSize);
+
+	Element->RadarMarker = Markers->RegisterMarker(Desc);
+	if (!Element->RadarMarker.IsValid())
+	{
+		return nullptr;
 	}
 
+	TrackedElements.AddUnique(Element);
+
+	UE_LOG(LogTemp, Log, TEXT("[RadarManager] StartTrackElement: Now tracking %d elements"), TrackedElements.Num());
 	return nullptr;
 }
 
@@ -188,7 +192,13 @@ void URadarManagerComponent::StopTrackElement_Implementation(URadarElementCompon
 
 	TrackedElements.Remove(Element);
 
-	// Remove the widget from the radar
+	if (USLFMapMarkerSubsystem* Markers = USLFMapMarkerSubsystem::Get(this))
+	{
+		Markers->UnregisterMarker(Element->RadarMarker);
+	}
+	Element->RadarMarker.Reset();
+
+	// Blueprint-created legacy widget, if any
 	if (UW_Radar_TrackedElement** MarkerWidget = TrackedElementWidgets.Find(Element))
 	{
 		if (RadarWidget && *MarkerWidget)
@@ -223,31 +233,55 @@ void URadarManagerComponent::AddCompassMarker_Implementation(FGameplayTag Direct
 
 void URadarManagerComponent::UpdateTrackedElements_Implementation()
 {
-	if (!bShouldUpdate || !PlayerCamera) return;
+	if (!bShouldUpdate || !PlayerCamera || !RadarWidget) return;
 
 	AActor* Owner = GetOwner();
 	if (!Owner) return;
 
-	FVector OwnerLocation = Owner->GetActorLocation();
+	USLFMarkerLayer* Layer = RadarWidget->GetMarkerLayer();
+	USLFMapMarkerSubsystem* Markers = USLFMapMarkerSubsystem::Get(this);
+	if (!Layer || !Markers) return;
 
-	for (URadarElementComponent* Element : TrackedElements)
+	// Only this manager's tracked elements, and only those whose actor is not hidden in game
+	RadarHandles.Reset();
+	for (const URadarElementComponent* Element : TrackedElements)
 	{
-		if (!Element || !Element->GetOwner()) continue;
+		const AActor* Source = Element ? Element->GetOwner() : nullptr;
+		if (Source && !Source->IsHidden() && Element->RadarMarker.IsValid())
+		{
+			RadarHandles.Add(Element->RadarMarker);
+		}
+	}
 
-		// Calculate position on radar
-		FVector ElementLocation = Element->GetOwner()->GetActorLocation();
-		FVector2D RadarPos = CalculateRadarPosition(ElementLocation);
+	const int32 NumMarkers = Markers->GatherMarkers(RadarHandles, RadarSnapshot);
+	FSLFMarkerDrawList& DrawList = Layer->EditMarkers();
 
-		// Update element marker widget position via render transform
-		if (UW_Radar_TrackedElement** MarkerWidget = TrackedElementWidgets.Find(Element))
+	// Icons, tints and sizes only change when elements come, go or hide, or an icon finishes loading
+	if (RadarStyleRevision != Markers->GetRevision() || RadarStyleIndices != RadarSnapshot.Indices)
+	{
+		DrawList.SetNum(NumMarkers);
+		for (int32 Index = 0; Index < NumMarkers; ++Index)
 		{
-			if (*MarkerWidget)
-			{
-				// Set render translation to position the marker on the radar
-				(*MarkerWidget)->SetRenderTranslation(RadarPos);
-			}
+			const FSLFMapMarkerDesc& Desc = Markers->GetMarkerDesc(RadarSnapshot.Indices[Index]);
+			DrawList.Sizes[Index] = Desc.Size;
+			DrawList.Tints[Index] = Desc.Tint;
+			// Icons load asynchronously on registration; until then the marker draws as a plain box
+			DrawList.BrushIndices[Index] = Layer->FindOrAddBrush(Desc.Icon.Get());
 		}
+		RadarStyleRevision = Markers->GetRevision();
+		RadarStyleIndices = RadarSnapshot.Indices;
 	}
+
+	// Same math as CalculateRadarPosition, for every marker in one pass
+	const FVector OwnerLocation = Owner->GetActorLocation();
+	USLFMapMarkerSubsystem::ProjectToRadar(
+		RadarSnapshot.X.GetData(), RadarSnapshot.Y.GetData(), NumMarkers,
+		FVector2f(static_cast<float>(OwnerLocation.X), static_cast<float>(OwnerLocation.Y)),
+		static_cast<float>(PlayerCamera->GetComponentRotation().Yaw),
+		static_cast<float>(RadarRadius), static_cast<float>(RadarClampLength),
+		DrawList.Positions.GetData());
+
+	Layer->CommitMarkers();
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -20,6 +20,7 @@
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
 #include "SLFGameTypes.h"
+#include "Components/SLFMapMarkerSubsystem.h"
 #include "RadarManagerComponent.generated.h"
 
 // Forward declarations
@@ -93,7 +94,7 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Runtime")
 	UW_Radar* RadarWidget;
 
-	/** Map of tracked elements to their widget representations */
+	/** Map of tracked elements to their widget representations (legacy - markers are drawn by the radar's marker layer) */
 	UPROPERTY(BlueprintReadWrite, Category = "Runtime")
 	TMap<URadarElementComponent*, UW_Radar_TrackedElement*> TrackedElementWidgets;
 
@@ -132,8 +133,9 @@ public:
 	// --- Tracking (4) ---
 
 	/** [3/13] Start tracking a radar element
+	 * Registers the element's owner with the map marker registry; the radar draws it from there.
 	 * @param Element - The radar element component to track
-	 * @return The created marker widget
+	 * @return Legacy marker widget (nullptr - markers no longer get their own widget)
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Radar Manager|Tracking")
 	UW_Radar_TrackedElement* StartTrackElement(URadarElementComponent* Element);
@@ -207,4 +209,15 @@ public:
 protected:
 	/** Populate default cardinal data if not set from Blueprint */
 	void PopulateDefaultCardinalData();
+
+private:
+	/** Marker handles of the tracked elements drawn this refresh, reused every refresh */
+	TArray<FSLFMapMarkerHandle> RadarHandles;
+
+	/** Packed radar marker locations, reused every refresh */
+	FSLFMapMarkerSnapshot RadarSnapshot;
+
+	/** Registry revision and marker set the marker layer's sizes/tints/brushes were built for */
+	uint32 RadarStyleRevision = MAX_uint32;
+	TArray<int32> RadarStyleIndices;
 };
@@ -0,0 +1,402 @@
+// SLFInventoryStore.cpp
+// Counted, indexed item container backing UAC_InventoryManager
+
+#include "SLFInventoryStore.h"
+#include "SLFPrimaryDataAssets.h"
+#include "GameplayTagsManager.h"
+
+namespace
+{
+	const UPDA_Item* AsItemData(const UPrimaryDataAsset* Item)
+	{
+		return Cast<const UPDA_Item>(Item);
+	}
+
+	bool IsWeaponSubCategory(ESLFItemSubCategory SubCategory)
+	{
+		return SubCategory == ESLFItemSubCategory::Sword ||
+		       SubCategory == ESLFItemSubCategory::Katana ||
+		       SubCategory == ESLFItemSubCategory::Axe ||
+		       SubCategory == ESLFItemSubCategory::Mace ||
+		       SubCategory == ESLFItemSubCategory::Staff;
+	}
+
+	/** Category/SubCategory fallback rules (same as the original per-slot string checks) */
+	bool MatchesFamily(ESLFEquipSlotFamily Family, ESLFItemCategory Category, ESLFItemSubCategory SubCategory)
+	{
+		switch (Family)
+		{
+		case ESLFEquipSlotFamily::RightHand:
+			// Abilities category is used for weapons in test data
+			return Category == ESLFItemCategory::Weapons || Category == ESLFItemCategory::Abilities || IsWeaponSubCategory(SubCategory);
+		case ESLFEquipSlotFamily::LeftHand:
+			// Shields AND weapons (dual-wielding)
+			return Category == ESLFItemCategory::Shields || Category == ESLFItemCategory::Weapons || IsWeaponSubCategory(SubCategory);
+		case ESLFEquipSlotFamily::Head:
+			return SubCategory == ESLFItemSubCategory::Head;
+		case ESLFEquipSlotFamily::Armor:
+			return SubCategory == ESLFItemSubCategory::Chest;
+		case ESLFEquipSlotFamily::Gloves:
+			return SubCategory == ESLFItemSubCategory::Arms;
+		case ESLFEquipSlotFamily::Greaves:
+			return SubCategory == ESLFItemSubCategory::Legs;
+		case ESLFEquipSlotFamily::Trinket:
+			return SubCategory == ESLFItemSubCategory::Talismans;
+		case ESLFEquipSlotFamily::Tool:
+			// bp_only uses Tool slots for consumables and projectiles
+			return Category == ESLFItemCategory::Tools || SubCategory == ESLFItemSubCategory::Flasks || SubCategory == ESLFItemSubCategory::Projectiles;
+		default:
+			return false;
+		}
+	}
+}
+
+FGameplayTag FSLFInventoryStore::GetItemKeyTag(const UPrimaryDataAsset* Item)
+{
+	if (!Item)
+	{
+		return FGameplayTag();
+	}
+
+	if (const UPDA_Item* ItemData = AsItemData(Item))
+	{
+		if (ItemData->ItemInformation.ItemTag.IsValid())
+		{
+			return ItemData->ItemInformation.ItemTag;
+		}
+	}
+
+	// Legacy key: tag named after the asset (empty if not registered)
+	return FGameplayTag::RequestGameplayTag(Item->GetFName(), false);
+}
+
+ESLFEquipSlotFamily FSLFInventoryStore::GetSlotFamily(const FGameplayTag& EquipmentSlotTag)
+{
+	// Slot tags are a small fixed set - parse each one once
+	static TMap<FGameplayTag, ESLFEquipSlotFamily> FamilyCache;
+	check(IsInGameThread());
+
+	if (const ESLFEquipSlotFamily* Cached = FamilyCache.Find(EquipmentSlotTag))
+	{
+		return *Cached;
+	}
+
+	// e.g. "Right Hand Weapon 1" from the full tag path; check order matters
+	const FString SlotTagStr = EquipmentSlotTag.ToString();
+	ESLFEquipSlotFamily Family = ESLFEquipSlotFamily::None;
+	if (SlotTagStr.Contains(TEXT("Right Hand")))      Family = ESLFEquipSlotFamily::RightHand;
+	else if (SlotTagStr.Contains(TEXT("Left Hand")))  Family = ESLFEquipSlotFamily::LeftHand;
+	else if (SlotTagStr.Contains(TEXT("Head")))       Family = ESLFEquipSlotFamily::Head;
+	else if (SlotTagStr.Contains(TEXT("Armor")))      Family = ESLFEquipSlotFamily::Armor;
+	else if (SlotTagStr.Contains(TEXT("Gloves")))     Family = ESLFEquipSlotFamily::Gloves;
+	else if (SlotTagStr.Contains(TEXT("Greaves")))    Family = ESLFEquipSlotFamily::Greaves;
+	else if (SlotTagStr.Contains(TEXT("Trinket")))    Family = ESLFEquipSlotFamily::Trinket;
+	else if (SlotTagStr.Contains(TEXT("Tool")))       Family = ESLFEquipSlotFamily::Tool;
+
+	FamilyCache.Add(EquipmentSlotTag, Family);
+	return Family;
+}
+
+FSLFInventoryHandle FSLFInventoryStore::Add(UPrimaryDataAsset* Item, int32 Count, int32& OutNewCount)
+{
+	OutNewCount = 0;
+	if (!Item || Count <= 0)
+	{
+		return FSLFInventoryHandle();
+	}
+
+	if (const int32* Existing = AssetIndex.Find(Item))
+	{
+		FSLFInventoryEntry& Entry = Entries[*Existing];
+		Entry.Count += Count;
+		TotalCount += Count;
+		OutNewCount = Entry.Count;
+		return FSLFInventoryHandle{*Existing, Entry.Generation};
+	}
+
+	const int32 Index = FreeIndices.Num() > 0 ? FreeIndices.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+	FSLFInventoryEntry& Entry = Entries[Index];
+	Entry.Item = Item;
+	Entry.ItemTag = GetItemKeyTag(Item);
+	Entry.Count = Count;
+	TotalCount += Count;
+	IndexEntry(Index);
+
+	OutNewCount = Count;
+	return FSLFInventoryHandle{Index, Entry.Generation};
+}
+
+int32 FSLFInventoryStore::Remove(FSLFInventoryHandle Handle, int32 Count)
+{
+	if (!Get(Handle) || Count <= 0)
+	{
+		return GetCount(Handle);
+	}
+
+	FSLFInventoryEntry& Entry = Entries[Handle.Index];
+	const int32 Removed = FMath::Min(Count, Entry.Count);
+	Entry.Count -= Removed;
+	TotalCount -= Removed;
+
+	if (Entry.Count > 0)
+	{
+		return Entry.Count;
+	}
+
+	UnindexEntry(Handle.Index);
+	Entry.Item = nullptr;
+	Entry.ItemTag = FGameplayTag();
+	Entry.Generation++;
+	FreeIndices.Add(Handle.Index);
+	return 0;
+}
+
+void FSLFInventoryStore::Reset()
+{
+	Entries.Reset();
+	FreeIndices.Reset();
+	AssetIndex.Reset();
+	TagIndex.Reset();
+	CategoryIndex.Reset();
+	SubCategoryIndex.Reset();
+	EquipSlotIndex.Reset();
+	for (TSet<int32>& Bucket : FamilyIndex)
+	{
+		Bucket.Reset();
+	}
+	TotalCount = 0;
+}
+
+void FSLFInventoryStore::RebuildIndexes()
+{
+	FreeIndices.Reset();
+	AssetIndex.Reset();
+	TagIndex.Reset();
+	CategoryIndex.Reset();
+	SubCategoryIndex.Reset();
+	EquipSlotIndex.Reset();
+	for (TSet<int32>& Bucket : FamilyIndex)
+	{
+		Bucket.Reset();
+	}
+	TotalCount = 0;
+
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		FSLFInventoryEntry& Entry = Entries[Index];
+		if (Entry.Item && Entry.Count > 0)
+		{
+			TotalCount += Entry.Count;
+			IndexEntry(Index);
+		}
+		else
+		{
+			Entry.Item = nullptr;
+			FreeIndices.Add(Index);
+		}
+	}
+}
+
+void FSLFInventoryStore::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		RebuildIndexes();
+	}
+}
+
+void FSLFInventoryStore::IndexEntry(int32 Index)
+{
+	const FSLFInventoryEntry& Entry = Entries[Index];
+	AssetIndex.Add(Entry.Item, Index);
+	if (Entry.ItemTag.IsValid())
+	{
+		TagIndex.Add(Entry.ItemTag, Index);
+	}
+
+	const UPDA_Item* ItemData = AsItemData(Entry.Item);
+	if (!ItemData)
+	{
+		return;
+	}
+
+	const ESLFItemCategory Category = ItemData->ItemInformation.Category.Category;
+	const ESLFItemSubCategory SubCategory = ItemData->ItemInformation.Category.SubCategory;
+	CategoryIndex.FindOrAdd(Category).Add(Index);
+	SubCategoryIndex.FindOrAdd(SubCategory).Add(Index);
+
+	const FGameplayTagContainer& EquipSlots = ItemData->ItemInformation.EquipmentDetails.EquipSlots;
+	if (EquipSlots.Num() > 0)
+	{
+		// Index each slot tag and its parents so lookups keep FGameplayTagContainer::HasTag semantics
+		for (const FGameplayTag& SlotTag : EquipSlots.GetGameplayTagParents())
+		{
+			EquipSlotIndex.FindOrAdd(SlotTag).Add(Index);
+		}
+		return;
+	}
+
+	for (int32 Family = 1; Family < static_cast<int32>(ESLFEquipSlotFamily::Num); ++Family)
+	{
+		if (MatchesFamily(static_cast<ESLFEquipSlotFamily>(Family), Category, SubCategory))
+		{
+			FamilyIndex[Family].Add(Index);
+		}
+	}
+}
+
+void FSLFInventoryStore::UnindexEntry(int32 Index)
+{
+	const FSLFInventoryEntry& Entry = Entries[Index];
+	AssetIndex.Remove(Entry.Item);
+	if (Entry.ItemTag.IsValid())
+	{
+		TagIndex.RemoveSingle(Entry.ItemTag, Index);
+	}
+
+	const UPDA_Item* ItemData = AsItemData(Entry.Item);
+	if (!ItemData)
+	{
+		return;
+	}
+
+	if (TSet<int32>* Bucket = CategoryIndex.Find(ItemData->ItemInformation.Category.Category))
+	{
+		Bucket->Remove(Index);
+	}
+	if (TSet<int32>* Bucket = SubCategoryIndex.Find(ItemData->ItemInformation.Category.SubCategory))
+	{
+		Bucket->Remove(Index);
+	}
+	for (const FGameplayTag& SlotTag : ItemData->ItemInformation.EquipmentDetails.EquipSlots.GetGameplayTagParents())
+	{
+		if (TSet<int32>* Bucket = EquipSlotIndex.Find(SlotTag))
+		{
+			Bucket->Remove(Index);
+		}
+	}
+	for (TSet<int32>& Bucket : FamilyIndex)
+	{
+		Bucket.Remove(Index);
+	}
+}
+
+FSLFInventoryHandle FSLFInventoryStore::FindByAsset(const UPrimaryDataAsset* Item) const
+{
+	if (const int32* Index = AssetIndex.Find(Item))
+	{
+		return FSLFInventoryHandle{*Index, Entries[*Index].Generation};
+	}
+	return FSLFInventoryHandle();
+}
+
+FSLFInventoryHandle FSLFInventoryStore::FindByTag(const FGameplayTag& ItemTag) const
+{
+	if (const int32* Index = TagIndex.Find(ItemTag))
+	{
+		return FSLFInventoryHandle{*Index, Entries[*Index].Generation};
+	}
+	return FSLFInventoryHandle();
+}
+
+int32 FSLFInventoryStore::GetCountMatchingTag(const FGameplayTag& Tag, TArray<FSLFInventoryHandle>* OutHandles) const
+{
+	if (!Tag.IsValid())
+	{
+		return 0;
+	}
+
+	// Exact item tag - the common case for crafting materials and keys
+	TArray<int32, TInlineAllocator<2>> Holders;
+	TagIndex.MultiFind(Tag, Holders, true);
+	if (Holders.Num() > 0)
+	{
+		int32 ExactTotal = 0;
+		for (const int32 Index : Holders)
+		{
+			const FSLFInventoryEntry& Entry = Entries[Index];
+			ExactTotal += Entry.Count;
+			if (OutHandles)
+			{
+				OutHandles->Add(FSLFInventoryHandle{Index, Entry.Generation});
+			}
+		}
+		return ExactTotal;
+	}
+
+	// Parent tag query - only the tag index needs walking, not the item data
+	int32 Total = 0;
+	for (const TPair<FGameplayTag, int32>& Pair : TagIndex)
+	{
+		if (Pair.Key.MatchesTag(Tag))
+		{
+			const FSLFInventoryEntry& Entry = Entries[Pair.Value];
+			Total += Entry.Count;
+			if (OutHandles)
+			{
+				OutHandles->Add(FSLFInventoryHandle{Pair.Value, Entry.Generation});
+			}
+		}
+	}
+	return Total;
+}
+
+const FSLFInventoryEntry* FSLFInventoryStore::Get(FSLFInventoryHandle Handle) const
+{
+	if (!Entries.IsValidIndex(Handle.Index))
+	{
+		return nullptr;
+	}
+	const FSLFInventoryEntry& Entry = Entries[Handle.Index];
+	return (Entry.Item && Entry.Generation == Handle.Generation) ? &Entry : nullptr;
+}
+
+int32 FSLFInventoryStore::GetCount(FSLFInventoryHandle Handle) const
+{
+	const FSLFInventoryEntry* Entry = Get(Handle);
+	return Entry ? Entry->Count : 0;
+}
+
+void FSLFInventoryStore::GetByCategory(ESLFItemCategory Category, TArray<FSLFInventoryHandle>& OutHandles) const
+{
+	if (const TSet<int32>* Bucket = CategoryIndex.Find(Category))
+	{
+		OutHandles.Reserve(OutHandles.Num() + Bucket->Num());
+		for (int32 Index : *Bucket)
+		{
+			OutHandles.Add(FSLFInventoryHandle{Index, Entries[Index].Generation});
+		}
+	}
+}
+
+void FSLFInventoryStore::GetBySubCategory(ESLFItemSubCategory SubCategory, TArray<FSLFInventoryHandle>& OutHandles) const
+{
+	if (const TSet<int32>* Bucket = SubCategoryIndex.Find(SubCategory))
+	{
+		OutHandles.Reserve(OutHandles.Num() + Bucket->Num());
+		for (int32 Index : *Bucket)
+		{
+			OutHandles.Add(FSLFInventoryHandle{Index, Entries[Index].Generation});
+		}
+	}
+}
+
+void FSLFInventoryStore::GetForEquipSlot(const FGameplayTag& EquipmentSlotTag, TArray<UPrimaryDataAsset*>& OutItems) const
+{
+	if (const TSet<int32>* Bucket = EquipSlotIndex.Find(EquipmentSlotTag))
+	{
+		for (int32 Index : *Bucket)
+		{
+			OutItems.Add(Entries[Index].Item);
+		}
+	}
+
+	const ESLFEquipSlotFamily Family = GetSlotFamily(EquipmentSlotTag);
+	if (Family != ESLFEquipSlotFamily::None)
+	{
+		for (int32 Index : FamilyIndex[static_cast<int32>(Family)])
+		{
+			OutItems.Add(Entries[Index].Item);
+		}
+	}
+}
@@ -0,0 +1,185 @@
+// SLFInventoryStore.h
+// Counted, indexed item container backing UAC_InventoryManager
+//
+// Entries live in a slot array addressed by stable handles (index + generation).
+// Secondary indexes by asset, item tag, category, subcategory and equip slot
+// keep every query O(1) or O(matches) instead of scanning the whole inventory.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "SLFEnums.h"
+#include "SLFInventoryStore.generated.h"
+
+class UPrimaryDataAsset;
+
+/**
+ * Stable reference to an entry in an FSLFInventoryStore.
+ * Generation is bumped whenever a slot is freed, so stale handles never alias a new item.
+ */
+USTRUCT(BlueprintType)
+struct SLFCONVERSION_API FSLFInventoryHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+	int32 Generation = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	bool operator==(const FSLFInventoryHandle& Other) const
+	{
+		return Index == Other.Index && Generation == Other.Generation;
+	}
+
+	friend uint32 GetTypeHash(const FSLFInventoryHandle& Handle)
+	{
+		return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation));
+	}
+};
+
+/** One stack of a single item asset */
+USTRUCT()
+struct SLFCONVERSION_API FSLFInventoryEntry
+{
+	GENERATED_BODY()
+
+	/** Item asset (nullptr when the slot is free) */
+	UPROPERTY()
+	UPrimaryDataAsset* Item = nullptr;
+
+	/** Key tag - ItemInformation.ItemTag for UPDA_Item, asset-name tag otherwise */
+	UPROPERTY()
+	FGameplayTag ItemTag;
+
+	UPROPERTY()
+	int32 Count = 0;
+
+	UPROPERTY()
+	int32 Generation = 0;
+};
+
+/**
+ * Equip-slot families used when an item has no explicit EquipSlots tags.
+ * Mirrors the Category/SubCategory fallback rules from the original
+ * GetItemsForEquipmentSlot string matching.
+ */
+enum class ESLFEquipSlotFamily : uint8
+{
+	None,
+	RightHand,
+	LeftHand,
+	Head,
+	Armor,
+	Gloves,
+	Greaves,
+	Trinket,
+	Tool,
+	Num
+};
+
+/**
+ * FSLFInventoryStore - counted item container with secondary indexes.
+ *
+ * Only Entries is reflected (keeps assets alive for GC and survives copies);
+ * all indexes are transient and rebuilt by RebuildIndexes() from PostSerialize,
+ * so loads, duplication and undo all come back with working queries.
+ */
+USTRUCT()
+struct SLFCONVERSION_API FSLFInventoryStore
+{
+	GENERATED_BODY()
+
+	/** Add Count of Item, stacking onto an existing entry. Returns the entry handle. */
+	FSLFInventoryHandle Add(UPrimaryDataAsset* Item, int32 Count, int32& OutNewCount);
+
+	/** Remove up to Count from the entry. Frees the slot at zero. Returns the remaining count. */
+	int32 Remove(FSLFInventoryHandle Handle, int32 Count);
+
+	/** Drop every entry and index */
+	void Reset();
+
+	/** Rebuild all transient indexes from Entries (after load or copy) */
+	void RebuildIndexes();
+
+	/** Tagged property serialization only restores Entries; rebuild the indexes on load */
+	void PostSerialize(const FArchive& Ar);
+
+	FSLFInventoryHandle FindByAsset(const UPrimaryDataAsset* Item) const;
+	FSLFInventoryHandle FindByTag(const FGameplayTag& ItemTag) const;
+
+	/** Sum counts of every entry whose item tag matches Tag (exact hit is O(holders)) */
+	int32 GetCountMatchingTag(const FGameplayTag& Tag, TArray<FSLFInventoryHandle>* OutHandles = nullptr) const;
+
+	const FSLFInventoryEntry* Get(FSLFInventoryHandle Handle) const;
+	int32 GetCount(FSLFInventoryHandle Handle) const;
+	int32 GetCount(const UPrimaryDataAsset* Item) const { return GetCount(FindByAsset(Item)); }
+
+	/** Number of distinct stacks */
+	int32 Num() const { return AssetIndex.Num(); }
+
+	/** Sum of all stack counts */
+	int32 GetTotalCount() const { return TotalCount; }
+
+	void GetByCategory(ESLFItemCategory Category, TArray<FSLFInventoryHandle>& OutHandles) const;
+	void GetBySubCategory(ESLFItemSubCategory SubCategory, TArray<FSLFInventoryHandle>& OutHandles) const;
+
+	/** Items that can go in EquipmentSlotTag: explicit EquipSlots matches plus category fallback */
+	void GetForEquipSlot(const FGameplayTag& EquipmentSlotTag, TArray<UPrimaryDataAsset*>& OutItems) const;
+
+	/** Visit every live entry in slot order */
+	template <typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for (int32 Index = 0; Index < Entries.Num(); ++Index)
+		{
+			const FSLFInventoryEntry& Entry = Entries[Index];
+			if (Entry.Item)
+			{
+				Func(FSLFInventoryHandle{Index, Entry.Generation}, Entry);
+			}
+		}
+	}
+
+	/** Key tag used for an item (also the key of UAC_InventoryManager::Items) */
+	static FGameplayTag GetItemKeyTag(const UPrimaryDataAsset* Item);
+
+	/** Which fallback family an equipment slot tag belongs to (cached per tag) */
+	static ESLFEquipSlotFamily GetSlotFamily(const FGameplayTag& EquipmentSlotTag);
+
+private:
+	void IndexEntry(int32 Index);
+	void UnindexEntry(int32 Index);
+
+	UPROPERTY()
+	TArray<FSLFInventoryEntry> Entries;
+
+	TArray<int32> FreeIndices;
+	TMap<const UPrimaryDataAsset*, int32> AssetIndex;
+
+	/** Several items may share an ItemTag; every holder stays indexed so removing one keeps the rest findable */
+	TMultiMap<FGameplayTag, int32> TagIndex;
+	TMap<ESLFItemCategory, TSet<int32>> CategoryIndex;
+	TMap<ESLFItemSubCategory, TSet<int32>> SubCategoryIndex;
+
+	/** Explicit EquipSlots tags (and their parents, to keep HasTag semantics) -> entries */
+	TMap<FGameplayTag, TSet<int32>> EquipSlotIndex;
+
+	/** Entries without explicit EquipSlots, bucketed by the family rules they satisfy */
+	TSet<int32> FamilyIndex[static_cast<int32>(ESLFEquipSlotFamily::Num)];
+
+	int32 TotalCount = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FSLFInventoryStore> : public TStructOpsTypeTraitsBase2<FSLFInventoryStore>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
+};
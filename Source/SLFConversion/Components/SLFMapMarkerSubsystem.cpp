@@ -0,0 +1,275 @@
+// SLFMapMarkerSubsystem.cpp
+// World registry of radar / world map marker sources
+
+#include "Components/SLFMapMarkerSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/Texture2D.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+USLFMapMarkerSubsystem* USLFMapMarkerSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<USLFMapMarkerSubsystem>() : nullptr;
+}
+
+bool USLFMapMarkerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USLFMapMarkerSubsystem::Deinitialize()
+{
+	for (TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& Load : IconLoads)
+	{
+		if (Load.Value.IsValid())
+		{
+			Load.Value->CancelHandle();
+		}
+	}
+	IconLoads.Empty();
+
+	Super::Deinitialize();
+}
+
+FSLFMapMarkerHandle USLFMapMarkerSubsystem::RegisterMarker(const FSLFMapMarkerDesc& Desc)
+{
+	FSLFMapMarkerHandle Handle;
+	AActor* Source = Desc.Source.Get();
+	if (!Source || Desc.Channels == ESLFMapMarkerChannel::None)
+	{
+		return Handle;
+	}
+
+	if (FreeIds.Num() > 0)
+	{
+		Handle.Id = FreeIds.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Handle.Id = IdToDense.AddUninitialized();
+		IdSerials.Add(0);
+	}
+
+	// Serial 0 is never handed out, so a default handle never matches
+	uint32& Serial = IdSerials[Handle.Id];
+	Serial = Serial == MAX_uint32 ? 1 : Serial + 1;
+	Handle.Serial = Serial;
+
+	const int32 DenseIndex = Descs.Add(Desc);
+	const FVector Location = Source->GetActorLocation();
+	LocX.Add(static_cast<float>(Location.X));
+	LocY.Add(static_cast<float>(Location.Y));
+	DenseToId.Add(Handle.Id);
+	IdToDense[Handle.Id] = DenseIndex;
+
+	RequestIcon(Desc.Icon);
+
+	++Revision;
+	return Handle;
+}
+
+void USLFMapMarkerSubsystem::RequestIcon(const TSoftObjectPtr<UTexture2D>& Icon)
+{
+	const FSoftObjectPath& IconPath = Icon.ToSoftObjectPath();
+	if (IconPath.IsNull() || IconLoads.Contains(IconPath))
+	{
+		return;
+	}
+
+	TWeakObjectPtr<USLFMapMarkerSubsystem> WeakThis(this);
+	IconLoads.Add(IconPath, UAssetManager::GetStreamableManager().RequestAsyncLoad(IconPath,
+		FStreamableDelegate::CreateLambda([WeakThis]()
+		{
+			if (USLFMapMarkerSubsystem* This = WeakThis.Get())
+			{
+				++This->Revision;
+			}
+		})));
+}
+
+void USLFMapMarkerSubsystem::UnregisterMarker(FSLFMapMarkerHandle& Handle)
+{
+	if (IsRegistered(Handle))
+	{
+		RemoveAtDense(IdToDense[Handle.Id]);
+	}
+	Handle.Reset();
+}
+
+bool USLFMapMarkerSubsystem::IsRegistered(const FSLFMapMarkerHandle& Handle) const
+{
+	return IdToDense.IsValidIndex(Handle.Id) && IdToDense[Handle.Id] != INDEX_NONE && IdSerials[Handle.Id] == Handle.Serial;
+}
+
+void USLFMapMarkerSubsystem::RemoveAtDense(int32 DenseIndex)
+{
+	const int32 RemovedId = DenseToId[DenseIndex];
+	const int32 LastIndex = Descs.Num() - 1;
+
+	// Swap-remove keeps the arrays packed; the moved marker's id now points at the hole
+	if (DenseIndex != LastIndex)
+	{
+		IdToDense[DenseToId[LastIndex]] = DenseIndex;
+	}
+
+	Descs.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	LocX.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	LocY.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	DenseToId.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+
+	IdToDense[RemovedId] = INDEX_NONE;
+	FreeIds.Add(RemovedId);
+	++Revision;
+}
+
+int32 USLFMapMarkerSubsystem::GatherMarkers(ESLFMapMarkerChannel Channel, FSLFMapMarkerSnapshot& Out)
+{
+	Out.X.Reset();
+	Out.Y.Reset();
+	Out.Indices.Reset();
+
+	// Walk backwards so swap-removing a destroyed source never skips an entry
+	for (int32 Index = Descs.Num() - 1; Index >= 0; --Index)
+	{
+		const FSLFMapMarkerDesc& Desc = Descs[Index];
+		const AActor* Source = Desc.Source.Get();
+		if (!Source)
+		{
+			RemoveAtDense(Index);
+			continue;
+		}
+
+		if (!Desc.bStatic)
+		{
+			const FVector Location = Source->GetActorLocation();
+			LocX[Index] = static_cast<float>(Location.X);
+			LocY[Index] = static_cast<float>(Location.Y);
+		}
+	}
+
+	Out.X.Reserve(Descs.Num());
+	Out.Y.Reserve(Descs.Num());
+	Out.Indices.Reserve(Descs.Num());
+
+	for (int32 Index = 0; Index < Descs.Num(); ++Index)
+	{
+		if (EnumHasAnyFlags(Descs[Index].Channels, Channel))
+		{
+			Out.X.Add(LocX[Index]);
+			Out.Y.Add(LocY[Index]);
+			Out.Indices.Add(Index);
+		}
+	}
+
+	return Out.Num();
+}
+
+int32 USLFMapMarkerSubsystem::GatherMarkers(TConstArrayView<FSLFMapMarkerHandle> Handles, FSLFMapMarkerSnapshot& Out)
+{
+	Out.X.Reset(Handles.Num());
+	Out.Y.Reset(Handles.Num());
+	Out.Indices.Reset(Handles.Num());
+
+	// No pruning here - a swap-remove would move markers already copied into Out;
+	// the channel gather and UnregisterMarker drop destroyed sources
+	for (const FSLFMapMarkerHandle& Handle : Handles)
+	{
+		if (!IsRegistered(Handle))
+		{
+			continue;
+		}
+
+		const int32 Index = IdToDense[Handle.Id];
+		const FSLFMapMarkerDesc& Desc = Descs[Index];
+		const AActor* Source = Desc.Source.Get();
+		if (!Source)
+		{
+			continue;
+		}
+
+		if (!Desc.bStatic)
+		{
+			const FVector Location = Source->GetActorLocation();
+			LocX[Index] = static_cast<float>(Location.X);
+			LocY[Index] = static_cast<float>(Location.Y);
+		}
+
+		Out.X.Add(LocX[Index]);
+		Out.Y.Add(LocY[Index]);
+		Out.Indices.Add(Index);
+	}
+
+	return Out.Num();
+}
+
+void USLFMapMarkerSubsystem::ForEachMarker(ESLFMapMarkerChannel Channel, TFunctionRef<void(const FSLFMapMarkerDesc&)> Visitor) const
+{
+	for (const FSLFMapMarkerDesc& Desc : Descs)
+	{
+		if (Desc.Source.IsValid() && EnumHasAnyFlags(Desc.Channels, Channel))
+		{
+			Visitor(Desc);
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// BATCHED PROJECTION
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void USLFMapMarkerSubsystem::ProjectToRadar(const float* RESTRICT X, const float* RESTRICT Y, int32 Num,
+	const FVector2f& ViewOrigin, float ViewYawDegrees, float Radius, float ClampLength,
+	FVector2f* RESTRICT OutPositions)
+{
+	if (Radius <= 0.0f || ClampLength <= 0.0f)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			OutPositions[Index] = FVector2f::ZeroVector;
+		}
+		return;
+	}
+
+	float SinYaw, CosYaw;
+	FMath::SinCos(&SinYaw, &CosYaw, FMath::DegreesToRadians(ViewYawDegrees));
+	const float Scale = ClampLength / Radius;
+	const float OriginX = ViewOrigin.X;
+	const float OriginY = ViewOrigin.Y;
+
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const float DX = X[Index] - OriginX;
+		const float DY = Y[Index] - OriginY;
+
+		// Unrotate by yaw: forward -> radar up, right -> radar right
+		const float Forward = CosYaw * DX + SinYaw * DY;
+		const float Right = CosYaw * DY - SinYaw * DX;
+
+		const float RadarX = Right * Scale;
+		const float RadarY = -Forward * Scale;
+
+		// Clamp to the radar edge without branching: k = Clamp / max(Length, Clamp)
+		const float Length = FMath::Sqrt(RadarX * RadarX + RadarY * RadarY);
+		const float Fit = ClampLength / FMath::Max(Length, ClampLength);
+
+		OutPositions[Index].X = RadarX * Fit;
+		OutPositions[Index].Y = RadarY * Fit;
+	}
+}
+
+void USLFMapMarkerSubsystem::ProjectToMapView(const FVector2f* RESTRICT MapUV, int32 Num,
+	const FVector2f& ViewCenterUV, float Zoom, FVector2f* RESTRICT OutPositions)
+{
+	// (UV - Center) * Zoom + 0.5 folded into one multiply-add per axis
+	const float OffsetX = 0.5f - ViewCenterUV.X * Zoom;
+	const float OffsetY = 0.5f - ViewCenterUV.Y * Zoom;
+
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		OutPositions[Index].X = MapUV[Index].X * Zoom + OffsetX;
+		OutPositions[Index].Y = MapUV[Index].Y * Zoom + OffsetY;
+	}
+}
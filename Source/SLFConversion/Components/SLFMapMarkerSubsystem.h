@@ -0,0 +1,162 @@
+// SLFMapMarkerSubsystem.h
+// World registry of radar / world map marker sources
+//
+// Actors that should appear on the radar or the world map register once (BeginPlay,
+// StartTrackElement) instead of being found by world iteration every refresh.
+// Markers are kept densely packed so a consumer gathers their 2D locations into
+// flat float arrays and projects them all in one loop (see ProjectToRadar /
+// ProjectToMapView), then hands the result to a USLFMarkerLayer for a single paint pass.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SLFMapMarkerSubsystem.generated.h"
+
+class AActor;
+class UTexture2D;
+struct FStreamableHandle;
+
+/** Which views a marker shows up on */
+enum class ESLFMapMarkerChannel : uint8
+{
+	None     = 0,
+	Radar    = 1 << 0,
+	WorldMap = 1 << 1,
+};
+ENUM_CLASS_FLAGS(ESLFMapMarkerChannel);
+
+/** What registered the marker (consumers cast Source accordingly) */
+enum class ESLFMapMarkerKind : uint8
+{
+	Generic,
+	RadarElement,
+	RestPoint,
+	DungeonEntrance,
+};
+
+/** Registration data for one marker */
+struct FSLFMapMarkerDesc
+{
+	/** Actor the marker follows */
+	TWeakObjectPtr<AActor> Source;
+
+	ESLFMapMarkerChannel Channels = ESLFMapMarkerChannel::None;
+	ESLFMapMarkerKind Kind = ESLFMapMarkerKind::Generic;
+
+	/** Location is sampled once at registration (placed rest points, doors) */
+	bool bStatic = false;
+
+	/** Loaded asynchronously on registration; consumers draw a placeholder while Icon.Get() is null */
+	TSoftObjectPtr<UTexture2D> Icon;
+	FLinearColor Tint = FLinearColor::White;
+	FVector2f Size = FVector2f(32.0f, 32.0f);
+};
+
+/**
+ * Stable id for a registered marker (survives other markers being removed).
+ * Ids are recycled; Serial tells a stale handle apart from the marker now using its id.
+ */
+struct FSLFMapMarkerHandle
+{
+	int32 Id = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsValid() const { return Id != INDEX_NONE; }
+	void Reset() { Id = INDEX_NONE; Serial = 0; }
+};
+
+/** Packed 2D locations of the markers on one channel, as filled by GatherMarkers */
+struct FSLFMapMarkerSnapshot
+{
+	TArray<float> X;
+	TArray<float> Y;
+
+	/** Dense registry index of each gathered marker (for GetMarkerDesc) */
+	TArray<int32> Indices;
+
+	int32 Num() const { return Indices.Num(); }
+};
+
+UCLASS()
+class SLFCONVERSION_API USLFMapMarkerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Registry for the given object's world (nullptr outside game / PIE worlds) */
+	static USLFMapMarkerSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Add a marker. Returns a handle for UnregisterMarker. */
+	FSLFMapMarkerHandle RegisterMarker(const FSLFMapMarkerDesc& Desc);
+
+	/** Remove a marker and reset the handle (no-op for an invalid handle) */
+	void UnregisterMarker(FSLFMapMarkerHandle& Handle);
+
+	bool IsRegistered(const FSLFMapMarkerHandle& Handle) const;
+
+	int32 GetNumMarkers() const { return Descs.Num(); }
+
+	/** Bumped whenever markers are added or removed or an icon finishes loading (consumers rebuild cached styles on change) */
+	uint32 GetRevision() const { return Revision; }
+
+	/**
+	 * Drop markers whose source was destroyed, refresh dynamic locations and copy the
+	 * markers on Channel into Out (packed, registration order). Returns the marker count.
+	 */
+	int32 GatherMarkers(ESLFMapMarkerChannel Channel, FSLFMapMarkerSnapshot& Out);
+
+	/**
+	 * Refresh the locations of just the given markers and copy them into Out (handle order).
+	 * Stale handles and destroyed sources are skipped. Returns the marker count.
+	 */
+	int32 GatherMarkers(TConstArrayView<FSLFMapMarkerHandle> Handles, FSLFMapMarkerSnapshot& Out);
+
+	const FSLFMapMarkerDesc& GetMarkerDesc(int32 DenseIndex) const { return Descs[DenseIndex]; }
+
+	/** Visit every live marker on Channel */
+	void ForEachMarker(ESLFMapMarkerChannel Channel, TFunctionRef<void(const FSLFMapMarkerDesc&)> Visitor) const;
+
+	// ═══════════════════════════════════════════════════════════════════
+	// BATCHED PROJECTION
+	// ═══════════════════════════════════════════════════════════════════
+
+	/**
+	 * World XY -> radar offsets (same math as URadarManagerComponent::CalculateRadarPosition):
+	 * unrotate by the view yaw, scale Radius to ClampLength, clamp to ClampLength.
+	 * Branch-free over flat arrays so the compiler can vectorize it.
+	 */
+	static void ProjectToRadar(const float* RESTRICT X, const float* RESTRICT Y, int32 Num,
+		const FVector2f& ViewOrigin, float ViewYawDegrees, float Radius, float ClampLength,
+		FVector2f* RESTRICT OutPositions);
+
+	/** Full map UV -> viewport UV for the world map's zoom / pan: (UV - ViewCenter) * Zoom + 0.5 */
+	static void ProjectToMapView(const FVector2f* RESTRICT MapUV, int32 Num,
+		const FVector2f& ViewCenterUV, float Zoom, FVector2f* RESTRICT OutPositions);
+
+	// UWorldSubsystem
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	void RemoveAtDense(int32 DenseIndex);
+
+	/** Start loading a marker icon once per texture; completion bumps Revision */
+	void RequestIcon(const TSoftObjectPtr<UTexture2D>& Icon);
+
+	/** Packed marker data (dense, swap-removed) */
+	TArray<FSLFMapMarkerDesc> Descs;
+	TArray<float> LocX;
+	TArray<float> LocY;
+	TArray<int32> DenseToId;
+
+	/** Handle id -> dense index (INDEX_NONE = free) and the serial of the marker holding it */
+	TArray<int32> IdToDense;
+	TArray<uint32> IdSerials;
+	TArray<int32> FreeIds;
+
+	/** Icon loads, kept so loaded icons stay resident while markers use them */
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> IconLoads;
+
+	uint32 Revision = 0;
+};
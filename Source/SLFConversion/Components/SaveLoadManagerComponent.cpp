@@ -199,16 +199,13 @@ void USaveLoadManagerComponent::SerializeAllData_Implementation()
 	if (PawnInventoryManager)
 	{
 		// Pawn's UAC_InventoryManager is the LIVE component - items picked up go here
-		// Items is TMap<FGameplayTag, UPrimaryDataAsset*>
-		for (const auto& ItemEntry : PawnInventoryManager->Items)
+		// Its inventory store tracks real stack counts
+		TArray<FSLFInventoryItemsSaveInfo> PawnItems;
+		PawnInventoryManager->GetItemsSaveInfo(ESLFInventorySlotType::InventorySlot, PawnItems);
+		SaveData.InventoryData.Reserve(PawnItems.Num());
+		for (const FSLFInventoryItemsSaveInfo& SaveInfo : PawnItems)
 		{
-			if (ItemEntry.Value)
-			{
-				FSLFInventoryItemsSaveInfo SaveInfo;
-				SaveInfo.Item = ItemEntry.Value;
-				SaveInfo.Amount = 1; // Tag-based map doesn't track quantity, default to 1
-				SaveData.InventoryData.Add(FInstancedStruct::Make<FSLFInventoryItemsSaveInfo>(SaveInfo));
-			}
+			SaveData.InventoryData.Add(FInstancedStruct::Make<FSLFInventoryItemsSaveInfo>(SaveInfo));
 		}
 		CurrencyToSave = PawnInventoryManager->Currency;
 		UE_LOG(LogTemp, Log, TEXT("[SaveLoadManager] Serialized %d items from PAWN InventoryManager, Currency=%d"),
@@ -485,8 +482,9 @@ void USaveLoadManagerComponent::ApplyLoadedData_Implementation()
 	// ═══════════════════════════════════════════════════════════════════════
 	if (PawnInventoryManager)
 	{
-		// Clear existing and restore items to Pawn's inventory
-		PawnInventoryManager->Items.Empty();
+		// Collect items, then replace the Pawn's inventory in one batched update
+		TArray<FSLFInventoryItemsSaveInfo> LoadedItems;
+		LoadedItems.Reserve(SaveData.InventoryData.Num());
 
 		for (const FInstancedStruct& Entry : SaveData.InventoryData)
 		{
@@ -494,13 +492,11 @@ void USaveLoadManagerComponent::ApplyLoadedData_Implementation()
 			{
 				if (LoadedItem->Item)
 				{
-					UPrimaryDataAsset* PDA = Cast<UPrimaryDataAsset>(LoadedItem->Item);
-					if (PDA)
+					if (Cast<UPrimaryDataAsset>(LoadedItem->Item))
 					{
-						// AddItem handles internal tag map and UI updates
-						PawnInventoryManager->AddItem(PDA, LoadedItem->Amount, false);
+						LoadedItems.Add(*LoadedItem);
 						UE_LOG(LogTemp, Log, TEXT("[SaveLoadManager] Restored item to PAWN: %s x%d"),
-							*PDA->GetName(), LoadedItem->Amount);
+							*LoadedItem->Item->GetName(), LoadedItem->Amount);
 					}
 				}
 				else
@@ -511,6 +507,9 @@ void USaveLoadManagerComponent::ApplyLoadedData_Implementation()
 				}
 			}
 		}
+
+		// InitializeLoadedInventory clears the store and handles tag view + UI updates
+		PawnInventoryManager->InitializeLoadedInventory(LoadedItems);
 		UE_LOG(LogTemp, Log, TEXT("[SaveLoadManager] Applied %d items to PAWN InventoryManager"), SaveData.InventoryData.Num());
 	}
 	else if (UInventoryManagerComponent* InvMgr = Cast<UInventoryManagerComponent>(InventoryManager))
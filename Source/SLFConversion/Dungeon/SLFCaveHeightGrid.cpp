@@ -0,0 +1,103 @@
+// SLFCaveHeightGrid.cpp
+
+#include "SLFCaveHeightGrid.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	constexpr uint32 HeightGridMagic = 0x48464C53; // "SLFH"
+	constexpr int32 HeightGridVersion = 3;
+
+	/** Layout bounds are rounded through the JSON; small drift between builds keeps the grid */
+	constexpr float BoundsTolerance = 100.0f;
+}
+
+FSLFCaveHeightGrid::FSLFCaveHeightGrid(const FBox& InBounds, uint64 InSourceHash, float InCellSize)
+	: Bounds(InBounds)
+	, SourceHash(InSourceHash)
+	, CellSize(FMath::Max(InCellSize, 0.01f))
+{
+}
+
+FIntVector FSLFCaveHeightGrid::GetCell(const FVector& Probe) const
+{
+	// World-aligned so cells stay stable when the bounds grow slightly between builds
+	return FIntVector(
+		FMath::FloorToInt32(Probe.X / CellSize),
+		FMath::FloorToInt32(Probe.Y / CellSize),
+		FMath::FloorToInt32(Probe.Z / CellSize));
+}
+
+FVector FSLFCaveHeightGrid::GetCellCenter(const FIntVector& Cell) const
+{
+	return (FVector(Cell) + FVector(0.5f)) * CellSize;
+}
+
+bool FSLFCaveHeightGrid::Covers(const FVector& Probe) const
+{
+	return Bounds.IsValid && Probe.X >= Bounds.Min.X && Probe.X <= Bounds.Max.X && Probe.Y >= Bounds.Min.Y && Probe.Y <= Bounds.Max.Y;
+}
+
+bool FSLFCaveHeightGrid::IsCompatible(const FBox& InBounds, uint64 InSourceHash, float InCellSize) const
+{
+	return Bounds.IsValid && InBounds.IsValid
+		&& SourceHash == InSourceHash && CellSize == InCellSize
+		&& Bounds.Min.Equals(InBounds.Min, BoundsTolerance) && Bounds.Max.Equals(InBounds.Max, BoundsTolerance);
+}
+
+FArchive& operator<<(FArchive& Ar, FSLFCaveHeightGrid& Grid)
+{
+	uint32 Magic = HeightGridMagic;
+	int32 Version = HeightGridVersion;
+	Ar << Magic << Version;
+	if (Ar.IsLoading() && (Magic != HeightGridMagic || Version != HeightGridVersion))
+	{
+		Ar.SetError();
+		return Ar;
+	}
+
+	uint8 bBoundsValid = Grid.Bounds.IsValid;
+	Ar << Grid.Bounds.Min << Grid.Bounds.Max << bBoundsValid;
+	Grid.Bounds.IsValid = bBoundsValid;
+
+	Ar << Grid.SourceHash << Grid.CellSize << Grid.Samples;
+	return Ar;
+}
+
+bool FSLFCaveHeightGrid::SaveToFile(const FString& Path) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << const_cast<FSLFCaveHeightGrid&>(*this);
+	return FFileHelper::SaveArrayToFile(Bytes, *Path);
+}
+
+bool FSLFCaveHeightGrid::LoadFromFile(const FString& Path)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FSLFCaveHeightGrid Loaded;
+	FMemoryReader Reader(Bytes);
+	Reader << Loaded;
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[CaveMaze] Ignoring incompatible height grid: %s"), *Path);
+		return false;
+	}
+
+	*this = MoveTemp(Loaded);
+	return true;
+}
+
+FString FSLFCaveHeightGrid::GetGridPath(int32 DungeonIndex)
+{
+	return FPaths::ProjectDir() / TEXT("MapCapture") /
+		FString::Printf(TEXT("dungeon_%02d_heights.bin"), DungeonIndex + 1);
+}
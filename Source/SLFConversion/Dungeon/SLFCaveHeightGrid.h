@@ -0,0 +1,88 @@
+// SLFCaveHeightGrid.h
+// Sparse floor/ceiling height cache for cave maze builds.
+// World-aligned cubic cells of DefaultCellSize over the layout's bounds (cells are 3D because
+// rooms sit at different heights). A cell is traced once, from its center, the first time a
+// wall probe lands in it, and every other wall in the cell reuses that answer - so even the
+// first build traces once per occupied cell rather than once per wall. The grid is saved next
+// to the layout JSON, keyed by a hash of the layout and of the static collision geometry the
+// traces hit, so a repeat build of an unchanged dungeon skips tracing entirely.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Floor / ceiling at one grid cell. Misses keep the trace sentinels (FLT_MIN floor, FLT_MAX ceiling):
+ * a cached miss is a known miss and resolves to the builder's default heights without tracing again.
+ */
+struct FSLFCaveHeightSample
+{
+	float FloorZ = FLT_MIN;
+	float CeilingZ = FLT_MAX;
+
+	bool HasFloor() const { return FloorZ != FLT_MIN; }
+	bool HasCeiling() const { return CeilingZ != FLT_MAX; }
+
+	friend FArchive& operator<<(FArchive& Ar, FSLFCaveHeightSample& Sample)
+	{
+		return Ar << Sample.FloorZ << Sample.CeilingZ;
+	}
+};
+
+/** Work done by one height resolution pass */
+struct FSLFCaveHeightStats
+{
+	int32 Probes = 0;
+	int32 CellsTraced = 0;
+	int32 CellsReused = 0;
+	int32 FallbackTraces = 0;
+	double Seconds = 0.0;
+};
+
+class SLFCONVERSION_API FSLFCaveHeightGrid
+{
+public:
+	/** Cell edge in cm; floors are sampled at this spacing, well under a wall's own length */
+	static constexpr float DefaultCellSize = 200.0f;
+
+	FSLFCaveHeightGrid() = default;
+	FSLFCaveHeightGrid(const FBox& InBounds, uint64 InSourceHash, float InCellSize = DefaultCellSize);
+
+	/** Cell containing a probe (the probe snapped to the cell size on all three axes) */
+	FIntVector GetCell(const FVector& Probe) const;
+
+	/** World-space center of a cell - where its floor and ceiling are traced from */
+	FVector GetCellCenter(const FIntVector& Cell) const;
+
+	/** Probe lies inside the bounds the grid was built for */
+	bool Covers(const FVector& Probe) const;
+
+	const FSLFCaveHeightSample* Find(const FIntVector& Cell) const { return Samples.Find(Cell); }
+	void Add(const FIntVector& Cell, const FSLFCaveHeightSample& Sample) { Samples.Add(Cell, Sample); }
+	int32 Num() const { return Samples.Num(); }
+
+	/**
+	 * Same cell size, (within 1 m) the same dungeon bounds and the same source hash
+	 * (FSLFCaveMazeBuilder::ComputeHeightSourceHash) - saved samples are reusable
+	 */
+	bool IsCompatible(const FBox& InBounds, uint64 InSourceHash, float InCellSize = DefaultCellSize) const;
+
+	const FBox& GetBounds() const { return Bounds; }
+	uint64 GetSourceHash() const { return SourceHash; }
+	float GetCellSize() const { return CellSize; }
+
+	/** Binary save / load (MapCapture/dungeon_NN_heights.bin next to the layout JSON) */
+	bool SaveToFile(const FString& Path) const;
+	bool LoadFromFile(const FString& Path);
+
+	/** Default grid path for a dungeon index (0-based, like the layout JSON) */
+	static FString GetGridPath(int32 DungeonIndex);
+
+	friend FArchive& operator<<(FArchive& Ar, FSLFCaveHeightGrid& Grid);
+
+private:
+	FBox Bounds = FBox(ForceInit);
+	uint64 SourceHash = 0;
+	float CellSize = DefaultCellSize;
+	TMap<FIntVector, FSLFCaveHeightSample> Samples;
+};
@@ -0,0 +1,115 @@
+// SLFCaveLayoutCache.cpp
+
+#include "SLFCaveLayoutCache.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	constexpr uint32 LayoutCacheMagic = 0x4C464C53; // "SLFL"
+
+	void SerializeWall(FArchive& Ar, FSLFWallSegment& Wall)
+	{
+		Ar << Wall.Start << Wall.End << Wall.Thickness << Wall.HeightOverride << Wall.bNaturalRock << Wall.Tag;
+	}
+
+	void SerializeRoom(FArchive& Ar, FSLFRoomDesign& Room)
+	{
+		uint8 Designation = static_cast<uint8>(Room.Designation);
+		Ar << Room.GroupId << Designation << Room.Center << Room.Radius << Room.ConnectedRoomIds;
+		Room.Designation = static_cast<ESLFRoomDesignation>(Designation);
+	}
+
+	void SerializeCorridor(FArchive& Ar, FSLFCorridorDesign& Corridor)
+	{
+		Ar << Corridor.FromRoomId << Corridor.ToRoomId << Corridor.Width << Corridor.Waypoints << Corridor.bIsShortcut;
+	}
+
+	template <typename ElementType, typename SerializeFn>
+	void SerializeArray(FArchive& Ar, TArray<ElementType>& Array, SerializeFn&& SerializeElement)
+	{
+		int32 Num = Array.Num();
+		Ar << Num;
+		if (Ar.IsLoading())
+		{
+			if (Num < 0 || Num > Ar.TotalSize())
+			{
+				Ar.SetError();
+				return;
+			}
+			Array.SetNum(Num);
+		}
+		for (ElementType& Element : Array)
+		{
+			SerializeElement(Ar, Element);
+			if (Ar.IsError())
+			{
+				return;
+			}
+		}
+	}
+}
+
+uint64 FSLFCaveLayoutCache::HashSource(const TArray<uint8>& JsonBytes)
+{
+	return FXxHash64::HashBuffer(JsonBytes.GetData(), JsonBytes.Num()).Hash;
+}
+
+FString FSLFCaveLayoutCache::GetCachePath(const FString& JsonPath)
+{
+	return FPaths::ChangeExtension(JsonPath, TEXT("bin"));
+}
+
+void FSLFCaveLayoutCache::Serialize(FArchive& Ar, FSLFCaveLayout& Layout)
+{
+	Ar << Layout.DungeonIndex << Layout.DungeonOrigin << Layout.DungeonExtent;
+	SerializeArray(Ar, Layout.Rooms, SerializeRoom);
+	SerializeArray(Ar, Layout.Corridors, SerializeCorridor);
+	SerializeArray(Ar, Layout.Walls, SerializeWall);
+}
+
+bool FSLFCaveLayoutCache::Save(const FString& CachePath, uint64 SourceHash, const FSLFCaveLayout& Layout)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = LayoutCacheMagic;
+	int32 FileVersion = Version;
+	Writer << Magic << FileVersion << SourceHash;
+	Serialize(Writer, const_cast<FSLFCaveLayout&>(Layout));
+
+	return FFileHelper::SaveArrayToFile(Bytes, *CachePath);
+}
+
+bool FSLFCaveLayoutCache::Load(const FString& CachePath, uint64 SourceHash, FSLFCaveLayout& OutLayout)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *CachePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	int32 FileVersion = 0;
+	uint64 FileHash = 0;
+	Reader << Magic << FileVersion << FileHash;
+	if (Reader.IsError() || Magic != LayoutCacheMagic || FileVersion != Version || FileHash != SourceHash)
+	{
+		return false;
+	}
+
+	FSLFCaveLayout Loaded;
+	Serialize(Reader, Loaded);
+	if (Reader.IsError() || !Reader.AtEnd())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[CaveMaze] Ignoring corrupt layout cache: %s"), *CachePath);
+		return false;
+	}
+
+	OutLayout = MoveTemp(Loaded);
+	return true;
+}
@@ -0,0 +1,32 @@
+// SLFCaveLayoutCache.h
+// Compiled binary form of a cave layout JSON.
+// The layout JSON is the source of truth; the first load of each revision parses it once
+// and writes a flat, versioned blob next to it (dungeon_NN_layout.bin) stamped with a hash
+// of the JSON bytes. Later loads (maze build, overlay, gameplay placement) hash the JSON
+// and deserialize the blob instead of walking the FJsonObject DOM again.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SLFCaveMazeTypes.h"
+
+struct SLFCONVERSION_API FSLFCaveLayoutCache
+{
+	/** Bump whenever the blob layout or the JSON -> layout mapping changes */
+	static constexpr int32 Version = 1;
+
+	/** Hash of the raw JSON file bytes the blob was compiled from */
+	static uint64 HashSource(const TArray<uint8>& JsonBytes);
+
+	/** Blob path for a layout JSON (same name, .bin extension) */
+	static FString GetCachePath(const FString& JsonPath);
+
+	/** Write the compiled layout. Returns false if the file could not be written. */
+	static bool Save(const FString& CachePath, uint64 SourceHash, const FSLFCaveLayout& Layout);
+
+	/** Read a compiled layout. Fails (leaving OutLayout untouched) on a missing file, version or hash mismatch. */
+	static bool Load(const FString& CachePath, uint64 SourceHash, FSLFCaveLayout& OutLayout);
+
+	/** Bidirectional layout serialization (shared by Save / Load) */
+	static void Serialize(FArchive& Ar, FSLFCaveLayout& Layout);
+};
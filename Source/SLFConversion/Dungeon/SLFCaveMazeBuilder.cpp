@@ -2,6 +2,9 @@
 // Design-driven dungeon maze: load layout JSON, build walls, overlay viz, gameplay actors.
 
 #include "SLFCaveMazeBuilder.h"
+#include "SLFCaveMazeWalls.h"
+#include "SLFCaveLayoutCache.h"
+#include "SLFCellGraphWriter.h"
 
 #if WITH_EDITOR
 #include "Core/Dungeon.h"
@@ -30,11 +33,15 @@
 #include "Components/ExponentialHeightFogComponent.h"
 #include "Components/TextRenderComponent.h"
 #include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
 #include "Materials/MaterialInterface.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "GameFramework/PlayerStart.h"
 #include "EngineUtils.h"
 #include "Misc/FileHelper.h"
+#include "Hash/xxhash.h"
+#include "Serialization/MemoryWriter.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -44,6 +51,12 @@
 #include "RenderingThread.h"
 #include "CollisionQueryParams.h"
 
+namespace
+{
+	/** Height traces reach this far above / below a wall's Z (see ResolveWallHeights) */
+	constexpr float HeightTraceReach = 3000.0f;
+}
+
 // Reuse SaveCaptureToPng from SLFConversion.cpp (declared static there).
 // We duplicate the PNG save logic here to keep the builder self-contained.
 static bool SaveCaptureToPngLocal(UTextureRenderTarget2D* RenderTarget, int32 Resolution,
@@ -230,7 +243,7 @@ void FSLFCaveMazeBuilder::CaptureCaveFloor(UWorld* World, int32 DungeonIndex, in
 // ═══════════════════════════════════════════════════════════════════════════════
 
 void FSLFCaveMazeBuilder::ExportCellGraphToJson(ADungeon* Dungeon, int32 DungeonIndex,
-	const FVector& DungeonOrigin, const FVector& GridSize)
+	const FVector& DungeonOrigin, const FVector& GridSize, bool bWriteBinary)
 {
 	if (!Dungeon)
 	{
@@ -247,40 +260,32 @@ void FSLFCaveMazeBuilder::ExportCellGraphToJson(ADungeon* Dungeon, int32 Dungeon
 
 	UDAFlowCellGraph* CellGraph = CellModel->CellGraph;
 
-	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
-	Root->SetNumberField(TEXT("dungeonIndex"), DungeonIndex);
-
-	// Origin
-	TArray<TSharedPtr<FJsonValue>> OriginArr;
-	OriginArr.Add(MakeShared<FJsonValueNumber>(DungeonOrigin.X));
-	OriginArr.Add(MakeShared<FJsonValueNumber>(DungeonOrigin.Y));
-	OriginArr.Add(MakeShared<FJsonValueNumber>(DungeonOrigin.Z));
-	Root->SetArrayField(TEXT("origin"), OriginArr);
+	FString OutputDir = FPaths::ProjectDir() / TEXT("MapCapture");
+	IFileManager::Get().MakeDirectory(*OutputDir, true);
+	FString OutputPath = OutputDir / FString::Printf(TEXT("dungeon_%02d_cellgraph.json"), DungeonIndex + 1);
+	FString BinaryPath = bWriteBinary ? FPaths::ChangeExtension(OutputPath, TEXT("bin")) : FString();
 
-	// Grid size
-	TArray<TSharedPtr<FJsonValue>> GridArr;
-	GridArr.Add(MakeShared<FJsonValueNumber>(GridSize.X));
-	GridArr.Add(MakeShared<FJsonValueNumber>(GridSize.Y));
-	GridArr.Add(MakeShared<FJsonValueNumber>(GridSize.Z));
-	Root->SetArrayField(TEXT("gridSize"), GridArr);
+	// Groups stream straight to disk; only the current group's leaves are held in memory
+	FSLFCellGraphWriter Writer(OutputPath, BinaryPath);
+	if (!Writer.IsOpen())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] ExportCellGraph: Cannot open %s"), *OutputPath);
+		return;
+	}
+	Writer.Begin(DungeonIndex, DungeonOrigin, GridSize);
 
 	// Groups (rooms)
-	TArray<TSharedPtr<FJsonValue>> GroupsArr;
+	FSLFCellGraphGroup GroupOut;
 	for (int32 GIdx = 0; GIdx < CellGraph->GroupNodes.Num(); GIdx++)
 	{
 		const FDAFlowCellGroupNode& Group = CellGraph->GroupNodes[GIdx];
 		if (!Group.IsActive()) continue;
 
-		TSharedPtr<FJsonObject> GObj = MakeShared<FJsonObject>();
-		GObj->SetNumberField(TEXT("groupId"), Group.GroupId);
-		GObj->SetNumberField(TEXT("groupHeight"), Group.GroupHeight);
-
 		// Compute center from leaf nodes
 		FVector2D Center2D = FVector2D::ZeroVector;
 		float TotalArea = 0.0f;
-		int32 LeafCount = 0;
+		GroupOut.Leaves.Reset();
 
-		TArray<TSharedPtr<FJsonValue>> LeavesArr;
 		for (int32 LeafIdx : Group.LeafNodes)
 		{
 			if (LeafIdx >= 0 && LeafIdx < CellGraph->LeafNodes.Num())
@@ -291,64 +296,48 @@ void FSLFCaveMazeBuilder::ExportCellGraphToJson(ADungeon* Dungeon, int32 Dungeon
 					Center2D += FVector2d(Leaf->GetCenter());
 					float Area = Leaf->GetArea();
 					TotalArea += Area;
-					LeafCount++;
 
-					TSharedPtr<FJsonObject> LObj = MakeShared<FJsonObject>();
-					LObj->SetNumberField(TEXT("cellId"), LeafIdx);
 					FVector2D LC = FVector2d(Leaf->GetCenter());
-					TArray<TSharedPtr<FJsonValue>> LCArr;
-					LCArr.Add(MakeShared<FJsonValueNumber>(DungeonOrigin.X + LC.X * GridSize.X));
-					LCArr.Add(MakeShared<FJsonValueNumber>(DungeonOrigin.Y + LC.Y * GridSize.Y));
-					LObj->SetArrayField(TEXT("center"), LCArr);
-					LObj->SetNumberField(TEXT("area"), Area);
-					LeavesArr.Add(MakeShared<FJsonValueObject>(LObj));
+					FSLFCellGraphLeaf& LeafOut = GroupOut.Leaves.AddDefaulted_GetRef();
+					LeafOut.CellId = LeafIdx;
+					LeafOut.Center = FVector2D(DungeonOrigin.X + LC.X * GridSize.X, DungeonOrigin.Y + LC.Y * GridSize.Y);
+					LeafOut.Area = Area;
 				}
 			}
 		}
 
+		const int32 LeafCount = GroupOut.Leaves.Num();
 		if (LeafCount == 0) continue;
 		Center2D /= (float)LeafCount;
 
-		FVector WorldCenter(
+		GroupOut.GroupId = Group.GroupId;
+		GroupOut.GroupHeight = Group.GroupHeight;
+		GroupOut.Center = FVector(
 			DungeonOrigin.X + Center2D.X * GridSize.X,
 			DungeonOrigin.Y + Center2D.Y * GridSize.Y,
 			DungeonOrigin.Z + (float)Group.GroupHeight * GridSize.Z
 		);
-		float Radius = FMath::Sqrt(TotalArea) * GridSize.X * 0.5f;
-
-		TArray<TSharedPtr<FJsonValue>> CenterArr;
-		CenterArr.Add(MakeShared<FJsonValueNumber>(WorldCenter.X));
-		CenterArr.Add(MakeShared<FJsonValueNumber>(WorldCenter.Y));
-		CenterArr.Add(MakeShared<FJsonValueNumber>(WorldCenter.Z));
-		GObj->SetArrayField(TEXT("center"), CenterArr);
-		GObj->SetNumberField(TEXT("radius"), Radius);
-		GObj->SetNumberField(TEXT("leafCount"), LeafCount);
-		GObj->SetNumberField(TEXT("totalArea"), TotalArea);
-		GObj->SetArrayField(TEXT("leaves"), LeavesArr);
+		GroupOut.Radius = FMath::Sqrt(TotalArea) * GridSize.X * 0.5f;
+		GroupOut.TotalArea = TotalArea;
 
 		// Connected group IDs
-		TArray<TSharedPtr<FJsonValue>> ConnsArr;
+		GroupOut.Connections.Reset();
 		for (int32 ConnIdx : Group.Connections)
 		{
-			ConnsArr.Add(MakeShared<FJsonValueNumber>(ConnIdx));
+			GroupOut.Connections.Add(ConnIdx);
 		}
-		GObj->SetArrayField(TEXT("connections"), ConnsArr);
 
-		GroupsArr.Add(MakeShared<FJsonValueObject>(GObj));
+		Writer.WriteGroup(GroupOut);
 	}
-	Root->SetArrayField(TEXT("groups"), GroupsArr);
-
-	// Serialize to file
-	FString OutputDir = FPaths::ProjectDir() / TEXT("MapCapture");
-	IFileManager::Get().MakeDirectory(*OutputDir, true);
-	FString OutputPath = OutputDir / FString::Printf(TEXT("dungeon_%02d_cellgraph.json"), DungeonIndex + 1);
 
-	FString JsonStr;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonStr);
-	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
-	FFileHelper::SaveStringToFile(JsonStr, *OutputPath);
+	if (!Writer.Finish())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] ExportCellGraph: Write failed for %s"), *OutputPath);
+		return;
+	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[CaveMaze] Exported cell graph: %d groups to %s"), GroupsArr.Num(), *OutputPath);
+	UE_LOG(LogTemp, Warning, TEXT("[CaveMaze] Exported cell graph: %d groups to %s%s"), Writer.GetNumGroups(), *OutputPath,
+		bWriteBinary ? TEXT(" (+ .bin)") : TEXT(""));
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -592,39 +581,84 @@ void FSLFCaveMazeBuilder::GenerateOverlay(UWorld* World, int32 DungeonIndex)
 // Phase E: Wall Construction
 // ═══════════════════════════════════════════════════════════════════════════════
 
-void FSLFCaveMazeBuilder::BuildCaveMaze(UWorld* World, int32 DungeonIndex)
+FSLFCaveMazeBuildStats FSLFCaveMazeBuilder::BuildCaveMaze(UWorld* World, int32 DungeonIndex, ESLFCaveWallOutput Output)
 {
 	if (!World)
 	{
 		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] BuildCaveMaze: No world!"));
-		return;
+		return FSLFCaveMazeBuildStats();
 	}
 
 	FSLFCaveLayout Layout;
 	if (!LoadLayoutFromJson(DungeonIndex, Layout))
 	{
 		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] BuildCaveMaze: Failed to load layout JSON!"));
-		return;
+		return FSLFCaveMazeBuildStats();
 	}
 
-	FBox Bounds = ComputeDungeonBounds(World);
+	// Reuse the saved height grid only while the layout and the traced geometry are unchanged
+	const FBox Bounds = ComputeLayoutBounds(Layout);
+	const uint64 SourceHash = ComputeHeightSourceHash(World, Layout);
+	const FString GridPath = FSLFCaveHeightGrid::GetGridPath(DungeonIndex);
+	FSLFCaveHeightGrid HeightGrid;
+	if (!HeightGrid.LoadFromFile(GridPath) || !HeightGrid.IsCompatible(Bounds, SourceHash))
+	{
+		if (HeightGrid.Num() > 0)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[CaveMaze] Discarding stale height grid %s (layout, geometry or bounds changed)"), *GridPath);
+		}
+		HeightGrid = FSLFCaveHeightGrid(Bounds, SourceHash);
+	}
+	const int32 CachedCells = HeightGrid.Num();
 
-	int32 WallsBuilt = 0;
-	for (const FSLFWallSegment& Wall : Layout.Walls)
+	FSLFCaveMazeBuildStats Stats = BuildCaveMazeFromLayout(World, Layout, Output, &HeightGrid);
+
+	if (HeightGrid.Num() != CachedCells)
 	{
-		// Find floor and ceiling at wall center
-		FVector WallCenter = (Wall.Start + Wall.End) * 0.5f;
+		if (HeightGrid.SaveToFile(GridPath))
+		{
+			UE_LOG(LogTemp, Log, TEXT("[CaveMaze] Saved %d height cells to %s"), HeightGrid.Num(), *GridPath);
+		}
+	}
+
+	return Stats;
+}
+
+FSLFCaveMazeBuildStats FSLFCaveMazeBuilder::BuildCaveMazeFromLayout(UWorld* World, const FSLFCaveLayout& Layout,
+	ESLFCaveWallOutput Output, FSLFCaveHeightGrid* HeightGrid)
+{
+	FSLFCaveMazeBuildStats Stats;
+	Stats.Output = Output;
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] BuildCaveMazeFromLayout: No world!"));
+		return Stats;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const FWallAssets Assets = LoadWallAssets();
+	if (!Assets.CubeMesh)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] BuildCaveMaze: Failed to load Cube mesh!"));
+		return Stats;
+	}
 
-		// Use the wall's Z from the JSON as a reference point — rooms are at different heights
-		float RefZ = WallCenter.Z;
+	// Instanced output: per-material transform / tag batches, flushed into one walls actor
+	const bool bInstanced = Output == ESLFCaveWallOutput::Instanced;
+	TArray<FTransform> InstanceTransforms[2];
+	TArray<FName> InstanceTags[2];
 
-		// Try line traces first (works in editor, may fail in commandlet)
-		float FloorZ = TraceFloorHeight(World, WallCenter, RefZ + 500.0f, RefZ - 3000.0f);
-		float CeilingZ = TraceCeilingHeight(World, WallCenter, RefZ - 500.0f, RefZ + 3000.0f);
+	// Floor and ceiling for every wall up front (one batch against the height grid)
+	TArray<FSLFCaveHeightSample> Heights;
+	const FSLFCaveHeightStats HeightStats = ResolveWallHeights(World, Layout, HeightGrid, Heights);
+	Stats.HeightCellsTraced = HeightStats.CellsTraced;
+	Stats.HeightFallbackTraces = HeightStats.FallbackTraces;
 
-		// Fallback: use wall Z as floor reference, add fixed height
-		if (FloorZ == FLT_MIN) FloorZ = RefZ - 200.0f;
-		if (CeilingZ == FLT_MAX) CeilingZ = RefZ + 1400.0f;
+	for (int32 WallIndex = 0; WallIndex < Layout.Walls.Num(); ++WallIndex)
+	{
+		const FSLFWallSegment& Wall = Layout.Walls[WallIndex];
+		float FloorZ = Heights[WallIndex].FloorZ;
+		float CeilingZ = Heights[WallIndex].CeilingZ;
 
 		// Allow height override
 		if (Wall.HeightOverride > 0.0f)
@@ -632,7 +666,16 @@ void FSLFCaveMazeBuilder::BuildCaveMaze(UWorld* World, int32 DungeonIndex)
 			CeilingZ = FloorZ + Wall.HeightOverride;
 		}
 
-		AActor* WallActor = SpawnWallSegment(World, Wall, FloorZ, CeilingZ);
+		if (bInstanced)
+		{
+			const int32 Batch = Wall.bNaturalRock ? 1 : 0;
+			InstanceTransforms[Batch].Add(ComputeWallTransform(Wall, FloorZ, CeilingZ));
+			InstanceTags[Batch].Add(Wall.Tag.IsEmpty() ? NAME_None : FName(*Wall.Tag));
+			Stats.WallsBuilt++;
+			continue;
+		}
+
+		AActor* WallActor = SpawnWallSegment(World, Wall, FloorZ, CeilingZ, Assets);
 		if (WallActor)
 		{
 			WallActor->Tags.Add(FName(TEXT("CaveMazeWall")));
@@ -641,11 +684,115 @@ void FSLFCaveMazeBuilder::BuildCaveMaze(UWorld* World, int32 DungeonIndex)
 				WallActor->Tags.Add(FName(*Wall.Tag));
 			}
 			WallActor->SetFolderPath(FName(TEXT("Dungeon/MazeWalls")));
-			WallsBuilt++;
+			Stats.WallsBuilt++;
+			Stats.ActorsSpawned++;
+		}
+	}
+
+	if (bInstanced && Stats.WallsBuilt > 0)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		ASLFCaveMazeWalls* WallsActor = World->SpawnActor<ASLFCaveMazeWalls>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+		if (WallsActor)
+		{
+			// Built walls keep the cube's default material, as in the per-actor path
+			WallsActor->SetWallAssets(Assets.CubeMesh, Assets.RockMaterial, nullptr);
+			WallsActor->AddWalls(true, InstanceTransforms[1], InstanceTags[1]);
+			WallsActor->AddWalls(false, InstanceTransforms[0], InstanceTags[0]);
+			WallsActor->SetFolderPath(FName(TEXT("Dungeon/MazeWalls")));
+			Stats.ActorsSpawned = 1;
+			Stats.InstancesAdded = WallsActor->GetNumWalls();
+		}
+		else
+		{
+			Stats.WallsBuilt = 0;
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[CaveMaze] BuildCaveMaze: %d walls built from %d segments"), WallsBuilt, Layout.Walls.Num());
+	Stats.BuildSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogTemp, Warning, TEXT("[CaveMaze] BuildCaveMaze (%s): %d walls built from %d segments - %d actors, %d instances, %.3f s"),
+		bInstanced ? TEXT("instanced") : TEXT("actors"), Stats.WallsBuilt, Layout.Walls.Num(),
+		Stats.ActorsSpawned, Stats.InstancesAdded, Stats.BuildSeconds);
+	return Stats;
+}
+
+FSLFCaveHeightStats FSLFCaveMazeBuilder::ResolveWallHeights(UWorld* World, const FSLFCaveLayout& Layout,
+	FSLFCaveHeightGrid* HeightGrid, TArray<FSLFCaveHeightSample>& OutHeights)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	FSLFCaveHeightStats Stats;
+	const int32 NumWalls = Layout.Walls.Num();
+	Stats.Probes = NumWalls;
+
+	// Probe at wall center; the wall's Z from the JSON is the reference - rooms are at different heights
+	TArray<FVector> Probes;
+	Probes.SetNumUninitialized(NumWalls);
+	for (int32 Index = 0; Index < NumWalls; ++Index)
+	{
+		Probes[Index] = (Layout.Walls[Index].Start + Layout.Walls[Index].End) * 0.5f;
+	}
+
+	OutHeights.Reset();
+	OutHeights.SetNum(NumWalls);
+
+	// Scene queries stay on the game thread; batching saves the repeated and cached probes, not the traces
+	auto TraceWall = [World](const FVector& Probe, FSLFCaveHeightSample& Sample)
+	{
+		const float RefZ = Probe.Z;
+		Sample.FloorZ = TraceFloorHeight(World, Probe, RefZ + 500.0f, RefZ - HeightTraceReach);
+		Sample.CeilingZ = TraceCeilingHeight(World, Probe, RefZ - 500.0f, RefZ + HeightTraceReach);
+	};
+
+	if (World && HeightGrid)
+	{
+		// Each cell is traced once, from its center, hits and misses alike; walls outside the grid trace on their own
+		TSet<FIntVector> ReusedCells;
+		for (int32 Index = 0; Index < NumWalls; ++Index)
+		{
+			if (!HeightGrid->Covers(Probes[Index]))
+			{
+				TraceWall(Probes[Index], OutHeights[Index]);
+				Stats.FallbackTraces++;
+				continue;
+			}
+
+			const FIntVector Cell = HeightGrid->GetCell(Probes[Index]);
+			if (const FSLFCaveHeightSample* CellSample = HeightGrid->Find(Cell))
+			{
+				OutHeights[Index] = *CellSample;
+				ReusedCells.Add(Cell);
+				continue;
+			}
+
+			TraceWall(HeightGrid->GetCellCenter(Cell), OutHeights[Index]);
+			HeightGrid->Add(Cell, OutHeights[Index]);
+			Stats.CellsTraced++;
+		}
+		Stats.CellsReused = ReusedCells.Num();
+	}
+	else if (World)
+	{
+		for (int32 Index = 0; Index < NumWalls; ++Index)
+		{
+			TraceWall(Probes[Index], OutHeights[Index]);
+		}
+		Stats.FallbackTraces = NumWalls;
+	}
+
+	// Fallback: use wall Z as floor reference, add fixed height
+	for (int32 Index = 0; Index < NumWalls; ++Index)
+	{
+		FSLFCaveHeightSample& Sample = OutHeights[Index];
+		if (!Sample.HasFloor()) Sample.FloorZ = Probes[Index].Z - 200.0f;
+		if (!Sample.HasCeiling()) Sample.CeilingZ = Probes[Index].Z + 1400.0f;
+	}
+
+	Stats.Seconds = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogTemp, Log, TEXT("[CaveMaze] ResolveWallHeights: %d probes, %d cells traced, %d cells reused, %d fallback traces, %.3f s"),
+		Stats.Probes, Stats.CellsTraced, Stats.CellsReused, Stats.FallbackTraces, Stats.Seconds);
+	return Stats;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -1023,18 +1170,55 @@ bool FSLFCaveMazeBuilder::LoadLayoutFromJson(int32 DungeonIndex, FSLFCaveLayout&
 	FString InputPath = FPaths::ProjectDir() / TEXT("MapCapture") /
 		FString::Printf(TEXT("dungeon_%02d_layout.json"), DungeonIndex + 1);
 
-	FString JsonStr;
-	if (!FFileHelper::LoadFileToString(JsonStr, *InputPath))
+	return LoadLayoutFromFile(InputPath, OutLayout);
+}
+
+bool FSLFCaveMazeBuilder::LoadLayoutFromFile(const FString& InputPath, FSLFCaveLayout& OutLayout, bool bUseCache)
+{
+	TArray<uint8> JsonBytes;
+	if (!FFileHelper::LoadFileToArray(JsonBytes, *InputPath))
 	{
 		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] Failed to load: %s"), *InputPath);
 		return false;
 	}
 
+	// The compiled blob is only trusted for the exact JSON bytes it was built from
+	const uint64 SourceHash = FSLFCaveLayoutCache::HashSource(JsonBytes);
+	const FString CachePath = FSLFCaveLayoutCache::GetCachePath(InputPath);
+	if (bUseCache && FSLFCaveLayoutCache::Load(CachePath, SourceHash, OutLayout))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[CaveMaze] Loaded layout: %d rooms, %d corridors, %d walls from %s"),
+			OutLayout.Rooms.Num(), OutLayout.Corridors.Num(), OutLayout.Walls.Num(), *CachePath);
+		return true;
+	}
+
+	FString JsonStr;
+	FFileHelper::BufferToString(JsonStr, JsonBytes.GetData(), JsonBytes.Num());
+
+	FSLFCaveLayout Parsed;
+	if (!ParseLayoutJson(JsonStr, Parsed))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] Failed to parse JSON: %s"), *InputPath);
+		return false;
+	}
+	OutLayout = MoveTemp(Parsed);
+
+	if (bUseCache && !FSLFCaveLayoutCache::Save(CachePath, SourceHash, OutLayout))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[CaveMaze] Failed to write layout cache: %s"), *CachePath);
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[CaveMaze] Loaded layout: %d rooms, %d corridors, %d walls from %s"),
+		OutLayout.Rooms.Num(), OutLayout.Corridors.Num(), OutLayout.Walls.Num(), *InputPath);
+	return true;
+}
+
+bool FSLFCaveMazeBuilder::ParseLayoutJson(const FString& JsonStr, FSLFCaveLayout& OutLayout)
+{
 	TSharedPtr<FJsonObject> Root;
 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonStr);
 	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] Failed to parse JSON: %s"), *InputPath);
 		return false;
 	}
 
@@ -1159,8 +1343,6 @@ bool FSLFCaveMazeBuilder::LoadLayoutFromJson(int32 DungeonIndex, FSLFCaveLayout&
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[CaveMaze] Loaded layout: %d rooms, %d corridors, %d walls from %s"),
-		OutLayout.Rooms.Num(), OutLayout.Corridors.Num(), OutLayout.Walls.Num(), *InputPath);
 	return true;
 }
 
@@ -1191,6 +1373,95 @@ FBox FSLFCaveMazeBuilder::ComputeDungeonBounds(UWorld* World)
 	return Bounds;
 }
 
+FBox FSLFCaveMazeBuilder::ComputeLayoutBounds(const FSLFCaveLayout& Layout)
+{
+	FBox Bounds(ForceInit);
+	for (const FSLFWallSegment& Wall : Layout.Walls)
+	{
+		Bounds += (Wall.Start + Wall.End) * 0.5f;
+	}
+	return Bounds.IsValid ? Bounds.ExpandBy(FSLFCaveHeightGrid::DefaultCellSize) : Bounds;
+}
+
+uint64 FSLFCaveMazeBuilder::ComputeHeightSourceHash(UWorld* World, const FSLFCaveLayout& Layout)
+{
+	// Layout (the wall probes) and map
+	TArray<uint8> SourceBytes;
+	FMemoryWriter SourceWriter(SourceBytes);
+	for (const FSLFWallSegment& Wall : Layout.Walls)
+	{
+		FVector Start = Wall.Start;
+		FVector End = Wall.End;
+		SourceWriter << Start << End;
+	}
+	FString MapName = World ? World->GetOutermost()->GetName() : FString();
+	SourceWriter << MapName;
+
+	// Geometry: every static component the WorldStatic traces can hit, except the maze's own output.
+	// Only the layout bounds (plus the trace reach in Z) can be hit, so one overlap query finds the
+	// candidates instead of walking every primitive in the world. Per-component hashes are summed
+	// so overlap order does not matter.
+	uint64 GeometryHash = 0;
+	TArray<uint8> ComponentBytes;
+	const FBox LayoutBounds = ComputeLayoutBounds(Layout);
+	if (World && LayoutBounds.IsValid)
+	{
+		const FBox TraceBounds = LayoutBounds.ExpandBy(FVector(0.0f, 0.0f, HeightTraceReach));
+		TArray<FOverlapResult> Overlaps;
+		World->OverlapMultiByChannel(Overlaps, TraceBounds.GetCenter(), FQuat::Identity, ECC_WorldStatic,
+			FCollisionShape::MakeBox(TraceBounds.GetExtent()));
+
+		// Instanced components report one overlap per instance; hash each component once
+		TSet<const UPrimitiveComponent*> Hashed;
+		for (const FOverlapResult& Overlap : Overlaps)
+		{
+			UPrimitiveComponent* PC = Overlap.GetComponent();
+			if (!PC || Hashed.Contains(PC))
+			{
+				continue;
+			}
+			Hashed.Add(PC);
+
+			const AActor* Actor = PC->GetOwner();
+			if (!Actor || Actor->IsA<ASLFCaveMazeWalls>()
+				|| Actor->Tags.Contains(FName(TEXT("CaveMazeWall"))) || Actor->Tags.Contains(FName(TEXT("LayoutOverlay"))))
+			{
+				continue;
+			}
+
+			if (!PC->IsRegistered() || PC->Mobility != EComponentMobility::Static || !PC->IsQueryCollisionEnabled()
+				|| PC->GetCollisionResponseToChannel(ECC_WorldStatic) != ECR_Block)
+			{
+				continue;
+			}
+
+			ComponentBytes.Reset();
+			FMemoryWriter Writer(ComponentBytes);
+			FString ComponentPath = PC->GetPathName(World);
+			FTransform Transform = PC->GetComponentTransform();
+			Writer << ComponentPath << Transform;
+
+			if (const UStaticMeshComponent* MeshComp = Cast<UStaticMeshComponent>(PC))
+			{
+				UStaticMesh* Mesh = MeshComp->GetStaticMesh();
+				FString MeshPath = Mesh ? Mesh->GetPathName() : FString();
+				FGuid MeshGuid = Mesh ? Mesh->GetLightingGuid() : FGuid();
+				Writer << MeshPath << MeshGuid;
+			}
+			else if (ULandscapeHeightfieldCollisionComponent* LandscapeComp = Cast<ULandscapeHeightfieldCollisionComponent>(PC))
+			{
+				// Regenerated whenever the landscape's collision heights are rebuilt
+				Writer << LandscapeComp->HeightfieldGuid;
+			}
+
+			GeometryHash += FXxHash64::HashBuffer(ComponentBytes.GetData(), ComponentBytes.Num()).Hash;
+		}
+	}
+
+	SourceWriter << GeometryHash;
+	return FXxHash64::HashBuffer(SourceBytes.GetData(), SourceBytes.Num()).Hash;
+}
+
 float FSLFCaveMazeBuilder::TraceFloorHeight(UWorld* World, FVector Position, float StartZ, float EndZ)
 {
 	FHitResult Hit;
@@ -1223,29 +1494,27 @@ float FSLFCaveMazeBuilder::TraceCeilingHeight(UWorld* World, FVector Position, f
 	return FLT_MAX;
 }
 
-AActor* FSLFCaveMazeBuilder::SpawnWallSegment(UWorld* World, const FSLFWallSegment& Wall, float FloorZ, float CeilingZ)
+FSLFCaveMazeBuilder::FWallAssets FSLFCaveMazeBuilder::LoadWallAssets()
 {
+	FWallAssets Assets;
+
 	// Load cube mesh
-	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
-	if (!CubeMesh)
-	{
-		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] SpawnWallSegment: Failed to load Cube mesh!"));
-		return nullptr;
-	}
+	Assets.CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
 
 	// Load rock material
-	UMaterialInterface* WallMat = nullptr;
-	if (Wall.bNaturalRock)
+	Assets.RockMaterial = LoadObject<UMaterialInterface>(nullptr,
+		TEXT("/Game/Wasteland/Materials/Material_Instances/MI_Rock_03.MI_Rock_03"));
+	if (!Assets.RockMaterial)
 	{
-		WallMat = LoadObject<UMaterialInterface>(nullptr,
-			TEXT("/Game/Wasteland/Materials/Material_Instances/MI_Rock_03.MI_Rock_03"));
-		if (!WallMat)
-		{
-			WallMat = LoadObject<UMaterialInterface>(nullptr,
-				TEXT("/Game/WastelandEnvironment/Materials/Material_Instances/MI_Rock_01.MI_Rock_01"));
-		}
+		Assets.RockMaterial = LoadObject<UMaterialInterface>(nullptr,
+			TEXT("/Game/WastelandEnvironment/Materials/Material_Instances/MI_Rock_01.MI_Rock_01"));
 	}
 
+	return Assets;
+}
+
+FTransform FSLFCaveMazeBuilder::ComputeWallTransform(const FSLFWallSegment& Wall, float FloorZ, float CeilingZ)
+{
 	FVector WallCenter = (Wall.Start + Wall.End) * 0.5f;
 	float WallLength = FVector::Dist(Wall.Start, Wall.End);
 	float WallHeight = CeilingZ - FloorZ;
@@ -1255,17 +1524,6 @@ AActor* FSLFCaveMazeBuilder::SpawnWallSegment(UWorld* World, const FSLFWallSegme
 	// Place at midpoint between floor and ceiling
 	FVector SpawnPos(WallCenter.X, WallCenter.Y, FloorZ + WallHeight * 0.5f);
 
-	AStaticMeshActor* WallActor = World->SpawnActor<AStaticMeshActor>(SpawnPos, Rot);
-	if (!WallActor) return nullptr;
-
-	UStaticMeshComponent* MeshComp = WallActor->GetStaticMeshComponent();
-	MeshComp->SetStaticMesh(CubeMesh);
-
-	if (WallMat)
-	{
-		MeshComp->SetMaterial(0, WallMat);
-	}
-
 	// Cube is 100x100x100, scale to match wall dimensions
 	// X = along wall direction (length), Y = perpendicular (thickness), Z = height
 	FVector Scale(
@@ -1273,7 +1531,32 @@ AActor* FSLFCaveMazeBuilder::SpawnWallSegment(UWorld* World, const FSLFWallSegme
 		Wall.Thickness / 100.0f,
 		WallHeight / 100.0f
 	);
-	WallActor->SetActorScale3D(Scale);
+
+	return FTransform(Rot, SpawnPos, Scale);
+}
+
+AActor* FSLFCaveMazeBuilder::SpawnWallSegment(UWorld* World, const FSLFWallSegment& Wall, float FloorZ, float CeilingZ, const FWallAssets& Assets)
+{
+	if (!Assets.CubeMesh)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CaveMaze] SpawnWallSegment: Failed to load Cube mesh!"));
+		return nullptr;
+	}
+
+	const FTransform WallTransform = ComputeWallTransform(Wall, FloorZ, CeilingZ);
+
+	AStaticMeshActor* WallActor = World->SpawnActor<AStaticMeshActor>(WallTransform.GetLocation(), WallTransform.Rotator());
+	if (!WallActor) return nullptr;
+
+	UStaticMeshComponent* MeshComp = WallActor->GetStaticMeshComponent();
+	MeshComp->SetStaticMesh(Assets.CubeMesh);
+
+	if (Wall.bNaturalRock && Assets.RockMaterial)
+	{
+		MeshComp->SetMaterial(0, Assets.RockMaterial);
+	}
+
+	WallActor->SetActorScale3D(WallTransform.GetScale3D());
 
 	// Collision
 	MeshComp->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
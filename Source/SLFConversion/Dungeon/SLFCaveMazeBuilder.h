@@ -7,9 +7,12 @@
 
 #include "CoreMinimal.h"
 #include "SLFCaveMazeTypes.h"
+#include "SLFCaveHeightGrid.h"
 
 class UWorld;
 class ADungeon;
+class UStaticMesh;
+class UMaterialInterface;
 
 class SLFCONVERSION_API FSLFCaveMazeBuilder
 {
@@ -24,8 +27,10 @@ public:
 	static void GenerateTemplateLayout(UWorld* World, int32 DungeonIndex);
 
 	// ── Phase C: Cell Graph Export ──
-	// Exports cell graph data (groups, leaves, connections) to JSON.
-	static void ExportCellGraphToJson(ADungeon* Dungeon, int32 DungeonIndex, const FVector& DungeonOrigin, const FVector& GridSize);
+	// Exports cell graph data (groups, leaves, connections) to JSON, streamed group by group.
+	// bWriteBinary also writes the compact dungeon_NN_cellgraph.bin (see FSLFCellGraphWriter).
+	static void ExportCellGraphToJson(ADungeon* Dungeon, int32 DungeonIndex, const FVector& DungeonOrigin, const FVector& GridSize,
+		bool bWriteBinary = false);
 
 	// ── Phase D: Overlay Visualization ──
 	// Spawn colored actors (planes, spheres) on the cave floor to visualize planned layout.
@@ -33,7 +38,31 @@ public:
 
 	// ── Phase E: Wall Construction ──
 	// Build wall geometry from layout JSON. Ray-traces floor/ceiling for height.
-	static void BuildCaveMaze(UWorld* World, int32 DungeonIndex);
+	// Instanced output emits every wall into one ASLFCaveMazeWalls (HISM per material).
+	static FSLFCaveMazeBuildStats BuildCaveMaze(UWorld* World, int32 DungeonIndex,
+		ESLFCaveWallOutput Output = ESLFCaveWallOutput::Actors);
+
+	// Build walls from an already loaded layout (BuildCaveMaze after the JSON load).
+	// HeightGrid answers floor/ceiling probes in one batch; nullptr traces every wall.
+	static FSLFCaveMazeBuildStats BuildCaveMazeFromLayout(UWorld* World, const FSLFCaveLayout& Layout,
+		ESLFCaveWallOutput Output = ESLFCaveWallOutput::Actors, FSLFCaveHeightGrid* HeightGrid = nullptr);
+
+	// ── Phase E: Height Resolution ──
+	// Floor/ceiling (before HeightOverride) for every wall of a layout, one entry per wall.
+	// With a grid: each wall's probe (center, wall Z) falls in a grid cell; a cell without data
+	// is traced once from its center on the game thread and stored, misses included, and every
+	// wall in it shares the answer. Walls outside the grid's bounds trace on their own.
+	// Without a grid: one floor and one ceiling trace per wall.
+	static FSLFCaveHeightStats ResolveWallHeights(UWorld* World, const FSLFCaveLayout& Layout,
+		FSLFCaveHeightGrid* HeightGrid, TArray<FSLFCaveHeightSample>& OutHeights);
+
+	// Bounds of the layout's wall probes padded by one grid cell - what a height grid covers.
+	static FBox ComputeLayoutBounds(const FSLFCaveLayout& Layout);
+
+	// Key for a saved height grid: the layout's wall probes, the map, and every static
+	// WorldStatic-blocking component (transform, mesh, landscape collision) the height traces
+	// can reach - found with one overlap query over the layout bounds, maze output excluded.
+	static uint64 ComputeHeightSourceHash(UWorld* World, const FSLFCaveLayout& Layout);
 
 	// ── Phase E: Gameplay Placement ──
 	// Place gameplay actors (enemies, traps, lights, boss gate) based on room designations.
@@ -43,6 +72,14 @@ public:
 	// Destroy all actors tagged CaveMazeWall or LayoutOverlay.
 	static void ClearCaveMaze(UWorld* World, int32 DungeonIndex);
 
+	// ── Layout Loading ──
+	// Load a layout JSON, going through its compiled blob (FSLFCaveLayoutCache) when the
+	// JSON hash matches and regenerating the blob when it does not.
+	static bool LoadLayoutFromFile(const FString& JsonPath, FSLFCaveLayout& OutLayout, bool bUseCache = true);
+
+	// Parse layout JSON text (no cache). Returns false if the text is not a JSON object.
+	static bool ParseLayoutJson(const FString& JsonStr, FSLFCaveLayout& OutLayout);
+
 private:
 	// Load layout JSON from MapCapture/dungeon_NN_layout.json
 	static bool LoadLayoutFromJson(int32 DungeonIndex, FSLFCaveLayout& OutLayout);
@@ -57,8 +94,19 @@ private:
 	static float TraceFloorHeight(UWorld* World, FVector Position, float StartZ, float EndZ);
 	static float TraceCeilingHeight(UWorld* World, FVector Position, float StartZ, float EndZ);
 
+	// Cube mesh and wall materials, loaded once per build
+	struct FWallAssets
+	{
+		UStaticMesh* CubeMesh = nullptr;
+		UMaterialInterface* RockMaterial = nullptr;
+	};
+	static FWallAssets LoadWallAssets();
+
+	// Cube transform spanning a wall segment between floor and ceiling
+	static FTransform ComputeWallTransform(const FSLFWallSegment& Wall, float FloorZ, float CeilingZ);
+
 	// Spawn a single wall segment
-	static AActor* SpawnWallSegment(UWorld* World, const FSLFWallSegment& Wall, float FloorZ, float CeilingZ);
+	static AActor* SpawnWallSegment(UWorld* World, const FSLFWallSegment& Wall, float FloorZ, float CeilingZ, const FWallAssets& Assets);
 
 	// Spawn overlay marker actor (flat plane or sphere)
 	static AActor* SpawnOverlayMarker(UWorld* World, FVector Position, FLinearColor Color, float Size, bool bIsSphere = false);
@@ -22,6 +22,13 @@ enum class ESLFRoomDesignation : uint8
 	HiddenRoom
 };
 
+UENUM(BlueprintType)
+enum class ESLFCaveWallOutput : uint8
+{
+	Actors,     // One AStaticMeshActor per wall segment
+	Instanced   // One ASLFCaveMazeWalls with an HISM per wall material
+};
+
 USTRUCT(BlueprintType)
 struct FSLFWallSegment
 {
@@ -111,3 +118,30 @@ struct FSLFCaveLayout
 	UPROPERTY(EditAnywhere)
 	int32 DungeonIndex = 0;
 };
+
+USTRUCT(BlueprintType)
+struct FSLFCaveMazeBuildStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere)
+	ESLFCaveWallOutput Output = ESLFCaveWallOutput::Actors;
+
+	UPROPERTY(VisibleAnywhere)
+	int32 WallsBuilt = 0;
+
+	UPROPERTY(VisibleAnywhere)
+	int32 ActorsSpawned = 0;
+
+	UPROPERTY(VisibleAnywhere)
+	int32 InstancesAdded = 0;
+
+	UPROPERTY(VisibleAnywhere)
+	int32 HeightCellsTraced = 0;
+
+	UPROPERTY(VisibleAnywhere)
+	int32 HeightFallbackTraces = 0;
+
+	UPROPERTY(VisibleAnywhere)
+	double BuildSeconds = 0.0;
+};
@@ -0,0 +1,107 @@
+// SLFCaveMazeWalls.cpp
+
+#include "SLFCaveMazeWalls.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+
+ASLFCaveMazeWalls::ASLFCaveMazeWalls()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	SceneRoot = CreateDefaultSubobject<USceneComponent>(TEXT("SceneRoot"));
+	SceneRoot->SetMobility(EComponentMobility::Static);
+	RootComponent = SceneRoot;
+
+	auto MakeWallComponent = [this](const TCHAR* Name)
+	{
+		UHierarchicalInstancedStaticMeshComponent* Component = CreateDefaultSubobject<UHierarchicalInstancedStaticMeshComponent>(Name);
+		Component->SetupAttachment(SceneRoot);
+		Component->SetMobility(EComponentMobility::Static);
+		Component->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+		Component->SetCollisionProfileName(TEXT("BlockAll"));
+		return Component;
+	};
+	RockWalls = MakeWallComponent(TEXT("RockWalls"));
+	BuiltWalls = MakeWallComponent(TEXT("BuiltWalls"));
+
+	Tags.Add(FName(TEXT("CaveMazeWall")));
+}
+
+void ASLFCaveMazeWalls::SetWallAssets(UStaticMesh* Mesh, UMaterialInterface* RockMaterial, UMaterialInterface* BuiltMaterial)
+{
+	RockWalls->SetStaticMesh(Mesh);
+	BuiltWalls->SetStaticMesh(Mesh);
+	if (RockMaterial)
+	{
+		RockWalls->SetMaterial(0, RockMaterial);
+	}
+	if (BuiltMaterial)
+	{
+		BuiltWalls->SetMaterial(0, BuiltMaterial);
+	}
+}
+
+void ASLFCaveMazeWalls::AddWalls(bool bNaturalRock, const TArray<FTransform>& Transforms, const TArray<FName>& WallTags)
+{
+	check(Transforms.Num() == WallTags.Num());
+	if (Transforms.Num() == 0)
+	{
+		return;
+	}
+
+	// One batched add builds the cluster tree once instead of per wall
+	GetWallComponent(bNaturalRock)->AddInstances(Transforms, /*bShouldReturnIndices*/ false, /*bWorldSpace*/ false);
+	(bNaturalRock ? RockWallTags : BuiltWallTags).Append(WallTags);
+}
+
+void ASLFCaveMazeWalls::ClearWalls()
+{
+	RockWalls->ClearInstances();
+	BuiltWalls->ClearInstances();
+	RockWallTags.Reset();
+	BuiltWallTags.Reset();
+}
+
+const TArray<FName>* ASLFCaveMazeWalls::GetTagTable(const UPrimitiveComponent* Component) const
+{
+	if (Component == RockWalls)
+	{
+		return &RockWallTags;
+	}
+	if (Component == BuiltWalls)
+	{
+		return &BuiltWallTags;
+	}
+	return nullptr;
+}
+
+FName ASLFCaveMazeWalls::GetInstanceTag(const UPrimitiveComponent* Component, int32 InstanceIndex) const
+{
+	const TArray<FName>* Table = GetTagTable(Component);
+	return Table && Table->IsValidIndex(InstanceIndex) ? (*Table)[InstanceIndex] : NAME_None;
+}
+
+int32 ASLFCaveMazeWalls::FindWallsWithTag(FName Tag, TArray<FSLFCaveWallInstance>& OutWalls) const
+{
+	OutWalls.Reset();
+	if (Tag.IsNone())
+	{
+		return 0;
+	}
+
+	for (UHierarchicalInstancedStaticMeshComponent* Component : { RockWalls.Get(), BuiltWalls.Get() })
+	{
+		const TArray<FName>& Table = *GetTagTable(Component);
+		for (int32 Index = 0; Index < Table.Num(); ++Index)
+		{
+			if (Table[Index] == Tag)
+			{
+				FSLFCaveWallInstance& Found = OutWalls.AddDefaulted_GetRef();
+				Found.Component = Component;
+				Found.InstanceIndex = Index;
+			}
+		}
+	}
+	return OutWalls.Num();
+}
@@ -0,0 +1,81 @@
+// SLFCaveMazeWalls.h
+// Instanced cave maze walls: one HISM per wall material plus a per-instance tag table.
+// Spawned by FSLFCaveMazeBuilder in ESLFCaveWallOutput::Instanced mode instead of
+// one AStaticMeshActor per wall segment.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SLFCaveMazeWalls.generated.h"
+
+class UHierarchicalInstancedStaticMeshComponent;
+class UPrimitiveComponent;
+class UStaticMesh;
+class UMaterialInterface;
+
+/** One wall instance found by tag */
+USTRUCT(BlueprintType)
+struct FSLFCaveWallInstance
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	TObjectPtr<UHierarchicalInstancedStaticMeshComponent> Component = nullptr;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 InstanceIndex = INDEX_NONE;
+};
+
+UCLASS()
+class SLFCONVERSION_API ASLFCaveMazeWalls : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ASLFCaveMazeWalls();
+
+	/** Mesh shared by both components, one material per component */
+	void SetWallAssets(UStaticMesh* Mesh, UMaterialInterface* RockMaterial, UMaterialInterface* BuiltMaterial);
+
+	/**
+	 * Append walls to the rock or built component in one batch. Tags parallels Transforms
+	 * (NAME_None = untagged). Walls are only ever appended or cleared, so instance indices stay stable.
+	 */
+	void AddWalls(bool bNaturalRock, const TArray<FTransform>& Transforms, const TArray<FName>& Tags);
+
+	void ClearWalls();
+
+	UHierarchicalInstancedStaticMeshComponent* GetWallComponent(bool bNaturalRock) const { return bNaturalRock ? RockWalls : BuiltWalls; }
+
+	/** Per-wall tag for a hit (Hit.Component, Hit.Item); NAME_None if untagged or not one of ours */
+	UFUNCTION(BlueprintCallable, Category = "Cave Maze")
+	FName GetInstanceTag(const UPrimitiveComponent* Component, int32 InstanceIndex) const;
+
+	/** Every wall instance carrying Tag. Returns the number found. */
+	UFUNCTION(BlueprintCallable, Category = "Cave Maze")
+	int32 FindWallsWithTag(FName Tag, TArray<FSLFCaveWallInstance>& OutWalls) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Cave Maze")
+	int32 GetNumWalls() const { return RockWallTags.Num() + BuiltWallTags.Num(); }
+
+protected:
+	UPROPERTY(VisibleAnywhere, Category = "Cave Maze")
+	TObjectPtr<USceneComponent> SceneRoot;
+
+	UPROPERTY(VisibleAnywhere, Category = "Cave Maze")
+	TObjectPtr<UHierarchicalInstancedStaticMeshComponent> RockWalls;
+
+	UPROPERTY(VisibleAnywhere, Category = "Cave Maze")
+	TObjectPtr<UHierarchicalInstancedStaticMeshComponent> BuiltWalls;
+
+	/** Side tables: wall tag per instance, parallel to each component's instance array */
+	UPROPERTY()
+	TArray<FName> RockWallTags;
+
+	UPROPERTY()
+	TArray<FName> BuiltWallTags;
+
+private:
+	const TArray<FName>* GetTagTable(const UPrimitiveComponent* Component) const;
+};
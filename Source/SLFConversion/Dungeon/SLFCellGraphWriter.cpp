@@ -0,0 +1,167 @@
+// SLFCellGraphWriter.cpp
+
+#include "SLFCellGraphWriter.h"
+#include "HAL/FileManager.h"
+
+FSLFCellGraphWriter::FSLFCellGraphWriter(const FString& JsonPath, const FString& BinaryPath)
+	: bWantsBinary(!BinaryPath.IsEmpty())
+{
+	JsonFile.Reset(IFileManager::Get().CreateFileWriter(*JsonPath));
+	if (JsonFile)
+	{
+		Json = TJsonWriterFactory<UTF8CHAR, TPrettyJsonPrintPolicy<UTF8CHAR>>::Create(JsonFile.Get());
+	}
+
+	if (bWantsBinary)
+	{
+		BinaryFile.Reset(IFileManager::Get().CreateFileWriter(*BinaryPath));
+	}
+}
+
+FSLFCellGraphWriter::~FSLFCellGraphWriter()
+{
+	Finish();
+}
+
+void FSLFCellGraphWriter::WriteNumberArray(const TCHAR* Identifier, std::initializer_list<double> Values)
+{
+	Json->WriteArrayStart(Identifier);
+	for (double Value : Values)
+	{
+		Json->WriteValue(Value);
+	}
+	Json->WriteArrayEnd();
+}
+
+void FSLFCellGraphWriter::Begin(int32 DungeonIndex, const FVector& Origin, const FVector& GridSize)
+{
+	if (!IsOpen() || bBegun)
+	{
+		return;
+	}
+	bBegun = true;
+
+	// Every number goes through WriteValue(double), exactly as FJsonValueNumber does
+	Json->WriteObjectStart();
+	Json->WriteValue(TEXT("dungeonIndex"), static_cast<double>(DungeonIndex));
+	WriteNumberArray(TEXT("origin"), { Origin.X, Origin.Y, Origin.Z });
+	WriteNumberArray(TEXT("gridSize"), { GridSize.X, GridSize.Y, GridSize.Z });
+	Json->WriteArrayStart(TEXT("groups"));
+
+	if (BinaryFile)
+	{
+		FArchive& Ar = *BinaryFile;
+		uint32 Magic = BinaryMagic;
+		int32 Version = BinaryVersion;
+		FVector OriginCopy = Origin;
+		FVector GridSizeCopy = GridSize;
+		Ar << Magic << Version << DungeonIndex << OriginCopy.X << OriginCopy.Y << OriginCopy.Z
+			<< GridSizeCopy.X << GridSizeCopy.Y << GridSizeCopy.Z;
+
+		// Patched in Finish once the group count is known
+		NumGroupsOffset = Ar.Tell();
+		int32 Placeholder = 0;
+		Ar << Placeholder;
+	}
+}
+
+void FSLFCellGraphWriter::WriteGroup(const FSLFCellGraphGroup& Group)
+{
+	if (!IsOpen() || !bBegun || bFinished)
+	{
+		return;
+	}
+
+	const int32 LeafCount = Group.Leaves.Num();
+
+	Json->WriteObjectStart();
+	Json->WriteValue(TEXT("groupId"), static_cast<double>(Group.GroupId));
+	Json->WriteValue(TEXT("groupHeight"), Group.GroupHeight);
+	WriteNumberArray(TEXT("center"), { Group.Center.X, Group.Center.Y, Group.Center.Z });
+	Json->WriteValue(TEXT("radius"), static_cast<double>(Group.Radius));
+	Json->WriteValue(TEXT("leafCount"), static_cast<double>(LeafCount));
+	Json->WriteValue(TEXT("totalArea"), static_cast<double>(Group.TotalArea));
+
+	Json->WriteArrayStart(TEXT("leaves"));
+	for (const FSLFCellGraphLeaf& Leaf : Group.Leaves)
+	{
+		Json->WriteObjectStart();
+		Json->WriteValue(TEXT("cellId"), static_cast<double>(Leaf.CellId));
+		WriteNumberArray(TEXT("center"), { Leaf.Center.X, Leaf.Center.Y });
+		Json->WriteValue(TEXT("area"), static_cast<double>(Leaf.Area));
+		Json->WriteObjectEnd();
+	}
+	Json->WriteArrayEnd();
+
+	Json->WriteArrayStart(TEXT("connections"));
+	for (int32 Connection : Group.Connections)
+	{
+		Json->WriteValue(static_cast<double>(Connection));
+	}
+	Json->WriteArrayEnd();
+	Json->WriteObjectEnd();
+
+	if (BinaryFile)
+	{
+		FArchive& Ar = *BinaryFile;
+		int32 GroupId = Group.GroupId;
+		double GroupHeight = Group.GroupHeight;
+		FVector Center = Group.Center;
+		float Radius = Group.Radius;
+		float TotalArea = Group.TotalArea;
+		int32 NumLeaves = LeafCount;
+		Ar << GroupId << GroupHeight << Center.X << Center.Y << Center.Z << Radius << NumLeaves << TotalArea << NumLeaves;
+		for (FSLFCellGraphLeaf Leaf : Group.Leaves)
+		{
+			Ar << Leaf.CellId << Leaf.Center.X << Leaf.Center.Y << Leaf.Area;
+		}
+
+		int32 NumConnections = Group.Connections.Num();
+		Ar << NumConnections;
+		for (int32 Connection : Group.Connections)
+		{
+			Ar << Connection;
+		}
+	}
+
+	++NumGroups;
+}
+
+bool FSLFCellGraphWriter::Finish()
+{
+	if (bFinished)
+	{
+		return true;
+	}
+	bFinished = true;
+
+	// An export that never began leaves an empty file behind, reported as a failure
+	bool bOk = IsOpen() && bBegun;
+	if (Json)
+	{
+		if (bBegun)
+		{
+			Json->WriteArrayEnd();
+			Json->WriteObjectEnd();
+			bOk &= Json->Close();
+		}
+		Json.Reset();
+	}
+	if (JsonFile)
+	{
+		bOk &= JsonFile->Close();
+		JsonFile.Reset();
+	}
+
+	if (BinaryFile)
+	{
+		if (bBegun)
+		{
+			BinaryFile->Seek(NumGroupsOffset);
+			*BinaryFile << NumGroups;
+		}
+		bOk &= BinaryFile->Close();
+		BinaryFile.Reset();
+	}
+	return bOk;
+}
@@ -0,0 +1,77 @@
+// SLFCellGraphWriter.h
+// Streaming writer for the cell graph export (MapCapture/dungeon_NN_cellgraph.json).
+// Groups are written one at a time straight to the file archive, so memory stays bounded
+// by the largest group instead of a full FJsonObject tree for every CellFlow leaf. The JSON
+// is byte-identical to FJsonSerializer output of the equivalent DOM (pretty printed, numbers
+// as doubles, ANSI/UTF-8 without BOM).
+//
+// Optional compact binary variant (dungeon_NN_cellgraph.bin), little endian:
+//   uint32 Magic 'SLFG', int32 Version, int32 DungeonIndex, double Origin[3], double GridSize[3], int32 NumGroups
+//   per group: int32 GroupId, double GroupHeight, double Center[3], float Radius, int32 LeafCount, float TotalArea,
+//              int32 NumLeaves, { int32 CellId, double Center[2], float Area } * NumLeaves,
+//              int32 NumConnections, int32 Connections[NumConnections]
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+/** One CellFlow leaf in world space */
+struct FSLFCellGraphLeaf
+{
+	int32 CellId = INDEX_NONE;
+	FVector2D Center = FVector2D::ZeroVector;
+	float Area = 0.0f;
+};
+
+/** One active CellFlow group (room) with its leaves */
+struct FSLFCellGraphGroup
+{
+	int32 GroupId = INDEX_NONE;
+	double GroupHeight = 0.0;
+	FVector Center = FVector::ZeroVector;
+	float Radius = 0.0f;
+	float TotalArea = 0.0f;
+	TArray<FSLFCellGraphLeaf> Leaves;
+	TArray<int32> Connections;
+};
+
+class SLFCONVERSION_API FSLFCellGraphWriter
+{
+public:
+	static constexpr uint32 BinaryMagic = 0x47464C53; // "SLFG"
+	static constexpr int32 BinaryVersion = 1;
+
+	/** Opens JsonPath, and BinaryPath too unless it is empty */
+	FSLFCellGraphWriter(const FString& JsonPath, const FString& BinaryPath = FString());
+	~FSLFCellGraphWriter();
+
+	bool IsOpen() const { return JsonFile.IsValid() && (!bWantsBinary || BinaryFile.IsValid()); }
+
+	/** Write the document header (must be called once before any group) */
+	void Begin(int32 DungeonIndex, const FVector& Origin, const FVector& GridSize);
+
+	void WriteGroup(const FSLFCellGraphGroup& Group);
+
+	/** Close the groups array / document and flush. Returns false on any write error. */
+	bool Finish();
+
+	int32 GetNumGroups() const { return NumGroups; }
+
+private:
+	using FJsonFileWriter = TJsonWriter<UTF8CHAR, TPrettyJsonPrintPolicy<UTF8CHAR>>;
+
+	void WriteNumberArray(const TCHAR* Identifier, std::initializer_list<double> Values);
+
+	TUniquePtr<FArchive> JsonFile;
+	TSharedPtr<FJsonFileWriter> Json;
+
+	TUniquePtr<FArchive> BinaryFile;
+	int64 NumGroupsOffset = 0;
+	bool bWantsBinary = false;
+
+	int32 NumGroups = 0;
+	bool bBegun = false;
+	bool bFinished = false;
+};
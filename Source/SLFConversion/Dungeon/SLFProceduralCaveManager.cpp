@@ -28,11 +28,71 @@
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/Character.h"
 #include "EngineUtils.h"  // For TActorIterator
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Materials/MaterialInterface.h"
+#include "Components/MeshComponent.h"
+#endif // WITH_EDITOR
+
+#if WITH_EDITOR
+namespace
+{
+	// Theme fallbacks when CaveTheme is unset (matching the working L_Dungeon_01/02/03
+	// code path in SetupOpenWorldCommandlet)
+	const TCHAR* const FallbackThemePaths[] =
+	{
+		TEXT("/Game/DungeonArchitect/Themes/DT_CaveTheme.DT_CaveTheme"),
+		TEXT("/DungeonArchitect/Showcase/Samples/Themes/Foundry/T_Theme_Founddry.T_Theme_Founddry"),
+		TEXT("/DungeonArchitect/Showcase/Samples/Themes/Legacy/SimpleSciFi/DungeonTheme/D_StarterPackTheme.D_StarterPackTheme"),
+	};
+
+	// Rock material — try multiple paths, engine basic material last
+	const TCHAR* const RockMaterialPaths[] =
+	{
+		TEXT("/Game/Wasteland/Materials/Material_Instances/MI_Rock_03.MI_Rock_03"),
+		TEXT("/Game/WastelandEnvironment/Materials/Material_Instances/MI_Rock_01.MI_Rock_01"),
+		TEXT("/Game/Wasteland/Materials/Material_Instances/MI_Rock_01.MI_Rock_01"),
+		TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"),
+	};
+
+	template <typename T, int32 N>
+	T* ResolveFirstOf(const TCHAR* const (&Paths)[N], bool bLoad)
+	{
+		for (const TCHAR* Path : Paths)
+		{
+			const FSoftObjectPath SoftPath(Path);
+			if (T* Object = Cast<T>(bLoad ? SoftPath.TryLoad() : SoftPath.ResolveObject()))
+			{
+				return Object;
+			}
+		}
+		return nullptr;
+	}
+
+	/** The entry ResolveFirstOf will pick once loaded: first one already in memory or known to the asset registry */
+	template <int32 N>
+	FSoftObjectPath FindFirstExisting(const TCHAR* const (&Paths)[N])
+	{
+		IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+		for (const TCHAR* Path : Paths)
+		{
+			const FSoftObjectPath SoftPath(Path);
+			if (SoftPath.ResolveObject() || AssetRegistry.GetAssetByObjectPath(SoftPath).IsValid())
+			{
+				return SoftPath;
+			}
+		}
+		return FSoftObjectPath();
+	}
+}
 #endif // WITH_EDITOR
 
 AProceduralCaveManager::AProceduralCaveManager()
 {
-	PrimaryActorTick.bCanEverTick = false;
+	// Ticks only while an async build is in flight
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 }
 
 void AProceduralCaveManager::BeginPlay()
@@ -43,9 +103,11 @@ void AProceduralCaveManager::BeginPlay()
 	if (bAutoBuildOnPlay)
 	{
 		FTimerHandle TimerHandle;
-		GetWorldTimerManager().SetTimer(TimerHandle, this,
-			&AProceduralCaveManager::BuildCaveDungeon, 1.0f, false);
-		UE_LOG(LogTemp, Warning, TEXT("[CaveDungeon] Auto-build scheduled in 1 second"));
+		GetWorldTimerManager().SetTimer(TimerHandle, this, bAsyncBuildOnPlay
+			? &AProceduralCaveManager::BuildCaveDungeonAsync
+			: &AProceduralCaveManager::BuildCaveDungeon, 1.0f, false);
+		UE_LOG(LogTemp, Warning, TEXT("[CaveDungeon] Auto-build scheduled in 1 second (%s)"),
+			bAsyncBuildOnPlay ? TEXT("async") : TEXT("sync"));
 	}
 	else if (bHasStoredEntrance)
 	{
@@ -62,6 +124,30 @@ void AProceduralCaveManager::BeginPlay()
 #endif
 }
 
+void AProceduralCaveManager::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+#if WITH_EDITOR
+	TickAsyncBuild();
+#endif
+}
+
+void AProceduralCaveManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+#if WITH_EDITOR
+	if (AssetLoadHandle.IsValid())
+	{
+		AssetLoadHandle->CancelHandle();
+		AssetLoadHandle.Reset();
+	}
+	BuildPhase = ESLFCaveBuildPhase::Idle;
+	PendingMaterialComponents.Empty();
+#endif
+
+	Super::EndPlay(EndPlayReason);
+}
+
 #if WITH_EDITOR
 
 void AProceduralCaveManager::BuildCaveDungeon()
@@ -72,6 +158,11 @@ void AProceduralCaveManager::BuildCaveDungeon()
 		UE_LOG(LogTemp, Error, TEXT("[CaveDungeon] No world!"));
 		return;
 	}
+	if (IsBuildInProgress())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[CaveDungeon] Async build already in progress"));
+		return;
+	}
 
 	UE_LOG(LogTemp, Warning, TEXT("=== Building Unified Voxel Cave (CellFlow) ==="));
 
@@ -81,73 +172,240 @@ void AProceduralCaveManager::BuildCaveDungeon()
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[CaveDungeon] CellFlowAsset not assigned!"));
 		UE_LOG(LogTemp, Warning, TEXT("  Run: -run=AutoBuildDungeon to generate CF_UnifiedCave"));
+		FinishBuild(false);
 		return;
 	}
 
+	ResolveBuildAssets(true);
+	if (!SpawnCaveDungeon(World, 0.0f)) // Synchronous
+	{
+		FinishBuild(false);
+		return;
+	}
+
+	// Build synchronously
+	UE_LOG(LogTemp, Warning, TEXT("  Building dungeon (seed=%d)..."), Seed);
+	CaveDungeon->BuildDungeon();
+
+	bool bBuildOk = CaveDungeon->GetBuilder() && CaveDungeon->GetBuilder()->HasBuildSucceeded();
+	UE_LOG(LogTemp, Warning, TEXT("  Build: %s"), bBuildOk ? TEXT("OK") : TEXT("FAILED"));
+
+	if (bBuildOk)
+	{
+		// Force-set rock material on all voxel mesh actors spawned by DA.
+		// DA's internal material pipeline may not apply VMS.Material reliably at runtime.
+		ForceMaterialOnVoxelMeshes(World);
+
+		OnBuildComplete(CaveDungeon, true);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CaveDungeon] Build failed!"));
+	}
+	FinishBuild(bBuildOk);
+}
+
+void AProceduralCaveManager::ResolveBuildAssets(bool bLoad)
+{
+	// Use editor-assigned theme, or fall back to DA bundled themes
+	ResolvedTheme = CaveTheme ? CaveTheme.Get() : ResolveFirstOf<UDungeonThemeAsset>(FallbackThemePaths, bLoad);
+	ResolvedRockMaterial = ResolveFirstOf<UMaterialInterface>(RockMaterialPaths, bLoad);
+}
+
+TArray<FSoftObjectPath> AProceduralCaveManager::GetBuildAssetPaths() const
+{
+	TArray<FSoftObjectPath> Paths;
+	Paths.Add(CellFlowAsset.ToSoftObjectPath());
+
+	// Only the fallback entries ResolveBuildAssets will actually pick, not every candidate
+	const FSoftObjectPath ThemePath = CaveTheme ? FSoftObjectPath() : FindFirstExisting(FallbackThemePaths);
+	if (ThemePath.IsValid())
+	{
+		Paths.Add(ThemePath);
+	}
+	const FSoftObjectPath RockMaterialPath = FindFirstExisting(RockMaterialPaths);
+	if (RockMaterialPath.IsValid())
+	{
+		Paths.Add(RockMaterialPath);
+	}
+	return Paths;
+}
+
+bool AProceduralCaveManager::SpawnCaveDungeon(UWorld* World, float MaxBuildTimePerFrameMs)
+{
 	// ── Spawn single ADungeon ──
 	CaveDungeon = World->SpawnActor<ADungeon>(GetActorLocation(), FRotator::ZeroRotator);
 	if (!CaveDungeon)
 	{
 		UE_LOG(LogTemp, Error, TEXT("[CaveDungeon] Failed to spawn ADungeon!"));
-		return;
+		return false;
 	}
 
 	CaveDungeon->SetFolderPath(FName(TEXT("CaveDungeon")));
 	CaveDungeon->bDrawDebugData = false; // No "Preview" text
 
 	// Configure CellFlow builder + voxel
-	ConfigureDungeon(CaveDungeon);
+	ConfigureDungeon(CaveDungeon, MaxBuildTimePerFrameMs);
 
-	// Assign theme — use editor-assigned theme, or fall back to DA bundled themes
-	// (matching the working L_Dungeon_01/02/03 code path in SetupOpenWorldCommandlet)
-	UDungeonThemeAsset* ThemeToUse = CaveTheme;
-	if (!ThemeToUse)
+	if (ResolvedTheme)
 	{
-		ThemeToUse = LoadObject<UDungeonThemeAsset>(nullptr,
-			TEXT("/Game/DungeonArchitect/Themes/DT_CaveTheme.DT_CaveTheme"));
+		CaveDungeon->Themes.Add(ResolvedTheme);
+		UE_LOG(LogTemp, Warning, TEXT("  Theme: %s"), *ResolvedTheme->GetPathName());
 	}
-	if (!ThemeToUse)
+	else
 	{
-		ThemeToUse = LoadObject<UDungeonThemeAsset>(nullptr,
-			TEXT("/DungeonArchitect/Showcase/Samples/Themes/Foundry/T_Theme_Founddry.T_Theme_Founddry"));
+		UE_LOG(LogTemp, Warning, TEXT("  WARNING: No theme found! Cave will have no decoration meshes."));
 	}
-	if (!ThemeToUse)
+	return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// ASYNC BUILD
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void AProceduralCaveManager::BuildCaveDungeonAsync()
+{
+	if (!GetWorld() || IsBuildInProgress())
 	{
-		ThemeToUse = LoadObject<UDungeonThemeAsset>(nullptr,
-			TEXT("/DungeonArchitect/Showcase/Samples/Themes/Legacy/SimpleSciFi/DungeonTheme/D_StarterPackTheme.D_StarterPackTheme"));
+		return;
 	}
-	if (ThemeToUse)
+
+	if (CellFlowAsset.IsNull())
 	{
-		CaveDungeon->Themes.Add(ThemeToUse);
-		UE_LOG(LogTemp, Warning, TEXT("  Theme: %s"), *ThemeToUse->GetPathName());
+		UE_LOG(LogTemp, Warning, TEXT("[CaveDungeon] CellFlowAsset not assigned!"));
+		FinishBuild(false);
+		return;
 	}
-	else
+
+	UE_LOG(LogTemp, Warning, TEXT("=== Building Unified Voxel Cave (CellFlow, async, %.1f ms/frame) ==="), FrameBudgetMs);
+	BuildStartTime = FPlatformTime::Seconds();
+	BuildPhase = ESLFCaveBuildPhase::LoadingAssets;
+
+	// Flow, fallback theme and rock material stream in together
+	AssetLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(GetBuildAssetPaths(),
+		FStreamableDelegate::CreateUObject(this, &AProceduralCaveManager::OnBuildAssetsLoaded),
+		FStreamableManager::AsyncLoadHighPriority);
+	if (!AssetLoadHandle.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("  WARNING: No theme found! Cave will have no decoration meshes."));
+		// Nothing to load (all already resident) - continue immediately
+		OnBuildAssetsLoaded();
 	}
+}
 
-	// Build synchronously
-	UE_LOG(LogTemp, Warning, TEXT("  Building dungeon (seed=%d)..."), Seed);
+void AProceduralCaveManager::OnBuildAssetsLoaded()
+{
+	if (BuildPhase != ESLFCaveBuildPhase::LoadingAssets)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World || !CellFlowAsset.Get())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CaveDungeon] CellFlowAsset failed to load: %s"), *CellFlowAsset.ToString());
+		FinishBuild(false);
+		return;
+	}
+
+	ResolveBuildAssets(false);
+	UE_LOG(LogTemp, Warning, TEXT("  Assets streamed in %.2f s"), FPlatformTime::Seconds() - BuildStartTime);
+
+	// DA spreads the CellFlow layout / voxel build over frames when given a per-frame budget
+	if (!SpawnCaveDungeon(World, FrameBudgetMs))
+	{
+		FinishBuild(false);
+		return;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("  Building dungeon (seed=%d, time-sliced)..."), Seed);
 	CaveDungeon->BuildDungeon();
 
-	bool bBuildOk = CaveDungeon->GetBuilder() && CaveDungeon->GetBuilder()->HasBuildSucceeded();
-	UE_LOG(LogTemp, Warning, TEXT("  Build: %s"), bBuildOk ? TEXT("OK") : TEXT("FAILED"));
+	BuildPhase = ESLFCaveBuildPhase::Building;
+	PhaseStartTime = FPlatformTime::Seconds();
+	SetActorTickEnabled(true);
+}
 
-	if (bBuildOk)
+void AProceduralCaveManager::TickAsyncBuild()
+{
+	UWorld* World = GetWorld();
+	const double FrameStart = FPlatformTime::Seconds();
+	const double Deadline = FrameStart + FrameBudgetMs / 1000.0;
+
+	switch (BuildPhase)
 	{
-		// Force-set rock material on all voxel mesh actors spawned by DA.
-		// DA's internal material pipeline may not apply VMS.Material reliably at runtime.
-		ForceMaterialOnVoxelMeshes(World);
+	case ESLFCaveBuildPhase::Building:
+	{
+		if (!CaveDungeon || !CaveDungeon->GetBuilder())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[CaveDungeon] Dungeon destroyed during build"));
+			FinishBuild(false);
+			return;
+		}
+		if (!CaveDungeon->GetBuilder()->HasBuildSucceeded())
+		{
+			if (FrameStart - PhaseStartTime > BuildTimeoutSeconds)
+			{
+				UE_LOG(LogTemp, Error, TEXT("[CaveDungeon] Build failed! (no result after %.0f s)"), BuildTimeoutSeconds);
+				FinishBuild(false);
+			}
+			return;
+		}
 
-		OnBuildComplete(CaveDungeon, true);
+		UE_LOG(LogTemp, Warning, TEXT("  Build: OK (%.2f s)"), FrameStart - PhaseStartTime);
+		GatherVoxelMeshComponents(World, PendingMaterialComponents);
+		NextMaterialComponent = 0;
+		BuildPhase = ESLFCaveBuildPhase::ApplyingMaterials;
+		return;
 	}
-	else
+
+	case ESLFCaveBuildPhase::ApplyingMaterials:
 	{
-		UE_LOG(LogTemp, Error, TEXT("[CaveDungeon] Build failed!"));
+		// SetMaterial re-creates render state per component; do as many as fit in the budget
+		if (ResolvedRockMaterial)
+		{
+			while (NextMaterialComponent < PendingMaterialComponents.Num() && FPlatformTime::Seconds() < Deadline)
+			{
+				if (UMeshComponent* MC = PendingMaterialComponents[NextMaterialComponent].Get())
+				{
+					MC->SetMaterial(0, ResolvedRockMaterial);
+				}
+				++NextMaterialComponent;
+			}
+			if (NextMaterialComponent < PendingMaterialComponents.Num())
+			{
+				return;
+			}
+			UE_LOG(LogTemp, Warning, TEXT("  ForceMaterial: Applied %s to %d voxel mesh components"),
+				*ResolvedRockMaterial->GetName(), PendingMaterialComponents.Num());
+		}
+		PendingMaterialComponents.Empty();
+		BuildPhase = ESLFCaveBuildPhase::Finalizing;
+		return;
 	}
+
+	case ESLFCaveBuildPhase::Finalizing:
+		OnBuildComplete(CaveDungeon, true);
+		UE_LOG(LogTemp, Warning, TEXT("  Async build finished in %.2f s"), FPlatformTime::Seconds() - BuildStartTime);
+		FinishBuild(true);
+		return;
+
+	default:
+		SetActorTickEnabled(false);
+		return;
+	}
+}
+
+void AProceduralCaveManager::FinishBuild(bool bSuccess)
+{
+	BuildPhase = ESLFCaveBuildPhase::Idle;
+	AssetLoadHandle.Reset();
+	PendingMaterialComponents.Empty();
+	SetActorTickEnabled(false);
+
+	OnCaveBuildCompleted.Broadcast(bSuccess);
 }
 
-void AProceduralCaveManager::ConfigureDungeon(ADungeon* Dungeon)
+void AProceduralCaveManager::ConfigureDungeon(ADungeon* Dungeon, float MaxBuildTimePerFrameMs)
 {
 	if (!Dungeon) return;
 
@@ -161,10 +419,10 @@ void AProceduralCaveManager::ConfigureDungeon(ADungeon* Dungeon)
 		Dungeon->Config = Config;
 	}
 
-	Config->CellFlow = CellFlowAsset.LoadSynchronous();
+	Config->CellFlow = CellFlowAsset.Get();
 	Config->GridSize = GridSize;
 	Config->Seed = Seed;
-	Config->MaxBuildTimePerFrameMs = 0; // Synchronous
+	Config->MaxBuildTimePerFrameMs = MaxBuildTimePerFrameMs; // 0 = synchronous
 
 	// Voxel carving
 	Dungeon->bCarveVoxels = true;
@@ -181,28 +439,7 @@ void AProceduralCaveManager::ConfigureDungeon(ADungeon* Dungeon)
 	// Our own CaveTheme handles all visual markers.
 	VMS.VoxelShapeTheme.Reset();
 
-	// Rock material — try multiple paths
-	UMaterialInterface* RockMat = LoadObject<UMaterialInterface>(nullptr,
-		TEXT("/Game/Wasteland/Materials/Material_Instances/MI_Rock_03.MI_Rock_03"));
-	if (!RockMat)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("  MI_Rock_03 not found, trying MI_Rock_01..."));
-		RockMat = LoadObject<UMaterialInterface>(nullptr,
-			TEXT("/Game/WastelandEnvironment/Materials/Material_Instances/MI_Rock_01.MI_Rock_01"));
-	}
-	if (!RockMat)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("  MI_Rock_01 not found, trying Wasteland MI_Rock_01..."));
-		RockMat = LoadObject<UMaterialInterface>(nullptr,
-			TEXT("/Game/Wasteland/Materials/Material_Instances/MI_Rock_01.MI_Rock_01"));
-	}
-	if (!RockMat)
-	{
-		// Fallback: use engine basic material
-		UE_LOG(LogTemp, Warning, TEXT("  No Wasteland rock material found! Using engine fallback."));
-		RockMat = LoadObject<UMaterialInterface>(nullptr,
-			TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
-	}
+	UMaterialInterface* RockMat = ResolvedRockMaterial;
 	UE_LOG(LogTemp, Warning, TEXT("  Voxel Material: %s"), RockMat ? *RockMat->GetPathName() : TEXT("NULL — 'Preview' material will show!"));
 	if (RockMat)
 	{
@@ -232,28 +469,34 @@ void AProceduralCaveManager::ForceMaterialOnVoxelMeshes(UWorld* World)
 {
 	if (!World) return;
 
-	// Load rock material
-	UMaterialInterface* RockMat = LoadObject<UMaterialInterface>(nullptr,
-		TEXT("/Game/Wasteland/Materials/Material_Instances/MI_Rock_03.MI_Rock_03"));
-	if (!RockMat)
-	{
-		RockMat = LoadObject<UMaterialInterface>(nullptr,
-			TEXT("/Game/WastelandEnvironment/Materials/Material_Instances/MI_Rock_01.MI_Rock_01"));
-	}
-	if (!RockMat)
-	{
-		RockMat = LoadObject<UMaterialInterface>(nullptr,
-			TEXT("/Game/Wasteland/Materials/Material_Instances/MI_Rock_01.MI_Rock_01"));
-	}
+	UMaterialInterface* RockMat = ResolvedRockMaterial;
 	if (!RockMat)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("  ForceMaterial: No rock material found!"));
 		return;
 	}
 
+	TArray<TWeakObjectPtr<UMeshComponent>> MeshComps;
+	GatherVoxelMeshComponents(World, MeshComps);
+	for (const TWeakObjectPtr<UMeshComponent>& MC : MeshComps)
+	{
+		if (UMeshComponent* Comp = MC.Get())
+		{
+			Comp->SetMaterial(0, RockMat);
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("  ForceMaterial: Applied %s to %d voxel mesh components"),
+		*RockMat->GetName(), MeshComps.Num());
+}
+
+void AProceduralCaveManager::GatherVoxelMeshComponents(UWorld* World, TArray<TWeakObjectPtr<UMeshComponent>>& OutComponents) const
+{
+	OutComponents.Reset();
+	if (!World) return;
+
 	// DA tags all voxel chunk actors with "da_voxel_mesh"
-	// Iterate all actors with that tag and force-set material on their mesh components
-	int32 Count = 0;
+	TArray<UMeshComponent*> MeshComps;
 	for (TActorIterator<AActor> It(World); It; ++It)
 	{
 		AActor* Actor = *It;
@@ -262,20 +505,15 @@ void AProceduralCaveManager::ForceMaterialOnVoxelMeshes(UWorld* World)
 			continue;
 		}
 
-		TArray<UMeshComponent*> MeshComps;
 		Actor->GetComponents<UMeshComponent>(MeshComps);
 		for (UMeshComponent* MC : MeshComps)
 		{
 			if (MC)
 			{
-				MC->SetMaterial(0, RockMat);
-				Count++;
+				OutComponents.Add(MC);
 			}
 		}
 	}
-
-	UE_LOG(LogTemp, Warning, TEXT("  ForceMaterial: Applied %s to %d voxel mesh components"),
-		*RockMat->GetName(), Count);
 }
 
 void AProceduralCaveManager::OnBuildComplete(ADungeon* Dungeon, bool bSuccess)
@@ -409,4 +647,10 @@ void AProceduralCaveManager::BuildCaveDungeon()
 	UE_LOG(LogTemp, Warning, TEXT("[CaveDungeon] BuildCaveDungeon requires editor (WITH_EDITOR)."));
 }
 
+void AProceduralCaveManager::BuildCaveDungeonAsync()
+{
+	UE_LOG(LogTemp, Warning, TEXT("[CaveDungeon] BuildCaveDungeonAsync requires editor (WITH_EDITOR)."));
+	OnCaveBuildCompleted.Broadcast(false);
+}
+
 #endif // WITH_EDITOR
@@ -7,6 +7,13 @@
 //   - Boss arena (boss path end) → spawn ADAVoxelVolume with flat noise
 //
 // Configurable via editor properties: CellFlowAsset, CaveTheme, Seed, GridSize.
+//
+// BuildCaveDungeonAsync (used for auto-build on play) avoids the one-frame hitch of
+// BuildCaveDungeon: flow / theme / material assets stream in, DA's CellFlow build is
+// time-sliced (MaxBuildTimePerFrameMs), and the voxel material override runs across
+// frames under FrameBudgetMs. The path query, boss volume and teleport are cheap and
+// run together in the single Finalizing tick that follows.
+// OnCaveBuildCompleted fires at the end of either build.
 
 #pragma once
 
@@ -17,6 +24,22 @@
 class ADungeon;
 class UCellFlowAsset;
 class UDungeonThemeAsset;
+class UMaterialInterface;
+class UMeshComponent;
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCaveBuildCompleted, bool, bSuccess);
+
+/** Step of an in-flight BuildCaveDungeonAsync */
+UENUM()
+enum class ESLFCaveBuildPhase : uint8
+{
+	Idle,
+	LoadingAssets,
+	Building,
+	ApplyingMaterials,	// Time-sliced under FrameBudgetMs
+	Finalizing			// Path query, boss volume, teleport - one tick
+};
 
 UCLASS()
 class SLFCONVERSION_API AProceduralCaveManager : public AActor
@@ -26,13 +49,38 @@ class SLFCONVERSION_API AProceduralCaveManager : public AActor
 public:
 	AProceduralCaveManager();
 	virtual void BeginPlay() override;
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+	/** Build everything in one call (commandlets save the level right after) */
 	UFUNCTION(BlueprintCallable, Category = "Cave Dungeon")
 	void BuildCaveDungeon();
 
+	/** Build across frames; OnCaveBuildCompleted fires when done. No-op while a build is running. */
+	UFUNCTION(BlueprintCallable, Category = "Cave Dungeon")
+	void BuildCaveDungeonAsync();
+
+	UFUNCTION(BlueprintPure, Category = "Cave Dungeon")
+	bool IsBuildInProgress() const { return BuildPhase != ESLFCaveBuildPhase::Idle; }
+
+	UPROPERTY(BlueprintAssignable, Category = "Cave Dungeon")
+	FOnCaveBuildCompleted OnCaveBuildCompleted;
+
 	UPROPERTY(EditAnywhere, Category = "Cave Dungeon")
 	bool bAutoBuildOnPlay = true;
 
+	/** Auto-build on play uses BuildCaveDungeonAsync */
+	UPROPERTY(EditAnywhere, Category = "Cave Dungeon|Async Build")
+	bool bAsyncBuildOnPlay = true;
+
+	/** Game-thread time per frame for the async build (DA time slicing and post-build passes) */
+	UPROPERTY(EditAnywhere, Category = "Cave Dungeon|Async Build", meta = (ClampMin = "0.5"))
+	float FrameBudgetMs = 4.0f;
+
+	/** Give up on a time-sliced DA build that has not succeeded after this long */
+	UPROPERTY(EditAnywhere, Category = "Cave Dungeon|Async Build", meta = (ClampMin = "1.0"))
+	float BuildTimeoutSeconds = 60.0f;
+
 	UPROPERTY(EditAnywhere, Category = "Cave Dungeon")
 	TSoftObjectPtr<UCellFlowAsset> CellFlowAsset;
 
@@ -56,9 +104,19 @@ public:
 	bool bHasStoredEntrance = false;
 
 private:
-	void ConfigureDungeon(ADungeon* Dungeon);
+	/** Resolve theme + rock material (bLoad = false after streaming: only already-loaded objects) */
+	void ResolveBuildAssets(bool bLoad);
+	TArray<FSoftObjectPath> GetBuildAssetPaths() const;
+	bool SpawnCaveDungeon(UWorld* World, float MaxBuildTimePerFrameMs);
+	void ConfigureDungeon(ADungeon* Dungeon, float MaxBuildTimePerFrameMs);
 	void ForceMaterialOnVoxelMeshes(UWorld* World);
+	void GatherVoxelMeshComponents(UWorld* World, TArray<TWeakObjectPtr<UMeshComponent>>& OutComponents) const;
 	void OnBuildComplete(ADungeon* Dungeon, bool bSuccess);
+	void FinishBuild(bool bSuccess);
+
+	// Async build steps
+	void OnBuildAssetsLoaded();
+	void TickAsyncBuild();
 	void SpawnBossArenaVolume(UWorld* World, const FVector& BossPos);
 	void TeleportPlayerToEntrance(const FVector& EntrancePos);
 	void QueryPathPositions(ADungeon* Dungeon, FVector& OutEntrance, FVector& OutBoss,
@@ -66,4 +124,18 @@ private:
 
 	UPROPERTY()
 	TObjectPtr<ADungeon> CaveDungeon;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UDungeonThemeAsset> ResolvedTheme;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UMaterialInterface> ResolvedRockMaterial;
+
+	/** Async build state */
+	ESLFCaveBuildPhase BuildPhase = ESLFCaveBuildPhase::Idle;
+	TSharedPtr<FStreamableHandle> AssetLoadHandle;
+	TArray<TWeakObjectPtr<UMeshComponent>> PendingMaterialComponents;
+	int32 NextMaterialComponent = 0;
+	double BuildStartTime = 0.0;
+	double PhaseStartTime = 0.0;
 };
@@ -8,6 +8,7 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetCompilingManager.h"
 #include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
 #include "AssetImportTask.h"
 #include "Factories/FbxFactory.h"
 #include "Factories/FbxImportUI.h"
@@ -17,8 +18,14 @@
 #include "IAssetTools.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
+#include "Async/ParallelFor.h"
+#include "Hash/xxhash.h"
+#include "Tasks/Task.h"
+#include "SLFEnemyImportManifest.h"
+#include "SLFRetargetDumpWriter.h"
 
 // IKRig headers
 #include "Rig/IKRigDefinition.h"
@@ -28,6 +35,131 @@
 #include "Retargeter/IKRetargetProcessor.h"
 #include "Retargeter/IKRetargetProfile.h"
 
+// ═══════════════════════════════════════════════════════════════════════════════
+// PIPELINE STATE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+struct UIKRetargetMultiSourceCommandlet::FEnemyBatch
+{
+	struct FAnim
+	{
+		FString SentinelName;
+		UAnimSequence* Source = nullptr;
+		uint64 SourceKey = 0;
+		uint64 OutputKey = 0;
+
+		/** Existing retargeted asset is current; its keys were read back for the dump */
+		bool bUpToDate = false;
+		bool bRetargeted = false;
+
+		FFrameRate FrameRate;
+		double PlayLength = 0.0;
+		int32 NumKeys = 0;
+
+		/** [Key][SourceBone] component-space source pose, consumed by RunRetarget */
+		TArray<TArray<FTransform>> SourceGlobal;
+
+		/** [TargetBone][Key] local keys */
+		TArray<TArray<FVector>> PosKeys;
+		TArray<TArray<FQuat>> RotKeys;
+		TArray<TArray<FVector>> ScaleKeys;
+	};
+
+	FString ChrId;
+	USkeletalMesh* Mesh = nullptr;
+	uint64 MeshKey = 0;
+	TArray<FAnim> Anims;
+
+	TUniquePtr<FIKRetargetProcessor> Processor;
+	FRetargetProfile Profile;
+	UE::Tasks::FTask RetargetTask;
+
+	/** Worker time spent in RunRetarget */
+	double RetargetSeconds = 0.0;
+};
+
+namespace
+{
+	/** Bump when the FBX import options change (invalidates imported meshes and animations) */
+	constexpr uint64 ImportSettingsVersion = 1;
+
+	/** Bump when the retarget chains or retargeter ops change (invalidates rigs, retargeters and outputs) */
+	constexpr uint64 RigDefinitionVersion = 1;
+
+	struct FStageTimer
+	{
+		double& Seconds;
+		const double Start = FPlatformTime::Seconds();
+
+		explicit FStageTimer(double& InSeconds) : Seconds(InSeconds) {}
+		~FStageTimer() { Seconds += FPlatformTime::Seconds() - Start; }
+	};
+
+	uint64 CombineKeys(std::initializer_list<uint64> Keys)
+	{
+		FXxHash64Builder Builder;
+		for (const uint64 Key : Keys)
+		{
+			Builder.Update(&Key, sizeof(Key));
+		}
+		return Builder.Finalize().Hash;
+	}
+
+	/** Bone names, parents and reference pose */
+	uint64 HashSkeleton(const FReferenceSkeleton& RefSkel)
+	{
+		FXxHash64Builder Builder;
+		const TArray<FTransform>& RefPose = RefSkel.GetRefBonePose();
+		for (int32 i = 0; i < RefSkel.GetRawBoneNum(); i++)
+		{
+			const FString Name = RefSkel.GetBoneName(i).ToString();
+			const int32 Parent = RefSkel.GetParentIndex(i);
+			const FVector Pos = RefPose[i].GetTranslation();
+			const FQuat Rot = RefPose[i].GetRotation();
+			const FVector Scale = RefPose[i].GetScale3D();
+			Builder.Update(*Name, Name.Len() * sizeof(TCHAR));
+			Builder.Update(&Parent, sizeof(Parent));
+			Builder.Update(&Pos, sizeof(Pos));
+			Builder.Update(&Rot, sizeof(Rot));
+			Builder.Update(&Scale, sizeof(Scale));
+		}
+		return Builder.Finalize().Hash;
+	}
+
+	FString HashToString(uint64 Hash)
+	{
+		return FString::Printf(TEXT("%016llx"), Hash);
+	}
+
+	TMap<FString, uint64> LoadOutputKeys(const FString& Path, int32 Version)
+	{
+		TMap<FString, uint64> Keys;
+		FString Text;
+		if (!FFileHelper::LoadFileToString(Text, *Path))
+		{
+			return Keys;
+		}
+
+		TSharedPtr<FJsonObject> Root;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+		if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || Root->GetIntegerField(TEXT("version")) != Version)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("  Ignoring resume state %s (unreadable or other version)"), *Path);
+			return Keys;
+		}
+
+		const TSharedPtr<FJsonObject>* Outputs = nullptr;
+		if (Root->TryGetObjectField(TEXT("outputs"), Outputs))
+		{
+			for (const auto& Pair : (*Outputs)->Values)
+			{
+				Keys.Add(Pair.Key, FParse::HexNumber64(*Pair.Value->AsString()));
+			}
+		}
+		return Keys;
+	}
+}
+
 UIKRetargetMultiSourceCommandlet::UIKRetargetMultiSourceCommandlet()
 {
 	IsClient = false;
@@ -39,6 +171,12 @@ UIKRetargetMultiSourceCommandlet::UIKRetargetMultiSourceCommandlet()
 int32 UIKRetargetMultiSourceCommandlet::Main(const FString& Params)
 {
 	UE_LOG(LogTemp, Warning, TEXT("=== IKRetargetMultiSource Commandlet ==="));
+	const double StartTime = FPlatformTime::Seconds();
+
+	bForce = Params.Contains(TEXT("-force"));
+	const bool bSequential = Params.Contains(TEXT("-sequential"));
+	UE_LOG(LogTemp, Warning, TEXT("  Mode: %s%s"),
+		bSequential ? TEXT("sequential") : TEXT("pipelined"), bForce ? TEXT(", -force (rebuild all)") : TEXT(""));
 
 	// Initialize Slate (needed for asset import tasks)
 	if (!FSlateApplication::IsInitialized())
@@ -47,8 +185,6 @@ int32 UIKRetargetMultiSourceCommandlet::Main(const FString& Params)
 		UE_LOG(LogTemp, Warning, TEXT("  Slate initialized"));
 	}
 
-	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
-
 	// ─── Animation mapping: SentinelName -> (ChrId, source FBX name) ───
 	struct FAnimDef { const TCHAR* SentinelName; const TCHAR* ChrId; };
 	const FAnimDef AnimDefs[] = {
@@ -71,313 +207,539 @@ int32 UIKRetargetMultiSourceCommandlet::Main(const FString& Params)
 	// Unique source enemies (excluding c3100 which is the target)
 	const TCHAR* SourceEnemies[] = { TEXT("c3180"), TEXT("c3560"), TEXT("c4060"), TEXT("c4080"), TEXT("c4090") };
 
+	// ─── Resume state ───
+	StatePath = FPaths::ProjectSavedDir() / TEXT("SLFImport") / TEXT("IKRetargetMultiSource.json");
+	if (!bForce)
+	{
+		OutputKeys = LoadOutputKeys(StatePath, StateVersion);
+	}
+	UE_LOG(LogTemp, Warning, TEXT("  Resume state: %d outputs recorded (%s)"), OutputKeys.Num(), *StatePath);
+
+	// ─── Hash every source FBX (content keys for resume) ───
+	TMap<FString, uint64> FbxHashes;
+	{
+		FStageTimer Timer(StageSeconds[(int32)EStage::HashSources]);
+
+		TArray<FString> FbxPaths;
+		for (const TCHAR* ChrId : SourceEnemies)
+		{
+			FbxPaths.Add(FString::Printf(TEXT("%s/%s/%s_mesh.fbx"), RawFbxDir, ChrId, ChrId));
+		}
+		for (const auto& AD : AnimDefs)
+		{
+			FbxPaths.Add(FString::Printf(TEXT("%s/%s/%s.fbx"), RawFbxDir, AD.ChrId, AD.SentinelName));
+		}
+
+		TArray<uint64> Hashes;
+		Hashes.SetNumZeroed(FbxPaths.Num());
+		ParallelFor(FbxPaths.Num(), [&FbxPaths, &Hashes](int32 Index)
+		{
+			Hashes[Index] = FSLFEnemyImportManifest::HashFile(FbxPaths[Index]);
+		});
+		for (int32 i = 0; i < FbxPaths.Num(); i++)
+		{
+			FbxHashes.Add(FbxPaths[i], Hashes[i]);
+		}
+	}
+
 	// ─── Step 0: Load c3100 (target) skeleton and mesh ───
 	UE_LOG(LogTemp, Warning, TEXT("--- Step 0: Load c3100 target ---"));
-	USkeletalMesh* C3100Mesh = LoadObject<USkeletalMesh>(nullptr, C3100MeshPath);
+	USkeletalMesh* C3100Mesh = nullptr;
+	{
+		FStageTimer Timer(StageSeconds[(int32)EStage::LoadTarget]);
+		C3100Mesh = LoadObject<USkeletalMesh>(nullptr, C3100MeshPath);
+	}
 	if (!C3100Mesh)
 	{
 		UE_LOG(LogTemp, Error, TEXT("  c3100 mesh not found at %s"), C3100MeshPath);
 		return 1;
 	}
-	USkeleton* C3100Skel = C3100Mesh->GetSkeleton();
+	const FReferenceSkeleton& C3100RefSkel = C3100Mesh->GetRefSkeleton();
+	const uint64 TargetSkeletonHash = HashSkeleton(C3100RefSkel);
 	UE_LOG(LogTemp, Warning, TEXT("  c3100: %s (%d bones)"),
-		*C3100Mesh->GetName(), C3100Mesh->GetRefSkeleton().GetRawBoneNum());
+		*C3100Mesh->GetName(), C3100RefSkel.GetRawBoneNum());
+
+	// ─── Step 1: IKRig for target (c3100) ───
+	UE_LOG(LogTemp, Warning, TEXT("--- Step 1: IKRig for c3100 (target) ---"));
+	const FString TargetRigDir = FString::Printf(TEXT("%s/IKRigs"), TempContentDir);
+	UIKRigDefinition* TargetRig = nullptr;
+	{
+		FStageTimer Timer(StageSeconds[(int32)EStage::RigSetup]);
+		TargetRig = FindOrCreateIKRig(C3100Mesh, TargetRigDir, TEXT("IKRig_c3100"), TargetSkeletonHash);
+	}
+	if (!TargetRig)
+	{
+		UE_LOG(LogTemp, Error, TEXT("  Failed to create target IKRig"));
+		return 1;
+	}
 
-	// ─── Step 1: Import source enemy meshes (creates skeleton per enemy) ───
-	UE_LOG(LogTemp, Warning, TEXT("--- Step 1: Import source enemy meshes ---"));
-	TMap<FString, USkeletalMesh*> SourceMeshes;
-	TMap<FString, USkeleton*> SourceSkeletons;
+	// ─── Step 2: Per enemy: import (game thread) overlapping the previous enemy's retarget (worker) ───
+	const FString JsonPath = FString::Printf(TEXT("%s/ik_retarget_dump.json"), RawFbxDir);
+	FSLFRetargetDumpWriter Dump;
+	if (!Dump.Open(JsonPath, C3100RefSkel))
+	{
+		UE_LOG(LogTemp, Error, TEXT("  Cannot write %s, JSON dump disabled"), *JsonPath);
+	}
 
-	for (const TCHAR* ChrId : SourceEnemies)
+	TArray<TUniquePtr<FEnemyBatch>> Batches;
+	FEnemyBatch* InFlight = nullptr;
+	int32 NumRetargeted = 0;
+	int32 NumUpToDate = 0;
+
+	// Waits for the in-flight retarget, then commits and dumps it. Nothing else runs
+	// off the game thread afterwards, so this is also where garbage is collected.
+	auto FinishInFlight = [&]()
 	{
-		FString MeshFbx = FString::Printf(TEXT("%s/%s/%s_mesh.fbx"), RawFbxDir, ChrId, ChrId);
-		if (!FPaths::FileExists(MeshFbx))
+		if (!InFlight)
 		{
-			UE_LOG(LogTemp, Error, TEXT("  MISSING: %s"), *MeshFbx);
-			continue;
+			return;
 		}
 
-		FString PkgDir = FString::Printf(TEXT("%s/%s"), TempContentDir, ChrId);
-		FString AssetName = FString::Printf(TEXT("%s_mesh"), ChrId);
-
-		USkeletalMesh* Mesh = ImportMeshFBX(MeshFbx, PkgDir, AssetName);
-		if (Mesh)
 		{
-			SourceMeshes.Add(ChrId, Mesh);
-			SourceSkeletons.Add(ChrId, Mesh->GetSkeleton());
-			UE_LOG(LogTemp, Warning, TEXT("  %s: %d bones, skeleton=%s"),
-				ChrId, Mesh->GetRefSkeleton().GetRawBoneNum(),
-				*Mesh->GetSkeleton()->GetName());
+			FStageTimer Timer(StageSeconds[(int32)EStage::RetargetWait]);
+			InFlight->RetargetTask.Wait();
 		}
-		else
+		StageSeconds[(int32)EStage::Retarget] += InFlight->RetargetSeconds;
+
+		CommitRetarget(*InFlight, C3100Mesh);
+
 		{
-			UE_LOG(LogTemp, Error, TEXT("  %s: mesh import FAILED"), ChrId);
+			FStageTimer Timer(StageSeconds[(int32)EStage::Dump]);
+			for (FEnemyBatch::FAnim& Anim : InFlight->Anims)
+			{
+				if (Anim.bRetargeted)
+				{
+					Dump.AddAnimation(Anim.SentinelName, Anim.PlayLength, Anim.NumKeys, Anim.PosKeys, Anim.RotKeys);
+					if (Anim.bUpToDate)
+					{
+						NumUpToDate++;
+					}
+					else
+					{
+						NumRetargeted++;
+					}
+				}
+				Anim.PosKeys.Empty();
+				Anim.RotKeys.Empty();
+				Anim.ScaleKeys.Empty();
+			}
 		}
-	}
 
-	// ─── Step 2: Import source animations (onto source skeletons) ───
-	UE_LOG(LogTemp, Warning, TEXT("--- Step 2: Import source animations ---"));
-	TMap<FString, UAnimSequence*> SourceAnims;  // Key: SentinelName
+		SaveState();
+		InFlight->Processor.Reset();
+		InFlight = nullptr;
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	};
 
-	for (const auto& AD : AnimDefs)
+	for (const TCHAR* ChrId : SourceEnemies)
 	{
-		FString ChrId = AD.ChrId;
-		FString SentinelName = AD.SentinelName;
+		FEnemyBatch& Batch = *Batches.Add_GetRef(MakeUnique<FEnemyBatch>());
+		Batch.ChrId = ChrId;
+		for (const auto& AD : AnimDefs)
+		{
+			if (FCString::Strcmp(AD.ChrId, ChrId) == 0)
+			{
+				Batch.Anims.AddDefaulted_GetRef().SentinelName = AD.SentinelName;
+			}
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("--- Step 2: Import %s (%d animations) ---"), ChrId, Batch.Anims.Num());
+		const bool bImported = ImportEnemy(Batch, FbxHashes);
+
+		FinishInFlight();
 
-		USkeleton** SkelPtr = SourceSkeletons.Find(ChrId);
-		if (!SkelPtr || !*SkelPtr)
+		if (!bImported)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("  SKIP %s: no skeleton for %s"), *SentinelName, *ChrId);
 			continue;
 		}
 
-		FString AnimFbx = FString::Printf(TEXT("%s/%s/%s.fbx"), RawFbxDir, *ChrId, *SentinelName);
-		if (!FPaths::FileExists(AnimFbx))
+		UE_LOG(LogTemp, Warning, TEXT("--- Step 3: IK Retarget %s -> c3100 ---"), ChrId);
+		if (!PrepareRetarget(Batch, C3100Mesh, TargetRig, TargetSkeletonHash))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("  SKIP %s: FBX not found at %s"), *SentinelName, *AnimFbx);
 			continue;
 		}
 
-		FString PkgDir = FString::Printf(TEXT("%s/%s/Anims"), TempContentDir, *ChrId);
-		UAnimSequence* Anim = ImportAnimFBX(AnimFbx, PkgDir, SentinelName, *SkelPtr);
-		if (Anim)
+		Batch.RetargetTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [&Batch, &C3100RefSkel]()
 		{
-			SourceAnims.Add(SentinelName, Anim);
-			UE_LOG(LogTemp, Warning, TEXT("  %s: %.2fs, %d keys"),
-				*SentinelName, Anim->GetPlayLength(), Anim->GetNumberOfSampledKeys());
+			RunRetarget(Batch, C3100RefSkel);
+		});
+		InFlight = &Batch;
+
+		if (bSequential)
+		{
+			FinishInFlight();
 		}
-		else
+	}
+	FinishInFlight();
+
+	// ─── Step 4: Close the JSON dump ───
+	{
+		FStageTimer Timer(StageSeconds[(int32)EStage::Dump]);
+		if (Dump.IsOpen())
 		{
-			UE_LOG(LogTemp, Error, TEXT("  %s: anim import FAILED"), *SentinelName);
+			const int32 NumDumped = Dump.Num();
+			if (Dump.Close())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("  JSON dumped: %s (%d anims, %d bones)"),
+					*JsonPath, NumDumped, C3100RefSkel.GetRawBoneNum());
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("  JSON dump write failed: %s"), *JsonPath);
+			}
 		}
 	}
 
-	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	UE_LOG(LogTemp, Warning, TEXT("=== IKRetargetMultiSource COMPLETE ==="));
+	UE_LOG(LogTemp, Warning, TEXT("  Retargeted: %d animations (%d up to date)"), NumRetargeted + NumUpToDate, NumUpToDate);
+	UE_LOG(LogTemp, Warning, TEXT("  JSON: %s"), *JsonPath);
+	LogStageTimings(FPlatformTime::Seconds() - StartTime);
 
-	// ─── Step 3: Create IKRig for target (c3100) ───
-	UE_LOG(LogTemp, Warning, TEXT("--- Step 3: Create IKRig for c3100 (target) ---"));
-	FString TargetRigDir = FString::Printf(TEXT("%s/IKRigs"), TempContentDir);
-	UIKRigDefinition* TargetRig = CreateIKRigForERSkeleton(C3100Mesh, TargetRigDir, TEXT("IKRig_c3100"));
-	if (!TargetRig)
+	return 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// PIPELINE STAGES
+// ═══════════════════════════════════════════════════════════════════════════════
+
+bool UIKRetargetMultiSourceCommandlet::ImportEnemy(FEnemyBatch& Batch, const TMap<FString, uint64>& FbxHashes)
+{
+	const FString& ChrId = Batch.ChrId;
+	const FString MeshFbx = FString::Printf(TEXT("%s/%s/%s_mesh.fbx"), RawFbxDir, *ChrId, *ChrId);
+	if (!FPaths::FileExists(MeshFbx))
 	{
-		UE_LOG(LogTemp, Error, TEXT("  Failed to create target IKRig"));
-		return 1;
+		UE_LOG(LogTemp, Error, TEXT("  MISSING: %s"), *MeshFbx);
+		return false;
 	}
 
-	// ─── Step 4: For each source enemy, create IKRig + IKRetargeter + retarget via FIKRetargetProcessor ───
-	TArray<UAnimSequence*> AllRetargetedAnims;
-	TArray<FString> AllRetargetedNames;
+	// ─── Mesh (creates the enemy's skeleton) ───
+	{
+		FStageTimer Timer(StageSeconds[(int32)EStage::ImportMesh]);
 
-	const FReferenceSkeleton& C3100RefSkel = C3100Mesh->GetRefSkeleton();
-	const int32 NumTgtBones = C3100RefSkel.GetRawBoneNum();
+		const FString PkgDir = FString::Printf(TEXT("%s/%s"), TempContentDir, *ChrId);
+		const FString AssetName = FString::Printf(TEXT("%s_mesh"), *ChrId);
+		const FString PkgName = PkgDir / AssetName;
+		Batch.MeshKey = CombineKeys({ FbxHashes.FindRef(MeshFbx), ImportSettingsVersion });
 
-	for (const TCHAR* ChrId : SourceEnemies)
+		if (IsOutputCurrent(PkgName, Batch.MeshKey))
+		{
+			Batch.Mesh = LoadObject<USkeletalMesh>(nullptr, *PkgName);
+		}
+		if (Batch.Mesh)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("  %s: mesh up to date"), *ChrId);
+		}
+		else
+		{
+			Batch.Mesh = ImportMeshFBX(MeshFbx, PkgDir, AssetName);
+			if (Batch.Mesh)
+			{
+				RecordOutput(PkgName, Batch.MeshKey);
+			}
+		}
+
+		if (!Batch.Mesh || !Batch.Mesh->GetSkeleton())
+		{
+			UE_LOG(LogTemp, Error, TEXT("  %s: mesh import FAILED"), *ChrId);
+			return false;
+		}
+		UE_LOG(LogTemp, Warning, TEXT("  %s: %d bones, skeleton=%s"),
+			*ChrId, Batch.Mesh->GetRefSkeleton().GetRawBoneNum(),
+			*Batch.Mesh->GetSkeleton()->GetName());
+	}
+
+	// ─── Source animations (onto the enemy's skeleton) ───
+	FStageTimer Timer(StageSeconds[(int32)EStage::ImportAnim]);
+	const FString PkgDir = FString::Printf(TEXT("%s/%s/Anims"), TempContentDir, *ChrId);
+
+	for (FEnemyBatch::FAnim& Anim : Batch.Anims)
 	{
-		USkeletalMesh** MeshPtr = SourceMeshes.Find(ChrId);
-		if (!MeshPtr || !*MeshPtr)
+		const FString AnimFbx = FString::Printf(TEXT("%s/%s/%s.fbx"), RawFbxDir, *ChrId, *Anim.SentinelName);
+		if (!FPaths::FileExists(AnimFbx))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("  SKIP %s: no mesh imported"), ChrId);
+			UE_LOG(LogTemp, Warning, TEXT("  SKIP %s: FBX not found at %s"), *Anim.SentinelName, *AnimFbx);
 			continue;
 		}
 
-		UE_LOG(LogTemp, Warning, TEXT("--- Step 4: IK Retarget %s -> c3100 ---"), ChrId);
+		const FString PkgName = PkgDir / Anim.SentinelName;
+		Anim.SourceKey = CombineKeys({ FbxHashes.FindRef(AnimFbx), Batch.MeshKey });
+
+		if (IsOutputCurrent(PkgName, Anim.SourceKey))
+		{
+			Anim.Source = LoadObject<UAnimSequence>(nullptr, *PkgName);
+		}
+		if (!Anim.Source)
+		{
+			Anim.Source = ImportAnimFBX(AnimFbx, PkgDir, Anim.SentinelName, Batch.Mesh->GetSkeleton());
+			if (Anim.Source)
+			{
+				RecordOutput(PkgName, Anim.SourceKey);
+			}
+		}
+
+		if (Anim.Source)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("  %s: %.2fs, %d keys"),
+				*Anim.SentinelName, Anim.Source->GetPlayLength(), Anim.Source->GetNumberOfSampledKeys());
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("  %s: anim import FAILED"), *Anim.SentinelName);
+		}
+	}
 
-		// Create source IKRig
-		FString SourceRigName = FString::Printf(TEXT("IKRig_%s"), ChrId);
-		UIKRigDefinition* SourceRig = CreateIKRigForERSkeleton(*MeshPtr, TargetRigDir, SourceRigName);
+	SaveState();
+	return true;
+}
+
+bool UIKRetargetMultiSourceCommandlet::PrepareRetarget(
+	FEnemyBatch& Batch, USkeletalMesh* TargetMesh, UIKRigDefinition* TargetRig, uint64 TargetSkeletonHash)
+{
+	const FString& ChrId = Batch.ChrId;
+	const FReferenceSkeleton& SrcRefSkel = Batch.Mesh->GetRefSkeleton();
+	const FReferenceSkeleton& TgtRefSkel = TargetMesh->GetRefSkeleton();
+	const int32 NumSrcBones = SrcRefSkel.GetRawBoneNum();
+	const int32 NumTgtBones = TgtRefSkel.GetRawBoneNum();
+	const FString RigDir = FString::Printf(TEXT("%s/IKRigs"), TempContentDir);
+	uint64 RetargeterKey = 0;
+
+	// ─── Rig, retargeter and processor ───
+	{
+		FStageTimer Timer(StageSeconds[(int32)EStage::RigSetup]);
+
+		const uint64 SourceSkeletonHash = HashSkeleton(SrcRefSkel);
+		UIKRigDefinition* SourceRig = FindOrCreateIKRig(
+			Batch.Mesh, RigDir, FString::Printf(TEXT("IKRig_%s"), *ChrId), SourceSkeletonHash);
 		if (!SourceRig)
 		{
-			UE_LOG(LogTemp, Error, TEXT("  Failed to create source IKRig for %s"), ChrId);
-			continue;
+			UE_LOG(LogTemp, Error, TEXT("  Failed to create source IKRig for %s"), *ChrId);
+			return false;
 		}
 
-		// Create IKRetargeter
-		FString RetargeterName = FString::Printf(TEXT("RTG_%s_to_c3100"), ChrId);
-		UIKRetargeter* Retargeter = CreateRetargeter(
-			SourceRig, TargetRig, *MeshPtr, C3100Mesh, TargetRigDir, RetargeterName);
+		RetargeterKey = CombineKeys({ SourceSkeletonHash, TargetSkeletonHash, RigDefinitionVersion });
+		UIKRetargeter* Retargeter = FindOrCreateRetargeter(SourceRig, TargetRig, Batch.Mesh, TargetMesh,
+			RigDir, FString::Printf(TEXT("RTG_%s_to_c3100"), *ChrId), RetargeterKey);
 		if (!Retargeter)
 		{
-			UE_LOG(LogTemp, Error, TEXT("  Failed to create retargeter for %s"), ChrId);
-			continue;
+			UE_LOG(LogTemp, Error, TEXT("  Failed to create retargeter for %s"), *ChrId);
+			return false;
 		}
 
 		// Initialize the processor (no UI dependency!)
-		FIKRetargetProcessor Processor;
-		FRetargetProfile Profile;
-		Processor.Initialize(*MeshPtr, C3100Mesh, Retargeter, Profile, true);
+		Batch.Processor = MakeUnique<FIKRetargetProcessor>();
+		Batch.Processor->Initialize(Batch.Mesh, TargetMesh, Retargeter, Batch.Profile, true);
+		if (!Batch.Processor->IsInitialized())
+		{
+			UE_LOG(LogTemp, Error, TEXT("  FIKRetargetProcessor failed to initialize for %s"), *ChrId);
+			Batch.Processor.Reset();
+			return false;
+		}
+		UE_LOG(LogTemp, Warning, TEXT("  Processor initialized for %s"), *ChrId);
+	}
 
-		if (!Processor.IsInitialized())
+	// ─── Source poses (UObject reads stay on the game thread) ───
+	FStageTimer Timer(StageSeconds[(int32)EStage::Sample]);
+
+	for (FEnemyBatch::FAnim& Anim : Batch.Anims)
+	{
+		if (!Anim.Source)
 		{
-			UE_LOG(LogTemp, Error, TEXT("  FIKRetargetProcessor failed to initialize for %s"), ChrId);
 			continue;
 		}
-		UE_LOG(LogTemp, Warning, TEXT("  Processor initialized for %s"), ChrId);
 
-		// Source skeleton info
-		const FReferenceSkeleton& SrcRefSkel = (*MeshPtr)->GetRefSkeleton();
-		const int32 NumSrcBones = SrcRefSkel.GetRawBoneNum();
+		const FString OutPkgName = FString::Printf(TEXT("%s/Retargeted/%s"), TempContentDir, *Anim.SentinelName);
+		Anim.OutputKey = CombineKeys({ Anim.SourceKey, RetargeterKey });
 
-		// Build source ref CS poses for extracting global poses from local anim data
-		TArray<FTransform> SrcRefLocal, SrcRefCS;
-		SrcRefLocal.SetNum(NumSrcBones);
-		SrcRefCS.SetNum(NumSrcBones);
-		for (int32 i = 0; i < NumSrcBones; i++)
+		// Up to date: read the stored keys back for the dump instead of retargeting again
+		if (IsOutputCurrent(OutPkgName, Anim.OutputKey))
 		{
-			SrcRefLocal[i] = SrcRefSkel.GetRefBonePose()[i];
-			int32 ParIdx = SrcRefSkel.GetParentIndex(i);
-			if (ParIdx == INDEX_NONE)
+			if (UAnimSequence* Existing = LoadObject<UAnimSequence>(nullptr, *OutPkgName))
 			{
-				SrcRefCS[i] = SrcRefLocal[i];
-			}
-			else
-			{
-				FTransform Chained;
-				FTransform::Multiply(&Chained, &SrcRefLocal[i], &SrcRefCS[ParIdx]);
-				SrcRefCS[i] = Chained;
+				const IAnimationDataModel* Model = Existing->GetDataModel();
+				Anim.PlayLength = Model->GetPlayLength();
+				Anim.NumKeys = Model->GetNumberOfKeys();
+				Anim.PosKeys.SetNum(NumTgtBones);
+				Anim.RotKeys.SetNum(NumTgtBones);
+				for (int32 b = 0; b < NumTgtBones; b++)
+				{
+					TArray<FTransform> Transforms;
+					Model->GetBoneTrackTransforms(TgtRefSkel.GetBoneName(b), Transforms);
+					if (Transforms.Num() != Anim.NumKeys)
+					{
+						Transforms.Init(TgtRefSkel.GetRefBonePose()[b], Anim.NumKeys);
+					}
+					for (FTransform& Transform : Transforms)
+					{
+						Anim.PosKeys[b].Add(Transform.GetTranslation());
+						Anim.RotKeys[b].Add(Transform.GetRotation());
+					}
+				}
+				Anim.bUpToDate = true;
+				Anim.bRetargeted = true;
+				UE_LOG(LogTemp, Warning, TEXT("    %s: up to date"), *Anim.SentinelName);
+				continue;
 			}
 		}
 
-		// Retarget each animation for this enemy
-		for (const auto& AD : AnimDefs)
-		{
-			if (FString(AD.ChrId) != FString(ChrId)) continue;
-			FString SentinelName = AD.SentinelName;
-			UAnimSequence** AnimPtr = SourceAnims.Find(SentinelName);
-			if (!AnimPtr || !*AnimPtr) continue;
-
-			UAnimSequence* SrcAnim = *AnimPtr;
-			const double PlayLen = SrcAnim->GetPlayLength();
-			const int32 NumKeys = SrcAnim->GetNumberOfSampledKeys();
-			const FFrameRate SrcFrameRate = SrcAnim->GetSamplingFrameRate();
-			const double FrameDuration = NumKeys > 1 ? PlayLen / (NumKeys - 1) : PlayLen;
-
-			UE_LOG(LogTemp, Warning, TEXT("    Retargeting %s (%.3fs, %d keys)"), *SentinelName, PlayLen, NumKeys);
-
-			// Create output AnimSequence on c3100 skeleton
-			FString OutPkgName = FString::Printf(TEXT("%s/Retargeted/%s"), TempContentDir, *SentinelName);
-			DeleteExistingAsset(OutPkgName);
-			UPackage* OutPkg = CreatePackage(*OutPkgName);
-			OutPkg->FullyLoad();
+		UAnimSequence* SrcAnim = Anim.Source;
+		Anim.PlayLength = SrcAnim->GetPlayLength();
+		Anim.NumKeys = SrcAnim->GetNumberOfSampledKeys();
+		Anim.FrameRate = SrcAnim->GetSamplingFrameRate();
+		const double FrameDuration = Anim.NumKeys > 1 ? Anim.PlayLength / (Anim.NumKeys - 1) : Anim.PlayLength;
 
-			UAnimSequence* OutAnim = NewObject<UAnimSequence>(OutPkg, *SentinelName, RF_Public | RF_Standalone);
-			OutAnim->SetSkeleton(C3100Skel);
+		UE_LOG(LogTemp, Warning, TEXT("    Retargeting %s (%.3fs, %d keys)"), *Anim.SentinelName, Anim.PlayLength, Anim.NumKeys);
 
-			IAnimationDataController& Controller = OutAnim->GetController();
-			Controller.OpenBracket(NSLOCTEXT("IKRt", "IKRt", "IK Retarget"));
-			Controller.InitializeModel();
-			Controller.SetFrameRate(SrcFrameRate);
-			Controller.SetNumberOfFrames(FFrameNumber(NumKeys > 0 ? NumKeys - 1 : 0));
-
-			for (int32 b = 0; b < NumTgtBones; b++)
-				Controller.AddBoneCurve(C3100RefSkel.GetBoneName(b));
-
-			// Per-bone key storage
-			TArray<TArray<FVector>> AllPosKeys;
-			TArray<TArray<FQuat>> AllRotKeys;
-			TArray<TArray<FVector>> AllScaleKeys;
-			AllPosKeys.SetNum(NumTgtBones);
-			AllRotKeys.SetNum(NumTgtBones);
-			AllScaleKeys.SetNum(NumTgtBones);
-
-			// Build target ref CS for local-from-global conversion
-			TArray<FTransform> TgtRefLocal, TgtRefCS;
-			TgtRefLocal.SetNum(NumTgtBones);
-			TgtRefCS.SetNum(NumTgtBones);
-			for (int32 i = 0; i < NumTgtBones; i++)
+		// Extract source local pose per key and build global
+		Anim.SourceGlobal.SetNum(Anim.NumKeys);
+		for (int32 KeyIdx = 0; KeyIdx < Anim.NumKeys; KeyIdx++)
+		{
+			const double Time = FMath::Min(KeyIdx * FrameDuration, Anim.PlayLength);
+			TArray<FTransform>& SrcGlobal = Anim.SourceGlobal[KeyIdx];
+			SrcGlobal.SetNum(NumSrcBones);
+			for (int32 i = 0; i < NumSrcBones; i++)
 			{
-				TgtRefLocal[i] = C3100RefSkel.GetRefBonePose()[i];
-				int32 ParIdx = C3100RefSkel.GetParentIndex(i);
+				FTransform Local;
+				SrcAnim->GetBoneTransform(Local, FSkeletonPoseBoneIndex(i), Time, false);
+				int32 ParIdx = SrcRefSkel.GetParentIndex(i);
 				if (ParIdx == INDEX_NONE)
 				{
-					TgtRefCS[i] = TgtRefLocal[i];
+					SrcGlobal[i] = Local;
 				}
 				else
 				{
 					FTransform Chained;
-					FTransform::Multiply(&Chained, &TgtRefLocal[i], &TgtRefCS[ParIdx]);
-					TgtRefCS[i] = Chained;
+					FTransform::Multiply(&Chained, &Local, &SrcGlobal[ParIdx]);
+					SrcGlobal[i] = Chained;
 				}
 			}
+		}
+	}
 
-			for (int32 KeyIdx = 0; KeyIdx < NumKeys; KeyIdx++)
-			{
-				double Time = FMath::Min(KeyIdx * FrameDuration, PlayLen);
+	return true;
+}
 
-				// Extract source local pose and build global
-				TArray<FTransform> SrcGlobal;
-				SrcGlobal.SetNum(NumSrcBones);
-				for (int32 i = 0; i < NumSrcBones; i++)
-				{
-					FTransform Local;
-					SrcAnim->GetBoneTransform(Local, FSkeletonPoseBoneIndex(i), Time, false);
-					int32 ParIdx = SrcRefSkel.GetParentIndex(i);
-					if (ParIdx == INDEX_NONE)
-					{
-						SrcGlobal[i] = Local;
-					}
-					else
-					{
-						FTransform Chained;
-						FTransform::Multiply(&Chained, &Local, &SrcGlobal[ParIdx]);
-						SrcGlobal[i] = Chained;
-					}
-				}
+void UIKRetargetMultiSourceCommandlet::RunRetarget(FEnemyBatch& Batch, const FReferenceSkeleton& TargetRefSkel)
+{
+	const double Start = FPlatformTime::Seconds();
+	const int32 NumTgtBones = TargetRefSkel.GetRawBoneNum();
 
-				// Run the IK Retargeter processor
-				TArray<FTransform>& TgtGlobal = Processor.RunRetargeter(SrcGlobal, Profile, 0.033f);
+	// Animations run back to back through one processor, in the same order as a sequential run
+	for (FEnemyBatch::FAnim& Anim : Batch.Anims)
+	{
+		if (Anim.bUpToDate || Anim.SourceGlobal.Num() == 0)
+		{
+			continue;
+		}
 
-				// Convert global to local for each target bone
-				for (int32 b = 0; b < NumTgtBones; b++)
+		Anim.PosKeys.SetNum(NumTgtBones);
+		Anim.RotKeys.SetNum(NumTgtBones);
+		Anim.ScaleKeys.SetNum(NumTgtBones);
+		for (int32 b = 0; b < NumTgtBones; b++)
+		{
+			Anim.PosKeys[b].Reserve(Anim.NumKeys);
+			Anim.RotKeys[b].Reserve(Anim.NumKeys);
+			Anim.ScaleKeys[b].Reserve(Anim.NumKeys);
+		}
+
+		for (const TArray<FTransform>& SrcGlobal : Anim.SourceGlobal)
+		{
+			// Run the IK Retargeter processor
+			TArray<FTransform>& TgtGlobal = Batch.Processor->RunRetargeter(SrcGlobal, Batch.Profile, 0.033f);
+
+			// Convert global to local for each target bone
+			for (int32 b = 0; b < NumTgtBones; b++)
+			{
+				int32 ParentIdx = TargetRefSkel.GetParentIndex(b);
+				FTransform Local;
+				if (ParentIdx == INDEX_NONE)
 				{
-					int32 ParentIdx = C3100RefSkel.GetParentIndex(b);
-					FTransform Local;
-					if (ParentIdx == INDEX_NONE)
-					{
-						Local = TgtGlobal[b];
-					}
-					else
-					{
-						FTransform ParentInv = TgtGlobal[ParentIdx].Inverse();
-						Local = TgtGlobal[b];
-						Local *= ParentInv;
-					}
-					AllPosKeys[b].Add(Local.GetTranslation());
-					AllRotKeys[b].Add(Local.GetRotation());
-					AllScaleKeys[b].Add(Local.GetScale3D());
+					Local = TgtGlobal[b];
 				}
+				else
+				{
+					FTransform ParentInv = TgtGlobal[ParentIdx].Inverse();
+					Local = TgtGlobal[b];
+					Local *= ParentInv;
+				}
+				Anim.PosKeys[b].Add(Local.GetTranslation());
+				Anim.RotKeys[b].Add(Local.GetRotation());
+				Anim.ScaleKeys[b].Add(Local.GetScale3D());
 			}
+		}
 
-			// Write keys to DataModel
-			for (int32 b = 0; b < NumTgtBones; b++)
-				Controller.SetBoneTrackKeys(C3100RefSkel.GetBoneName(b), AllPosKeys[b], AllRotKeys[b], AllScaleKeys[b]);
+		Anim.SourceGlobal.Empty();
+		Anim.bRetargeted = true;
+	}
 
-			Controller.NotifyPopulated();
-			Controller.CloseBracket();
+	Batch.RetargetSeconds = FPlatformTime::Seconds() - Start;
+}
 
-			// Compress and save
-			OutAnim->CacheDerivedDataForCurrentPlatform();
-			OutAnim->WaitOnExistingCompression(true);
-			FAssetCompilingManager::Get().FinishAllCompilation();
+void UIKRetargetMultiSourceCommandlet::CommitRetarget(FEnemyBatch& Batch, USkeletalMesh* TargetMesh)
+{
+	FStageTimer Timer(StageSeconds[(int32)EStage::Commit]);
 
-			SaveAsset(OutAnim, OutPkgName);
-			AllRetargetedAnims.Add(OutAnim);
-			AllRetargetedNames.Add(SentinelName);
+	USkeleton* TargetSkeleton = TargetMesh->GetSkeleton();
+	const FReferenceSkeleton& TgtRefSkel = TargetMesh->GetRefSkeleton();
+	const int32 NumTgtBones = TgtRefSkel.GetRawBoneNum();
 
-			UE_LOG(LogTemp, Warning, TEXT("      -> %s: OK (%d bones, %d keys)"),
-				*SentinelName, NumTgtBones, NumKeys);
+	TArray<TPair<FEnemyBatch::FAnim*, UAnimSequence*>> Written;
+	for (FEnemyBatch::FAnim& Anim : Batch.Anims)
+	{
+		if (!Anim.bRetargeted || Anim.bUpToDate)
+		{
+			continue;
 		}
+
+		// Create output AnimSequence on c3100 skeleton
+		const FString OutPkgName = FString::Printf(TEXT("%s/Retargeted/%s"), TempContentDir, *Anim.SentinelName);
+		DeleteExistingAsset(OutPkgName);
+		UPackage* OutPkg = CreatePackage(*OutPkgName);
+		OutPkg->FullyLoad();
+
+		UAnimSequence* OutAnim = NewObject<UAnimSequence>(OutPkg, *Anim.SentinelName, RF_Public | RF_Standalone);
+		OutAnim->SetSkeleton(TargetSkeleton);
+
+		IAnimationDataController& Controller = OutAnim->GetController();
+		Controller.OpenBracket(NSLOCTEXT("IKRt", "IKRt", "IK Retarget"));
+		Controller.InitializeModel();
+		Controller.SetFrameRate(Anim.FrameRate);
+		Controller.SetNumberOfFrames(FFrameNumber(Anim.NumKeys > 0 ? Anim.NumKeys - 1 : 0));
+
+		for (int32 b = 0; b < NumTgtBones; b++)
+			Controller.AddBoneCurve(TgtRefSkel.GetBoneName(b));
+
+		// Write keys to DataModel
+		for (int32 b = 0; b < NumTgtBones; b++)
+			Controller.SetBoneTrackKeys(TgtRefSkel.GetBoneName(b), Anim.PosKeys[b], Anim.RotKeys[b], Anim.ScaleKeys[b]);
+
+		Controller.NotifyPopulated();
+		Controller.CloseBracket();
+
+		OutAnim->CacheDerivedDataForCurrentPlatform();
+		Written.Emplace(&Anim, OutAnim);
 	}
 
-	// ─── Step 5: Dump retargeted animations to JSON for Blender visualization ───
-	UE_LOG(LogTemp, Warning, TEXT("--- Step 5: Dump retargeted anims to JSON ---"));
-	FString JsonPath = FString::Printf(TEXT("%s/ik_retarget_dump.json"), RawFbxDir);
-	DumpRetargetedAnimsToJSON(AllRetargetedAnims, AllRetargetedNames, JsonPath);
+	// Compress the enemy's animations together, then save
+	FAssetCompilingManager::Get().FinishAllCompilation();
 
-	UE_LOG(LogTemp, Warning, TEXT("=== IKRetargetMultiSource COMPLETE ==="));
-	UE_LOG(LogTemp, Warning, TEXT("  Retargeted: %d animations"), AllRetargetedAnims.Num());
-	UE_LOG(LogTemp, Warning, TEXT("  JSON: %s"), *JsonPath);
+	for (const TPair<FEnemyBatch::FAnim*, UAnimSequence*>& Entry : Written)
+	{
+		FEnemyBatch::FAnim& Anim = *Entry.Key;
+		UAnimSequence* OutAnim = Entry.Value;
+		OutAnim->WaitOnExistingCompression(true);
 
-	return 0;
+		const FString OutPkgName = OutAnim->GetOutermost()->GetName();
+		if (SaveAsset(OutAnim, OutPkgName))
+		{
+			RecordOutput(OutPkgName, Anim.OutputKey);
+			UE_LOG(LogTemp, Warning, TEXT("      -> %s: OK (%d bones, %d keys)"),
+				*Anim.SentinelName, NumTgtBones, Anim.NumKeys);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("      -> %s: save FAILED"), *Anim.SentinelName);
+		}
+	}
 }
 
 USkeletalMesh* UIKRetargetMultiSourceCommandlet::ImportMeshFBX(
@@ -599,119 +961,141 @@ UIKRetargeter* UIKRetargetMultiSourceCommandlet::CreateRetargeter(
 	return Retargeter;
 }
 
-void UIKRetargetMultiSourceCommandlet::DumpRetargetedAnimsToJSON(
-	const TArray<UAnimSequence*>& Anims,
-	const TArray<FString>& AnimNames,
-	const FString& JsonPath)
+// ═══════════════════════════════════════════════════════════════════════════════
+// CACHE + RESUME STATE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+UIKRigDefinition* UIKRetargetMultiSourceCommandlet::FindOrCreateIKRig(
+	USkeletalMesh* Mesh, const FString& PackageDir, const FString& Name, uint64 SkeletonHash)
 {
-	if (Anims.Num() == 0)
+	if (UIKRigDefinition** Cached = RigCache.Find(SkeletonHash))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("  No retargeted anims to dump"));
-		return;
+		UE_LOG(LogTemp, Warning, TEXT("  IKRig %s: reusing %s (same skeleton)"), *Name, *(*Cached)->GetName());
+		return *Cached;
 	}
 
-	// Get skeleton ref data from first anim
-	USkeleton* Skel = Anims[0]->GetSkeleton();
-	if (!Skel)
+	const FString PkgName = PackageDir / Name;
+	const uint64 Key = CombineKeys({ SkeletonHash, RigDefinitionVersion });
+	UIKRigDefinition* IKRig = nullptr;
+	if (IsOutputCurrent(PkgName, Key))
+	{
+		IKRig = LoadObject<UIKRigDefinition>(nullptr, *PkgName);
+	}
+	if (IKRig)
 	{
-		UE_LOG(LogTemp, Error, TEXT("  First retargeted anim has no skeleton"));
-		return;
+		UE_LOG(LogTemp, Warning, TEXT("  IKRig %s: up to date"), *Name);
+	}
+	else
+	{
+		IKRig = CreateIKRigForERSkeleton(Mesh, PackageDir, Name);
+		if (IKRig)
+		{
+			RecordOutput(PkgName, Key);
+		}
 	}
 
-	const FReferenceSkeleton& RefSkel = Skel->GetReferenceSkeleton();
-	const int32 NumBones = RefSkel.GetNum();
+	if (IKRig)
+	{
+		RigCache.Add(SkeletonHash, IKRig);
+	}
+	return IKRig;
+}
 
-	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+UIKRetargeter* UIKRetargetMultiSourceCommandlet::FindOrCreateRetargeter(
+	UIKRigDefinition* SourceRig, UIKRigDefinition* TargetRig,
+	USkeletalMesh* SourceMesh, USkeletalMesh* TargetMesh,
+	const FString& PackageDir, const FString& Name, uint64 Key)
+{
+	if (UIKRetargeter** Cached = RetargeterCache.Find(Key))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  Retargeter %s: reusing %s (same skeletons)"), *Name, *(*Cached)->GetName());
+		return *Cached;
+	}
 
-	// Write skeleton info
-	TArray<TSharedPtr<FJsonValue>> BonesArray;
-	for (int32 i = 0; i < NumBones; i++)
-	{
-		TSharedPtr<FJsonObject> BoneObj = MakeShared<FJsonObject>();
-		BoneObj->SetStringField(TEXT("name"), RefSkel.GetBoneName(i).ToString());
-		BoneObj->SetNumberField(TEXT("parent"), RefSkel.GetParentIndex(i));
-
-		const FTransform& RefLocal = RefSkel.GetRefBonePose()[i];
-		FVector P = RefLocal.GetTranslation();
-		FQuat R = RefLocal.GetRotation();
-		FVector S = RefLocal.GetScale3D();
-
-		TArray<TSharedPtr<FJsonValue>> PV, RV, SV;
-		PV.Add(MakeShared<FJsonValueNumber>(P.X));
-		PV.Add(MakeShared<FJsonValueNumber>(P.Y));
-		PV.Add(MakeShared<FJsonValueNumber>(P.Z));
-		RV.Add(MakeShared<FJsonValueNumber>(R.X));
-		RV.Add(MakeShared<FJsonValueNumber>(R.Y));
-		RV.Add(MakeShared<FJsonValueNumber>(R.Z));
-		RV.Add(MakeShared<FJsonValueNumber>(R.W));
-		SV.Add(MakeShared<FJsonValueNumber>(S.X));
-		SV.Add(MakeShared<FJsonValueNumber>(S.Y));
-		SV.Add(MakeShared<FJsonValueNumber>(S.Z));
-		BoneObj->SetArrayField(TEXT("pos"), PV);
-		BoneObj->SetArrayField(TEXT("rot"), RV);
-		BoneObj->SetArrayField(TEXT("scale"), SV);
-
-		BonesArray.Add(MakeShared<FJsonValueObject>(BoneObj));
-	}
-	Root->SetArrayField(TEXT("skeleton"), BonesArray);
-
-	// Write animations
-	TSharedPtr<FJsonObject> AnimsObj = MakeShared<FJsonObject>();
-	for (int32 ai = 0; ai < Anims.Num(); ai++)
-	{
-		UAnimSequence* Anim = Anims[ai];
-		FString Name = (ai < AnimNames.Num()) ? AnimNames[ai] : Anim->GetName();
-		const double PlayLen = Anim->GetPlayLength();
-		const int32 NumKeys = Anim->GetNumberOfSampledKeys();
-		const double FrameDuration = NumKeys > 1 ? PlayLen / (NumKeys - 1) : PlayLen;
-
-		TSharedPtr<FJsonObject> AnimObj = MakeShared<FJsonObject>();
-		AnimObj->SetNumberField(TEXT("duration"), PlayLen);
-		AnimObj->SetNumberField(TEXT("num_keys"), NumKeys);
-
-		// Sample ALL frames
-		TArray<TSharedPtr<FJsonValue>> FramesArray;
-		for (int32 ki = 0; ki < NumKeys; ki++)
-		{
-			double Time = FMath::Min(ki * FrameDuration, PlayLen);
-
-			TSharedPtr<FJsonObject> FrameObj = MakeShared<FJsonObject>();
-			FrameObj->SetNumberField(TEXT("frame"), ki);
-
-			TArray<TSharedPtr<FJsonValue>> BoneLocals;
-			for (int32 bi = 0; bi < NumBones; bi++)
-			{
-				FTransform BoneLocal;
-				Anim->GetBoneTransform(BoneLocal, FSkeletonPoseBoneIndex(bi), Time, false);
-
-				FVector P = BoneLocal.GetTranslation();
-				FQuat R = BoneLocal.GetRotation();
-				// Compact: [px, py, pz, rx, ry, rz, rw]
-				TArray<TSharedPtr<FJsonValue>> BV;
-				BV.Add(MakeShared<FJsonValueNumber>(P.X));
-				BV.Add(MakeShared<FJsonValueNumber>(P.Y));
-				BV.Add(MakeShared<FJsonValueNumber>(P.Z));
-				BV.Add(MakeShared<FJsonValueNumber>(R.X));
-				BV.Add(MakeShared<FJsonValueNumber>(R.Y));
-				BV.Add(MakeShared<FJsonValueNumber>(R.Z));
-				BV.Add(MakeShared<FJsonValueNumber>(R.W));
-				BoneLocals.Add(MakeShared<FJsonValueArray>(BV));
-			}
-			FrameObj->SetArrayField(TEXT("local"), BoneLocals);
-			FramesArray.Add(MakeShared<FJsonValueObject>(FrameObj));
+	const FString PkgName = PackageDir / Name;
+	UIKRetargeter* Retargeter = nullptr;
+	if (IsOutputCurrent(PkgName, Key))
+	{
+		Retargeter = LoadObject<UIKRetargeter>(nullptr, *PkgName);
+	}
+	if (Retargeter)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  Retargeter %s: up to date"), *Name);
+	}
+	else
+	{
+		Retargeter = CreateRetargeter(SourceRig, TargetRig, SourceMesh, TargetMesh, PackageDir, Name);
+		if (Retargeter)
+		{
+			RecordOutput(PkgName, Key);
 		}
-		AnimObj->SetArrayField(TEXT("frames"), FramesArray);
-		AnimsObj->SetObjectField(Name, AnimObj);
 	}
-	Root->SetObjectField(TEXT("animations"), AnimsObj);
 
-	// Write to file
+	if (Retargeter)
+	{
+		RetargeterCache.Add(Key, Retargeter);
+	}
+	return Retargeter;
+}
+
+bool UIKRetargetMultiSourceCommandlet::IsOutputCurrent(const FString& PackagePath, uint64 Key) const
+{
+	if (bForce)
+	{
+		return false;
+	}
+	const uint64* Recorded = OutputKeys.Find(PackagePath);
+	return Recorded && *Recorded == Key && FPackageName::DoesPackageExist(PackagePath);
+}
+
+void UIKRetargetMultiSourceCommandlet::RecordOutput(const FString& PackagePath, uint64 Key)
+{
+	OutputKeys.Add(PackagePath, Key);
+}
+
+void UIKRetargetMultiSourceCommandlet::SaveState() const
+{
+	TSharedPtr<FJsonObject> Outputs = MakeShared<FJsonObject>();
+	for (const TPair<FString, uint64>& Pair : OutputKeys)
+	{
+		Outputs->SetStringField(Pair.Key, HashToString(Pair.Value));
+	}
+
+	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("version"), StateVersion);
+	Root->SetObjectField(TEXT("outputs"), Outputs);
+
 	FString JsonStr;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonStr);
 	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
-	FFileHelper::SaveStringToFile(JsonStr, *JsonPath);
-	UE_LOG(LogTemp, Warning, TEXT("  JSON dumped: %s (%d anims, %d bones)"),
-		*JsonPath, Anims.Num(), NumBones);
+	if (!FFileHelper::SaveStringToFile(JsonStr, *StatePath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  Failed to save resume state %s"), *StatePath);
+	}
+}
+
+void UIKRetargetMultiSourceCommandlet::LogStageTimings(double WallSeconds) const
+{
+	static const TCHAR* StageNames[] = {
+		TEXT("Hash source FBX"),
+		TEXT("Load target"),
+		TEXT("Import meshes"),
+		TEXT("Import animations"),
+		TEXT("IK rigs + retargeters"),
+		TEXT("Sample source poses"),
+		TEXT("Retarget (worker)"),
+		TEXT("Retarget wait (game thread)"),
+		TEXT("Commit + compress + save"),
+		TEXT("JSON dump"),
+	};
+	static_assert(UE_ARRAY_COUNT(StageNames) == (int32)EStage::Num, "One name per stage");
+
+	UE_LOG(LogTemp, Warning, TEXT("--- Stage timings ---"));
+	for (int32 Stage = 0; Stage < (int32)EStage::Num; Stage++)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  %-28s %8.0f ms"), StageNames[Stage], StageSeconds[Stage] * 1000.0);
+	}
+	UE_LOG(LogTemp, Warning, TEXT("  %-28s %8.0f ms"), TEXT("Total (wall)"), WallSeconds * 1000.0);
 }
 
 bool UIKRetargetMultiSourceCommandlet::SaveAsset(UObject* Asset, const FString& PackagePath)
@@ -4,15 +4,26 @@
 #include "Commandlets/Commandlet.h"
 #include "IKRetargetMultiSourceCommandlet.generated.h"
 
+class UIKRigDefinition;
+class UIKRetargeter;
+struct FReferenceSkeleton;
+
 /**
  * Import multi-source enemy animations and retarget to c3100 via UE5 IK Retargeter.
  *
  * Usage:
- *   UnrealEditor-Cmd.exe SLFConversion.uproject -run=IKRetargetMultiSource -unattended -nosplash
+ *   UnrealEditor-Cmd.exe SLFConversion.uproject -run=IKRetargetMultiSource -unattended -nosplash [-force] [-sequential]
  *
  * Reads raw FBX from C:/scripts/elden_ring_tools/output/multisource_raw/<chr_id>/
  * Outputs retargeted AnimSequences to /Game/Temp/IKRetarget/<chr_id>/
- * Dumps JSON to C:/scripts/elden_ring_tools/output/multisource_raw/ik_retarget_dump.json
+ * Streams JSON to C:/scripts/elden_ring_tools/output/multisource_raw/ik_retarget_dump.json
+ *
+ * Enemies are pipelined: while one enemy's animations are retargeted on a worker
+ * task, the next enemy's FBX files are imported on the game thread. IK rigs and
+ * retargeters are cached by skeleton hash, and every output package is recorded in
+ * Saved/SLFImport/IKRetargetMultiSource.json with a key of its inputs, so an
+ * interrupted run resumes where it stopped. -force rebuilds everything,
+ * -sequential waits for each retarget before importing the next enemy.
  */
 UCLASS()
 class UIKRetargetMultiSourceCommandlet : public UCommandlet
@@ -45,14 +56,71 @@ private:
 		USkeletalMesh* SourceMesh, USkeletalMesh* TargetMesh,
 		const FString& PackageDir, const FString& Name);
 
-	void DumpRetargetedAnimsToJSON(
-		const TArray<UAnimSequence*>& Anims,
-		const TArray<FString>& AnimNames,
-		const FString& JsonPath);
+	// ═══════════════════════════════════════════════════════════════════
+	// PIPELINE STAGES
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** One source enemy in flight (defined in the .cpp) */
+	struct FEnemyBatch;
+
+	enum class EStage : uint8
+	{
+		HashSources,
+		LoadTarget,
+		ImportMesh,
+		ImportAnim,
+		RigSetup,
+		Sample,
+		Retarget,
+		RetargetWait,
+		Commit,
+		Dump,
+		Num
+	};
+
+	/** Game thread: import (or reload, when up to date) the enemy's mesh and source animations */
+	bool ImportEnemy(FEnemyBatch& Batch, const TMap<FString, uint64>& FbxHashes);
+
+	/** Game thread: cached rig + retargeter, processor init, source pose sampling */
+	bool PrepareRetarget(FEnemyBatch& Batch, USkeletalMesh* TargetMesh, UIKRigDefinition* TargetRig, uint64 TargetSkeletonHash);
+
+	/** Any thread: run the retarget processor over the sampled source poses */
+	static void RunRetarget(FEnemyBatch& Batch, const FReferenceSkeleton& TargetRefSkel);
+
+	/** Game thread: write, compress and save the retargeted animations */
+	void CommitRetarget(FEnemyBatch& Batch, USkeletalMesh* TargetMesh);
+
+	/** IK rig for Mesh, reused when one was built for the same skeleton hash */
+	UIKRigDefinition* FindOrCreateIKRig(USkeletalMesh* Mesh, const FString& PackageDir, const FString& Name, uint64 SkeletonHash);
+
+	/** Retargeter for a source/target rig pair, reused for the same pair of skeleton hashes */
+	UIKRetargeter* FindOrCreateRetargeter(
+		UIKRigDefinition* SourceRig, UIKRigDefinition* TargetRig,
+		USkeletalMesh* SourceMesh, USkeletalMesh* TargetMesh,
+		const FString& PackageDir, const FString& Name, uint64 Key);
+
+	/** True when PackagePath was last built from Key and still exists (always false with -force) */
+	bool IsOutputCurrent(const FString& PackagePath, uint64 Key) const;
+	void RecordOutput(const FString& PackagePath, uint64 Key);
+	void SaveState() const;
+
+	void LogStageTimings(double WallSeconds) const;
 
 	bool SaveAsset(UObject* Asset, const FString& PackagePath);
 	void DeleteExistingAsset(const FString& PackagePath);
 
+	/** Package path -> key of the inputs it was built from (resume state) */
+	TMap<FString, uint64> OutputKeys;
+	FString StatePath;
+	bool bForce = false;
+
+	/** Skeleton hash -> rig, skeleton hash pair -> retargeter (this run) */
+	TMap<uint64, UIKRigDefinition*> RigCache;
+	TMap<uint64, UIKRetargeter*> RetargeterCache;
+
+	double StageSeconds[(int32)EStage::Num] = {};
+
+	static constexpr int32 StateVersion = 1;
 	static constexpr const TCHAR* RawFbxDir = TEXT("C:/scripts/elden_ring_tools/output/multisource_raw");
 	static constexpr const TCHAR* TempContentDir = TEXT("/Game/Temp/IKRetarget");
 	static constexpr const TCHAR* C3100MeshPath = TEXT("/Game/EldenRingAnimations/c3100_guard/c3100_mesh");
@@ -0,0 +1,142 @@
+// SLFHeightField.cpp
+
+#include "OpenWorld/SLFHeightField.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Points per ParallelFor task; smaller batches run inline */
+	constexpr int32 PointsPerTask = 4096;
+}
+
+void FSLFHeightField::Initialize(TArray<uint16>&& InHeights, int32 InSizeX, int32 InSizeY, const FVector& InOrigin, const FVector& InScale)
+{
+	if (InSizeX <= 0 || InSizeY <= 0 || InHeights.Num() != InSizeX * InSizeY)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[HeightField] Ignoring %d samples for a %dx%d map"), InHeights.Num(), InSizeX, InSizeY);
+		Reset();
+		return;
+	}
+
+	Heights = MoveTemp(InHeights);
+	SizeX = InSizeX;
+	SizeY = InSizeY;
+	Origin = InOrigin;
+	Scale = FVector(FMath::Max(InScale.X, UE_KINDA_SMALL_NUMBER), FMath::Max(InScale.Y, UE_KINDA_SMALL_NUMBER), InScale.Z);
+}
+
+void FSLFHeightField::InitializeFlat(const FVector2D& Min, const FVector2D& Max, float Z)
+{
+	TArray<uint16> Flat;
+	Flat.Init((uint16)MidHeight, 4);
+	Initialize(MoveTemp(Flat), 2, 2, FVector(Min.X, Min.Y, Z), FVector(Max.X - Min.X, Max.Y - Min.Y, 100.0f));
+}
+
+void FSLFHeightField::Reset()
+{
+	Heights.Empty();
+	SizeX = 0;
+	SizeY = 0;
+}
+
+uint16 FSLFHeightField::GetSample(int32 X, int32 Y) const
+{
+	X = FMath::Clamp(X, 0, SizeX - 1);
+	Y = FMath::Clamp(Y, 0, SizeY - 1);
+	return Heights[Y * SizeX + X];
+}
+
+void FSLFHeightField::ToCell(double X, double Y, int32& OutX0, int32& OutY0, float& OutFracX, float& OutFracY) const
+{
+	const double MapX = FMath::Clamp((X - Origin.X) / Scale.X, 0.0, (double)(SizeX - 1));
+	const double MapY = FMath::Clamp((Y - Origin.Y) / Scale.Y, 0.0, (double)(SizeY - 1));
+
+	// Last row / column uses the cell before it with fraction 1
+	OutX0 = FMath::Min((int32)MapX, FMath::Max(SizeX - 2, 0));
+	OutY0 = FMath::Min((int32)MapY, FMath::Max(SizeY - 2, 0));
+	OutFracX = (float)(MapX - OutX0);
+	OutFracY = (float)(MapY - OutY0);
+}
+
+float FSLFHeightField::GetHeightAndNormal(double X, double Y, FVector& OutNormal) const
+{
+	if (!IsValid())
+	{
+		OutNormal = FVector::UpVector;
+		return (float)Origin.Z;
+	}
+
+	int32 X0, Y0;
+	float FX, FY;
+	ToCell(X, Y, X0, Y0, FX, FY);
+
+	const float H00 = GetSample(X0, Y0);
+	const float H10 = GetSample(X0 + 1, Y0);
+	const float H01 = GetSample(X0, Y0 + 1);
+	const float H11 = GetSample(X0 + 1, Y0 + 1);
+
+	const float Top = FMath::Lerp(H00, H10, FX);
+	const float Bottom = FMath::Lerp(H01, H11, FX);
+	const float Sample = FMath::Lerp(Top, Bottom, FY);
+
+	// d(height)/d(world) along each axis; degenerate 1-wide maps have no slope on that axis
+	const float ZPerSample = HeightStep * (float)Scale.Z;
+	const float DX = SizeX > 1 ? FMath::Lerp(H10 - H00, H11 - H01, FY) * ZPerSample / (float)Scale.X : 0.0f;
+	const float DY = SizeY > 1 ? (Bottom - Top) * ZPerSample / (float)Scale.Y : 0.0f;
+	OutNormal = FVector(-DX, -DY, 1.0f).GetSafeNormal();
+
+	return ToWorldZ(Sample);
+}
+
+float FSLFHeightField::GetHeight(double X, double Y) const
+{
+	if (!IsValid())
+	{
+		return (float)Origin.Z;
+	}
+
+	int32 X0, Y0;
+	float FX, FY;
+	ToCell(X, Y, X0, Y0, FX, FY);
+
+	const float Top = FMath::Lerp((float)GetSample(X0, Y0), (float)GetSample(X0 + 1, Y0), FX);
+	const float Bottom = FMath::Lerp((float)GetSample(X0, Y0 + 1), (float)GetSample(X0 + 1, Y0 + 1), FX);
+	return ToWorldZ(FMath::Lerp(Top, Bottom, FY));
+}
+
+FVector FSLFHeightField::GetNormal(double X, double Y) const
+{
+	FVector Normal;
+	GetHeightAndNormal(X, Y, Normal);
+	return Normal;
+}
+
+void FSLFHeightField::GetHeights(TConstArrayView<FVector2D> Points, TArrayView<float> OutHeights) const
+{
+	check(OutHeights.Num() == Points.Num());
+
+	const int32 NumTasks = FMath::DivideAndRoundUp(Points.Num(), PointsPerTask);
+	ParallelFor(NumTasks, [&](int32 Task)
+	{
+		const int32 End = FMath::Min((Task + 1) * PointsPerTask, Points.Num());
+		for (int32 Index = Task * PointsPerTask; Index < End; ++Index)
+		{
+			OutHeights[Index] = GetHeight(Points[Index].X, Points[Index].Y);
+		}
+	}, NumTasks < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void FSLFHeightField::GetHeightsAndNormals(TConstArrayView<FVector2D> Points, TArrayView<float> OutHeights, TArrayView<FVector> OutNormals) const
+{
+	check(OutHeights.Num() == Points.Num() && OutNormals.Num() == Points.Num());
+
+	const int32 NumTasks = FMath::DivideAndRoundUp(Points.Num(), PointsPerTask);
+	ParallelFor(NumTasks, [&](int32 Task)
+	{
+		const int32 End = FMath::Min((Task + 1) * PointsPerTask, Points.Num());
+		for (int32 Index = Task * PointsPerTask; Index < End; ++Index)
+		{
+			OutHeights[Index] = GetHeightAndNormal(Points[Index].X, Points[Index].Y, OutNormals[Index]);
+		}
+	}, NumTasks < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
@@ -0,0 +1,61 @@
+// SLFHeightField.h
+// In-memory height field for procedural placement.
+//
+// Holds a uint16 heightmap in landscape convention (32768 = Origin.Z, 1/128 unit per step,
+// times Scale.Z) and answers world-space height / normal queries by bilinear
+// interpolation - no physics trace per instance. Points outside the map clamp to the edge.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class SLFCONVERSION_API FSLFHeightField
+{
+public:
+	static constexpr float MidHeight = 32768.0f;
+	static constexpr float HeightStep = 1.0f / 128.0f; // LANDSCAPE_ZSCALE
+
+	/**
+	 * Take ownership of a SizeX x SizeY heightmap (row-major, as GenerateHeightmap returns it).
+	 * Origin is the world position of sample (0,0); Scale.X/Y are cm between samples.
+	 */
+	void Initialize(TArray<uint16>&& InHeights, int32 InSizeX, int32 InSizeY, const FVector& InOrigin, const FVector& InScale);
+
+	/** Flat field over [Min, Max] at height Z (tile-grid terrain) */
+	void InitializeFlat(const FVector2D& Min, const FVector2D& Max, float Z);
+
+	void Reset();
+
+	bool IsValid() const { return SizeX > 0 && SizeY > 0; }
+	int32 GetSizeX() const { return SizeX; }
+	int32 GetSizeY() const { return SizeY; }
+
+	/** Raw sample, coordinates clamped to the map */
+	uint16 GetSample(int32 X, int32 Y) const;
+
+	/** World Z under world (X, Y); Origin.Z when the field is empty */
+	float GetHeight(double X, double Y) const;
+
+	/** Unit surface normal under world (X, Y) (gradient of the bilinear patch) */
+	FVector GetNormal(double X, double Y) const;
+
+	float GetHeightAndNormal(double X, double Y, FVector& OutNormal) const;
+
+	/** Batched heights (split across worker threads for large batches). OutHeights must match Points. */
+	void GetHeights(TConstArrayView<FVector2D> Points, TArrayView<float> OutHeights) const;
+
+	/** Batched heights and normals. Output views must match Points. */
+	void GetHeightsAndNormals(TConstArrayView<FVector2D> Points, TArrayView<float> OutHeights, TArrayView<FVector> OutNormals) const;
+
+private:
+	/** World XY -> cell (X0, Y0) and fraction within it, clamped to the map */
+	FORCEINLINE void ToCell(double X, double Y, int32& OutX0, int32& OutY0, float& OutFracX, float& OutFracY) const;
+
+	FORCEINLINE float ToWorldZ(float Sample) const { return (float)Origin.Z + (Sample - MidHeight) * HeightStep * (float)Scale.Z; }
+
+	TArray<uint16> Heights;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	FVector Origin = FVector::ZeroVector;
+	FVector Scale = FVector::OneVector;
+};
@@ -0,0 +1,222 @@
+// SLFHeightmapGenerator.cpp
+
+#include "OpenWorld/SLFHeightmapGenerator.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+	FORCEINLINE float EvaluateTerm(ESLFHeightTerm Term, float Value)
+	{
+		return Term == ESLFHeightTerm::Sin ? FMath::Sin(Value) : FMath::Cos(Value);
+	}
+
+	/** Rows per ParallelFor task (each task owns one row buffer) */
+	constexpr int32 RowsPerTask = 16;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// LAYERS
+// ═══════════════════════════════════════════════════════════════════════════════
+
+FSLFSeparableHeightLayer::FSLFSeparableHeightLayer(ESLFHeightTerm InTermX, float InFreqX, float InPhaseX,
+	ESLFHeightTerm InTermY, float InFreqY, float InPhaseY, float InAmplitude)
+	: TermX(InTermX), TermY(InTermY)
+	, FreqX(InFreqX), PhaseX(InPhaseX), FreqY(InFreqY), PhaseY(InPhaseY), Amplitude(InAmplitude)
+{
+}
+
+void FSLFSeparableHeightLayer::Prepare(int32 SizeX, int32 SizeY, int32 PaddedSizeX)
+{
+	ColumnTerms.SetNumUninitialized(PaddedSizeX);
+	for (int32 X = 0; X < PaddedSizeX; ++X)
+	{
+		ColumnTerms[X] = EvaluateTerm(TermX, (float)X * FreqX + PhaseX);
+	}
+
+	RowTerms.SetNumUninitialized(SizeY);
+	for (int32 Y = 0; Y < SizeY; ++Y)
+	{
+		RowTerms[Y] = EvaluateTerm(TermY, (float)Y * FreqY + PhaseY);
+	}
+}
+
+void FSLFSeparableHeightLayer::AccumulateRow(int32 Y, float* RESTRICT Row, int32 PaddedSizeX) const
+{
+	// (TermX * TermY) * Amplitude, multiply then add - no FMA, so rounding matches Evaluate
+	const VectorRegister4Float RowTerm = VectorSetFloat1(RowTerms[Y]);
+	const VectorRegister4Float Amp = VectorSetFloat1(Amplitude);
+	const float* RESTRICT Columns = ColumnTerms.GetData();
+
+	for (int32 X = 0; X < PaddedSizeX; X += 4)
+	{
+		const VectorRegister4Float Term = VectorMultiply(VectorMultiply(VectorLoad(Columns + X), RowTerm), Amp);
+		VectorStore(VectorAdd(VectorLoad(Row + X), Term), Row + X);
+	}
+}
+
+float FSLFSeparableHeightLayer::Evaluate(float FX, float FY) const
+{
+	return EvaluateTerm(TermX, FX * FreqX + PhaseX) * EvaluateTerm(TermY, FY * FreqY + PhaseY) * Amplitude;
+}
+
+FSLFRidgeHeightLayer::FSLFRidgeHeightLayer(float InFreq, float InAmplitude, float InGateFreq)
+	: Freq(InFreq), Amplitude(InAmplitude), GateFreq(InGateFreq)
+{
+}
+
+void FSLFRidgeHeightLayer::Prepare(int32 SizeX, int32 SizeY, int32 PaddedSizeX)
+{
+	// X + Y is exact in float for any map size we generate, so one table covers every diagonal
+	const int32 NumDiagonals = PaddedSizeX + SizeY - 1;
+	DiagonalTerms.SetNumUninitialized(NumDiagonals);
+	for (int32 Sum = 0; Sum < NumDiagonals; ++Sum)
+	{
+		DiagonalTerms[Sum] = FMath::Sin((float)Sum * Freq) * Amplitude;
+	}
+
+	RowGates.SetNumUninitialized(SizeY);
+	for (int32 Y = 0; Y < SizeY; ++Y)
+	{
+		RowGates[Y] = FMath::Max(0.0f, FMath::Sin((float)Y * GateFreq));
+	}
+}
+
+void FSLFRidgeHeightLayer::AccumulateRow(int32 Y, float* RESTRICT Row, int32 PaddedSizeX) const
+{
+	const float Gate = RowGates[Y];
+	if (Gate == 0.0f)
+	{
+		// Ridge * 0 adds +-0, which leaves every finite height unchanged
+		return;
+	}
+
+	const VectorRegister4Float GateV = VectorSetFloat1(Gate);
+	const float* RESTRICT Diagonal = DiagonalTerms.GetData() + Y;
+
+	for (int32 X = 0; X < PaddedSizeX; X += 4)
+	{
+		VectorStore(VectorAdd(VectorLoad(Row + X), VectorMultiply(VectorLoad(Diagonal + X), GateV)), Row + X);
+	}
+}
+
+float FSLFRidgeHeightLayer::Evaluate(float FX, float FY) const
+{
+	const float Ridge = FMath::Sin((FX + FY) * Freq) * Amplitude;
+	return Ridge * FMath::Max(0.0f, FMath::Sin(FY * GateFreq));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// GENERATOR
+// ═══════════════════════════════════════════════════════════════════════════════
+
+FSLFHeightmapGenerator& FSLFHeightmapGenerator::AddLayer(TUniquePtr<FSLFHeightmapLayer> Layer)
+{
+	if (Layer)
+	{
+		Layers.Add(MoveTemp(Layer));
+	}
+	return *this;
+}
+
+FSLFHeightmapGenerator FSLFHeightmapGenerator::MakeOpenWorldTerrain()
+{
+	FSLFHeightmapGenerator Generator;
+
+	// Layer 1: Base rolling hills (low frequency, high amplitude)
+	Generator.AddLayer(MakeUnique<FSLFSeparableHeightLayer>(ESLFHeightTerm::Sin, 0.002f, 0.0f, ESLFHeightTerm::Cos, 0.0025f, 0.0f, 8000.0f));
+
+	// Layer 2: Medium terrain features
+	Generator.AddLayer(MakeUnique<FSLFSeparableHeightLayer>(ESLFHeightTerm::Sin, 0.008f, 1.3f, ESLFHeightTerm::Sin, 0.006f, 0.7f, 2500.0f));
+
+	// Layer 3: Fine detail (small bumps)
+	Generator.AddLayer(MakeUnique<FSLFSeparableHeightLayer>(ESLFHeightTerm::Sin, 0.025f, 3.1f, ESLFHeightTerm::Cos, 0.03f, 2.2f, 800.0f));
+
+	// Layer 4: Asymmetric ridge running NW-SE
+	Generator.AddLayer(MakeUnique<FSLFRidgeHeightLayer>(0.003f, 3000.0f, 0.004f));
+
+	return Generator;
+}
+
+TArray<uint16> FSLFHeightmapGenerator::Generate(int32 SizeX, int32 SizeY)
+{
+	TArray<uint16> Heightmap;
+	if (SizeX <= 0 || SizeY <= 0)
+	{
+		return Heightmap;
+	}
+	Heightmap.SetNumUninitialized(SizeX * SizeY);
+
+	const int32 PaddedSizeX = Align(SizeX, 4);
+	for (const TUniquePtr<FSLFHeightmapLayer>& Layer : Layers)
+	{
+		Layer->Prepare(SizeX, SizeY, PaddedSizeX);
+	}
+
+	const VectorRegister4Float Base = VectorSetFloat1(BaseHeight);
+	const VectorRegister4Float MinHeight = VectorZeroFloat();
+	const VectorRegister4Float MaxHeight = VectorSetFloat1(65535.0f);
+	uint16* RESTRICT Out = Heightmap.GetData();
+
+	const int32 NumTasks = FMath::DivideAndRoundUp(SizeY, RowsPerTask);
+	ParallelFor(NumTasks, [&](int32 TaskIndex)
+	{
+		TArray<float, TAlignedHeapAllocator<16>> Row;
+		Row.SetNumUninitialized(PaddedSizeX);
+		alignas(16) int32 Clamped[4];
+
+		const int32 FirstRow = TaskIndex * RowsPerTask;
+		const int32 LastRow = FMath::Min(FirstRow + RowsPerTask, SizeY);
+		for (int32 Y = FirstRow; Y < LastRow; ++Y)
+		{
+			FMemory::Memzero(Row.GetData(), PaddedSizeX * sizeof(float));
+			for (const TUniquePtr<FSLFHeightmapLayer>& Layer : Layers)
+			{
+				Layer->AccumulateRow(Y, Row.GetData(), PaddedSizeX);
+			}
+
+			// Clamping in float before truncating equals Clamp((int32)H, 0, 65535) for every finite H
+			uint16* RESTRICT OutRow = Out + (int64)Y * SizeX;
+			for (int32 X = 0; X < PaddedSizeX; X += 4)
+			{
+				VectorRegister4Float Height = VectorAdd(Base, VectorLoadAligned(Row.GetData() + X));
+				Height = VectorMin(VectorMax(Height, MinHeight), MaxHeight);
+				VectorIntStoreAligned(VectorFloatToInt(Height), Clamped);
+
+				const int32 Count = FMath::Min(4, SizeX - X);
+				for (int32 Lane = 0; Lane < Count; ++Lane)
+				{
+					OutRow[X + Lane] = (uint16)Clamped[Lane];
+				}
+			}
+		}
+	});
+
+	return Heightmap;
+}
+
+TArray<uint16> FSLFHeightmapGenerator::GenerateReference(int32 SizeX, int32 SizeY) const
+{
+	TArray<uint16> Heightmap;
+	Heightmap.SetNum(FMath::Max(SizeX, 0) * FMath::Max(SizeY, 0));
+
+	for (int32 Y = 0; Y < SizeY; Y++)
+	{
+		for (int32 X = 0; X < SizeX; X++)
+		{
+			float FX = (float)X;
+			float FY = (float)Y;
+
+			float H = 0.0f;
+			for (const TUniquePtr<FSLFHeightmapLayer>& Layer : Layers)
+			{
+				H += Layer->Evaluate(FX, FY);
+			}
+
+			int32 HeightVal = FMath::Clamp((int32)(BaseHeight + H), 0, 65535);
+			Heightmap[Y * SizeX + X] = (uint16)HeightVal;
+		}
+	}
+
+	return Heightmap;
+}
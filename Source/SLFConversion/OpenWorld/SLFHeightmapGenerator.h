@@ -0,0 +1,94 @@
+// SLFHeightmapGenerator.h
+// Layered procedural heightmap for the open world commandlet.
+//
+// Every layer is evaluated from small per-row / per-column tables instead of per-pixel
+// trig: a separable layer is TermX(x) * TermY(y) * Amplitude, the ridge layer is a
+// function of (x + y) gated per row. Rows are split across ParallelFor and accumulated /
+// clamped with VectorRegister math in the same operation order as the scalar loop, so the
+// result is bit-identical to evaluating the layers pixel by pixel.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** One additive heightmap layer. Prepare builds lookup tables; AccumulateRow must be thread safe. */
+class SLFCONVERSION_API FSLFHeightmapLayer
+{
+public:
+	virtual ~FSLFHeightmapLayer() = default;
+
+	/** Build tables for a SizeX x SizeY map. PaddedSizeX is a multiple of 4 (tables may be read up to it). */
+	virtual void Prepare(int32 SizeX, int32 SizeY, int32 PaddedSizeX) = 0;
+
+	/** Row[X] += height(X, Y) for X in [0, PaddedSizeX) */
+	virtual void AccumulateRow(int32 Y, float* RESTRICT Row, int32 PaddedSizeX) const = 0;
+
+	/** Scalar height at one pixel (reference path, identical math) */
+	virtual float Evaluate(float FX, float FY) const = 0;
+};
+
+/** Sin or Cos term of a separable layer */
+enum class ESLFHeightTerm : uint8
+{
+	Sin,
+	Cos
+};
+
+/** H += TermX(FX * FreqX + PhaseX) * TermY(FY * FreqY + PhaseY) * Amplitude */
+class SLFCONVERSION_API FSLFSeparableHeightLayer : public FSLFHeightmapLayer
+{
+public:
+	FSLFSeparableHeightLayer(ESLFHeightTerm InTermX, float InFreqX, float InPhaseX,
+		ESLFHeightTerm InTermY, float InFreqY, float InPhaseY, float InAmplitude);
+
+	virtual void Prepare(int32 SizeX, int32 SizeY, int32 PaddedSizeX) override;
+	virtual void AccumulateRow(int32 Y, float* RESTRICT Row, int32 PaddedSizeX) const override;
+	virtual float Evaluate(float FX, float FY) const override;
+
+private:
+	ESLFHeightTerm TermX, TermY;
+	float FreqX, PhaseX, FreqY, PhaseY, Amplitude;
+
+	TArray<float> ColumnTerms;
+	TArray<float> RowTerms;
+};
+
+/** Diagonal ridge: H += Sin((FX + FY) * Freq) * Amplitude * Max(0, Sin(FY * GateFreq)) */
+class SLFCONVERSION_API FSLFRidgeHeightLayer : public FSLFHeightmapLayer
+{
+public:
+	FSLFRidgeHeightLayer(float InFreq, float InAmplitude, float InGateFreq);
+
+	virtual void Prepare(int32 SizeX, int32 SizeY, int32 PaddedSizeX) override;
+	virtual void AccumulateRow(int32 Y, float* RESTRICT Row, int32 PaddedSizeX) const override;
+	virtual float Evaluate(float FX, float FY) const override;
+
+private:
+	float Freq, Amplitude, GateFreq;
+
+	/** Ridge value indexed by X + Y */
+	TArray<float> DiagonalTerms;
+	TArray<float> RowGates;
+};
+
+class SLFCONVERSION_API FSLFHeightmapGenerator
+{
+public:
+	/** Height of a pixel with no layer contribution (uint16 sea level) */
+	float BaseHeight = 32768.0f;
+
+	FSLFHeightmapGenerator& AddLayer(TUniquePtr<FSLFHeightmapLayer> Layer);
+	int32 NumLayers() const { return Layers.Num(); }
+
+	/** The open world terrain: rolling hills, medium features, fine bumps, NW-SE ridge */
+	static FSLFHeightmapGenerator MakeOpenWorldTerrain();
+
+	/** Row-parallel, table-driven, SIMD accumulate / clamp */
+	TArray<uint16> Generate(int32 SizeX, int32 SizeY);
+
+	/** One pixel at a time, single threaded (reference for tests / benchmarks) */
+	TArray<uint16> GenerateReference(int32 SizeX, int32 SizeY) const;
+
+private:
+	TArray<TUniquePtr<FSLFHeightmapLayer>> Layers;
+};
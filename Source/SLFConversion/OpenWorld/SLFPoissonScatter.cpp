@@ -0,0 +1,232 @@
+// SLFPoissonScatter.cpp
+
+#include "OpenWorld/SLFPoissonScatter.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	/** Fresh seeds tried in a tile once its active list runs dry (fills pockets cut off by exclusions) */
+	constexpr int32 ReseedAttemptsPerTile = 30;
+
+	/** Shared background grid: one point per cell, cell size MinSpacing / sqrt(2) */
+	struct FScatterGrid
+	{
+		FVector2D Origin;
+		double CellSize = 0.0;
+		int32 CellsX = 0;
+		int32 CellsY = 0;
+		TArray<FVector2D> Points;
+		TArray<uint8> Occupied;
+
+		FORCEINLINE int32 CellX(double X) const { return FMath::Clamp((int32)((X - Origin.X) / CellSize), 0, CellsX - 1); }
+		FORCEINLINE int32 CellY(double Y) const { return FMath::Clamp((int32)((Y - Origin.Y) / CellSize), 0, CellsY - 1); }
+
+		/** Any point within MinSpacing? (5x5 neighbourhood covers MinSpacing = sqrt(2) cells) */
+		bool HasNeighbourWithin(const FVector2D& P, int32 CX, int32 CY, double MinSpacingSq) const
+		{
+			const int32 MinX = FMath::Max(CX - 2, 0);
+			const int32 MaxX = FMath::Min(CX + 2, CellsX - 1);
+			const int32 MinY = FMath::Max(CY - 2, 0);
+			const int32 MaxY = FMath::Min(CY + 2, CellsY - 1);
+
+			for (int32 Y = MinY; Y <= MaxY; ++Y)
+			{
+				const int32 Row = Y * CellsX;
+				for (int32 X = MinX; X <= MaxX; ++X)
+				{
+					if (Occupied[Row + X] && FVector2D::DistSquared(Points[Row + X], P) < MinSpacingSq)
+					{
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+	};
+
+	/** Cell range owned by one tile (half-open) */
+	struct FScatterTile
+	{
+		int32 CellMinX, CellMinY, CellMaxX, CellMaxY;
+		uint32 Seed;
+		TArray<FVector2D> Points;
+		int32 CandidatesTested = 0;
+	};
+
+	void SampleTile(FScatterTile& Tile, FScatterGrid& Grid, const FSLFPoissonScatterParams& Params)
+	{
+		const double MinSpacing = Params.MinSpacing;
+		const double MinSpacingSq = MinSpacing * MinSpacing;
+		const FVector2D TileMin = Grid.Origin + FVector2D(Tile.CellMinX, Tile.CellMinY) * Grid.CellSize;
+		const FVector2D TileMax(
+			FMath::Min(Grid.Origin.X + Tile.CellMaxX * Grid.CellSize, Params.RegionMax.X),
+			FMath::Min(Grid.Origin.Y + Tile.CellMaxY * Grid.CellSize, Params.RegionMax.Y));
+
+		FRandomStream Rng(Tile.Seed);
+		TArray<int32> Active;
+
+		// Accept into this tile's cells only - neighbours' cells are read, never written
+		auto TryAccept = [&](const FVector2D& P) -> bool
+		{
+			++Tile.CandidatesTested;
+			if (P.X < TileMin.X || P.Y < TileMin.Y || P.X >= TileMax.X || P.Y >= TileMax.Y)
+			{
+				return false;
+			}
+			if (FSLFPoissonScatter::IsExcluded(P, Params.Exclusions))
+			{
+				return false;
+			}
+
+			const int32 CX = Grid.CellX(P.X);
+			const int32 CY = Grid.CellY(P.Y);
+			if (Grid.HasNeighbourWithin(P, CX, CY, MinSpacingSq))
+			{
+				return false;
+			}
+
+			const int32 Cell = CY * Grid.CellsX + CX;
+			Grid.Points[Cell] = P;
+			Grid.Occupied[Cell] = 1;
+			Active.Add(Tile.Points.Add(P));
+			return true;
+		};
+
+		int32 ReseedsLeft = ReseedAttemptsPerTile;
+		while (ReseedsLeft > 0)
+		{
+			if (Active.Num() == 0)
+			{
+				--ReseedsLeft;
+				TryAccept(FVector2D(Rng.FRandRange(TileMin.X, TileMax.X), Rng.FRandRange(TileMin.Y, TileMax.Y)));
+				continue;
+			}
+
+			const int32 ActiveSlot = Rng.RandRange(0, Active.Num() - 1);
+			const FVector2D Origin = Tile.Points[Active[ActiveSlot]];
+
+			bool bFound = false;
+			for (int32 Candidate = 0; Candidate < Params.CandidatesPerPoint && !bFound; ++Candidate)
+			{
+				// Uniform angle, radius in [r, 2r)
+				const double Angle = Rng.FRandRange(0.0f, UE_TWO_PI);
+				const double Distance = MinSpacing * (1.0 + Rng.FRand());
+				bFound = TryAccept(Origin + FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Distance);
+			}
+
+			if (!bFound)
+			{
+				Active.RemoveAtSwap(ActiveSlot, 1, EAllowShrinking::No);
+			}
+		}
+	}
+}
+
+bool FSLFPoissonScatter::IsExcluded(const FVector2D& Point, TConstArrayView<FSLFScatterExclusion> Exclusions)
+{
+	for (const FSLFScatterExclusion& Exclusion : Exclusions)
+	{
+		if (FVector2D::DistSquared(Point, Exclusion.Center) < FMath::Square((double)Exclusion.Radius))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+TArray<FVector2D> FSLFPoissonScatter::Generate(const FSLFPoissonScatterParams& Params, FSLFPoissonScatterStats* OutStats)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<FVector2D> Result;
+
+	const FVector2D Extent = Params.RegionMax - Params.RegionMin;
+	if (Params.MinSpacing <= 0.0f || Extent.X <= 0.0 || Extent.Y <= 0.0 || Params.MaxPoints <= 0)
+	{
+		if (OutStats) *OutStats = FSLFPoissonScatterStats();
+		return Result;
+	}
+
+	FScatterGrid Grid;
+	Grid.Origin = Params.RegionMin;
+	Grid.CellSize = Params.MinSpacing / UE_DOUBLE_SQRT_2;
+	Grid.CellsX = FMath::Max(FMath::CeilToInt32(Extent.X / Grid.CellSize), 1);
+	Grid.CellsY = FMath::Max(FMath::CeilToInt32(Extent.Y / Grid.CellSize), 1);
+	Grid.Points.SetNumUninitialized(Grid.CellsX * Grid.CellsY);
+	Grid.Occupied.SetNumZeroed(Grid.CellsX * Grid.CellsY);
+
+	// Tiles are whole cells and at least 2 wide, so a candidate's 5x5 lookup never
+	// reaches past the adjacent tile - and adjacent tiles never share a pass
+	const int32 TileCells = Params.TileSize > 0.0f
+		? FMath::Max(FMath::CeilToInt32(Params.TileSize / Grid.CellSize), 2)
+		: FMath::Max(Grid.CellsX, Grid.CellsY);
+	const int32 TilesX = FMath::DivideAndRoundUp(Grid.CellsX, TileCells);
+	const int32 TilesY = FMath::DivideAndRoundUp(Grid.CellsY, TileCells);
+
+	TArray<FScatterTile> Tiles;
+	Tiles.Reserve(TilesX * TilesY);
+	for (int32 TY = 0; TY < TilesY; ++TY)
+	{
+		for (int32 TX = 0; TX < TilesX; ++TX)
+		{
+			FScatterTile& Tile = Tiles.AddDefaulted_GetRef();
+			Tile.CellMinX = TX * TileCells;
+			Tile.CellMinY = TY * TileCells;
+			Tile.CellMaxX = FMath::Min(Tile.CellMinX + TileCells, Grid.CellsX);
+			Tile.CellMaxY = FMath::Min(Tile.CellMinY + TileCells, Grid.CellsY);
+			Tile.Seed = HashCombineFast(Params.Seed, GetTypeHash(FIntPoint(TX, TY)));
+		}
+	}
+
+	// Four checkerboard passes (even/odd X by even/odd Y). Within a pass tiles are two
+	// apart, so they run in parallel; later passes see earlier passes' seam points.
+	for (int32 Pass = 0; Pass < 4; ++Pass)
+	{
+		TArray<int32> PassTiles;
+		for (int32 TY = Pass / 2; TY < TilesY; TY += 2)
+		{
+			for (int32 TX = Pass % 2; TX < TilesX; TX += 2)
+			{
+				PassTiles.Add(TY * TilesX + TX);
+			}
+		}
+
+		ParallelFor(PassTiles.Num(), [&](int32 Index)
+		{
+			SampleTile(Tiles[PassTiles[Index]], Grid, Params);
+		}, PassTiles.Num() < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+
+	int32 CandidatesTested = 0;
+	int32 Total = 0;
+	for (const FScatterTile& Tile : Tiles)
+	{
+		Total += Tile.Points.Num();
+	}
+	Result.Reserve(Total);
+	for (const FScatterTile& Tile : Tiles)
+	{
+		Result.Append(Tile.Points);
+		CandidatesTested += Tile.CandidatesTested;
+	}
+
+	// Keep a uniform subset rather than the first N, which would cluster around the first seeds
+	if (Result.Num() > Params.MaxPoints)
+	{
+		FRandomStream Rng(Params.Seed);
+		for (int32 Index = 0; Index < Params.MaxPoints; ++Index)
+		{
+			Result.Swap(Index, Rng.RandRange(Index, Result.Num() - 1));
+		}
+		Result.SetNum(Params.MaxPoints, EAllowShrinking::No);
+	}
+
+	if (OutStats)
+	{
+		OutStats->Generated = Total;
+		OutStats->CandidatesTested = CandidatesTested;
+		OutStats->Tiles = Tiles.Num();
+		OutStats->Seconds = FPlatformTime::Seconds() - StartTime;
+	}
+	return Result;
+}
@@ -0,0 +1,59 @@
+// SLFPoissonScatter.h
+// Poisson-disk scatter for open world dressing (Bridson's algorithm).
+//
+// A background grid with cell size MinSpacing / sqrt(2) holds at most one point per cell,
+// so each candidate is checked against a 5x5 cell neighbourhood instead of every placed
+// point. Large regions can be split into tiles that run in parallel: tiles are processed
+// in four checkerboard passes so tiles running at the same time never touch each other's
+// cells, and each tile sees the points its already-finished neighbours placed along the
+// seam. Output depends only on the params (seed, tile size), never on thread timing.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Circle no point may fall inside (flat gameplay areas, entrances) */
+struct FSLFScatterExclusion
+{
+	FVector2D Center = FVector2D::ZeroVector;
+	float Radius = 0.0f;
+};
+
+struct FSLFPoissonScatterParams
+{
+	FVector2D RegionMin = FVector2D::ZeroVector;
+	FVector2D RegionMax = FVector2D::ZeroVector;
+
+	/** No two points closer than this (2D) */
+	float MinSpacing = 500.0f;
+
+	/** Keep at most this many points, picked uniformly from the full Poisson set */
+	int32 MaxPoints = MAX_int32;
+
+	/** Bridson's k: candidates tried around each active point before it is retired */
+	int32 CandidatesPerPoint = 30;
+
+	uint32 Seed = 0;
+
+	TArray<FSLFScatterExclusion> Exclusions;
+
+	/** Tile edge for multithreaded sampling (0 = single tile). Rounded up to at least 2 grid cells. */
+	float TileSize = 0.0f;
+};
+
+struct FSLFPoissonScatterStats
+{
+	int32 Generated = 0;
+	int32 CandidatesTested = 0;
+	int32 Tiles = 0;
+	double Seconds = 0.0;
+};
+
+class SLFCONVERSION_API FSLFPoissonScatter
+{
+public:
+	/** Sample the region. Points are in tile order (or random order once trimmed to MaxPoints). */
+	static TArray<FVector2D> Generate(const FSLFPoissonScatterParams& Params, FSLFPoissonScatterStats* OutStats = nullptr);
+
+	static bool IsExcluded(const FVector2D& Point, TConstArrayView<FSLFScatterExclusion> Exclusions);
+};
@@ -0,0 +1,97 @@
+// SLFScatterBatch.cpp
+
+#include "OpenWorld/SLFScatterBatch.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+void FSLFScatterBatch::Add(UStaticMesh* Mesh, const FTransform& Transform, bool bMirrorBackface)
+{
+	if (!Mesh)
+	{
+		return;
+	}
+
+	int32& BatchIndex = BatchIndexByMesh.FindOrAdd(Mesh, INDEX_NONE);
+	if (BatchIndex == INDEX_NONE)
+	{
+		BatchIndex = Batches.Num();
+		Batches.AddDefaulted_GetRef().Mesh = Mesh;
+	}
+
+	FMeshBatch& Batch = Batches[BatchIndex];
+	Batch.Transforms.Add(Transform);
+	++NumInstances;
+
+	if (bMirrorBackface)
+	{
+		FRotator MirrorRot = Transform.Rotator();
+		MirrorRot.Yaw += 180.0f;
+		Batch.Transforms.Emplace(MirrorRot, Transform.GetLocation(), Transform.GetScale3D());
+		++NumInstances;
+	}
+}
+
+int32 FSLFScatterBatch::CountDrawCalls(const UStaticMesh* Mesh)
+{
+	return Mesh ? FMath::Max(Mesh->GetNumSections(0), 1) : 0;
+}
+
+AActor* FSLFScatterBatch::Flush(UWorld* World, const FString& ActorLabel, FName FolderPath, FSLFScatterBatchStats* OutStats)
+{
+	FSLFScatterBatchStats Stats;
+	AActor* Actor = nullptr;
+
+	if (World && NumInstances > 0)
+	{
+		Actor = World->SpawnActor<AActor>();
+	}
+
+	if (Actor)
+	{
+		USceneComponent* Root = NewObject<USceneComponent>(Actor, TEXT("ScatterRoot"));
+		Root->SetMobility(EComponentMobility::Static);
+		Actor->SetRootComponent(Root);
+		Actor->AddInstanceComponent(Root);
+		Root->RegisterComponent();
+
+		for (const FMeshBatch& Batch : Batches)
+		{
+			// Per-mesh component names keep the saved level readable (SM_Rock_01, SM_Rock_01_1, ...)
+			const FName ComponentName = MakeUniqueObjectName(Actor, UHierarchicalInstancedStaticMeshComponent::StaticClass(), Batch.Mesh->GetFName());
+			UHierarchicalInstancedStaticMeshComponent* HISM = NewObject<UHierarchicalInstancedStaticMeshComponent>(Actor, ComponentName);
+			HISM->SetMobility(EComponentMobility::Static);
+			HISM->SetStaticMesh(Batch.Mesh);
+			HISM->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName); // Same as AStaticMeshActor
+			HISM->SetupAttachment(Root);
+			Actor->AddInstanceComponent(HISM);
+			HISM->RegisterComponent();
+			HISM->AddInstances(Batch.Transforms, /*bShouldReturnIndices=*/ false, /*bWorldSpace=*/ true);
+
+			const int32 MeshDrawCalls = CountDrawCalls(Batch.Mesh);
+			Stats.Instances += Batch.Transforms.Num();
+			Stats.Components += 1;
+			Stats.DrawCalls += MeshDrawCalls;
+			Stats.LegacyActors += Batch.Transforms.Num();
+			Stats.LegacyDrawCalls += MeshDrawCalls * Batch.Transforms.Num();
+		}
+		Stats.Actors = 1;
+
+#if WITH_EDITOR
+		Actor->SetActorLabel(ActorLabel);
+		Actor->SetFolderPath(FolderPath);
+#endif
+	}
+
+	Batches.Reset();
+	BatchIndexByMesh.Reset();
+	NumInstances = 0;
+
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+	return Actor;
+}
@@ -0,0 +1,71 @@
+// SLFScatterBatch.h
+// Instanced output for open world scatter.
+//
+// Placements are collected per mesh and written as one hierarchical instanced static
+// mesh component per mesh on a single actor, instead of one AStaticMeshActor per
+// placement. Back-to-back mirrored copies (single-sided cliff rocks) go into the same
+// component as a second instance, so they cost neither an actor nor a draw call.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UStaticMesh;
+class UWorld;
+
+/** Output size of one or more flushed batches, next to what per-placement actors would cost */
+struct FSLFScatterBatchStats
+{
+	int32 Instances = 0;
+	int32 Components = 0;
+	int32 Actors = 0;
+	int32 DrawCalls = 0;
+
+	/** One AStaticMeshActor per placement (plus one per mirrored copy) */
+	int32 LegacyActors = 0;
+	int32 LegacyDrawCalls = 0;
+
+	void Accumulate(const FSLFScatterBatchStats& Other)
+	{
+		Instances += Other.Instances;
+		Components += Other.Components;
+		Actors += Other.Actors;
+		DrawCalls += Other.DrawCalls;
+		LegacyActors += Other.LegacyActors;
+		LegacyDrawCalls += Other.LegacyDrawCalls;
+	}
+};
+
+class SLFCONVERSION_API FSLFScatterBatch
+{
+public:
+	/**
+	 * Queue one placement. bMirrorBackface adds a second instance rotated 180° in yaw.
+	 * The batch does not reference Mesh for GC - the caller keeps it alive until Flush.
+	 */
+	void Add(UStaticMesh* Mesh, const FTransform& Transform, bool bMirrorBackface = false);
+
+	int32 GetNumInstances() const { return NumInstances; }
+	bool IsEmpty() const { return NumInstances == 0; }
+
+	/**
+	 * Spawn one actor with a HISM component per mesh (components in first-use order) and
+	 * clear the batch. Returns nullptr when there is nothing to write.
+	 */
+	AActor* Flush(UWorld* World, const FString& ActorLabel, FName FolderPath, FSLFScatterBatchStats* OutStats = nullptr);
+
+	/** Draw calls for one copy of Mesh (LOD0 sections) */
+	static int32 CountDrawCalls(const UStaticMesh* Mesh);
+
+private:
+	struct FMeshBatch
+	{
+		UStaticMesh* Mesh = nullptr;
+		TArray<FTransform> Transforms;
+	};
+
+	TArray<FMeshBatch> Batches;
+	TMap<const UStaticMesh*, int32> BatchIndexByMesh;
+	int32 NumInstances = 0;
+};
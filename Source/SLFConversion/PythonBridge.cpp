@@ -42,6 +42,15 @@
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
 #include "UObject/PropertyIterator.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "IO/IoHash.h"
+#include "Tasks/Task.h"
+#include "SLFAssetDependencyGraph.h"
 
 // ============================================================================
 // JSON HELPER FUNCTIONS
@@ -784,10 +793,16 @@ TSharedPtr<FJsonObject> UPythonBridge::SerializeFunction(UFunction* Function, UB
 // ============================================================================
 
 FString UPythonBridge::ExportBlueprintDNA(UBlueprint* Blueprint)
+{
+	TSharedPtr<FJsonObject> RootObj = BuildBlueprintDNA(Blueprint);
+	return RootObj.IsValid() ? JsonObjectToString(RootObj) : TEXT("{}");
+}
+
+TSharedPtr<FJsonObject> UPythonBridge::BuildBlueprintDNA(UBlueprint* Blueprint)
 {
 	if (!Blueprint)
 	{
-		return TEXT("{}");
+		return nullptr;
 	}
 
 	TSharedPtr<FJsonObject> RootObj = MakeShareable(new FJsonObject());
@@ -960,7 +975,7 @@ FString UPythonBridge::ExportBlueprintDNA(UBlueprint* Blueprint)
 	LogicObj->SetArrayField(TEXT("AllGraphs"), AllGraphsArray);
 	RootObj->SetObjectField(TEXT("Logic"), LogicObj);
 
-	return JsonObjectToString(RootObj);
+	return RootObj;
 }
 
 // ============================================================================
@@ -969,19 +984,19 @@ FString UPythonBridge::ExportBlueprintDNA(UBlueprint* Blueprint)
 
 FString UPythonBridge::ExportWidgetBlueprintDNA(UObject* WidgetBlueprintObj)
 {
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(WidgetBlueprintObj);
+	TSharedPtr<FJsonObject> RootObj = BuildWidgetBlueprintDNA(Cast<UWidgetBlueprint>(WidgetBlueprintObj));
+	return RootObj.IsValid() ? JsonObjectToString(RootObj) : TEXT("{}");
+}
+
+TSharedPtr<FJsonObject> UPythonBridge::BuildWidgetBlueprintDNA(UWidgetBlueprint* WidgetBlueprint)
+{
 	if (!WidgetBlueprint)
 	{
-		return TEXT("{}");
+		return nullptr;
 	}
 
-	// Start with base Blueprint export
-	TSharedPtr<FJsonObject> RootObj = MakeShareable(new FJsonObject());
-
-	// Parse the base Blueprint export
-	FString BaseDNA = ExportBlueprintDNA(WidgetBlueprint);
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaseDNA);
-	FJsonSerializer::Deserialize(Reader, RootObj);
+	// Start with base Blueprint export (extended in place, no string round trip)
+	TSharedPtr<FJsonObject> RootObj = BuildBlueprintDNA(WidgetBlueprint);
 
 	// Add widget-specific info
 	if (WidgetBlueprint->WidgetTree)
@@ -1027,22 +1042,24 @@ FString UPythonBridge::ExportWidgetBlueprintDNA(UObject* WidgetBlueprintObj)
 	}
 	RootObj->SetArrayField(TEXT("Animations"), AnimationsArray);
 
-	return JsonObjectToString(RootObj);
+	return RootObj;
 }
 
 FString UPythonBridge::ExportAnimBlueprintDNA(UAnimBlueprint* AnimBlueprint)
+{
+	TSharedPtr<FJsonObject> RootObj = BuildAnimBlueprintDNA(AnimBlueprint);
+	return RootObj.IsValid() ? JsonObjectToString(RootObj) : TEXT("{}");
+}
+
+TSharedPtr<FJsonObject> UPythonBridge::BuildAnimBlueprintDNA(UAnimBlueprint* AnimBlueprint)
 {
 	if (!AnimBlueprint)
 	{
-		return TEXT("{}");
+		return nullptr;
 	}
 
-	// Start with base Blueprint export
-	TSharedPtr<FJsonObject> RootObj = MakeShareable(new FJsonObject());
-
-	FString BaseDNA = ExportBlueprintDNA(AnimBlueprint);
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaseDNA);
-	FJsonSerializer::Deserialize(Reader, RootObj);
+	// Start with base Blueprint export (extended in place, no string round trip)
+	TSharedPtr<FJsonObject> RootObj = BuildBlueprintDNA(AnimBlueprint);
 
 	// Add anim-specific info
 	if (AnimBlueprint->TargetSkeleton)
@@ -1238,14 +1255,20 @@ FString UPythonBridge::ExportAnimBlueprintDNA(UAnimBlueprint* AnimBlueprint)
 	AnimGraphObj->SetArrayField(TEXT("AllPropertyAccessPaths"), AllPropertyAccessArray);
 	RootObj->SetObjectField(TEXT("AnimGraphInfo"), AnimGraphObj);
 
-	return JsonObjectToString(RootObj);
+	return RootObj;
 }
 
 FString UPythonBridge::ExportUserDefinedEnum(UUserDefinedEnum* Enum)
+{
+	TSharedPtr<FJsonObject> RootObj = BuildUserDefinedEnumDNA(Enum);
+	return RootObj.IsValid() ? JsonObjectToString(RootObj) : TEXT("{}");
+}
+
+TSharedPtr<FJsonObject> UPythonBridge::BuildUserDefinedEnumDNA(UUserDefinedEnum* Enum)
 {
 	if (!Enum)
 	{
-		return TEXT("{}");
+		return nullptr;
 	}
 
 	TSharedPtr<FJsonObject> RootObj = MakeShareable(new FJsonObject());
@@ -1263,14 +1286,20 @@ FString UPythonBridge::ExportUserDefinedEnum(UUserDefinedEnum* Enum)
 	}
 	RootObj->SetArrayField(TEXT("Values"), ValuesArray);
 
-	return JsonObjectToString(RootObj);
+	return RootObj;
 }
 
 FString UPythonBridge::ExportUserDefinedStruct(UUserDefinedStruct* Struct)
+{
+	TSharedPtr<FJsonObject> RootObj = BuildUserDefinedStructDNA(Struct);
+	return RootObj.IsValid() ? JsonObjectToString(RootObj) : TEXT("{}");
+}
+
+TSharedPtr<FJsonObject> UPythonBridge::BuildUserDefinedStructDNA(UUserDefinedStruct* Struct)
 {
 	if (!Struct)
 	{
-		return TEXT("{}");
+		return nullptr;
 	}
 
 	TSharedPtr<FJsonObject> RootObj = MakeShareable(new FJsonObject());
@@ -1288,14 +1317,20 @@ FString UPythonBridge::ExportUserDefinedStruct(UUserDefinedStruct* Struct)
 	}
 	RootObj->SetArrayField(TEXT("Properties"), PropertiesArray);
 
-	return JsonObjectToString(RootObj);
+	return RootObj;
 }
 
 FString UPythonBridge::ExportDataAsset(UDataAsset* DataAsset)
+{
+	TSharedPtr<FJsonObject> RootObj = BuildDataAssetDNA(DataAsset);
+	return RootObj.IsValid() ? JsonObjectToString(RootObj) : TEXT("{}");
+}
+
+TSharedPtr<FJsonObject> UPythonBridge::BuildDataAssetDNA(UDataAsset* DataAsset)
 {
 	if (!DataAsset)
 	{
-		return TEXT("{}");
+		return nullptr;
 	}
 
 	TSharedPtr<FJsonObject> RootObj = MakeShareable(new FJsonObject());
@@ -1317,39 +1352,45 @@ FString UPythonBridge::ExportDataAsset(UDataAsset* DataAsset)
 	}
 	RootObj->SetArrayField(TEXT("Properties"), PropertiesArray);
 
-	return JsonObjectToString(RootObj);
+	return RootObj;
 }
 
 FString UPythonBridge::ExportAssetDNA(UObject* Asset)
+{
+	TSharedPtr<FJsonObject> RootObj = BuildAssetDNA(Asset);
+	return RootObj.IsValid() ? JsonObjectToString(RootObj) : TEXT("{}");
+}
+
+TSharedPtr<FJsonObject> UPythonBridge::BuildAssetDNA(UObject* Asset)
 {
 	if (!Asset)
 	{
-		return TEXT("{}");
+		return nullptr;
 	}
 
 	if (UBlueprint* BP = Cast<UBlueprint>(Asset))
 	{
 		if (UWidgetBlueprint* WidgetBP = Cast<UWidgetBlueprint>(Asset))
 		{
-			return ExportWidgetBlueprintDNA(WidgetBP);
+			return BuildWidgetBlueprintDNA(WidgetBP);
 		}
 		if (UAnimBlueprint* AnimBP = Cast<UAnimBlueprint>(Asset))
 		{
-			return ExportAnimBlueprintDNA(AnimBP);
+			return BuildAnimBlueprintDNA(AnimBP);
 		}
-		return ExportBlueprintDNA(BP);
+		return BuildBlueprintDNA(BP);
 	}
 	if (UUserDefinedEnum* Enum = Cast<UUserDefinedEnum>(Asset))
 	{
-		return ExportUserDefinedEnum(Enum);
+		return BuildUserDefinedEnumDNA(Enum);
 	}
 	if (UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Asset))
 	{
-		return ExportUserDefinedStruct(Struct);
+		return BuildUserDefinedStructDNA(Struct);
 	}
 	if (UDataAsset* DA = Cast<UDataAsset>(Asset))
 	{
-		return ExportDataAsset(DA);
+		return BuildDataAssetDNA(DA);
 	}
 
 	// Fallback - basic info
@@ -1357,7 +1398,256 @@ FString UPythonBridge::ExportAssetDNA(UObject* Asset)
 	RootObj->SetStringField(TEXT("Name"), Asset->GetName());
 	RootObj->SetStringField(TEXT("Path"), Asset->GetPathName());
 	RootObj->SetStringField(TEXT("Class"), Asset->GetClass()->GetName());
-	return JsonObjectToString(RootObj);
+	return RootObj;
+}
+
+// ============================================================================
+// BULK EXPORT
+// ============================================================================
+
+namespace
+{
+	/** Bump when the DNA layout changes so every asset is exported again */
+	constexpr int32 DNAExportFormatVersion = 1;
+
+	const TCHAR* const DNAExportManifestName = TEXT("_DNAExportManifest.json");
+
+	FString GetPackageSavedHash(IAssetRegistry& AssetRegistry, FName PackageName)
+	{
+		TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+		return PackageData.IsSet() ? LexToString(PackageData->GetPackageSavedHash()) : FString();
+	}
+
+	/** Worker thread: stream the snapshot into the file as UTF-8 (same text ExportAssetDNA returns) */
+	bool WriteDNAFile(const TSharedRef<FJsonObject>& Root, const FString& FilePath)
+	{
+		TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+		if (!FileWriter)
+		{
+			return false;
+		}
+
+		TSharedRef<TJsonWriter<UTF8CHAR>> Writer = TJsonWriterFactory<UTF8CHAR>::Create(FileWriter.Get());
+		const bool bSerialized = FJsonSerializer::Serialize(Root, Writer);
+		return FileWriter->Close() && bSerialized;
+	}
+
+	/** Asset path -> package saved hash at the time of its last export */
+	TMap<FString, FString> LoadDNAExportManifest(const FString& ManifestPath)
+	{
+		TMap<FString, FString> Hashes;
+
+		FString ManifestText;
+		TSharedPtr<FJsonObject> ManifestObj;
+		int32 Version = 0;
+		if (!FFileHelper::LoadFileToString(ManifestText, *ManifestPath) ||
+			!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ManifestText), ManifestObj) || !ManifestObj.IsValid() ||
+			!ManifestObj->TryGetNumberField(TEXT("Version"), Version) || Version != DNAExportFormatVersion)
+		{
+			return Hashes;
+		}
+
+		const TSharedPtr<FJsonObject>* AssetsObj = nullptr;
+		if (ManifestObj->TryGetObjectField(TEXT("Assets"), AssetsObj))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*AssetsObj)->Values)
+			{
+				Hashes.Add(Entry.Key, Entry.Value->AsString());
+			}
+		}
+		return Hashes;
+	}
+
+	bool SaveDNAExportManifest(const FString& ManifestPath, TMap<FString, FString> Hashes)
+	{
+		Hashes.KeySort(TLess<FString>());
+
+		TSharedPtr<FJsonObject> AssetsObj = MakeShareable(new FJsonObject());
+		for (const TPair<FString, FString>& Entry : Hashes)
+		{
+			AssetsObj->SetStringField(Entry.Key, Entry.Value);
+		}
+
+		TSharedPtr<FJsonObject> ManifestObj = MakeShareable(new FJsonObject());
+		ManifestObj->SetNumberField(TEXT("Version"), DNAExportFormatVersion);
+		ManifestObj->SetObjectField(TEXT("Assets"), AssetsObj);
+		return FFileHelper::SaveStringToFile(JsonObjectToString(ManifestObj), *ManifestPath);
+	}
+}
+
+FString UPythonBridge::GetDNAExportFilePath(const FString& OutputFolder, const FString& AssetPath)
+{
+	// "/Game/A/BP_A.BP_A" -> "<OutputFolder>/Game/A/BP_A.json"
+	const FString PackageName = FPackageName::ObjectPathToPackageName(AssetPath);
+	return FPaths::Combine(OutputFolder, PackageName.RightChop(1) + TEXT(".json"));
+}
+
+FSLFBulkDNAExportResult UPythonBridge::BulkExportAssetDNA(const TArray<FString>& AssetPaths, const FString& OutputFolder, bool bForce, int32 BatchSize)
+{
+	FSLFBulkDNAExportResult Result;
+	const double StartTime = FPlatformTime::Seconds();
+	BatchSize = FMath::Max(BatchSize, 1);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	const FString ManifestPath = FPaths::Combine(OutputFolder, DNAExportManifestName);
+	TMap<FString, FString> ExportedHashes = LoadDNAExportManifest(ManifestPath);
+
+	struct FPendingAsset
+	{
+		FSoftObjectPath ObjectPath;
+		FString FilePath;
+		FString SavedHash;
+	};
+
+	// Drop unchanged assets before anything is loaded
+	TArray<FPendingAsset> Pending;
+	Pending.Reserve(AssetPaths.Num());
+	for (const FString& InPath : AssetPaths)
+	{
+		FSoftObjectPath ObjectPath(InPath);
+		if (ObjectPath.GetAssetName().IsEmpty())
+		{
+			// Package path ("/Game/A/BP_A") - the asset is named after its package
+			ObjectPath = FSoftObjectPath(InPath + TEXT(".") + FPackageName::GetShortName(InPath));
+		}
+		if (!ObjectPath.IsValid() || (!AssetRegistry.GetAssetByObjectPath(ObjectPath).IsValid() && !ObjectPath.ResolveObject()))
+		{
+			Result.FailedAssets.Add(InPath);
+			continue;
+		}
+
+		const FString AssetPath = ObjectPath.ToString();
+		const FName PackageName = ObjectPath.GetLongPackageFName();
+		FPendingAsset Asset{ ObjectPath, GetDNAExportFilePath(OutputFolder, AssetPath), GetPackageSavedHash(AssetRegistry, PackageName) };
+
+		// A loaded package with unsaved edits no longer matches its saved hash
+		const UPackage* LoadedPackage = FindPackage(nullptr, *PackageName.ToString());
+		const bool bDirty = LoadedPackage && LoadedPackage->IsDirty();
+
+		const FString* PreviousHash = ExportedHashes.Find(AssetPath);
+		if (!bForce && !bDirty && !Asset.SavedHash.IsEmpty() && PreviousHash && *PreviousHash == Asset.SavedHash &&
+			IFileManager::Get().FileExists(*Asset.FilePath))
+		{
+			++Result.Skipped;
+			continue;
+		}
+
+		Pending.Add(MoveTemp(Asset));
+	}
+
+	// Writes of one batch run on workers while the next batch loads and snapshots
+	TArray<UE::Tasks::TTask<bool>> InFlightWrites;
+	TArray<int32> InFlightAssets;
+	auto CompleteWrites = [&]()
+	{
+		for (int32 Index = 0; Index < InFlightWrites.Num(); ++Index)
+		{
+			const FPendingAsset& Asset = Pending[InFlightAssets[Index]];
+			if (InFlightWrites[Index].GetResult())
+			{
+				++Result.Exported;
+				if (!Asset.SavedHash.IsEmpty())
+				{
+					ExportedHashes.Add(Asset.ObjectPath.ToString(), Asset.SavedHash);
+				}
+			}
+			else
+			{
+				// The file on disk may be stale or partial - the next run must export it again
+				Result.FailedAssets.Add(Asset.ObjectPath.ToString());
+				ExportedHashes.Remove(Asset.ObjectPath.ToString());
+			}
+		}
+		InFlightWrites.Reset();
+		InFlightAssets.Reset();
+	};
+
+	for (int32 BatchStart = 0; BatchStart < Pending.Num(); BatchStart += BatchSize)
+	{
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Pending.Num());
+
+		// Queue the whole batch so package IO overlaps, then block once
+		for (int32 Index = BatchStart; Index < BatchEnd; ++Index)
+		{
+			const FString PackageName = Pending[Index].ObjectPath.GetLongPackageName();
+			if (!FindPackage(nullptr, *PackageName))
+			{
+				LoadPackageAsync(PackageName);
+			}
+		}
+		FlushAsyncLoading();
+
+		// Reflection snapshot on the game thread
+		TArray<TSharedRef<FJsonObject>> Snapshots;
+		TArray<int32> SnapshotAssets;
+		for (int32 Index = BatchStart; Index < BatchEnd; ++Index)
+		{
+			TSharedPtr<FJsonObject> Root = BuildAssetDNA(Pending[Index].ObjectPath.TryLoad());
+			if (!Root.IsValid())
+			{
+				Result.FailedAssets.Add(Pending[Index].ObjectPath.ToString());
+				ExportedHashes.Remove(Pending[Index].ObjectPath.ToString());
+				continue;
+			}
+			Snapshots.Add(Root.ToSharedRef());
+			SnapshotAssets.Add(Index);
+		}
+
+		// Previous batch must be done before its slots are reused
+		CompleteWrites();
+
+		for (int32 Slot = 0; Slot < Snapshots.Num(); ++Slot)
+		{
+			InFlightWrites.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION,
+				[Root = Snapshots[Slot], FilePath = Pending[SnapshotAssets[Slot]].FilePath]()
+				{
+					return WriteDNAFile(Root, FilePath);
+				}));
+		}
+		InFlightAssets = MoveTemp(SnapshotAssets);
+
+		// Snapshots are plain JSON, so this batch's packages can go before the next one loads
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+	CompleteWrites();
+
+	SaveDNAExportManifest(ManifestPath, MoveTemp(ExportedHashes));
+
+	Result.Seconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+	Result.AssetsPerSecond = Result.Seconds > 0.0f ? (Result.Exported + Result.Skipped) / Result.Seconds : 0.0f;
+
+	UE_LOG(LogTemp, Warning, TEXT("PythonBridge: Bulk DNA export to '%s' - %d exported, %d unchanged, %d failed in %.2fs (%.1f assets/s)"),
+		*OutputFolder, Result.Exported, Result.Skipped, Result.FailedAssets.Num(), Result.Seconds, Result.AssetsPerSecond);
+	return Result;
+}
+
+FSLFBulkDNAExportResult UPythonBridge::BulkExportContentRootDNA(const FString& ContentRoot, const FString& OutputFolder, bool bForce, int32 BatchSize)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	// Same asset types ExportAssetDNA has a dedicated export for
+	FARFilter Filter;
+	Filter.PackagePaths.Add(FName(*ContentRoot));
+	Filter.bRecursivePaths = true;
+	Filter.bRecursiveClasses = true;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.ClassPaths.Add(UUserDefinedEnum::StaticClass()->GetClassPathName());
+	Filter.ClassPaths.Add(UUserDefinedStruct::StaticClass()->GetClassPathName());
+	Filter.ClassPaths.Add(UDataAsset::StaticClass()->GetClassPathName());
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	TArray<FString> AssetPaths;
+	AssetPaths.Reserve(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		AssetPaths.Add(AssetData.GetObjectPathString());
+	}
+	AssetPaths.Sort();
+
+	return BulkExportAssetDNA(AssetPaths, OutputFolder, bForce, BatchSize);
 }
 
 // ============================================================================
@@ -1631,77 +1921,103 @@ TArray<FString> UPythonBridge::PrepareBlueprintForReparenting(UBlueprint* Bluepr
 
 TArray<UBlueprint*> UPythonBridge::GetChildBlueprints(UClass* ParentClass)
 {
-	TArray<UBlueprint*> ChildBlueprints;
-
 	if (!ParentClass)
 	{
-		return ChildBlueprints;
+		return TArray<UBlueprint*>();
 	}
 
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-	TArray<FAssetData> BlueprintAssets;
-	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), BlueprintAssets, true);
+	const TArray<FName> CandidatePackages = FSLFAssetDependencyGraph::Get().GetChildBlueprintPackages(
+		FName(*ParentClass->GetClassPathName().ToString()));
 
-	for (const FAssetData& Asset : BlueprintAssets)
+	// Both passes below can see the same Blueprint
+	TSet<UBlueprint*> Found;
+
+	for (const FName PackageName : CandidatePackages)
 	{
-		if (UBlueprint* BP = Cast<UBlueprint>(Asset.GetAsset()))
+		TArray<FAssetData> PackageAssets;
+		AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets, true);
+
+		for (const FAssetData& Asset : PackageAssets)
 		{
-			if (BP->GeneratedClass && BP->GeneratedClass->IsChildOf(ParentClass))
+			if (!Asset.IsInstanceOf(UBlueprint::StaticClass()))
 			{
-				ChildBlueprints.Add(BP);
+				continue;
+			}
+
+			// The index comes from registry tags; the loaded class has the final say
+			if (UBlueprint* BP = Cast<UBlueprint>(Asset.GetAsset()))
+			{
+				if (BP->GeneratedClass && BP->GeneratedClass->IsChildOf(ParentClass))
+				{
+					Found.Add(BP);
+				}
 			}
 		}
 	}
 
-	return ChildBlueprints;
+	// Registry tags lag behind unsaved edits: a Blueprint created or reparented in this session
+	// is missing from (or misfiled in) the index until it is saved. Loaded Blueprints are
+	// already in memory, so check them directly.
+	for (TObjectIterator<UBlueprint> It; It; ++It)
+	{
+		UBlueprint* BP = *It;
+		if (IsValid(BP) && BP->GetOutermost() != GetTransientPackage()
+			&& BP->GeneratedClass && BP->GeneratedClass->IsChildOf(ParentClass))
+		{
+			Found.Add(BP);
+		}
+	}
+
+	return Found.Array();
 }
 
-TArray<FString> UPythonBridge::GetAssetDependencies(UObject* Asset)
+namespace
 {
-	TArray<FString> Dependencies;
-
-	if (!Asset)
+	TArray<FString> PackageNamesToStrings(const TArray<FName>& PackageNames)
 	{
-		return Dependencies;
+		TArray<FString> Result;
+		Result.Reserve(PackageNames.Num());
+		for (const FName PackageName : PackageNames)
+		{
+			Result.Add(PackageName.ToString());
+		}
+		return Result;
 	}
 
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	TArray<FAssetIdentifier> Deps;
-	AssetRegistry.GetDependencies(FAssetIdentifier(FName(*Asset->GetPathName())), Deps);
-
-	for (const FAssetIdentifier& Dep : Deps)
+	TArray<FName> StringsToPackageNames(const TArray<FString>& Paths)
 	{
-		Dependencies.Add(Dep.ToString());
+		// Object paths ("/Game/X.X") are accepted too
+		TArray<FName> Result;
+		Result.Reserve(Paths.Num());
+		for (const FString& Path : Paths)
+		{
+			Result.Add(FName(*FPackageName::ObjectPathToPackageName(Path)));
+		}
+		return Result;
 	}
-
-	return Dependencies;
 }
 
-TArray<FString> UPythonBridge::GetAssetReferencers(UObject* Asset)
+TArray<FString> UPythonBridge::GetAssetDependencies(UObject* Asset)
 {
-	TArray<FString> Referencers;
-
 	if (!Asset)
 	{
-		return Referencers;
+		return TArray<FString>();
 	}
 
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	TArray<FAssetIdentifier> Refs;
-	AssetRegistry.GetReferencers(FAssetIdentifier(FName(*Asset->GetPathName())), Refs);
+	return PackageNamesToStrings(FSLFAssetDependencyGraph::Get().GetDependencies(Asset->GetOutermost()->GetFName()));
+}
 
-	for (const FAssetIdentifier& Ref : Refs)
+TArray<FString> UPythonBridge::GetAssetReferencers(UObject* Asset)
+{
+	if (!Asset)
 	{
-		Referencers.Add(Ref.ToString());
+		return TArray<FString>();
 	}
 
-	return Referencers;
+	return PackageNamesToStrings(FSLFAssetDependencyGraph::Get().GetReferencers(Asset->GetOutermost()->GetFName()));
 }
 
 FString UPythonBridge::GetAssetDependencyReport(UObject* Asset)
@@ -1733,6 +2049,36 @@ FString UPythonBridge::GetAssetDependencyReport(UObject* Asset)
 	return JsonObjectToString(RootObj);
 }
 
+TArray<FString> UPythonBridge::GetTransitiveDependencies(const TArray<FString>& PackageNames)
+{
+	return PackageNamesToStrings(FSLFAssetDependencyGraph::Get().GetTransitiveDependencies(StringsToPackageNames(PackageNames)));
+}
+
+TArray<FString> UPythonBridge::GetTransitiveReferencers(const TArray<FString>& PackageNames)
+{
+	return PackageNamesToStrings(FSLFAssetDependencyGraph::Get().GetTransitiveReferencers(StringsToPackageNames(PackageNames)));
+}
+
+TArray<FString> UPythonBridge::GetImpactSet(const TArray<FString>& ChangedPackages)
+{
+	const TArray<FString> Impacted = PackageNamesToStrings(FSLFAssetDependencyGraph::Get().GetImpactSet(StringsToPackageNames(ChangedPackages)));
+	UE_LOG(LogTemp, Log, TEXT("PythonBridge: %d changed package(s) impact %d package(s)"), ChangedPackages.Num(), Impacted.Num());
+	return Impacted;
+}
+
+int32 UPythonBridge::RebuildAssetDependencyGraph()
+{
+	FSLFAssetDependencyGraph& Graph = FSLFAssetDependencyGraph::Get();
+	Graph.BuildFromRegistry();
+	Graph.SaveSnapshot(FSLFAssetDependencyGraph::GetDefaultSnapshotPath());
+	return Graph.NumNodes();
+}
+
+bool UPythonBridge::SaveAssetDependencyGraph()
+{
+	return FSLFAssetDependencyGraph::Get().SaveSnapshot(FSLFAssetDependencyGraph::GetDefaultSnapshotPath());
+}
+
 // ============================================================================
 // WIDGET HELPERS
 // ============================================================================
@@ -16,6 +16,31 @@ class UUserDefinedEnum;
 class UUserDefinedStruct;
 class UDataAsset;
 
+/** Outcome of UPythonBridge::BulkExportAssetDNA */
+USTRUCT(BlueprintType)
+struct SLFCONVERSION_API FSLFBulkDNAExportResult
+{
+	GENERATED_BODY()
+
+	/** DNA files written */
+	UPROPERTY(BlueprintReadOnly, Category = "Python Bridge|Export")
+	int32 Exported = 0;
+
+	/** Package saved-hash unchanged since the last export (file kept) */
+	UPROPERTY(BlueprintReadOnly, Category = "Python Bridge|Export")
+	int32 Skipped = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Python Bridge|Export")
+	TArray<FString> FailedAssets;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Python Bridge|Export")
+	float Seconds = 0.0f;
+
+	/** (Exported + Skipped) / Seconds */
+	UPROPERTY(BlueprintReadOnly, Category = "Python Bridge|Export")
+	float AssetsPerSecond = 0.0f;
+};
+
 /**
  * Python Bridge - Exposes Blueprint internals to Python for migration workflows.
  *
@@ -91,6 +116,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Export")
 	static FString ExportAssetDNA(UObject* Asset);
 
+	// ============================================================================
+	// BULK EXPORT - Many assets per call
+	// ============================================================================
+
+	/**
+	 * Export the DNA of many assets to OutputFolder/<package path>.json (same JSON as ExportAssetDNA).
+	 * Packages are loaded BatchSize at a time and snapshotted on the game thread; JSON
+	 * formatting and file writes run on worker threads while the next batch loads.
+	 * Assets whose package saved-hash matches the last export (OutputFolder/_DNAExportManifest.json)
+	 * are skipped unless bForce; an asset whose write fails loses its manifest entry so the next
+	 * run exports it again. Garbage is collected after each batch.
+	 *
+	 * Usage from Python:
+	 *   result = unreal.PythonBridge.bulk_export_asset_dna(["/Game/A/BP_A", "/Game/B/BP_B"], "C:/Exports/DNA")
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Export")
+	static FSLFBulkDNAExportResult BulkExportAssetDNA(const TArray<FString>& AssetPaths, const FString& OutputFolder, bool bForce = false, int32 BatchSize = 64);
+
+	/** BulkExportAssetDNA for every Blueprint, user enum/struct and data asset under ContentRoot (e.g. "/Game/SoulslikeFramework") */
+	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Export")
+	static FSLFBulkDNAExportResult BulkExportContentRootDNA(const FString& ContentRoot, const FString& OutputFolder, bool bForce = false, int32 BatchSize = 64);
+
+	/** File BulkExportAssetDNA writes for an asset ("/Game/A/BP_A.BP_A" -> OutputFolder/Game/A/BP_A.json) */
+	static FString GetDNAExportFilePath(const FString& OutputFolder, const FString& AssetPath);
+
 	// ============================================================================
 	// BLUEPRINT MANIPULATION - Modify blueprints programmatically
 	// ============================================================================
@@ -160,18 +210,20 @@ public:
 
 	/**
 	 * Get all Blueprints that inherit from a given class.
+	 * Candidates come from the dependency graph's class index, so only matching Blueprints are loaded;
+	 * Blueprints already in memory are checked directly, so unsaved or reparented ones are included.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Dependencies")
 	static TArray<UBlueprint*> GetChildBlueprints(UClass* ParentClass);
 
 	/**
-	 * Get all assets that this asset depends on.
+	 * Get all packages that this asset's package depends on.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Dependencies")
 	static TArray<FString> GetAssetDependencies(UObject* Asset);
 
 	/**
-	 * Get all assets that reference this asset.
+	 * Get all packages that reference this asset's package.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Dependencies")
 	static TArray<FString> GetAssetReferencers(UObject* Asset);
@@ -182,6 +234,39 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Dependencies")
 	static FString GetAssetDependencyReport(UObject* Asset);
 
+	/**
+	 * Every package the given packages depend on, directly or indirectly.
+	 * Package names ("/Game/Blueprints/B_Soulslike_Character"), answered from the cached graph.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Dependencies")
+	static TArray<FString> GetTransitiveDependencies(const TArray<FString>& PackageNames);
+
+	/**
+	 * Every package that depends on the given packages, directly or indirectly.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Dependencies")
+	static TArray<FString> GetTransitiveReferencers(const TArray<FString>& PackageNames);
+
+	/**
+	 * Packages to re-validate after the given packages change: the packages themselves
+	 * plus everything that transitively references them.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Dependencies")
+	static TArray<FString> GetImpactSet(const TArray<FString>& ChangedPackages);
+
+	/**
+	 * Drop the cached dependency graph and rebuild it from the asset registry.
+	 * Returns the number of graph nodes.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Dependencies")
+	static int32 RebuildAssetDependencyGraph();
+
+	/**
+	 * Write the dependency graph snapshot now (normally written after the registry scan and at exit).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python Bridge|Dependencies")
+	static bool SaveAssetDependencyGraph();
+
 	// ============================================================================
 	// WIDGET BLUEPRINT HELPERS
 	// ============================================================================
@@ -199,6 +284,15 @@ public:
 	static UObject* GetRootWidgetFromBP(UObject* WidgetBlueprintObj);
 
 private:
+	// DNA snapshot builders (game thread; the resulting JSON tree holds no UObject references)
+	static TSharedPtr<FJsonObject> BuildBlueprintDNA(UBlueprint* Blueprint);
+	static TSharedPtr<FJsonObject> BuildWidgetBlueprintDNA(UWidgetBlueprint* WidgetBlueprint);
+	static TSharedPtr<FJsonObject> BuildAnimBlueprintDNA(UAnimBlueprint* AnimBlueprint);
+	static TSharedPtr<FJsonObject> BuildUserDefinedEnumDNA(UUserDefinedEnum* Enum);
+	static TSharedPtr<FJsonObject> BuildUserDefinedStructDNA(UUserDefinedStruct* Struct);
+	static TSharedPtr<FJsonObject> BuildDataAssetDNA(UDataAsset* DataAsset);
+	static TSharedPtr<FJsonObject> BuildAssetDNA(UObject* Asset);
+
 	// Helper functions for JSON serialization
 	static TSharedPtr<FJsonObject> SerializePropertyType(FProperty* Property);
 	static TSharedPtr<FJsonObject> SerializeVariable(const FBPVariableDescription& Variable, UBlueprint* Blueprint);
@@ -264,7 +264,7 @@ FString USLFAutomationLibrary::ExportAnimGraphState(UObject* AnimBlueprintAsset,
 	return Json;
 }
 
-FString USLFAutomationLibrary::DiffBlueprintStates(const FString& BeforeJsonPath, const FString& AfterJsonPath)
+FString USLFAutomationLibrary::DiffBlueprintStates(const FString& BeforeJsonPath, const FString& AfterJsonPath, const FString& DiffOutputPath)
 {
 	FString BeforeJson, AfterJson;
 
@@ -277,50 +277,70 @@ FString USLFAutomationLibrary::DiffBlueprintStates(const FString& BeforeJsonPath
 		return TEXT("Error: Could not load after JSON: ") + AfterJsonPath;
 	}
 
-	FString Diff;
-	Diff += TEXT("=== BLUEPRINT STATE DIFF ===\n\n");
-	Diff += TEXT("Before: ") + BeforeJsonPath + TEXT("\n");
-	Diff += TEXT("After: ") + AfterJsonPath + TEXT("\n\n");
-
-	// Line-by-line diff
-	TArray<FString> BeforeLines, AfterLines;
-	BeforeJson.ParseIntoArrayLines(BeforeLines);
-	AfterJson.ParseIntoArrayLines(AfterLines);
-
-	Diff += FString::Printf(TEXT("Before: %d lines\n"), BeforeLines.Num());
-	Diff += FString::Printf(TEXT("After: %d lines\n\n"), AfterLines.Num());
+	// Report goes to the file when one is given, otherwise into memory for the return value
+	TArray<uint8> ReportBytes;
+	TUniquePtr<FArchive> Report;
+	if (!DiffOutputPath.IsEmpty())
+	{
+		Report.Reset(IFileManager::Get().CreateFileWriter(*DiffOutputPath));
+		if (!Report)
+		{
+			return TEXT("Error: Could not write diff: ") + DiffOutputPath;
+		}
+	}
+	else
+	{
+		Report = MakeUnique<FMemoryWriter>(ReportBytes);
+	}
 
-	// Find differences
-	TSet<FString> BeforeSet(BeforeLines);
-	TSet<FString> AfterSet(AfterLines);
+	FSLFDiffEngine::WriteLine(*Report, TEXT("=== BLUEPRINT STATE DIFF ==="));
+	FSLFDiffEngine::WriteLine(*Report, TEXT(""));
+	FSLFDiffEngine::WriteLine(*Report, TEXT("Before: ") + BeforeJsonPath);
+	FSLFDiffEngine::WriteLine(*Report, TEXT("After: ") + AfterJsonPath);
+	FSLFDiffEngine::WriteLine(*Report, TEXT(""));
 
-	int32 RemovedCount = 0, AddedCount = 0;
+	TSharedPtr<FJsonObject> BeforeRoot, AfterRoot;
+	const bool bStructural =
+		FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BeforeJson), BeforeRoot) && BeforeRoot.IsValid() &&
+		FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(AfterJson), AfterRoot) && AfterRoot.IsValid();
 
-	Diff += TEXT("=== REMOVED ===\n");
-	for (const FString& Line : BeforeLines)
+	FSLFDiffStats Stats;
+	if (bStructural)
 	{
-		FString Trimmed = Line.TrimStartAndEnd();
-		if (!AfterSet.Contains(Line) && !Trimmed.IsEmpty() && !Trimmed.StartsWith(TEXT("{")))
-		{
-			Diff += TEXT("- ") + Trimmed + TEXT("\n");
-			RemovedCount++;
-		}
+		FSLFDiffEngine::WriteLine(*Report, TEXT("=== CHANGES (by path) ==="));
+		Stats = FSLFDiffEngine::WriteJsonDiff(*BeforeRoot, *AfterRoot, *Report);
+	}
+	else
+	{
+		// Exports with a skipped null node are not valid JSON; fall back to aligned lines
+		TArray<FStringView> BeforeLines, AfterLines;
+		FSLFDiffEngine::SplitLines(BeforeJson, BeforeLines);
+		FSLFDiffEngine::SplitLines(AfterJson, AfterLines);
+		FSLFDiffEngine::WriteLine(*Report, FString::Printf(TEXT("Before: %d lines"), BeforeLines.Num()));
+		FSLFDiffEngine::WriteLine(*Report, FString::Printf(TEXT("After: %d lines"), AfterLines.Num()));
+		FSLFDiffEngine::WriteLine(*Report, TEXT(""));
+		FSLFDiffEngine::WriteLine(*Report, TEXT("=== CHANGES (by line) ==="));
+		Stats = FSLFDiffEngine::WriteLineDiff(BeforeLines, AfterLines, *Report);
 	}
 
-	Diff += TEXT("\n=== ADDED ===\n");
-	for (const FString& Line : AfterLines)
+	const FString Summary = FString::Printf(TEXT("=== SUMMARY ===\nRemoved: %d\nAdded: %d\nChanged: %d\n"),
+		Stats.Removed, Stats.Added, Stats.Changed);
+	FSLFDiffEngine::WriteLine(*Report, TEXT(""));
+	FSLFDiffEngine::WriteLine(*Report, Summary.LeftChop(1));
+
+	if (!DiffOutputPath.IsEmpty())
 	{
-		FString Trimmed = Line.TrimStartAndEnd();
-		if (!BeforeSet.Contains(Line) && !Trimmed.IsEmpty() && !Trimmed.StartsWith(TEXT("{")))
+		if (!Report->Close())
 		{
-			Diff += TEXT("+ ") + Trimmed + TEXT("\n");
-			AddedCount++;
+			return TEXT("Error: Could not write diff: ") + DiffOutputPath;
 		}
+		UE_LOG(LogSLFAutomation, Warning, TEXT("DiffBlueprintStates: %d removed, %d added, %d changed -> %s"),
+			Stats.Removed, Stats.Added, Stats.Changed, *DiffOutputPath);
+		return Summary;
 	}
 
-	Diff += FString::Printf(TEXT("\n=== SUMMARY ===\nRemoved: %d lines\nAdded: %d lines\n"), RemovedCount, AddedCount);
-
-	return Diff;
+	Report.Reset();
+	return FString(FUTF8ToTCHAR(reinterpret_cast<const UTF8CHAR*>(ReportBytes.GetData()), ReportBytes.Num()));
 }
 
 int32 USLFAutomationLibrary::FixAnimBPFromReference(UObject* AnimBlueprintAsset, const FString& ReferenceJsonPath)
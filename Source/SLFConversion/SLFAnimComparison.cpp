@@ -0,0 +1,408 @@
+// SLFAnimComparison.cpp
+// Numeric comparison of two animations' bone tracks
+
+#include "SLFAnimComparison.h"
+#include "SLFAnimFrameDump.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+	/** Resampled channels per bone: position xyz, rotation xyzw (scale is not compared) */
+	constexpr int32 CompareChannels = 7;
+
+	/** Name lookups for one side of the comparison */
+	struct FCompareSide
+	{
+		const FSLFAnimFrameDump& Dump;
+		TMap<FName, int32> BoneIndices;
+		TMap<FName, int32> TrackIndices;
+		double FrameRate = 0.0;
+
+		explicit FCompareSide(const FSLFAnimFrameDump& InDump)
+			: Dump(InDump)
+			, FrameRate(InDump.FrameRate.AsDecimal())
+		{
+			BoneIndices.Reserve(Dump.BoneNames.Num());
+			for (int32 Bone = 0; Bone < Dump.BoneNames.Num(); ++Bone)
+			{
+				BoneIndices.Add(Dump.BoneNames[Bone], Bone);
+			}
+			TrackIndices.Reserve(Dump.TrackNames.Num());
+			for (int32 Track = 0; Track < Dump.TrackNames.Num(); ++Track)
+			{
+				TrackIndices.Add(Dump.TrackNames[Track], Track);
+			}
+		}
+
+		bool Contains(FName Bone) const { return BoneIndices.Contains(Bone) || TrackIndices.Contains(Bone); }
+		double GetLength() const { return (Dump.GetNumFrames() - 1) / FrameRate; }
+	};
+
+	struct FBonePair
+	{
+		FName BoneA;
+		FName BoneB;
+	};
+
+	/**
+	 * Sample one bone at OutFrames frames, SourceStep source frames apart, into CompareChannels
+	 * rows of Stride floats. Integer source frames are copied exactly; in between, position is
+	 * lerped and rotation nlerped. Unanimated bones hold their reference pose.
+	 */
+	void ResampleBone(const FCompareSide& Side, FName Bone, double SourceStep, int32 OutFrames, int32 Stride, float* Out)
+	{
+		const int32* Track = Side.TrackIndices.Find(Bone);
+		if (!Track)
+		{
+			const int32* BoneIndex = Side.BoneIndices.Find(Bone);
+			const FTransform RefPose = BoneIndex && Side.Dump.RefPose.IsValidIndex(*BoneIndex) ? Side.Dump.RefPose[*BoneIndex] : FTransform::Identity;
+			const FVector Position = RefPose.GetTranslation();
+			const FQuat Rotation = RefPose.GetRotation();
+			const float Values[CompareChannels] =
+			{
+				(float)Position.X, (float)Position.Y, (float)Position.Z,
+				(float)Rotation.X, (float)Rotation.Y, (float)Rotation.Z, (float)Rotation.W
+			};
+			for (int32 Channel = 0; Channel < CompareChannels; ++Channel)
+			{
+				for (int32 Frame = 0; Frame < OutFrames; ++Frame)
+				{
+					Out[Channel * Stride + Frame] = Values[Channel];
+				}
+			}
+			return;
+		}
+
+		const float* Source[CompareChannels];
+		for (int32 Channel = 0; Channel < CompareChannels; ++Channel)
+		{
+			Source[Channel] = Side.Dump.GetChannel(*Track, (ESLFAnimChannel)Channel).GetData();
+		}
+
+		const int32 LastSourceFrame = Side.Dump.GetNumFrames() - 1;
+		for (int32 Frame = 0; Frame < OutFrames; ++Frame)
+		{
+			const double SourceFrame = FMath::Clamp(Frame * SourceStep, 0.0, (double)LastSourceFrame);
+			const int32 Frame0 = FMath::FloorToInt32(SourceFrame);
+			const float Alpha = (float)(SourceFrame - Frame0);
+			if (Alpha == 0.0f || Frame0 >= LastSourceFrame)
+			{
+				for (int32 Channel = 0; Channel < CompareChannels; ++Channel)
+				{
+					Out[Channel * Stride + Frame] = Source[Channel][Frame0];
+				}
+				continue;
+			}
+
+			const int32 Frame1 = Frame0 + 1;
+			for (int32 Channel = 0; Channel < 3; ++Channel)
+			{
+				Out[Channel * Stride + Frame] = FMath::Lerp(Source[Channel][Frame0], Source[Channel][Frame1], Alpha);
+			}
+
+			// q and -q are the same rotation; blend along the shorter arc
+			float Dot = 0.0f;
+			for (int32 Channel = 3; Channel < CompareChannels; ++Channel)
+			{
+				Dot += Source[Channel][Frame0] * Source[Channel][Frame1];
+			}
+			const float Sign = Dot < 0.0f ? -1.0f : 1.0f;
+			float Blended[4];
+			float LengthSquared = 0.0f;
+			for (int32 Component = 0; Component < 4; ++Component)
+			{
+				Blended[Component] = FMath::Lerp(Source[3 + Component][Frame0], Sign * Source[3 + Component][Frame1], Alpha);
+				LengthSquared += Blended[Component] * Blended[Component];
+			}
+			const float InvLength = LengthSquared > 0.0f ? FMath::InvSqrt(LengthSquared) : 0.0f;
+			for (int32 Component = 0; Component < 4; ++Component)
+			{
+				Out[(3 + Component) * Stride + Frame] = Blended[Component] * InvLength;
+			}
+		}
+	}
+
+	/**
+	 * Per-frame position error and relative rotation angle for one bone pair. Frames are
+	 * processed four at a time; the padding past NumFrames is zero on both sides and
+	 * produces zero error. Rotation uses the chord between the two quaternions,
+	 * angle = 4 * asin(min(|a - b|, |a + b|) / 2), which stays exact near zero where
+	 * 2 * acos(|a . b|) does not.
+	 */
+	void ComputeErrors(const float* RESTRICT A, const float* RESTRICT B, int32 NumFrames, int32 Stride,
+		float* RESTRICT OutPosition, float* RESTRICT OutRotationDegrees)
+	{
+		const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+		for (int32 Frame = 0; Frame < Stride; Frame += 4)
+		{
+			VectorRegister4Float PositionSquared = VectorZeroFloat();
+			for (int32 Channel = 0; Channel < 3; ++Channel)
+			{
+				const VectorRegister4Float Delta = VectorSubtract(VectorLoad(A + Channel * Stride + Frame), VectorLoad(B + Channel * Stride + Frame));
+				PositionSquared = VectorMultiplyAdd(Delta, Delta, PositionSquared);
+			}
+
+			VectorRegister4Float MinusSquared = VectorZeroFloat();
+			VectorRegister4Float PlusSquared = VectorZeroFloat();
+			for (int32 Channel = 3; Channel < CompareChannels; ++Channel)
+			{
+				const VectorRegister4Float QuatA = VectorLoad(A + Channel * Stride + Frame);
+				const VectorRegister4Float QuatB = VectorLoad(B + Channel * Stride + Frame);
+				const VectorRegister4Float Minus = VectorSubtract(QuatA, QuatB);
+				const VectorRegister4Float Plus = VectorAdd(QuatA, QuatB);
+				MinusSquared = VectorMultiplyAdd(Minus, Minus, MinusSquared);
+				PlusSquared = VectorMultiplyAdd(Plus, Plus, PlusSquared);
+			}
+
+			VectorStore(VectorSqrt(PositionSquared), OutPosition + Frame);
+			VectorStore(VectorMultiply(VectorSqrt(VectorMin(MinusSquared, PlusSquared)), Half), OutRotationDegrees + Frame);
+		}
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			OutRotationDegrees[Frame] = FMath::RadiansToDegrees(4.0f * FMath::Asin(FMath::Min(OutRotationDegrees[Frame], 1.0f)));
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// COMPARE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+bool FSLFAnimComparison::Compare(const FSLFAnimFrameDump& A, const FSLFAnimFrameDump& B, const FSLFAnimCompareOptions& Options,
+	FSLFAnimComparisonResult& OutResult, FString& OutError)
+{
+	OutResult = FSLFAnimComparisonResult();
+	OutResult.AnimationA = A.AnimationPath;
+	OutResult.AnimationB = B.AnimationPath;
+
+	const FCompareSide SideA(A);
+	const FCompareSide SideB(B);
+	if (A.GetNumFrames() == 0 || B.GetNumFrames() == 0 || SideA.FrameRate <= 0.0 || SideB.FrameRate <= 0.0)
+	{
+		OutError = TEXT("Both animations need frames and a frame rate");
+		return false;
+	}
+
+	// ── Common timeline ──
+	const double FrameRate = Options.FrameRate > 0.0 ? Options.FrameRate : FMath::Max(SideA.FrameRate, SideB.FrameRate);
+	const double Length = Options.bNormalizeTime
+		? FMath::Max(SideA.GetLength(), SideB.GetLength())
+		: FMath::Min(SideA.GetLength(), SideB.GetLength());
+	const int32 NumFrames = FMath::FloorToInt32(Length * FrameRate + 1e-4) + 1;
+	const int32 Stride = Align(NumFrames, 4);
+
+	double StepA = SideA.FrameRate / FrameRate;
+	double StepB = SideB.FrameRate / FrameRate;
+	if (Options.bNormalizeTime)
+	{
+		StepA = NumFrames > 1 ? double(A.GetNumFrames() - 1) / (NumFrames - 1) : 0.0;
+		StepB = NumFrames > 1 ? double(B.GetNumFrames() - 1) / (NumFrames - 1) : 0.0;
+	}
+
+	OutResult.FrameRate = FrameRate;
+	OutResult.NumFrames = NumFrames;
+
+	// ── Pair bones: same name first, then the target -> source mapping ──
+	TArray<FName> NamesB = B.BoneNames;
+	for (const FName& Track : B.TrackNames)
+	{
+		NamesB.AddUnique(Track);
+	}
+
+	TArray<FBonePair> Pairs;
+	TSet<FName> PairedA;
+	for (const FName& BoneB : NamesB)
+	{
+		FName BoneA = BoneB;
+		if (!SideA.Contains(BoneA))
+		{
+			const FName* Mapped = Options.BoneNameMapping.Find(BoneB);
+			BoneA = Mapped && SideA.Contains(*Mapped) ? *Mapped : NAME_None;
+		}
+
+		const bool bAnimatedB = SideB.TrackIndices.Contains(BoneB);
+		if (BoneA.IsNone())
+		{
+			if (bAnimatedB)
+			{
+				OutResult.UnmatchedB.Add(BoneB);
+			}
+			continue;
+		}
+
+		PairedA.Add(BoneA);
+		if (bAnimatedB || SideA.TrackIndices.Contains(BoneA))
+		{
+			Pairs.Add({ BoneA, BoneB });
+		}
+	}
+	for (const FName& Track : A.TrackNames)
+	{
+		if (!PairedA.Contains(Track))
+		{
+			OutResult.UnmatchedA.Add(Track);
+		}
+	}
+
+	if (Pairs.Num() == 0)
+	{
+		OutError = TEXT("No animated bones could be paired between the two animations");
+		return false;
+	}
+
+	// ── Per pair: resample both sides, then errors per frame ──
+	const int32 NumPairs = Pairs.Num();
+	const int64 BoneBlock = (int64)CompareChannels * Stride;
+	TArray<float> PositionErrors;
+	TArray<float> RotationErrors;
+	PositionErrors.SetNumZeroed(NumPairs * Stride);
+	RotationErrors.SetNumZeroed(NumPairs * Stride);
+	OutResult.Bones.SetNum(NumPairs);
+
+	ParallelFor(NumPairs, [&](int32 Pair)
+	{
+		TArray<float> Resampled;
+		Resampled.SetNumZeroed(BoneBlock * 2);
+		float* ResampledA = Resampled.GetData();
+		float* ResampledB = ResampledA + BoneBlock;
+		ResampleBone(SideA, Pairs[Pair].BoneA, StepA, NumFrames, Stride, ResampledA);
+		ResampleBone(SideB, Pairs[Pair].BoneB, StepB, NumFrames, Stride, ResampledB);
+
+		float* Position = PositionErrors.GetData() + (int64)Pair * Stride;
+		float* Rotation = RotationErrors.GetData() + (int64)Pair * Stride;
+		ComputeErrors(ResampledA, ResampledB, NumFrames, Stride, Position, Rotation);
+
+		FSLFBoneErrorStats& Stats = OutResult.Bones[Pair];
+		Stats.BoneA = Pairs[Pair].BoneA;
+		Stats.BoneB = Pairs[Pair].BoneB;
+		double PositionSum = 0.0;
+		double RotationSum = 0.0;
+		int32 WorstPositionFrame = 0;
+		int32 WorstRotationFrame = 0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			PositionSum += (double)Position[Frame] * Position[Frame];
+			RotationSum += (double)Rotation[Frame] * Rotation[Frame];
+			if (Position[Frame] > Stats.MaxPosition)
+			{
+				Stats.MaxPosition = Position[Frame];
+				WorstPositionFrame = Frame;
+			}
+			if (Rotation[Frame] > Stats.MaxRotationDegrees)
+			{
+				Stats.MaxRotationDegrees = Rotation[Frame];
+				WorstRotationFrame = Frame;
+			}
+		}
+		Stats.WorstFrame = Stats.MaxRotationDegrees > 0.0f ? WorstRotationFrame : WorstPositionFrame;
+		Stats.RmsPosition = (float)FMath::Sqrt(PositionSum / NumFrames);
+		Stats.RmsRotationDegrees = (float)FMath::Sqrt(RotationSum / NumFrames);
+	});
+
+	// ── Per frame: reduce across pairs, four frames at a time ──
+	TArray<float> FrameTotals;
+	FrameTotals.SetNumZeroed(Stride * 4);
+	float* MaxPosition = FrameTotals.GetData();
+	float* SumPosition = MaxPosition + Stride;
+	float* MaxRotation = SumPosition + Stride;
+	float* SumRotation = MaxRotation + Stride;
+	for (int32 Pair = 0; Pair < NumPairs; ++Pair)
+	{
+		const float* Position = PositionErrors.GetData() + (int64)Pair * Stride;
+		const float* Rotation = RotationErrors.GetData() + (int64)Pair * Stride;
+		for (int32 Frame = 0; Frame < Stride; Frame += 4)
+		{
+			const VectorRegister4Float PositionV = VectorLoad(Position + Frame);
+			const VectorRegister4Float RotationV = VectorLoad(Rotation + Frame);
+			VectorStore(VectorMax(VectorLoad(MaxPosition + Frame), PositionV), MaxPosition + Frame);
+			VectorStore(VectorMultiplyAdd(PositionV, PositionV, VectorLoad(SumPosition + Frame)), SumPosition + Frame);
+			VectorStore(VectorMax(VectorLoad(MaxRotation + Frame), RotationV), MaxRotation + Frame);
+			VectorStore(VectorMultiplyAdd(RotationV, RotationV, VectorLoad(SumRotation + Frame)), SumRotation + Frame);
+		}
+	}
+
+	OutResult.Frames.SetNum(NumFrames);
+	double TotalPosition = 0.0;
+	double TotalRotation = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		FSLFAnimErrorStats& Stats = OutResult.Frames[Frame];
+		Stats.MaxPosition = MaxPosition[Frame];
+		Stats.RmsPosition = FMath::Sqrt(SumPosition[Frame] / NumPairs);
+		Stats.MaxRotationDegrees = MaxRotation[Frame];
+		Stats.RmsRotationDegrees = FMath::Sqrt(SumRotation[Frame] / NumPairs);
+		TotalPosition += SumPosition[Frame];
+		TotalRotation += SumRotation[Frame];
+		OutResult.Overall.MaxPosition = FMath::Max(OutResult.Overall.MaxPosition, Stats.MaxPosition);
+		OutResult.Overall.MaxRotationDegrees = FMath::Max(OutResult.Overall.MaxRotationDegrees, Stats.MaxRotationDegrees);
+	}
+	const double NumSamples = (double)NumPairs * NumFrames;
+	OutResult.Overall.RmsPosition = (float)FMath::Sqrt(TotalPosition / NumSamples);
+	OutResult.Overall.RmsRotationDegrees = (float)FMath::Sqrt(TotalRotation / NumSamples);
+	return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// REPORTS
+// ═══════════════════════════════════════════════════════════════════════════════
+
+FString FSLFAnimComparisonResult::ToSummary(int32 NumWorstBones) const
+{
+	TArray<FString> Lines;
+	Lines.Add(FString::Printf(TEXT("Frames: %d @ %.2f fps, bones compared: %d (unmatched A: %d, B: %d)"),
+		NumFrames, FrameRate, Bones.Num(), UnmatchedA.Num(), UnmatchedB.Num()));
+	Lines.Add(FString::Printf(TEXT("Position error: max %.4f cm, RMS %.4f cm"), Overall.MaxPosition, Overall.RmsPosition));
+	Lines.Add(FString::Printf(TEXT("Rotation error: max %.3f deg, RMS %.3f deg"), Overall.MaxRotationDegrees, Overall.RmsRotationDegrees));
+
+	TArray<const FSLFBoneErrorStats*> Worst;
+	for (const FSLFBoneErrorStats& Bone : Bones)
+	{
+		Worst.Add(&Bone);
+	}
+	Worst.Sort([](const FSLFBoneErrorStats& L, const FSLFBoneErrorStats& R)
+	{
+		return L.MaxRotationDegrees != R.MaxRotationDegrees ? L.MaxRotationDegrees > R.MaxRotationDegrees : L.MaxPosition > R.MaxPosition;
+	});
+
+	const int32 NumShown = FMath::Min(NumWorstBones, Worst.Num());
+	if (NumShown > 0)
+	{
+		Lines.Add(TEXT("Worst bones:"));
+	}
+	for (int32 Index = 0; Index < NumShown; ++Index)
+	{
+		const FSLFBoneErrorStats& Bone = *Worst[Index];
+		Lines.Add(FString::Printf(TEXT("  %s -> %s: rot max %.3f / RMS %.3f deg, pos max %.4f / RMS %.4f cm (frame %d)"),
+			*Bone.BoneA.ToString(), *Bone.BoneB.ToString(),
+			Bone.MaxRotationDegrees, Bone.RmsRotationDegrees, Bone.MaxPosition, Bone.RmsPosition, Bone.WorstFrame));
+	}
+	return FString::Join(Lines, TEXT("\n"));
+}
+
+bool FSLFAnimComparison::SaveBoneCsv(const FSLFAnimComparisonResult& Result, const FString& Path)
+{
+	FString Csv = TEXT("bone_a,bone_b,max_pos,rms_pos,max_rot_deg,rms_rot_deg,worst_frame\n");
+	for (const FSLFBoneErrorStats& Bone : Result.Bones)
+	{
+		Csv += FString::Printf(TEXT("%s,%s,%.6f,%.6f,%.6f,%.6f,%d\n"),
+			*Bone.BoneA.ToString(), *Bone.BoneB.ToString(),
+			Bone.MaxPosition, Bone.RmsPosition, Bone.MaxRotationDegrees, Bone.RmsRotationDegrees, Bone.WorstFrame);
+	}
+	return FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+bool FSLFAnimComparison::SaveFrameCsv(const FSLFAnimComparisonResult& Result, const FString& Path)
+{
+	FString Csv = TEXT("frame,time,max_pos,rms_pos,max_rot_deg,rms_rot_deg\n");
+	for (int32 Frame = 0; Frame < Result.Frames.Num(); ++Frame)
+	{
+		const FSLFAnimErrorStats& Stats = Result.Frames[Frame];
+		Csv += FString::Printf(TEXT("%d,%.6f,%.6f,%.6f,%.6f,%.6f\n"),
+			Frame, Result.FrameRate > 0.0 ? Frame / Result.FrameRate : 0.0,
+			Stats.MaxPosition, Stats.RmsPosition, Stats.MaxRotationDegrees, Stats.RmsRotationDegrees);
+	}
+	return FFileHelper::SaveStringToFile(Csv, *Path);
+}
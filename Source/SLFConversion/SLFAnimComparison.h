@@ -0,0 +1,92 @@
+// SLFAnimComparison.h
+// Numeric comparison of two animations' bone tracks
+//
+// Both animations are resampled to one frame rate into the columnar layout of
+// FSLFAnimFrameDump, then every matched bone pair is compared four frames at a time
+// with vector registers: local position error (cm) and rotation error (degrees of
+// the relative rotation), reduced per bone and per frame to max and RMS. Bones are
+// paired by name, falling back to the target -> source name mapping that
+// BakeAnimWithBoneMapping takes, so a retargeted bake can be checked against its
+// source. Results are plain structs, with an optional CSV per bone and per frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSLFAnimFrameDump;
+
+struct FSLFAnimCompareOptions
+{
+	/** Common sample rate in frames per second (0 = the higher of the two animations' rates) */
+	double FrameRate = 0.0;
+
+	/** Sample both animations over their own length (for time-warped bakes) instead of in seconds */
+	bool bNormalizeTime = false;
+
+	/** B (target) bone name -> A (source) bone name, used when B's bone has no same-named bone in A */
+	TMap<FName, FName> BoneNameMapping;
+};
+
+struct FSLFAnimErrorStats
+{
+	float MaxPosition = 0.0f;
+	float RmsPosition = 0.0f;
+	float MaxRotationDegrees = 0.0f;
+	float RmsRotationDegrees = 0.0f;
+};
+
+struct FSLFBoneErrorStats : FSLFAnimErrorStats
+{
+	FName BoneA;
+	FName BoneB;
+
+	/** Frame with the largest rotation error (largest position error when rotations match) */
+	int32 WorstFrame = 0;
+};
+
+struct FSLFAnimComparisonResult
+{
+	FString AnimationA;
+	FString AnimationB;
+	double FrameRate = 0.0;
+	int32 NumFrames = 0;
+
+	/** One entry per compared bone pair, in B's bone order */
+	TArray<FSLFBoneErrorStats> Bones;
+
+	/** One entry per common frame, over all compared bones */
+	TArray<FSLFAnimErrorStats> Frames;
+
+	/** Over all bones and frames */
+	FSLFAnimErrorStats Overall;
+
+	/** Animated bones without a counterpart on the other skeleton */
+	TArray<FName> UnmatchedA;
+	TArray<FName> UnmatchedB;
+
+	bool IsWithin(float PositionTolerance, float RotationToleranceDegrees) const
+	{
+		return Overall.MaxPosition <= PositionTolerance && Overall.MaxRotationDegrees <= RotationToleranceDegrees;
+	}
+
+	/** Overall numbers plus the worst bones by rotation error */
+	FString ToSummary(int32 NumWorstBones = 10) const;
+};
+
+class SLFCONVERSION_API FSLFAnimComparison
+{
+public:
+	/**
+	 * Compare B against A. Bones without an animation track use their reference pose,
+	 * pairs where neither side is animated are skipped.
+	 * False (with OutError) when either dump is empty or no bones could be paired.
+	 */
+	static bool Compare(const FSLFAnimFrameDump& A, const FSLFAnimFrameDump& B, const FSLFAnimCompareOptions& Options,
+		FSLFAnimComparisonResult& OutResult, FString& OutError);
+
+	/** bone_a,bone_b,max_pos,rms_pos,max_rot_deg,rms_rot_deg,worst_frame */
+	static bool SaveBoneCsv(const FSLFAnimComparisonResult& Result, const FString& Path);
+
+	/** frame,time,max_pos,rms_pos,max_rot_deg,rms_rot_deg */
+	static bool SaveFrameCsv(const FSLFAnimComparisonResult& Result, const FString& Path);
+};
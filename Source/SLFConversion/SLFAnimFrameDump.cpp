@@ -0,0 +1,328 @@
+// SLFAnimFrameDump.cpp
+// Columnar per-frame bone transform dump of an AnimSequence
+
+#include "SLFAnimFrameDump.h"
+#include "HAL/FileManager.h"
+#include "Misc/StringBuilder.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+
+#if WITH_EDITOR
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataModel.h"
+#include "Animation/Skeleton.h"
+#include "Async/ParallelFor.h"
+#endif
+
+namespace
+{
+	/** JSON text is converted and written once this many characters are pending */
+	constexpr int32 JsonFlushThreshold = 64 * 1024;
+}
+
+void FSLFAnimFrameDump::Reset(int32 InNumFrames)
+{
+	NumFrames = FMath::Max(InNumFrames, 0);
+	Samples.SetNumUninitialized(TrackNames.Num() * NumChannels * NumFrames);
+	for (int32 Track = 0; Track < TrackNames.Num(); ++Track)
+	{
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			const bool bOne = Channel == (int32)ESLFAnimChannel::RotW || Channel >= (int32)ESLFAnimChannel::ScaleX;
+			float* Data = GetChannelData(Track, Channel);
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				Data[Frame] = bOne ? 1.0f : 0.0f;
+			}
+		}
+	}
+}
+
+TConstArrayView<float> FSLFAnimFrameDump::GetChannel(int32 Track, ESLFAnimChannel Channel) const
+{
+	check(TrackNames.IsValidIndex(Track) && Channel < ESLFAnimChannel::Num);
+	return TConstArrayView<float>(GetChannelData(Track, (int32)Channel), NumFrames);
+}
+
+FTransform FSLFAnimFrameDump::GetTransform(int32 Track, int32 Frame) const
+{
+	check(TrackNames.IsValidIndex(Track) && Frame >= 0 && Frame < NumFrames);
+	float Values[NumChannels];
+	for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+	{
+		Values[Channel] = GetChannelData(Track, Channel)[Frame];
+	}
+	return FTransform(
+		FQuat(Values[3], Values[4], Values[5], Values[6]),
+		FVector(Values[0], Values[1], Values[2]),
+		FVector(Values[7], Values[8], Values[9]));
+}
+
+void FSLFAnimFrameDump::SetTransform(int32 Track, int32 Frame, const FTransform& Transform)
+{
+	check(TrackNames.IsValidIndex(Track) && Frame >= 0 && Frame < NumFrames);
+	const FVector Position = Transform.GetTranslation();
+	const FQuat Rotation = Transform.GetRotation();
+	const FVector Scale = Transform.GetScale3D();
+	const double Values[NumChannels] =
+	{
+		Position.X, Position.Y, Position.Z,
+		Rotation.X, Rotation.Y, Rotation.Z, Rotation.W,
+		Scale.X, Scale.Y, Scale.Z
+	};
+	for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+	{
+		GetChannelData(Track, Channel)[Frame] = (float)Values[Channel];
+	}
+}
+
+#if WITH_EDITOR
+bool FSLFAnimFrameDump::Sample(const UAnimSequence& Anim, FString& OutError)
+{
+	const USkeleton* Skeleton = Anim.GetSkeleton();
+	if (!Skeleton)
+	{
+		OutError = TEXT("Animation has no skeleton");
+		return false;
+	}
+
+	const IAnimationDataModel* DataModel = Anim.GetDataModel();
+	if (!DataModel)
+	{
+		OutError = TEXT("Animation has no DataModel");
+		return false;
+	}
+
+	AnimationPath = Anim.GetPathName();
+	SkeletonPath = Skeleton->GetPathName();
+	Duration = Anim.GetPlayLength();
+	FrameRate = DataModel->GetFrameRate();
+
+	const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+	const int32 NumBones = RefSkeleton.GetNum();
+	BoneNames.Reset(NumBones);
+	ParentIndices.Reset(NumBones);
+	for (int32 Bone = 0; Bone < NumBones; ++Bone)
+	{
+		BoneNames.Add(RefSkeleton.GetBoneName(Bone));
+		ParentIndices.Add(RefSkeleton.GetParentIndex(Bone));
+	}
+	RefPose = RefSkeleton.GetRefBonePose();
+
+	TrackNames.Reset();
+	DataModel->GetBoneTrackNames(TrackNames);
+	Reset(DataModel->GetNumberOfFrames());
+
+	// The data model is a UObject and is only read here, on the calling thread: copy every
+	// track's keys first (evaluating frames past the last key), then convert in parallel
+	TArray<TArray<FTransform>> TrackKeys;
+	TrackKeys.SetNum(TrackNames.Num());
+	for (int32 Track = 0; Track < TrackNames.Num(); ++Track)
+	{
+		TArray<FTransform>& Keys = TrackKeys[Track];
+		DataModel->GetBoneTrackTransforms(TrackNames[Track], Keys);
+		for (int32 Frame = Keys.Num(); Frame < NumFrames; ++Frame)
+		{
+			Keys.Add(DataModel->GetBoneTrackTransform(TrackNames[Track], FFrameNumber(Frame)));
+		}
+	}
+
+	// Each task writes only its own track's channel rows
+	ParallelFor(TrackNames.Num(), [this, &TrackKeys](int32 Track)
+	{
+		const TArray<FTransform>& Keys = TrackKeys[Track];
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			SetTransform(Track, Frame, Keys[Frame]);
+		}
+	});
+
+	return true;
+}
+#endif // WITH_EDITOR
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// FILES
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void FSLFAnimFrameDump::Serialize(FArchive& Ar)
+{
+	uint32 FileMagic = Magic;
+	int32 FileVersion = Version;
+	int32 FileChannels = NumChannels;
+	Ar << FileMagic;
+	Ar << FileVersion;
+	Ar << FileChannels;
+	if (Ar.IsLoading() && (FileMagic != Magic || FileVersion != Version || FileChannels != NumChannels))
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << AnimationPath;
+	Ar << SkeletonPath;
+	Ar << Duration;
+	Ar << FrameRate.Numerator;
+	Ar << FrameRate.Denominator;
+	Ar << NumFrames;
+	Ar << BoneNames;
+	Ar << ParentIndices;
+	Ar << RefPose;
+	Ar << TrackNames;
+
+	// Raw float block; the count is checked against the header and the bytes left before allocating
+	int64 NumSamples = Samples.Num();
+	Ar << NumSamples;
+	if (Ar.IsLoading())
+	{
+		const int64 Expected = (int64)TrackNames.Num() * NumChannels * NumFrames;
+		if (Ar.IsError() || NumFrames < 0 || NumSamples != Expected
+			|| NumSamples * (int64)sizeof(float) > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return;
+		}
+		Samples.SetNumUninitialized((int32)NumSamples);
+	}
+	Ar.Serialize(Samples.GetData(), NumSamples * sizeof(float));
+}
+
+bool FSLFAnimFrameDump::Save(const FString& Path) const
+{
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*Path));
+	if (!FileWriter)
+	{
+		return false;
+	}
+
+	// Serialize is symmetric; saving does not modify the dump
+	FNameAsStringProxyArchive Ar(*FileWriter);
+	const_cast<FSLFAnimFrameDump*>(this)->Serialize(Ar);
+	return FileWriter->Close() && !Ar.IsError();
+}
+
+bool FSLFAnimFrameDump::Load(const FString& Path, FString* OutError)
+{
+	*this = FSLFAnimFrameDump();
+
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*Path));
+	if (!FileReader)
+	{
+		if (OutError)
+		{
+			*OutError = FString::Printf(TEXT("Could not open %s"), *Path);
+		}
+		return false;
+	}
+
+	FNameAsStringProxyArchive Ar(*FileReader);
+	Serialize(Ar);
+	if (Ar.IsError())
+	{
+		if (OutError)
+		{
+			*OutError = FString::Printf(TEXT("%s is not a version %d animation dump or is truncated"), *Path, Version);
+		}
+		*this = FSLFAnimFrameDump();
+		return false;
+	}
+	return true;
+}
+
+bool FSLFAnimFrameDump::SaveAsJson(const FString& Path) const
+{
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*Path));
+	if (!FileWriter)
+	{
+		return false;
+	}
+
+	TStringBuilder<1024> Json;
+	auto Flush = [&Json, &FileWriter]()
+	{
+		const FTCHARToUTF8 Converted(Json.GetData(), Json.Len());
+		FileWriter->Serialize(const_cast<void*>(static_cast<const void*>(Converted.Get())), Converted.Length());
+		Json.Reset();
+	};
+	auto FlushIfFull = [&Json, &Flush]()
+	{
+		if (Json.Len() >= JsonFlushThreshold)
+		{
+			Flush();
+		}
+	};
+	auto AppendTransform = [&Json](const FTransform& Transform)
+	{
+		const FVector Pos = Transform.GetTranslation();
+		const FQuat Rot = Transform.GetRotation();
+		const FVector Scale = Transform.GetScale3D();
+		Json.Appendf(TEXT("\"pos\": [%.8f, %.8f, %.8f], \"rot\": [%.8f, %.8f, %.8f, %.8f], \"scale\": [%.8f, %.8f, %.8f]}"),
+			Pos.X, Pos.Y, Pos.Z, Rot.X, Rot.Y, Rot.Z, Rot.W, Scale.X, Scale.Y, Scale.Z);
+	};
+
+	const int32 NumBones = BoneNames.Num();
+	Json << TEXT("{\n");
+	Json.Appendf(TEXT("  \"animation\": \"%s\",\n"), *AnimationPath);
+	Json.Appendf(TEXT("  \"skeleton\": \"%s\",\n"), *SkeletonPath);
+	Json.Appendf(TEXT("  \"bone_count\": %d,\n"), NumBones);
+	Json.Appendf(TEXT("  \"track_count\": %d,\n"), TrackNames.Num());
+	Json.Appendf(TEXT("  \"frame_count\": %d,\n"), NumFrames);
+	Json.Appendf(TEXT("  \"duration\": %.6f,\n"), Duration);
+	Json.Appendf(TEXT("  \"frame_rate_num\": %d,\n"), FrameRate.Numerator);
+	Json.Appendf(TEXT("  \"frame_rate_den\": %d,\n"), FrameRate.Denominator);
+
+	Json << TEXT("  \"bones\": [\n");
+	for (int32 Bone = 0; Bone < NumBones; ++Bone)
+	{
+		Json.Appendf(TEXT("    {\"index\": %d, \"name\": \"%s\", \"parent\": %d}%s\n"),
+			Bone, *BoneNames[Bone].ToString(), ParentIndices[Bone], Bone < NumBones - 1 ? TEXT(",") : TEXT(""));
+		FlushIfFull();
+	}
+	Json << TEXT("  ],\n");
+
+	Json << TEXT("  \"ref_pose\": [\n");
+	for (int32 Bone = 0; Bone < NumBones && Bone < RefPose.Num(); ++Bone)
+	{
+		Json.Appendf(TEXT("    {\"bone\": \"%s\", "), *BoneNames[Bone].ToString());
+		AppendTransform(RefPose[Bone]);
+		Json << (Bone < NumBones - 1 ? TEXT(",\n") : TEXT("\n"));
+		FlushIfFull();
+	}
+	Json << TEXT("  ],\n");
+
+	Json << TEXT("  \"track_names\": [\n");
+	for (int32 Track = 0; Track < TrackNames.Num(); ++Track)
+	{
+		Json.Appendf(TEXT("    \"%s\"%s\n"), *TrackNames[Track].ToString(), Track < TrackNames.Num() - 1 ? TEXT(",") : TEXT(""));
+	}
+	Json << TEXT("  ],\n");
+
+	// Track names are formatted once, not once per frame
+	TArray<FString> TrackPrefixes;
+	TrackPrefixes.Reserve(TrackNames.Num());
+	for (const FName& TrackName : TrackNames)
+	{
+		TrackPrefixes.Add(FString::Printf(TEXT("        \"%s\": {"), *TrackName.ToString()));
+	}
+
+	Json << TEXT("  \"frames\": [\n");
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		Json << TEXT("    {\n");
+		Json.Appendf(TEXT("      \"frame\": %d,\n"), Frame);
+		Json << TEXT("      \"bones\": {\n");
+		for (int32 Track = 0; Track < TrackNames.Num(); ++Track)
+		{
+			Json << TrackPrefixes[Track];
+			AppendTransform(GetTransform(Track, Frame));
+			Json << (Track < TrackNames.Num() - 1 ? TEXT(",\n") : TEXT("\n"));
+			FlushIfFull();
+		}
+		Json << TEXT("      }\n");
+		Json << (Frame < NumFrames - 1 ? TEXT("    },\n") : TEXT("    }\n"));
+	}
+	Json << TEXT("  ]\n");
+	Json << TEXT("}\n");
+	Flush();
+
+	return FileWriter->Close();
+}
@@ -0,0 +1,95 @@
+// SLFAnimFrameDump.h
+// Columnar per-frame bone transform dump of an AnimSequence
+//
+// Every bone track is sampled at every frame (keys read on the calling thread, then
+// converted in parallel) into
+// float32 channel arrays: for each track, ten contiguous arrays of NumFrames values
+// (position xyz, rotation quaternion xyzw, scale xyz). The binary file is a small
+// header (magic, version, frame count/rate, bone names, parents, ref pose, track
+// names) followed by the sample block as raw little-endian float32, so dumping and
+// comparing hundreds of retargeted animations is bound by I/O rather than by
+// number formatting. The JSON layout written by DumpAnimAllFrames is still
+// available as a converter (SaveAsJson).
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAnimSequence;
+
+/** Sample channels, in storage order */
+enum class ESLFAnimChannel : uint8
+{
+	PosX,
+	PosY,
+	PosZ,
+	RotX,
+	RotY,
+	RotZ,
+	RotW,
+	ScaleX,
+	ScaleY,
+	ScaleZ,
+	Num
+};
+
+class SLFCONVERSION_API FSLFAnimFrameDump
+{
+public:
+	static constexpr uint32 Magic = 0x41464C53; // "SLFA"
+	static constexpr int32 Version = 1;
+	static constexpr int32 NumChannels = (int32)ESLFAnimChannel::Num;
+
+	FString AnimationPath;
+	FString SkeletonPath;
+	double Duration = 0.0;
+	FFrameRate FrameRate;
+
+	/** Reference skeleton (all bones, animated or not) */
+	TArray<FName> BoneNames;
+	TArray<int32> ParentIndices;
+	TArray<FTransform> RefPose;
+
+	/** Bones that have animation data, in data model order (sample rows) */
+	TArray<FName> TrackNames;
+
+#if WITH_EDITOR
+	/** Fill from an AnimSequence's data model (game thread); keys are converted with one ParallelFor task per track */
+	bool Sample(const UAnimSequence& Anim, FString& OutError);
+#endif
+
+	/** Size the sample block for TrackNames.Num() x InNumFrames (identity transforms) */
+	void Reset(int32 InNumFrames);
+
+	int32 GetNumFrames() const { return NumFrames; }
+	int32 FindTrack(FName TrackName) const { return TrackNames.IndexOfByKey(TrackName); }
+
+	/** NumFrames values of one channel of one track */
+	TConstArrayView<float> GetChannel(int32 Track, ESLFAnimChannel Channel) const;
+
+	FTransform GetTransform(int32 Track, int32 Frame) const;
+	void SetTransform(int32 Track, int32 Frame, const FTransform& Transform);
+
+	// ═══════════════════════════════════════════════════════════════════
+	// FILES
+	// ═══════════════════════════════════════════════════════════════════
+
+	bool Save(const FString& Path) const;
+
+	/** False (dump left empty) on a missing file, another version or a truncated sample block */
+	bool Load(const FString& Path, FString* OutError = nullptr);
+
+	/** Same layout as the original DumpAnimAllFrames JSON, written in chunks */
+	bool SaveAsJson(const FString& Path) const;
+
+private:
+	void Serialize(FArchive& Ar);
+
+	float* GetChannelData(int32 Track, int32 Channel) { return Samples.GetData() + ((int64)Track * NumChannels + Channel) * NumFrames; }
+	const float* GetChannelData(int32 Track, int32 Channel) const { return Samples.GetData() + ((int64)Track * NumChannels + Channel) * NumFrames; }
+
+	int32 NumFrames = 0;
+
+	/** [Track][Channel][Frame] */
+	TArray<float> Samples;
+};
@@ -0,0 +1,662 @@
+// SLFAssetDependencyGraph.cpp
+// In-memory package dependency graph for migration queries
+
+#include "SLFAssetDependencyGraph.h"
+
+#if WITH_EDITOR
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+
+namespace
+{
+	constexpr uint32 SnapshotMagic = 0x47464C53; // "SLFG"
+
+	IAssetRegistry& GetAssetRegistry()
+	{
+		return FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	}
+
+	FIoHash GetSavedHash(IAssetRegistry& AssetRegistry, FName PackageName)
+	{
+		const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+		return PackageData.IsSet() ? PackageData->GetPackageSavedHash() : FIoHash::Zero;
+	}
+
+	bool IsValidIndex(int32 Index, int32 Num, bool bAllowNone)
+	{
+		return (bAllowNone && Index == INDEX_NONE) || (Index >= 0 && Index < Num);
+	}
+}
+
+FSLFAssetDependencyGraph& FSLFAssetDependencyGraph::Get()
+{
+	// Never deleted: registry delegates are unbound at engine pre-exit instead of from a static destructor
+	static FSLFAssetDependencyGraph* Graph = nullptr;
+	if (!Graph)
+	{
+		Graph = new FSLFAssetDependencyGraph();
+
+		// While the registry is still scanning, a snapshot answers queries and OnFilesLoaded reconciles it
+		const bool bLoadedSnapshot = Graph->LoadSnapshot(GetDefaultSnapshotPath());
+		const bool bRegistryReady = !GetAssetRegistry().IsLoadingAssets();
+		if (!bLoadedSnapshot || bRegistryReady)
+		{
+			Graph->Reconcile();
+		}
+		if (bRegistryReady && Graph->IsDirty())
+		{
+			Graph->SaveSnapshot(GetDefaultSnapshotPath());
+		}
+
+		Graph->BindRegistryEvents();
+		FCoreDelegates::OnEnginePreExit.AddLambda([]()
+		{
+			if (Graph->IsDirty())
+			{
+				Graph->SaveSnapshot(GetDefaultSnapshotPath());
+			}
+			Graph->UnbindRegistryEvents();
+		});
+	}
+	return *Graph;
+}
+
+FString FSLFAssetDependencyGraph::GetDefaultSnapshotPath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SLFAssetGraph"), TEXT("AssetDependencyGraph.bin"));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// BUILDING
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void FSLFAssetDependencyGraph::Reset()
+{
+	NodeNames.Reset();
+	Dependencies.Reset();
+	Referencers.Reset();
+	SavedHashes.Reset();
+	NodeIds.Reset();
+
+	ClassNames.Reset();
+	ClassParents.Reset();
+	ClassChildren.Reset();
+	ClassPackages.Reset();
+	ClassIds.Reset();
+	PackageClasses.Reset();
+
+	bDirty = true;
+}
+
+void FSLFAssetDependencyGraph::BuildFromRegistry()
+{
+	Reset();
+	Reconcile();
+}
+
+int32 FSLFAssetDependencyGraph::Reconcile()
+{
+	const double StartTime = FPlatformTime::Seconds();
+	IAssetRegistry& AssetRegistry = GetAssetRegistry();
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAllAssets(Assets, true);
+
+	TSet<FName> Packages;
+	Packages.Reserve(Assets.Num());
+	for (const FAssetData& Asset : Assets)
+	{
+		Packages.Add(Asset.PackageName);
+	}
+
+	int32 NumChanged = 0;
+	for (const FName PackageName : Packages)
+	{
+		const int32 Node = FindNode(PackageName);
+		const FIoHash SavedHash = GetSavedHash(AssetRegistry, PackageName);
+		if (Node == INDEX_NONE || SavedHash.IsZero() || SavedHashes[Node] != SavedHash)
+		{
+			RefreshPackage(PackageName);
+			++NumChanged;
+		}
+	}
+
+	// Nodes with a recorded hash were real packages; the rest are script packages or missing dependencies
+	for (int32 Node = 0; Node < NodeNames.Num(); ++Node)
+	{
+		if (!SavedHashes[Node].IsZero() && !Packages.Contains(NodeNames[Node]))
+		{
+			RemovePackage(NodeNames[Node]);
+			++NumChanged;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("SLFAssetDependencyGraph: Reconciled %d of %d packages (%d nodes, %d classes) in %.1f ms"),
+		NumChanged, Packages.Num(), NodeNames.Num(), ClassNames.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return NumChanged;
+}
+
+void FSLFAssetDependencyGraph::RefreshPackage(FName PackageName)
+{
+	IAssetRegistry& AssetRegistry = GetAssetRegistry();
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByPackageName(PackageName, Assets, false);
+	if (Assets.Num() == 0)
+	{
+		RemovePackage(PackageName);
+		return;
+	}
+
+	TArray<FName> PackageDependencies;
+	AssetRegistry.GetDependencies(PackageName, PackageDependencies, UE::AssetRegistry::EDependencyCategory::Package);
+	SetDependencies(PackageName, PackageDependencies);
+
+	const int32 Node = FindNode(PackageName);
+	SavedHashes[Node] = GetSavedHash(AssetRegistry, PackageName);
+
+	for (const FAssetData& Asset : Assets)
+	{
+		FString GeneratedClassPath;
+		if (Asset.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassPath))
+		{
+			FString ParentClassPath;
+			Asset.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassPath);
+
+			SetBlueprintClass(PackageName,
+				FName(*FPackageName::ExportTextPathToObjectPath(GeneratedClassPath)),
+				ParentClassPath.IsEmpty() ? NAME_None : FName(*FPackageName::ExportTextPathToObjectPath(ParentClassPath)));
+			return;
+		}
+	}
+	ClearBlueprintClass(Node);
+}
+
+void FSLFAssetDependencyGraph::RemovePackage(FName PackageName)
+{
+	const int32 Node = FindNode(PackageName);
+	if (Node == INDEX_NONE)
+	{
+		return;
+	}
+
+	// The node itself stays: referencers that were not resaved still point at it
+	SetOutgoing(Node, TArray<int32>());
+	ClearBlueprintClass(Node);
+	SavedHashes[Node] = FIoHash::Zero;
+	bDirty = true;
+}
+
+void FSLFAssetDependencyGraph::SetDependencies(FName PackageName, const TArray<FName>& InDependencies)
+{
+	const int32 Node = FindOrAddNode(PackageName);
+
+	TArray<int32> NewDependencies;
+	NewDependencies.Reserve(InDependencies.Num());
+	for (const FName Dependency : InDependencies)
+	{
+		if (Dependency != PackageName)
+		{
+			NewDependencies.AddUnique(FindOrAddNode(Dependency));
+		}
+	}
+	SetOutgoing(Node, MoveTemp(NewDependencies));
+}
+
+void FSLFAssetDependencyGraph::SetOutgoing(int32 Node, TArray<int32>&& NewDependencies)
+{
+	if (Dependencies[Node] == NewDependencies)
+	{
+		return;
+	}
+
+	for (const int32 Old : Dependencies[Node])
+	{
+		Referencers[Old].RemoveSingleSwap(Node, EAllowShrinking::No);
+	}
+	for (const int32 New : NewDependencies)
+	{
+		Referencers[New].Add(Node);
+	}
+	Dependencies[Node] = MoveTemp(NewDependencies);
+	bDirty = true;
+}
+
+int32 FSLFAssetDependencyGraph::FindNode(FName PackageName) const
+{
+	const int32* Node = NodeIds.Find(PackageName);
+	return Node ? *Node : INDEX_NONE;
+}
+
+int32 FSLFAssetDependencyGraph::FindOrAddNode(FName PackageName)
+{
+	if (const int32* Existing = NodeIds.Find(PackageName))
+	{
+		return *Existing;
+	}
+
+	const int32 Node = NodeNames.Add(PackageName);
+	Dependencies.AddDefaulted();
+	Referencers.AddDefaulted();
+	SavedHashes.Add(FIoHash::Zero);
+	NodeIds.Add(PackageName, Node);
+	bDirty = true;
+	return Node;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// CLASS HIERARCHY
+// ═══════════════════════════════════════════════════════════════════════════════
+
+int32 FSLFAssetDependencyGraph::FindOrAddClass(FName ClassPath)
+{
+	if (const int32* Existing = ClassIds.Find(ClassPath))
+	{
+		return *Existing;
+	}
+
+	const int32 Class = ClassNames.Add(ClassPath);
+	ClassParents.Add(INDEX_NONE);
+	ClassChildren.AddDefaulted();
+	ClassPackages.Add(INDEX_NONE);
+	ClassIds.Add(ClassPath, Class);
+	bDirty = true;
+
+	// Native parents carry no registry tags, so walk the loaded class instead
+	if (ClassPath.ToString().StartsWith(TEXT("/Script/")))
+	{
+		const UClass* NativeClass = FindObject<UClass>(nullptr, *ClassPath.ToString());
+		if (const UClass* Super = NativeClass ? NativeClass->GetSuperClass() : nullptr)
+		{
+			const int32 Parent = FindOrAddClass(FName(*Super->GetClassPathName().ToString()));
+			ClassParents[Class] = Parent;
+			ClassChildren[Parent].Add(Class);
+		}
+	}
+	return Class;
+}
+
+void FSLFAssetDependencyGraph::DetachClass(int32 Class)
+{
+	const int32 Parent = ClassParents[Class];
+	if (Parent != INDEX_NONE)
+	{
+		ClassChildren[Parent].RemoveSingleSwap(Class, EAllowShrinking::No);
+		ClassParents[Class] = INDEX_NONE;
+		bDirty = true;
+	}
+}
+
+void FSLFAssetDependencyGraph::ClearBlueprintClass(int32 Node)
+{
+	int32 Class = INDEX_NONE;
+	if (PackageClasses.RemoveAndCopyValue(Node, Class))
+	{
+		// Child classes keep their link: their own tags still name this class as parent
+		DetachClass(Class);
+		ClassPackages[Class] = INDEX_NONE;
+		bDirty = true;
+	}
+}
+
+void FSLFAssetDependencyGraph::SetBlueprintClass(FName PackageName, FName ClassPath, FName ParentClassPath)
+{
+	const int32 Node = FindOrAddNode(PackageName);
+
+	const int32* Previous = PackageClasses.Find(Node);
+	if (Previous && ClassNames[*Previous] != ClassPath)
+	{
+		ClearBlueprintClass(Node);
+	}
+
+	const int32 Class = FindOrAddClass(ClassPath);
+	const int32 Parent = ParentClassPath.IsNone() ? INDEX_NONE : FindOrAddClass(ParentClassPath);
+	if (ClassParents[Class] != Parent && Parent != Class)
+	{
+		DetachClass(Class);
+		ClassParents[Class] = Parent;
+		if (Parent != INDEX_NONE)
+		{
+			ClassChildren[Parent].Add(Class);
+		}
+		bDirty = true;
+	}
+
+	if (ClassPackages[Class] != Node)
+	{
+		ClassPackages[Class] = Node;
+		PackageClasses.Add(Node, Class);
+		bDirty = true;
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// QUERIES
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TArray<FName> FSLFAssetDependencyGraph::GetDependencies(FName PackageName) const
+{
+	TArray<FName> Result;
+	const int32 Node = FindNode(PackageName);
+	if (Node != INDEX_NONE)
+	{
+		Result.Reserve(Dependencies[Node].Num());
+		for (const int32 Dependency : Dependencies[Node])
+		{
+			Result.Add(NodeNames[Dependency]);
+		}
+	}
+	return Result;
+}
+
+TArray<FName> FSLFAssetDependencyGraph::GetReferencers(FName PackageName) const
+{
+	TArray<FName> Result;
+	const int32 Node = FindNode(PackageName);
+	if (Node != INDEX_NONE)
+	{
+		Result.Reserve(Referencers[Node].Num());
+		for (const int32 Referencer : Referencers[Node])
+		{
+			Result.Add(NodeNames[Referencer]);
+		}
+	}
+	return Result;
+}
+
+TArray<FName> FSLFAssetDependencyGraph::Closure(const TArray<FName>& Roots, bool bReverse, bool bIncludeRoots) const
+{
+	const TArray<TArray<int32>>& Edges = bReverse ? Referencers : Dependencies;
+
+	TBitArray<> Visited(false, NodeNames.Num());
+	TArray<int32> Queue;
+	for (const FName Root : Roots)
+	{
+		const int32 Node = FindNode(Root);
+		if (Node != INDEX_NONE && !Visited[Node])
+		{
+			Visited[Node] = true;
+			Queue.Add(Node);
+		}
+	}
+	const int32 NumRoots = Queue.Num();
+
+	// Breadth-first; the queue doubles as the visit order
+	for (int32 Head = 0; Head < Queue.Num(); ++Head)
+	{
+		for (const int32 Next : Edges[Queue[Head]])
+		{
+			if (!Visited[Next])
+			{
+				Visited[Next] = true;
+				Queue.Add(Next);
+			}
+		}
+	}
+
+	TArray<FName> Result;
+	const int32 First = bIncludeRoots ? 0 : NumRoots;
+	Result.Reserve(Queue.Num() - First);
+	for (int32 Index = First; Index < Queue.Num(); ++Index)
+	{
+		Result.Add(NodeNames[Queue[Index]]);
+	}
+	return Result;
+}
+
+TArray<FName> FSLFAssetDependencyGraph::GetTransitiveDependencies(const TArray<FName>& Roots) const
+{
+	return Closure(Roots, false, false);
+}
+
+TArray<FName> FSLFAssetDependencyGraph::GetTransitiveReferencers(const TArray<FName>& Roots) const
+{
+	return Closure(Roots, true, false);
+}
+
+TArray<FName> FSLFAssetDependencyGraph::GetImpactSet(const TArray<FName>& Changed) const
+{
+	return Closure(Changed, true, true);
+}
+
+TArray<FName> FSLFAssetDependencyGraph::GetChildBlueprintPackages(FName ClassPath) const
+{
+	TArray<FName> Result;
+	const int32* Root = ClassIds.Find(ClassPath);
+	if (!Root)
+	{
+		return Result;
+	}
+
+	TBitArray<> Visited(false, ClassNames.Num());
+	TArray<int32> Queue = { *Root };
+	Visited[*Root] = true;
+	for (int32 Head = 0; Head < Queue.Num(); ++Head)
+	{
+		const int32 Class = Queue[Head];
+		if (ClassPackages[Class] != INDEX_NONE)
+		{
+			Result.Add(NodeNames[ClassPackages[Class]]);
+		}
+		for (const int32 Child : ClassChildren[Class])
+		{
+			if (!Visited[Child])
+			{
+				Visited[Child] = true;
+				Queue.Add(Child);
+			}
+		}
+	}
+	return Result;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// REGISTRY EVENTS
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void FSLFAssetDependencyGraph::BindRegistryEvents()
+{
+	UnbindRegistryEvents();
+
+	IAssetRegistry& AssetRegistry = GetAssetRegistry();
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FSLFAssetDependencyGraph::HandleAssetChanged);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FSLFAssetDependencyGraph::HandleAssetChanged);
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FSLFAssetDependencyGraph::HandleAssetChanged);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FSLFAssetDependencyGraph::HandleAssetRenamed);
+	FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FSLFAssetDependencyGraph::HandleFilesLoaded);
+}
+
+void FSLFAssetDependencyGraph::UnbindRegistryEvents()
+{
+	FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry");
+	if (!AssetRegistryModule)
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+	AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+	AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+	AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+	AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+	AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+}
+
+void FSLFAssetDependencyGraph::HandleAssetChanged(const FAssetData& AssetData)
+{
+	// The initial scan fires this for every asset; OnFilesLoaded reconciles once instead
+	if (GetAssetRegistry().IsLoadingAssets())
+	{
+		return;
+	}
+	RefreshPackage(AssetData.PackageName);
+}
+
+void FSLFAssetDependencyGraph::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (GetAssetRegistry().IsLoadingAssets())
+	{
+		return;
+	}
+
+	// The old package may survive as a redirector, so both ends are re-read rather than re-keyed
+	RefreshPackage(AssetData.PackageName);
+	RefreshPackage(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+}
+
+void FSLFAssetDependencyGraph::HandleFilesLoaded()
+{
+	Reconcile();
+	if (bDirty)
+	{
+		SaveSnapshot(GetDefaultSnapshotPath());
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// SNAPSHOT
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void FSLFAssetDependencyGraph::Serialize(FArchive& Ar)
+{
+	// Reverse edges, children and the lookup maps are derived, so only the forward data is stored
+	Ar << NodeNames;
+	Ar << Dependencies;
+	Ar << SavedHashes;
+	Ar << ClassNames;
+	Ar << ClassParents;
+	Ar << ClassPackages;
+}
+
+bool FSLFAssetDependencyGraph::SaveSnapshot(const FString& Path)
+{
+	const FString TempPath = Path + TEXT(".tmp");
+	{
+		TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*TempPath));
+		if (!FileWriter)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SLFAssetDependencyGraph: Could not write %s"), *TempPath);
+			return false;
+		}
+
+		FNameAsStringProxyArchive Ar(*FileWriter);
+		uint32 Magic = SnapshotMagic;
+		int32 Version = SnapshotVersion;
+		Ar << Magic;
+		Ar << Version;
+		Serialize(Ar);
+
+		if (!FileWriter->Close())
+		{
+			return false;
+		}
+	}
+
+	if (!IFileManager::Get().Move(*Path, *TempPath, true, true))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SLFAssetDependencyGraph: Could not replace %s"), *Path);
+		return false;
+	}
+
+	bDirty = false;
+	return true;
+}
+
+bool FSLFAssetDependencyGraph::LoadSnapshot(const FString& Path)
+{
+	Reset();
+
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*Path));
+	if (!FileReader)
+	{
+		return false;
+	}
+
+	FNameAsStringProxyArchive Ar(*FileReader);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Ar << Magic;
+	Ar << Version;
+	if (Magic != SnapshotMagic || Version != SnapshotVersion)
+	{
+		UE_LOG(LogTemp, Log, TEXT("SLFAssetDependencyGraph: Ignoring snapshot %s (version %d, expected %d)"), *Path, Version, SnapshotVersion);
+		return false;
+	}
+
+	Serialize(Ar);
+
+	// A truncated or hand-edited file must not leave out-of-range ids behind
+	bool bValid = !Ar.IsError()
+		&& Dependencies.Num() == NodeNames.Num() && SavedHashes.Num() == NodeNames.Num()
+		&& ClassParents.Num() == ClassNames.Num() && ClassPackages.Num() == ClassNames.Num();
+	for (int32 Node = 0; bValid && Node < Dependencies.Num(); ++Node)
+	{
+		for (const int32 Dependency : Dependencies[Node])
+		{
+			bValid &= IsValidIndex(Dependency, NodeNames.Num(), false);
+		}
+	}
+	for (int32 Class = 0; bValid && Class < ClassNames.Num(); ++Class)
+	{
+		bValid &= IsValidIndex(ClassParents[Class], ClassNames.Num(), true)
+			&& IsValidIndex(ClassPackages[Class], NodeNames.Num(), true);
+	}
+
+	if (!bValid)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SLFAssetDependencyGraph: Snapshot %s is corrupt, rebuilding"), *Path);
+		Reset();
+		return false;
+	}
+
+	RebuildIndices();
+	bDirty = false;
+	return true;
+}
+
+void FSLFAssetDependencyGraph::RebuildIndices()
+{
+	NodeIds.Reset();
+	NodeIds.Reserve(NodeNames.Num());
+	Referencers.SetNum(NodeNames.Num());
+	for (int32 Node = 0; Node < NodeNames.Num(); ++Node)
+	{
+		NodeIds.Add(NodeNames[Node], Node);
+		Referencers[Node].Reset();
+	}
+	for (int32 Node = 0; Node < NodeNames.Num(); ++Node)
+	{
+		for (const int32 Dependency : Dependencies[Node])
+		{
+			Referencers[Dependency].Add(Node);
+		}
+	}
+
+	ClassIds.Reset();
+	PackageClasses.Reset();
+	ClassChildren.SetNum(ClassNames.Num());
+	for (int32 Class = 0; Class < ClassNames.Num(); ++Class)
+	{
+		ClassIds.Add(ClassNames[Class], Class);
+		ClassChildren[Class].Reset();
+	}
+	for (int32 Class = 0; Class < ClassNames.Num(); ++Class)
+	{
+		if (ClassParents[Class] != INDEX_NONE)
+		{
+			ClassChildren[ClassParents[Class]].Add(Class);
+		}
+		if (ClassPackages[Class] != INDEX_NONE)
+		{
+			PackageClasses.Add(ClassPackages[Class], Class);
+		}
+	}
+}
+
+#endif // WITH_EDITOR
@@ -0,0 +1,136 @@
+// SLFAssetDependencyGraph.h
+// In-memory package dependency graph for migration queries
+//
+// Built once from the asset registry and then kept current from its add / remove /
+// rename / update events. Packages are dense int32 node ids with adjacency lists in
+// both directions, and Blueprint parent-class tags feed a class-hierarchy index, so
+// dependency, referencer, closure and child-Blueprint queries neither go back to the
+// registry nor load assets. A snapshot in Saved/SLFAssetGraph lets the next editor
+// session answer queries before the registry scan finishes; once it has finished,
+// only packages whose saved hash changed are re-read.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IO/IoHash.h"
+
+struct FAssetData;
+
+class SLFCONVERSION_API FSLFAssetDependencyGraph
+{
+public:
+	static constexpr int32 SnapshotVersion = 1;
+
+	/** Shared graph: loaded from the snapshot (or built) on first use, then kept current from registry events */
+	static FSLFAssetDependencyGraph& Get();
+
+	static FString GetDefaultSnapshotPath();
+
+	// ═══════════════════════════════════════════════════════════════════
+	// BUILDING
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Drop everything and read every on-disk package from the registry */
+	void BuildFromRegistry();
+
+	/**
+	 * Bring the graph in line with the registry: re-read packages whose saved hash
+	 * differs from the recorded one and remove packages that are gone.
+	 * Returns the number of packages refreshed or removed.
+	 */
+	int32 Reconcile();
+
+	void BindRegistryEvents();
+	void UnbindRegistryEvents();
+
+	/** Re-read one package's dependencies and Blueprint class from the registry (removes it if it has no assets) */
+	void RefreshPackage(FName PackageName);
+
+	/** Forget a package's outgoing edges and class; packages still referencing it keep their edge */
+	void RemovePackage(FName PackageName);
+
+	/** Replace a package's outgoing edges */
+	void SetDependencies(FName PackageName, const TArray<FName>& InDependencies);
+
+	/** Record that PackageName holds the Blueprint generating ClassPath, derived from ParentClassPath */
+	void SetBlueprintClass(FName PackageName, FName ClassPath, FName ParentClassPath);
+
+	void Reset();
+
+	// ═══════════════════════════════════════════════════════════════════
+	// QUERIES
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Node id of a package (INDEX_NONE if never seen) */
+	int32 FindNode(FName PackageName) const;
+	int32 NumNodes() const { return NodeNames.Num(); }
+	int32 NumClasses() const { return ClassNames.Num(); }
+
+	/** Direct dependencies / referencers */
+	TArray<FName> GetDependencies(FName PackageName) const;
+	TArray<FName> GetReferencers(FName PackageName) const;
+
+	/** Everything Roots depend on, directly or not (Roots excluded) */
+	TArray<FName> GetTransitiveDependencies(const TArray<FName>& Roots) const;
+
+	/** Everything that depends on Roots, directly or not (Roots excluded) */
+	TArray<FName> GetTransitiveReferencers(const TArray<FName>& Roots) const;
+
+	/** Packages to revisit when Changed change: Changed plus their transitive referencers */
+	TArray<FName> GetImpactSet(const TArray<FName>& Changed) const;
+
+	/** Packages of Blueprints whose generated class is ClassPath or derives from it ("/Script/Engine.Actor") */
+	TArray<FName> GetChildBlueprintPackages(FName ClassPath) const;
+
+	// ═══════════════════════════════════════════════════════════════════
+	// SNAPSHOT
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Written to Path.tmp and moved into place; clears the dirty flag */
+	bool SaveSnapshot(const FString& Path);
+
+	/** False (graph left empty) if the file is missing, from another version or inconsistent */
+	bool LoadSnapshot(const FString& Path);
+
+	/** Changed since the last save or load */
+	bool IsDirty() const { return bDirty; }
+
+private:
+	int32 FindOrAddNode(FName PackageName);
+	int32 FindOrAddClass(FName ClassPath);
+	void SetOutgoing(int32 Node, TArray<int32>&& NewDependencies);
+	void DetachClass(int32 Class);
+	void ClearBlueprintClass(int32 Node);
+	void Serialize(FArchive& Ar);
+	void RebuildIndices();
+	TArray<FName> Closure(const TArray<FName>& Roots, bool bReverse, bool bIncludeRoots) const;
+
+	void HandleAssetChanged(const FAssetData& AssetData);
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void HandleFilesLoaded();
+
+	// Package nodes (ids are never reused)
+	TArray<FName> NodeNames;
+	TArray<TArray<int32>> Dependencies;
+	TArray<TArray<int32>> Referencers;
+	TArray<FIoHash> SavedHashes;
+	TMap<FName, int32> NodeIds;
+
+	// Class hierarchy index
+	TArray<FName> ClassNames;
+	TArray<int32> ClassParents;
+	TArray<TArray<int32>> ClassChildren;
+
+	/** Package node holding the Blueprint that generates the class (INDEX_NONE for native classes) */
+	TArray<int32> ClassPackages;
+	TMap<FName, int32> ClassIds;
+	TMap<int32, int32> PackageClasses;
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+	FDelegateHandle FilesLoadedHandle;
+
+	bool bDirty = false;
+};
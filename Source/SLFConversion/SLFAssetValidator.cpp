@@ -16,9 +16,11 @@
 #include "Blueprint/WidgetBlueprintGeneratedClass.h"
 #include "WidgetBlueprint.h"
 #include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformFileManager.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "UObject/UObjectIterator.h"
+#include "SLFDiffEngine.h"
 
 void USLFAssetValidator::ExportObjectProperties(UObject* Object, FString& OutText, int32 IndentLevel)
 {
@@ -392,39 +394,34 @@ bool USLFAssetValidator::CompareExports(const FString& File1Path, const FString&
 		return false;
 	}
 
-	// Split into lines and compare
-	TArray<FString> Lines1, Lines2;
-	Content1.ParseIntoArrayLines(Lines1);
-	Content2.ParseIntoArrayLines(Lines2);
+	// Lines are views into the loaded text; the report goes straight to disk
+	TArray<FStringView> Lines1, Lines2;
+	FSLFDiffEngine::SplitLines(Content1, Lines1);
+	FSLFDiffEngine::SplitLines(Content2, Lines2);
 
-	FString DiffText;
-	DiffText += FString::Printf(TEXT("=== DIFF REPORT ===\n"));
-	DiffText += FString::Printf(TEXT("File1: %s (%d lines)\n"), *File1Path, Lines1.Num());
-	DiffText += FString::Printf(TEXT("File2: %s (%d lines)\n"), *File2Path, Lines2.Num());
-	DiffText += TEXT("\n");
-
-	int32 DiffCount = 0;
-	int32 MaxLines = FMath::Max(Lines1.Num(), Lines2.Num());
-
-	for (int32 i = 0; i < MaxLines; i++)
+	TUniquePtr<FArchive> Report(IFileManager::Get().CreateFileWriter(*DiffOutputPath));
+	if (!Report)
 	{
-		FString Line1 = i < Lines1.Num() ? Lines1[i] : TEXT("<missing>");
-		FString Line2 = i < Lines2.Num() ? Lines2[i] : TEXT("<missing>");
-
-		if (Line1 != Line2)
-		{
-			DiffCount++;
-			DiffText += FString::Printf(TEXT("Line %d:\n"), i + 1);
-			DiffText += FString::Printf(TEXT("  File1: %s\n"), *Line1);
-			DiffText += FString::Printf(TEXT("  File2: %s\n"), *Line2);
-			DiffText += TEXT("\n");
-		}
+		UE_LOG(LogTemp, Error, TEXT("[AssetValidator] Failed to write: %s"), *DiffOutputPath);
+		return false;
 	}
 
-	DiffText += FString::Printf(TEXT("\n=== SUMMARY ===\n"));
-	DiffText += FString::Printf(TEXT("Total differences: %d\n"), DiffCount);
+	FSLFDiffEngine::WriteLine(*Report, TEXT("=== DIFF REPORT ==="));
+	FSLFDiffEngine::WriteLine(*Report, FString::Printf(TEXT("File1: %s (%d lines)"), *File1Path, Lines1.Num()));
+	FSLFDiffEngine::WriteLine(*Report, FString::Printf(TEXT("File2: %s (%d lines)"), *File2Path, Lines2.Num()));
+	FSLFDiffEngine::WriteLine(*Report, TEXT(""));
+
+	const FSLFDiffStats Stats = FSLFDiffEngine::WriteLineDiff(Lines1, Lines2, *Report);
+	const int32 DiffCount = Stats.Total();
+
+	FSLFDiffEngine::WriteLine(*Report, TEXT(""));
+	FSLFDiffEngine::WriteLine(*Report, TEXT("=== SUMMARY ==="));
+	FSLFDiffEngine::WriteLine(*Report, FString::Printf(TEXT("Total differences: %d"), DiffCount));
+	FSLFDiffEngine::WriteLine(*Report, FString::Printf(TEXT("Removed lines: %d"), Stats.Removed));
+	FSLFDiffEngine::WriteLine(*Report, FString::Printf(TEXT("Added lines: %d"), Stats.Added));
+	FSLFDiffEngine::WriteLine(*Report, FString::Printf(TEXT("Hunks: %d"), Stats.Hunks));
 
-	if (FFileHelper::SaveStringToFile(DiffText, *DiffOutputPath))
+	if (Report->Close())
 	{
 		UE_LOG(LogTemp, Log, TEXT("[AssetValidator] Diff saved to: %s (Found %d differences)"), *DiffOutputPath, DiffCount);
 		return true;
@@ -48,6 +48,8 @@ public:
 
 	/**
 	 * Compare two export files and generate a diff report
+	 * Lines are aligned (patience/Myers), so an inserted line only reports itself;
+	 * the report is unified-diff hunks with 3 lines of context, written as it is produced
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SLF|Validation")
 	static bool CompareExports(const FString& File1Path, const FString& File2Path, const FString& DiffOutputPath);
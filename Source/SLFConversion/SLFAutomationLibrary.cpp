@@ -67,6 +67,13 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Misc/FileHelper.h"
+// Blueprint state diffs
+#include "SLFDiffEngine.h"
+// Animation frame dumps
+#include "SLFAnimFrameDump.h"
+#include "SLFAnimComparison.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryWriter.h"
 // Destructible diagnostics
 #include "GeometryCollection/GeometryCollectionComponent.h"
 #include "GeometryCollection/GeometryCollectionObject.h"
@@ -98,6 +105,7 @@
 #include "Engine/SkeletalMesh.h"
 #include "Engine/SkeletalMeshSocket.h"
 #include "AssetCompilingManager.h"
+#include "Tasks/Task.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogSLFAutomation, Log, All);
 
@@ -13775,220 +13783,86 @@ FString USLFAutomationLibrary::ApplyForensicTransforms(
 	return Result;
 }
 
-// ── File-scope helper: core bake logic with bone name mapping support ──
-static FString BakeAnimationTransformsImpl(
-	const FString& SourceAnimPath,
-	const FString& OutputPath,
-	const FString& NewAssetName,
-	float NoiseAmplitudeDegrees,
-	float TimeWarpStrength,
-	FVector BoneRotationOffsetDegrees,
-	float TargetFrameRate,
-	int32 RandomSeed,
-	const FString& TargetSkeletonPath,
-	const TMap<FName, FName>& BoneNameMapping)
-{
-	TArray<FString> Lines;
-	Lines.Add(FString::Printf(TEXT("=== BakeAnimationTransforms: %s -> %s/%s ==="),
-		*SourceAnimPath, *OutputPath, *NewAssetName));
-
-	// ── Phase 1: READ source animation ──────────────────────────────────
-	UAnimSequence* SourceAnim = LoadObject<UAnimSequence>(nullptr, *SourceAnimPath);
-	if (!SourceAnim)
-	{
-		Lines.Add(FString::Printf(TEXT("ERROR: Source animation not found: %s"), *SourceAnimPath));
-		return FString::Join(Lines, TEXT("\n"));
-	}
-
-	USkeleton* SourceSkeleton = SourceAnim->GetSkeleton();
-	if (!SourceSkeleton)
-	{
-		Lines.Add(TEXT("ERROR: Source animation has no skeleton"));
-		return FString::Join(Lines, TEXT("\n"));
-	}
-
-	// Use target skeleton for output if specified, otherwise use source skeleton
-	USkeleton* OutputSkeleton = SourceSkeleton;
-	if (!TargetSkeletonPath.IsEmpty())
-	{
-		USkeleton* TargetSkel = LoadObject<USkeleton>(nullptr, *TargetSkeletonPath);
-		if (TargetSkel)
-		{
-			OutputSkeleton = TargetSkel;
-			Lines.Add(FString::Printf(TEXT("  Using target skeleton: %s"), *TargetSkeletonPath));
-		}
-		else
-		{
-			Lines.Add(FString::Printf(TEXT("WARNING: Target skeleton not found: %s, using source skeleton"), *TargetSkeletonPath));
-		}
-	}
+// ── Bake stages ──
+// A bake is read (game thread: load, sample source bones), compute (any thread: resample,
+// time warp, noise, offsets, retarget into key arrays) and commit (game thread: write the
+// data model, compress, save). Single bakes run the stages back to back; BakeAnimationBatch
+// computes one group on workers while the game thread commits the previous group.
 
-	// Use source skeleton's reference for reading bone data
-	const FReferenceSkeleton& RefSkel = SourceSkeleton->GetReferenceSkeleton();
-	int32 NumBones = RefSkel.GetNum();
-	float SourceDuration = SourceAnim->GetPlayLength();
-	int32 SourceNumKeys = SourceAnim->GetNumberOfSampledKeys();
-	float SourceFPS = (SourceNumKeys > 1) ? (float)(SourceNumKeys - 1) / FMath::Max(0.001f, SourceDuration) : 30.0f;
-
-	Lines.Add(FString::Printf(TEXT("  Source: %d bones, %d keys, %.1f fps, %.3fs duration"),
-		NumBones, SourceNumKeys, SourceFPS, SourceDuration));
-
-	// ── Read per-bone per-frame local transforms from source ──
-	// Structure: SourceBoneFrames[BoneIdx][FrameIdx]
-	TArray<TArray<FTransform>> SourceBoneFrames;
-	SourceBoneFrames.SetNum(NumBones);
-
-	for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
-	{
-		SourceBoneFrames[BoneIdx].SetNum(SourceNumKeys);
-		for (int32 Frame = 0; Frame < SourceNumKeys; Frame++)
-		{
-			float Time = (SourceNumKeys > 1)
-				? (float)Frame / (float)(SourceNumKeys - 1) * SourceDuration
-				: 0.0f;
-
-			FTransform BoneT;
-			SourceAnim->GetBoneTransform(BoneT, FSkeletonPoseBoneIndex(BoneIdx), Time, false);
-			SourceBoneFrames[BoneIdx][Frame] = BoneT;
-		}
-	}
-
-	// ── Phase 2: RESAMPLE to target frame rate ──────────────────────────
-	float ClampedWarp = FMath::Clamp(TimeWarpStrength, 0.0f, 0.95f);
-	int32 OutputNumKeys = FMath::Max(2, FMath::RoundToInt32(SourceDuration * TargetFrameRate) + 1);
-	float OutputDuration = SourceDuration; // Keep same duration
-
-	Lines.Add(FString::Printf(TEXT("  Output: %d keys at %.1f fps, warp=%.2f, noise=%.1f deg"),
-		OutputNumKeys, TargetFrameRate, ClampedWarp, NoiseAmplitudeDegrees));
-
-	// OutputBoneFrames[BoneIdx][FrameIdx]
-	TArray<TArray<FTransform>> OutputBoneFrames;
-	OutputBoneFrames.SetNum(NumBones);
-
-	// Setup RNG
-	FRandomStream RNG(RandomSeed != 0 ? RandomSeed : FMath::Rand());
-
-	// Pre-generate noise curves per bone
-	TArray<TArray<FQuat>> BoneNoiseCurves;
-	BoneNoiseCurves.SetNum(NumBones);
-	TArray<float> BoneWeights;
-	BoneWeights.SetNum(NumBones);
-
-	for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+namespace
+{
+	/** Settings shared by every item of a bake */
+	struct FBakeSettings
 	{
-		FName BoneName = RefSkel.GetBoneName(BoneIdx);
-		BoneWeights[BoneIdx] = ComputeBoneRegionWeight(BoneName);
-		BoneNoiseCurves[BoneIdx] = GenerateSmoothNoiseCurve(
-			OutputNumKeys, NoiseAmplitudeDegrees, BoneWeights[BoneIdx], RNG);
-	}
-
-	// Compute static rotation offset quaternion (applied scaled by bone weight)
-	FQuat BaseOffsetQuat = FQuat(FRotator(
-		BoneRotationOffsetDegrees.Y,  // Pitch
-		BoneRotationOffsetDegrees.Z,  // Yaw
-		BoneRotationOffsetDegrees.X   // Roll
-	));
+		float NoiseAmplitudeDegrees = 2.0f;
+		float TimeWarpStrength = 0.15f;
+		FVector BoneRotationOffsetDegrees = FVector(0.0, 10.0, 0.0);
+		float TargetFrameRate = 24.0f;
+	};
 
-	for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+	/** Component-space retarget data for one source/target skeleton pair, shared across bakes */
+	struct FBakeRetargetMap
 	{
-		OutputBoneFrames[BoneIdx].SetNum(OutputNumKeys);
-		float Weight = BoneWeights[BoneIdx];
-
-		for (int32 OutFrame = 0; OutFrame < OutputNumKeys; OutFrame++)
-		{
-			// Normalized time [0, 1]
-			float T = (OutputNumKeys > 1)
-				? (float)OutFrame / (float)(OutputNumKeys - 1)
-				: 0.0f;
-
-			// ── Phase 3: TIME WARP ──
-			// Non-linear sine easing: preserves start/end, creates accel/decel
-			float WarpedT = T + ClampedWarp * FMath::Sin(2.0f * PI * T) / (2.0f * PI);
-			WarpedT = FMath::Clamp(WarpedT, 0.0f, 1.0f);
-
-			// Map warped T to source frame space
-			float SourceFrameF = WarpedT * (float)(SourceNumKeys - 1);
-			int32 FrameA = FMath::Clamp(FMath::FloorToInt32(SourceFrameF), 0, SourceNumKeys - 1);
-			int32 FrameB = FMath::Clamp(FrameA + 1, 0, SourceNumKeys - 1);
-			float Alpha = SourceFrameF - (float)FrameA;
-
-			// Lerp/Slerp between source frames
-			const FTransform& TransA = SourceBoneFrames[BoneIdx][FrameA];
-			const FTransform& TransB = SourceBoneFrames[BoneIdx][FrameB];
-
-			FTransform Interp;
-			Interp.SetLocation(FMath::Lerp(TransA.GetLocation(), TransB.GetLocation(), Alpha));
-			Interp.SetRotation(FQuat::Slerp(TransA.GetRotation(), TransB.GetRotation(), Alpha));
-			Interp.SetScale3D(FMath::Lerp(TransA.GetScale3D(), TransB.GetScale3D(), Alpha));
-
-			// ── Phase 4: NOISE + OFFSETS ──
-			if (Weight > 0.001f)
-			{
-				// Apply smooth noise rotation
-				FQuat NoiseQuat = BoneNoiseCurves[BoneIdx][OutFrame];
-
-				// Apply static offset (scaled by bone weight via Slerp from identity)
-				FQuat ScaledOffset = FQuat::Slerp(FQuat::Identity, BaseOffsetQuat, Weight);
-
-				// Combine: original * noise * offset
-				Interp.SetRotation(Interp.GetRotation() * NoiseQuat * ScaledOffset);
-				Interp.NormalizeRotation();
-			}
+		TArray<FName> TgtNames;
+		TArray<int32> TgtParents;
+		TArray<FTransform> TgtRefCS;
+		TArray<FTransform> SrcRefCSInv;
+		TArray<int32> TgtToSrc;
 
-			OutputBoneFrames[BoneIdx][OutFrame] = Interp;
-		}
-	}
+		/** Mapping statistics and reference pose differences, reported once per map */
+		TArray<FString> Lines;
+	};
 
-	// ── Phase 4b + 5: COMPONENT-SPACE RETARGET & WRITE ──────────────────
-	// The per-bone local retarget formula is WRONG when skeletons have different
-	// component-space reference poses (different root orientations cascade to all children).
-	// Correct approach: work in component space to preserve skin matrices.
-	//   SkinMatrix = AnimCS * RefCS^-1
-	//   For SkinMatrix_tgt = SkinMatrix_src:
-	//   TgtAnimCS = SrcAnimCS * SrcRefCS^-1 * TgtRefCS  (in matrix math)
-	//   In UE FTransform: TgtAnimCS = TgtRefCS * SrcRefCS.Inverse() * SrcAnimCS
+	using FBakeRetargetCache = TMap<TPair<const USkeleton*, const USkeleton*>, TSharedPtr<const FBakeRetargetMap>>;
 
-	// Prepare output animation package
-	FString PkgName = OutputPath / NewAssetName;
-	UPackage* ExistingPkg = FindPackage(nullptr, *PkgName);
-	if (ExistingPkg)
+	struct FBakeTrack
 	{
-		ExistingPkg->FullyLoad();
-		UObject* ExistingObj = StaticFindObjectFast(nullptr, ExistingPkg, FName(*NewAssetName));
-		if (ExistingObj)
-		{
-			ExistingObj->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
-		}
-	}
-	UPackage* Package = CreatePackage(*PkgName);
-	Package->FullyLoad();
-
-	UAnimSequence* NewAnim = NewObject<UAnimSequence>(Package, FName(*NewAssetName), RF_Public | RF_Standalone);
-	NewAnim->SetSkeleton(OutputSkeleton);
-
-	IAnimationDataController& Controller = NewAnim->GetController();
-	Controller.OpenBracket(NSLOCTEXT("SLFAutomation", "BakeAnim", "Bake Animation"), false);
-	Controller.InitializeModel();
-
-	FFrameRate OutFrameRate(FMath::RoundToInt32(TargetFrameRate), 1);
-	Controller.SetFrameRate(OutFrameRate, false);
-	Controller.SetNumberOfFrames(FFrameNumber(OutputNumKeys - 1), false);
+		FName BoneName;
+		bool bMatched = true;
+		TArray<FVector3f> PosKeys;
+		TArray<FQuat4f> RotKeys;
+		TArray<FVector3f> ScaleKeys;
+	};
 
-	int32 TracksAdded = 0;
-	int32 TracksSkipped = 0;
+	struct FBakeJob
+	{
+		FString SourceAnimPath;
+		FString OutputPath;
+		FString NewAssetName;
+		int32 Seed = 0;
+
+		// Read
+		USkeleton* SourceSkeleton = nullptr;
+		USkeleton* OutputSkeleton = nullptr;
+		TSharedPtr<const FBakeRetargetMap> Retarget;
+		TArray<FName> SrcNames;
+		TArray<int32> SrcParents;
+		TArray<TArray<FTransform>> SourceBoneFrames;
+		float SourceDuration = 0.0f;
+		int32 SourceNumKeys = 0;
+
+		// Compute
+		int32 OutputNumKeys = 0;
+		TArray<FBakeTrack> Tracks;
+		int32 TracksAdded = 0;
+		int32 TracksSkipped = 0;
+
+		// Commit
+		UPackage* Package = nullptr;
+		UAnimSequence* NewAnim = nullptr;
+		bool bSaved = false;
+
+		TArray<FString> Lines;
+		double ReadSeconds = 0.0;
+		double ComputeSeconds = 0.0;
+		double CommitSeconds = 0.0;
+		double SaveSeconds = 0.0;
+	};
 
-	if (OutputSkeleton != SourceSkeleton)
+	TSharedPtr<const FBakeRetargetMap> BuildBakeRetargetMap(const FReferenceSkeleton& RefSkel, const FReferenceSkeleton& TgtRefSkel,
+		const TMap<FName, FName>& BoneNameMapping)
 	{
-		// Component-space retarget: preserves skin deformation when reference poses differ.
-		// This correctly handles the 180° root bone rotation from FBX round-tripping.
-		//
-		// Formula per bone: TgtAnimCS = SrcAnimCS * SrcRefCS^-1 * TgtRefCS
-		// Then convert back to bone-local: TgtLocal = TgtAnimCS * TgtAnimCS_Parent^-1
-		//
-		// UE5 FTransform convention: CS[child] = Local[child] * CS[parent]
-		// So Local[child] = CS[child] * CS[parent]^-1
-
-		const FReferenceSkeleton& TgtRefSkel = OutputSkeleton->GetReferenceSkeleton();
+		TSharedPtr<FBakeRetargetMap> Map = MakeShared<FBakeRetargetMap>();
 		int32 NumSrcBones = RefSkel.GetNum();
 		int32 NumTgtBones = TgtRefSkel.GetNum();
 
@@ -14005,15 +13879,18 @@ static FString BakeAnimationTransformsImpl(
 		}
 
 		// Pre-compute target reference pose in component space
-		TArray<FTransform> TgtRefCS;
-		TgtRefCS.SetNum(NumTgtBones);
+		Map->TgtRefCS.SetNum(NumTgtBones);
+		Map->TgtNames.SetNum(NumTgtBones);
+		Map->TgtParents.SetNum(NumTgtBones);
 		for (int32 i = 0; i < NumTgtBones; i++)
 		{
 			int32 Parent = TgtRefSkel.GetParentIndex(i);
+			Map->TgtNames[i] = TgtRefSkel.GetBoneName(i);
+			Map->TgtParents[i] = Parent;
 			if (Parent == INDEX_NONE)
-				TgtRefCS[i] = TgtRefSkel.GetRefBonePose()[i];
+				Map->TgtRefCS[i] = TgtRefSkel.GetRefBonePose()[i];
 			else
-				TgtRefCS[i] = TgtRefSkel.GetRefBonePose()[i] * TgtRefCS[Parent];
+				Map->TgtRefCS[i] = TgtRefSkel.GetRefBonePose()[i] * Map->TgtRefCS[Parent];
 		}
 
 		// Build source bone name->index map
@@ -14022,8 +13899,7 @@ static FString BakeAnimationTransformsImpl(
 			SrcBoneNameMap.Add(RefSkel.GetBoneName(i), i);
 
 		// Build target->source bone index mapping (with optional name mapping)
-		TArray<int32> TgtToSrc;
-		TgtToSrc.SetNum(NumTgtBones);
+		Map->TgtToSrc.SetNum(NumTgtBones);
 		int32 NameMatches = 0;
 		int32 MappedMatches = 0;
 		for (int32 TgtIdx = 0; TgtIdx < NumTgtBones; TgtIdx++)
@@ -14045,33 +13921,33 @@ static FString BakeAnimationTransformsImpl(
 
 			if (SrcIdxPtr)
 			{
-				TgtToSrc[TgtIdx] = *SrcIdxPtr;
+				Map->TgtToSrc[TgtIdx] = *SrcIdxPtr;
 				NameMatches++;
 			}
 			else
 			{
-				TgtToSrc[TgtIdx] = INDEX_NONE;
+				Map->TgtToSrc[TgtIdx] = INDEX_NONE;
 			}
 		}
 
 		if (MappedMatches > 0)
 		{
-			Lines.Add(FString::Printf(TEXT("  Bone mapping: %d direct matches, %d via name mapping"), NameMatches - MappedMatches, MappedMatches));
+			Map->Lines.Add(FString::Printf(TEXT("  Bone mapping: %d direct matches, %d via name mapping"), NameMatches - MappedMatches, MappedMatches));
 		}
 
-		Lines.Add(FString::Printf(TEXT("  CS retarget: %d/%d target bones match source by name"),
+		Map->Lines.Add(FString::Printf(TEXT("  CS retarget: %d/%d target bones match source by name"),
 			NameMatches, NumTgtBones));
 
 		// Log reference pose differences for first few bones
 		for (int32 TgtIdx = 0; TgtIdx < FMath::Min(5, NumTgtBones); TgtIdx++)
 		{
-			int32 SrcIdx = TgtToSrc[TgtIdx];
+			int32 SrcIdx = Map->TgtToSrc[TgtIdx];
 			if (SrcIdx != INDEX_NONE)
 			{
 				FQuat SrcQ = SrcRefCS[SrcIdx].GetRotation();
-				FQuat TgtQ = TgtRefCS[TgtIdx].GetRotation();
+				FQuat TgtQ = Map->TgtRefCS[TgtIdx].GetRotation();
 				float AngDiff = FMath::RadiansToDegrees(SrcQ.AngularDistance(TgtQ));
-				Lines.Add(FString::Printf(TEXT("    [%d] %s: SrcCS rot=(%.4f,%.4f,%.4f,%.4f) TgtCS rot=(%.4f,%.4f,%.4f,%.4f) diff=%.1f deg"),
+				Map->Lines.Add(FString::Printf(TEXT("    [%d] %s: SrcCS rot=(%.4f,%.4f,%.4f,%.4f) TgtCS rot=(%.4f,%.4f,%.4f,%.4f) diff=%.1f deg"),
 					TgtIdx, *TgtRefSkel.GetBoneName(TgtIdx).ToString(),
 					SrcQ.X, SrcQ.Y, SrcQ.Z, SrcQ.W,
 					TgtQ.X, TgtQ.Y, TgtQ.Z, TgtQ.W,
@@ -14080,180 +13956,465 @@ static FString BakeAnimationTransformsImpl(
 		}
 
 		// Pre-compute inverse source reference CS (avoids recomputing per frame)
-		TArray<FTransform> SrcRefCSInv;
-		SrcRefCSInv.SetNum(NumSrcBones);
+		Map->SrcRefCSInv.SetNum(NumSrcBones);
 		for (int32 i = 0; i < NumSrcBones; i++)
-			SrcRefCSInv[i] = SrcRefCS[i].Inverse();
+			Map->SrcRefCSInv[i] = SrcRefCS[i].Inverse();
 
-		// For each frame, compute retargeted bone-locals for target skeleton
-		// Allocate storage for target bone-locals [tgtBone][frame]
-		TArray<TArray<FTransform>> TgtBoneLocals;
-		TgtBoneLocals.SetNum(NumTgtBones);
-		for (int32 i = 0; i < NumTgtBones; i++)
-			TgtBoneLocals[i].SetNum(OutputNumKeys);
+		return Map;
+	}
 
-		for (int32 Frame = 0; Frame < OutputNumKeys; Frame++)
+	/** Game thread: load the source, pick the output skeleton, sample every source bone at every key */
+	bool ReadBakeSource(FBakeJob& Job, const FString& TargetSkeletonPath, USkeleton* TargetSkeleton,
+		const TMap<FName, FName>& BoneNameMapping, FBakeRetargetCache& RetargetCache, int32 RandomSeed)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		// ── Phase 1: READ source animation ──────────────────────────────────
+		UAnimSequence* SourceAnim = LoadObject<UAnimSequence>(nullptr, *Job.SourceAnimPath);
+		if (!SourceAnim)
 		{
-			// 1. Chain source bone-locals to get source animation in component space
-			TArray<FTransform> SrcAnimCS;
-			SrcAnimCS.SetNum(NumSrcBones);
-			for (int32 SrcIdx = 0; SrcIdx < NumSrcBones; SrcIdx++)
-			{
-				int32 Parent = RefSkel.GetParentIndex(SrcIdx);
-				if (Parent == INDEX_NONE)
-					SrcAnimCS[SrcIdx] = OutputBoneFrames[SrcIdx][Frame];
-				else
-					SrcAnimCS[SrcIdx] = OutputBoneFrames[SrcIdx][Frame] * SrcAnimCS[Parent];
-			}
+			Job.Lines.Add(FString::Printf(TEXT("ERROR: Source animation not found: %s"), *Job.SourceAnimPath));
+			return false;
+		}
 
-			// 2. Retarget each target bone: TgtAnimCS = TgtRefCS * SrcRefCS^-1 * SrcAnimCS
-			// UE5 FTransform A*B means "apply A first, then B". So this composition:
-			//   TgtRefCS (tgt bone-local -> component) * SrcRefCSInv (component -> src bone-local)
-			//   * SrcAnimCS (src bone-local -> component animated)
-			// = tgt bone-local -> component (animated), preserving skin deformation.
-			TArray<FTransform> TgtAnimCS;
-			TgtAnimCS.SetNum(NumTgtBones);
-			for (int32 TgtIdx = 0; TgtIdx < NumTgtBones; TgtIdx++)
+		USkeleton* SourceSkeleton = SourceAnim->GetSkeleton();
+		if (!SourceSkeleton)
+		{
+			Job.Lines.Add(TEXT("ERROR: Source animation has no skeleton"));
+			return false;
+		}
+
+		// Use target skeleton for output if specified, otherwise use source skeleton
+		USkeleton* OutputSkeleton = SourceSkeleton;
+		if (!TargetSkeletonPath.IsEmpty())
+		{
+			if (TargetSkeleton)
 			{
-				int32 SrcIdx = TgtToSrc[TgtIdx];
-				if (SrcIdx != INDEX_NONE)
-				{
-					TgtAnimCS[TgtIdx] = TgtRefCS[TgtIdx] * SrcRefCSInv[SrcIdx] * SrcAnimCS[SrcIdx];
-				}
-				else
-				{
-					// Unmatched bone: hold at target reference pose
-					TgtAnimCS[TgtIdx] = TgtRefCS[TgtIdx];
-				}
+				OutputSkeleton = TargetSkeleton;
+				Job.Lines.Add(FString::Printf(TEXT("  Using target skeleton: %s"), *TargetSkeletonPath));
 			}
-
-			// 3. Convert component space back to bone-local
-			for (int32 TgtIdx = 0; TgtIdx < NumTgtBones; TgtIdx++)
+			else
 			{
-				int32 Parent = TgtRefSkel.GetParentIndex(TgtIdx);
-				if (Parent == INDEX_NONE)
-				{
-					TgtBoneLocals[TgtIdx][Frame] = TgtAnimCS[TgtIdx];
-				}
-				else
-				{
-					TgtBoneLocals[TgtIdx][Frame] = TgtAnimCS[TgtIdx] * TgtAnimCS[Parent].Inverse();
-				}
+				Job.Lines.Add(FString::Printf(TEXT("WARNING: Target skeleton not found: %s, using source skeleton"), *TargetSkeletonPath));
 			}
 		}
+		Job.SourceSkeleton = SourceSkeleton;
+		Job.OutputSkeleton = OutputSkeleton;
 
-		// 4. Write retargeted tracks to animation
-		for (int32 TgtIdx = 0; TgtIdx < NumTgtBones; TgtIdx++)
-		{
-			FName BoneName = TgtRefSkel.GetBoneName(TgtIdx);
-			Controller.AddBoneCurve(BoneName, false);
+		// Resolve the seed here: FMath::Rand is not for worker threads
+		Job.Seed = RandomSeed != 0 ? RandomSeed : FMath::Rand();
 
-			TArray<FVector3f> PosKeys;
-			TArray<FQuat4f> RotKeys;
-			TArray<FVector3f> ScaleKeys;
-			PosKeys.SetNum(OutputNumKeys);
-			RotKeys.SetNum(OutputNumKeys);
-			ScaleKeys.SetNum(OutputNumKeys);
+		// Use source skeleton's reference for reading bone data
+		const FReferenceSkeleton& RefSkel = SourceSkeleton->GetReferenceSkeleton();
+		int32 NumBones = RefSkel.GetNum();
+		float SourceDuration = SourceAnim->GetPlayLength();
+		int32 SourceNumKeys = SourceAnim->GetNumberOfSampledKeys();
+		float SourceFPS = (SourceNumKeys > 1) ? (float)(SourceNumKeys - 1) / FMath::Max(0.001f, SourceDuration) : 30.0f;
+		Job.SourceDuration = SourceDuration;
+		Job.SourceNumKeys = SourceNumKeys;
 
-			for (int32 Frame = 0; Frame < OutputNumKeys; Frame++)
+		Job.Lines.Add(FString::Printf(TEXT("  Source: %d bones, %d keys, %.1f fps, %.3fs duration"),
+			NumBones, SourceNumKeys, SourceFPS, SourceDuration));
+
+		Job.SrcNames.SetNum(NumBones);
+		Job.SrcParents.SetNum(NumBones);
+		for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+		{
+			Job.SrcNames[BoneIdx] = RefSkel.GetBoneName(BoneIdx);
+			Job.SrcParents[BoneIdx] = RefSkel.GetParentIndex(BoneIdx);
+		}
+
+		// ── Read per-bone per-frame local transforms from source ──
+		// Structure: SourceBoneFrames[BoneIdx][FrameIdx]
+		Job.SourceBoneFrames.SetNum(NumBones);
+		for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+		{
+			Job.SourceBoneFrames[BoneIdx].SetNum(SourceNumKeys);
+			for (int32 Frame = 0; Frame < SourceNumKeys; Frame++)
 			{
-				const FTransform& T = TgtBoneLocals[TgtIdx][Frame];
-				PosKeys[Frame] = FVector3f(T.GetLocation());
-				RotKeys[Frame] = FQuat4f(T.GetRotation());
-				ScaleKeys[Frame] = FVector3f(T.GetScale3D());
-			}
+				float Time = (SourceNumKeys > 1)
+					? (float)Frame / (float)(SourceNumKeys - 1) * SourceDuration
+					: 0.0f;
 
-			Controller.SetBoneTrackKeys(BoneName, PosKeys, RotKeys, ScaleKeys, false);
+				FTransform BoneT;
+				SourceAnim->GetBoneTransform(BoneT, FSkeletonPoseBoneIndex(BoneIdx), Time, false);
+				Job.SourceBoneFrames[BoneIdx][Frame] = BoneT;
+			}
+		}
 
-			if (TgtToSrc[TgtIdx] != INDEX_NONE)
-				TracksAdded++;
+		// The component-space retarget data depends only on the two skeletons and the mapping
+		if (OutputSkeleton != SourceSkeleton)
+		{
+			const TPair<const USkeleton*, const USkeleton*> Key(SourceSkeleton, OutputSkeleton);
+			if (const TSharedPtr<const FBakeRetargetMap>* Cached = RetargetCache.Find(Key))
+			{
+				Job.Retarget = *Cached;
+			}
 			else
 			{
-				TracksSkipped++;
-				Lines.Add(FString::Printf(TEXT("  Unmatched bone '%s' -> reference pose"), *BoneName.ToString()));
+				Job.Retarget = BuildBakeRetargetMap(RefSkel, OutputSkeleton->GetReferenceSkeleton(), BoneNameMapping);
+				RetargetCache.Add(Key, Job.Retarget);
+				Job.Lines.Append(Job.Retarget->Lines);
 			}
 		}
 
-		Lines.Add(FString::Printf(TEXT("  Retargeted %d tracks, %d unmatched (ref pose)"), TracksAdded, TracksSkipped));
+		Job.ReadSeconds = FPlatformTime::Seconds() - StartTime;
+		return true;
 	}
-	else
+
+	/** Any thread: resample, warp, noise and retarget into per-track key arrays. Deterministic per Job.Seed */
+	void ComputeBakeKeys(FBakeJob& Job, const FBakeSettings& Settings)
 	{
-		// No retargeting needed - write source bones directly to matching target bones
-		TSet<FName> OutputBoneNames;
+		const double StartTime = FPlatformTime::Seconds();
+		const int32 NumBones = Job.SrcNames.Num();
+		const int32 SourceNumKeys = Job.SourceNumKeys;
+		const float SourceDuration = Job.SourceDuration;
+
+		// ── Phase 2: RESAMPLE to target frame rate ──────────────────────────
+		float ClampedWarp = FMath::Clamp(Settings.TimeWarpStrength, 0.0f, 0.95f);
+		int32 OutputNumKeys = FMath::Max(2, FMath::RoundToInt32(SourceDuration * Settings.TargetFrameRate) + 1);
+		Job.OutputNumKeys = OutputNumKeys;
+
+		Job.Lines.Add(FString::Printf(TEXT("  Output: %d keys at %.1f fps, warp=%.2f, noise=%.1f deg"),
+			OutputNumKeys, Settings.TargetFrameRate, ClampedWarp, Settings.NoiseAmplitudeDegrees));
+
+		// OutputBoneFrames[BoneIdx][FrameIdx]
+		TArray<TArray<FTransform>> OutputBoneFrames;
+		OutputBoneFrames.SetNum(NumBones);
+
+		// Setup RNG
+		FRandomStream RNG(Job.Seed);
+
+		// Pre-generate noise curves per bone
+		TArray<TArray<FQuat>> BoneNoiseCurves;
+		BoneNoiseCurves.SetNum(NumBones);
+		TArray<float> BoneWeights;
+		BoneWeights.SetNum(NumBones);
+
+		for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
 		{
-			const FReferenceSkeleton& OutRefSkel = OutputSkeleton->GetReferenceSkeleton();
-			for (int32 i = 0; i < OutRefSkel.GetNum(); i++)
-				OutputBoneNames.Add(OutRefSkel.GetBoneName(i));
+			BoneWeights[BoneIdx] = ComputeBoneRegionWeight(Job.SrcNames[BoneIdx]);
+			BoneNoiseCurves[BoneIdx] = GenerateSmoothNoiseCurve(
+				OutputNumKeys, Settings.NoiseAmplitudeDegrees, BoneWeights[BoneIdx], RNG);
 		}
 
+		// Compute static rotation offset quaternion (applied scaled by bone weight)
+		FQuat BaseOffsetQuat = FQuat(FRotator(
+			Settings.BoneRotationOffsetDegrees.Y,  // Pitch
+			Settings.BoneRotationOffsetDegrees.Z,  // Yaw
+			Settings.BoneRotationOffsetDegrees.X   // Roll
+		));
+
 		for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
 		{
-			FName BoneName = RefSkel.GetBoneName(BoneIdx);
-			if (!OutputBoneNames.Contains(BoneName))
+			OutputBoneFrames[BoneIdx].SetNum(OutputNumKeys);
+			float Weight = BoneWeights[BoneIdx];
+
+			for (int32 OutFrame = 0; OutFrame < OutputNumKeys; OutFrame++)
 			{
-				TracksSkipped++;
-				continue;
+				// Normalized time [0, 1]
+				float T = (OutputNumKeys > 1)
+					? (float)OutFrame / (float)(OutputNumKeys - 1)
+					: 0.0f;
+
+				// ── Phase 3: TIME WARP ──
+				// Non-linear sine easing: preserves start/end, creates accel/decel
+				float WarpedT = T + ClampedWarp * FMath::Sin(2.0f * PI * T) / (2.0f * PI);
+				WarpedT = FMath::Clamp(WarpedT, 0.0f, 1.0f);
+
+				// Map warped T to source frame space
+				float SourceFrameF = WarpedT * (float)(SourceNumKeys - 1);
+				int32 FrameA = FMath::Clamp(FMath::FloorToInt32(SourceFrameF), 0, SourceNumKeys - 1);
+				int32 FrameB = FMath::Clamp(FrameA + 1, 0, SourceNumKeys - 1);
+				float Alpha = SourceFrameF - (float)FrameA;
+
+				// Lerp/Slerp between source frames
+				const FTransform& TransA = Job.SourceBoneFrames[BoneIdx][FrameA];
+				const FTransform& TransB = Job.SourceBoneFrames[BoneIdx][FrameB];
+
+				FTransform Interp;
+				Interp.SetLocation(FMath::Lerp(TransA.GetLocation(), TransB.GetLocation(), Alpha));
+				Interp.SetRotation(FQuat::Slerp(TransA.GetRotation(), TransB.GetRotation(), Alpha));
+				Interp.SetScale3D(FMath::Lerp(TransA.GetScale3D(), TransB.GetScale3D(), Alpha));
+
+				// ── Phase 4: NOISE + OFFSETS ──
+				if (Weight > 0.001f)
+				{
+					// Apply smooth noise rotation
+					FQuat NoiseQuat = BoneNoiseCurves[BoneIdx][OutFrame];
+
+					// Apply static offset (scaled by bone weight via Slerp from identity)
+					FQuat ScaledOffset = FQuat::Slerp(FQuat::Identity, BaseOffsetQuat, Weight);
+
+					// Combine: original * noise * offset
+					Interp.SetRotation(Interp.GetRotation() * NoiseQuat * ScaledOffset);
+					Interp.NormalizeRotation();
+				}
+
+				OutputBoneFrames[BoneIdx][OutFrame] = Interp;
 			}
+		}
+
+		// Source frames are no longer needed; batches keep two groups of jobs alive
+		Job.SourceBoneFrames.Empty();
 
-			Controller.AddBoneCurve(BoneName, false);
+		auto AddTrack = [&Job, OutputNumKeys](FName BoneName, const TArray<FTransform>& Frames, bool bMatched)
+		{
+			FBakeTrack& Track = Job.Tracks.AddDefaulted_GetRef();
+			Track.BoneName = BoneName;
+			Track.bMatched = bMatched;
+			Track.PosKeys.SetNum(OutputNumKeys);
+			Track.RotKeys.SetNum(OutputNumKeys);
+			Track.ScaleKeys.SetNum(OutputNumKeys);
+
+			for (int32 Frame = 0; Frame < OutputNumKeys; Frame++)
+			{
+				const FTransform& T = Frames[Frame];
+				Track.PosKeys[Frame] = FVector3f(T.GetLocation());
+				Track.RotKeys[Frame] = FQuat4f(T.GetRotation());
+				Track.ScaleKeys[Frame] = FVector3f(T.GetScale3D());
+			}
+		};
 
-			TArray<FVector3f> PosKeys;
-			TArray<FQuat4f> RotKeys;
-			TArray<FVector3f> ScaleKeys;
-			PosKeys.SetNum(OutputNumKeys);
-			RotKeys.SetNum(OutputNumKeys);
-			ScaleKeys.SetNum(OutputNumKeys);
+		// ── Phase 4b: COMPONENT-SPACE RETARGET ──────────────────────────────
+		// The per-bone local retarget formula is WRONG when skeletons have different
+		// component-space reference poses (different root orientations cascade to all children).
+		// Correct approach: work in component space to preserve skin matrices.
+		//   SkinMatrix = AnimCS * RefCS^-1
+		//   For SkinMatrix_tgt = SkinMatrix_src:
+		//   TgtAnimCS = SrcAnimCS * SrcRefCS^-1 * TgtRefCS  (in matrix math)
+		//   In UE FTransform: TgtAnimCS = TgtRefCS * SrcRefCS.Inverse() * SrcAnimCS
+		if (Job.Retarget.IsValid())
+		{
+			// Component-space retarget: preserves skin deformation when reference poses differ.
+			// This correctly handles the 180° root bone rotation from FBX round-tripping.
+			//
+			// Formula per bone: TgtAnimCS = SrcAnimCS * SrcRefCS^-1 * TgtRefCS
+			// Then convert back to bone-local: TgtLocal = TgtAnimCS * TgtAnimCS_Parent^-1
+			//
+			// UE5 FTransform convention: CS[child] = Local[child] * CS[parent]
+			// So Local[child] = CS[child] * CS[parent]^-1
+			const FBakeRetargetMap& Map = *Job.Retarget;
+			int32 NumSrcBones = NumBones;
+			int32 NumTgtBones = Map.TgtNames.Num();
+
+			// For each frame, compute retargeted bone-locals for target skeleton
+			// Allocate storage for target bone-locals [tgtBone][frame]
+			TArray<TArray<FTransform>> TgtBoneLocals;
+			TgtBoneLocals.SetNum(NumTgtBones);
+			for (int32 i = 0; i < NumTgtBones; i++)
+				TgtBoneLocals[i].SetNum(OutputNumKeys);
 
+			TArray<FTransform> SrcAnimCS;
+			TArray<FTransform> TgtAnimCS;
+			SrcAnimCS.SetNum(NumSrcBones);
+			TgtAnimCS.SetNum(NumTgtBones);
 			for (int32 Frame = 0; Frame < OutputNumKeys; Frame++)
 			{
-				const FTransform& T = OutputBoneFrames[BoneIdx][Frame];
-				PosKeys[Frame] = FVector3f(T.GetLocation());
-				RotKeys[Frame] = FQuat4f(T.GetRotation());
-				ScaleKeys[Frame] = FVector3f(T.GetScale3D());
+				// 1. Chain source bone-locals to get source animation in component space
+				for (int32 SrcIdx = 0; SrcIdx < NumSrcBones; SrcIdx++)
+				{
+					int32 Parent = Job.SrcParents[SrcIdx];
+					if (Parent == INDEX_NONE)
+						SrcAnimCS[SrcIdx] = OutputBoneFrames[SrcIdx][Frame];
+					else
+						SrcAnimCS[SrcIdx] = OutputBoneFrames[SrcIdx][Frame] * SrcAnimCS[Parent];
+				}
+
+				// 2. Retarget each target bone: TgtAnimCS = TgtRefCS * SrcRefCS^-1 * SrcAnimCS
+				// UE5 FTransform A*B means "apply A first, then B". So this composition:
+				//   TgtRefCS (tgt bone-local -> component) * SrcRefCSInv (component -> src bone-local)
+				//   * SrcAnimCS (src bone-local -> component animated)
+				// = tgt bone-local -> component (animated), preserving skin deformation.
+				for (int32 TgtIdx = 0; TgtIdx < NumTgtBones; TgtIdx++)
+				{
+					int32 SrcIdx = Map.TgtToSrc[TgtIdx];
+					if (SrcIdx != INDEX_NONE)
+					{
+						TgtAnimCS[TgtIdx] = Map.TgtRefCS[TgtIdx] * Map.SrcRefCSInv[SrcIdx] * SrcAnimCS[SrcIdx];
+					}
+					else
+					{
+						// Unmatched bone: hold at target reference pose
+						TgtAnimCS[TgtIdx] = Map.TgtRefCS[TgtIdx];
+					}
+				}
+
+				// 3. Convert component space back to bone-local
+				for (int32 TgtIdx = 0; TgtIdx < NumTgtBones; TgtIdx++)
+				{
+					int32 Parent = Map.TgtParents[TgtIdx];
+					if (Parent == INDEX_NONE)
+					{
+						TgtBoneLocals[TgtIdx][Frame] = TgtAnimCS[TgtIdx];
+					}
+					else
+					{
+						TgtBoneLocals[TgtIdx][Frame] = TgtAnimCS[TgtIdx] * TgtAnimCS[Parent].Inverse();
+					}
+				}
 			}
 
-			Controller.SetBoneTrackKeys(BoneName, PosKeys, RotKeys, ScaleKeys, false);
-			TracksAdded++;
+			// 4. Retargeted tracks
+			for (int32 TgtIdx = 0; TgtIdx < NumTgtBones; TgtIdx++)
+			{
+				const bool bMatched = Map.TgtToSrc[TgtIdx] != INDEX_NONE;
+				AddTrack(Map.TgtNames[TgtIdx], TgtBoneLocals[TgtIdx], bMatched);
+
+				if (bMatched)
+					Job.TracksAdded++;
+				else
+				{
+					Job.TracksSkipped++;
+					Job.Lines.Add(FString::Printf(TEXT("  Unmatched bone '%s' -> reference pose"), *Map.TgtNames[TgtIdx].ToString()));
+				}
+			}
+
+			Job.Lines.Add(FString::Printf(TEXT("  Retargeted %d tracks, %d unmatched (ref pose)"), Job.TracksAdded, Job.TracksSkipped));
+		}
+		else
+		{
+			// No retargeting needed - output skeleton is the source skeleton, every bone has a track
+			for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+			{
+				AddTrack(Job.SrcNames[BoneIdx], OutputBoneFrames[BoneIdx], true);
+				Job.TracksAdded++;
+			}
 		}
+
+		Job.ComputeSeconds = FPlatformTime::Seconds() - StartTime;
 	}
 
-	Controller.NotifyPopulated();
-	Controller.CloseBracket(false);
+	/** Game thread: create the sequence, write every track in one controller bracket, start compression */
+	void CommitBakeKeys(FBakeJob& Job, const FBakeSettings& Settings)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		// Prepare output animation package
+		FString PkgName = Job.OutputPath / Job.NewAssetName;
+		UPackage* ExistingPkg = FindPackage(nullptr, *PkgName);
+		if (ExistingPkg)
+		{
+			ExistingPkg->FullyLoad();
+			UObject* ExistingObj = StaticFindObjectFast(nullptr, ExistingPkg, FName(*Job.NewAssetName));
+			if (ExistingObj)
+			{
+				ExistingObj->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+			}
+		}
+		UPackage* Package = CreatePackage(*PkgName);
+		Package->FullyLoad();
 
-	// Force skeleton AFTER bracket close (InitializeModel can reset it)
-	NewAnim->SetSkeleton(OutputSkeleton);
-	UE_LOG(LogSLFAutomation, Warning, TEXT("  Skeleton after bracket: %s (wanted: %s)"),
-		NewAnim->GetSkeleton() ? *NewAnim->GetSkeleton()->GetPathName() : TEXT("NULL"),
-		*OutputSkeleton->GetPathName());
+		UAnimSequence* NewAnim = NewObject<UAnimSequence>(Package, FName(*Job.NewAssetName), RF_Public | RF_Standalone);
+		NewAnim->SetSkeleton(Job.OutputSkeleton);
 
-	// Force root lock to first frame (prevents snap-back, Bug #17)
-	NewAnim->bForceRootLock = true;
-	NewAnim->RootMotionRootLock = ERootMotionRootLock::AnimFirstFrame;
+		// ── Phase 5: WRITE ──
+		IAnimationDataController& Controller = NewAnim->GetController();
+		Controller.OpenBracket(NSLOCTEXT("SLFAutomation", "BakeAnim", "Bake Animation"), false);
+		Controller.InitializeModel();
 
-	// DDC compression (CRITICAL for UE5.7 - Bug #11)
-	NewAnim->CacheDerivedDataForCurrentPlatform();
-	FAssetCompilingManager::Get().FinishAllCompilation();
+		FFrameRate OutFrameRate(FMath::RoundToInt32(Settings.TargetFrameRate), 1);
+		Controller.SetFrameRate(OutFrameRate, false);
+		Controller.SetNumberOfFrames(FFrameNumber(Job.OutputNumKeys - 1), false);
+
+		for (const FBakeTrack& Track : Job.Tracks)
+		{
+			Controller.AddBoneCurve(Track.BoneName, false);
+			Controller.SetBoneTrackKeys(Track.BoneName, Track.PosKeys, Track.RotKeys, Track.ScaleKeys, false);
+		}
+
+		Controller.NotifyPopulated();
+		Controller.CloseBracket(false);
+
+		// Keys are in the data model now
+		Job.Tracks.Empty();
+
+		// Force skeleton AFTER bracket close (InitializeModel can reset it)
+		NewAnim->SetSkeleton(Job.OutputSkeleton);
+		UE_LOG(LogSLFAutomation, Warning, TEXT("  Skeleton after bracket: %s (wanted: %s)"),
+			NewAnim->GetSkeleton() ? *NewAnim->GetSkeleton()->GetPathName() : TEXT("NULL"),
+			*Job.OutputSkeleton->GetPathName());
 
-	// Force skeleton again after DDC (compression may reset skeleton ref)
-	if (NewAnim->GetSkeleton() != OutputSkeleton)
+		// Force root lock to first frame (prevents snap-back, Bug #17)
+		NewAnim->bForceRootLock = true;
+		NewAnim->RootMotionRootLock = ERootMotionRootLock::AnimFirstFrame;
+
+		// DDC compression (CRITICAL for UE5.7 - Bug #11); the caller waits with FinishAllCompilation
+		NewAnim->CacheDerivedDataForCurrentPlatform();
+
+		Job.Package = Package;
+		Job.NewAnim = NewAnim;
+		Job.CommitSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	/** Game thread, after FinishAllCompilation: save the committed sequence */
+	void SaveBakedAnim(FBakeJob& Job)
 	{
-		UE_LOG(LogSLFAutomation, Warning, TEXT("  Skeleton was reset by DDC! Forcing back to: %s"), *OutputSkeleton->GetPathName());
-		NewAnim->SetSkeleton(OutputSkeleton);
+		const double StartTime = FPlatformTime::Seconds();
+		UAnimSequence* NewAnim = Job.NewAnim;
+		UPackage* Package = Job.Package;
+
+		// Force skeleton again after DDC (compression may reset skeleton ref)
+		if (NewAnim->GetSkeleton() != Job.OutputSkeleton)
+		{
+			UE_LOG(LogSLFAutomation, Warning, TEXT("  Skeleton was reset by DDC! Forcing back to: %s"), *Job.OutputSkeleton->GetPathName());
+			NewAnim->SetSkeleton(Job.OutputSkeleton);
+		}
+
+		// Save
+		FAssetRegistryModule::AssetCreated(NewAnim);
+		Package->MarkPackageDirty();
+		FString FileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Standalone;
+		Job.bSaved = UPackage::SavePackage(Package, NewAnim, *FileName, SaveArgs);
+
+		Job.Lines.Add(FString::Printf(TEXT("  Wrote %d bone tracks (%d skipped), %d frames"), Job.TracksAdded, Job.TracksSkipped, Job.OutputNumKeys));
+		Job.Lines.Add(FString::Printf(TEXT("  Save: %s -> %s"), Job.bSaved ? TEXT("SUCCESS") : TEXT("FAILED"), *Package->GetName()));
+		Job.SaveSeconds = FPlatformTime::Seconds() - StartTime;
 	}
+}
 
-	// Save
-	FAssetRegistryModule::AssetCreated(NewAnim);
-	Package->MarkPackageDirty();
-	FString FileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Standalone;
-	bool bSaved = UPackage::SavePackage(Package, NewAnim, *FileName, SaveArgs);
+// ── File-scope helper: core bake logic with bone name mapping support ──
+static FString BakeAnimationTransformsImpl(
+	const FString& SourceAnimPath,
+	const FString& OutputPath,
+	const FString& NewAssetName,
+	float NoiseAmplitudeDegrees,
+	float TimeWarpStrength,
+	FVector BoneRotationOffsetDegrees,
+	float TargetFrameRate,
+	int32 RandomSeed,
+	const FString& TargetSkeletonPath,
+	const TMap<FName, FName>& BoneNameMapping)
+{
+	FBakeJob Job;
+	Job.SourceAnimPath = SourceAnimPath;
+	Job.OutputPath = OutputPath;
+	Job.NewAssetName = NewAssetName;
+	Job.Lines.Add(FString::Printf(TEXT("=== BakeAnimationTransforms: %s -> %s/%s ==="),
+		*SourceAnimPath, *OutputPath, *NewAssetName));
 
-	Lines.Add(FString::Printf(TEXT("  Wrote %d bone tracks (%d skipped), %d frames"), TracksAdded, TracksSkipped, OutputNumKeys));
-	Lines.Add(FString::Printf(TEXT("  Save: %s -> %s"), bSaved ? TEXT("SUCCESS") : TEXT("FAILED"), *PkgName));
-	Lines.Add(TEXT("=== BakeAnimationTransforms COMPLETE ==="));
+	FBakeSettings Settings;
+	Settings.NoiseAmplitudeDegrees = NoiseAmplitudeDegrees;
+	Settings.TimeWarpStrength = TimeWarpStrength;
+	Settings.BoneRotationOffsetDegrees = BoneRotationOffsetDegrees;
+	Settings.TargetFrameRate = TargetFrameRate;
 
-	FString Result = FString::Join(Lines, TEXT("\n"));
+	USkeleton* TargetSkeleton = TargetSkeletonPath.IsEmpty() ? nullptr : LoadObject<USkeleton>(nullptr, *TargetSkeletonPath);
+	FBakeRetargetCache RetargetCache;
+	if (!ReadBakeSource(Job, TargetSkeletonPath, TargetSkeleton, BoneNameMapping, RetargetCache, RandomSeed))
+	{
+		return FString::Join(Job.Lines, TEXT("\n"));
+	}
+
+	ComputeBakeKeys(Job, Settings);
+	CommitBakeKeys(Job, Settings);
+	FAssetCompilingManager::Get().FinishAllCompilation();
+	SaveBakedAnim(Job);
+	Job.Lines.Add(TEXT("=== BakeAnimationTransforms COMPLETE ==="));
+
+	FString Result = FString::Join(Job.Lines, TEXT("\n"));
 	UE_LOG(LogSLFAutomation, Warning, TEXT("%s"), *Result);
 	return Result;
 }
@@ -14297,6 +14458,146 @@ FString USLFAutomationLibrary::BakeAnimWithBoneMapping(
 		BoneNameMapping);
 }
 
+// ── Batch bake (not UFUNCTION) ──
+FString USLFAutomationLibrary::BakeAnimationBatch(
+	const TArray<FSLFAnimBakeItem>& Items,
+	const FString& TargetSkeletonPath,
+	const TMap<FName, FName>& BoneNameMapping,
+	float NoiseAmplitudeDegrees,
+	float TimeWarpStrength,
+	FVector BoneRotationOffsetDegrees,
+	float TargetFrameRate,
+	int32 GroupSize)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	GroupSize = FMath::Max(1, GroupSize);
+
+	TArray<FString> Lines;
+	Lines.Add(FString::Printf(TEXT("=== BakeAnimationBatch: %d animations, groups of %d ==="), Items.Num(), GroupSize));
+
+	FBakeSettings Settings;
+	Settings.NoiseAmplitudeDegrees = NoiseAmplitudeDegrees;
+	Settings.TimeWarpStrength = TimeWarpStrength;
+	Settings.BoneRotationOffsetDegrees = BoneRotationOffsetDegrees;
+	Settings.TargetFrameRate = TargetFrameRate;
+
+	USkeleton* TargetSkeleton = TargetSkeletonPath.IsEmpty() ? nullptr : LoadObject<USkeleton>(nullptr, *TargetSkeletonPath);
+	if (!TargetSkeletonPath.IsEmpty() && !TargetSkeleton)
+	{
+		Lines.Add(FString::Printf(TEXT("WARNING: Target skeleton not found: %s, using source skeletons"), *TargetSkeletonPath));
+	}
+
+	// Jobs are heap-allocated so workers keep stable pointers while the array grows
+	TArray<TUniquePtr<FBakeJob>> Jobs;
+	Jobs.Reserve(Items.Num());
+	FBakeRetargetCache RetargetCache;
+	int32 Baked = 0;
+	int32 Failed = 0;
+	double CompileSeconds = 0.0;
+
+	// Keys of one group are computed on workers while the game thread commits the previous group
+	TArray<UE::Tasks::FTask> InFlight;
+	TArray<FBakeJob*> InFlightJobs;
+	auto CommitInFlight = [&]()
+	{
+		UE::Tasks::Wait(InFlight);
+		for (FBakeJob* Job : InFlightJobs)
+		{
+			CommitBakeKeys(*Job, Settings);
+		}
+
+		// One compile wait per group instead of one per sequence
+		const double CompileStart = FPlatformTime::Seconds();
+		FAssetCompilingManager::Get().FinishAllCompilation();
+		CompileSeconds += FPlatformTime::Seconds() - CompileStart;
+
+		for (FBakeJob* Job : InFlightJobs)
+		{
+			SaveBakedAnim(*Job);
+			if (Job->bSaved)
+			{
+				Baked++;
+			}
+			else
+			{
+				Failed++;
+			}
+			UE_LOG(LogSLFAutomation, Log, TEXT("%s"), *FString::Join(Job->Lines, TEXT("\n")));
+		}
+		InFlight.Reset();
+		InFlightJobs.Reset();
+	};
+
+	for (int32 GroupStart = 0; GroupStart < Items.Num(); GroupStart += GroupSize)
+	{
+		const int32 GroupEnd = FMath::Min(GroupStart + GroupSize, Items.Num());
+
+		TArray<FBakeJob*> GroupJobs;
+		for (int32 Index = GroupStart; Index < GroupEnd; ++Index)
+		{
+			const FSLFAnimBakeItem& Item = Items[Index];
+			FBakeJob& Job = *Jobs.Add_GetRef(MakeUnique<FBakeJob>());
+			Job.SourceAnimPath = Item.SourceAnimPath;
+			Job.OutputPath = Item.OutputPath;
+			Job.NewAssetName = Item.NewAssetName;
+			Job.Lines.Add(FString::Printf(TEXT("=== BakeAnimationTransforms: %s -> %s/%s ==="),
+				*Item.SourceAnimPath, *Item.OutputPath, *Item.NewAssetName));
+
+			const int32 MapsBefore = RetargetCache.Num();
+			if (!ReadBakeSource(Job, TargetSkeletonPath, TargetSkeleton, BoneNameMapping, RetargetCache, Item.RandomSeed))
+			{
+				Failed++;
+				UE_LOG(LogSLFAutomation, Error, TEXT("%s"), *FString::Join(Job.Lines, TEXT("\n")));
+				continue;
+			}
+			if (RetargetCache.Num() > MapsBefore)
+			{
+				Lines.Add(FString::Printf(TEXT("  Retarget map %s -> %s:"), *Job.SourceSkeleton->GetName(), *Job.OutputSkeleton->GetName()));
+				Lines.Append(Job.Retarget->Lines);
+			}
+			GroupJobs.Add(&Job);
+		}
+
+		// Previous group's keys are needed before this group's tasks are queued behind them
+		CommitInFlight();
+
+		for (FBakeJob* Job : GroupJobs)
+		{
+			InFlight.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Job, &Settings]()
+			{
+				ComputeBakeKeys(*Job, Settings);
+			}));
+		}
+		InFlightJobs = MoveTemp(GroupJobs);
+	}
+	CommitInFlight();
+
+	// ── Throughput per animation ──
+	for (int32 Index = 0; Index < Jobs.Num(); ++Index)
+	{
+		const FBakeJob& Job = *Jobs[Index];
+		if (!Job.NewAnim)
+		{
+			Lines.Add(FString::Printf(TEXT("  [%d/%d] %s: %s"), Index + 1, Items.Num(), *Job.SourceAnimPath, *Job.Lines.Last()));
+			continue;
+		}
+		Lines.Add(FString::Printf(TEXT("  [%d/%d] %s/%s: %d tracks x %d keys, seed %d | read %.0f ms, compute %.0f ms, commit %.0f ms, save %.0f ms | %s"),
+			Index + 1, Items.Num(), *Job.OutputPath, *Job.NewAssetName, Job.TracksAdded + Job.TracksSkipped, Job.OutputNumKeys, Job.Seed,
+			Job.ReadSeconds * 1000.0, Job.ComputeSeconds * 1000.0, Job.CommitSeconds * 1000.0, Job.SaveSeconds * 1000.0,
+			Job.bSaved ? TEXT("SUCCESS") : TEXT("SAVE FAILED")));
+	}
+
+	const double Elapsed = FPlatformTime::Seconds() - StartTime;
+	Lines.Add(FString::Printf(TEXT("Baked %d/%d animations in %.2f sec (%.2f anims/sec, %.0f ms per animation, %.2f sec compile wait), %d failed"),
+		Baked, Items.Num(), Elapsed, Elapsed > 0.0 ? Baked / Elapsed : 0.0, Items.Num() > 0 ? Elapsed * 1000.0 / Items.Num() : 0.0,
+		CompileSeconds, Failed));
+	Lines.Add(TEXT("=== BakeAnimationBatch COMPLETE ==="));
+
+	FString Result = FString::Join(Lines, TEXT("\n"));
+	UE_LOG(LogSLFAutomation, Warning, TEXT("%s"), *Result);
+	return Result;
+}
+
 FString USLFAutomationLibrary::DiagnoseSkeletonMismatch(
 	const FString& SkeletonPathA,
 	const FString& SkeletonPathB,
@@ -14735,6 +15036,10 @@ FString USLFAutomationLibrary::CompareAnimations(const FString& AnimPathA, const
 	DiagnoseOneAnim(AnimPathA, TEXT("AnimA"), Lines);
 	DiagnoseOneAnim(AnimPathB, TEXT("AnimB"), Lines);
 
+	Lines.Add(TEXT("\n--- Numeric (B vs A, local bone transforms) ---"));
+	FSLFAnimComparisonResult Numeric;
+	Lines.Add(CompareAnimationsNumeric(AnimPathA, AnimPathB, TMap<FName, FName>(), Numeric));
+
 	FString Result = FString::Join(Lines, TEXT("\n"));
 	UE_LOG(LogSLFAutomation, Warning, TEXT("%s"), *Result);
 	return Result;
@@ -15898,149 +16203,244 @@ FString USLFAutomationLibrary::CompareWalkAnimations()
 }
 
 // ============================================================================
-// DUMP ALL ANIMATION FRAMES TO JSON
+// DUMP ALL ANIMATION FRAMES (binary, JSON via converter)
 // ============================================================================
 
-FString USLFAutomationLibrary::DumpAnimAllFrames(const FString& AnimPath, const FString& OutputJsonPath)
+static bool SampleAnimFrames(const FString& AnimPath, FSLFAnimFrameDump& OutDump, FString& OutError)
 {
 	UAnimSequence* Anim = LoadObject<UAnimSequence>(nullptr, *AnimPath);
 	if (!Anim)
 	{
-		FString Err = FString::Printf(TEXT("ERROR: Failed to load animation: %s"), *AnimPath);
+		OutError = FString::Printf(TEXT("ERROR: Failed to load animation: %s"), *AnimPath);
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	FString SampleError;
+	if (!OutDump.Sample(*Anim, SampleError))
+	{
+		OutError = TEXT("ERROR: ") + SampleError;
+		return false;
+	}
+	OutDump.AnimationPath = AnimPath;
+
+	UE_LOG(LogTemp, Warning, TEXT("[DumpAnimAllFrames] %s: %d bones, %d frames, %.3f sec, %d tracks (sampled in %.1f ms)"),
+		*AnimPath, OutDump.BoneNames.Num(), OutDump.GetNumFrames(), OutDump.Duration, OutDump.TrackNames.Num(),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return true;
+}
+
+FString USLFAutomationLibrary::DumpAnimAllFrames(const FString& AnimPath, const FString& OutputJsonPath)
+{
+	FSLFAnimFrameDump Dump;
+	FString Err;
+	if (!SampleAnimFrames(AnimPath, Dump, Err))
+	{
 		UE_LOG(LogTemp, Error, TEXT("[DumpAnimAllFrames] %s"), *Err);
 		return Err;
 	}
 
-	USkeleton* Skel = Anim->GetSkeleton();
-	if (!Skel)
+	if (Dump.SaveAsJson(OutputJsonPath))
+	{
+		FString Summary = FString::Printf(
+			TEXT("SUCCESS: Dumped %d frames x %d tracks to %s (%.1f KB)"),
+			Dump.GetNumFrames(), Dump.TrackNames.Num(), *OutputJsonPath, IFileManager::Get().FileSize(*OutputJsonPath) / 1024.0f);
+		UE_LOG(LogTemp, Warning, TEXT("[DumpAnimAllFrames] %s"), *Summary);
+		return Summary;
+	}
+	else
 	{
-		FString Err = TEXT("ERROR: Animation has no skeleton");
+		Err = FString::Printf(TEXT("ERROR: Failed to write to %s"), *OutputJsonPath);
 		UE_LOG(LogTemp, Error, TEXT("[DumpAnimAllFrames] %s"), *Err);
 		return Err;
 	}
+}
 
-	IAnimationDataModel* DM = Anim->GetDataModel();
-	if (!DM)
+FString USLFAutomationLibrary::DumpAnimAllFramesBinary(const FString& AnimPath, const FString& OutputPath)
+{
+	FSLFAnimFrameDump Dump;
+	FString Err;
+	if (!SampleAnimFrames(AnimPath, Dump, Err))
 	{
-		FString Err = TEXT("ERROR: Animation has no DataModel");
 		UE_LOG(LogTemp, Error, TEXT("[DumpAnimAllFrames] %s"), *Err);
 		return Err;
 	}
 
-	const FReferenceSkeleton& RefSkel = Skel->GetReferenceSkeleton();
-	int32 NumBones = RefSkel.GetNum();
-	int32 NumFrames = DM->GetNumberOfFrames();
-	double Duration = Anim->GetPlayLength();
-	FFrameRate FR = DM->GetFrameRate();
+	if (!Dump.Save(OutputPath))
+	{
+		Err = FString::Printf(TEXT("ERROR: Failed to write to %s"), *OutputPath);
+		UE_LOG(LogTemp, Error, TEXT("[DumpAnimAllFrames] %s"), *Err);
+		return Err;
+	}
 
-	TArray<FName> TrackNames;
-	DM->GetBoneTrackNames(TrackNames);
+	FString Summary = FString::Printf(
+		TEXT("SUCCESS: Dumped %d frames x %d tracks to %s (%.1f KB)"),
+		Dump.GetNumFrames(), Dump.TrackNames.Num(), *OutputPath, IFileManager::Get().FileSize(*OutputPath) / 1024.0f);
+	UE_LOG(LogTemp, Warning, TEXT("[DumpAnimAllFrames] %s"), *Summary);
+	return Summary;
+}
 
-	UE_LOG(LogTemp, Warning, TEXT("[DumpAnimAllFrames] %s: %d bones, %d frames, %.3f sec, %d tracks"),
-		*AnimPath, NumBones, NumFrames, Duration, TrackNames.Num());
+FString USLFAutomationLibrary::ConvertAnimFrameDumpToJson(const FString& DumpPath, const FString& OutputJsonPath)
+{
+	FSLFAnimFrameDump Dump;
+	FString Err;
+	if (!Dump.Load(DumpPath, &Err))
+	{
+		Err = TEXT("ERROR: ") + Err;
+		UE_LOG(LogTemp, Error, TEXT("[DumpAnimAllFrames] %s"), *Err);
+		return Err;
+	}
+
+	if (!Dump.SaveAsJson(OutputJsonPath))
+	{
+		Err = FString::Printf(TEXT("ERROR: Failed to write to %s"), *OutputJsonPath);
+		UE_LOG(LogTemp, Error, TEXT("[DumpAnimAllFrames] %s"), *Err);
+		return Err;
+	}
+
+	FString Summary = FString::Printf(TEXT("SUCCESS: Converted %s to %s"), *DumpPath, *OutputJsonPath);
+	UE_LOG(LogTemp, Warning, TEXT("[DumpAnimAllFrames] %s"), *Summary);
+	return Summary;
+}
 
-	// Build JSON manually for maximum control
-	FString Json;
-	Json.Reserve(NumFrames * NumBones * 200); // Pre-allocate
+// ============================================================================
+// NUMERIC ANIMATION COMPARISON
+// ============================================================================
 
-	Json += TEXT("{\n");
-	Json += FString::Printf(TEXT("  \"animation\": \"%s\",\n"), *AnimPath);
-	Json += FString::Printf(TEXT("  \"skeleton\": \"%s\",\n"), *Skel->GetPathName());
-	Json += FString::Printf(TEXT("  \"bone_count\": %d,\n"), NumBones);
-	Json += FString::Printf(TEXT("  \"track_count\": %d,\n"), TrackNames.Num());
-	Json += FString::Printf(TEXT("  \"frame_count\": %d,\n"), NumFrames);
-	Json += FString::Printf(TEXT("  \"duration\": %.6f,\n"), Duration);
-	Json += FString::Printf(TEXT("  \"frame_rate_num\": %d,\n"), FR.Numerator);
-	Json += FString::Printf(TEXT("  \"frame_rate_den\": %d,\n"), FR.Denominator);
+FString USLFAutomationLibrary::CompareAnimationsNumeric(
+	const FString& AnimPathA,
+	const FString& AnimPathB,
+	const TMap<FName, FName>& BoneNameMapping,
+	FSLFAnimComparisonResult& OutResult,
+	const FString& CsvPath,
+	float FrameRate,
+	bool bNormalizeTime)
+{
+	FSLFAnimFrameDump DumpA;
+	FSLFAnimFrameDump DumpB;
+	FString Err;
+	if (!SampleAnimFrames(AnimPathA, DumpA, Err) || !SampleAnimFrames(AnimPathB, DumpB, Err))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CompareAnimationsNumeric] %s"), *Err);
+		return Err;
+	}
 
-	// Bone info array (names, parent indices)
-	Json += TEXT("  \"bones\": [\n");
-	for (int32 i = 0; i < NumBones; i++)
+	FSLFAnimCompareOptions Options;
+	Options.FrameRate = FrameRate;
+	Options.bNormalizeTime = bNormalizeTime;
+	Options.BoneNameMapping = BoneNameMapping;
+	if (!FSLFAnimComparison::Compare(DumpA, DumpB, Options, OutResult, Err))
 	{
-		FName BoneName = RefSkel.GetBoneName(i);
-		int32 ParentIdx = RefSkel.GetParentIndex(i);
-		Json += FString::Printf(TEXT("    {\"index\": %d, \"name\": \"%s\", \"parent\": %d}%s\n"),
-			i, *BoneName.ToString(), ParentIdx,
-			(i < NumBones - 1) ? TEXT(",") : TEXT(""));
-	}
-	Json += TEXT("  ],\n");
-
-	// Reference pose
-	Json += TEXT("  \"ref_pose\": [\n");
-	const TArray<FTransform>& RefPose = RefSkel.GetRefBonePose();
-	for (int32 i = 0; i < NumBones; i++)
-	{
-		const FTransform& T = RefPose[i];
-		FVector Pos = T.GetTranslation();
-		FQuat Rot = T.GetRotation();
-		FVector Scale = T.GetScale3D();
-		Json += FString::Printf(
-			TEXT("    {\"bone\": \"%s\", \"pos\": [%.8f, %.8f, %.8f], \"rot\": [%.8f, %.8f, %.8f, %.8f], \"scale\": [%.8f, %.8f, %.8f]}%s\n"),
-			*RefSkel.GetBoneName(i).ToString(),
-			Pos.X, Pos.Y, Pos.Z,
-			Rot.X, Rot.Y, Rot.Z, Rot.W,
-			Scale.X, Scale.Y, Scale.Z,
-			(i < NumBones - 1) ? TEXT(",") : TEXT(""));
+		Err = TEXT("ERROR: ") + Err;
+		UE_LOG(LogTemp, Error, TEXT("[CompareAnimationsNumeric] %s"), *Err);
+		return Err;
 	}
-	Json += TEXT("  ],\n");
 
-	// Track names (bones that have animation data)
-	Json += TEXT("  \"track_names\": [\n");
-	for (int32 i = 0; i < TrackNames.Num(); i++)
+	FString Summary = OutResult.ToSummary();
+	if (!CsvPath.IsEmpty())
 	{
-		Json += FString::Printf(TEXT("    \"%s\"%s\n"),
-			*TrackNames[i].ToString(),
-			(i < TrackNames.Num() - 1) ? TEXT(",") : TEXT(""));
+		const FString FrameCsvPath = FPaths::GetPath(CsvPath) / FPaths::GetBaseFilename(CsvPath) + TEXT("_frames.csv");
+		if (FSLFAnimComparison::SaveBoneCsv(OutResult, CsvPath) && FSLFAnimComparison::SaveFrameCsv(OutResult, FrameCsvPath))
+		{
+			Summary += FString::Printf(TEXT("\nCSV: %s, %s"), *CsvPath, *FrameCsvPath);
+		}
+		else
+		{
+			Summary += FString::Printf(TEXT("\nERROR: Failed to write %s"), *CsvPath);
+		}
 	}
-	Json += TEXT("  ],\n");
 
-	// Frames array - for each frame, dump all bone local transforms
-	Json += TEXT("  \"frames\": [\n");
-	for (int32 f = 0; f < NumFrames; f++)
+	UE_LOG(LogTemp, Log, TEXT("[CompareAnimationsNumeric] %s vs %s\n%s"), *AnimPathA, *AnimPathB, *Summary);
+	return Summary;
+}
+
+FString USLFAutomationLibrary::CompareAnimationBatch(
+	const TArray<FString>& AnimPathsA,
+	const TArray<FString>& AnimPathsB,
+	const TMap<FName, FName>& BoneNameMapping,
+	const FString& ReportCsvPath,
+	float PositionTolerance,
+	float RotationToleranceDegrees,
+	bool bNormalizeTime)
+{
+	if (AnimPathsA.Num() != AnimPathsB.Num())
 	{
-		Json += TEXT("    {\n");
-		Json += FString::Printf(TEXT("      \"frame\": %d,\n"), f);
-		Json += TEXT("      \"bones\": {\n");
+		return FString::Printf(TEXT("ERROR: %d source animations but %d compared animations"), AnimPathsA.Num(), AnimPathsB.Num());
+	}
 
-		int32 TrackIdx = 0;
-		for (const FName& TN : TrackNames)
-		{
-			FTransform T = DM->GetBoneTrackTransform(TN, FFrameNumber(f));
-			FVector Pos = T.GetTranslation();
-			FQuat Rot = T.GetRotation();
-			FVector Scale = T.GetScale3D();
+	FSLFAnimCompareOptions Options;
+	Options.bNormalizeTime = bNormalizeTime;
+	Options.BoneNameMapping = BoneNameMapping;
 
-			Json += FString::Printf(
-				TEXT("        \"%s\": {\"pos\": [%.8f, %.8f, %.8f], \"rot\": [%.8f, %.8f, %.8f, %.8f], \"scale\": [%.8f, %.8f, %.8f]}%s\n"),
-				*TN.ToString(),
-				Pos.X, Pos.Y, Pos.Z,
-				Rot.X, Rot.Y, Rot.Z, Rot.W,
-				Scale.X, Scale.Y, Scale.Z,
-				(TrackIdx < TrackNames.Num() - 1) ? TEXT(",") : TEXT(""));
-			TrackIdx++;
+	FString Csv = TEXT("anim_a,anim_b,frames,bones,max_pos,rms_pos,max_rot_deg,rms_rot_deg,worst_bone,result\n");
+	int32 Passed = 0;
+	int32 Failed = 0;
+	int32 Errors = 0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	for (int32 Index = 0; Index < AnimPathsA.Num(); ++Index)
+	{
+		// One pair in memory at a time; each dump is sampled and compared in parallel internally
+		FSLFAnimFrameDump DumpA;
+		FSLFAnimFrameDump DumpB;
+		FSLFAnimComparisonResult Result;
+		FString Err;
+		const bool bCompared = SampleAnimFrames(AnimPathsA[Index], DumpA, Err)
+			&& SampleAnimFrames(AnimPathsB[Index], DumpB, Err)
+			&& FSLFAnimComparison::Compare(DumpA, DumpB, Options, Result, Err);
+		if (!bCompared)
+		{
+			Errors++;
+			UE_LOG(LogTemp, Error, TEXT("[CompareAnimationBatch] %s vs %s: %s"), *AnimPathsA[Index], *AnimPathsB[Index], *Err);
+			Csv += FString::Printf(TEXT("%s,%s,0,0,0,0,0,0,,ERROR\n"), *AnimPathsA[Index], *AnimPathsB[Index]);
+			continue;
 		}
 
-		Json += TEXT("      }\n");
-		Json += (f < NumFrames - 1) ? TEXT("    },\n") : TEXT("    }\n");
-	}
-	Json += TEXT("  ]\n");
-	Json += TEXT("}\n");
+		const bool bWithin = Result.IsWithin(PositionTolerance, RotationToleranceDegrees);
+		if (bWithin)
+		{
+			Passed++;
+		}
+		else
+		{
+			Failed++;
+		}
 
-	// Write to file
-	if (FFileHelper::SaveStringToFile(Json, *OutputJsonPath))
-	{
-		FString Summary = FString::Printf(
-			TEXT("SUCCESS: Dumped %d frames x %d tracks to %s (%.1f KB)"),
-			NumFrames, TrackNames.Num(), *OutputJsonPath, Json.Len() / 1024.0f);
-		UE_LOG(LogTemp, Warning, TEXT("[DumpAnimAllFrames] %s"), *Summary);
-		return Summary;
+		const FSLFBoneErrorStats* WorstBone = nullptr;
+		for (const FSLFBoneErrorStats& Bone : Result.Bones)
+		{
+			if (!WorstBone || Bone.MaxRotationDegrees > WorstBone->MaxRotationDegrees)
+			{
+				WorstBone = &Bone;
+			}
+		}
+		Csv += FString::Printf(TEXT("%s,%s,%d,%d,%.6f,%.6f,%.6f,%.6f,%s,%s\n"),
+			*AnimPathsA[Index], *AnimPathsB[Index], Result.NumFrames, Result.Bones.Num(),
+			Result.Overall.MaxPosition, Result.Overall.RmsPosition,
+			Result.Overall.MaxRotationDegrees, Result.Overall.RmsRotationDegrees,
+			WorstBone ? *WorstBone->BoneB.ToString() : TEXT(""),
+			bWithin ? TEXT("PASS") : TEXT("FAIL"));
 	}
-	else
+
+	const double Elapsed = FPlatformTime::Seconds() - StartTime;
+	FString Summary = FString::Printf(
+		TEXT("Compared %d animation pairs in %.2f sec: %d within tolerance (%.3f cm, %.3f deg), %d over, %d errors"),
+		AnimPathsA.Num(), Elapsed, Passed, PositionTolerance, RotationToleranceDegrees, Failed, Errors);
+
+	if (!ReportCsvPath.IsEmpty())
 	{
-		FString Err = FString::Printf(TEXT("ERROR: Failed to write to %s"), *OutputJsonPath);
-		UE_LOG(LogTemp, Error, TEXT("[DumpAnimAllFrames] %s"), *Err);
-		return Err;
+		if (FFileHelper::SaveStringToFile(Csv, *ReportCsvPath))
+		{
+			Summary += FString::Printf(TEXT("\nReport: %s"), *ReportCsvPath);
+		}
+		else
+		{
+			Summary += FString::Printf(TEXT("\nERROR: Failed to write %s"), *ReportCsvPath);
+		}
 	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[CompareAnimationBatch] %s"), *Summary);
+	return (Failed == 0 && Errors == 0 ? TEXT("SUCCESS: ") : TEXT("FAILED: ")) + Summary;
 }
 
 // ============================================================================
@@ -7,6 +7,19 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "SLFAutomationLibrary.generated.h"
 
+struct FSLFAnimComparisonResult;
+
+/** One animation of a BakeAnimationBatch */
+struct FSLFAnimBakeItem
+{
+	FString SourceAnimPath;
+	FString OutputPath;
+	FString NewAssetName;
+
+	/** Deterministic seed for this item's noise (0 = random) */
+	int32 RandomSeed = 0;
+};
+
 UCLASS()
 class SLFCONVERSION_API USLFAutomationLibrary : public UBlueprintFunctionLibrary
 {
@@ -169,8 +182,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SLF Automation|Export")
 	static FString ExportAnimGraphState(UObject* AnimBlueprintAsset, const FString& OutputFilePath = TEXT(""));
 
+	// Structural diff keyed by node GUID / graph / pin name when both files parse as JSON, aligned line diff otherwise.
+	// With DiffOutputPath the report is streamed to that file and only the summary is returned.
 	UFUNCTION(BlueprintCallable, Category = "SLF Automation|Export")
-	static FString DiffBlueprintStates(const FString& BeforeJsonPath, const FString& AfterJsonPath);
+	static FString DiffBlueprintStates(const FString& BeforeJsonPath, const FString& AfterJsonPath, const FString& DiffOutputPath = TEXT(""));
 
 	UFUNCTION(BlueprintCallable, Category = "SLF Automation|AnimBP")
 	static int32 FixAnimBPFromReference(UObject* AnimBlueprintAsset, const FString& ReferenceJsonPath);
@@ -945,6 +960,29 @@ public:
 		int32 RandomSeed = 0
 	);
 
+	/**
+	 * Bake many animations with shared noise / time-warp / offset settings.
+	 * Same output per item as BakeAnimWithBoneMapping with the item's seed. Source bones are
+	 * read on the game thread, keys computed on worker threads, and each group of GroupSize
+	 * sequences committed, compressed and saved together while the next group computes.
+	 * The target-skeleton bone mapping is built once per source skeleton.
+	 * NOT a UFUNCTION - use for C++ commandlet calls.
+	 *
+	 * @param TargetSkeletonPath - Output skeleton for every item ("" = each source's own skeleton)
+	 * @param BoneNameMapping - Maps target bone name -> source bone name
+	 * @return Per-animation timings and overall throughput
+	 */
+	static FString BakeAnimationBatch(
+		const TArray<FSLFAnimBakeItem>& Items,
+		const FString& TargetSkeletonPath,
+		const TMap<FName, FName>& BoneNameMapping,
+		float NoiseAmplitudeDegrees = 2.0f,
+		float TimeWarpStrength = 0.15f,
+		FVector BoneRotationOffsetDegrees = FVector(0.f, 10.f, 0.f),
+		float TargetFrameRate = 24.0f,
+		int32 GroupSize = 8
+	);
+
 	/**
 	 * Apply forensic transforms (noise, time warp, resample) to an EXISTING animation in-place.
 	 * Unlike BakeAnimationTransforms, this does NOT do cross-skeleton retarget.
@@ -984,9 +1022,45 @@ public:
 	 * Reports which bones have non-identity transforms at frame 0 and mid-frame. */
 	static FString DiagnoseAnimDataModel(const FString& AnimPath);
 
-	/** Deep comparison of two animations - compares skeleton, DataModel, and compressed evaluation */
+	/** Deep comparison of two animations - compares skeleton, DataModel, and compressed evaluation,
+	 * followed by the CompareAnimationsNumeric summary */
 	static FString CompareAnimations(const FString& AnimPathA, const FString& AnimPathB);
 
+	/**
+	 * Per-bone and per-frame error of B against A (position cm, rotation degrees; max and RMS),
+	 * both sampled at a common frame rate.
+	 * @param BoneNameMapping - Target (B) bone name -> source (A) bone name, as for BakeAnimWithBoneMapping
+	 * @param OutResult - Full numeric result
+	 * @param CsvPath - Optional per-bone CSV; per-frame rows go to <name>_frames.csv beside it
+	 * @param FrameRate - Common sample rate (0 = the higher of the two)
+	 * @param bNormalizeTime - Sample each over its own length (time-warped bakes)
+	 * @return Summary with the worst bones, or "ERROR: ..."
+	 */
+	static FString CompareAnimationsNumeric(
+		const FString& AnimPathA,
+		const FString& AnimPathB,
+		const TMap<FName, FName>& BoneNameMapping,
+		FSLFAnimComparisonResult& OutResult,
+		const FString& CsvPath = TEXT(""),
+		float FrameRate = 0.0f,
+		bool bNormalizeTime = false
+	);
+
+	/**
+	 * Regression check over many animation pairs (AnimPathsA[i] vs AnimPathsB[i]).
+	 * Writes one CSV row per pair with the overall errors and PASS / FAIL / ERROR.
+	 * @return "SUCCESS: ..." when every pair is within both tolerances, otherwise "FAILED: ..."
+	 */
+	static FString CompareAnimationBatch(
+		const TArray<FString>& AnimPathsA,
+		const TArray<FString>& AnimPathsB,
+		const TMap<FName, FName>& BoneNameMapping,
+		const FString& ReportCsvPath,
+		float PositionTolerance = 0.5f,
+		float RotationToleranceDegrees = 1.0f,
+		bool bNormalizeTime = false
+	);
+
 	/**
 	 * Place a Blueprint actor in a level (editor-time, no BeginPlay)
 	 * @param MapPath - UE content path to the map (e.g., /Game/.../L_Demo_Showcase)
@@ -1038,7 +1112,7 @@ public:
 
 	/**
 	 * Dump ALL frames of a given animation to JSON.
-	 * For each frame: bone local transforms (pos xyz, rot xyzw, scale xyz).
+	 * For each frame: bone local transforms (pos xyz, rot xyzw, scale xyz), sampled as float32.
 	 * Includes ref pose, bone names, parent indices, frame count, duration.
 	 * @param AnimPath - UE content path to the AnimSequence
 	 * @param OutputJsonPath - Filesystem path for output JSON file
@@ -1046,6 +1120,23 @@ public:
 	 */
 	static FString DumpAnimAllFrames(const FString& AnimPath, const FString& OutputJsonPath);
 
+	/**
+	 * Same data as DumpAnimAllFrames, written as a binary FSLFAnimFrameDump
+	 * (float32 channel arrays per bone track). Track keys are read serially from the data model;
+	 * only the double -> float32 channel conversion runs in parallel across tracks.
+	 * Read it back with FSLFAnimFrameDump::Load, or convert with ConvertAnimFrameDumpToJson.
+	 * @param AnimPath - UE content path to the AnimSequence
+	 * @param OutputPath - Filesystem path for the dump file
+	 * @return Result summary string
+	 */
+	static FString DumpAnimAllFramesBinary(const FString& AnimPath, const FString& OutputPath);
+
+	/**
+	 * Write a binary frame dump out in the DumpAnimAllFrames JSON layout.
+	 * @return Result summary string
+	 */
+	static FString ConvertAnimFrameDumpToJson(const FString& DumpPath, const FString& OutputJsonPath);
+
 #endif // WITH_EDITOR
 
 	/**
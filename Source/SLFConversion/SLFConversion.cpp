@@ -2322,11 +2322,13 @@ static FAutoConsoleCommand GenerateOverlayCmd(
 static FAutoConsoleCommand BuildCaveMazeCmd(
 	TEXT("SLF.BuildCaveMaze"),
 	TEXT("Build wall geometry from layout JSON (ray-traces floor/ceiling).\n"
-		 "Usage: SLF.BuildCaveMaze [DungeonIndex=2]"),
+		 "Usage: SLF.BuildCaveMaze [DungeonIndex=2] [instanced]"),
 	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
 	{
 		int32 DungeonIndex = 1;
 		if (Args.Num() >= 1) DungeonIndex = FCString::Atoi(*Args[0]) - 1;
+		const ESLFCaveWallOutput Output = (Args.Num() >= 2 && Args[1].Equals(TEXT("instanced"), ESearchCase::IgnoreCase))
+			? ESLFCaveWallOutput::Instanced : ESLFCaveWallOutput::Actors;
 
 		UWorld* World = nullptr;
 		if (GEditor && GEditor->GetEditorWorldContext().World())
@@ -2340,7 +2342,7 @@ static FAutoConsoleCommand BuildCaveMazeCmd(
 			return;
 		}
 
-		FSLFCaveMazeBuilder::BuildCaveMaze(World, DungeonIndex);
+		FSLFCaveMazeBuilder::BuildCaveMaze(World, DungeonIndex, Output);
 	})
 );
 
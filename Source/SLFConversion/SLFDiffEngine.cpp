@@ -0,0 +1,716 @@
+// SLFDiffEngine.cpp
+// Line and structural diff for migration validation reports
+
+#include "SLFDiffEngine.h"
+#include "Algo/AllOf.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Hash/CityHash.h"
+#include "Misc/StringBuilder.h"
+
+#if WITH_EDITOR
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#endif
+
+namespace
+{
+	/**
+	 * Marks the lines of Old / New that are not part of the common subsequence.
+	 * Myers' linear-space bisection (middle snake), optionally inside patience anchors;
+	 * the V vectors are allocated once per diff and reused by every subproblem.
+	 */
+	class FLineAligner
+	{
+	public:
+		FLineAligner(TConstArrayView<int32> InOld, TConstArrayView<int32> InNew)
+			: Old(InOld)
+			, New(InNew)
+			, OldChanged(false, InOld.Num())
+			, NewChanged(false, InNew.Num())
+		{
+			const int32 MaxD = (Old.Num() + New.Num() + 1) / 2;
+			ForwardV.SetNumUninitialized(2 * MaxD + 2);
+			ReverseV.SetNumUninitialized(2 * MaxD + 2);
+		}
+
+		void Run(ESLFDiffAlgorithm Algorithm)
+		{
+			if (Algorithm == ESLFDiffAlgorithm::Patience)
+			{
+				Patience(0, Old.Num(), 0, New.Num());
+			}
+			else
+			{
+				Myers(0, Old.Num(), 0, New.Num());
+			}
+		}
+
+		TArray<FSLFDiffRun> ToRuns() const
+		{
+			TArray<FSLFDiffRun> Runs;
+			int32 OldIndex = 0;
+			int32 NewIndex = 0;
+			while (OldIndex < Old.Num() || NewIndex < New.Num())
+			{
+				FSLFDiffRun& Run = Runs.AddDefaulted_GetRef();
+				Run.OldStart = OldIndex;
+				Run.NewStart = NewIndex;
+
+				if (OldIndex < Old.Num() && OldChanged[OldIndex])
+				{
+					Run.Op = ESLFDiffOp::Delete;
+					while (OldIndex < Old.Num() && OldChanged[OldIndex])
+					{
+						++OldIndex;
+						++Run.Count;
+					}
+				}
+				else if (NewIndex < New.Num() && NewChanged[NewIndex])
+				{
+					Run.Op = ESLFDiffOp::Insert;
+					while (NewIndex < New.Num() && NewChanged[NewIndex])
+					{
+						++NewIndex;
+						++Run.Count;
+					}
+				}
+				else
+				{
+					Run.Op = ESLFDiffOp::Equal;
+					while (OldIndex < Old.Num() && NewIndex < New.Num() && !OldChanged[OldIndex] && !NewChanged[NewIndex])
+					{
+						++OldIndex;
+						++NewIndex;
+						++Run.Count;
+					}
+				}
+			}
+			return Runs;
+		}
+
+	private:
+		void MarkChanged(int32 OldLo, int32 OldHi, int32 NewLo, int32 NewHi)
+		{
+			for (int32 Index = OldLo; Index < OldHi; ++Index)
+			{
+				OldChanged[Index] = true;
+			}
+			for (int32 Index = NewLo; Index < NewHi; ++Index)
+			{
+				NewChanged[Index] = true;
+			}
+		}
+
+		/** Shrink the range by its common prefix and suffix; false if nothing is left to align */
+		bool TrimCommon(int32& OldLo, int32& OldHi, int32& NewLo, int32& NewHi) const
+		{
+			while (OldLo < OldHi && NewLo < NewHi && Old[OldLo] == New[NewLo])
+			{
+				++OldLo;
+				++NewLo;
+			}
+			while (OldLo < OldHi && NewLo < NewHi && Old[OldHi - 1] == New[NewHi - 1])
+			{
+				--OldHi;
+				--NewHi;
+			}
+			return OldLo < OldHi && NewLo < NewHi;
+		}
+
+		void Patience(int32 OldLo, int32 OldHi, int32 NewLo, int32 NewHi)
+		{
+			if (!TrimCommon(OldLo, OldHi, NewLo, NewHi))
+			{
+				MarkChanged(OldLo, OldHi, NewLo, NewHi);
+				return;
+			}
+
+			// Lines occurring exactly once on each side of this range
+			struct FOccurrence
+			{
+				int32 OldCount = 0;
+				int32 NewCount = 0;
+				int32 OldIndex = INDEX_NONE;
+				int32 NewIndex = INDEX_NONE;
+			};
+			TMap<int32, FOccurrence> Occurrences;
+			for (int32 Index = OldLo; Index < OldHi; ++Index)
+			{
+				FOccurrence& Occurrence = Occurrences.FindOrAdd(Old[Index]);
+				++Occurrence.OldCount;
+				Occurrence.OldIndex = Index;
+			}
+			for (int32 Index = NewLo; Index < NewHi; ++Index)
+			{
+				if (FOccurrence* Occurrence = Occurrences.Find(New[Index]))
+				{
+					++Occurrence->NewCount;
+					Occurrence->NewIndex = Index;
+				}
+			}
+
+			TArray<TPair<int32, int32>> Unique;
+			for (int32 Index = OldLo; Index < OldHi; ++Index)
+			{
+				const FOccurrence& Occurrence = Occurrences.FindChecked(Old[Index]);
+				if (Occurrence.OldCount == 1 && Occurrence.NewCount == 1)
+				{
+					Unique.Emplace(Index, Occurrence.NewIndex);
+				}
+			}
+			if (Unique.Num() == 0)
+			{
+				Myers(OldLo, OldHi, NewLo, NewHi);
+				return;
+			}
+
+			// Longest increasing run of new-side indices (patience sort with back links)
+			TArray<int32> PileTops;
+			TArray<int32> Previous;
+			Previous.SetNumUninitialized(Unique.Num());
+			for (int32 Index = 0; Index < Unique.Num(); ++Index)
+			{
+				const int32 Pile = Algo::LowerBoundBy(PileTops, Unique[Index].Value,
+					[&Unique](int32 Top) { return Unique[Top].Value; });
+				Previous[Index] = Pile > 0 ? PileTops[Pile - 1] : INDEX_NONE;
+				if (Pile == PileTops.Num())
+				{
+					PileTops.Add(Index);
+				}
+				else
+				{
+					PileTops[Pile] = Index;
+				}
+			}
+
+			TArray<int32> Anchors;
+			for (int32 Index = PileTops.Last(); Index != INDEX_NONE; Index = Previous[Index])
+			{
+				Anchors.Add(Index);
+			}
+
+			int32 OldCursor = OldLo;
+			int32 NewCursor = NewLo;
+			for (int32 AnchorIndex = Anchors.Num() - 1; AnchorIndex >= 0; --AnchorIndex)
+			{
+				const TPair<int32, int32>& Anchor = Unique[Anchors[AnchorIndex]];
+				Patience(OldCursor, Anchor.Key, NewCursor, Anchor.Value);
+				OldCursor = Anchor.Key + 1;
+				NewCursor = Anchor.Value + 1;
+			}
+			Patience(OldCursor, OldHi, NewCursor, NewHi);
+		}
+
+		void Myers(int32 OldLo, int32 OldHi, int32 NewLo, int32 NewHi)
+		{
+			if (!TrimCommon(OldLo, OldHi, NewLo, NewHi))
+			{
+				MarkChanged(OldLo, OldHi, NewLo, NewHi);
+				return;
+			}
+
+			int32 SplitOld = 0;
+			int32 SplitNew = 0;
+			const bool bSplit = FindMiddleSnake(OldLo, OldHi, NewLo, NewHi, SplitOld, SplitNew);
+
+			// A split on a corner would recurse on the same range; treat it as a full replacement
+			const bool bProgress = bSplit
+				&& (SplitOld > OldLo || SplitNew > NewLo)
+				&& (SplitOld < OldHi || SplitNew < NewHi);
+			if (!bProgress)
+			{
+				MarkChanged(OldLo, OldHi, NewLo, NewHi);
+				return;
+			}
+
+			Myers(OldLo, SplitOld, NewLo, SplitNew);
+			Myers(SplitOld, OldHi, SplitNew, NewHi);
+		}
+
+		/** Point where the forward and reverse D-paths overlap (range must not share a prefix or suffix) */
+		bool FindMiddleSnake(int32 OldLo, int32 OldHi, int32 NewLo, int32 NewHi, int32& OutOld, int32& OutNew)
+		{
+			const int32 N = OldHi - OldLo;
+			const int32 M = NewHi - NewLo;
+			const int32 MaxD = (N + M + 1) / 2;
+			const int32 VOffset = MaxD;
+			const int32 VLength = 2 * MaxD + 2;
+			int32* V1 = ForwardV.GetData();
+			int32* V2 = ReverseV.GetData();
+			for (int32 Index = 0; Index < VLength; ++Index)
+			{
+				V1[Index] = -1;
+				V2[Index] = -1;
+			}
+			V1[VOffset + 1] = 0;
+			V2[VOffset + 1] = 0;
+
+			const int32 Delta = N - M;
+			const bool bFront = (Delta % 2) != 0;
+			int32 K1Start = 0;
+			int32 K1End = 0;
+			int32 K2Start = 0;
+			int32 K2End = 0;
+
+			for (int32 D = 0; D < MaxD; ++D)
+			{
+				for (int32 K1 = -D + K1Start; K1 <= D - K1End; K1 += 2)
+				{
+					const int32 K1Offset = VOffset + K1;
+					int32 X1 = (K1 == -D || (K1 != D && V1[K1Offset - 1] < V1[K1Offset + 1])) ? V1[K1Offset + 1] : V1[K1Offset - 1] + 1;
+					int32 Y1 = X1 - K1;
+					while (X1 < N && Y1 < M && Old[OldLo + X1] == New[NewLo + Y1])
+					{
+						++X1;
+						++Y1;
+					}
+					V1[K1Offset] = X1;
+
+					if (X1 > N)
+					{
+						K1End += 2;
+					}
+					else if (Y1 > M)
+					{
+						K1Start += 2;
+					}
+					else if (bFront)
+					{
+						const int32 K2Offset = VOffset + Delta - K1;
+						if (K2Offset >= 0 && K2Offset < VLength && V2[K2Offset] != -1 && X1 >= N - V2[K2Offset])
+						{
+							OutOld = OldLo + X1;
+							OutNew = NewLo + Y1;
+							return true;
+						}
+					}
+				}
+
+				for (int32 K2 = -D + K2Start; K2 <= D - K2End; K2 += 2)
+				{
+					const int32 K2Offset = VOffset + K2;
+					int32 X2 = (K2 == -D || (K2 != D && V2[K2Offset - 1] < V2[K2Offset + 1])) ? V2[K2Offset + 1] : V2[K2Offset - 1] + 1;
+					int32 Y2 = X2 - K2;
+					while (X2 < N && Y2 < M && Old[OldHi - X2 - 1] == New[NewHi - Y2 - 1])
+					{
+						++X2;
+						++Y2;
+					}
+					V2[K2Offset] = X2;
+
+					if (X2 > N)
+					{
+						K2End += 2;
+					}
+					else if (Y2 > M)
+					{
+						K2Start += 2;
+					}
+					else if (!bFront)
+					{
+						const int32 K1Offset = VOffset + Delta - K2;
+						if (K1Offset >= 0 && K1Offset < VLength && V1[K1Offset] != -1)
+						{
+							const int32 X1 = V1[K1Offset];
+							const int32 Y1 = VOffset + X1 - K1Offset;
+							if (X1 >= N - X2)
+							{
+								OutOld = OldLo + X1;
+								OutNew = NewLo + Y1;
+								return true;
+							}
+						}
+					}
+				}
+			}
+			return false;
+		}
+
+		TConstArrayView<int32> Old;
+		TConstArrayView<int32> New;
+		TBitArray<> OldChanged;
+		TBitArray<> NewChanged;
+		TArray<int32> ForwardV;
+		TArray<int32> ReverseV;
+	};
+
+	void WritePrefixedLine(FArchive& Report, const TCHAR* Prefix, FStringView Line)
+	{
+		TStringBuilder<512> Builder;
+		Builder << Prefix << Line;
+		FSLFDiffEngine::WriteLine(Report, Builder);
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// SEQUENCES
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void FSLFDiffEngine::SplitLines(FStringView Text, TArray<FStringView>& OutLines)
+{
+	OutLines.Reset();
+	int32 LineStart = 0;
+	for (int32 Index = 0; Index < Text.Len(); ++Index)
+	{
+		if (Text[Index] == TEXT('\n'))
+		{
+			const int32 LineEnd = (Index > LineStart && Text[Index - 1] == TEXT('\r')) ? Index - 1 : Index;
+			OutLines.Add(Text.Mid(LineStart, LineEnd - LineStart));
+			LineStart = Index + 1;
+		}
+	}
+	if (LineStart < Text.Len())
+	{
+		OutLines.Add(Text.Mid(LineStart));
+	}
+}
+
+void FSLFDiffEngine::InternLines(TConstArrayView<FStringView> OldLines, TConstArrayView<FStringView> NewLines,
+	TArray<int32>& OutOldIds, TArray<int32>& OutNewIds)
+{
+	// Hash first; the text is only compared when hashes collide
+	TMultiMap<uint64, int32> IdsByHash;
+	TArray<FStringView> Texts;
+	IdsByHash.Reserve(OldLines.Num() + NewLines.Num());
+
+	auto Intern = [&IdsByHash, &Texts](FStringView Line)
+	{
+		const uint64 Hash = CityHash64(reinterpret_cast<const char*>(Line.GetData()), Line.Len() * sizeof(TCHAR));
+		for (TMultiMap<uint64, int32>::TConstKeyIterator It = IdsByHash.CreateConstKeyIterator(Hash); It; ++It)
+		{
+			if (Texts[It.Value()].Equals(Line, ESearchCase::CaseSensitive))
+			{
+				return It.Value();
+			}
+		}
+		const int32 Id = Texts.Add(Line);
+		IdsByHash.Add(Hash, Id);
+		return Id;
+	};
+
+	OutOldIds.Reset(OldLines.Num());
+	for (const FStringView Line : OldLines)
+	{
+		OutOldIds.Add(Intern(Line));
+	}
+	OutNewIds.Reset(NewLines.Num());
+	for (const FStringView Line : NewLines)
+	{
+		OutNewIds.Add(Intern(Line));
+	}
+}
+
+TArray<FSLFDiffRun> FSLFDiffEngine::Diff(TConstArrayView<int32> Old, TConstArrayView<int32> New, ESLFDiffAlgorithm Algorithm)
+{
+	FLineAligner Aligner(Old, New);
+	Aligner.Run(Algorithm);
+	return Aligner.ToRuns();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// REPORTS
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void FSLFDiffEngine::WriteLine(FArchive& Report, FStringView Text)
+{
+	const FTCHARToUTF8 Converted(Text.GetData(), Text.Len());
+	Report.Serialize(const_cast<void*>(static_cast<const void*>(Converted.Get())), Converted.Length());
+
+	ANSICHAR Newline = '\n';
+	Report.Serialize(&Newline, 1);
+}
+
+FSLFDiffStats FSLFDiffEngine::WriteLineDiff(TConstArrayView<FStringView> OldLines, TConstArrayView<FStringView> NewLines,
+	FArchive& Report, int32 ContextLines, ESLFDiffAlgorithm Algorithm)
+{
+	TArray<int32> OldIds;
+	TArray<int32> NewIds;
+	InternLines(OldLines, NewLines, OldIds, NewIds);
+	const TArray<FSLFDiffRun> Runs = Diff(OldIds, NewIds, Algorithm);
+
+	FSLFDiffStats Stats;
+	ContextLines = FMath::Max(ContextLines, 0);
+
+	int32 RunIndex = 0;
+	while (RunIndex < Runs.Num())
+	{
+		if (Runs[RunIndex].Op == ESLFDiffOp::Equal)
+		{
+			++RunIndex;
+			continue;
+		}
+
+		// Changes separated by no more than twice the context share a hunk
+		const int32 First = RunIndex;
+		int32 Last = RunIndex;
+		for (int32 Next = RunIndex + 1; Next < Runs.Num(); ++Next)
+		{
+			if (Runs[Next].Op != ESLFDiffOp::Equal)
+			{
+				Last = Next;
+			}
+			else if (Next + 1 >= Runs.Num() || Runs[Next].Count > 2 * ContextLines)
+			{
+				break;
+			}
+		}
+
+		const int32 Lead = First > 0 ? FMath::Min(ContextLines, Runs[First - 1].Count) : 0;
+		const int32 Trail = Last + 1 < Runs.Num() ? FMath::Min(ContextLines, Runs[Last + 1].Count) : 0;
+		const FSLFDiffRun& LastRun = Runs[Last];
+		const int32 OldStart = Runs[First].OldStart - Lead;
+		const int32 NewStart = Runs[First].NewStart - Lead;
+		const int32 OldEnd = LastRun.OldStart + (LastRun.Op == ESLFDiffOp::Insert ? 0 : LastRun.Count) + Trail;
+		const int32 NewEnd = LastRun.NewStart + (LastRun.Op == ESLFDiffOp::Delete ? 0 : LastRun.Count) + Trail;
+
+		WriteLine(Report, FString::Printf(TEXT("@@ -%d,%d +%d,%d @@"), OldStart + 1, OldEnd - OldStart, NewStart + 1, NewEnd - NewStart));
+		for (int32 Index = OldStart; Index < Runs[First].OldStart; ++Index)
+		{
+			WritePrefixedLine(Report, TEXT(" "), OldLines[Index]);
+		}
+		for (int32 Index = First; Index <= Last; ++Index)
+		{
+			const FSLFDiffRun& Run = Runs[Index];
+			for (int32 Line = 0; Line < Run.Count; ++Line)
+			{
+				switch (Run.Op)
+				{
+				case ESLFDiffOp::Equal:
+					WritePrefixedLine(Report, TEXT(" "), OldLines[Run.OldStart + Line]);
+					break;
+				case ESLFDiffOp::Delete:
+					WritePrefixedLine(Report, TEXT("-"), OldLines[Run.OldStart + Line]);
+					++Stats.Removed;
+					break;
+				case ESLFDiffOp::Insert:
+					WritePrefixedLine(Report, TEXT("+"), NewLines[Run.NewStart + Line]);
+					++Stats.Added;
+					break;
+				case ESLFDiffOp::Changed:
+					checkNoEntry();
+					break;
+				}
+			}
+		}
+		const int32 TrailStart = LastRun.OldStart + (LastRun.Op == ESLFDiffOp::Insert ? 0 : LastRun.Count);
+		for (int32 Index = TrailStart; Index < TrailStart + Trail; ++Index)
+		{
+			WritePrefixedLine(Report, TEXT(" "), OldLines[Index]);
+		}
+
+		++Stats.Hunks;
+		RunIndex = Last + 1;
+	}
+
+	return Stats;
+}
+
+#if WITH_EDITOR
+// ═══════════════════════════════════════════════════════════════════════════════
+// STRUCTURAL (JSON)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace
+{
+	/** Fields that identify an array element across exports, most specific first */
+	const TCHAR* const ElementKeyFields[] =
+	{
+		TEXT("NodeGuid"),
+		TEXT("GraphName"),
+		TEXT("PinName"),
+		TEXT("VarName"),
+		TEXT("Name"),
+		TEXT("NodeName")
+	};
+
+	bool IsScalar(const FJsonValue& Value)
+	{
+		return Value.Type != EJson::Object && Value.Type != EJson::Array;
+	}
+
+	FString ScalarToString(const FJsonValue& Value)
+	{
+		switch (Value.Type)
+		{
+		case EJson::String:  return FString::Printf(TEXT("\"%s\""), *Value.AsString());
+		case EJson::Number:  return FString::SanitizeFloat(Value.AsNumber());
+		case EJson::Boolean: return Value.AsBool() ? TEXT("true") : TEXT("false");
+		default:             return TEXT("null");
+		}
+	}
+
+	/** Key field whose string value is present and unique on every element, or null */
+	const TCHAR* FindElementKeyField(const TArray<TSharedPtr<FJsonValue>>& Values)
+	{
+		for (const TCHAR* Field : ElementKeyFields)
+		{
+			TSet<FString> Seen;
+			bool bUsable = true;
+			for (const TSharedPtr<FJsonValue>& Value : Values)
+			{
+				const TSharedPtr<FJsonObject>* Object = nullptr;
+				FString Key;
+				if (!Value.IsValid() || !Value->TryGetObject(Object) || !(*Object)->TryGetStringField(Field, Key)
+					|| Key.IsEmpty() || Seen.Contains(Key))
+				{
+					bUsable = false;
+					break;
+				}
+				Seen.Add(Key);
+			}
+			if (bUsable)
+			{
+				return Field;
+			}
+		}
+		return nullptr;
+	}
+
+	void FlattenValue(const FString& Path, const FJsonValue& Value, TArray<TPair<FString, FString>>& OutEntries);
+
+	void FlattenObject(const FString& Path, const FJsonObject& Object, TArray<TPair<FString, FString>>& OutEntries)
+	{
+		if (Object.Values.Num() == 0)
+		{
+			OutEntries.Emplace(Path, TEXT("{}"));
+			return;
+		}
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object.Values)
+		{
+			if (Field.Value.IsValid())
+			{
+				FlattenValue(Path.IsEmpty() ? Field.Key : Path + TEXT(".") + Field.Key, *Field.Value, OutEntries);
+			}
+		}
+	}
+
+	void FlattenValue(const FString& Path, const FJsonValue& Value, TArray<TPair<FString, FString>>& OutEntries)
+	{
+		if (Value.Type == EJson::Object)
+		{
+			FlattenObject(Path, *Value.AsObject(), OutEntries);
+			return;
+		}
+		if (Value.Type != EJson::Array)
+		{
+			OutEntries.Emplace(Path, ScalarToString(Value));
+			return;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>& Elements = Value.AsArray();
+
+		// Scalar lists (LinkedTo, tags) stay one value
+		if (Algo::AllOf(Elements, [](const TSharedPtr<FJsonValue>& Element) { return Element.IsValid() && IsScalar(*Element); }))
+		{
+			TStringBuilder<256> Joined;
+			Joined << TEXT("[");
+			for (int32 Index = 0; Index < Elements.Num(); ++Index)
+			{
+				Joined << (Index > 0 ? TEXT(", ") : TEXT("")) << ScalarToString(*Elements[Index]);
+			}
+			Joined << TEXT("]");
+			OutEntries.Emplace(Path, Joined.ToString());
+			return;
+		}
+
+		const TCHAR* KeyField = FindElementKeyField(Elements);
+		for (int32 Index = 0; Index < Elements.Num(); ++Index)
+		{
+			if (!Elements[Index].IsValid())
+			{
+				continue;
+			}
+			const FString Key = KeyField ? Elements[Index]->AsObject()->GetStringField(KeyField) : FString::FromInt(Index);
+			FlattenValue(FString::Printf(TEXT("%s[%s]"), *Path, *Key), *Elements[Index], OutEntries);
+		}
+	}
+}
+
+void FSLFDiffEngine::FlattenJson(const FJsonObject& Root, TArray<TPair<FString, FString>>& OutEntries)
+{
+	OutEntries.Reset();
+	FlattenObject(FString(), Root, OutEntries);
+	Algo::Sort(OutEntries, [](const TPair<FString, FString>& A, const TPair<FString, FString>& B)
+	{
+		return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0;
+	});
+}
+
+void FSLFDiffEngine::DiffJson(const FJsonObject& Old, const FJsonObject& New, TArray<FSLFStructuralChange>& OutChanges)
+{
+	TArray<TPair<FString, FString>> OldEntries;
+	TArray<TPair<FString, FString>> NewEntries;
+	FlattenJson(Old, OldEntries);
+	FlattenJson(New, NewEntries);
+
+	OutChanges.Reset();
+	int32 OldIndex = 0;
+	int32 NewIndex = 0;
+	while (OldIndex < OldEntries.Num() || NewIndex < NewEntries.Num())
+	{
+		const int32 Order = OldIndex >= OldEntries.Num() ? 1
+			: NewIndex >= NewEntries.Num() ? -1
+			: OldEntries[OldIndex].Key.Compare(NewEntries[NewIndex].Key, ESearchCase::CaseSensitive);
+
+		if (Order < 0)
+		{
+			FSLFStructuralChange& Change = OutChanges.AddDefaulted_GetRef();
+			Change.Op = ESLFDiffOp::Delete;
+			Change.Path = OldEntries[OldIndex].Key;
+			Change.OldValue = OldEntries[OldIndex].Value;
+			++OldIndex;
+		}
+		else if (Order > 0)
+		{
+			FSLFStructuralChange& Change = OutChanges.AddDefaulted_GetRef();
+			Change.Op = ESLFDiffOp::Insert;
+			Change.Path = NewEntries[NewIndex].Key;
+			Change.NewValue = NewEntries[NewIndex].Value;
+			++NewIndex;
+		}
+		else
+		{
+			if (!OldEntries[OldIndex].Value.Equals(NewEntries[NewIndex].Value, ESearchCase::CaseSensitive))
+			{
+				FSLFStructuralChange& Change = OutChanges.AddDefaulted_GetRef();
+				Change.Op = ESLFDiffOp::Changed;
+				Change.Path = OldEntries[OldIndex].Key;
+				Change.OldValue = OldEntries[OldIndex].Value;
+				Change.NewValue = NewEntries[NewIndex].Value;
+			}
+			++OldIndex;
+			++NewIndex;
+		}
+	}
+}
+
+FSLFDiffStats FSLFDiffEngine::WriteJsonDiff(const FJsonObject& Old, const FJsonObject& New, FArchive& Report)
+{
+	TArray<FSLFStructuralChange> Changes;
+	DiffJson(Old, New, Changes);
+
+	FSLFDiffStats Stats;
+	for (const FSLFStructuralChange& Change : Changes)
+	{
+		TStringBuilder<512> Line;
+		switch (Change.Op)
+		{
+		case ESLFDiffOp::Delete:
+			Line << TEXT("- ") << Change.Path << TEXT(": ") << Change.OldValue;
+			++Stats.Removed;
+			break;
+		case ESLFDiffOp::Insert:
+			Line << TEXT("+ ") << Change.Path << TEXT(": ") << Change.NewValue;
+			++Stats.Added;
+			break;
+		case ESLFDiffOp::Changed:
+			Line << TEXT("~ ") << Change.Path << TEXT(": ") << Change.OldValue << TEXT(" -> ") << Change.NewValue;
+			++Stats.Changed;
+			break;
+		}
+		WriteLine(Report, Line);
+	}
+	return Stats;
+}
+#endif // WITH_EDITOR
@@ -0,0 +1,107 @@
+// SLFDiffEngine.h
+// Line and structural diff for migration validation reports
+//
+// Lines are interned to int32 ids by hash, so the diff itself compares integers.
+// Sequences are aligned with patience anchoring (lines unique on both sides) and
+// linear-space Myers between anchors, so a single inserted property no longer shifts
+// everything after it and working memory stays O(N + M). JSON exports can instead be
+// compared structurally: arrays of objects are keyed by NodeGuid / GraphName /
+// PinName / Name, so reordered nodes are not reported. Reports are written line by
+// line to an archive (normally a file writer) rather than built up in one string.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+enum class ESLFDiffAlgorithm : uint8
+{
+	/** Minimal edit script */
+	Myers,
+	/** Anchors on lines unique to both sides first (more readable hunks on code-like text) */
+	Patience
+};
+
+enum class ESLFDiffOp : uint8
+{
+	Equal,
+	Delete,
+	Insert,
+	/** Same path, different value (structural diffs only; line runs never carry it) */
+	Changed
+};
+
+/** Run of lines: Equal covers Old[OldStart..] and New[NewStart..]; Delete only Old; Insert only New */
+struct FSLFDiffRun
+{
+	ESLFDiffOp Op = ESLFDiffOp::Equal;
+	int32 OldStart = 0;
+	int32 NewStart = 0;
+	int32 Count = 0;
+};
+
+struct FSLFDiffStats
+{
+	int32 Added = 0;
+	int32 Removed = 0;
+	int32 Changed = 0;
+	int32 Hunks = 0;
+
+	int32 Total() const { return Added + Removed + Changed; }
+};
+
+/** One difference between two flattened JSON documents */
+struct FSLFStructuralChange
+{
+	ESLFDiffOp Op = ESLFDiffOp::Changed;  // Delete = removed, Insert = added, Changed = value changed
+	FString Path;
+	FString OldValue;
+	FString NewValue;
+};
+
+class SLFCONVERSION_API FSLFDiffEngine
+{
+public:
+	// ═══════════════════════════════════════════════════════════════════
+	// SEQUENCES
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Split into lines without copying (empty lines kept, "\r\n" and "\n" both end a line) */
+	static void SplitLines(FStringView Text, TArray<FStringView>& OutLines);
+
+	/** Give equal lines equal ids across both sides */
+	static void InternLines(TConstArrayView<FStringView> OldLines, TConstArrayView<FStringView> NewLines,
+		TArray<int32>& OutOldIds, TArray<int32>& OutNewIds);
+
+	/** Edit script from Old to New, as alternating runs */
+	static TArray<FSLFDiffRun> Diff(TConstArrayView<int32> Old, TConstArrayView<int32> New,
+		ESLFDiffAlgorithm Algorithm = ESLFDiffAlgorithm::Patience);
+
+	// ═══════════════════════════════════════════════════════════════════
+	// REPORTS
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Append Text and a newline to Report as UTF-8 */
+	static void WriteLine(FArchive& Report, FStringView Text);
+
+	/**
+	 * Unified-style hunks ("@@ -a,b +c,d @@", " ", "-", "+") for two line lists.
+	 * Modified lines count as one removal plus one addition.
+	 */
+	static FSLFDiffStats WriteLineDiff(TConstArrayView<FStringView> OldLines, TConstArrayView<FStringView> NewLines,
+		FArchive& Report, int32 ContextLines = 3, ESLFDiffAlgorithm Algorithm = ESLFDiffAlgorithm::Patience);
+
+#if WITH_EDITOR
+	/**
+	 * Flatten a JSON document into sorted (path, value) pairs such as
+	 * "Graphs[EventGraph].Nodes[<guid>].Pins[then].LinkedTo" = "[\"K2Node_CallFunction_0.execute\"]"
+	 */
+	static void FlattenJson(const FJsonObject& Root, TArray<TPair<FString, FString>>& OutEntries);
+
+	static void DiffJson(const FJsonObject& Old, const FJsonObject& New, TArray<FSLFStructuralChange>& OutChanges);
+
+	/** "- path: value", "+ path: value" and "~ path: old -> new" lines, in path order */
+	static FSLFDiffStats WriteJsonDiff(const FJsonObject& Old, const FJsonObject& New, FArchive& Report);
+#endif // WITH_EDITOR
+};
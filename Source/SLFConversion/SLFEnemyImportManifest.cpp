@@ -0,0 +1,467 @@
+// SLFEnemyImportManifest.cpp
+
+#include "SLFEnemyImportManifest.h"
+
+#if WITH_EDITOR
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	const TCHAR* AnimationConfigFile = TEXT("animation_config.json");
+	const TCHAR* TaeHitboxesFile = TEXT("tae_hitboxes.json");
+
+	FString HashToString(uint64 Hash)
+	{
+		return FString::Printf(TEXT("%016llx"), Hash);
+	}
+
+	uint64 StringToHash(const FString& Text)
+	{
+		return FParse::HexNumber64(*Text);
+	}
+
+	TSharedPtr<FJsonObject> ParseJsonFile(const FString& Path)
+	{
+		FString Text;
+		if (!FFileHelper::LoadFileToString(Text, *Path))
+		{
+			return nullptr;
+		}
+
+		TSharedPtr<FJsonObject> Object;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+		if (!FJsonSerializer::Deserialize(Reader, Object) || !Object.IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[EnemyImport] Failed to parse %s"), *Path);
+			return nullptr;
+		}
+		return Object;
+	}
+
+	/** Fold the hashes of RelativePaths (in order, missing files as 0) into Builder */
+	void HashFiles(FXxHash64Builder& Builder, const FSLFEnemySourceScan& Scan, const TArray<FString>& RelativePaths)
+	{
+		for (const FString& Path : RelativePaths)
+		{
+			const uint64 Hash = Scan.GetFileHash(Path);
+			Builder.Update(*Path, Path.Len() * sizeof(TCHAR));
+			Builder.Update(&Hash, sizeof(Hash));
+		}
+	}
+}
+
+uint64 FSLFEnemySourceScan::GetFileHash(const FString& RelativePath) const
+{
+	const FSLFImportFileState* State = Files.Find(RelativePath);
+	return State ? State->Hash : 0;
+}
+
+FString FSLFEnemyImportManifest::GetDefaultPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("SLFImport") / TEXT("EnemyImportManifest.json");
+}
+
+const TCHAR* FSLFEnemyImportManifest::GetStepName(ESLFEnemyImportStep Step)
+{
+	switch (Step)
+	{
+	case ESLFEnemyImportStep::Mesh:       return TEXT("Mesh");
+	case ESLFEnemyImportStep::Animations: return TEXT("Animations");
+	case ESLFEnemyImportStep::Assets:     return TEXT("Assets");
+	default:                              return TEXT("Unknown");
+	}
+}
+
+uint64 FSLFEnemyImportManifest::HashFile(const FString& Path)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+	if (!Reader)
+	{
+		return 0;
+	}
+
+	constexpr int64 ChunkSize = 1024 * 1024;
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(ChunkSize);
+
+	FXxHash64Builder Builder;
+	int64 Remaining = Reader->TotalSize();
+	while (Remaining > 0 && !Reader->IsError())
+	{
+		const int64 Bytes = FMath::Min(Remaining, ChunkSize);
+		Reader->Serialize(Buffer.GetData(), Bytes);
+		Builder.Update(Buffer.GetData(), Bytes);
+		Remaining -= Bytes;
+	}
+
+	return Reader->IsError() ? 0 : Builder.Finalize().Hash;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// SCAN
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TArray<FString> FSLFEnemyImportManifest::DiscoverEnemies(const FString& SourceBaseDir)
+{
+	TArray<FString> Dirs;
+	IFileManager::Get().FindFiles(Dirs, *(SourceBaseDir / TEXT("*")), false, true);
+	Dirs.Sort();
+
+	TArray<bool> HasFBX;
+	HasFBX.SetNumZeroed(Dirs.Num());
+	ParallelFor(Dirs.Num(), [&](int32 Index)
+	{
+		TArray<FString> FBXFiles;
+		IFileManager::Get().FindFiles(FBXFiles, *(SourceBaseDir / Dirs[Index] / TEXT("fbx") / TEXT("*.fbx")), true, false);
+		HasFBX[Index] = FBXFiles.Num() > 0;
+	});
+
+	TArray<FString> Enemies;
+	for (int32 Index = 0; Index < Dirs.Num(); ++Index)
+	{
+		if (HasFBX[Index])
+		{
+			Enemies.Add(Dirs[Index]);
+		}
+	}
+	return Enemies;
+}
+
+TArray<FSLFEnemySourceScan> FSLFEnemyImportManifest::ScanSources(const FString& SourceBaseDir, const TArray<FString>& EnemyNames) const
+{
+	TArray<FSLFEnemySourceScan> Scans;
+	Scans.SetNum(EnemyNames.Num());
+
+	// Phase 1 (per enemy): list input files
+	ParallelFor(EnemyNames.Num(), [&](int32 Index)
+	{
+		FSLFEnemySourceScan& Scan = Scans[Index];
+		Scan.EnemyName = EnemyNames[Index];
+		Scan.SourceDir = SourceBaseDir / Scan.EnemyName;
+
+		IFileManager& FileManager = IFileManager::Get();
+		Scan.bExists = FileManager.DirectoryExists(*Scan.SourceDir);
+		if (!Scan.bExists)
+		{
+			return;
+		}
+
+		TArray<FString> Found;
+		FileManager.FindFiles(Found, *(Scan.SourceDir / TEXT("fbx") / TEXT("*.fbx")), true, false);
+		Found.Sort();
+		for (const FString& File : Found)
+		{
+			Scan.AnimFBXFiles.Add(FString(TEXT("fbx")) / File);
+		}
+
+		// Same choice as the mesh step: first rigged FBX, else the raw Meshy model
+		Scan.MeshFBXFile = Scan.AnimFBXFiles.Num() > 0 ? Scan.AnimFBXFiles[0] : FString(TEXT("model.fbx"));
+
+		Found.Reset();
+		FileManager.FindFiles(Found, *(Scan.SourceDir / TEXT("texture_*.png")), true, false);
+		Found.Sort();
+		Scan.TextureFiles = MoveTemp(Found);
+
+		TArray<FString> Inputs = Scan.AnimFBXFiles;
+		Inputs.Append(Scan.TextureFiles);
+		Inputs.AddUnique(Scan.MeshFBXFile);
+		Inputs.Add(AnimationConfigFile);
+		Inputs.Add(TaeHitboxesFile);
+		for (const FString& Input : Inputs)
+		{
+			const FString FullPath = Scan.SourceDir / Input;
+			const int64 Size = FileManager.FileSize(*FullPath);
+			if (Size >= 0)
+			{
+				FSLFImportFileState& State = Scan.Files.Add(Input);
+				State.Size = Size;
+				State.TimestampTicks = FileManager.GetTimeStamp(*FullPath).GetTicks();
+			}
+		}
+	});
+
+	// Phase 2 (per file, across all enemies): hash what changed, parse JSON
+	struct FFileJob { int32 ScanIndex; FString RelativePath; };
+	TArray<FFileJob> Jobs;
+	for (int32 ScanIndex = 0; ScanIndex < Scans.Num(); ++ScanIndex)
+	{
+		const FEnemyEntry* Entry = Entries.Find(Scans[ScanIndex].EnemyName);
+		for (TPair<FString, FSLFImportFileState>& File : Scans[ScanIndex].Files)
+		{
+			// Unchanged size + timestamp: trust the recorded content hash
+			const FSLFImportFileState* Recorded = Entry ? Entry->Files.Find(File.Key) : nullptr;
+			if (Recorded && Recorded->Size == File.Value.Size && Recorded->TimestampTicks == File.Value.TimestampTicks)
+			{
+				File.Value.Hash = Recorded->Hash;
+			}
+			else
+			{
+				Jobs.Add({ScanIndex, File.Key});
+			}
+		}
+	}
+
+	TArray<uint64> JobHashes;
+	JobHashes.SetNumZeroed(Jobs.Num());
+	ParallelFor(Jobs.Num() + Scans.Num() * 2, [&](int32 Index)
+	{
+		if (Index < Jobs.Num())
+		{
+			const FFileJob& Job = Jobs[Index];
+			JobHashes[Index] = HashFile(Scans[Job.ScanIndex].SourceDir / Job.RelativePath);
+			return;
+		}
+
+		const int32 JsonIndex = Index - Jobs.Num();
+		FSLFEnemySourceScan& Scan = Scans[JsonIndex / 2];
+		const bool bConfig = (JsonIndex % 2) == 0;
+		const TCHAR* FileName = bConfig ? AnimationConfigFile : TaeHitboxesFile;
+		if (Scan.Files.Contains(FileName))
+		{
+			(bConfig ? Scan.AnimationConfig : Scan.TaeHitboxes) = ParseJsonFile(Scan.SourceDir / FileName);
+		}
+	});
+
+	for (int32 Index = 0; Index < Jobs.Num(); ++Index)
+	{
+		FSLFEnemySourceScan& Scan = Scans[Jobs[Index].ScanIndex];
+		Scan.Files[Jobs[Index].RelativePath].Hash = JobHashes[Index];
+		++Scan.FilesHashed;
+	}
+
+	for (FSLFEnemySourceScan& Scan : Scans)
+	{
+		ComputeStepKeys(Scan);
+	}
+	return Scans;
+}
+
+void FSLFEnemyImportManifest::ComputeStepKeys(FSLFEnemySourceScan& Scan)
+{
+	const int32 ManifestVersion = Version;
+
+	FXxHash64Builder MeshKey;
+	MeshKey.Update(&ManifestVersion, sizeof(ManifestVersion));
+	HashFiles(MeshKey, Scan, TArray<FString>{Scan.MeshFBXFile});
+	HashFiles(MeshKey, Scan, Scan.TextureFiles);
+	Scan.StepKeys[(int32)ESLFEnemyImportStep::Mesh] = MeshKey.Finalize().Hash;
+
+	// Animations are imported onto the mesh's skeleton: a new mesh re-imports them
+	FXxHash64Builder AnimKey;
+	AnimKey.Update(&Scan.StepKeys[(int32)ESLFEnemyImportStep::Mesh], sizeof(uint64));
+	HashFiles(AnimKey, Scan, Scan.AnimFBXFiles);
+	HashFiles(AnimKey, Scan, TArray<FString>{FString(AnimationConfigFile)});
+	Scan.StepKeys[(int32)ESLFEnemyImportStep::Animations] = AnimKey.Finalize().Hash;
+
+	FXxHash64Builder AssetKey;
+	AssetKey.Update(&Scan.StepKeys[(int32)ESLFEnemyImportStep::Animations], sizeof(uint64));
+	HashFiles(AssetKey, Scan, TArray<FString>{FString(TaeHitboxesFile)});
+	Scan.StepKeys[(int32)ESLFEnemyImportStep::Assets] = AssetKey.Finalize().Hash;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// STATE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+bool FSLFEnemyImportManifest::IsStepUpToDate(const FSLFEnemySourceScan& Scan, ESLFEnemyImportStep Step) const
+{
+	const FEnemyEntry* Entry = Entries.Find(Scan.EnemyName);
+	if (!Entry || Entry->StepKeys[(int32)Step] != Scan.GetStepKey(Step))
+	{
+		return false;
+	}
+
+	// Outputs deleted or never written: redo the step
+	const TArray<FString>& Packages = Entry->StepPackages[(int32)Step];
+	for (const FString& Package : Packages)
+	{
+		if (!FPackageName::DoesPackageExist(Package))
+		{
+			return false;
+		}
+	}
+	return Packages.Num() > 0;
+}
+
+void FSLFEnemyImportManifest::RecordStep(const FSLFEnemySourceScan& Scan, ESLFEnemyImportStep Step, const TArray<FString>& Packages)
+{
+	FEnemyEntry& Entry = Entries.FindOrAdd(Scan.EnemyName);
+	Entry.Files = Scan.Files;
+	Entry.StepKeys[(int32)Step] = Scan.GetStepKey(Step);
+	Entry.StepPackages[(int32)Step] = Packages;
+}
+
+TArray<FString> FSLFEnemyImportManifest::GetChangedFiles(const FSLFEnemySourceScan& Scan) const
+{
+	TArray<FString> Changed;
+	const FEnemyEntry* Entry = Entries.Find(Scan.EnemyName);
+	if (!Entry)
+	{
+		Scan.Files.GenerateKeyArray(Changed);
+		Changed.Sort();
+		return Changed;
+	}
+
+	for (const TPair<FString, FSLFImportFileState>& File : Scan.Files)
+	{
+		const FSLFImportFileState* Recorded = Entry->Files.Find(File.Key);
+		if (!Recorded || Recorded->Hash != File.Value.Hash)
+		{
+			Changed.Add(File.Key);
+		}
+	}
+	for (const TPair<FString, FSLFImportFileState>& File : Entry->Files)
+	{
+		if (!Scan.Files.Contains(File.Key))
+		{
+			Changed.Add(File.Key);
+		}
+	}
+	Changed.Sort();
+	return Changed;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// DISK
+// ═══════════════════════════════════════════════════════════════════════════════
+
+bool FSLFEnemyImportManifest::Load(const FString& Path)
+{
+	Entries.Reset();
+
+	TSharedPtr<FJsonObject> Root = ParseJsonFile(Path);
+	if (!Root.IsValid())
+	{
+		return false;
+	}
+	if (Root->GetIntegerField(TEXT("version")) != Version)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[EnemyImport] Manifest version changed, rebuilding every enemy"));
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* Enemies;
+	if (!Root->TryGetObjectField(TEXT("enemies"), Enemies))
+	{
+		return false;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& EnemyPair : (*Enemies)->Values)
+	{
+		const TSharedPtr<FJsonObject> EnemyObj = EnemyPair.Value->AsObject();
+		if (!EnemyObj.IsValid())
+		{
+			continue;
+		}
+
+		FEnemyEntry& Entry = Entries.Add(EnemyPair.Key);
+
+		const TSharedPtr<FJsonObject>* FilesObj;
+		if (EnemyObj->TryGetObjectField(TEXT("files"), FilesObj))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& FilePair : (*FilesObj)->Values)
+			{
+				const TSharedPtr<FJsonObject> FileObj = FilePair.Value->AsObject();
+				if (FileObj.IsValid())
+				{
+					FSLFImportFileState& State = Entry.Files.Add(FilePair.Key);
+					State.Size = FCString::Atoi64(*FileObj->GetStringField(TEXT("size")));
+					State.TimestampTicks = FCString::Atoi64(*FileObj->GetStringField(TEXT("time")));
+					State.Hash = StringToHash(FileObj->GetStringField(TEXT("hash")));
+				}
+			}
+		}
+
+		const TSharedPtr<FJsonObject>* StepsObj;
+		if (EnemyObj->TryGetObjectField(TEXT("steps"), StepsObj))
+		{
+			for (int32 Step = 0; Step < (int32)ESLFEnemyImportStep::Num; ++Step)
+			{
+				const TSharedPtr<FJsonObject>* StepObj;
+				if ((*StepsObj)->TryGetObjectField(GetStepName((ESLFEnemyImportStep)Step), StepObj))
+				{
+					Entry.StepKeys[Step] = StringToHash((*StepObj)->GetStringField(TEXT("key")));
+					(*StepObj)->TryGetStringArrayField(TEXT("packages"), Entry.StepPackages[Step]);
+				}
+			}
+		}
+	}
+	return true;
+}
+
+bool FSLFEnemyImportManifest::Save(const FString& Path) const
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("version"), Version);
+
+	// Sorted so the file diffs cleanly between runs
+	TArray<FString> EnemyNames;
+	Entries.GenerateKeyArray(EnemyNames);
+	EnemyNames.Sort();
+
+	TSharedRef<FJsonObject> Enemies = MakeShared<FJsonObject>();
+	for (const FString& EnemyName : EnemyNames)
+	{
+		const FEnemyEntry& Entry = Entries[EnemyName];
+		TSharedRef<FJsonObject> EnemyObj = MakeShared<FJsonObject>();
+
+		// 64-bit values as strings - JSON numbers are doubles
+		TArray<FString> FileNames;
+		Entry.Files.GenerateKeyArray(FileNames);
+		FileNames.Sort();
+		TSharedRef<FJsonObject> FilesObj = MakeShared<FJsonObject>();
+		for (const FString& FileName : FileNames)
+		{
+			const FSLFImportFileState& State = Entry.Files[FileName];
+			TSharedRef<FJsonObject> FileObj = MakeShared<FJsonObject>();
+			FileObj->SetStringField(TEXT("hash"), HashToString(State.Hash));
+			FileObj->SetStringField(TEXT("size"), LexToString(State.Size));
+			FileObj->SetStringField(TEXT("time"), LexToString(State.TimestampTicks));
+			FilesObj->SetObjectField(FileName, FileObj);
+		}
+		EnemyObj->SetObjectField(TEXT("files"), FilesObj);
+
+		TSharedRef<FJsonObject> StepsObj = MakeShared<FJsonObject>();
+		for (int32 Step = 0; Step < (int32)ESLFEnemyImportStep::Num; ++Step)
+		{
+			if (Entry.StepKeys[Step] == 0)
+			{
+				continue;
+			}
+
+			TArray<TSharedPtr<FJsonValue>> Packages;
+			for (const FString& Package : Entry.StepPackages[Step])
+			{
+				Packages.Add(MakeShared<FJsonValueString>(Package));
+			}
+
+			TSharedRef<FJsonObject> StepObj = MakeShared<FJsonObject>();
+			StepObj->SetStringField(TEXT("key"), HashToString(Entry.StepKeys[Step]));
+			StepObj->SetArrayField(TEXT("packages"), Packages);
+			StepsObj->SetObjectField(GetStepName((ESLFEnemyImportStep)Step), StepObj);
+		}
+		EnemyObj->SetObjectField(TEXT("steps"), StepsObj);
+
+		Enemies->SetObjectField(EnemyName, EnemyObj);
+	}
+	Root->SetObjectField(TEXT("enemies"), Enemies);
+
+	FString Text;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Text);
+	if (!FJsonSerializer::Serialize(Root, Writer))
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(Text, *Path);
+}
+
+#endif // WITH_EDITOR
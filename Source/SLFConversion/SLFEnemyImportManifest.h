@@ -0,0 +1,110 @@
+// SLFEnemyImportManifest.h
+// Incremental import state for USetupBatchEnemyCommandlet.
+//
+// Each enemy's source directory (fbx/*.fbx, texture_*.png, animation_config.json,
+// tae_hitboxes.json) is scanned on worker threads: files are content-hashed and the JSON
+// is parsed up front, so the game thread only creates UObjects. The manifest records, per
+// import step, a key built from the hashes of that step's inputs and the packages the step
+// produced. A step whose key is unchanged and whose packages still exist is skipped.
+//
+// Stored as JSON in Saved/SLFImport/EnemyImportManifest.json (editor only).
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/** Import steps, in pipeline order. Each step's key includes the previous step's key. */
+enum class ESLFEnemyImportStep : uint8
+{
+	Mesh,        // Mesh FBX + textures -> skeletal mesh, skeleton, textures, material
+	Animations,  // Every FBX + animation_config.json -> sequences, montages, sockets
+	Assets,      // Blend space, AnimBP, data assets, weapon traces (tae_hitboxes.json), Blueprint
+	Num
+};
+
+/** What a source file looked like when it was last hashed */
+struct FSLFImportFileState
+{
+	int64 Size = 0;
+	int64 TimestampTicks = 0;
+	uint64 Hash = 0;
+};
+
+/** Source snapshot of one enemy, built off the game thread */
+struct FSLFEnemySourceScan
+{
+	FString EnemyName;
+	FString SourceDir;
+	bool bExists = false;
+
+	/** Paths relative to SourceDir ("fbx/x_a000_003000.fbx"), sorted */
+	TArray<FString> AnimFBXFiles;
+	FString MeshFBXFile;
+	TArray<FString> TextureFiles;
+
+	/** Every input file (relative path -> state) */
+	TMap<FString, FSLFImportFileState> Files;
+
+	/** Parsed on the worker (null when the file is missing or malformed) */
+	TSharedPtr<FJsonObject> AnimationConfig;
+	TSharedPtr<FJsonObject> TaeHitboxes;
+
+	/** Files read and hashed this run (the rest reused the manifest hash: same size + timestamp) */
+	int32 FilesHashed = 0;
+
+	uint64 StepKeys[(int32)ESLFEnemyImportStep::Num] = {};
+
+	uint64 GetStepKey(ESLFEnemyImportStep Step) const { return StepKeys[(int32)Step]; }
+	uint64 GetFileHash(const FString& RelativePath) const;
+};
+
+class SLFCONVERSION_API FSLFEnemyImportManifest
+{
+public:
+	/** Bump when an import step changes what it generates (invalidates every entry) */
+	static constexpr int32 Version = 1;
+
+	static FString GetDefaultPath();
+	static const TCHAR* GetStepName(ESLFEnemyImportStep Step);
+
+	/** Load from disk. A missing file, bad JSON or version mismatch leaves the manifest empty. */
+	bool Load(const FString& Path);
+	bool Save(const FString& Path) const;
+
+	/** Enemy directories under SourceBaseDir with at least one FBX in fbx/ (sorted, checked in parallel) */
+	static TArray<FString> DiscoverEnemies(const FString& SourceBaseDir);
+
+	/**
+	 * Scan every enemy in parallel: file discovery, content hashing (skipped when size and
+	 * timestamp match this manifest) and JSON parsing. Also computes the step keys.
+	 */
+	TArray<FSLFEnemySourceScan> ScanSources(const FString& SourceBaseDir, const TArray<FString>& EnemyNames) const;
+
+	/** Step key matches and every package the step produced still exists */
+	bool IsStepUpToDate(const FSLFEnemySourceScan& Scan, ESLFEnemyImportStep Step) const;
+
+	/** Store the step's key and output packages, plus the current file states */
+	void RecordStep(const FSLFEnemySourceScan& Scan, ESLFEnemyImportStep Step, const TArray<FString>& Packages);
+
+	/** Input files added, removed or modified since the manifest was written (for logging) */
+	TArray<FString> GetChangedFiles(const FSLFEnemySourceScan& Scan) const;
+
+	int32 Num() const { return Entries.Num(); }
+
+	/** xxHash64 of a file's contents, streamed in 1 MB chunks (0 if unreadable) */
+	static uint64 HashFile(const FString& Path);
+
+private:
+	struct FEnemyEntry
+	{
+		TMap<FString, FSLFImportFileState> Files;
+		uint64 StepKeys[(int32)ESLFEnemyImportStep::Num] = {};
+		TArray<FString> StepPackages[(int32)ESLFEnemyImportStep::Num];
+	};
+
+	static void ComputeStepKeys(FSLFEnemySourceScan& Scan);
+
+	TMap<FString, FEnemyEntry> Entries;
+};
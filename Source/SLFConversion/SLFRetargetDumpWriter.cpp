@@ -0,0 +1,133 @@
+// SLFRetargetDumpWriter.cpp
+// Streaming writer for ik_retarget_dump.json (UIKRetargetMultiSourceCommandlet)
+
+#include "SLFRetargetDumpWriter.h"
+#include "HAL/FileManager.h"
+#include "ReferenceSkeleton.h"
+
+namespace
+{
+	constexpr int32 FlushThreshold = 64 * 1024;
+}
+
+bool FSLFRetargetDumpWriter::Open(const FString& Path, const FReferenceSkeleton& RefSkel)
+{
+	return Open(TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*Path)), RefSkel);
+}
+
+bool FSLFRetargetDumpWriter::Open(TUniquePtr<FArchive> InAr, const FReferenceSkeleton& RefSkel)
+{
+	Ar = MoveTemp(InAr);
+	if (!Ar)
+	{
+		return false;
+	}
+
+	Json.Reset();
+	NumAnims = 0;
+	NumBones = RefSkel.GetRawBoneNum();
+	const TArray<FTransform>& RefPose = RefSkel.GetRefBonePose();
+
+	Json << TEXT("{\n  \"skeleton\": [");
+	for (int32 i = 0; i < NumBones; i++)
+	{
+		const FVector P = RefPose[i].GetTranslation();
+		const FQuat R = RefPose[i].GetRotation();
+		const FVector S = RefPose[i].GetScale3D();
+		Json << (i > 0 ? TEXT(",") : TEXT("")) << TEXT("\n    {\"name\": ");
+		AppendQuoted(Json, RefSkel.GetBoneName(i).ToString());
+		Json.Appendf(TEXT(", \"parent\": %d, "), RefSkel.GetParentIndex(i));
+		Json.Appendf(TEXT("\"pos\": [%.8f, %.8f, %.8f], \"rot\": [%.8f, %.8f, %.8f, %.8f], \"scale\": [%.8f, %.8f, %.8f]}"),
+			P.X, P.Y, P.Z, R.X, R.Y, R.Z, R.W, S.X, S.Y, S.Z);
+		FlushIfFull();
+	}
+	Json << TEXT("\n  ],\n  \"animations\": {");
+	Flush();
+	return true;
+}
+
+void FSLFRetargetDumpWriter::AddAnimation(const FString& Name, double Duration, int32 NumKeys,
+	const TArray<TArray<FVector>>& PosKeys, const TArray<TArray<FQuat>>& RotKeys)
+{
+	if (!Ar || PosKeys.Num() != NumBones || RotKeys.Num() != NumBones)
+	{
+		return;
+	}
+
+	Json << (NumAnims > 0 ? TEXT(",") : TEXT("")) << TEXT("\n    ");
+	AppendQuoted(Json, Name);
+	Json.Appendf(TEXT(": {\"duration\": %.6f, \"num_keys\": %d, \"frames\": ["), Duration, NumKeys);
+	for (int32 Key = 0; Key < NumKeys; Key++)
+	{
+		Json.Appendf(TEXT("%s\n      {\"frame\": %d, \"local\": ["), Key > 0 ? TEXT(",") : TEXT(""), Key);
+		for (int32 Bone = 0; Bone < NumBones; Bone++)
+		{
+			const FVector& P = PosKeys[Bone].IsValidIndex(Key) ? PosKeys[Bone][Key] : FVector::ZeroVector;
+			const FQuat& R = RotKeys[Bone].IsValidIndex(Key) ? RotKeys[Bone][Key] : FQuat::Identity;
+			Json.Appendf(TEXT("%s[%.8f, %.8f, %.8f, %.8f, %.8f, %.8f, %.8f]"),
+				Bone > 0 ? TEXT(", ") : TEXT(""), P.X, P.Y, P.Z, R.X, R.Y, R.Z, R.W);
+		}
+		Json << TEXT("]}");
+		FlushIfFull();
+	}
+	Json << TEXT("\n    ]}");
+	Flush();
+	NumAnims++;
+}
+
+bool FSLFRetargetDumpWriter::Close()
+{
+	if (!Ar)
+	{
+		return false;
+	}
+	Json << TEXT("\n  }\n}\n");
+	Flush();
+	const bool bOk = Ar->Close() && !Ar->IsError();
+	Ar.Reset();
+	return bOk;
+}
+
+void FSLFRetargetDumpWriter::AppendQuoted(FStringBuilderBase& Out, FStringView Text)
+{
+	Out << TEXT('"');
+	for (const TCHAR Char : Text)
+	{
+		switch (Char)
+		{
+		case TEXT('"'):  Out << TEXT("\\\""); break;
+		case TEXT('\\'): Out << TEXT("\\\\"); break;
+		case TEXT('\n'): Out << TEXT("\\n"); break;
+		case TEXT('\r'): Out << TEXT("\\r"); break;
+		case TEXT('\t'): Out << TEXT("\\t"); break;
+		case TEXT('\b'): Out << TEXT("\\b"); break;
+		case TEXT('\f'): Out << TEXT("\\f"); break;
+		default:
+			if (Char < 0x20)
+			{
+				Out.Appendf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+			}
+			else
+			{
+				Out << Char;
+			}
+			break;
+		}
+	}
+	Out << TEXT('"');
+}
+
+void FSLFRetargetDumpWriter::Flush()
+{
+	const FTCHARToUTF8 Converted(Json.GetData(), Json.Len());
+	Ar->Serialize(const_cast<void*>(static_cast<const void*>(Converted.Get())), Converted.Length());
+	Json.Reset();
+}
+
+void FSLFRetargetDumpWriter::FlushIfFull()
+{
+	if (Json.Len() >= FlushThreshold)
+	{
+		Flush();
+	}
+}
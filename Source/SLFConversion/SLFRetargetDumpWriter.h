@@ -0,0 +1,45 @@
+// SLFRetargetDumpWriter.h
+// Streaming writer for ik_retarget_dump.json (UIKRetargetMultiSourceCommandlet)
+//
+// Writes the layout the old FJsonObject dump produced, one animation at a time:
+// { "skeleton": [{name, parent, pos, rot, scale}], "animations": { name: {duration, num_keys, frames: [{frame, local: [[px,py,pz,rx,ry,rz,rw], ...]}]} } }
+// Only one animation's keys are held in memory, and text is flushed as UTF-8 in 64 KB chunks.
+// Bone and animation names are JSON-escaped.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FReferenceSkeleton;
+
+class SLFCONVERSION_API FSLFRetargetDumpWriter
+{
+public:
+	/** Start a dump at Path; keys passed to AddAnimation are indexed by RefSkel's raw bones */
+	bool Open(const FString& Path, const FReferenceSkeleton& RefSkel);
+
+	/** Start a dump into an already open archive (memory writers in tests) */
+	bool Open(TUniquePtr<FArchive> InAr, const FReferenceSkeleton& RefSkel);
+
+	bool IsOpen() const { return Ar.IsValid(); }
+	int32 Num() const { return NumAnims; }
+
+	/** Keys are [Bone][Key] for the skeleton passed to Open; missing keys write the identity */
+	void AddAnimation(const FString& Name, double Duration, int32 NumKeys,
+		const TArray<TArray<FVector>>& PosKeys, const TArray<TArray<FQuat>>& RotKeys);
+
+	/** Close the document and the archive. Returns false if anything failed to write. */
+	bool Close();
+
+	/** Append Text as a quoted JSON string */
+	static void AppendQuoted(FStringBuilderBase& Out, FStringView Text);
+
+private:
+	void Flush();
+	void FlushIfFull();
+
+	TUniquePtr<FArchive> Ar;
+	TStringBuilder<1024> Json;
+	int32 NumBones = 0;
+	int32 NumAnims = 0;
+};
@@ -3,6 +3,7 @@
 
 #include "SLFYAMLExporter.h"
 #if WITH_EDITOR
+#include "SLFYAMLWriter.h"
 #include "Engine/Blueprint.h"
 #include "Engine/DataTable.h"
 #include "Engine/UserDefinedStruct.h"
@@ -16,6 +17,7 @@
 #include "Components/PanelWidget.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
 #include "GameplayTagContainer.h"
 
 FString USLFYAMLExporter::GetIndent(int32 Level)
@@ -52,192 +54,219 @@ FString USLFYAMLExporter::FTextToString(const FText& Text)
 	return Text.ToString();
 }
 
-void USLFYAMLExporter::PropertyToYAML(FProperty* Property, const void* ValuePtr, FString& OutYAML, int32 IndentLevel)
+namespace
 {
-	if (!Property || !ValuePtr) return;
+	/** FName text without allocating an FString */
+	struct FSLFNameText : public TStringBuilder<FName::StringBufferSize>
+	{
+		explicit FSLFNameText(FName Name) { Name.AppendString(*this); }
+	};
+}
 
-	FString Indent = GetIndent(IndentLevel);
-	FString PropName = Property->GetName();
+bool USLFYAMLExporter::WriteYAMLFile(const FString& OutputPath, TFunctionRef<void(FSLFYAMLWriter&)> Emit)
+{
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*OutputPath));
+	if (!FileWriter)
+	{
+		return false;
+	}
+
+	bool bNonAnsi = false;
+	{
+		FSLFYAMLWriter Writer(*FileWriter);
+		Emit(Writer);
+		Writer.Flush();
+		bNonAnsi = Writer.HasNonAnsiText();
+	}
+
+	const bool bWritten = FileWriter->Close();
+	FileWriter.Reset();
+	if (!bWritten)
+	{
+		return false;
+	}
+
+	// SaveStringToFile wrote non-ANSI documents as UTF-16 with a BOM - keep the files byte-identical
+	if (bNonAnsi)
+	{
+		FString Text;
+		return FFileHelper::LoadFileToString(Text, *OutputPath) && FFileHelper::SaveStringToFile(Text, *OutputPath);
+	}
+	return true;
+}
+
+void USLFYAMLExporter::PropertyToYAML(const FSLFYAMLField& Field, const void* ValuePtr, FSLFYAMLWriter& Writer, int32 IndentLevel)
+{
+	if (!Field.Property || !ValuePtr) return;
+
+	const FString& PropName = Field.Name;
 
 	// Handle different property types
-	if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	switch (Field.Kind)
+	{
+	case ESLFYAMLPropertyKind::Struct:
 	{
-		OutYAML += FString::Printf(TEXT("%s%s:\n"), *Indent, *PropName);
-		StructToYAML(ValuePtr, StructProp->Struct, OutYAML, IndentLevel + 1);
+		FStructProperty* StructProp = CastFieldChecked<FStructProperty>(Field.Property);
+		Writer.Key(IndentLevel, PropName);
+		StructToYAML(ValuePtr, StructProp->Struct, Writer, IndentLevel + 1);
+		break;
 	}
-	else if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Property))
+	case ESLFYAMLPropertyKind::Object:
 	{
-		UObject* ObjValue = ObjProp->GetObjectPropertyValue(ValuePtr);
+		UObject* ObjValue = CastFieldChecked<FObjectProperty>(Field.Property)->GetObjectPropertyValue(ValuePtr);
 		if (ObjValue)
 		{
-			OutYAML += FString::Printf(TEXT("%s%s:\n"), *Indent, *PropName);
-			OutYAML += FString::Printf(TEXT("%s  class: %s\n"), *Indent, *ObjValue->GetClass()->GetName());
-			OutYAML += FString::Printf(TEXT("%s  name: %s\n"), *Indent, *ObjValue->GetName());
-			OutYAML += FString::Printf(TEXT("%s  path: %s\n"), *Indent, *EscapeYAMLString(ObjValue->GetPathName()));
+			TStringBuilder<256> ObjPath;
+			ObjValue->GetPathName(nullptr, ObjPath);
+
+			Writer.Key(IndentLevel, PropName);
+			Writer.Value(IndentLevel + 1, TEXT("class"), FSLFNameText(ObjValue->GetClass()->GetFName()));
+			Writer.Value(IndentLevel + 1, TEXT("name"), FSLFNameText(ObjValue->GetFName()));
+			Writer.EscapedValue(IndentLevel + 1, TEXT("path"), ObjPath);
 		}
 		else
 		{
-			OutYAML += FString::Printf(TEXT("%s%s: null\n"), *Indent, *PropName);
+			Writer.Value(IndentLevel, PropName, TEXT("null"));
 		}
+		break;
 	}
-	else if (FSoftObjectProperty* SoftObjProp = CastField<FSoftObjectProperty>(Property))
+	case ESLFYAMLPropertyKind::SoftObject:
 	{
-		FSoftObjectPtr SoftPtr = SoftObjProp->GetPropertyValue(ValuePtr);
+		const FSoftObjectPtr SoftPtr = CastFieldChecked<FSoftObjectProperty>(Field.Property)->GetPropertyValue(ValuePtr);
 		if (SoftPtr.IsNull())
 		{
-			OutYAML += FString::Printf(TEXT("%s%s: null\n"), *Indent, *PropName);
+			Writer.Value(IndentLevel, PropName, TEXT("null"));
 		}
 		else
 		{
-			OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *EscapeYAMLString(SoftPtr.ToString()));
+			Writer.EscapedValue(IndentLevel, PropName, SoftPtr.ToString());
 		}
+		break;
 	}
-	else if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	case ESLFYAMLPropertyKind::Array:
 	{
+		FArrayProperty* ArrayProp = CastFieldChecked<FArrayProperty>(Field.Property);
 		FScriptArrayHelper ArrayHelper(ArrayProp, ValuePtr);
-		OutYAML += FString::Printf(TEXT("%s%s:\n"), *Indent, *PropName);
-		OutYAML += FString::Printf(TEXT("%s  count: %d\n"), *Indent, ArrayHelper.Num());
-		OutYAML += FString::Printf(TEXT("%s  items:\n"), *Indent);
+		Writer.Key(IndentLevel, PropName);
+		Writer.IntValue(IndentLevel + 1, TEXT("count"), ArrayHelper.Num());
+		Writer.Key(IndentLevel + 1, TEXT("items"));
 
+		FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProp->Inner);
 		for (int32 i = 0; i < ArrayHelper.Num(); i++)
 		{
 			const void* ElementPtr = ArrayHelper.GetRawPtr(i);
-			OutYAML += FString::Printf(TEXT("%s    - index: %d\n"), *Indent, i);
+			Writer.IntValue(IndentLevel + 2, TEXT("- index"), i);
 
-			if (FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProp->Inner))
+			if (InnerStruct)
 			{
-				StructToYAML(ElementPtr, InnerStruct->Struct, OutYAML, IndentLevel + 3);
+				StructToYAML(ElementPtr, InnerStruct->Struct, Writer, IndentLevel + 3);
 			}
 			else
 			{
-				FString ElementStr;
+				FString& ElementStr = Writer.GetScratch();
 				ArrayProp->Inner->ExportTextItem_Direct(ElementStr, ElementPtr, nullptr, nullptr, PPF_None);
-				OutYAML += FString::Printf(TEXT("%s      value: %s\n"), *Indent, *EscapeYAMLString(ElementStr));
+				Writer.EscapedValue(IndentLevel + 3, TEXT("value"), ElementStr);
 			}
 		}
+		break;
 	}
-	else if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	case ESLFYAMLPropertyKind::Map:
 	{
+		FMapProperty* MapProp = CastFieldChecked<FMapProperty>(Field.Property);
 		FScriptMapHelper MapHelper(MapProp, ValuePtr);
-		OutYAML += FString::Printf(TEXT("%s%s:\n"), *Indent, *PropName);
-		OutYAML += FString::Printf(TEXT("%s  count: %d\n"), *Indent, MapHelper.Num());
-		OutYAML += FString::Printf(TEXT("%s  entries:\n"), *Indent);
+		Writer.Key(IndentLevel, PropName);
+		Writer.IntValue(IndentLevel + 1, TEXT("count"), MapHelper.Num());
+		Writer.Key(IndentLevel + 1, TEXT("entries"));
 
-		int32 EntryIndex = 0;
-		for (auto It = MapHelper.CreateIterator(); It; ++It, ++EntryIndex)
+		for (auto It = MapHelper.CreateIterator(); It; ++It)
 		{
-			FString KeyStr, ValueStr;
+			FString& KeyStr = Writer.GetScratch();
 			MapProp->KeyProp->ExportTextItem_Direct(KeyStr, MapHelper.GetKeyPtr(It.GetInternalIndex()), nullptr, nullptr, PPF_None);
+			Writer.EscapedValue(IndentLevel + 2, TEXT("- key"), KeyStr);
+
+			FString& ValueStr = Writer.GetScratch();
 			MapProp->ValueProp->ExportTextItem_Direct(ValueStr, MapHelper.GetValuePtr(It.GetInternalIndex()), nullptr, nullptr, PPF_None);
-			OutYAML += FString::Printf(TEXT("%s    - key: %s\n"), *Indent, *EscapeYAMLString(KeyStr));
-			OutYAML += FString::Printf(TEXT("%s      value: %s\n"), *Indent, *EscapeYAMLString(ValueStr));
+			Writer.EscapedValue(IndentLevel + 3, TEXT("value"), ValueStr);
 		}
-	}
-	else if (FTextProperty* TextProp = CastField<FTextProperty>(Property))
-	{
-		FText TextValue = TextProp->GetPropertyValue(ValuePtr);
-		OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *EscapeYAMLString(FTextToString(TextValue)));
-	}
-	else if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
-	{
-		FString StrValue = StrProp->GetPropertyValue(ValuePtr);
-		OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *EscapeYAMLString(StrValue));
-	}
-	else if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
-	{
-		FName NameValue = NameProp->GetPropertyValue(ValuePtr);
-		OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *EscapeYAMLString(NameValue.ToString()));
-	}
-	else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
-	{
-		bool BoolValue = BoolProp->GetPropertyValue(ValuePtr);
-		OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, BoolValue ? TEXT("true") : TEXT("false"));
-	}
-	else if (FIntProperty* IntProp = CastField<FIntProperty>(Property))
-	{
-		int32 IntValue = IntProp->GetPropertyValue(ValuePtr);
-		OutYAML += FString::Printf(TEXT("%s%s: %d\n"), *Indent, *PropName, IntValue);
-	}
-	else if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
-	{
-		float FloatValue = FloatProp->GetPropertyValue(ValuePtr);
-		OutYAML += FString::Printf(TEXT("%s%s: %f\n"), *Indent, *PropName, FloatValue);
-	}
-	else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
-	{
-		double DoubleValue = DoubleProp->GetPropertyValue(ValuePtr);
-		OutYAML += FString::Printf(TEXT("%s%s: %f\n"), *Indent, *PropName, DoubleValue);
-	}
-	else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
-	{
-		FString EnumStr;
-		EnumProp->ExportTextItem_Direct(EnumStr, ValuePtr, nullptr, nullptr, PPF_None);
-		OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *EscapeYAMLString(EnumStr));
-	}
-	else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
-	{
+		break;
+	}
+	case ESLFYAMLPropertyKind::Text:
+	{
+		const FText& TextValue = *CastFieldChecked<FTextProperty>(Field.Property)->GetPropertyValuePtr(ValuePtr);
+		Writer.EscapedValue(IndentLevel, PropName, TextValue.ToString());
+		break;
+	}
+	case ESLFYAMLPropertyKind::String:
+		Writer.EscapedValue(IndentLevel, PropName, *CastFieldChecked<FStrProperty>(Field.Property)->GetPropertyValuePtr(ValuePtr));
+		break;
+	case ESLFYAMLPropertyKind::Name:
+		Writer.EscapedValue(IndentLevel, PropName, FSLFNameText(CastFieldChecked<FNameProperty>(Field.Property)->GetPropertyValue(ValuePtr)));
+		break;
+	case ESLFYAMLPropertyKind::Bool:
+		Writer.Indent(IndentLevel).Raw(PropName).Raw(": ").Bool(CastFieldChecked<FBoolProperty>(Field.Property)->GetPropertyValue(ValuePtr)).Newline();
+		break;
+	case ESLFYAMLPropertyKind::Int:
+		Writer.IntValue(IndentLevel, PropName, CastFieldChecked<FIntProperty>(Field.Property)->GetPropertyValue(ValuePtr));
+		break;
+	case ESLFYAMLPropertyKind::Float:
+		Writer.Indent(IndentLevel).Raw(PropName).Raw(": ").Float(CastFieldChecked<FFloatProperty>(Field.Property)->GetPropertyValue(ValuePtr)).Newline();
+		break;
+	case ESLFYAMLPropertyKind::Double:
+		Writer.Indent(IndentLevel).Raw(PropName).Raw(": ").Float(CastFieldChecked<FDoubleProperty>(Field.Property)->GetPropertyValue(ValuePtr)).Newline();
+		break;
+	case ESLFYAMLPropertyKind::Byte:
+	{
+		FByteProperty* ByteProp = CastFieldChecked<FByteProperty>(Field.Property);
+		const uint8 ByteValue = ByteProp->GetPropertyValue(ValuePtr);
 		if (ByteProp->Enum)
 		{
-			uint8 ByteValue = ByteProp->GetPropertyValue(ValuePtr);
-			FString EnumName = ByteProp->Enum->GetNameStringByValue(ByteValue);
-			OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *EscapeYAMLString(EnumName));
+			Writer.EscapedValue(IndentLevel, PropName, ByteProp->Enum->GetNameStringByValue(ByteValue));
 		}
 		else
 		{
-			uint8 ByteValue = ByteProp->GetPropertyValue(ValuePtr);
-			OutYAML += FString::Printf(TEXT("%s%s: %d\n"), *Indent, *PropName, ByteValue);
+			Writer.IntValue(IndentLevel, PropName, ByteValue);
 		}
+		break;
 	}
-	else
+	case ESLFYAMLPropertyKind::Enum:
+	default:
 	{
-		// Generic fallback using ExportTextItem
-		FString ValueStr;
-		Property->ExportTextItem_Direct(ValueStr, ValuePtr, nullptr, nullptr, PPF_None);
-		OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *EscapeYAMLString(ValueStr));
+		// Enums and the generic fallback both go through ExportTextItem
+		FString& ValueStr = Writer.GetScratch();
+		Field.Property->ExportTextItem_Direct(ValueStr, ValuePtr, nullptr, nullptr, PPF_None);
+		Writer.EscapedValue(IndentLevel, PropName, ValueStr);
+		break;
+	}
 	}
 }
 
-void USLFYAMLExporter::StructToYAML(const void* StructData, const UStruct* StructType, FString& OutYAML, int32 IndentLevel)
+void USLFYAMLExporter::StructToYAML(const void* StructData, const UStruct* StructType, FSLFYAMLWriter& Writer, int32 IndentLevel)
 {
 	if (!StructData || !StructType) return;
 
-	for (TFieldIterator<FProperty> PropIt(StructType); PropIt; ++PropIt)
+	// Deprecated and transient properties are already filtered out of the cached list
+	for (const FSLFYAMLField& Field : Writer.GetFields(StructType))
 	{
-		FProperty* Property = *PropIt;
-		if (!Property) continue;
-
-		// Skip deprecated and transient
-		if (Property->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient)) continue;
-
-		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructData);
-		PropertyToYAML(Property, ValuePtr, OutYAML, IndentLevel);
+		const void* ValuePtr = Field.Property->ContainerPtrToValuePtr<void>(StructData);
+		PropertyToYAML(Field, ValuePtr, Writer, IndentLevel);
 	}
 }
 
-void USLFYAMLExporter::ObjectToYAML(UObject* Object, FString& OutYAML, int32 IndentLevel)
+void USLFYAMLExporter::ObjectToYAML(UObject* Object, FSLFYAMLWriter& Writer, int32 IndentLevel)
 {
 	if (!Object) return;
 
-	FString Indent = GetIndent(IndentLevel);
+	TStringBuilder<256> ObjPath;
+	Object->GetPathName(nullptr, ObjPath);
 
 	// Object header
-	OutYAML += FString::Printf(TEXT("%sclass: %s\n"), *Indent, *Object->GetClass()->GetName());
-	OutYAML += FString::Printf(TEXT("%sname: %s\n"), *Indent, *Object->GetName());
-	OutYAML += FString::Printf(TEXT("%spath: %s\n"), *Indent, *EscapeYAMLString(Object->GetPathName()));
-	OutYAML += FString::Printf(TEXT("%sproperties:\n"), *Indent);
-
-	// Export all properties
-	for (TFieldIterator<FProperty> PropIt(Object->GetClass()); PropIt; ++PropIt)
-	{
-		FProperty* Property = *PropIt;
-		if (!Property) continue;
+	Writer.Value(IndentLevel, TEXT("class"), FSLFNameText(Object->GetClass()->GetFName()));
+	Writer.Value(IndentLevel, TEXT("name"), FSLFNameText(Object->GetFName()));
+	Writer.EscapedValue(IndentLevel, TEXT("path"), ObjPath);
+	Writer.Key(IndentLevel, TEXT("properties"));
 
-		// Skip deprecated, transient, and editor-only
-		if (Property->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient)) continue;
-
-		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Object);
-		PropertyToYAML(Property, ValuePtr, OutYAML, IndentLevel + 1);
-	}
+	// Export all properties (deprecated and transient skipped by the cache)
+	StructToYAML(Object, Object->GetClass(), Writer, IndentLevel + 1);
 }
 
 bool USLFYAMLExporter::ExportBlueprintToYAML(const FString& BlueprintPath, const FString& OutputPath)
@@ -249,66 +278,67 @@ bool USLFYAMLExporter::ExportBlueprintToYAML(const FString& BlueprintPath, const
 		return false;
 	}
 
-	FString YAML;
-	YAML += TEXT("# Blueprint Export - AUTO-GENERATED\n");
-	YAML += TEXT("# DO NOT EDIT - This is the source of truth from bp_only\n\n");
+	const bool bSaved = WriteYAMLFile(OutputPath, [&](FSLFYAMLWriter& YAML)
+	{
+		YAML.Raw("# Blueprint Export - AUTO-GENERATED\n");
+		YAML.Raw("# DO NOT EDIT - This is the source of truth from bp_only\n\n");
 
-	YAML += TEXT("blueprint:\n");
-	YAML += FString::Printf(TEXT("  path: %s\n"), *EscapeYAMLString(BlueprintPath));
-	YAML += FString::Printf(TEXT("  class: %s\n"), *Blueprint->GetClass()->GetName());
-	YAML += FString::Printf(TEXT("  parent_class: %s\n"), Blueprint->ParentClass ? *Blueprint->ParentClass->GetName() : TEXT("None"));
-	YAML += FString::Printf(TEXT("  generated_class: %s\n"), Blueprint->GeneratedClass ? *Blueprint->GeneratedClass->GetName() : TEXT("None"));
-	YAML += TEXT("\n");
+		YAML.Key(0, TEXT("blueprint"));
+		YAML.EscapedValue(1, TEXT("path"), BlueprintPath);
+		YAML.Value(1, TEXT("class"), Blueprint->GetClass()->GetName());
+		YAML.Value(1, TEXT("parent_class"), Blueprint->ParentClass ? Blueprint->ParentClass->GetName() : TEXT("None"));
+		YAML.Value(1, TEXT("generated_class"), Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetName() : TEXT("None"));
+		YAML.Newline();
 
-	// Blueprint Variables
-	YAML += TEXT("variables:\n");
-	for (const FBPVariableDescription& Var : Blueprint->NewVariables)
-	{
-		YAML += FString::Printf(TEXT("  - name: %s\n"), *Var.VarName.ToString());
-		YAML += FString::Printf(TEXT("    type: %s\n"), *Var.VarType.PinCategory.ToString());
-		YAML += FString::Printf(TEXT("    subcategory: %s\n"), *Var.VarType.PinSubCategory.ToString());
-		YAML += FString::Printf(TEXT("    category: %s\n"), *EscapeYAMLString(Var.Category.ToString()));
-		YAML += FString::Printf(TEXT("    replication: %d\n"), (int32)Var.ReplicationCondition);
-		if (!Var.DefaultValue.IsEmpty())
+		// Blueprint Variables
+		YAML.Key(0, TEXT("variables"));
+		for (const FBPVariableDescription& Var : Blueprint->NewVariables)
 		{
-			YAML += FString::Printf(TEXT("    default_value: %s\n"), *EscapeYAMLString(Var.DefaultValue));
+			YAML.Value(1, TEXT("- name"), Var.VarName.ToString());
+			YAML.Value(2, TEXT("type"), Var.VarType.PinCategory.ToString());
+			YAML.Value(2, TEXT("subcategory"), Var.VarType.PinSubCategory.ToString());
+			YAML.EscapedValue(2, TEXT("category"), Var.Category.ToString());
+			YAML.IntValue(2, TEXT("replication"), (int32)Var.ReplicationCondition);
+			if (!Var.DefaultValue.IsEmpty())
+			{
+				YAML.EscapedValue(2, TEXT("default_value"), Var.DefaultValue);
+			}
+			YAML.Newline();
 		}
-		YAML += TEXT("\n");
-	}
 
-	// Class Default Object
-	if (Blueprint->GeneratedClass)
-	{
-		UObject* CDO = Blueprint->GeneratedClass->GetDefaultObject();
-		if (CDO)
+		// Class Default Object
+		if (Blueprint->GeneratedClass)
 		{
-			YAML += TEXT("class_default_object:\n");
-			ObjectToYAML(CDO, YAML, 1);
-			YAML += TEXT("\n");
+			UObject* CDO = Blueprint->GeneratedClass->GetDefaultObject();
+			if (CDO)
+			{
+				YAML.Key(0, TEXT("class_default_object"));
+				ObjectToYAML(CDO, YAML, 1);
+				YAML.Newline();
+			}
 		}
-	}
 
-	// Components (SCS)
-	if (Blueprint->SimpleConstructionScript)
-	{
-		YAML += TEXT("components:\n");
-		TArray<USCS_Node*> AllNodes = Blueprint->SimpleConstructionScript->GetAllNodes();
-		for (USCS_Node* Node : AllNodes)
+		// Components (SCS)
+		if (Blueprint->SimpleConstructionScript)
 		{
-			if (Node && Node->ComponentTemplate)
+			YAML.Key(0, TEXT("components"));
+			TArray<USCS_Node*> AllNodes = Blueprint->SimpleConstructionScript->GetAllNodes();
+			for (USCS_Node* Node : AllNodes)
 			{
-				YAML += FString::Printf(TEXT("  - variable_name: %s\n"), *Node->GetVariableName().ToString());
-				YAML += FString::Printf(TEXT("    component_class: %s\n"), *Node->ComponentTemplate->GetClass()->GetName());
-				YAML += FString::Printf(TEXT("    parent_variable: %s\n"), Node->ParentComponentOrVariableName.IsNone() ? TEXT("None") : *Node->ParentComponentOrVariableName.ToString());
-				YAML += TEXT("    properties:\n");
-				ObjectToYAML(Node->ComponentTemplate, YAML, 3);
-				YAML += TEXT("\n");
+				if (Node && Node->ComponentTemplate)
+				{
+					YAML.Value(1, TEXT("- variable_name"), Node->GetVariableName().ToString());
+					YAML.Value(2, TEXT("component_class"), Node->ComponentTemplate->GetClass()->GetName());
+					YAML.Value(2, TEXT("parent_variable"), Node->ParentComponentOrVariableName.IsNone() ? FString(TEXT("None")) : Node->ParentComponentOrVariableName.ToString());
+					YAML.Key(2, TEXT("properties"));
+					ObjectToYAML(Node->ComponentTemplate, YAML, 3);
+					YAML.Newline();
+				}
 			}
 		}
-	}
+	});
 
-	// Save
-	if (FFileHelper::SaveStringToFile(YAML, *OutputPath))
+	if (bSaved)
 	{
 		UE_LOG(LogTemp, Log, TEXT("[YAMLExporter] Exported Blueprint to: %s"), *OutputPath);
 		return true;
@@ -326,91 +356,89 @@ bool USLFYAMLExporter::ExportWidgetToYAML(const FString& WidgetPath, const FStri
 		return false;
 	}
 
-	FString YAML;
-	YAML += TEXT("# Widget Blueprint Export - AUTO-GENERATED\n");
-	YAML += TEXT("# DO NOT EDIT - This is the source of truth from bp_only\n\n");
-
-	YAML += TEXT("widget:\n");
-	YAML += FString::Printf(TEXT("  path: %s\n"), *EscapeYAMLString(WidgetPath));
-	YAML += FString::Printf(TEXT("  class: %s\n"), *WidgetBP->GetClass()->GetName());
-	YAML += FString::Printf(TEXT("  parent_class: %s\n"), WidgetBP->ParentClass ? *WidgetBP->ParentClass->GetName() : TEXT("None"));
-	YAML += TEXT("\n");
-
-	// Variables
-	YAML += TEXT("variables:\n");
-	for (const FBPVariableDescription& Var : WidgetBP->NewVariables)
+	const bool bSaved = WriteYAMLFile(OutputPath, [&](FSLFYAMLWriter& YAML)
 	{
-		YAML += FString::Printf(TEXT("  - name: %s\n"), *Var.VarName.ToString());
-		YAML += FString::Printf(TEXT("    type: %s\n"), *Var.VarType.PinCategory.ToString());
-		YAML += FString::Printf(TEXT("    subcategory: %s\n"), *Var.VarType.PinSubCategory.ToString());
-		if (Var.VarType.PinSubCategoryObject.IsValid())
-		{
-			YAML += FString::Printf(TEXT("    subcategory_object: %s\n"), *Var.VarType.PinSubCategoryObject->GetName());
-		}
-		if (!Var.DefaultValue.IsEmpty())
-		{
-			YAML += FString::Printf(TEXT("    default_value: %s\n"), *EscapeYAMLString(Var.DefaultValue));
-		}
-		YAML += TEXT("\n");
-	}
+		YAML.Raw("# Widget Blueprint Export - AUTO-GENERATED\n");
+		YAML.Raw("# DO NOT EDIT - This is the source of truth from bp_only\n\n");
 
-	// Widget Tree
-	YAML += TEXT("widget_tree:\n");
-	if (WidgetBP->WidgetTree)
-	{
-		TArray<UWidget*> AllWidgets;
-		WidgetBP->WidgetTree->ForEachWidget([&AllWidgets](UWidget* Widget)
+		YAML.Key(0, TEXT("widget"));
+		YAML.EscapedValue(1, TEXT("path"), WidgetPath);
+		YAML.Value(1, TEXT("class"), WidgetBP->GetClass()->GetName());
+		YAML.Value(1, TEXT("parent_class"), WidgetBP->ParentClass ? WidgetBP->ParentClass->GetName() : TEXT("None"));
+		YAML.Newline();
+
+		// Variables
+		YAML.Key(0, TEXT("variables"));
+		for (const FBPVariableDescription& Var : WidgetBP->NewVariables)
 		{
-			if (Widget)
+			YAML.Value(1, TEXT("- name"), Var.VarName.ToString());
+			YAML.Value(2, TEXT("type"), Var.VarType.PinCategory.ToString());
+			YAML.Value(2, TEXT("subcategory"), Var.VarType.PinSubCategory.ToString());
+			if (Var.VarType.PinSubCategoryObject.IsValid())
+			{
+				YAML.Value(2, TEXT("subcategory_object"), Var.VarType.PinSubCategoryObject->GetName());
+			}
+			if (!Var.DefaultValue.IsEmpty())
 			{
-				AllWidgets.Add(Widget);
+				YAML.EscapedValue(2, TEXT("default_value"), Var.DefaultValue);
 			}
-		});
+			YAML.Newline();
+		}
 
-		for (UWidget* Widget : AllWidgets)
+		// Widget Tree
+		YAML.Key(0, TEXT("widget_tree"));
+		if (WidgetBP->WidgetTree)
 		{
-			YAML += FString::Printf(TEXT("  - name: %s\n"), *Widget->GetName());
-			YAML += FString::Printf(TEXT("    class: %s\n"), *Widget->GetClass()->GetName());
-			YAML += FString::Printf(TEXT("    visibility: %d\n"), (int32)Widget->GetVisibility());
-			YAML += FString::Printf(TEXT("    is_visible: %s\n"), Widget->IsVisible() ? TEXT("true") : TEXT("false"));
-
-			// Check if it's a panel with children
-			if (UPanelWidget* Panel = Cast<UPanelWidget>(Widget))
+			TArray<UWidget*> AllWidgets;
+			WidgetBP->WidgetTree->ForEachWidget([&AllWidgets](UWidget* Widget)
 			{
-				YAML += FString::Printf(TEXT("    child_count: %d\n"), Panel->GetChildrenCount());
-			}
+				if (Widget)
+				{
+					AllWidgets.Add(Widget);
+				}
+			});
 
-			// Export widget-specific properties
-			YAML += TEXT("    properties:\n");
-			for (TFieldIterator<FProperty> PropIt(Widget->GetClass()); PropIt; ++PropIt)
+			for (UWidget* Widget : AllWidgets)
 			{
-				FProperty* Property = *PropIt;
-				if (!Property) continue;
-				if (Property->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient)) continue;
+				YAML.Value(1, TEXT("- name"), Widget->GetName());
+				YAML.Value(2, TEXT("class"), Widget->GetClass()->GetName());
+				YAML.IntValue(2, TEXT("visibility"), (int32)Widget->GetVisibility());
+				YAML.Value(2, TEXT("is_visible"), Widget->IsVisible() ? TEXT("true") : TEXT("false"));
 
-				// Only export properties defined on this class, not inherited
-				if (Property->GetOwnerClass() == Widget->GetClass())
+				// Check if it's a panel with children
+				if (UPanelWidget* Panel = Cast<UPanelWidget>(Widget))
 				{
-					const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Widget);
-					PropertyToYAML(Property, ValuePtr, YAML, 3);
+					YAML.IntValue(2, TEXT("child_count"), Panel->GetChildrenCount());
 				}
+
+				// Export widget-specific properties
+				YAML.Key(2, TEXT("properties"));
+				for (const FSLFYAMLField& Field : YAML.GetFields(Widget->GetClass()))
+				{
+					// Only export properties defined on this class, not inherited
+					if (Field.Property->GetOwnerClass() == Widget->GetClass())
+					{
+						const void* ValuePtr = Field.Property->ContainerPtrToValuePtr<void>(Widget);
+						PropertyToYAML(Field, ValuePtr, YAML, 3);
+					}
+				}
+				YAML.Newline();
 			}
-			YAML += TEXT("\n");
 		}
-	}
 
-	// CDO
-	if (WidgetBP->GeneratedClass)
-	{
-		UObject* CDO = WidgetBP->GeneratedClass->GetDefaultObject();
-		if (CDO)
+		// CDO
+		if (WidgetBP->GeneratedClass)
 		{
-			YAML += TEXT("class_default_object:\n");
-			ObjectToYAML(CDO, YAML, 1);
+			UObject* CDO = WidgetBP->GeneratedClass->GetDefaultObject();
+			if (CDO)
+			{
+				YAML.Key(0, TEXT("class_default_object"));
+				ObjectToYAML(CDO, YAML, 1);
+			}
 		}
-	}
+	});
 
-	if (FFileHelper::SaveStringToFile(YAML, *OutputPath))
+	if (bSaved)
 	{
 		UE_LOG(LogTemp, Log, TEXT("[YAMLExporter] Exported Widget to: %s"), *OutputPath);
 		return true;
@@ -428,33 +456,36 @@ bool USLFYAMLExporter::ExportDataTableToYAML(const FString& TablePath, const FSt
 		return false;
 	}
 
-	FString YAML;
-	YAML += TEXT("# DataTable Export - AUTO-GENERATED\n");
-	YAML += TEXT("# DO NOT EDIT - This is the source of truth from bp_only\n\n");
+	const bool bSaved = WriteYAMLFile(OutputPath, [&](FSLFYAMLWriter& YAML)
+	{
+		YAML.Raw("# DataTable Export - AUTO-GENERATED\n");
+		YAML.Raw("# DO NOT EDIT - This is the source of truth from bp_only\n\n");
 
-	YAML += TEXT("datatable:\n");
-	YAML += FString::Printf(TEXT("  path: %s\n"), *EscapeYAMLString(TablePath));
-	YAML += FString::Printf(TEXT("  row_struct: %s\n"), DataTable->GetRowStruct() ? *DataTable->GetRowStruct()->GetName() : TEXT("None"));
+		const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+		YAML.Key(0, TEXT("datatable"));
+		YAML.EscapedValue(1, TEXT("path"), TablePath);
+		YAML.Value(1, TEXT("row_struct"), RowStruct ? RowStruct->GetName() : TEXT("None"));
 
-	TArray<FName> RowNames = DataTable->GetRowNames();
-	YAML += FString::Printf(TEXT("  row_count: %d\n"), RowNames.Num());
-	YAML += TEXT("\n");
+		// Rows are walked in place; the row struct's property list is resolved once for the whole table
+		const TMap<FName, uint8*>& RowMap = DataTable->GetRowMap();
+		YAML.IntValue(1, TEXT("row_count"), RowMap.Num());
+		YAML.Newline();
 
-	YAML += TEXT("rows:\n");
-	for (const FName& RowName : RowNames)
-	{
-		YAML += FString::Printf(TEXT("  - row_name: %s\n"), *RowName.ToString());
-
-		const uint8* RowData = DataTable->FindRowUnchecked(RowName);
-		if (RowData && DataTable->GetRowStruct())
+		YAML.Key(0, TEXT("rows"));
+		for (const TPair<FName, uint8*>& Row : RowMap)
 		{
-			YAML += TEXT("    columns:\n");
-			StructToYAML(RowData, DataTable->GetRowStruct(), YAML, 3);
+			YAML.Value(1, TEXT("- row_name"), FSLFNameText(Row.Key));
+
+			if (Row.Value && RowStruct)
+			{
+				YAML.Key(2, TEXT("columns"));
+				StructToYAML(Row.Value, RowStruct, YAML, 3);
+			}
+			YAML.Newline();
 		}
-		YAML += TEXT("\n");
-	}
+	});
 
-	if (FFileHelper::SaveStringToFile(YAML, *OutputPath))
+	if (bSaved)
 	{
 		UE_LOG(LogTemp, Log, TEXT("[YAMLExporter] Exported DataTable to: %s"), *OutputPath);
 		return true;
@@ -472,19 +503,21 @@ bool USLFYAMLExporter::ExportDataAssetToYAML(const FString& AssetPath, const FSt
 		return false;
 	}
 
-	FString YAML;
-	YAML += TEXT("# Data Asset Export - AUTO-GENERATED\n");
-	YAML += TEXT("# DO NOT EDIT - This is the source of truth from bp_only\n\n");
+	const bool bSaved = WriteYAMLFile(OutputPath, [&](FSLFYAMLWriter& YAML)
+	{
+		YAML.Raw("# Data Asset Export - AUTO-GENERATED\n");
+		YAML.Raw("# DO NOT EDIT - This is the source of truth from bp_only\n\n");
 
-	YAML += TEXT("data_asset:\n");
-	YAML += FString::Printf(TEXT("  path: %s\n"), *EscapeYAMLString(AssetPath));
-	YAML += FString::Printf(TEXT("  class: %s\n"), *Asset->GetClass()->GetName());
-	YAML += TEXT("\n");
+		YAML.Key(0, TEXT("data_asset"));
+		YAML.EscapedValue(1, TEXT("path"), AssetPath);
+		YAML.Value(1, TEXT("class"), Asset->GetClass()->GetName());
+		YAML.Newline();
 
-	YAML += TEXT("properties:\n");
-	ObjectToYAML(Asset, YAML, 1);
+		YAML.Key(0, TEXT("properties"));
+		ObjectToYAML(Asset, YAML, 1);
+	});
 
-	if (FFileHelper::SaveStringToFile(YAML, *OutputPath))
+	if (bSaved)
 	{
 		UE_LOG(LogTemp, Log, TEXT("[YAMLExporter] Exported DataAsset to: %s"), *OutputPath);
 		return true;
@@ -502,29 +535,32 @@ bool USLFYAMLExporter::ExportStructToYAML(const FString& StructPath, const FStri
 		return false;
 	}
 
-	FString YAML;
-	YAML += TEXT("# Struct Export - AUTO-GENERATED\n");
-	YAML += TEXT("# DO NOT EDIT - This is the source of truth from bp_only\n\n");
-
-	YAML += TEXT("struct:\n");
-	YAML += FString::Printf(TEXT("  path: %s\n"), *EscapeYAMLString(StructPath));
-	YAML += FString::Printf(TEXT("  name: %s\n"), *Struct->GetName());
-	YAML += TEXT("\n");
-
-	YAML += TEXT("fields:\n");
-	for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+	const bool bSaved = WriteYAMLFile(OutputPath, [&](FSLFYAMLWriter& YAML)
 	{
-		FProperty* Property = *PropIt;
-		if (!Property) continue;
+		YAML.Raw("# Struct Export - AUTO-GENERATED\n");
+		YAML.Raw("# DO NOT EDIT - This is the source of truth from bp_only\n\n");
 
-		YAML += FString::Printf(TEXT("  - name: %s\n"), *Property->GetName());
-		YAML += FString::Printf(TEXT("    type: %s\n"), *Property->GetCPPType());
-		YAML += FString::Printf(TEXT("    offset: %d\n"), Property->GetOffset_ForInternal());
-		YAML += FString::Printf(TEXT("    size: %d\n"), Property->GetSize());
-		YAML += TEXT("\n");
-	}
+		YAML.Key(0, TEXT("struct"));
+		YAML.EscapedValue(1, TEXT("path"), StructPath);
+		YAML.Value(1, TEXT("name"), Struct->GetName());
+		YAML.Newline();
+
+		// Every field, including deprecated and transient ones (layout documentation)
+		YAML.Key(0, TEXT("fields"));
+		for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+		{
+			FProperty* Property = *PropIt;
+			if (!Property) continue;
+
+			YAML.Value(1, TEXT("- name"), Property->GetName());
+			YAML.Value(2, TEXT("type"), Property->GetCPPType());
+			YAML.IntValue(2, TEXT("offset"), Property->GetOffset_ForInternal());
+			YAML.IntValue(2, TEXT("size"), Property->GetSize());
+			YAML.Newline();
+		}
+	});
 
-	if (FFileHelper::SaveStringToFile(YAML, *OutputPath))
+	if (bSaved)
 	{
 		UE_LOG(LogTemp, Log, TEXT("[YAMLExporter] Exported Struct to: %s"), *OutputPath);
 		return true;
@@ -536,6 +572,7 @@ bool USLFYAMLExporter::ExportStructToYAML(const FString& StructPath, const FStri
 int32 USLFYAMLExporter::ExportNPCSystemToYAML(const FString& OutputFolder)
 {
 	int32 ExportCount = 0;
+	const double StartTime = FPlatformTime::Seconds();
 
 	// Create subdirectories
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
@@ -648,7 +685,7 @@ int32 USLFYAMLExporter::ExportNPCSystemToYAML(const FString& OutputFolder)
 		if (ExportStructToYAML(StructPath, OutPath)) ExportCount++;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[YAMLExporter] Exported %d NPC system assets to: %s"), ExportCount, *OutputFolder);
+	UE_LOG(LogTemp, Log, TEXT("[YAMLExporter] Exported %d NPC system assets to: %s (%.2fs)"), ExportCount, *OutputFolder, FPlatformTime::Seconds() - StartTime);
 	return ExportCount;
 }
 
@@ -8,9 +8,15 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "SLFYAMLExporter.generated.h"
 
+class FSLFYAMLWriter;
+struct FSLFYAMLField;
+
 /**
  * YAML Exporter for complete asset documentation
  * Outputs machine-readable YAML with every single property
+ *
+ * Documents are streamed to disk through FSLFYAMLWriter rather than built up
+ * in one FString, so large DataTables and Blueprints export in bounded memory.
  */
 UCLASS()
 class SLFCONVERSION_API USLFYAMLExporter : public UBlueprintFunctionLibrary
@@ -55,14 +61,21 @@ public:
 	// HELPER FUNCTIONS
 	// ═══════════════════════════════════════════════════════════════════
 
-	/** Convert any UObject property to YAML string */
-	static void ObjectToYAML(UObject* Object, FString& OutYAML, int32 IndentLevel = 0);
+	/**
+	 * Stream a YAML document to OutputPath. Text is written as UTF-8, except that a
+	 * document containing non-ANSI characters is re-saved as UTF-16, which is what
+	 * FFileHelper::SaveStringToFile produced for the same text.
+	 */
+	static bool WriteYAMLFile(const FString& OutputPath, TFunctionRef<void(FSLFYAMLWriter&)> Emit);
+
+	/** Write every UObject property as YAML */
+	static void ObjectToYAML(UObject* Object, FSLFYAMLWriter& Writer, int32 IndentLevel = 0);
 
-	/** Convert struct data to YAML string */
-	static void StructToYAML(const void* StructData, const UStruct* StructType, FString& OutYAML, int32 IndentLevel);
+	/** Write struct data as YAML */
+	static void StructToYAML(const void* StructData, const UStruct* StructType, FSLFYAMLWriter& Writer, int32 IndentLevel);
 
-	/** Convert a single property to YAML string */
-	static void PropertyToYAML(FProperty* Property, const void* ValuePtr, FString& OutYAML, int32 IndentLevel);
+	/** Write a single property as YAML */
+	static void PropertyToYAML(const FSLFYAMLField& Field, const void* ValuePtr, FSLFYAMLWriter& Writer, int32 IndentLevel);
 
 	/** Get YAML-safe indent string */
 	static FString GetIndent(int32 Level);
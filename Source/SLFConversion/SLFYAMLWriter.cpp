@@ -0,0 +1,282 @@
+// SLFYAMLWriter.cpp
+// Streaming text emitter used by USLFYAMLExporter
+
+#include "SLFYAMLWriter.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+
+namespace
+{
+	constexpr int32 FlushThreshold = 64 * 1024;
+
+	/** 64 levels; deeper indents are written in several pieces */
+	constexpr int32 MaxIndentTableLevel = 64;
+	const ANSICHAR IndentTable[MaxIndentTableLevel * 2 + 1] =
+		"                                                                "
+		"                                                                ";
+
+	bool NeedsQuotes(FStringView Text)
+	{
+		if (Text.IsEmpty())
+		{
+			return false;
+		}
+
+		// Escaping never adds or removes these, so the raw text decides
+		if (Text[0] == TEXT(' ') || Text[Text.Len() - 1] == TEXT(' '))
+		{
+			return true;
+		}
+
+		for (const TCHAR Char : Text)
+		{
+			switch (Char)
+			{
+			case TEXT(':'):
+			case TEXT('#'):
+			case TEXT('['):
+			case TEXT(']'):
+			case TEXT('{'):
+			case TEXT('}'):
+				return true;
+			default:
+				break;
+			}
+		}
+		return false;
+	}
+
+	const ANSICHAR* GetEscape(TCHAR Char)
+	{
+		switch (Char)
+		{
+		case TEXT('\\'): return "\\\\";
+		case TEXT('"'):  return "\\\"";
+		case TEXT('\n'): return "\\n";
+		case TEXT('\r'): return "\\r";
+		case TEXT('\t'): return "\\t";
+		default:         return nullptr;
+		}
+	}
+}
+
+FSLFYAMLWriter::FSLFYAMLWriter(FArchive& InAr)
+	: Ar(InAr)
+{
+	Buffer.Reserve(FlushThreshold + 1024);
+}
+
+FSLFYAMLWriter::~FSLFYAMLWriter()
+{
+	Flush();
+}
+
+void FSLFYAMLWriter::Flush()
+{
+	if (Buffer.Num() > 0)
+	{
+		Ar.Serialize(Buffer.GetData(), Buffer.Num());
+		BytesFlushed += Buffer.Num();
+		Buffer.Reset();
+	}
+}
+
+void FSLFYAMLWriter::Append(const ANSICHAR* Data, int32 Num)
+{
+	Buffer.Append(Data, Num);
+	if (Buffer.Num() >= FlushThreshold)
+	{
+		Flush();
+	}
+}
+
+void FSLFYAMLWriter::AppendWide(const TCHAR* Data, int32 Num)
+{
+	int32 Index = 0;
+	while (Index < Num)
+	{
+		// 7-bit runs are copied byte for byte
+		const int32 AsciiStart = Index;
+		while (Index < Num && Data[Index] < 0x80)
+		{
+			++Index;
+		}
+		if (Index > AsciiStart)
+		{
+			const int32 RunLength = Index - AsciiStart;
+			const int32 Offset = Buffer.AddUninitialized(RunLength);
+			for (int32 Char = 0; Char < RunLength; ++Char)
+			{
+				Buffer[Offset + Char] = static_cast<ANSICHAR>(Data[AsciiStart + Char]);
+			}
+		}
+
+		// Anything else goes through the UTF-8 converter a run at a time (keeps surrogate pairs together)
+		const int32 WideStart = Index;
+		while (Index < Num && Data[Index] >= 0x80)
+		{
+			++Index;
+		}
+		if (Index > WideStart)
+		{
+			bNonAnsi = true;
+			const FTCHARToUTF8 Converted(Data + WideStart, Index - WideStart);
+			Buffer.Append(reinterpret_cast<const ANSICHAR*>(Converted.Get()), Converted.Length());
+		}
+	}
+
+	if (Buffer.Num() >= FlushThreshold)
+	{
+		Flush();
+	}
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::Indent(int32 Level)
+{
+	while (Level > 0)
+	{
+		const int32 Chunk = FMath::Min(Level, MaxIndentTableLevel);
+		Append(IndentTable, Chunk * 2);
+		Level -= Chunk;
+	}
+	return *this;
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::Raw(FStringView Text)
+{
+	AppendWide(Text.GetData(), Text.Len());
+	return *this;
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::Raw(const ANSICHAR* Text)
+{
+	Append(Text, FCStringAnsi::Strlen(Text));
+	return *this;
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::Escaped(FStringView Text)
+{
+	const bool bQuote = NeedsQuotes(Text);
+	if (bQuote)
+	{
+		Append("\"", 1);
+	}
+
+	const TCHAR* Data = Text.GetData();
+	int32 RunStart = 0;
+	for (int32 Index = 0; Index < Text.Len(); ++Index)
+	{
+		if (const ANSICHAR* Escape = GetEscape(Data[Index]))
+		{
+			AppendWide(Data + RunStart, Index - RunStart);
+			Append(Escape, 2);
+			RunStart = Index + 1;
+		}
+	}
+	AppendWide(Data + RunStart, Text.Len() - RunStart);
+
+	if (bQuote)
+	{
+		Append("\"", 1);
+	}
+	return *this;
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::Int(int64 Number)
+{
+	ANSICHAR Digits[32];
+	const int32 Length = FCStringAnsi::Snprintf(Digits, UE_ARRAY_COUNT(Digits), "%lld", static_cast<long long>(Number));
+	Append(Digits, Length);
+	return *this;
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::Float(double Number)
+{
+	// %f of DBL_MAX is 316 characters
+	ANSICHAR Digits[512];
+	const int32 Length = FCStringAnsi::Snprintf(Digits, UE_ARRAY_COUNT(Digits), "%f", Number);
+	Append(Digits, FMath::Clamp(Length, 0, (int32)UE_ARRAY_COUNT(Digits) - 1));
+	return *this;
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::Bool(bool bValue)
+{
+	return bValue ? Raw("true") : Raw("false");
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::Newline()
+{
+	Append("\n", 1);
+	return *this;
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::Key(int32 Level, FStringView Name)
+{
+	return Indent(Level).Raw(Name).Raw(":\n");
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::Value(int32 Level, FStringView Name, FStringView Text)
+{
+	return Indent(Level).Raw(Name).Raw(": ").Raw(Text).Newline();
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::EscapedValue(int32 Level, FStringView Name, FStringView Text)
+{
+	return Indent(Level).Raw(Name).Raw(": ").Escaped(Text).Newline();
+}
+
+FSLFYAMLWriter& FSLFYAMLWriter::IntValue(int32 Level, FStringView Name, int64 Number)
+{
+	return Indent(Level).Raw(Name).Raw(": ").Int(Number).Newline();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// REFLECTION CACHE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+ESLFYAMLPropertyKind FSLFYAMLWriter::ClassifyProperty(const FProperty* Property)
+{
+	// Same precedence as the exporter's original cast chain
+	if (Property->IsA<FStructProperty>())     return ESLFYAMLPropertyKind::Struct;
+	if (Property->IsA<FObjectProperty>())     return ESLFYAMLPropertyKind::Object;
+	if (Property->IsA<FSoftObjectProperty>()) return ESLFYAMLPropertyKind::SoftObject;
+	if (Property->IsA<FArrayProperty>())      return ESLFYAMLPropertyKind::Array;
+	if (Property->IsA<FMapProperty>())        return ESLFYAMLPropertyKind::Map;
+	if (Property->IsA<FTextProperty>())       return ESLFYAMLPropertyKind::Text;
+	if (Property->IsA<FStrProperty>())        return ESLFYAMLPropertyKind::String;
+	if (Property->IsA<FNameProperty>())       return ESLFYAMLPropertyKind::Name;
+	if (Property->IsA<FBoolProperty>())       return ESLFYAMLPropertyKind::Bool;
+	if (Property->IsA<FIntProperty>())        return ESLFYAMLPropertyKind::Int;
+	if (Property->IsA<FFloatProperty>())      return ESLFYAMLPropertyKind::Float;
+	if (Property->IsA<FDoubleProperty>())     return ESLFYAMLPropertyKind::Double;
+	if (Property->IsA<FEnumProperty>())       return ESLFYAMLPropertyKind::Enum;
+	if (Property->IsA<FByteProperty>())       return ESLFYAMLPropertyKind::Byte;
+	return ESLFYAMLPropertyKind::Other;
+}
+
+const TArray<FSLFYAMLField>& FSLFYAMLWriter::GetFields(const UStruct* Struct)
+{
+	if (const TUniquePtr<TArray<FSLFYAMLField>>* Cached = FieldCache.Find(Struct))
+	{
+		return **Cached;
+	}
+
+	// Heap-allocated so callers iterating an outer struct's fields survive the map growing
+	TUniquePtr<TArray<FSLFYAMLField>> Fields = MakeUnique<TArray<FSLFYAMLField>>();
+	for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+	{
+		FProperty* Property = *PropIt;
+		if (!Property || Property->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient))
+		{
+			continue;
+		}
+
+		FSLFYAMLField& Field = Fields->AddDefaulted_GetRef();
+		Field.Property = Property;
+		Field.Name = Property->GetName();
+		Field.Kind = ClassifyProperty(Property);
+	}
+
+	return *FieldCache.Add(Struct, MoveTemp(Fields));
+}
@@ -0,0 +1,117 @@
+// SLFYAMLWriter.h
+// Streaming text emitter used by USLFYAMLExporter
+//
+// Lines are appended straight into a fixed-size UTF-8 buffer that is flushed to an
+// FArchive (usually a file writer), so an export never holds the whole document.
+// Indentation comes from a static table of spaces, escaping and number formatting
+// write in place, and reflected property lists are cached per UStruct for the
+// lifetime of the writer (one export), so DataTable rows sharing a row struct only
+// walk its fields once.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FProperty;
+class UStruct;
+
+/** How USLFYAMLExporter formats a property (resolved once per field) */
+enum class ESLFYAMLPropertyKind : uint8
+{
+	Struct,
+	Object,
+	SoftObject,
+	Array,
+	Map,
+	Text,
+	String,
+	Name,
+	Bool,
+	Int,
+	Float,
+	Double,
+	Enum,
+	Byte,
+	Other
+};
+
+/** Exportable property of a struct or class, as cached by FSLFYAMLWriter */
+struct FSLFYAMLField
+{
+	FProperty* Property = nullptr;
+	FString Name;
+	ESLFYAMLPropertyKind Kind = ESLFYAMLPropertyKind::Other;
+};
+
+class SLFCONVERSION_API FSLFYAMLWriter
+{
+public:
+	/** Output is written to Ar as UTF-8 (byte-identical to ANSI for 7-bit text) */
+	explicit FSLFYAMLWriter(FArchive& InAr);
+	~FSLFYAMLWriter();
+
+	FSLFYAMLWriter(const FSLFYAMLWriter&) = delete;
+	FSLFYAMLWriter& operator=(const FSLFYAMLWriter&) = delete;
+
+	/** Two spaces per level */
+	FSLFYAMLWriter& Indent(int32 Level);
+	FSLFYAMLWriter& Raw(FStringView Text);
+	FSLFYAMLWriter& Raw(const ANSICHAR* Text);
+
+	/** Same escaping and quoting as USLFYAMLExporter::EscapeYAMLString, without the copy */
+	FSLFYAMLWriter& Escaped(FStringView Text);
+
+	/** %d / %f formatting, matching FString::Printf */
+	FSLFYAMLWriter& Int(int64 Value);
+	FSLFYAMLWriter& Float(double Value);
+	FSLFYAMLWriter& Bool(bool bValue);
+	FSLFYAMLWriter& Newline();
+
+	// ═══════════════════════════════════════════════════════════════════
+	// LINE HELPERS
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** "<indent>Key:\n" */
+	FSLFYAMLWriter& Key(int32 Level, FStringView Name);
+
+	/** "<indent>Key: Value\n" (value written as-is) */
+	FSLFYAMLWriter& Value(int32 Level, FStringView Name, FStringView Text);
+
+	/** "<indent>Key: Value\n" (value escaped) */
+	FSLFYAMLWriter& EscapedValue(int32 Level, FStringView Name, FStringView Text);
+
+	/** "<indent>Key: 123\n" */
+	FSLFYAMLWriter& IntValue(int32 Level, FStringView Name, int64 Number);
+
+	/** Push buffered bytes to the archive */
+	void Flush();
+
+	/** Any character above 0x7F was written (FFileHelper would have saved the text as UTF-16) */
+	bool HasNonAnsiText() const { return bNonAnsi; }
+
+	int64 GetBytesWritten() const { return BytesFlushed + Buffer.Num(); }
+
+	// ═══════════════════════════════════════════════════════════════════
+	// REFLECTION CACHE
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Non-deprecated, non-transient properties of Struct (super fields included, TFieldIterator order) */
+	const TArray<FSLFYAMLField>& GetFields(const UStruct* Struct);
+
+	/** Scratch string for ExportTextItem results (reset, capacity kept) */
+	FString& GetScratch() { Scratch.Reset(); return Scratch; }
+
+	static ESLFYAMLPropertyKind ClassifyProperty(const FProperty* Property);
+
+private:
+	void Append(const ANSICHAR* Data, int32 Num);
+	void AppendWide(const TCHAR* Data, int32 Num);
+
+	FArchive& Ar;
+	TArray<ANSICHAR> Buffer;
+	int64 BytesFlushed = 0;
+	bool bNonAnsi = false;
+
+	TMap<const UStruct*, TUniquePtr<TArray<FSLFYAMLField>>> FieldCache;
+	FString Scratch;
+};
@@ -6,11 +6,13 @@
 //   -run=SetupBatchEnemy -name=withered_wanderer
 //   -run=SetupBatchEnemy -name=withered_wanderer -skipmesh -skipanims
 //   -run=SetupBatchEnemy -name=ALL   (batch all enemies found in test_meshes/)
+//   -run=SetupBatchEnemy -name=ALL -force   (ignore the import manifest, redo every step)
 
 #include "SetupBatchEnemyCommandlet.h"
 
 #if WITH_EDITOR
 #include "SLFAutomationLibrary.h"
+#include "SLFEnemyImportManifest.h"
 #include "Animation/SLFAnimNotifyStateWeaponTrace.h"
 #include "SLFPrimaryDataAssets.h"
 #include "Animation/Skeleton.h"
@@ -59,6 +61,50 @@
 #include "Dom/JsonObject.h"
 #include "Internationalization/Regex.h"
 
+namespace
+{
+	/** Names of the packages saved while it is alive - what an import step actually wrote */
+	class FSavedPackageRecorder
+	{
+	public:
+		FSavedPackageRecorder()
+		{
+			Handle = UPackage::PackageSavedWithContextEvent.AddLambda(
+				[this](const FString& Filename, UPackage* Package, FObjectPostSaveContext Context)
+				{
+					if (Package)
+					{
+						Packages.AddUnique(Package->GetName());
+					}
+				});
+		}
+
+		~FSavedPackageRecorder()
+		{
+			UPackage::PackageSavedWithContextEvent.Remove(Handle);
+		}
+
+		FSavedPackageRecorder(const FSavedPackageRecorder&) = delete;
+		FSavedPackageRecorder& operator=(const FSavedPackageRecorder&) = delete;
+
+		/** Start a new step */
+		void Reset() { Packages.Reset(); }
+
+		/** Packages saved since the last Reset / Consume, sorted */
+		TArray<FString> Consume()
+		{
+			TArray<FString> Result = MoveTemp(Packages);
+			Packages.Reset();
+			Result.Sort();
+			return Result;
+		}
+
+	private:
+		TArray<FString> Packages;
+		FDelegateHandle Handle;
+	};
+}
+
 USetupBatchEnemyCommandlet::USetupBatchEnemyCommandlet()
 {
 	IsClient = false;
@@ -163,28 +209,15 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 
 	bool bSkipMesh = Params.Contains(TEXT("-skipmesh"));
 	bool bSkipAnims = Params.Contains(TEXT("-skipanims"));
+	bool bForce = Params.Contains(TEXT("-force"));
+
+	const double StartTime = FPlatformTime::Seconds();
 
 	// Handle -name=ALL: process all enemy directories that have fbx/ subdirs
 	TArray<FString> EnemiesToProcess;
 	if (EnemyName.Equals(TEXT("ALL"), ESearchCase::IgnoreCase))
 	{
-		IFileManager& FM = IFileManager::Get();
-		TArray<FString> FoundDirs;
-		FString SearchPath = FString(SourceBaseDir) / TEXT("*");
-		FM.FindFiles(FoundDirs, *SearchPath, false, true);
-		for (const FString& Dir : FoundDirs)
-		{
-			FString FBXDir = FString(SourceBaseDir) / Dir / TEXT("fbx");
-			if (FM.DirectoryExists(*FBXDir))
-			{
-				TArray<FString> FBXFiles;
-				FM.FindFiles(FBXFiles, *(FBXDir / TEXT("*.fbx")), true, false);
-				if (FBXFiles.Num() > 0)
-				{
-					EnemiesToProcess.Add(Dir);
-				}
-			}
-		}
+		EnemiesToProcess = FSLFEnemyImportManifest::DiscoverEnemies(SourceBaseDir);
 		UE_LOG(LogTemp, Warning, TEXT("Found %d enemies to process"), EnemiesToProcess.Num());
 	}
 	else
@@ -192,6 +225,26 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 		EnemiesToProcess.Add(EnemyName);
 	}
 
+	// Hash every source file and parse the JSON on worker threads before any UObject work.
+	// Unchanged files (same size + timestamp as the manifest) reuse their recorded hash.
+	// -force still loads the manifest (other enemies' entries are kept) but redoes every step.
+	const FString ManifestPath = FSLFEnemyImportManifest::GetDefaultPath();
+	FSLFEnemyImportManifest Manifest;
+	Manifest.Load(ManifestPath);
+
+	const double ScanStart = FPlatformTime::Seconds();
+	const TArray<FSLFEnemySourceScan> Scans = Manifest.ScanSources(SourceBaseDir, EnemiesToProcess);
+	int32 FilesTotal = 0;
+	int32 FilesHashed = 0;
+	for (const FSLFEnemySourceScan& Scan : Scans)
+	{
+		FilesTotal += Scan.Files.Num();
+		FilesHashed += Scan.FilesHashed;
+	}
+	UE_LOG(LogTemp, Warning, TEXT("Scanned %d enemies in %.0f ms: %d source files, %d hashed, %d unchanged (manifest: %d entries%s)"),
+		Scans.Num(), (FPlatformTime::Seconds() - ScanStart) * 1000.0, FilesTotal, FilesHashed, FilesTotal - FilesHashed,
+		Manifest.Num(), bForce ? TEXT(", -force") : TEXT(""));
+
 	// Initialize Slate (needed for UAssetImportTask)
 	if (!FSlateApplication::IsInitialized())
 	{
@@ -199,9 +252,13 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 	}
 
 	int32 SuccessCount = 0;
+	int32 UpToDateCount = 0;
 
-	for (const FString& Enemy : EnemiesToProcess)
+	for (const FSLFEnemySourceScan& Scan : Scans)
 	{
+		const FString& Enemy = Scan.EnemyName;
+		CurrentScan = &Scan;
+
 		FString PascalName = ToPascalCase(Enemy);
 		FString SourceDir = FString(SourceBaseDir) / Enemy;
 		FString FBXDir = SourceDir / TEXT("fbx");
@@ -216,12 +273,40 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 		UE_LOG(LogTemp, Warning, TEXT("╚══════════════════════════════════════════════════════════════╝"));
 
 		// Verify source directory exists
-		if (!IFileManager::Get().DirectoryExists(*SourceDir))
+		if (!Scan.bExists)
 		{
 			UE_LOG(LogTemp, Error, TEXT("  Source directory not found: %s"), *SourceDir);
 			continue;
 		}
 
+		// Steps chain (mesh -> animations -> assets): a step is only current if the ones before it are
+		const bool bMeshUpToDate = !bForce && Manifest.IsStepUpToDate(Scan, ESLFEnemyImportStep::Mesh);
+		const bool bAnimsUpToDate = bMeshUpToDate && Manifest.IsStepUpToDate(Scan, ESLFEnemyImportStep::Animations);
+		const bool bAssetsUpToDate = bAnimsUpToDate && Manifest.IsStepUpToDate(Scan, ESLFEnemyImportStep::Assets);
+		if (bAssetsUpToDate)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("  Sources unchanged, all outputs present - skipped"));
+			UpToDateCount++;
+			SuccessCount++;
+			continue;
+		}
+
+		if (!bForce)
+		{
+			const TArray<FString> Changed = Manifest.GetChangedFiles(Scan);
+			UE_LOG(LogTemp, Warning, TEXT("  %d changed source file(s)%s%s"), Changed.Num(),
+				Changed.Num() > 0 ? TEXT(": ") : TEXT(""), *FString::Join(TArrayView<const FString>(Changed).Left(8), TEXT(", ")));
+		}
+
+		// Record a finished step with the packages it saved, and save right away so an
+		// interrupted roster run resumes here
+		FSavedPackageRecorder SavedPackages;
+		auto RecordStep = [&](ESLFEnemyImportStep Step)
+		{
+			Manifest.RecordStep(Scan, Step, SavedPackages.Consume());
+			Manifest.Save(ManifestPath);
+		};
+
 		// ═══════════════════════════════════════════════════════════════
 		// Step 0: Import Mesh
 		// ═══════════════════════════════════════════════════════════════
@@ -229,6 +314,10 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("--- Step 0: SKIP mesh import (-skipmesh) ---"));
 		}
+		else if (bMeshUpToDate)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("--- Step 0: SKIP mesh import (mesh FBX and textures unchanged) ---"));
+		}
 		else
 		{
 			UE_LOG(LogTemp, Warning, TEXT("--- Step 0: Import mesh ---"));
@@ -338,29 +427,41 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 		// Textures can be imported via SLF.SetupSentinelTextures pattern after commandlet completes.
 		// ═══════════════════════════════════════════════════════════════
 		// Texture import skipped when -skipmesh (crashes on sequential commandlet runs due to Slate/ContentBrowser)
-		if (!bSkipMesh)
+		if (!bSkipMesh && !bMeshUpToDate)
 		{
-			ImportTexturesAndCreateMaterial(SourceDir, DestDir, PascalName);
+			if (ImportTexturesAndCreateMaterial(SourceDir, DestDir, PascalName))
+			{
+				RecordStep(ESLFEnemyImportStep::Mesh);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("  Mesh step incomplete for %s - not recorded, will rerun"), *Enemy);
+			}
 		}
+		SavedPackages.Reset();
 
 		// ═══════════════════════════════════════════════════════════════
 		// Step 1: Import Animations
 		// ═══════════════════════════════════════════════════════════════
 		TMap<FString, FString> AnimCategoryMap; // AnimName -> Category
+		bool bAnimsOk = true; // Every import, socket and montage sub-step succeeded
 
 		// Check for animation_config.json — if present, use config-driven import
 		FString ConfigPath = SourceDir / TEXT("animation_config.json");
-		bool bHasAnimConfig = FPaths::FileExists(ConfigPath);
+		bool bHasAnimConfig = Scan.Files.Contains(TEXT("animation_config.json"));
+
+		if (bAnimsUpToDate)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("--- Steps 1-3: SKIP animations, sockets, montages (FBX and config unchanged) ---"));
+			goto SkipLegacyMontages;
+		}
 
 		if (bHasAnimConfig)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("--- Config-driven import: %s ---"), *ConfigPath);
 
-			FString ConfigJson;
-			FFileHelper::LoadFileToString(ConfigJson, *ConfigPath);
-			TSharedPtr<FJsonObject> Config;
-			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ConfigJson);
-			FJsonSerializer::Deserialize(Reader, Config);
+			// Parsed on a worker during the scan
+			TSharedPtr<FJsonObject> Config = Scan.AnimationConfig;
 
 			if (!Config.IsValid())
 			{
@@ -454,7 +555,11 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 						PackageFilename = FPackageName::LongPackageNameToFilename(SeqPackage->GetName(), FPackageName::GetAssetPackageExtension());
 						FSavePackageArgs SaveArgs;
 						SaveArgs.TopLevelFlags = RF_Standalone;
-						UPackage::SavePackage(SeqPackage, ImportedSeq, *PackageFilename, SaveArgs);
+						if (!UPackage::SavePackage(SeqPackage, ImportedSeq, *PackageFilename, SaveArgs))
+						{
+							UE_LOG(LogTemp, Warning, TEXT("    Failed to save: %s"), *AnimName);
+							return false;
+						}
 					}
 				}
 
@@ -465,7 +570,7 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 				FString Result = USLFAutomationLibrary::CreateMontageFromSequence(AnimPath, MontagePath, TEXT("DefaultSlot"));
 				UE_LOG(LogTemp, Warning, TEXT("  %s (%s/%s) -> %s"), *MontageName, *Source, *AnimId,
 					Result.Contains(TEXT("OK")) || Result.Contains(TEXT("Created")) ? TEXT("OK") : *Result);
-				return true;
+				return !Result.Contains(TEXT("ERROR"));
 			};
 
 			// Import attacks
@@ -478,7 +583,7 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 					FString Src = A->GetStringField(TEXT("source"));
 					FString Aid = A->GetStringField(TEXT("anim_id"));
 					FString Suffix = FString::Printf(TEXT("Attack%02d"), i + 1);
-					ImportAndCreateMontage(Src, Aid, Suffix);
+					bAnimsOk &= ImportAndCreateMontage(Src, Aid, Suffix);
 				}
 			}
 
@@ -494,7 +599,7 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 					FString Suffix = (HeavyAttacks->Num() == 1)
 						? TEXT("HeavyAttack")
 						: FString::Printf(TEXT("HeavyAttack%02d"), i + 1);
-					ImportAndCreateMontage(Src, Aid, Suffix);
+					bAnimsOk &= ImportAndCreateMontage(Src, Aid, Suffix);
 				}
 			}
 
@@ -506,7 +611,7 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 				{
 					FString Src = (*Obj)->GetStringField(TEXT("source"));
 					FString Aid = (*Obj)->GetStringField(TEXT("anim_id"));
-					ImportAndCreateMontage(Src, Aid, Suffix);
+					bAnimsOk &= ImportAndCreateMontage(Src, Aid, Suffix);
 				}
 			};
 			ImportSingle(TEXT("idle"), TEXT("Idle"));
@@ -526,7 +631,7 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 						FString Src = A->GetStringField(TEXT("source"));
 						FString Aid = A->GetStringField(TEXT("anim_id"));
 						FString Suffix = FString::Printf(TEXT("%s%02d"), *Prefix, i + 1);
-						ImportAndCreateMontage(Src, Aid, Suffix, bRootMotion);
+						bAnimsOk &= ImportAndCreateMontage(Src, Aid, Suffix, bRootMotion);
 					}
 				}
 			};
@@ -556,7 +661,16 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 			}
 
 			// Add sockets
-			AddSockets(SkeletonObjPath);
+			bAnimsOk &= AddSockets(SkeletonObjPath);
+
+			if (bAnimsOk)
+			{
+				RecordStep(ESLFEnemyImportStep::Animations);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("  Animation step incomplete for %s - not recorded, will rerun"), *Enemy);
+			}
 
 			// Skip legacy import + montage creation (already done above)
 			goto SkipLegacyMontages;
@@ -569,8 +683,10 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 		else
 		{
 			UE_LOG(LogTemp, Warning, TEXT("--- Step 1: Import animations (legacy scan) ---"));
-			int32 AnimCount = ImportAnimations(FBXDir, AnimDir, PascalName, Skeleton);
-			UE_LOG(LogTemp, Warning, TEXT("  Imported %d animations"), AnimCount);
+			int32 FailedAnims = 0;
+			int32 AnimCount = ImportAnimations(FBXDir, AnimDir, PascalName, Skeleton, &FailedAnims);
+			UE_LOG(LogTemp, Warning, TEXT("  Imported %d animations (%d failed)"), AnimCount, FailedAnims);
+			bAnimsOk &= FailedAnims == 0;
 		}
 
 		// Discover all imported animations and categorize them
@@ -596,33 +712,47 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 		// Step 2: Add sockets
 		// ═══════════════════════════════════════════════════════════════
 		UE_LOG(LogTemp, Warning, TEXT("--- Step 2: Adding sockets ---"));
-		AddSockets(SkeletonObjPath);
+		bAnimsOk &= AddSockets(SkeletonObjPath);
 
 		// ═══════════════════════════════════════════════════════════════
 		// Step 3: Create montages (legacy scan-based)
 		// ═══════════════════════════════════════════════════════════════
 		UE_LOG(LogTemp, Warning, TEXT("--- Step 3: Creating montages ---"));
-		CreateMontages(DestDir, AnimDir, PascalName, AnimCategoryMap);
+		bAnimsOk &= CreateMontages(DestDir, AnimDir, PascalName, AnimCategoryMap);
+
+		if (!bSkipAnims)
+		{
+			if (bAnimsOk)
+			{
+				RecordStep(ESLFEnemyImportStep::Animations);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("  Animation step incomplete for %s - not recorded, will rerun"), *Enemy);
+			}
+		}
 
 		SkipLegacyMontages:
+		SavedPackages.Reset();
+		bool bAssetsOk = true;
 
 		// ═══════════════════════════════════════════════════════════════
 		// Step 4: Create blend space
 		// ═══════════════════════════════════════════════════════════════
 		UE_LOG(LogTemp, Warning, TEXT("--- Step 4: Creating blend space ---"));
-		CreateBlendSpace(DestDir, AnimDir, PascalName, SkeletonObjPath);
+		bAssetsOk &= CreateBlendSpace(DestDir, AnimDir, PascalName, SkeletonObjPath);
 
 		// ═══════════════════════════════════════════════════════════════
 		// Step 5: Create AnimBP
 		// ═══════════════════════════════════════════════════════════════
 		UE_LOG(LogTemp, Warning, TEXT("--- Step 5: Creating AnimBP ---"));
-		CreateAnimBP(DestDir, AnimDir, PascalName, SkeletonObjPath);
+		bAssetsOk &= CreateAnimBP(DestDir, AnimDir, PascalName, SkeletonObjPath);
 
 		// ═══════════════════════════════════════════════════════════════
 		// Step 6: Create data assets
 		// ═══════════════════════════════════════════════════════════════
 		UE_LOG(LogTemp, Warning, TEXT("--- Step 6: Creating data assets ---"));
-		CreateDataAssets(DestDir, AnimDir, PascalName, Enemy);
+		bAssetsOk &= CreateDataAssets(DestDir, AnimDir, PascalName, Enemy);
 
 		// ═══════════════════════════════════════════════════════════════
 		// Step 7: Add weapon traces
@@ -634,6 +764,7 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 		// Step 8: Create Blueprint (parented to ASLFEnemyGeneric, with EnemyTypeName set)
 		// ═══════════════════════════════════════════════════════════════
 		UE_LOG(LogTemp, Warning, TEXT("--- Step 8: Creating Blueprint ---"));
+		bool bBlueprintOk = false;
 		{
 			FString BPDir = TEXT("/Game/CustomEnemies") / PascalName;
 			FString BPName = FString::Printf(TEXT("B_%s"), *PascalName);
@@ -673,13 +804,25 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 						}
 
 						FKismetEditorUtilities::CompileBlueprint(NewBP, EBlueprintCompileOptions::SkipGarbageCollection);
-
-						FSavePackageArgs SaveArgs;
-						SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-						FString Filename = FPackageName::LongPackageNameToFilename(BPPkg->GetName(), FPackageName::GetAssetPackageExtension());
-						UPackage::SavePackage(BPPkg, NewBP, *Filename, SaveArgs);
-
-						UE_LOG(LogTemp, Warning, TEXT("  Created %s (EnemyTypeName=%s)"), *BPName, *PascalName);
+						if (NewBP->Status == BS_Error)
+						{
+							UE_LOG(LogTemp, Error, TEXT("  %s failed to compile"), *BPName);
+						}
+						else
+						{
+							FSavePackageArgs SaveArgs;
+							SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+							FString Filename = FPackageName::LongPackageNameToFilename(BPPkg->GetName(), FPackageName::GetAssetPackageExtension());
+							bBlueprintOk = UPackage::SavePackage(BPPkg, NewBP, *Filename, SaveArgs);
+							if (bBlueprintOk)
+							{
+								UE_LOG(LogTemp, Warning, TEXT("  Created %s (EnemyTypeName=%s)"), *BPName, *PascalName);
+							}
+							else
+							{
+								UE_LOG(LogTemp, Error, TEXT("  Failed to save %s"), *Filename);
+							}
+						}
 					}
 				}
 			}
@@ -688,15 +831,28 @@ int32 USetupBatchEnemyCommandlet::Main(const FString& Params)
 				UE_LOG(LogTemp, Error, TEXT("  ASLFEnemyGeneric class not found!"));
 			}
 		}
+		bAssetsOk &= bBlueprintOk;
+
+		// A failed sub-step leaves the step unrecorded, so the next run redoes it
+		if (bAssetsOk)
+		{
+			RecordStep(ESLFEnemyImportStep::Assets);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("  Asset step incomplete for %s - not recorded, will rerun"), *PascalName);
+		}
 
 		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 
 		UE_LOG(LogTemp, Warning, TEXT("=== %s COMPLETE ==="), *PascalName);
 		SuccessCount++;
 	}
+	CurrentScan = nullptr;
 
 	UE_LOG(LogTemp, Warning, TEXT(""));
-	UE_LOG(LogTemp, Warning, TEXT("=== SetupBatchEnemy: %d/%d enemies processed ==="), SuccessCount, EnemiesToProcess.Num());
+	UE_LOG(LogTemp, Warning, TEXT("=== SetupBatchEnemy: %d/%d enemies processed (%d up to date) in %.1f s ==="),
+		SuccessCount, EnemiesToProcess.Num(), UpToDateCount, FPlatformTime::Seconds() - StartTime);
 	return 0;
 }
 
@@ -793,6 +949,7 @@ bool USetupBatchEnemyCommandlet::ImportTexturesAndCreateMaterial(
 
 	FAssetToolsModule& ATModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
 	TMap<FString, UTexture2D*> ImportedTextures;
+	bool bOk = true; // False once any texture, the material or the mesh fails to import or save
 
 	// Lambda to load existing textures from Content
 	auto TryLoadExistingTex = [&](const FString& Suffix) -> UTexture2D*
@@ -822,12 +979,17 @@ bool USetupBatchEnemyCommandlet::ImportTexturesAndCreateMaterial(
 		FString TexName = FString::Printf(TEXT("T_%s%s"), *PascalName, TexFile.Suffix);
 		FString PackagePath = DestDir / TexName;
 		UPackage* TexPackage = CreatePackage(*PackagePath);
-		if (!TexPackage) continue;
+		if (!TexPackage)
+		{
+			bOk = false;
+			continue;
+		}
 
 		TArray<uint8> FileData;
 		if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
 		{
 			UE_LOG(LogTemp, Error, TEXT("  Failed to read: %s"), *FilePath);
+			bOk = false;
 			continue;
 		}
 
@@ -852,15 +1014,20 @@ bool USetupBatchEnemyCommandlet::ImportTexturesAndCreateMaterial(
 			TexPackage->MarkPackageDirty();
 			FSavePackageArgs SaveArgs;
 			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-			UPackage::SavePackage(TexPackage, Tex,
+			if (!UPackage::SavePackage(TexPackage, Tex,
 				*FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension()),
-				SaveArgs);
+				SaveArgs))
+			{
+				UE_LOG(LogTemp, Error, TEXT("  Failed to save texture: %s"), *TexName);
+				bOk = false;
+			}
 			ImportedTextures.Add(FString(TexFile.Suffix), Tex);
 			UE_LOG(LogTemp, Warning, TEXT("  Imported texture: %s (%dx%d)"), *TexName, Tex->GetSizeX(), Tex->GetSizeY());
 		}
 		else
 		{
 			UE_LOG(LogTemp, Error, TEXT("  Failed to import texture: %s"), *FilePath);
+			bOk = false;
 		}
 	}
 
@@ -872,8 +1039,9 @@ CreateMaterial:
 
 	if (!T_BaseColor)
 	{
+		// Nothing to build from - only a failed import above makes this step incomplete
 		UE_LOG(LogTemp, Warning, TEXT("  No base color texture, skipping material creation"));
-		return false;
+		return bOk;
 	}
 
 	// Create full UMaterial (not MaterialInstance) with proper PBR setup
@@ -994,7 +1162,11 @@ CreateMaterial:
 
 	Material->PreEditChange(nullptr);
 	Material->PostEditChange();
-	SaveAsset(Material, MatPkg);
+	if (!SaveAsset(Material, MatPkg))
+	{
+		UE_LOG(LogTemp, Error, TEXT("  Failed to save material: %s"), *MatName);
+		bOk = false;
+	}
 	UE_LOG(LogTemp, Warning, TEXT("  Created PBR material: %s"), *MatName);
 
 	// Assign material to mesh
@@ -1020,16 +1192,26 @@ CreateMaterial:
 		UPackage* MeshPkg = Mesh->GetOutermost();
 		FSavePackageArgs SA;
 		SA.TopLevelFlags = RF_Standalone;
-		UPackage::SavePackage(MeshPkg, Mesh,
-			*FPackageName::LongPackageNameToFilename(MeshPkg->GetName(), FPackageName::GetAssetPackageExtension()), SA);
+		if (!UPackage::SavePackage(MeshPkg, Mesh,
+			*FPackageName::LongPackageNameToFilename(MeshPkg->GetName(), FPackageName::GetAssetPackageExtension()), SA))
+		{
+			UE_LOG(LogTemp, Error, TEXT("  Failed to save SKM_%s"), *PascalName);
+			bOk = false;
+		}
 		UE_LOG(LogTemp, Warning, TEXT("  Assigned M_%s to SKM_%s"), *PascalName, *PascalName);
 	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("  Mesh not found for material assignment: %s"), *MeshPath);
+		bOk = false;
+	}
 
-	return true;
+	return bOk;
 }
 
 int32 USetupBatchEnemyCommandlet::ImportAnimations(
-	const FString& FBXDir, const FString& DestAnimDir, const FString& PascalName, USkeleton* Skeleton)
+	const FString& FBXDir, const FString& DestAnimDir, const FString& PascalName, USkeleton* Skeleton,
+	int32* OutFailedCount)
 {
 	// Find all FBX files in the directory
 	TArray<FString> FBXFiles;
@@ -1119,6 +1301,7 @@ int32 USetupBatchEnemyCommandlet::ImportAnimations(
 		if (!bFound)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("  %s: FAILED to import as AnimSequence"), *AnimName);
+			if (OutFailedCount) (*OutFailedCount)++;
 		}
 
 		ImportTask->RemoveFromRoot();
@@ -1128,7 +1311,7 @@ int32 USetupBatchEnemyCommandlet::ImportAnimations(
 	return SuccessCount;
 }
 
-void USetupBatchEnemyCommandlet::CreateMontages(
+bool USetupBatchEnemyCommandlet::CreateMontages(
 	const FString& DestDir, const FString& AnimDir, const FString& PascalName,
 	const TMap<FString, FString>& AnimCategoryMap)
 {
@@ -1147,6 +1330,7 @@ void USetupBatchEnemyCommandlet::CreateMontages(
 
 	FString Result;
 	int32 MontageCount = 0;
+	int32 FailedCount = 0;
 
 	// Attack montages (up to 8)
 	auto CreateCategoryMontages = [&](const FString& Category, const FString& MontagePrefix, int32 MaxCount)
@@ -1166,6 +1350,7 @@ void USetupBatchEnemyCommandlet::CreateMontages(
 			Result = USLFAutomationLibrary::CreateMontageFromSequence(AnimPath, MontagePath, TEXT("DefaultSlot"));
 			UE_LOG(LogTemp, Warning, TEXT("  %s → %s: %s"), *(*Anims)[i], *MontageName,
 				Result.Contains(TEXT("OK")) || Result.Contains(TEXT("Created")) ? TEXT("OK") : *Result);
+			if (Result.Contains(TEXT("ERROR"))) FailedCount++;
 			MontageCount++;
 		}
 	};
@@ -1205,6 +1390,7 @@ void USetupBatchEnemyCommandlet::CreateMontages(
 				Result = USLFAutomationLibrary::CreateMontageFromSequence(WalkPath, WalkMontagePath, TEXT("DefaultSlot"));
 				UE_LOG(LogTemp, Warning, TEXT("  %s → AM_%s_Walk: %s"), *WalkAnim, *PascalName,
 					Result.Contains(TEXT("OK")) || Result.Contains(TEXT("Created")) ? TEXT("OK") : *Result);
+				if (Result.Contains(TEXT("ERROR"))) FailedCount++;
 				MontageCount++;
 			}
 			if (!RunAnim.IsEmpty())
@@ -1214,15 +1400,17 @@ void USetupBatchEnemyCommandlet::CreateMontages(
 				Result = USLFAutomationLibrary::CreateMontageFromSequence(RunPath, RunMontagePath, TEXT("DefaultSlot"));
 				UE_LOG(LogTemp, Warning, TEXT("  %s → AM_%s_Run: %s"), *RunAnim, *PascalName,
 					Result.Contains(TEXT("OK")) || Result.Contains(TEXT("Created")) ? TEXT("OK") : *Result);
+				if (Result.Contains(TEXT("ERROR"))) FailedCount++;
 				MontageCount++;
 			}
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("  Created %d montages total"), MontageCount);
+	UE_LOG(LogTemp, Warning, TEXT("  Created %d montages total (%d failed)"), MontageCount - FailedCount, FailedCount);
+	return FailedCount == 0;
 }
 
-void USetupBatchEnemyCommandlet::CreateBlendSpace(
+bool USetupBatchEnemyCommandlet::CreateBlendSpace(
 	const FString& DestDir, const FString& AnimDir, const FString& PascalName, const FString& SkeletonPath)
 {
 	// Find idle, walk, run animations
@@ -1251,7 +1439,7 @@ void USetupBatchEnemyCommandlet::CreateBlendSpace(
 	if (IdleName.IsEmpty() || WalkName.IsEmpty())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("  Cannot create blend space: missing Idle or Walk anim"));
-		return;
+		return false;
 	}
 	if (RunName.IsEmpty()) RunName = WalkName; // Fallback
 
@@ -1264,14 +1452,16 @@ void USetupBatchEnemyCommandlet::CreateBlendSpace(
 		AnimDir / RunName
 	);
 	UE_LOG(LogTemp, Warning, TEXT("  %s"), *Result);
+	return !Result.Contains(TEXT("ERROR"));
 }
 
-void USetupBatchEnemyCommandlet::CreateAnimBP(
+bool USetupBatchEnemyCommandlet::CreateAnimBP(
 	const FString& DestDir, const FString& AnimDir, const FString& PascalName, const FString& SkeletonPath)
 {
 	FString ABPName = FString::Printf(TEXT("ABP_%s"), *PascalName);
 	FString ABPPath = DestDir / ABPName;
 	FString Result;
+	bool bOk = true;
 
 	// Duplicate from base SoulslikeEnemy ABP
 	Result = USLFAutomationLibrary::DuplicateAnimBPForSkeleton(
@@ -1280,6 +1470,7 @@ void USetupBatchEnemyCommandlet::CreateAnimBP(
 		ABPPath
 	);
 	UE_LOG(LogTemp, Warning, TEXT("  Duplicate: %s"), *Result);
+	bOk &= !Result.Contains(TEXT("ERROR"));
 
 	// Replace animation references
 	{
@@ -1316,17 +1507,22 @@ void USetupBatchEnemyCommandlet::CreateAnimBP(
 
 		Result = USLFAutomationLibrary::ReplaceAnimReferencesInAnimBP(ABPPath, AnimReplacementMap);
 		UE_LOG(LogTemp, Warning, TEXT("  Replace refs: %s"), *Result);
+		bOk &= !Result.Contains(TEXT("ERROR"));
 	}
 
 	// Remove Control Rig + IK Rig nodes
 	Result = USLFAutomationLibrary::DisableControlRigInAnimBP(ABPPath);
 	UE_LOG(LogTemp, Warning, TEXT("  Disable ControlRig: %s"), *Result);
+	bOk &= !Result.Contains(TEXT("ERROR"));
+
+	return bOk;
 }
 
-void USetupBatchEnemyCommandlet::CreateDataAssets(
+bool USetupBatchEnemyCommandlet::CreateDataAssets(
 	const FString& DestDir, const FString& AnimDir, const FString& PascalName, const FString& EnemySnakeName)
 {
 	FString Result;
+	bool bAllSaved = true;
 
 	// Check for animation_config.json
 	FString ConfigPath = FString(SourceBaseDir) / EnemySnakeName / TEXT("animation_config.json");
@@ -1366,7 +1562,7 @@ void USetupBatchEnemyCommandlet::CreateDataAssets(
 			AnimData->Idle = LoadObject<UAnimSequenceBase>(nullptr, *(AnimDir / (*IdleAnims)[0]));
 		}
 
-		SaveAsset(AnimData, Pkg);
+		bAllSaved &= SaveAsset(AnimData, Pkg);
 		UE_LOG(LogTemp, Warning, TEXT("  PDA_%s_AnimData: SAVED"), *PascalName);
 	}
 
@@ -1397,7 +1593,7 @@ void USetupBatchEnemyCommandlet::CreateDataAssets(
 		}
 		WA->Guard_R_Hit = LoadObject<UAnimMontage>(nullptr, *GuardHitPath);
 
-		SaveAsset(WA, Pkg);
+		bAllSaved &= SaveAsset(WA, Pkg);
 		UE_LOG(LogTemp, Warning, TEXT("  PDA_%s_WeaponAnimset: SAVED"), *PascalName);
 	}
 
@@ -1432,7 +1628,7 @@ void USetupBatchEnemyCommandlet::CreateDataAssets(
 			}
 		}
 
-		SaveAsset(Rx, Pkg);
+		bAllSaved &= SaveAsset(Rx, Pkg);
 		UE_LOG(LogTemp, Warning, TEXT("  PDA_%s_CombatReaction: SAVED"), *PascalName);
 	}
 
@@ -1449,7 +1645,7 @@ void USetupBatchEnemyCommandlet::CreateDataAssets(
 		if (PBAnims && PBAnims->Num() >= 2)
 			PB->PoiseBreak_Loop = LoadObject<UAnimSequence>(nullptr, *(AnimDir / (*PBAnims)[1]));
 
-		SaveAsset(PB, Pkg);
+		bAllSaved &= SaveAsset(PB, Pkg);
 		UE_LOG(LogTemp, Warning, TEXT("  PDA_%s_PoiseBreak: SAVED"), *PascalName);
 	}
 
@@ -1457,11 +1653,18 @@ void USetupBatchEnemyCommandlet::CreateDataAssets(
 	if (bHasConfig)
 	{
 		// Config-driven: create exactly the number of DAs matching the config
-		FString ConfigJson;
-		FFileHelper::LoadFileToString(ConfigJson, *ConfigPath);
 		TSharedPtr<FJsonObject> Config;
-		TSharedRef<TJsonReader<>> CfgReader = TJsonReaderFactory<>::Create(ConfigJson);
-		FJsonSerializer::Deserialize(CfgReader, Config);
+		if (CurrentScan && CurrentScan->EnemyName == EnemySnakeName)
+		{
+			Config = CurrentScan->AnimationConfig;
+		}
+		else
+		{
+			FString ConfigJson;
+			FFileHelper::LoadFileToString(ConfigJson, *ConfigPath);
+			TSharedRef<TJsonReader<>> CfgReader = TJsonReaderFactory<>::Create(ConfigJson);
+			FJsonSerializer::Deserialize(CfgReader, Config);
+		}
 
 		if (Config.IsValid())
 		{
@@ -1479,7 +1682,7 @@ void USetupBatchEnemyCommandlet::CreateDataAssets(
 					Ability->Montage = LoadObject<UAnimMontage>(nullptr, *(DestDir / MontageName));
 					Ability->Score = 1.0;
 					Ability->Cooldown = 2.0;
-					SaveAsset(Ability, Pkg);
+					bAllSaved &= SaveAsset(Ability, Pkg);
 					UE_LOG(LogTemp, Warning, TEXT("  %s: SAVED"), *DAName);
 				}
 			}
@@ -1501,7 +1704,7 @@ void USetupBatchEnemyCommandlet::CreateDataAssets(
 					Ability->Montage = LoadObject<UAnimMontage>(nullptr, *(DestDir / MontageName));
 					Ability->Score = 0.5;
 					Ability->Cooldown = 5.0;
-					SaveAsset(Ability, Pkg);
+					bAllSaved &= SaveAsset(Ability, Pkg);
 					UE_LOG(LogTemp, Warning, TEXT("  %s: SAVED"), *DAName);
 				}
 			}
@@ -1525,7 +1728,7 @@ void USetupBatchEnemyCommandlet::CreateDataAssets(
 			Ability->Montage = LoadObject<UAnimMontage>(nullptr, *(DestDir / MontageName));
 			Ability->Score = 1.0;
 			Ability->Cooldown = 2.0;
-			SaveAsset(Ability, Pkg);
+			bAllSaved &= SaveAsset(Ability, Pkg);
 			UE_LOG(LogTemp, Warning, TEXT("  %s: SAVED"), *DAName);
 		}
 
@@ -1544,14 +1747,16 @@ void USetupBatchEnemyCommandlet::CreateDataAssets(
 				Ability->Montage = LoadObject<UAnimMontage>(nullptr, *(DestDir / MontageName));
 				Ability->Score = 0.5;
 				Ability->Cooldown = 5.0;
-				SaveAsset(Ability, Pkg);
+				bAllSaved &= SaveAsset(Ability, Pkg);
 				UE_LOG(LogTemp, Warning, TEXT("  %s: SAVED"), *DAName);
 			}
 		}
 	}
+
+	return bAllSaved;
 }
 
-void USetupBatchEnemyCommandlet::AddSockets(const FString& SkeletonPath)
+bool USetupBatchEnemyCommandlet::AddSockets(const FString& SkeletonPath)
 {
 	struct FSocketDef { const TCHAR* Name; const TCHAR* Bone; FVector Offset; };
 	const FSocketDef Sockets[] = {
@@ -1563,23 +1768,33 @@ void USetupBatchEnemyCommandlet::AddSockets(const FString& SkeletonPath)
 		{ TEXT("foot_r"),       TEXT("foot_r"),   FVector::ZeroVector },
 	};
 
+	bool bOk = true;
 	for (const auto& S : Sockets)
 	{
 		FString Result = USLFAutomationLibrary::AddSocketToSkeleton(SkeletonPath, S.Name, S.Bone, S.Offset);
 		UE_LOG(LogTemp, Warning, TEXT("  %s"), *Result);
+		bOk &= !Result.Contains(TEXT("ERROR"));
 	}
 
 	// Save skeleton
 	USkeleton* Skel = LoadObject<USkeleton>(nullptr, *SkeletonPath);
-	if (Skel)
+	if (!Skel)
 	{
-		UPackage* Pkg = Skel->GetOutermost();
-		Pkg->MarkPackageDirty();
-		FString Fn = FPackageName::LongPackageNameToFilename(Pkg->GetName(), FPackageName::GetAssetPackageExtension());
-		FSavePackageArgs SA;
-		SA.TopLevelFlags = RF_Standalone;
-		UPackage::SavePackage(Pkg, Skel, *Fn, SA);
+		UE_LOG(LogTemp, Error, TEXT("  Skeleton not found for socket save: %s"), *SkeletonPath);
+		return false;
+	}
+
+	UPackage* Pkg = Skel->GetOutermost();
+	Pkg->MarkPackageDirty();
+	FString Fn = FPackageName::LongPackageNameToFilename(Pkg->GetName(), FPackageName::GetAssetPackageExtension());
+	FSavePackageArgs SA;
+	SA.TopLevelFlags = RF_Standalone;
+	if (!UPackage::SavePackage(Pkg, Skel, *Fn, SA))
+	{
+		UE_LOG(LogTemp, Error, TEXT("  Failed to save skeleton sockets: %s"), *SkeletonPath);
+		bOk = false;
 	}
+	return bOk;
 }
 
 void USetupBatchEnemyCommandlet::AddWeaponTraces(const FString& DestDir, const FString& PascalName, const FString& EnemySnakeName)
@@ -1677,17 +1892,27 @@ bool USetupBatchEnemyCommandlet::AddWeaponTracesFromTAE(const FString& DestDir,
 		return false;
 	}
 
-	// Read and parse JSON
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *JsonPath))
+	// Use the JSON parsed during the source scan; read it here only when called outside Main's loop
+	const bool bScanned = CurrentScan && CurrentScan->EnemyName == EnemySnakeName;
+	TSharedPtr<FJsonObject> RootObject;
+	if (bScanned)
 	{
-		UE_LOG(LogTemp, Error, TEXT("  Failed to read TAE JSON: %s"), *JsonPath);
-		return false;
+		RootObject = CurrentScan->TaeHitboxes;
 	}
+	else
+	{
+		FString JsonString;
+		if (!FFileHelper::LoadFileToString(JsonString, *JsonPath))
+		{
+			UE_LOG(LogTemp, Error, TEXT("  Failed to read TAE JSON: %s"), *JsonPath);
+			return false;
+		}
 
-	TSharedPtr<FJsonObject> RootObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-	if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+		FJsonSerializer::Deserialize(Reader, RootObject);
+	}
+
+	if (!RootObject.IsValid())
 	{
 		UE_LOG(LogTemp, Error, TEXT("  Failed to parse TAE JSON: %s"), *JsonPath);
 		return false;
@@ -1706,35 +1931,44 @@ bool USetupBatchEnemyCommandlet::AddWeaponTracesFromTAE(const FString& DestDir,
 	TMap<int32, FString> AttackSlotToAnimId;   // Attack index (1-8) -> anim_id
 	TMap<int32, FString> HeavySlotToAnimId;    // Heavy index (1-2) -> anim_id
 	{
-		FString ConfigPath = FString(SourceBaseDir) / EnemySnakeName / TEXT("animation_config.json");
-		FString ConfigStr;
-		if (FFileHelper::LoadFileToString(ConfigStr, *ConfigPath))
+		TSharedPtr<FJsonObject> Config;
+		if (bScanned)
 		{
-			TSharedPtr<FJsonObject> Config;
-			TSharedRef<TJsonReader<>> CfgReader = TJsonReaderFactory<>::Create(ConfigStr);
-			if (FJsonSerializer::Deserialize(CfgReader, Config) && Config.IsValid())
+			Config = CurrentScan->AnimationConfig;
+		}
+		else
+		{
+			FString ConfigPath = FString(SourceBaseDir) / EnemySnakeName / TEXT("animation_config.json");
+			FString ConfigStr;
+			if (FFileHelper::LoadFileToString(ConfigStr, *ConfigPath))
+			{
+				TSharedRef<TJsonReader<>> CfgReader = TJsonReaderFactory<>::Create(ConfigStr);
+				FJsonSerializer::Deserialize(CfgReader, Config);
+			}
+		}
+
+		if (Config.IsValid())
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Attacks;
+			if (Config->TryGetArrayField(TEXT("attacks"), Attacks))
 			{
-				const TArray<TSharedPtr<FJsonValue>>* Attacks;
-				if (Config->TryGetArrayField(TEXT("attacks"), Attacks))
+				for (int32 idx = 0; idx < Attacks->Num(); idx++)
 				{
-					for (int32 idx = 0; idx < Attacks->Num(); idx++)
-					{
-						FString Aid = (*Attacks)[idx]->AsObject()->GetStringField(TEXT("anim_id"));
-						AttackSlotToAnimId.Add(idx + 1, Aid);
-					}
+					FString Aid = (*Attacks)[idx]->AsObject()->GetStringField(TEXT("anim_id"));
+					AttackSlotToAnimId.Add(idx + 1, Aid);
 				}
-				const TArray<TSharedPtr<FJsonValue>>* Heavies;
-				if (Config->TryGetArrayField(TEXT("heavy_attacks"), Heavies))
+			}
+			const TArray<TSharedPtr<FJsonValue>>* Heavies;
+			if (Config->TryGetArrayField(TEXT("heavy_attacks"), Heavies))
+			{
+				for (int32 idx = 0; idx < Heavies->Num(); idx++)
 				{
-					for (int32 idx = 0; idx < Heavies->Num(); idx++)
-					{
-						FString Aid = (*Heavies)[idx]->AsObject()->GetStringField(TEXT("anim_id"));
-						HeavySlotToAnimId.Add(idx + 1, Aid);
-					}
+					FString Aid = (*Heavies)[idx]->AsObject()->GetStringField(TEXT("anim_id"));
+					HeavySlotToAnimId.Add(idx + 1, Aid);
 				}
-				UE_LOG(LogTemp, Warning, TEXT("  Config mapping: %d attacks, %d heavies"),
-					AttackSlotToAnimId.Num(), HeavySlotToAnimId.Num());
 			}
+			UE_LOG(LogTemp, Warning, TEXT("  Config mapping: %d attacks, %d heavies"),
+				AttackSlotToAnimId.Num(), HeavySlotToAnimId.Num());
 		}
 	}
 
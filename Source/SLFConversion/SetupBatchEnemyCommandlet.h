@@ -1,6 +1,7 @@
 // SetupBatchEnemyCommandlet.h
 // Generic commandlet for importing any Ashborne enemy from the Meshy AI + Blender pipeline.
-// Usage: -run=SetupBatchEnemy -name=withered_wanderer [-skipmesh] [-skipanims]
+// Usage: -run=SetupBatchEnemy -name=withered_wanderer [-skipmesh] [-skipanims] [-force]
+// Steps whose inputs are unchanged since the last run are skipped (see SLFEnemyImportManifest.h).
 
 #pragma once
 
@@ -8,6 +9,8 @@
 #include "Commandlets/Commandlet.h"
 #include "SetupBatchEnemyCommandlet.generated.h"
 
+struct FSLFEnemySourceScan;
+
 UCLASS()
 class USetupBatchEnemyCommandlet : public UCommandlet
 {
@@ -27,27 +30,28 @@ private:
 	// Import mesh from FBX via UAssetImportTask
 	bool ImportMesh(const FString& FBXPath, const FString& DestDir, const FString& DestName);
 
-	// Import PBR textures and create material
+	// Import PBR textures and create material. False if any texture, the material or the mesh failed to import or save.
 	bool ImportTexturesAndCreateMaterial(const FString& EnemyDir, const FString& DestDir, const FString& PascalName);
 
-	// Import all animations from fbx/ directory
-	int32 ImportAnimations(const FString& FBXDir, const FString& DestAnimDir, const FString& PascalName, USkeleton* Skeleton);
+	// Import all animations from fbx/ directory. Returns the number imported; OutFailedCount counts the FBXs that failed.
+	int32 ImportAnimations(const FString& FBXDir, const FString& DestAnimDir, const FString& PascalName, USkeleton* Skeleton,
+		int32* OutFailedCount = nullptr);
 
-	// Create montages from imported animation sequences
-	void CreateMontages(const FString& DestDir, const FString& AnimDir, const FString& PascalName,
+	// Create montages from imported animation sequences. False if any montage could not be created.
+	bool CreateMontages(const FString& DestDir, const FString& AnimDir, const FString& PascalName,
 		const TMap<FString, FString>& AnimCategoryMap);
 
-	// Create blend space from locomotion animations
-	void CreateBlendSpace(const FString& DestDir, const FString& AnimDir, const FString& PascalName, const FString& SkeletonPath);
+	// Create blend space from locomotion animations. False if it could not be created.
+	bool CreateBlendSpace(const FString& DestDir, const FString& AnimDir, const FString& PascalName, const FString& SkeletonPath);
 
-	// Create AnimBP by duplicating and retargeting
-	void CreateAnimBP(const FString& DestDir, const FString& AnimDir, const FString& PascalName, const FString& SkeletonPath);
+	// Create AnimBP by duplicating and retargeting. False if any stage reported an error.
+	bool CreateAnimBP(const FString& DestDir, const FString& AnimDir, const FString& PascalName, const FString& SkeletonPath);
 
-	// Create data assets (AnimData, WeaponAnimset, CombatReaction, PoiseBreak, AI Abilities)
-	void CreateDataAssets(const FString& DestDir, const FString& AnimDir, const FString& PascalName, const FString& EnemySnakeName);
+	// Create data assets (AnimData, WeaponAnimset, CombatReaction, PoiseBreak, AI Abilities). False if any failed to save.
+	bool CreateDataAssets(const FString& DestDir, const FString& AnimDir, const FString& PascalName, const FString& EnemySnakeName);
 
-	// Add sockets to skeleton
-	void AddSockets(const FString& SkeletonPath);
+	// Add sockets to skeleton. False if a socket could not be added or the skeleton failed to save.
+	bool AddSockets(const FString& SkeletonPath);
 
 	// Add weapon traces to attack montages (tries TAE JSON first, falls back to heuristic)
 	void AddWeaponTraces(const FString& DestDir, const FString& PascalName, const FString& EnemySnakeName);
@@ -61,6 +65,9 @@ private:
 	// Helper: prepare package (clear existing)
 	static UPackage* PreparePackage(const FString& PkgName, const FString& ObjName);
 
+	// Pre-scanned sources of the enemy being processed (parsed JSON, hashes)
+	const FSLFEnemySourceScan* CurrentScan = nullptr;
+
 	// Source FBX directory
 	static constexpr const TCHAR* SourceBaseDir = TEXT("C:/scripts/elden_ring_tools/test_meshes");
 };
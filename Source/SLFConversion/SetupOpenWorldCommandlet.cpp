@@ -78,6 +78,9 @@
 #include "Dungeon/SLFCaveRandomTransform.h"
 #include "Dungeon/SLFCaveSpawnLogic.h"
 #include "Dungeon/SLFCaveMazeBuilder.h"
+#include "OpenWorld/SLFHeightmapGenerator.h"
+#include "OpenWorld/SLFPoissonScatter.h"
+#include "OpenWorld/SLFScatterBatch.h"
 
 // Collision
 #include "PhysicsEngine/BodySetup.h"
@@ -467,46 +470,18 @@ int32 USetupOpenWorldCommandlet::Main(const FString& Params)
 
 TArray<uint16> USetupOpenWorldCommandlet::GenerateHeightmap(int32 SizeX, int32 SizeY)
 {
-	TArray<uint16> Heightmap;
-	Heightmap.SetNum(SizeX * SizeY);
-
-	const uint16 MidHeight = 32768; // Sea level
-
-	// Perlin-like noise via layered sine waves (deterministic, no external deps)
-	FRandomStream Rng(42); // Fixed seed for reproducibility
-
-	for (int32 Y = 0; Y < SizeY; Y++)
-	{
-		for (int32 X = 0; X < SizeX; X++)
-		{
-			float FX = (float)X;
-			float FY = (float)Y;
-
-			// Layer 1: Base rolling hills (low frequency, high amplitude)
-			float H = FMath::Sin(FX * 0.002f) * FMath::Cos(FY * 0.0025f) * 8000.0f;
-
-			// Layer 2: Medium terrain features
-			H += FMath::Sin(FX * 0.008f + 1.3f) * FMath::Sin(FY * 0.006f + 0.7f) * 2500.0f;
-
-			// Layer 3: Fine detail (small bumps)
-			H += FMath::Sin(FX * 0.025f + 3.1f) * FMath::Cos(FY * 0.03f + 2.2f) * 800.0f;
-
-			// Layer 4: Asymmetric ridge running NW-SE
-			float Ridge = FMath::Sin((FX + FY) * 0.003f) * 3000.0f;
-			H += Ridge * FMath::Max(0.0f, FMath::Sin(FY * 0.004f));
-
-			// Clamp to uint16 range
-			int32 HeightVal = FMath::Clamp((int32)(MidHeight + H), 0, 65535);
-			Heightmap[Y * SizeX + X] = (uint16)HeightVal;
-		}
-	}
+	// Perlin-like noise via layered sine waves (deterministic, no external deps).
+	// Table-driven and row-parallel; identical output to evaluating the layers per pixel.
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<uint16> Heightmap = FSLFHeightmapGenerator::MakeOpenWorldTerrain().Generate(SizeX, SizeY);
 
+	UE_LOG(LogTemp, Warning, TEXT("  Heightmap %dx%d generated in %.1f ms"), SizeX, SizeY, (FPlatformTime::Seconds() - StartTime) * 1000.0);
 	return Heightmap;
 }
 
 void USetupOpenWorldCommandlet::CarveFlats()
 {
-	// Define gameplay areas — all at ground level (Z=0)
+	// Define gameplay areas — ground level is resolved from the terrain height field below
 	FlatAreas.Empty();
 
 	// Player spawn area — near first dungeon entrance for easy testing
@@ -528,7 +503,12 @@ void USetupOpenWorldCommandlet::CarveFlats()
 	FlatAreas.Add({FVector(5000, -3000, 0), 3000.0f, TEXT("patrol_1")});
 	FlatAreas.Add({FVector(-6000, 7000, 0), 3000.0f, TEXT("patrol_2")});
 
-	UE_LOG(LogTemp, Warning, TEXT("  Defined %d gameplay areas (all at Z=0)"), FlatAreas.Num());
+	for (FlatArea& Area : FlatAreas)
+	{
+		Area.Center.Z = SampleTerrainHeight(nullptr, Area.Center.X, Area.Center.Y);
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("  Defined %d gameplay areas (snapped to terrain)"), FlatAreas.Num());
 }
 
 bool USetupOpenWorldCommandlet::CreateLandscape(UWorld* World)
@@ -562,9 +542,6 @@ bool USetupOpenWorldCommandlet::CreateLandscape(UWorld* World)
 		UE_LOG(LogTemp, Warning, TEXT("  No ground material found — tiles will use default"));
 	}
 
-	// Populate flat areas (all at Z=0 ground level)
-	CarveFlats();
-
 	// Create terrain grid: 10x10 tiles, each 5000x5000 cm = 50000x50000 cm total
 	// All tiles at Z=0 (flat ground) — Cube is 100x100x100, scale XY to tile size
 	const int32 GridSize = 10;
@@ -573,6 +550,13 @@ bool USetupOpenWorldCommandlet::CreateLandscape(UWorld* World)
 	const float HalfTotal = TotalSize / 2.0f;
 	const float TileScale = TileSize / 100.0f; // Cube is 100x100x100 by default
 
+	// Placement samples the surface the tiles form. A landscape imported from
+	// GenerateHeightmap would hand its heightmap to TerrainHeightField.Initialize instead.
+	TerrainHeightField.InitializeFlat(FVector2D(-HalfTotal, -HalfTotal), FVector2D(HalfTotal, HalfTotal), 0.0f);
+
+	// Populate flat areas (snapped to the terrain surface)
+	CarveFlats();
+
 	int32 TilesCreated = 0;
 
 	for (int32 GY = 0; GY < GridSize; GY++)
@@ -678,7 +662,7 @@ UStaticMesh* USetupOpenWorldCommandlet::FindWastelandMesh(const FString& Categor
 
 void USetupOpenWorldCommandlet::ScatterCategory(UWorld* World, const TArray<FString>& MeshPaths, const FString& CategoryName,
 	int32 Count, FVector RegionMin, FVector RegionMax, float MinSpacing, float ScaleMin, float ScaleMax,
-	bool bMirrorBackface)
+	bool bMirrorBackface, bool bAvoidFlatAreas)
 {
 	TArray<FString> Paths = MeshPaths;
 	if (Paths.Num() == 0)
@@ -687,33 +671,41 @@ void USetupOpenWorldCommandlet::ScatterCategory(UWorld* World, const TArray<FStr
 		Paths.Add(TEXT("/Engine/BasicShapes/Cube.Cube"));
 	}
 
-	FRandomStream Rng(FCrc::StrCrc32(*CategoryName)); // Deterministic per category
-	TArray<FVector> PlacedLocations;
-	int32 Placed = 0;
-	int32 MaxAttempts = Count * 5;
+	const uint32 Seed = FCrc::StrCrc32(*CategoryName); // Deterministic per category
+	FRandomStream Rng(Seed);
 
-	for (int32 Attempt = 0; Attempt < MaxAttempts && Placed < Count; Attempt++)
+	// Poisson-disk positions first (grid-accelerated, tiled across worker threads),
+	// then per-instance rotation / scale / mesh from the category stream
+	FSLFPoissonScatterParams ScatterParams;
+	ScatterParams.RegionMin = FVector2D(RegionMin);
+	ScatterParams.RegionMax = FVector2D(RegionMax);
+	ScatterParams.MinSpacing = MinSpacing;
+	ScatterParams.MaxPoints = Count;
+	ScatterParams.Seed = Seed;
+	ScatterParams.TileSize = MinSpacing * 16.0f;
+	if (bAvoidFlatAreas)
 	{
-		FVector Location;
-		Location.X = Rng.FRandRange(RegionMin.X, RegionMax.X);
-		Location.Y = Rng.FRandRange(RegionMin.Y, RegionMax.Y);
-		Location.Z = 0; // Will be adjusted by terrain height
-
-		// Check min spacing against already-placed meshes
-		bool bTooClose = false;
-		for (const FVector& Existing : PlacedLocations)
+		for (const FlatArea& Area : FlatAreas)
 		{
-			if (FVector::Dist2D(Location, Existing) < MinSpacing)
-			{
-				bTooClose = true;
-				break;
-			}
+			ScatterParams.Exclusions.Add({FVector2D(Area.Center), Area.Radius});
 		}
-		if (bTooClose) continue;
+	}
+
+	FSLFPoissonScatterStats ScatterStats;
+	const TArray<FVector2D> Points = FSLFPoissonScatter::Generate(ScatterParams, &ScatterStats);
+	int32 Placed = 0;
+
+	// One actor per category with a HISM per mesh; mirrored copies are a second instance
+	FSLFScatterBatch Batch;
 
-		// Get terrain height at this location
-		float TerrainZ = SampleTerrainHeight(World, Location.X, Location.Y);
-		Location.Z = TerrainZ;
+	// Terrain heights for every placement in one batched query
+	TArray<float> TerrainZ;
+	TerrainZ.SetNumUninitialized(Points.Num());
+	TerrainHeightField.GetHeights(Points, TerrainZ);
+
+	for (int32 PointIndex = 0; PointIndex < Points.Num(); ++PointIndex)
+	{
+		const FVector Location(Points[PointIndex].X, Points[PointIndex].Y, TerrainZ[PointIndex]);
 
 		// Random rotation (yaw only) and scale variation
 		FRotator Rotation(0, Rng.FRandRange(0.0f, 360.0f), 0);
@@ -721,48 +713,48 @@ void USetupOpenWorldCommandlet::ScatterCategory(UWorld* World, const TArray<FStr
 
 		// Pick a random mesh from the category
 		int32 MeshIndex = Rng.RandRange(0, Paths.Num() - 1);
-		UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *Paths[MeshIndex]);
+		UStaticMesh* Mesh = ResolveWastelandMesh(Paths[MeshIndex]);
 		if (!Mesh) continue;
 
-		// Spawn static mesh actor
-		AStaticMeshActor* MeshActor = World->SpawnActor<AStaticMeshActor>(Location, Rotation);
-		if (MeshActor)
-		{
-			MeshActor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
-			MeshActor->SetActorScale3D(FVector(Scale));
-			MeshActor->SetFolderPath(FName(*FString::Printf(TEXT("Wasteland/%s"), *CategoryName)));
-			PlacedLocations.Add(Location);
-			Placed++;
-
-			// Mirror copy: spawn a 180° yaw-rotated duplicate at same location
-			// to fill in single-sided backfaces on cliff/wall rock meshes
-			if (bMirrorBackface)
-			{
-				FRotator MirrorRot = Rotation;
-				MirrorRot.Yaw += 180.0f;
-				AStaticMeshActor* Mirror = World->SpawnActor<AStaticMeshActor>(Location, MirrorRot);
-				if (Mirror)
-				{
-					Mirror->GetStaticMeshComponent()->SetStaticMesh(Mesh);
-					Mirror->SetActorScale3D(FVector(Scale));
-					Mirror->SetFolderPath(FName(*FString::Printf(TEXT("Wasteland/%s_Mirror"), *CategoryName)));
-				}
-			}
-		}
+		// Mirror copy: a 180° yaw-rotated instance at the same location
+		// fills in single-sided backfaces on cliff/wall rock meshes
+		Batch.Add(Mesh, FTransform(Rotation, Location, FVector(Scale)), bMirrorBackface);
+		Placed++;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("  Scattered %d/%d meshes for %s (%d mesh variants)"), Placed, Count, *CategoryName, Paths.Num());
+	FSLFScatterBatchStats BatchStats;
+	Batch.Flush(World, FString::Printf(TEXT("Scatter_%s"), *CategoryName),
+		FName(*FString::Printf(TEXT("Wasteland/%s"), *CategoryName)), &BatchStats);
+	ScatterTotals.Accumulate(BatchStats);
+
+	UE_LOG(LogTemp, Warning, TEXT("  Scattered %d/%d meshes for %s (%d mesh variants, %d Poisson candidates, %.2f ms)"),
+		Placed, Count, *CategoryName, Paths.Num(), ScatterStats.Generated, ScatterStats.Seconds * 1000.0);
+	UE_LOG(LogTemp, Warning, TEXT("    %d instances in %d HISM components (was %d actors, ~%d -> %d draw calls)"),
+		BatchStats.Instances, BatchStats.Components, BatchStats.LegacyActors, BatchStats.LegacyDrawCalls, BatchStats.DrawCalls);
 }
 
-float USetupOpenWorldCommandlet::SampleTerrainHeight(UWorld* /*World*/, float /*X*/, float /*Y*/)
+UStaticMesh* USetupOpenWorldCommandlet::ResolveWastelandMesh(const FString& MeshPath)
 {
-	// Flat terrain at Z=0. Visual height variation comes from Wasteland meshes.
-	// A real landscape with proper collision can be substituted in-editor later.
-	return 0.0f;
+	if (const TObjectPtr<UStaticMesh>* Cached = WastelandMeshCache.Find(MeshPath))
+	{
+		return *Cached;
+	}
+
+	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	WastelandMeshCache.Add(MeshPath, Mesh);
+	return Mesh;
+}
+
+float USetupOpenWorldCommandlet::SampleTerrainHeight(UWorld* /*World*/, float X, float Y)
+{
+	// Bilinear lookup in the in-memory height field; Z=0 before CreateLandscape has run
+	return TerrainHeightField.IsValid() ? TerrainHeightField.GetHeight(X, Y) : 0.0f;
 }
 
 bool USetupOpenWorldCommandlet::ScatterWastelandMeshes(UWorld* World)
 {
+	ScatterTotals = FSLFScatterBatchStats();
+
 	// Full map bounds: ~±25200 cm (504 quads * 100 cm / 2)
 	const float MapHalfSize = 25000.0f;
 	const FVector MapMin(-MapHalfSize, -MapHalfSize, 0);
@@ -839,13 +831,14 @@ bool USetupOpenWorldCommandlet::ScatterWastelandMeshes(UWorld* World)
 			FVector ClusterMin = Area.Center - FVector(3000, 3000, 0);
 			FVector ClusterMax = Area.Center + FVector(3000, 3000, 0);
 
-			// Dense rock cluster around entrance (mirrored for solid look)
+			// Dense rock cluster around entrance (mirrored for solid look).
+			// Clusters sit on the entrance flat area by design, so no flat-area exclusion.
 			ScatterCategory(World, RockMeshes, TEXT("DungeonRocks"), 20,
-				ClusterMin, ClusterMax, 200.0f, 0.8f, 1.6f, /*bMirrorBackface=*/ true);
+				ClusterMin, ClusterMax, 200.0f, 0.8f, 1.6f, /*bMirrorBackface=*/ true, /*bAvoidFlatAreas=*/ false);
 
 			// Debris/props around entrance
 			ScatterCategory(World, PropMeshes, TEXT("DungeonProps"), 10,
-				ClusterMin, ClusterMax, 300.0f, 0.6f, 1.0f);
+				ClusterMin, ClusterMax, 300.0f, 0.6f, 1.0f, /*bMirrorBackface=*/ false, /*bAvoidFlatAreas=*/ false);
 
 			// Build visible dungeon entrance structure (rock archway + light)
 			BuildDungeonEntrance(World, Area.Center, DungeonIdx);
@@ -853,6 +846,10 @@ bool USetupOpenWorldCommandlet::ScatterWastelandMeshes(UWorld* World)
 		}
 	}
 
+	UE_LOG(LogTemp, Warning, TEXT("  Scatter output: %d instances, %d HISM components on %d actors (was %d actors); draw calls ~%d -> %d; %d meshes cached"),
+		ScatterTotals.Instances, ScatterTotals.Components, ScatterTotals.Actors, ScatterTotals.LegacyActors,
+		ScatterTotals.LegacyDrawCalls, ScatterTotals.DrawCalls, WastelandMeshCache.Num());
+
 	return true;
 }
 
@@ -1470,7 +1467,8 @@ void USetupOpenWorldCommandlet::BuildCellFlowCave(UWorld* DungeonWorld, FVector
 		if (FPaths::FileExists(LayoutPath))
 		{
 			UE_LOG(LogTemp, Warning, TEXT("  Canvas mode: found layout JSON, building maze walls..."));
-			FSLFCaveMazeBuilder::BuildCaveMaze(DungeonWorld, DungeonIdx);
+			// Instanced walls: a few HISM components instead of one actor per wall in the saved level
+			FSLFCaveMazeBuilder::BuildCaveMaze(DungeonWorld, DungeonIdx, ESLFCaveWallOutput::Instanced);
 		}
 		else
 		{
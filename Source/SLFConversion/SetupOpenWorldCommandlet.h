@@ -9,11 +9,14 @@
 
 #include "CoreMinimal.h"
 #include "Commandlets/Commandlet.h"
+#include "OpenWorld/SLFHeightField.h"
+#include "OpenWorld/SLFScatterBatch.h"
 #include "SetupOpenWorldCommandlet.generated.h"
 
 class ADungeon;
 class UCellFlowAsset;
 class UDungeonThemeAsset;
+class UStaticMesh;
 
 UCLASS()
 class USetupOpenWorldCommandlet : public UCommandlet
@@ -34,7 +37,7 @@ private:
 	bool ScatterWastelandMeshes(UWorld* World);
 	void ScatterCategory(UWorld* World, const TArray<FString>& MeshPaths, const FString& CategoryName,
 		int32 Count, FVector RegionMin, FVector RegionMax, float MinSpacing, float ScaleMin, float ScaleMax,
-		bool bMirrorBackface = false);
+		bool bMirrorBackface = false, bool bAvoidFlatAreas = true);
 	void BuildDungeonEntrance(UWorld* World, FVector Location, int32 DungeonIndex);
 
 	// ── Phase 3: Cave Dungeon Generation (Cell Flow + Voxel Cave) ──
@@ -53,6 +56,7 @@ private:
 	// ── Helpers ──
 	bool SaveLevel(UWorld* World, const FString& PackageName);
 	UStaticMesh* FindWastelandMesh(const FString& NamePrefix, int32 Index);
+	UStaticMesh* ResolveWastelandMesh(const FString& MeshPath);
 	TArray<FString> DiscoverWastelandAssets(const FString& NamePrefixFilter);
 	TArray<FString> DiscoverWastelandByPrefixes(const TArray<FString>& Prefixes);
 	float SampleTerrainHeight(UWorld* World, float X, float Y);
@@ -66,6 +70,16 @@ private:
 	};
 	TArray<FlatArea> FlatAreas;
 
+	// Surface built by CreateLandscape, queried by SampleTerrainHeight (no traces)
+	FSLFHeightField TerrainHeightField;
+
+	// Scatter meshes by path, loaded once per run (failed loads cached as null)
+	UPROPERTY()
+	TMap<FString, TObjectPtr<UStaticMesh>> WastelandMeshCache;
+
+	// Scatter output totals for the current ScatterWastelandMeshes pass
+	FSLFScatterBatchStats ScatterTotals;
+
 	// Cave theme (created once, reused across dungeons)
 	UPROPERTY()
 	TObjectPtr<UDungeonThemeAsset> CachedCaveTheme;
@@ -30,6 +30,10 @@
 #include "EngineUtils.h"
 #include "UnrealClient.h"
 #include "Blueprints/SLFEnemySentinel.h"
+#include "Components/StatManagerComponent.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Containers/Ticker.h"
+#include "Dungeon/SLFProceduralCaveManager.h"
 
 // ========== CONSOLE COMMANDS ==========
 
@@ -105,6 +109,44 @@ static FAutoConsoleCommand CCmdTestNPCDialog(
 	})
 );
 
+static FAutoConsoleCommand CCmdBenchHUD(
+	TEXT("SLF.Bench.HUD"),
+	TEXT("Benchmark HUD Slate cost idle vs combat, invalidation off vs on. Usage: SLF.Bench.HUD [FramesPerPhase]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Frames = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 300;
+		if (UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GetCurrentPlayWorld(), EGetWorldErrorMode::ReturnNull))
+		{
+			if (UGameInstance* GI = World->GetGameInstance())
+			{
+				if (USLFPIETestRunner* Runner = GI->GetSubsystem<USLFPIETestRunner>())
+				{
+					Runner->RunHUDBenchmark(Frames);
+				}
+			}
+		}
+	})
+);
+
+static FAutoConsoleCommand CCmdBenchCaveBuild(
+	TEXT("SLF.Bench.CaveBuild"),
+	TEXT("Build the voxel cave asynchronously and report the worst frame time. Usage: SLF.Bench.CaveBuild [MaxFrameMs]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const float MaxFrameMs = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 50.0f;
+		if (UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GetCurrentPlayWorld(), EGetWorldErrorMode::ReturnNull))
+		{
+			if (UGameInstance* GI = World->GetGameInstance())
+			{
+				if (USLFPIETestRunner* Runner = GI->GetSubsystem<USLFPIETestRunner>())
+				{
+					Runner->RunCaveBuildBenchmark(MaxFrameMs);
+				}
+			}
+		}
+	})
+);
+
 static FAutoConsoleCommand CCmdSimKey(
 	TEXT("SLF.SimKey"),
 	TEXT("Simulate a key press. Usage: SLF.SimKey <KeyName> (e.g., SLF.SimKey SpaceBar)"),
@@ -1200,6 +1242,9 @@ void USLFPIETestRunner::Initialize(FSubsystemCollectionBase& Collection)
 
 void USLFPIETestRunner::Deinitialize()
 {
+	FTSTicker::GetCoreTicker().RemoveTicker(CaveBenchTickerHandle);
+	CaveBenchTickerHandle.Reset();
+
 	Super::Deinitialize();
 }
 
@@ -1725,3 +1770,239 @@ void USLFPIETestRunner::RunNPCDialogTest()
 
 	}, 0.5f, false); // Wait 0.5 seconds for overlap to register
 }
+
+// ========== HUD BENCHMARK ==========
+
+void USLFPIETestRunner::RunHUDBenchmark(int32 FramesPerPhase)
+{
+	UE_LOG(LogTemp, Warning, TEXT("[SLFPIETestRunner] ===== HUD BENCHMARK ====="));
+
+	UWorld* World = GetWorld();
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	ACharacter* PlayerChar = PC ? PC->GetCharacter() : nullptr;
+	if (!PlayerChar || !FSlateApplication::IsInitialized())
+	{
+		LogTestResult(FName("HUDBenchmark"), false, TEXT("No player character or Slate application"));
+		return;
+	}
+
+	TArray<UUserWidget*> HUDWidgets;
+	UWidgetBlueprintLibrary::GetAllWidgetsOfClass(World, HUDWidgets, UW_HUD::StaticClass(), false);
+	UW_HUD* HUD = HUDWidgets.Num() > 0 ? Cast<UW_HUD>(HUDWidgets[0]) : nullptr;
+	if (!HUD)
+	{
+		LogTestResult(FName("HUDBenchmark"), false, TEXT("W_HUD not found"));
+		return;
+	}
+
+	struct FHUDBenchPhase
+	{
+		const TCHAR* Name;
+		bool bInvalidation;
+		bool bCombat;
+	};
+	static const FHUDBenchPhase Phases[] =
+	{
+		{ TEXT("Idle, no invalidation"),   false, false },
+		{ TEXT("Combat, no invalidation"), false, true  },
+		{ TEXT("Idle, invalidation"),      true,  false },
+		{ TEXT("Combat, invalidation"),    true,  true  },
+	};
+
+	struct FHUDBenchState
+	{
+		TWeakObjectPtr<UW_HUD> HUD;
+		TWeakObjectPtr<ACharacter> Player;
+		TWeakObjectPtr<UStatManagerComponent> StatManager;
+		int32 FramesPerPhase = 0;
+		int32 Phase = INDEX_NONE;
+		int32 CombatFrame = 0;
+		uint64 SlateTickStart = 0;
+		TArray<double> SamplesMs;
+		FString Report;
+		FDelegateHandle PreTickHandle;
+		FDelegateHandle PostTickHandle;
+		FTSTicker::FDelegateHandle TickerHandle;
+	};
+
+	TSharedRef<FHUDBenchState> State = MakeShared<FHUDBenchState>();
+	State->HUD = HUD;
+	State->Player = PlayerChar;
+	State->StatManager = PlayerChar->FindComponentByClass<UStatManagerComponent>();
+	State->FramesPerPhase = FMath::Max(FramesPerPhase, 30);
+	State->SamplesMs.Reserve(State->FramesPerPhase);
+
+	// Slate tick = prepass + paint of every window, measured between the application's pre / post tick
+	FSlateApplication& SlateApp = FSlateApplication::Get();
+	State->PreTickHandle = SlateApp.OnPreTick().AddLambda([State](float)
+	{
+		State->SlateTickStart = FPlatformTime::Cycles64();
+	});
+	State->PostTickHandle = SlateApp.OnPostTick().AddLambda([State](float)
+	{
+		if (State->Phase != INDEX_NONE && State->SlateTickStart != 0)
+		{
+			State->SamplesMs.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - State->SlateTickStart));
+		}
+	});
+
+	GEngine->Exec(World, TEXT("stat slate"));
+
+	const FGameplayTag HPTag = FGameplayTag::RequestGameplayTag(FName("SoulslikeFramework.Stat.Secondary.HP"), false);
+	const FGameplayTag StaminaTag = FGameplayTag::RequestGameplayTag(FName("SoulslikeFramework.Stat.Secondary.Stamina"), false);
+
+	// Drives the phases from the core ticker (runs before the Slate tick each frame)
+	State->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this,
+		[this, State, HPTag, StaminaTag](float) -> bool
+	{
+		UW_HUD* BenchHUD = State->HUD.Get();
+		const bool bPhaseDone = State->Phase == INDEX_NONE || State->SamplesMs.Num() >= State->FramesPerPhase;
+
+		if (bPhaseDone && State->Phase != INDEX_NONE)
+		{
+			TArray<double>& Samples = State->SamplesMs;
+			Samples.Sort();
+			double Total = 0.0;
+			for (double Sample : Samples)
+			{
+				Total += Sample;
+			}
+			const double AverageMs = Samples.Num() > 0 ? Total / Samples.Num() : 0.0;
+			const double P95Ms = Samples.Num() > 0 ? Samples[FMath::Min(Samples.Num() - 1, Samples.Num() * 95 / 100)] : 0.0;
+
+			const FString Line = FString::Printf(TEXT("%-24s avg %.3f ms  p95 %.3f ms  (%d frames)"),
+				Phases[State->Phase].Name, AverageMs, P95Ms, Samples.Num());
+			UE_LOG(LogTemp, Warning, TEXT("[SLFPIETestRunner] HUD %s"), *Line);
+			State->Report += Line + TEXT("\n");
+
+			if (Phases[State->Phase].bCombat && BenchHUD)
+			{
+				BenchHUD->EventHideBossBar();
+			}
+		}
+
+		if (bPhaseDone)
+		{
+			const int32 NextPhase = State->Phase + 1;
+			if (NextPhase >= UE_ARRAY_COUNT(Phases) || !BenchHUD)
+			{
+				// Restore settings and stop
+				if (BenchHUD)
+				{
+					const IConsoleVariable* HudInvalidation = IConsoleManager::Get().FindConsoleVariable(TEXT("SLF.HUD.Invalidation"));
+					BenchHUD->SetInvalidationEnabled(!HudInvalidation || HudInvalidation->GetInt() != 0);
+				}
+				if (FSlateApplication::IsInitialized())
+				{
+					FSlateApplication::Get().OnPreTick().Remove(State->PreTickHandle);
+					FSlateApplication::Get().OnPostTick().Remove(State->PostTickHandle);
+				}
+				if (UWorld* BenchWorld = GetWorld())
+				{
+					GEngine->Exec(BenchWorld, TEXT("stat slate"));
+				}
+
+				LogTestResult(FName("HUDBenchmark"), BenchHUD != nullptr, FString::Printf(TEXT("\n%s"), *State->Report));
+				return false;
+			}
+
+			State->Phase = NextPhase;
+			State->CombatFrame = 0;
+			State->SamplesMs.Reset();
+
+			const FHUDBenchPhase& Phase = Phases[NextPhase];
+			BenchHUD->SetInvalidationEnabled(Phase.bInvalidation);
+			if (Phase.bCombat)
+			{
+				// The player doubles as the boss so the bar binds to a live HP stat
+				BenchHUD->EventShowBossBar(FText::FromString(TEXT("Benchmark Boss")), State->Player.Get());
+			}
+			return true;
+		}
+
+		// Combat: HP and stamina change every frame, the way they do mid-fight
+		if (Phases[State->Phase].bCombat)
+		{
+			if (UStatManagerComponent* Stats = State->StatManager.Get())
+			{
+				const double Delta = (State->CombatFrame++ & 1) ? 1.0 : -1.0;
+				if (HPTag.IsValid())
+				{
+					Stats->AdjustStat(HPTag, ESLFValueType::CurrentValue, Delta, false, false);
+				}
+				if (StaminaTag.IsValid())
+				{
+					Stats->AdjustStat(StaminaTag, ESLFValueType::CurrentValue, Delta * 5.0, false, false);
+				}
+			}
+		}
+		return true;
+	}));
+}
+
+void USLFPIETestRunner::RunCaveBuildBenchmark(float MaxFrameMs)
+{
+	UE_LOG(LogTemp, Warning, TEXT("[SLFPIETestRunner] ===== CAVE BUILD BENCHMARK ====="));
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		LogTestResult(FName("CaveBuildBenchmark"), false, TEXT("No world"));
+		return;
+	}
+
+	if (CaveBenchTickerHandle.IsValid())
+	{
+		LogTestResult(FName("CaveBuildBenchmark"), false, TEXT("Benchmark already running"));
+		return;
+	}
+
+	// Deferred so BeginPlay does not schedule its own auto-build
+	AProceduralCaveManager* Manager = World->SpawnActorDeferred<AProceduralCaveManager>(AProceduralCaveManager::StaticClass(),
+		FTransform::Identity, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Manager)
+	{
+		LogTestResult(FName("CaveBuildBenchmark"), false, TEXT("Failed to spawn AProceduralCaveManager"));
+		return;
+	}
+	Manager->bAutoBuildOnPlay = false;
+	Manager->CellFlowAsset = TSoftObjectPtr<UCellFlowAsset>(FSoftObjectPath(TEXT("/Game/Dungeons/CellFlow/CF_UnifiedCave.CF_UnifiedCave")));
+	Manager->FinishSpawning(FTransform::Identity);
+
+	CaveBenchFrameMs.Reset();
+	CaveBenchMaxFrameMs = MaxFrameMs;
+	CaveBenchStartTime = CaveBenchLastFrameTime = FPlatformTime::Seconds();
+
+	// Wall time between core ticks = full frame time, including whatever the build did that frame
+	CaveBenchTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float) -> bool
+	{
+		const double Now = FPlatformTime::Seconds();
+		CaveBenchFrameMs.Add((Now - CaveBenchLastFrameTime) * 1000.0);
+		CaveBenchLastFrameTime = Now;
+		return true;
+	}));
+
+	Manager->OnCaveBuildCompleted.AddDynamic(this, &USLFPIETestRunner::OnCaveBenchmarkBuildCompleted);
+	Manager->BuildCaveDungeonAsync();
+}
+
+void USLFPIETestRunner::OnCaveBenchmarkBuildCompleted(bool bSuccess)
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(CaveBenchTickerHandle);
+	CaveBenchTickerHandle.Reset();
+
+	TArray<double> Sorted = MoveTemp(CaveBenchFrameMs);
+	Sorted.Sort();
+	const int32 Num = Sorted.Num();
+	const double WorstMs = Num > 0 ? Sorted.Last() : 0.0;
+	const double P95Ms = Num > 0 ? Sorted[FMath::Min(Num - 1, Num * 95 / 100)] : 0.0;
+	int32 SlowFrames = 0;
+	for (double Ms : Sorted)
+	{
+		SlowFrames += Ms > 33.3 ? 1 : 0;
+	}
+
+	const FString Report = FString::Printf(TEXT("build %s in %.2f s over %d frames: worst %.1f ms, p95 %.1f ms, %d frames > 33 ms (limit %.1f ms)"),
+		bSuccess ? TEXT("OK") : TEXT("FAILED"), FPlatformTime::Seconds() - CaveBenchStartTime, Num, WorstMs, P95Ms, SlowFrames, CaveBenchMaxFrameMs);
+	LogTestResult(FName("CaveBuildBenchmark"), bSuccess && WorstMs <= CaveBenchMaxFrameMs, Report);
+}
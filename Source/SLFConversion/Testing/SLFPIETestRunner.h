@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
 #include "SLFPIETestRunner.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTestCompleted, FName, TestName, bool, bPassed);
@@ -58,6 +59,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PIE Testing")
 	void RunNPCDialogTest();
 
+	/**
+	 * Run HUD benchmark - average / p95 Slate tick cost with the HUD idle and in simulated combat
+	 * (stat drain + boss bar), once with invalidation disabled and once enabled. Toggles "stat slate".
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PIE Testing")
+	void RunHUDBenchmark(int32 FramesPerPhase = 300);
+
+	/**
+	 * Run cave build benchmark - spawns an AProceduralCaveManager, runs BuildCaveDungeonAsync and
+	 * records frame times until OnCaveBuildCompleted. Passes if the build succeeds and the worst
+	 * frame stays under MaxFrameMs. The build teleports the player to the cave entrance.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PIE Testing")
+	void RunCaveBuildBenchmark(float MaxFrameMs = 50.0f);
+
 	/** Event fired when a test completes */
 	UPROPERTY(BlueprintAssignable, Category = "PIE Testing")
 	FOnTestCompleted OnTestCompleted;
@@ -69,6 +85,16 @@ public:
 private:
 	TMap<FName, bool> TestResults;
 	void LogTestResult(FName TestName, bool bPassed, const FString& Message);
+
+	/** RunCaveBuildBenchmark completion (bound to AProceduralCaveManager::OnCaveBuildCompleted) */
+	UFUNCTION()
+	void OnCaveBenchmarkBuildCompleted(bool bSuccess);
+
+	TArray<double> CaveBenchFrameMs;
+	double CaveBenchStartTime = 0.0;
+	double CaveBenchLastFrameTime = 0.0;
+	float CaveBenchMaxFrameMs = 0.0f;
+	FTSTicker::FDelegateHandle CaveBenchTickerHandle;
 };
 
 /**
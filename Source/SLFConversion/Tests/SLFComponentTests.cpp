@@ -34,6 +34,11 @@
 #include "Components/AICombatManagerComponent.h"
 #include "Components/AIBehaviorManagerComponent.h"
 #include "Components/CollisionManagerComponent.h"
+#include "Components/SLFInventoryStore.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "SLFPrimaryDataAssets.h"
 
 // ============================================================================
 // TEST: Player Component Instantiation
@@ -327,6 +332,22 @@ bool FSLFInventoryManagerFunctionTest::RunTest(const FString& Parameters)
 		AddInfo(TEXT("  - HasItem(): Check if item exists"));
 		AddInfo(TEXT("  - GetItemsByCategory(): Filter by category"));
 
+		// Replenish refills held rechargeables to MaxAmount and never grants missing items
+		UPDA_Item* Flask = NewObject<UPDA_Item>(GetTransientPackage(), TEXT("TestReplenishFlask"));
+		Flask->ItemInformation.bRechargeable = true;
+		Flask->ItemInformation.MaxAmount = 5;
+
+		int32 Amount = 0;
+		bool bFound = false;
+		InventoryManager->ReplenishItem(Flask);
+		InventoryManager->GetAmountOfItem(Flask, Amount, bFound);
+		TestFalse(TEXT("Replenish does not grant an item that is not held"), bFound && Amount > 0);
+
+		InventoryManager->AddItem(Flask, 2, false);
+		InventoryManager->ReplenishItem(Flask);
+		InventoryManager->GetAmountOfItem(Flask, Amount, bFound);
+		TestEqual(TEXT("Replenish refills a held flask to MaxAmount"), Amount, 5);
+
 		AddInfo(TEXT(""));
 		AddInfo(TEXT("[OK] InventoryManager functions available"));
 	}
@@ -337,6 +358,123 @@ bool FSLFInventoryManagerFunctionTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+// ============================================================================
+// TEST: Inventory Store (counts, handles, indexes)
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFInventoryStoreTest, "SLF.Components.InventoryStore",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFInventoryStoreTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Inventory Store"));
+	AddInfo(TEXT("   Stack counts, stable handles, category/equip-slot indexes"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	UPDA_Item* Sword = NewObject<UPDA_Item>(GetTransientPackage(), TEXT("TestStoreSword"));
+	Sword->ItemInformation.Category.Category = ESLFItemCategory::Weapons;
+	Sword->ItemInformation.Category.SubCategory = ESLFItemSubCategory::Sword;
+
+	UPDA_Item* Flask = NewObject<UPDA_Item>(GetTransientPackage(), TEXT("TestStoreFlask"));
+	Flask->ItemInformation.Category.Category = ESLFItemCategory::Tools;
+	Flask->ItemInformation.Category.SubCategory = ESLFItemSubCategory::Flasks;
+	Flask->ItemInformation.MaxAmount = 5;
+
+	FSLFInventoryStore Store;
+	int32 NewCount = 0;
+
+	// Stacking
+	const FSLFInventoryHandle FlaskHandle = Store.Add(Flask, 2, NewCount);
+	Store.Add(Flask, 3, NewCount);
+	TestEqual(TEXT("Flask stacks to 5"), NewCount, 5);
+	TestEqual(TEXT("Flask count by asset"), Store.GetCount(Flask), 5);
+	TestTrue(TEXT("Handle is stable across stacking"), Store.FindByAsset(Flask) == FlaskHandle);
+
+	const FSLFInventoryHandle SwordHandle = Store.Add(Sword, 1, NewCount);
+	TestEqual(TEXT("Two distinct stacks"), Store.Num(), 2);
+	TestEqual(TEXT("Total count sums stacks"), Store.GetTotalCount(), 6);
+
+	// Category index
+	TArray<FSLFInventoryHandle> Weapons;
+	Store.GetByCategory(ESLFItemCategory::Weapons, Weapons);
+	TestEqual(TEXT("One weapon indexed"), Weapons.Num(), 1);
+
+	// Equip-slot fallback (no explicit EquipSlots on either item)
+	const FGameplayTag RightHand = FGameplayTag::RequestGameplayTag(FName("SoulslikeFramework.Equipment.SlotType.Right Hand Weapon 1"), false);
+	const FGameplayTag Tool = FGameplayTag::RequestGameplayTag(FName("SoulslikeFramework.Equipment.SlotType.Tool 1"), false);
+	if (RightHand.IsValid() && Tool.IsValid())
+	{
+		TArray<UPrimaryDataAsset*> RightHandItems;
+		Store.GetForEquipSlot(RightHand, RightHandItems);
+		TestTrue(TEXT("Sword fits right hand"), RightHandItems.Num() == 1 && RightHandItems[0] == Sword);
+
+		TArray<UPrimaryDataAsset*> ToolItems;
+		Store.GetForEquipSlot(Tool, ToolItems);
+		TestTrue(TEXT("Flask fits tool slot"), ToolItems.Num() == 1 && ToolItems[0] == Flask);
+	}
+
+	// Partial and full removal
+	TestEqual(TEXT("Partial removal keeps stack"), Store.Remove(FlaskHandle, 2), 3);
+	TestEqual(TEXT("Full removal empties stack"), Store.Remove(SwordHandle, 10), 0);
+	TestNull(TEXT("Stale handle resolves to nothing"), Store.Get(SwordHandle));
+
+	// Freed slot is reused with a new generation
+	const FSLFInventoryHandle Reused = Store.Add(Sword, 1, NewCount);
+	TestEqual(TEXT("Freed slot index reused"), Reused.Index, SwordHandle.Index);
+	TestNotEqual(TEXT("Generation bumped on reuse"), Reused.Generation, SwordHandle.Generation);
+
+	Weapons.Reset();
+	Store.GetByCategory(ESLFItemCategory::Weapons, Weapons);
+	TestEqual(TEXT("Category index tracks remove/re-add"), Weapons.Num(), 1);
+	TestEqual(TEXT("Total count after churn"), Store.GetTotalCount(), 4);
+
+	// Two items sharing an ItemTag: removing one keeps the other findable by tag
+	const FGameplayTag SharedTag = FGameplayTag::RequestGameplayTag(FName("SoulslikeFramework.Items.Examples.Armor"), false);
+	if (SharedTag.IsValid())
+	{
+		FSLFInventoryStore TagStore;
+		UPDA_Item* KeyA = NewObject<UPDA_Item>(GetTransientPackage(), TEXT("TestStoreKeyA"));
+		UPDA_Item* KeyB = NewObject<UPDA_Item>(GetTransientPackage(), TEXT("TestStoreKeyB"));
+		KeyA->ItemInformation.ItemTag = SharedTag;
+		KeyB->ItemInformation.ItemTag = SharedTag;
+
+		const FSLFInventoryHandle KeyAHandle = TagStore.Add(KeyA, 1, NewCount);
+		TagStore.Add(KeyB, 2, NewCount);
+		TestEqual(TEXT("Shared tag sums both holders"), TagStore.GetCountMatchingTag(SharedTag), 3);
+		TagStore.Remove(KeyAHandle, 1);
+		const FSLFInventoryEntry* Survivor = TagStore.Get(TagStore.FindByTag(SharedTag));
+		TestTrue(TEXT("Surviving holder still found by tag"), Survivor && Survivor->Item == KeyB);
+		TestEqual(TEXT("Shared tag count after removal"), TagStore.GetCountMatchingTag(SharedTag), 2);
+	}
+
+	// Serialization only carries Entries; PostSerialize must rebuild the indexes
+	TArray<uint8> Bytes;
+	{
+		FMemoryWriter Writer(Bytes);
+		FObjectAndNameAsStringProxyArchive WriterProxy(Writer, false);
+		FSLFInventoryStore::StaticStruct()->SerializeItem(WriterProxy, &Store, nullptr);
+	}
+	FSLFInventoryStore Loaded;
+	{
+		FMemoryReader Reader(Bytes);
+		FObjectAndNameAsStringProxyArchive ReaderProxy(Reader, false);
+		FSLFInventoryStore::StaticStruct()->SerializeItem(ReaderProxy, &Loaded, nullptr);
+	}
+	TestEqual(TEXT("Loaded store keeps its stacks"), Loaded.Num(), Store.Num());
+	TestEqual(TEXT("Loaded store keeps its total"), Loaded.GetTotalCount(), 4);
+	TestTrue(TEXT("Loaded asset index resolves the same handle"), Loaded.FindByAsset(Sword) == Reused);
+	TestEqual(TEXT("Loaded flask count"), Loaded.GetCount(Flask), 3);
+	Weapons.Reset();
+	Loaded.GetByCategory(ESLFItemCategory::Weapons, Weapons);
+	TestEqual(TEXT("Loaded category index rebuilt"), Weapons.Num(), 1);
+
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	return true;
+}
+
 // ============================================================================
 // TEST: Equipment Manager Functionality
 // ============================================================================
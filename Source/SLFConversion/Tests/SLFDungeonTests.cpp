@@ -0,0 +1,641 @@
+// SLFDungeonTests.cpp
+// Automated tests for the design-driven cave maze pipeline (Dungeon/)
+// Run via: UnrealEditor-Cmd.exe [project] -ExecCmds="Automation RunTests SLF.Dungeon" -unattended -nopause
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "EngineUtils.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+
+#if WITH_EDITOR
+#include "Dungeon/SLFCaveMazeBuilder.h"
+#include "Dungeon/SLFCaveMazeWalls.h"
+#include "Dungeon/SLFCaveLayoutCache.h"
+#include "Dungeon/SLFCellGraphWriter.h"
+#include "Misc/FileHelper.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryReader.h"
+
+// ============================================================================
+// HELPER: Synthetic maze layout (grid of cells, one wall per cell edge)
+// ============================================================================
+static FSLFCaveLayout MakeGridLayout(int32 CellsPerSide, float CellSize)
+{
+	FSLFCaveLayout Layout;
+	for (int32 Y = 0; Y <= CellsPerSide; ++Y)
+	{
+		for (int32 X = 0; X <= CellsPerSide; ++X)
+		{
+			const FVector Corner(X * CellSize, Y * CellSize, 0.0f);
+			const int32 WallIndex = Layout.Walls.Num();
+
+			// Horizontal and vertical edge from each grid corner
+			if (X < CellsPerSide)
+			{
+				FSLFWallSegment& Wall = Layout.Walls.AddDefaulted_GetRef();
+				Wall.Start = Corner;
+				Wall.End = Corner + FVector(CellSize, 0.0f, 0.0f);
+				Wall.bNaturalRock = (WallIndex % 3) != 0;
+				Wall.Tag = (WallIndex % 10) == 0 ? TEXT("ShortcutWall") : TEXT("");
+			}
+			if (Y < CellsPerSide)
+			{
+				FSLFWallSegment& Wall = Layout.Walls.AddDefaulted_GetRef();
+				Wall.Start = Corner;
+				Wall.End = Corner + FVector(0.0f, CellSize, 0.0f);
+				Wall.bNaturalRock = true;
+				Wall.HeightOverride = (WallIndex % 7) == 0 ? 600.0f : 0.0f;
+			}
+		}
+	}
+	return Layout;
+}
+
+// ============================================================================
+// HELPER: Spawn a collidable cube slab (floor / ceiling for height traces)
+// ============================================================================
+static AStaticMeshActor* SpawnSlab(UWorld* World, UStaticMesh* Cube, const FVector& Center, const FRotator& Rotation, const FVector& Size)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AStaticMeshActor* Slab = World->SpawnActor<AStaticMeshActor>(Center, Rotation, SpawnParams);
+	if (Slab)
+	{
+		UStaticMeshComponent* MeshComp = Slab->GetStaticMeshComponent();
+		MeshComp->SetStaticMesh(Cube);
+		MeshComp->SetCollisionProfileName(TEXT("BlockAll"));
+		Slab->SetActorScale3D(Size / 100.0f);
+	}
+	return Slab;
+}
+
+// ============================================================================
+// TEST: Instanced wall output vs per-actor output
+// Same layout through both paths: instance count, tag side table, transforms, stats
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFCaveMazeInstancedWallsTest, "SLF.Dungeon.CaveMazeInstancedWalls",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFCaveMazeInstancedWallsTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Cave maze walls - instanced vs per-actor output"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	const FSLFCaveLayout Layout = MakeGridLayout(16, 800.0f);
+	int32 ExpectedTagged = 0;
+	for (const FSLFWallSegment& Wall : Layout.Walls)
+	{
+		ExpectedTagged += Wall.Tag == TEXT("ShortcutWall") ? 1 : 0;
+	}
+
+	UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestWorld)
+	{
+		AddError(TEXT("Failed to create test world"));
+		return false;
+	}
+
+	// ── Per-actor path ──
+	const FSLFCaveMazeBuildStats ActorStats = FSLFCaveMazeBuilder::BuildCaveMazeFromLayout(TestWorld, Layout, ESLFCaveWallOutput::Actors);
+	TestEqual(TEXT("Actor path builds every wall"), ActorStats.WallsBuilt, Layout.Walls.Num());
+	TestEqual(TEXT("Actor path spawns one actor per wall"), ActorStats.ActorsSpawned, Layout.Walls.Num());
+	TestEqual(TEXT("Actor path adds no instances"), ActorStats.InstancesAdded, 0);
+
+	// Reference transforms and tag count from the spawned actors
+	TArray<FTransform> ActorTransforms;
+	int32 ActorTagged = 0;
+	for (TActorIterator<AStaticMeshActor> It(TestWorld); It; ++It)
+	{
+		if (It->Tags.Contains(FName(TEXT("CaveMazeWall"))))
+		{
+			ActorTransforms.Add(It->GetActorTransform());
+			ActorTagged += It->Tags.Contains(FName(TEXT("ShortcutWall"))) ? 1 : 0;
+		}
+	}
+	TestEqual(TEXT("Actor path tags shortcut walls"), ActorTagged, ExpectedTagged);
+
+	FSLFCaveMazeBuilder::ClearCaveMaze(TestWorld, 0);
+
+	// ── Instanced path ──
+	const FSLFCaveMazeBuildStats InstancedStats = FSLFCaveMazeBuilder::BuildCaveMazeFromLayout(TestWorld, Layout, ESLFCaveWallOutput::Instanced);
+	TestEqual(TEXT("Instanced path builds every wall"), InstancedStats.WallsBuilt, Layout.Walls.Num());
+	TestEqual(TEXT("Instanced path spawns a single actor"), InstancedStats.ActorsSpawned, 1);
+	TestEqual(TEXT("Instanced path adds one instance per wall"), InstancedStats.InstancesAdded, Layout.Walls.Num());
+
+	ASLFCaveMazeWalls* WallsActor = nullptr;
+	for (TActorIterator<ASLFCaveMazeWalls> It(TestWorld); It; ++It)
+	{
+		WallsActor = *It;
+	}
+	if (!TestNotNull(TEXT("Walls actor spawned"), WallsActor))
+	{
+		TestWorld->DestroyWorld(false);
+		return false;
+	}
+
+	TestTrue(TEXT("Walls actor carries CaveMazeWall tag"), WallsActor->Tags.Contains(FName(TEXT("CaveMazeWall"))));
+
+	UHierarchicalInstancedStaticMeshComponent* Rock = WallsActor->GetWallComponent(true);
+	UHierarchicalInstancedStaticMeshComponent* Built = WallsActor->GetWallComponent(false);
+	TestEqual(TEXT("Instances split by material"), Rock->GetInstanceCount() + Built->GetInstanceCount(), Layout.Walls.Num());
+
+	// Tag side table: lookup by tag, then every hit resolves back to the same tag
+	TArray<FSLFCaveWallInstance> Tagged;
+	TestEqual(TEXT("FindWallsWithTag finds every shortcut wall"), WallsActor->FindWallsWithTag(FName(TEXT("ShortcutWall")), Tagged), ExpectedTagged);
+	for (const FSLFCaveWallInstance& Instance : Tagged)
+	{
+		TestTrue(TEXT("GetInstanceTag round-trips"), WallsActor->GetInstanceTag(Instance.Component, Instance.InstanceIndex) == FName(TEXT("ShortcutWall")));
+	}
+	TestTrue(TEXT("Out-of-range instance has no tag"), WallsActor->GetInstanceTag(Rock, Rock->GetInstanceCount()).IsNone());
+
+	// Every instance matches a wall the actor path produced
+	int32 Unmatched = 0;
+	for (UHierarchicalInstancedStaticMeshComponent* Component : { Rock, Built })
+	{
+		for (int32 Index = 0; Index < Component->GetInstanceCount(); ++Index)
+		{
+			FTransform InstanceTransform;
+			Component->GetInstanceTransform(Index, InstanceTransform, /*bWorldSpace*/ true);
+			const bool bMatched = ActorTransforms.ContainsByPredicate([&InstanceTransform](const FTransform& ActorTransform)
+			{
+				return ActorTransform.Equals(InstanceTransform, 0.1f);
+			});
+			Unmatched += bMatched ? 0 : 1;
+		}
+	}
+	TestEqual(TEXT("Instance transforms match per-actor transforms"), Unmatched, 0);
+
+	AddInfo(FString::Printf(TEXT("%d walls: actors %d in %.2f ms, instanced %d actor / %d instances in %.2f ms"),
+		Layout.Walls.Num(),
+		ActorStats.ActorsSpawned, ActorStats.BuildSeconds * 1000.0,
+		InstancedStats.ActorsSpawned, InstancedStats.InstancesAdded, InstancedStats.BuildSeconds * 1000.0));
+
+	FSLFCaveMazeBuilder::ClearCaveMaze(TestWorld, 0);
+	TestWorld->DestroyWorld(false);
+	return true;
+}
+
+// ============================================================================
+// TEST: Batched height grid vs per-wall traces
+// Gently sloped floor + flat ceiling; grid answers must match the per-wall traces to within
+// the slope across half a cell, walls sharing a cell must share one trace, a saved / reloaded
+// grid must answer the same build without tracing, misses must stay misses without being
+// retraced, and moving the geometry must invalidate the grid
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFCaveHeightGridTest, "SLF.Dungeon.CaveHeightGrid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFCaveHeightGridTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Cave height grid - batched vs per-wall traces"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Cube mesh"), Cube))
+	{
+		return false;
+	}
+
+	UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestWorld)
+	{
+		AddError(TEXT("Failed to create test world"));
+		return false;
+	}
+
+	// Floor around Z=-200 tilted 2 degrees (+-140 over the maze), ceiling bottom at Z=1550
+	const int32 CellsPerSide = 10;
+	const float MazeSize = CellsPerSide * 800.0f;
+	const FVector MazeCenter(MazeSize * 0.5f, MazeSize * 0.5f, 0.0f);
+	SpawnSlab(TestWorld, Cube, MazeCenter + FVector(0.0f, 0.0f, -200.0f), FRotator(2.0f, 0.0f, 0.0f), FVector(MazeSize + 400.0f, MazeSize + 400.0f, 100.0f));
+	SpawnSlab(TestWorld, Cube, MazeCenter + FVector(0.0f, 0.0f, 1600.0f), FRotator::ZeroRotator, FVector(MazeSize + 400.0f, MazeSize + 400.0f, 100.0f));
+
+	// Walls float mid-cave like layout JSON walls do
+	FSLFCaveLayout Layout = MakeGridLayout(CellsPerSide, 800.0f);
+	for (FSLFWallSegment& Wall : Layout.Walls)
+	{
+		Wall.Start.Z = 700.0f;
+		Wall.End.Z = 700.0f;
+	}
+
+	// Reference: one floor and one ceiling trace per wall
+	TArray<FSLFCaveHeightSample> Traced;
+	const FSLFCaveHeightStats TracedStats = FSLFCaveMazeBuilder::ResolveWallHeights(TestWorld, Layout, nullptr, Traced);
+
+	// Batched: cells traced once into the grid
+	const FBox Bounds = FSLFCaveMazeBuilder::ComputeLayoutBounds(Layout);
+	const uint64 SourceHash = FSLFCaveMazeBuilder::ComputeHeightSourceHash(TestWorld, Layout);
+	FSLFCaveHeightGrid Grid(Bounds, SourceHash);
+	TArray<FSLFCaveHeightSample> Batched;
+	const FSLFCaveHeightStats BatchedStats = FSLFCaveMazeBuilder::ResolveWallHeights(TestWorld, Layout, &Grid, Batched);
+
+	TestEqual(TEXT("One height per wall"), Batched.Num(), Traced.Num());
+	TestTrue(TEXT("Grid traces at most one cell per wall"), BatchedStats.CellsTraced <= Layout.Walls.Num());
+	TestEqual(TEXT("No per-wall fallback inside the grid bounds"), BatchedStats.FallbackTraces, 0);
+
+	// Cells are traced from their center: the floor can differ by the 2 degree slope across
+	// half a cell diagonal, the flat ceiling not at all
+	constexpr float Tolerance = 0.1f;
+	const float FloorTolerance = Tolerance
+		+ FMath::Tan(FMath::DegreesToRadians(2.0f)) * Grid.GetCellSize() * UE_HALF_SQRT_2;
+	float MaxFloorError = 0.0f;
+	float MaxCeilingError = 0.0f;
+	int32 FloorHits = 0;
+	for (int32 Index = 0; Index < FMath::Min(Batched.Num(), Traced.Num()); ++Index)
+	{
+		MaxFloorError = FMath::Max(MaxFloorError, FMath::Abs(Batched[Index].FloorZ - Traced[Index].FloorZ));
+		MaxCeilingError = FMath::Max(MaxCeilingError, FMath::Abs(Batched[Index].CeilingZ - Traced[Index].CeilingZ));
+		FloorHits += Traced[Index].FloorZ < 0.0f ? 1 : 0;
+	}
+	TestEqual(TEXT("Reference traces hit the floor slab"), FloorHits, Traced.Num());
+	TestTrue(FString::Printf(TEXT("Floor heights within %.1f (max error %.2f)"), FloorTolerance, MaxFloorError), MaxFloorError <= FloorTolerance);
+	TestTrue(FString::Printf(TEXT("Ceiling heights within %.1f (max error %.2f)"), Tolerance, MaxCeilingError), MaxCeilingError <= Tolerance);
+
+	// Save / load next to the layout, then rebuild without tracing
+	const FString GridPath = FPaths::AutomationTransientDir() / TEXT("SLFCaveHeightGridTest.bin");
+	TestTrue(TEXT("Grid saves"), Grid.SaveToFile(GridPath));
+
+	FSLFCaveHeightGrid Loaded;
+	TestTrue(TEXT("Grid loads"), Loaded.LoadFromFile(GridPath));
+	TestEqual(TEXT("Loaded grid keeps every cell"), Loaded.Num(), Grid.Num());
+	TestTrue(TEXT("Loaded grid is compatible with the same bounds and sources"), Loaded.IsCompatible(Bounds, SourceHash));
+	TestFalse(TEXT("Loaded grid rejects different bounds"), Loaded.IsCompatible(Bounds.ShiftBy(FVector(1000.0f, 0.0f, 0.0f)), SourceHash));
+
+	TArray<FSLFCaveHeightSample> Reloaded;
+	const FSLFCaveHeightStats ReloadedStats = FSLFCaveMazeBuilder::ResolveWallHeights(TestWorld, Layout, &Loaded, Reloaded);
+	TestEqual(TEXT("Reloaded grid traces nothing"), ReloadedStats.CellsTraced + ReloadedStats.FallbackTraces, 0);
+
+	int32 Mismatches = 0;
+	for (int32 Index = 0; Index < FMath::Min(Reloaded.Num(), Batched.Num()); ++Index)
+	{
+		Mismatches += (Reloaded[Index].FloorZ != Batched[Index].FloorZ || Reloaded[Index].CeilingZ != Batched[Index].CeilingZ) ? 1 : 0;
+	}
+	TestEqual(TEXT("Reloaded grid answers identically"), Mismatches, 0);
+
+	// Short wall pieces (a quarter cell each) share cells, so a first build traces fewer cells than walls
+	FSLFCaveLayout SplitLayout;
+	const float PieceLength = Grid.GetCellSize() * 0.25f;
+	for (const FSLFWallSegment& Wall : Layout.Walls)
+	{
+		const FVector Dir = (Wall.End - Wall.Start).GetSafeNormal();
+		const int32 NumPieces = FMath::FloorToInt32(FVector::Dist(Wall.Start, Wall.End) / PieceLength);
+		for (int32 Piece = 0; Piece < NumPieces; ++Piece)
+		{
+			FSLFWallSegment& Split = SplitLayout.Walls.Add_GetRef(Wall);
+			Split.Start = Wall.Start + Dir * (Piece * PieceLength);
+			Split.End = Split.Start + Dir * PieceLength;
+		}
+	}
+	FSLFCaveHeightGrid SplitGrid(FSLFCaveMazeBuilder::ComputeLayoutBounds(SplitLayout), 0);
+	TArray<FSLFCaveHeightSample> SplitHeights;
+	const FSLFCaveHeightStats SplitStats = FSLFCaveMazeBuilder::ResolveWallHeights(TestWorld, SplitLayout, &SplitGrid, SplitHeights);
+	TestTrue(FString::Printf(TEXT("First build shares traces (%d cells for %d walls)"), SplitStats.CellsTraced, SplitLayout.Walls.Num()),
+		SplitStats.CellsTraced > 0 && SplitStats.CellsTraced * 2 <= SplitLayout.Walls.Num());
+
+	// A wall above the ceiling slab misses both traces: cached as a miss, never retraced
+	FSLFCaveLayout MissLayout;
+	FSLFWallSegment& MissWall = MissLayout.Walls.AddDefaulted_GetRef();
+	MissWall.Start = FVector(400.0f, 400.0f, 6000.0f);
+	MissWall.End = FVector(1200.0f, 400.0f, 6000.0f);
+
+	TArray<FSLFCaveHeightSample> MissHeights;
+	const FSLFCaveHeightStats MissStats = FSLFCaveMazeBuilder::ResolveWallHeights(TestWorld, MissLayout, &Grid, MissHeights);
+	TestEqual(TEXT("Missing probe traced once"), MissStats.CellsTraced, 1);
+	TestEqual(TEXT("Miss falls back to the default floor"), MissHeights[0].FloorZ, 6000.0f - 200.0f);
+	TestEqual(TEXT("Miss falls back to the default ceiling"), MissHeights[0].CeilingZ, 6000.0f + 1400.0f);
+
+	const FSLFCaveHeightSample* MissSample = Grid.Find(Grid.GetCell(FVector(800.0f, 400.0f, 6000.0f)));
+	TestTrue(TEXT("Miss cached as a miss, not a hit"), MissSample && !MissSample->HasFloor() && !MissSample->HasCeiling());
+
+	const FSLFCaveHeightStats MissAgainStats = FSLFCaveMazeBuilder::ResolveWallHeights(TestWorld, MissLayout, &Grid, MissHeights);
+	TestEqual(TEXT("Cached miss is not retraced"), MissAgainStats.CellsTraced + MissAgainStats.FallbackTraces, 0);
+
+	// Layout and geometry edits change the source hash, so the saved grid is not reused
+	TestNotEqual(TEXT("Changing the layout changes the source hash"),
+		FSLFCaveMazeBuilder::ComputeHeightSourceHash(TestWorld, MissLayout), SourceHash);
+	SpawnSlab(TestWorld, Cube, MazeCenter + FVector(0.0f, 0.0f, 400.0f), FRotator::ZeroRotator, FVector(800.0f, 800.0f, 100.0f));
+	const uint64 EditedHash = FSLFCaveMazeBuilder::ComputeHeightSourceHash(TestWorld, Layout);
+	TestNotEqual(TEXT("Adding a floor changes the source hash"), EditedHash, SourceHash);
+	TestFalse(TEXT("Loaded grid rejects changed geometry"), Loaded.IsCompatible(Bounds, EditedHash));
+
+	AddInfo(FString::Printf(TEXT("%d walls: per-wall %d traces in %.2f ms, grid %d cells in %.2f ms, reloaded grid %.2f ms"),
+		Layout.Walls.Num(), TracedStats.FallbackTraces * 2, TracedStats.Seconds * 1000.0,
+		BatchedStats.CellsTraced, BatchedStats.Seconds * 1000.0, ReloadedStats.Seconds * 1000.0));
+
+	IFileManager::Get().Delete(*GridPath);
+	TestWorld->DestroyWorld(false);
+	return true;
+}
+
+// ============================================================================
+// TEST: Compiled layout blob vs JSON parse
+// Same layout from the JSON DOM and the compiled blob; edited JSON invalidates the blob
+// ============================================================================
+static const TCHAR* LayoutCacheTestJson = TEXT(R"JSON({
+	"dungeonIndex": 2,
+	"origin": [1000.5, -2000.25, 300],
+	"extent": [8000, 6000, 1500],
+	"rooms": [
+		{ "groupId": 0, "designation": "Entrance", "center": [100, 200, 0], "radius": 650, "connectedRoomIds": [1] },
+		{ "groupId": 1, "designation": "bossarena", "center": [4000, 2500, -250.75], "radius": 1800, "connectedRoomIds": [0, 2] },
+		{ "groupId": 2, "designation": "HiddenRoom", "center": [-300, 5100, 120], "radius": 420.5, "connectedRoomIds": [] }
+	],
+	"corridors": [
+		{ "from": 0, "to": 1, "width": 450, "waypoints": [[100, 200, 0], [2000, 1200, -100], [4000, 2500, -250.75]] },
+		{ "from": 1, "to": 2, "width": 300, "isShortcut": true, "waypoints": [] }
+	],
+	"walls": [
+		{ "start": [0, 0, 0], "end": [800, 0, 0], "thickness": 200 },
+		{ "start": [800, 0, 0], "end": [800, 800, 10], "thickness": 150, "naturalRock": false, "tag": "BossGateWall", "heightOverride": 900 },
+		{ "start": [-100.125, 50, 5], "end": [-100.125, 950, 5], "thickness": 250, "tag": "ShortcutWall" }
+	]
+})JSON");
+
+static bool LayoutsMatch(FAutomationTestBase& Test, const FSLFCaveLayout& A, const FSLFCaveLayout& B)
+{
+	bool bMatch = A.DungeonIndex == B.DungeonIndex && A.DungeonOrigin == B.DungeonOrigin && A.DungeonExtent == B.DungeonExtent
+		&& A.Rooms.Num() == B.Rooms.Num() && A.Corridors.Num() == B.Corridors.Num() && A.Walls.Num() == B.Walls.Num();
+
+	for (int32 Index = 0; bMatch && Index < A.Rooms.Num(); ++Index)
+	{
+		const FSLFRoomDesign& RA = A.Rooms[Index];
+		const FSLFRoomDesign& RB = B.Rooms[Index];
+		bMatch = RA.GroupId == RB.GroupId && RA.Designation == RB.Designation && RA.Center == RB.Center
+			&& RA.Radius == RB.Radius && RA.ConnectedRoomIds == RB.ConnectedRoomIds;
+	}
+	for (int32 Index = 0; bMatch && Index < A.Corridors.Num(); ++Index)
+	{
+		const FSLFCorridorDesign& CA = A.Corridors[Index];
+		const FSLFCorridorDesign& CB = B.Corridors[Index];
+		bMatch = CA.FromRoomId == CB.FromRoomId && CA.ToRoomId == CB.ToRoomId && CA.Width == CB.Width
+			&& CA.bIsShortcut == CB.bIsShortcut && CA.Waypoints == CB.Waypoints;
+	}
+	for (int32 Index = 0; bMatch && Index < A.Walls.Num(); ++Index)
+	{
+		const FSLFWallSegment& WA = A.Walls[Index];
+		const FSLFWallSegment& WB = B.Walls[Index];
+		bMatch = WA.Start == WB.Start && WA.End == WB.End && WA.Thickness == WB.Thickness
+			&& WA.HeightOverride == WB.HeightOverride && WA.bNaturalRock == WB.bNaturalRock && WA.Tag == WB.Tag;
+	}
+
+	if (!bMatch)
+	{
+		Test.AddInfo(FString::Printf(TEXT("Layout mismatch: %d/%d rooms, %d/%d corridors, %d/%d walls"),
+			A.Rooms.Num(), B.Rooms.Num(), A.Corridors.Num(), B.Corridors.Num(), A.Walls.Num(), B.Walls.Num()));
+	}
+	return bMatch;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFCaveLayoutCacheTest, "SLF.Dungeon.CaveLayoutCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFCaveLayoutCacheTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Cave layout cache - compiled blob vs JSON"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	const FString JsonPath = FPaths::AutomationTransientDir() / TEXT("SLFCaveLayoutCacheTest_layout.json");
+	const FString CachePath = FSLFCaveLayoutCache::GetCachePath(JsonPath);
+	IFileManager::Get().Delete(*CachePath);
+	TestTrue(TEXT("Test JSON written"), FFileHelper::SaveStringToFile(LayoutCacheTestJson, *JsonPath));
+
+	// Reference: JSON DOM only
+	FSLFCaveLayout FromJson;
+	TestTrue(TEXT("JSON parses"), FSLFCaveMazeBuilder::LoadLayoutFromFile(JsonPath, FromJson, false));
+	TestFalse(TEXT("Uncached load writes no blob"), IFileManager::Get().FileExists(*CachePath));
+	TestEqual(TEXT("Rooms parsed"), FromJson.Rooms.Num(), 3);
+	TestEqual(TEXT("Corridors parsed"), FromJson.Corridors.Num(), 2);
+	TestEqual(TEXT("Walls parsed"), FromJson.Walls.Num(), 3);
+	if (FromJson.Rooms.Num() == 3)
+	{
+		TestTrue(TEXT("Designation parsed case-insensitively"), FromJson.Rooms[1].Designation == ESLFRoomDesignation::BossArena);
+	}
+
+	// First cached load compiles the blob, second one reads it
+	FSLFCaveLayout Compiled;
+	TestTrue(TEXT("Cached load (compile)"), FSLFCaveMazeBuilder::LoadLayoutFromFile(JsonPath, Compiled));
+	TestTrue(TEXT("Blob written next to the JSON"), IFileManager::Get().FileExists(*CachePath));
+	TestTrue(TEXT("Compiling load matches JSON"), LayoutsMatch(*this, Compiled, FromJson));
+
+	TArray<uint8> JsonBytes;
+	FFileHelper::LoadFileToArray(JsonBytes, *JsonPath);
+	const uint64 SourceHash = FSLFCaveLayoutCache::HashSource(JsonBytes);
+
+	FSLFCaveLayout FromBlob;
+	TestTrue(TEXT("Blob loads for the current JSON hash"), FSLFCaveLayoutCache::Load(CachePath, SourceHash, FromBlob));
+	TestTrue(TEXT("Blob round-trips the JSON layout"), LayoutsMatch(*this, FromBlob, FromJson));
+
+	FSLFCaveLayout Cached;
+	TestTrue(TEXT("Cached load (blob)"), FSLFCaveMazeBuilder::LoadLayoutFromFile(JsonPath, Cached));
+	TestTrue(TEXT("Blob load matches JSON"), LayoutsMatch(*this, Cached, FromJson));
+
+	// Editing the JSON changes the hash: stale blob is rejected and regenerated
+	FString EditedJson = LayoutCacheTestJson;
+	EditedJson.ReplaceInline(TEXT("\"thickness\": 250"), TEXT("\"thickness\": 275"));
+	TestTrue(TEXT("Edited JSON written"), FFileHelper::SaveStringToFile(EditedJson, *JsonPath));
+
+	TArray<uint8> EditedBytes;
+	FFileHelper::LoadFileToArray(EditedBytes, *JsonPath);
+	const uint64 EditedHash = FSLFCaveLayoutCache::HashSource(EditedBytes);
+	TestTrue(TEXT("Edited JSON hashes differently"), EditedHash != SourceHash);
+
+	FSLFCaveLayout Stale;
+	TestFalse(TEXT("Stale blob rejected"), FSLFCaveLayoutCache::Load(CachePath, EditedHash, Stale));
+
+	FSLFCaveLayout Regenerated;
+	TestTrue(TEXT("Cached load after edit"), FSLFCaveMazeBuilder::LoadLayoutFromFile(JsonPath, Regenerated));
+	if (Regenerated.Walls.Num() == 3)
+	{
+		TestEqual(TEXT("Edit visible after regeneration"), Regenerated.Walls[2].Thickness, 275.0f);
+	}
+	TestTrue(TEXT("Regenerated blob accepted for the edited hash"), FSLFCaveLayoutCache::Load(CachePath, EditedHash, Stale));
+
+	IFileManager::Get().Delete(*JsonPath);
+	IFileManager::Get().Delete(*CachePath);
+	return true;
+}
+
+// ============================================================================
+// TEST: Streaming cell graph writer vs the FJsonObject DOM it replaced
+// ============================================================================
+static TSharedRef<FJsonValue> MakeNumberArray(std::initializer_list<double> Values)
+{
+	TArray<TSharedPtr<FJsonValue>> Arr;
+	for (double Value : Values)
+	{
+		Arr.Add(MakeShared<FJsonValueNumber>(Value));
+	}
+	return MakeShared<FJsonValueArray>(Arr);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFCellGraphWriterTest, "SLF.Dungeon.CellGraphWriter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFCellGraphWriterTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Cell graph writer - streamed vs DOM output"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	const int32 DungeonIndex = 1;
+	const FVector Origin(-12000.0, 3500.5, -800.0);
+	const FVector GridSize(400.0, 400.0, 200.0);
+
+	// Synthetic groups with awkward values (fractions, negatives, an empty connection list)
+	FRandomStream Random(1234);
+	TArray<FSLFCellGraphGroup> Groups;
+	for (int32 GroupIndex = 0; GroupIndex < 40; ++GroupIndex)
+	{
+		FSLFCellGraphGroup& Group = Groups.AddDefaulted_GetRef();
+		Group.GroupId = GroupIndex * 3;
+		Group.GroupHeight = Random.RandRange(-2, 4);
+		for (int32 LeafIndex = 0; LeafIndex < 1 + GroupIndex % 7; ++LeafIndex)
+		{
+			FSLFCellGraphLeaf& Leaf = Group.Leaves.AddDefaulted_GetRef();
+			Leaf.CellId = GroupIndex * 10 + LeafIndex;
+			Leaf.Center = FVector2D(Origin.X + Random.FRandRange(0.0f, 60.0f) * GridSize.X, Origin.Y + Random.FRandRange(0.0f, 60.0f) * GridSize.Y);
+			Leaf.Area = Random.FRandRange(0.5f, 40.0f);
+			Group.TotalArea += Leaf.Area;
+		}
+		Group.Center = FVector(Random.FRandRange(-1e5f, 1e5f), Random.FRandRange(-1e5f, 1e5f), Origin.Z + Group.GroupHeight * GridSize.Z);
+		Group.Radius = FMath::Sqrt(Group.TotalArea) * GridSize.X * 0.5f;
+		for (int32 Conn = 0; Conn < GroupIndex % 4; ++Conn)
+		{
+			Group.Connections.Add((GroupIndex + Conn + 1) % 40);
+		}
+	}
+
+	// Reference: the DOM exporter (FJsonObject tree -> FString -> SaveStringToFile)
+	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("dungeonIndex"), DungeonIndex);
+	Root->SetField(TEXT("origin"), MakeNumberArray({ Origin.X, Origin.Y, Origin.Z }));
+	Root->SetField(TEXT("gridSize"), MakeNumberArray({ GridSize.X, GridSize.Y, GridSize.Z }));
+	TArray<TSharedPtr<FJsonValue>> GroupsArr;
+	for (const FSLFCellGraphGroup& Group : Groups)
+	{
+		TSharedPtr<FJsonObject> GObj = MakeShared<FJsonObject>();
+		GObj->SetNumberField(TEXT("groupId"), Group.GroupId);
+		GObj->SetNumberField(TEXT("groupHeight"), Group.GroupHeight);
+		TArray<TSharedPtr<FJsonValue>> LeavesArr;
+		for (const FSLFCellGraphLeaf& Leaf : Group.Leaves)
+		{
+			TSharedPtr<FJsonObject> LObj = MakeShared<FJsonObject>();
+			LObj->SetNumberField(TEXT("cellId"), Leaf.CellId);
+			LObj->SetField(TEXT("center"), MakeNumberArray({ Leaf.Center.X, Leaf.Center.Y }));
+			LObj->SetNumberField(TEXT("area"), Leaf.Area);
+			LeavesArr.Add(MakeShared<FJsonValueObject>(LObj));
+		}
+		GObj->SetField(TEXT("center"), MakeNumberArray({ Group.Center.X, Group.Center.Y, Group.Center.Z }));
+		GObj->SetNumberField(TEXT("radius"), Group.Radius);
+		GObj->SetNumberField(TEXT("leafCount"), Group.Leaves.Num());
+		GObj->SetNumberField(TEXT("totalArea"), Group.TotalArea);
+		GObj->SetArrayField(TEXT("leaves"), LeavesArr);
+		TArray<TSharedPtr<FJsonValue>> ConnsArr;
+		for (int32 Conn : Group.Connections)
+		{
+			ConnsArr.Add(MakeShared<FJsonValueNumber>(Conn));
+		}
+		GObj->SetArrayField(TEXT("connections"), ConnsArr);
+		GroupsArr.Add(MakeShared<FJsonValueObject>(GObj));
+	}
+	Root->SetArrayField(TEXT("groups"), GroupsArr);
+
+	const FString DomPath = FPaths::AutomationTransientDir() / TEXT("SLFCellGraphWriterTest_dom.json");
+	const FString StreamPath = FPaths::AutomationTransientDir() / TEXT("SLFCellGraphWriterTest_stream.json");
+	const FString BinaryPath = FPaths::AutomationTransientDir() / TEXT("SLFCellGraphWriterTest_stream.bin");
+
+	FString JsonStr;
+	TSharedRef<TJsonWriter<>> DomWriter = TJsonWriterFactory<>::Create(&JsonStr);
+	FJsonSerializer::Serialize(Root.ToSharedRef(), DomWriter);
+	FFileHelper::SaveStringToFile(JsonStr, *DomPath);
+
+	// Streamed
+	{
+		FSLFCellGraphWriter Writer(StreamPath, BinaryPath);
+		TestTrue(TEXT("Writer opens"), Writer.IsOpen());
+		Writer.Begin(DungeonIndex, Origin, GridSize);
+		for (const FSLFCellGraphGroup& Group : Groups)
+		{
+			Writer.WriteGroup(Group);
+		}
+		TestTrue(TEXT("Writer finishes"), Writer.Finish());
+		TestEqual(TEXT("Group count"), Writer.GetNumGroups(), Groups.Num());
+	}
+
+	TArray<uint8> DomBytes, StreamBytes;
+	FFileHelper::LoadFileToArray(DomBytes, *DomPath);
+	FFileHelper::LoadFileToArray(StreamBytes, *StreamPath);
+	TestEqual(TEXT("Same size as DOM output"), StreamBytes.Num(), DomBytes.Num());
+	TestTrue(TEXT("Byte-identical to DOM output"), StreamBytes == DomBytes);
+
+	// Binary variant reads back the same graph
+	TArray<uint8> BinaryBytes;
+	TestTrue(TEXT("Binary written"), FFileHelper::LoadFileToArray(BinaryBytes, *BinaryPath));
+	FMemoryReader Reader(BinaryBytes);
+	uint32 Magic = 0;
+	int32 Version = 0, FileDungeonIndex = 0, NumGroups = 0;
+	FVector FileOrigin, FileGridSize;
+	Reader << Magic << Version << FileDungeonIndex << FileOrigin.X << FileOrigin.Y << FileOrigin.Z
+		<< FileGridSize.X << FileGridSize.Y << FileGridSize.Z << NumGroups;
+	TestTrue(TEXT("Binary header"), Magic == FSLFCellGraphWriter::BinaryMagic && Version == FSLFCellGraphWriter::BinaryVersion
+		&& FileDungeonIndex == DungeonIndex && FileOrigin == Origin && FileGridSize == GridSize);
+	TestEqual(TEXT("Binary group count"), NumGroups, Groups.Num());
+
+	int32 Mismatches = 0;
+	for (int32 GroupIndex = 0; GroupIndex < NumGroups && !Reader.IsError(); ++GroupIndex)
+	{
+		const FSLFCellGraphGroup& Expected = Groups[GroupIndex];
+		FSLFCellGraphGroup Group;
+		int32 LeafCount = 0, NumLeaves = 0, NumConnections = 0;
+		Reader << Group.GroupId << Group.GroupHeight << Group.Center.X << Group.Center.Y << Group.Center.Z
+			<< Group.Radius << LeafCount << Group.TotalArea << NumLeaves;
+		Group.Leaves.SetNum(NumLeaves);
+		for (FSLFCellGraphLeaf& Leaf : Group.Leaves)
+		{
+			Reader << Leaf.CellId << Leaf.Center.X << Leaf.Center.Y << Leaf.Area;
+		}
+		Reader << NumConnections;
+		Group.Connections.SetNum(NumConnections);
+		for (int32& Conn : Group.Connections)
+		{
+			Reader << Conn;
+		}
+
+		bool bMatch = Group.GroupId == Expected.GroupId && Group.GroupHeight == Expected.GroupHeight
+			&& Group.Center == Expected.Center && Group.Radius == Expected.Radius && Group.TotalArea == Expected.TotalArea
+			&& LeafCount == Expected.Leaves.Num() && Group.Connections == Expected.Connections && NumLeaves == Expected.Leaves.Num();
+		for (int32 LeafIndex = 0; bMatch && LeafIndex < NumLeaves; ++LeafIndex)
+		{
+			bMatch = Group.Leaves[LeafIndex].CellId == Expected.Leaves[LeafIndex].CellId
+				&& Group.Leaves[LeafIndex].Center == Expected.Leaves[LeafIndex].Center
+				&& Group.Leaves[LeafIndex].Area == Expected.Leaves[LeafIndex].Area;
+		}
+		Mismatches += bMatch ? 0 : 1;
+	}
+	TestFalse(TEXT("Binary reads cleanly"), Reader.IsError());
+	TestTrue(TEXT("Binary fully consumed"), Reader.AtEnd());
+	TestEqual(TEXT("Binary groups match"), Mismatches, 0);
+
+	AddInfo(FString::Printf(TEXT("%d groups: JSON %d bytes, binary %d bytes"), Groups.Num(), StreamBytes.Num(), BinaryBytes.Num()));
+
+	IFileManager::Get().Delete(*DomPath);
+	IFileManager::Get().Delete(*StreamPath);
+	IFileManager::Get().Delete(*BinaryPath);
+	return true;
+}
+
+#endif // WITH_EDITOR
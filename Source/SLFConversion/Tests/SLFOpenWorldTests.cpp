@@ -0,0 +1,473 @@
+// SLFOpenWorldTests.cpp
+// Automated tests for open world generation helpers (OpenWorld/)
+// Run via: UnrealEditor-Cmd.exe [project] -ExecCmds="Automation RunTests SLF.OpenWorld" -unattended -nopause
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "OpenWorld/SLFHeightmapGenerator.h"
+#include "OpenWorld/SLFHeightField.h"
+#include "OpenWorld/SLFPoissonScatter.h"
+#include "OpenWorld/SLFScatterBatch.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+// ============================================================================
+// HELPER: The original per-pixel heightmap loop (USetupOpenWorldCommandlet::GenerateHeightmap)
+// ============================================================================
+static TArray<uint16> GenerateLegacyHeightmap(int32 SizeX, int32 SizeY)
+{
+	TArray<uint16> Heightmap;
+	Heightmap.SetNum(SizeX * SizeY);
+
+	const uint16 MidHeight = 32768; // Sea level
+
+	for (int32 Y = 0; Y < SizeY; Y++)
+	{
+		for (int32 X = 0; X < SizeX; X++)
+		{
+			float FX = (float)X;
+			float FY = (float)Y;
+
+			float H = FMath::Sin(FX * 0.002f) * FMath::Cos(FY * 0.0025f) * 8000.0f;
+			H += FMath::Sin(FX * 0.008f + 1.3f) * FMath::Sin(FY * 0.006f + 0.7f) * 2500.0f;
+			H += FMath::Sin(FX * 0.025f + 3.1f) * FMath::Cos(FY * 0.03f + 2.2f) * 800.0f;
+			float Ridge = FMath::Sin((FX + FY) * 0.003f) * 3000.0f;
+			H += Ridge * FMath::Max(0.0f, FMath::Sin(FY * 0.004f));
+
+			int32 HeightVal = FMath::Clamp((int32)(MidHeight + H), 0, 65535);
+			Heightmap[Y * SizeX + X] = (uint16)HeightVal;
+		}
+	}
+
+	return Heightmap;
+}
+
+static int32 CountMismatches(const TArray<uint16>& A, const TArray<uint16>& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return FMath::Max(A.Num(), B.Num());
+	}
+	int32 Mismatches = 0;
+	for (int32 Index = 0; Index < A.Num(); ++Index)
+	{
+		Mismatches += A[Index] != B[Index] ? 1 : 0;
+	}
+	return Mismatches;
+}
+
+// ============================================================================
+// TEST: Table-driven SIMD heightmap is bit-identical to the per-pixel loop
+// Odd sizes exercise the vector tail; the tall map crosses several row tasks
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFHeightmapGeneratorTest, "SLF.OpenWorld.HeightmapGenerator",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFHeightmapGeneratorTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Heightmap generator - bit-identical to per-pixel loop"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	const FIntPoint Sizes[] = { FIntPoint(1, 1), FIntPoint(7, 3), FIntPoint(255, 129), FIntPoint(1009, 61), FIntPoint(64, 1500) };
+	for (const FIntPoint& Size : Sizes)
+	{
+		const TArray<uint16> Legacy = GenerateLegacyHeightmap(Size.X, Size.Y);
+
+		FSLFHeightmapGenerator Generator = FSLFHeightmapGenerator::MakeOpenWorldTerrain();
+		const TArray<uint16> Fast = Generator.Generate(Size.X, Size.Y);
+		const TArray<uint16> Reference = Generator.GenerateReference(Size.X, Size.Y);
+
+		TestEqual(FString::Printf(TEXT("%dx%d: SIMD vs legacy mismatches"), Size.X, Size.Y), CountMismatches(Fast, Legacy), 0);
+		TestEqual(FString::Printf(TEXT("%dx%d: layer reference vs legacy mismatches"), Size.X, Size.Y), CountMismatches(Reference, Legacy), 0);
+	}
+
+	// Pluggable layers: an empty generator is flat sea level, a custom layer shows up
+	FSLFHeightmapGenerator Flat;
+	const TArray<uint16> FlatMap = Flat.Generate(9, 2);
+	TestTrue(TEXT("No layers = sea level"), FlatMap.Num() == 18 && FlatMap[0] == 32768 && FlatMap[17] == 32768);
+
+	FSLFHeightmapGenerator Custom;
+	Custom.AddLayer(MakeUnique<FSLFSeparableHeightLayer>(ESLFHeightTerm::Cos, 0.0f, 0.0f, ESLFHeightTerm::Cos, 0.0f, 0.0f, 1000.0f));
+	const TArray<uint16> CustomMap = Custom.Generate(5, 5);
+	TestTrue(TEXT("Custom constant layer raises every pixel"), CustomMap.Num() == 25 && CustomMap[0] == 33768 && CustomMap[24] == 33768);
+
+	FSLFHeightmapGenerator Clamped;
+	Clamped.AddLayer(MakeUnique<FSLFSeparableHeightLayer>(ESLFHeightTerm::Cos, 0.0f, 0.0f, ESLFHeightTerm::Cos, 0.0f, 0.0f, 100000.0f));
+	Clamped.AddLayer(MakeUnique<FSLFRidgeHeightLayer>(0.0f, 0.0f, 0.0f));
+	TestTrue(TEXT("Clamped to uint16 max"), Clamped.Generate(6, 1)[5] == 65535);
+
+	return true;
+}
+
+// ============================================================================
+// BENCHMARK: Heightmap throughput (pixels per second), legacy loop vs generator
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFHeightmapBenchmarkTest, "SLF.OpenWorld.HeightmapBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFHeightmapBenchmarkTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   BENCHMARK: Heightmap generation throughput"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	const int32 Sizes[] = { 1009, 2017, 4033, 8129 };
+	for (int32 Size : Sizes)
+	{
+		const double Pixels = (double)Size * Size;
+
+		FSLFHeightmapGenerator Generator = FSLFHeightmapGenerator::MakeOpenWorldTerrain();
+		double StartTime = FPlatformTime::Seconds();
+		const TArray<uint16> Fast = Generator.Generate(Size, Size);
+		const double FastSeconds = FPlatformTime::Seconds() - StartTime;
+
+		// The legacy loop is only timed up to 4k; 8k takes long enough on one core to stall the test run
+		FString LegacyText = TEXT("legacy skipped");
+		if (Size <= 4033)
+		{
+			StartTime = FPlatformTime::Seconds();
+			const TArray<uint16> Legacy = GenerateLegacyHeightmap(Size, Size);
+			const double LegacySeconds = FPlatformTime::Seconds() - StartTime;
+
+			TestEqual(FString::Printf(TEXT("%d^2 bit-identical"), Size), CountMismatches(Fast, Legacy), 0);
+			LegacyText = FString::Printf(TEXT("legacy %.1f Mpx/s (%.0f ms), speedup %.1fx"),
+				Pixels / FMath::Max(LegacySeconds, 1e-9) / 1e6, LegacySeconds * 1000.0, LegacySeconds / FMath::Max(FastSeconds, 1e-9));
+		}
+
+		AddInfo(FString::Printf(TEXT("%5d^2: generator %.1f Mpx/s (%.0f ms), %s"),
+			Size, Pixels / FMath::Max(FastSeconds, 1e-9) / 1e6, FastSeconds * 1000.0, *LegacyText));
+		TestEqual(FString::Printf(TEXT("%d^2 pixel count"), Size), Fast.Num(), Size * Size);
+	}
+
+	return true;
+}
+
+// ============================================================================
+// HELPER: Brute-force closest pair (O(n^2), independent of the sampler's grid)
+// ============================================================================
+static double ClosestPairDistance(const TArray<FVector2D>& Points)
+{
+	double ClosestSq = TNumericLimits<double>::Max();
+	for (int32 A = 0; A < Points.Num(); ++A)
+	{
+		for (int32 B = A + 1; B < Points.Num(); ++B)
+		{
+			ClosestSq = FMath::Min(ClosestSq, FVector2D::DistSquared(Points[A], Points[B]));
+		}
+	}
+	return FMath::Sqrt(ClosestSq);
+}
+
+// ============================================================================
+// TEST: Poisson-disk scatter - minimum spacing (incl. across tile seams),
+// region bounds, exclusions, MaxPoints and determinism per seed
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFPoissonScatterTest, "SLF.OpenWorld.PoissonScatter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFPoissonScatterTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Poisson-disk scatter - spacing, exclusions, determinism"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	FSLFPoissonScatterParams Params;
+	Params.RegionMin = FVector2D(-10000.0, -8000.0);
+	Params.RegionMax = FVector2D(10000.0, 9000.0);
+	Params.MinSpacing = 300.0f;
+	Params.Seed = FCrc::StrCrc32(TEXT("Rocks"));
+	Params.Exclusions.Add({FVector2D(-2000.0, 1000.0), 2500.0f});
+	Params.Exclusions.Add({FVector2D(9000.0, -7000.0), 1500.0f});
+
+	// Single tile and tiled (tiles of ~5 cells, so many seams) must both hold the guarantee
+	const float TileSizes[] = { 0.0f, 1000.0f, 4800.0f };
+	for (float TileSize : TileSizes)
+	{
+		Params.TileSize = TileSize;
+		FSLFPoissonScatterStats Stats;
+		const TArray<FVector2D> Points = FSLFPoissonScatter::Generate(Params, &Stats);
+
+		const double Closest = ClosestPairDistance(Points);
+		AddInfo(FString::Printf(TEXT("Tile %.0f: %d points in %d tiles, %d candidates, closest pair %.1f, %.2f ms"),
+			TileSize, Points.Num(), Stats.Tiles, Stats.CandidatesTested, Closest, Stats.Seconds * 1000.0));
+
+		// A (near-)maximal set covers the free area with r-disks: at least area / (pi r^2) ~ 1100 points
+		TestTrue(FString::Printf(TEXT("Tile %.0f: region is filled"), TileSize), Points.Num() > 1000);
+		TestTrue(FString::Printf(TEXT("Tile %.0f: closest pair >= MinSpacing"), TileSize), Closest >= Params.MinSpacing - UE_KINDA_SMALL_NUMBER);
+
+		int32 OutOfBounds = 0;
+		int32 Excluded = 0;
+		for (const FVector2D& Point : Points)
+		{
+			OutOfBounds += (Point.X < Params.RegionMin.X || Point.Y < Params.RegionMin.Y ||
+				Point.X >= Params.RegionMax.X || Point.Y >= Params.RegionMax.Y) ? 1 : 0;
+			Excluded += FSLFPoissonScatter::IsExcluded(Point, Params.Exclusions) ? 1 : 0;
+		}
+		TestEqual(FString::Printf(TEXT("Tile %.0f: points outside region"), TileSize), OutOfBounds, 0);
+		TestEqual(FString::Printf(TEXT("Tile %.0f: points inside exclusions"), TileSize), Excluded, 0);
+
+		// Same params -> same points in the same order, regardless of worker scheduling
+		const TArray<FVector2D> Again = FSLFPoissonScatter::Generate(Params);
+		TestTrue(FString::Printf(TEXT("Tile %.0f: deterministic"), TileSize), Again == Points);
+	}
+
+	// A different category seed gives a different layout
+	Params.TileSize = 1000.0f;
+	const TArray<FVector2D> RockPoints = FSLFPoissonScatter::Generate(Params);
+	Params.Seed = FCrc::StrCrc32(TEXT("Boulders"));
+	TestFalse(TEXT("Different seed, different layout"), FSLFPoissonScatter::Generate(Params) == RockPoints);
+
+	// MaxPoints keeps a spread-out subset, identical between runs
+	Params.MaxPoints = 120;
+	const TArray<FVector2D> Capped = FSLFPoissonScatter::Generate(Params);
+	TestEqual(TEXT("MaxPoints honoured"), Capped.Num(), 120);
+	TestTrue(TEXT("Capped subset deterministic"), FSLFPoissonScatter::Generate(Params) == Capped);
+	FBox2D CappedBounds(Capped);
+	TestTrue(TEXT("Capped subset covers the region, not one corner"),
+		CappedBounds.GetSize().X > 15000.0 && CappedBounds.GetSize().Y > 12000.0);
+
+	// Degenerate inputs
+	FSLFPoissonScatterParams Empty;
+	TestEqual(TEXT("Empty region -> no points"), FSLFPoissonScatter::Generate(Empty).Num(), 0);
+	Params.MinSpacing = 0.0f;
+	TestEqual(TEXT("Zero spacing -> no points"), FSLFPoissonScatter::Generate(Params).Num(), 0);
+
+	// Whole region excluded
+	FSLFPoissonScatterParams Covered;
+	Covered.RegionMax = FVector2D(1000.0, 1000.0);
+	Covered.MinSpacing = 100.0f;
+	Covered.Exclusions.Add({FVector2D(500.0, 500.0), 1000.0f});
+	TestEqual(TEXT("Fully excluded region -> no points"), FSLFPoissonScatter::Generate(Covered).Num(), 0);
+
+	return true;
+}
+
+// ============================================================================
+// BENCHMARK: Scatter throughput on the full open world map (tens of thousands of points)
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFPoissonScatterBenchmarkTest, "SLF.OpenWorld.PoissonScatterBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFPoissonScatterBenchmarkTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   BENCHMARK: Poisson-disk scatter throughput"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	FSLFPoissonScatterParams Params;
+	Params.RegionMin = FVector2D(-25000.0, -25000.0);
+	Params.RegionMax = FVector2D(25000.0, 25000.0);
+	Params.Seed = FCrc::StrCrc32(TEXT("Foliage"));
+
+	const float Spacings[] = { 500.0f, 250.0f, 150.0f };
+	for (float Spacing : Spacings)
+	{
+		Params.MinSpacing = Spacing;
+
+		Params.TileSize = 0.0f;
+		FSLFPoissonScatterStats Single;
+		const TArray<FVector2D> SinglePoints = FSLFPoissonScatter::Generate(Params, &Single);
+
+		Params.TileSize = Spacing * 16.0f;
+		FSLFPoissonScatterStats Tiled;
+		const TArray<FVector2D> TiledPoints = FSLFPoissonScatter::Generate(Params, &Tiled);
+
+		AddInfo(FString::Printf(TEXT("Spacing %.0f: single tile %d pts in %.1f ms, %d tiles %d pts in %.1f ms (%.1fx)"),
+			Spacing, SinglePoints.Num(), Single.Seconds * 1000.0, Tiled.Tiles, TiledPoints.Num(), Tiled.Seconds * 1000.0,
+			Single.Seconds / FMath::Max(Tiled.Seconds, 1e-9)));
+		TestTrue(FString::Printf(TEXT("Spacing %.0f: tiled run fills as densely"), Spacing),
+			TiledPoints.Num() > SinglePoints.Num() * 9 / 10);
+	}
+
+	return true;
+}
+
+// ============================================================================
+// TEST: Scatter batch - one actor, one HISM per mesh, mirrored copies as instances
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFScatterBatchTest, "SLF.OpenWorld.ScatterBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFScatterBatchTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Scatter batch - HISM output replaces per-placement actors"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	UStaticMesh* Sphere = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	if (!TestNotNull(TEXT("Cube mesh"), Cube) || !TestNotNull(TEXT("Sphere mesh"), Sphere))
+	{
+		return false;
+	}
+
+	UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestWorld)
+	{
+		AddError(TEXT("Failed to create test world"));
+		return false;
+	}
+
+	// 40 mirrored cubes + 25 spheres = 105 instances that used to be 105 actors
+	FSLFScatterBatch Batch;
+	for (int32 Index = 0; Index < 40; ++Index)
+	{
+		Batch.Add(Cube, FTransform(FRotator(0.0f, Index * 9.0f, 0.0f), FVector(Index * 300.0f, 0.0f, 0.0f), FVector(1.2f)), /*bMirrorBackface=*/ true);
+	}
+	for (int32 Index = 0; Index < 25; ++Index)
+	{
+		Batch.Add(Sphere, FTransform(FVector(0.0f, Index * 300.0f, 50.0f)));
+	}
+	Batch.Add(nullptr, FTransform::Identity);
+	TestEqual(TEXT("Queued instances (null mesh ignored)"), Batch.GetNumInstances(), 105);
+
+	FSLFScatterBatchStats Stats;
+	AActor* Actor = Batch.Flush(TestWorld, TEXT("Scatter_Test"), FName(TEXT("Wasteland/Test")), &Stats);
+	if (TestNotNull(TEXT("Batch actor spawned"), Actor))
+	{
+		TArray<UHierarchicalInstancedStaticMeshComponent*> Components;
+		Actor->GetComponents(Components);
+		TestEqual(TEXT("One HISM per mesh"), Components.Num(), 2);
+
+		if (Components.Num() == 2)
+		{
+			UHierarchicalInstancedStaticMeshComponent* CubeHISM = Components[0]->GetStaticMesh() == Cube ? Components[0] : Components[1];
+			UHierarchicalInstancedStaticMeshComponent* SphereHISM = CubeHISM == Components[0] ? Components[1] : Components[0];
+			TestEqual(TEXT("Cube instances incl. mirrors"), CubeHISM->GetInstanceCount(), 80);
+			TestEqual(TEXT("Sphere instances"), SphereHISM->GetInstanceCount(), 25);
+
+			// Placement 3 and its mirror: same location and scale, yaw + 180
+			FTransform Original, Mirror;
+			CubeHISM->GetInstanceTransform(6, Original, /*bWorldSpace=*/ true);
+			CubeHISM->GetInstanceTransform(7, Mirror, /*bWorldSpace=*/ true);
+			TestTrue(TEXT("Mirror shares location"), Original.GetLocation().Equals(FVector(900.0f, 0.0f, 0.0f), 0.1f) && Mirror.GetLocation().Equals(Original.GetLocation(), 0.1f));
+			TestTrue(TEXT("Mirror shares scale"), Mirror.GetScale3D().Equals(FVector(1.2f), 0.001f));
+			TestTrue(TEXT("Mirror yaw + 180"), FMath::IsNearlyEqual(FRotator::NormalizeAxis(Mirror.Rotator().Yaw - Original.Rotator().Yaw), -180.0f, 0.1f) ||
+				FMath::IsNearlyEqual(FRotator::NormalizeAxis(Mirror.Rotator().Yaw - Original.Rotator().Yaw), 180.0f, 0.1f));
+		}
+	}
+
+	TestEqual(TEXT("Stats: instances"), Stats.Instances, 105);
+	TestEqual(TEXT("Stats: actors"), Stats.Actors, 1);
+	TestEqual(TEXT("Stats: legacy actors"), Stats.LegacyActors, 105);
+	TestTrue(TEXT("Stats: fewer draw calls"), Stats.DrawCalls > 0 && Stats.DrawCalls * 50 <= Stats.LegacyDrawCalls);
+	AddInfo(FString::Printf(TEXT("%d instances: %d actors -> %d, ~%d draw calls -> %d"),
+		Stats.Instances, Stats.LegacyActors, Stats.Actors, Stats.LegacyDrawCalls, Stats.DrawCalls));
+
+	// Flush clears the batch; an empty flush spawns nothing
+	TestTrue(TEXT("Batch cleared"), Batch.IsEmpty());
+	TestNull(TEXT("Empty flush spawns nothing"), Batch.Flush(TestWorld, TEXT("Scatter_Empty"), NAME_None));
+
+	TestWorld->DestroyWorld(false);
+	return true;
+}
+
+// ============================================================================
+// TEST: Height field - exact samples, bilinear midpoints, edge clamping,
+// normals of a known slope, batched == scalar, generated heightmap round trip
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFHeightFieldTest, "SLF.OpenWorld.HeightField",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFHeightFieldTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Height field - bilinear heights and normals"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	// 3x2 map, 100 cm between samples, origin (-100, 200, 50), Z scale 128 -> 1 cm per step
+	//   row 0: 32768  32868  32968     (0, +100, +200 cm)
+	//   row 1: 33268  33368  33468     (+500, +600, +700 cm)
+	FSLFHeightField Field;
+	Field.Initialize({ 32768, 32868, 32968, 33268, 33368, 33468 }, 3, 2, FVector(-100.0, 200.0, 50.0), FVector(100.0, 100.0, 128.0));
+	TestTrue(TEXT("Field valid"), Field.IsValid());
+
+	TestEqual(TEXT("Sample (0,0)"), Field.GetHeight(-100.0, 200.0), 50.0f, 0.01f);
+	TestEqual(TEXT("Sample (2,0)"), Field.GetHeight(100.0, 200.0), 250.0f, 0.01f);
+	TestEqual(TEXT("Sample (1,1)"), Field.GetHeight(0.0, 300.0), 650.0f, 0.01f);
+	TestEqual(TEXT("Last corner (2,1)"), Field.GetHeight(100.0, 300.0), 750.0f, 0.01f);
+	TestEqual(TEXT("Midpoint along X"), Field.GetHeight(-50.0, 200.0), 100.0f, 0.01f);
+	TestEqual(TEXT("Cell center"), Field.GetHeight(50.0, 250.0), 50.0f + (100.0f + 200.0f + 600.0f + 700.0f) * 0.25f, 0.01f);
+	TestEqual(TEXT("Quarter point"), Field.GetHeight(-75.0, 275.0), 50.0f + 25.0f * 0.25f + 525.0f * 0.75f, 0.01f);
+	TestEqual(TEXT("Clamped outside (min corner)"), Field.GetHeight(-5000.0, -5000.0), 50.0f, 0.01f);
+	TestEqual(TEXT("Clamped outside (max corner)"), Field.GetHeight(5000.0, 5000.0), 750.0f, 0.01f);
+
+	// Slope is 1 cm/cm in X and 5 cm/cm in Y everywhere -> normal (-1, -5, 1) normalized
+	const FVector Expected = FVector(-1.0, -5.0, 1.0).GetSafeNormal();
+	TestTrue(TEXT("Normal of known slope"), Field.GetNormal(-30.0, 240.0).Equals(Expected, 0.001f));
+	TestTrue(TEXT("Normal on the last column"), Field.GetNormal(100.0, 260.0).Equals(Expected, 0.001f));
+
+	// Flat field: height everywhere, straight up
+	FSLFHeightField Flat;
+	Flat.InitializeFlat(FVector2D(-25000.0, -25000.0), FVector2D(25000.0, 25000.0), 12.5f);
+	TestEqual(TEXT("Flat height"), Flat.GetHeight(1234.0, -9876.0), 12.5f, 0.001f);
+	TestTrue(TEXT("Flat normal"), Flat.GetNormal(0.0, 0.0).Equals(FVector::UpVector, 0.0001f));
+
+	// Bad input and empty field
+	FSLFHeightField Bad;
+	Bad.Initialize({ 1, 2, 3 }, 2, 2, FVector::ZeroVector, FVector::OneVector);
+	TestFalse(TEXT("Mismatched sample count rejected"), Bad.IsValid());
+	TestEqual(TEXT("Empty field height"), Bad.GetHeight(10.0, 10.0), 0.0f);
+
+	// Generated open world heightmap: exact at samples, batched identical to scalar
+	const int32 Size = 257;
+	TArray<uint16> Heightmap = FSLFHeightmapGenerator::MakeOpenWorldTerrain().Generate(Size, Size);
+	const TArray<uint16> Copy = Heightmap;
+	const FVector Origin(-25200.0, -25200.0, 0.0);
+	const FVector Scale(100.0, 100.0, 100.0);
+	FSLFHeightField Terrain;
+	Terrain.Initialize(MoveTemp(Heightmap), Size, Size, Origin, Scale);
+
+	int32 SampleMismatches = 0;
+	for (int32 Y = 0; Y < Size; Y += 16)
+	{
+		for (int32 X = 0; X < Size; X += 16)
+		{
+			const float ExpectedZ = (Copy[Y * Size + X] - 32768.0f) / 128.0f * 100.0f;
+			SampleMismatches += FMath::IsNearlyEqual(Terrain.GetHeight(Origin.X + X * 100.0, Origin.Y + Y * 100.0), ExpectedZ, 0.01f) ? 0 : 1;
+		}
+	}
+	TestEqual(TEXT("Generated heightmap: exact at sample points"), SampleMismatches, 0);
+
+	FRandomStream Rng(39);
+	TArray<FVector2D> Points;
+	for (int32 Index = 0; Index < 20000; ++Index)
+	{
+		Points.Add(FVector2D(Rng.FRandRange(-26000.0f, 26000.0f), Rng.FRandRange(-26000.0f, 26000.0f)));
+	}
+
+	TArray<float> Heights;
+	TArray<FVector> Normals;
+	Heights.SetNumUninitialized(Points.Num());
+	Normals.SetNumUninitialized(Points.Num());
+
+	const double StartTime = FPlatformTime::Seconds();
+	Terrain.GetHeightsAndNormals(Points, Heights, Normals);
+	const double BatchMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	int32 BatchMismatches = 0;
+	for (int32 Index = 0; Index < Points.Num(); ++Index)
+	{
+		FVector Normal;
+		const float Height = Terrain.GetHeightAndNormal(Points[Index].X, Points[Index].Y, Normal);
+		BatchMismatches += (Height == Heights[Index] && Normal == Normals[Index] && Normal.IsNormalized()) ? 0 : 1;
+	}
+	TestEqual(TEXT("Batched heights/normals match scalar queries"), BatchMismatches, 0);
+
+	TArray<float> HeightsOnly;
+	HeightsOnly.SetNumUninitialized(Points.Num());
+	Terrain.GetHeights(Points, HeightsOnly);
+	TestTrue(TEXT("GetHeights matches GetHeightsAndNormals"), HeightsOnly == Heights);
+
+	AddInfo(FString::Printf(TEXT("%d batched height + normal queries in %.2f ms"), Points.Num(), BatchMs));
+	return true;
+}
@@ -0,0 +1,1573 @@
+// SLFPipelineTests.cpp
+// Automated tests for editor asset pipeline helpers (import manifests, exporters, dependency graph, diffs, anim frame dumps, comparison and batch bakes)
+// Run via: UnrealEditor-Cmd.exe [project] -ExecCmds="Automation RunTests SLF.Pipeline" -unattended -nopause
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+
+#if WITH_EDITOR
+#include "SLFEnemyImportManifest.h"
+#include "SLFYAMLExporter.h"
+#include "SLFYAMLWriter.h"
+#include "SLFAssetDependencyGraph.h"
+#include "SLFDiffEngine.h"
+#include "SLFAnimFrameDump.h"
+#include "SLFAnimComparison.h"
+#include "SLFRetargetDumpWriter.h"
+#include "SLFAssetValidator.h"
+#include "SLFAutomationLibrary.h"
+#include "SLFGameTypes.h"
+#include "PythonBridge.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataModel.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "EditorAssetLibrary.h"
+#include "Engine/DataAsset.h"
+#include "Engine/DataTable.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UnrealType.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "ReferenceSkeleton.h"
+#include "Math/RandomStream.h"
+#include "Hash/xxhash.h"
+
+// ============================================================================
+// TEST: Enemy import manifest - per-step keys follow their inputs only,
+// unchanged files are not re-hashed, outputs must still exist
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFEnemyImportManifestTest, "SLF.Pipeline.EnemyImportManifest",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFEnemyImportManifestTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Enemy import manifest - content-hash step skipping"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	// Fake roster: one enemy with sources, one directory without fbx/
+	const FString BaseDir = FPaths::AutomationTransientDir() / TEXT("SLFEnemyImportManifestTest");
+	const FString EnemyDir = BaseDir / TEXT("test_wanderer");
+	const FString ManifestPath = BaseDir / TEXT("manifest.json");
+	IFileManager::Get().DeleteDirectory(*BaseDir, false, true);
+
+	FFileHelper::SaveStringToFile(TEXT("mesh+skeleton fbx"), *(EnemyDir / TEXT("fbx") / TEXT("test_wanderer_c3100_a000_003000.fbx")));
+	FFileHelper::SaveStringToFile(TEXT("attack fbx"), *(EnemyDir / TEXT("fbx") / TEXT("test_wanderer_c3100_a000_003001.fbx")));
+	FFileHelper::SaveStringToFile(TEXT("png bytes"), *(EnemyDir / TEXT("texture_base_color.png")));
+	FFileHelper::SaveStringToFile(TEXT("{ \"attacks\": [ { \"source\": \"c3100\", \"anim_id\": \"a000_003001\" } ] }"), *(EnemyDir / TEXT("animation_config.json")));
+	FFileHelper::SaveStringToFile(TEXT("{ \"animations\": {} }"), *(EnemyDir / TEXT("tae_hitboxes.json")));
+	FFileHelper::SaveStringToFile(TEXT("notes"), *(BaseDir / TEXT("not_an_enemy") / TEXT("readme.txt")));
+
+	const TArray<FString> Discovered = FSLFEnemyImportManifest::DiscoverEnemies(BaseDir);
+	TestTrue(TEXT("Discovery finds only directories with fbx/*.fbx"), Discovered.Num() == 1 && Discovered[0] == TEXT("test_wanderer"));
+
+	// First scan: everything hashed and parsed, nothing up to date
+	FSLFEnemyImportManifest Manifest;
+	TArray<FSLFEnemySourceScan> Scans = Manifest.ScanSources(BaseDir, { TEXT("test_wanderer"), TEXT("missing_enemy") });
+	if (!TestEqual(TEXT("One scan per enemy"), Scans.Num(), 2))
+	{
+		return false;
+	}
+
+	const FSLFEnemySourceScan& First = Scans[0];
+	TestTrue(TEXT("Source dir exists"), First.bExists);
+	TestFalse(TEXT("Missing enemy flagged"), Scans[1].bExists);
+	TestEqual(TEXT("Input files found"), First.Files.Num(), 5);
+	TestEqual(TEXT("Every file hashed on first scan"), First.FilesHashed, 5);
+	TestTrue(TEXT("Mesh FBX is the first rigged FBX"), First.MeshFBXFile == TEXT("fbx/test_wanderer_c3100_a000_003000.fbx"));
+	TestTrue(TEXT("animation_config.json parsed on scan"), First.AnimationConfig.IsValid() && First.AnimationConfig->HasField(TEXT("attacks")));
+	TestTrue(TEXT("tae_hitboxes.json parsed on scan"), First.TaeHitboxes.IsValid() && First.TaeHitboxes->HasField(TEXT("animations")));
+	TestFalse(TEXT("Nothing up to date before recording"), Manifest.IsStepUpToDate(First, ESLFEnemyImportStep::Mesh));
+
+	// Streamed hash equals a one-shot hash of the file bytes
+	TArray<uint8> FbxBytes;
+	FFileHelper::LoadFileToArray(FbxBytes, *(EnemyDir / First.MeshFBXFile));
+	TestTrue(TEXT("File hash is xxHash64 of the contents"), First.GetFileHash(First.MeshFBXFile) == FXxHash64::HashBuffer(FbxBytes.GetData(), FbxBytes.Num()).Hash);
+
+	// Record all steps against packages that exist, save, reload
+	const TArray<FString> Existing = { TEXT("/Engine/BasicShapes/Cube") };
+	for (int32 Step = 0; Step < (int32)ESLFEnemyImportStep::Num; ++Step)
+	{
+		Manifest.RecordStep(First, (ESLFEnemyImportStep)Step, Existing);
+	}
+	TestTrue(TEXT("Manifest saved"), Manifest.Save(ManifestPath));
+
+	FSLFEnemyImportManifest Reloaded;
+	TestTrue(TEXT("Manifest reloaded"), Reloaded.Load(ManifestPath));
+	Scans = Reloaded.ScanSources(BaseDir, { TEXT("test_wanderer") });
+	const FSLFEnemySourceScan Second = Scans[0];
+	TestEqual(TEXT("Unchanged files reuse the recorded hash"), Second.FilesHashed, 0);
+	TestEqual(TEXT("No changed files"), Reloaded.GetChangedFiles(Second).Num(), 0);
+	for (int32 Step = 0; Step < (int32)ESLFEnemyImportStep::Num; ++Step)
+	{
+		TestTrue(FString::Printf(TEXT("%s up to date after reload"), FSLFEnemyImportManifest::GetStepName((ESLFEnemyImportStep)Step)),
+			Reloaded.IsStepUpToDate(Second, (ESLFEnemyImportStep)Step));
+	}
+
+	// Editing the TAE JSON only invalidates the asset step
+	FFileHelper::SaveStringToFile(TEXT("{ \"animations\": { \"a000_003001\": {} } }"), *(EnemyDir / TEXT("tae_hitboxes.json")));
+	Scans = Reloaded.ScanSources(BaseDir, { TEXT("test_wanderer") });
+	const FSLFEnemySourceScan TaeEdit = Scans[0];
+	TestEqual(TEXT("Only the edited file is re-hashed"), TaeEdit.FilesHashed, 1);
+	const TArray<FString> TaeChanged = Reloaded.GetChangedFiles(TaeEdit);
+	TestTrue(TEXT("Changed file reported"), TaeChanged.Num() == 1 && TaeChanged[0] == TEXT("tae_hitboxes.json"));
+	TestTrue(TEXT("TAE edit: mesh step current"), Reloaded.IsStepUpToDate(TaeEdit, ESLFEnemyImportStep::Mesh));
+	TestTrue(TEXT("TAE edit: animation step current"), Reloaded.IsStepUpToDate(TaeEdit, ESLFEnemyImportStep::Animations));
+	TestFalse(TEXT("TAE edit: asset step stale"), Reloaded.IsStepUpToDate(TaeEdit, ESLFEnemyImportStep::Assets));
+
+	// Editing an animation FBX invalidates animations and everything after them
+	FFileHelper::SaveStringToFile(TEXT("attack fbx v2"), *(EnemyDir / TEXT("fbx") / TEXT("test_wanderer_c3100_a000_003001.fbx")));
+	Scans = Reloaded.ScanSources(BaseDir, { TEXT("test_wanderer") });
+	const FSLFEnemySourceScan FbxEdit = Scans[0];
+	TestTrue(TEXT("FBX edit: mesh step current"), Reloaded.IsStepUpToDate(FbxEdit, ESLFEnemyImportStep::Mesh));
+	TestFalse(TEXT("FBX edit: animation step stale"), Reloaded.IsStepUpToDate(FbxEdit, ESLFEnemyImportStep::Animations));
+	TestFalse(TEXT("FBX edit: asset step stale"), Reloaded.IsStepUpToDate(FbxEdit, ESLFEnemyImportStep::Assets));
+
+	// Same inputs but a recorded output is gone: redo the step
+	Reloaded.RecordStep(FbxEdit, ESLFEnemyImportStep::Animations, { TEXT("/Game/SLFEnemyImportManifestTest/DoesNotExist") });
+	TestFalse(TEXT("Missing output package makes the step stale"), Reloaded.IsStepUpToDate(FbxEdit, ESLFEnemyImportStep::Animations));
+
+	// Files over one read chunk hash the same streamed as in one buffer
+	TArray<uint8> Large;
+	Large.SetNumUninitialized(3 * 1024 * 1024 + 17);
+	for (int32 Index = 0; Index < Large.Num(); ++Index)
+	{
+		Large[Index] = (uint8)(Index * 31 + (Index >> 11));
+	}
+	const FString LargePath = BaseDir / TEXT("large.bin");
+	FFileHelper::SaveArrayToFile(Large, *LargePath);
+	TestTrue(TEXT("Chunked hash matches one-shot hash"), FSLFEnemyImportManifest::HashFile(LargePath) == FXxHash64::HashBuffer(Large.GetData(), Large.Num()).Hash);
+	TestTrue(TEXT("Unreadable file hashes to 0"), FSLFEnemyImportManifest::HashFile(BaseDir / TEXT("nope.bin")) == 0);
+
+	IFileManager::Get().DeleteDirectory(*BaseDir, false, true);
+	return true;
+}
+
+// ============================================================================
+// TEST: YAML exporter golden file - streamed DataTable export matches the
+// document the FString-based exporter wrote, byte for byte
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFYAMLExporterGoldenTest, "SLF.Pipeline.YAMLExporterGolden",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFYAMLExporterGoldenTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: YAML exporter golden file"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	UDataTable* Table = NewObject<UDataTable>(GetTransientPackage(), TEXT("DT_SLFYAMLGolden"), RF_Transient);
+	Table->RowStruct = FSLFDialogEntry::StaticStruct();
+
+	FSLFDialogEntry Greeting;
+	Greeting.Entry = FText::FromString(TEXT("Hello: traveler"));
+	Table->AddRow(TEXT("Greeting"), Greeting);
+
+	FSLFDialogEntry Farewell;
+	Farewell.Entry = FText::FromString(TEXT("Say \"bye\"\n"));
+	Table->AddRow(TEXT("Farewell"), Farewell);
+
+	const FString TablePath = Table->GetPathName();
+	const FString OutputPath = FPaths::AutomationTransientDir() / TEXT("SLFYAMLGolden.yaml");
+
+	// Recorded from the FString-based exporter (ANSI output)
+	const FString Golden = FString(
+		TEXT("# DataTable Export - AUTO-GENERATED\n")
+		TEXT("# DO NOT EDIT - This is the source of truth from bp_only\n")
+		TEXT("\n")
+		TEXT("datatable:\n")
+		TEXT("  path: ")) + TablePath + TEXT("\n") + FString(
+		TEXT("  row_struct: SLFDialogEntry\n")
+		TEXT("  row_count: 2\n")
+		TEXT("\n")
+		TEXT("rows:\n")
+		TEXT("  - row_name: Greeting\n")
+		TEXT("    columns:\n")
+		TEXT("      Entry: \"Hello: traveler\"\n")
+		TEXT("      GameplayEvents:\n")
+		TEXT("        count: 0\n")
+		TEXT("        items:\n")
+		TEXT("\n")
+		TEXT("  - row_name: Farewell\n")
+		TEXT("    columns:\n")
+		TEXT("      Entry: Say \\\"bye\\\"\\n\n")
+		TEXT("      GameplayEvents:\n")
+		TEXT("        count: 0\n")
+		TEXT("        items:\n")
+		TEXT("\n"));
+
+	TestTrue(TEXT("DataTable exported"), USLFYAMLExporter::ExportDataTableToYAML(TablePath, OutputPath));
+
+	TArray<uint8> Bytes;
+	FFileHelper::LoadFileToArray(Bytes, *OutputPath);
+	const FTCHARToUTF8 GoldenBytes(*Golden);
+	TestEqual(TEXT("Golden size"), Bytes.Num(), GoldenBytes.Length());
+	TestTrue(TEXT("Output is byte-identical to the golden file"),
+		Bytes.Num() == GoldenBytes.Length() && FMemory::Memcmp(Bytes.GetData(), GoldenBytes.Get(), Bytes.Num()) == 0);
+
+	// Non-ANSI text: SaveStringToFile wrote UTF-16 with a BOM, so the streamed export must too
+	FSLFDialogEntry Accented;
+	Accented.Entry = FText::FromString(TEXT("Caf\u00E9"));
+	Table->AddRow(TEXT("Accented"), Accented);
+
+	const FString GoldenUnicode = Golden.Replace(TEXT("row_count: 2"), TEXT("row_count: 3")) +
+		TEXT("  - row_name: Accented\n")
+		TEXT("    columns:\n")
+		TEXT("      Entry: Caf\u00E9\n")
+		TEXT("      GameplayEvents:\n")
+		TEXT("        count: 0\n")
+		TEXT("        items:\n")
+		TEXT("\n");
+
+	TestTrue(TEXT("Non-ANSI DataTable exported"), USLFYAMLExporter::ExportDataTableToYAML(TablePath, OutputPath));
+	Bytes.Reset();
+	FFileHelper::LoadFileToArray(Bytes, *OutputPath);
+	TestTrue(TEXT("Non-ANSI export starts with a UTF-16 BOM"), Bytes.Num() > 2 && Bytes[0] == 0xFF && Bytes[1] == 0xFE);
+
+	FString Reloaded;
+	FFileHelper::LoadFileToString(Reloaded, *OutputPath);
+	TestTrue(TEXT("Non-ANSI export text matches"), Reloaded.Equals(GoldenUnicode, ESearchCase::CaseSensitive));
+
+	IFileManager::Get().Delete(*OutputPath);
+	return true;
+}
+
+// ============================================================================
+// TEST: YAML exporter parity - streamed property output matches the
+// FString-based exporter for every struct in the module and a few engine CDOs
+// ============================================================================
+namespace SLFYAMLLegacy
+{
+	// The exporter's original Printf/append implementation, kept as the reference
+	void StructToYAML(const void* StructData, const UStruct* StructType, FString& OutYAML, int32 IndentLevel);
+
+	void PropertyToYAML(FProperty* Property, const void* ValuePtr, FString& OutYAML, int32 IndentLevel)
+	{
+		const FString Indent = USLFYAMLExporter::GetIndent(IndentLevel);
+		const FString PropName = Property->GetName();
+		auto Escape = [](const FString& In) { return USLFYAMLExporter::EscapeYAMLString(In); };
+
+		if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+		{
+			OutYAML += FString::Printf(TEXT("%s%s:\n"), *Indent, *PropName);
+			StructToYAML(ValuePtr, StructProp->Struct, OutYAML, IndentLevel + 1);
+		}
+		else if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Property))
+		{
+			UObject* ObjValue = ObjProp->GetObjectPropertyValue(ValuePtr);
+			if (ObjValue)
+			{
+				OutYAML += FString::Printf(TEXT("%s%s:\n"), *Indent, *PropName);
+				OutYAML += FString::Printf(TEXT("%s  class: %s\n"), *Indent, *ObjValue->GetClass()->GetName());
+				OutYAML += FString::Printf(TEXT("%s  name: %s\n"), *Indent, *ObjValue->GetName());
+				OutYAML += FString::Printf(TEXT("%s  path: %s\n"), *Indent, *Escape(ObjValue->GetPathName()));
+			}
+			else
+			{
+				OutYAML += FString::Printf(TEXT("%s%s: null\n"), *Indent, *PropName);
+			}
+		}
+		else if (FSoftObjectProperty* SoftObjProp = CastField<FSoftObjectProperty>(Property))
+		{
+			FSoftObjectPtr SoftPtr = SoftObjProp->GetPropertyValue(ValuePtr);
+			OutYAML += SoftPtr.IsNull()
+				? FString::Printf(TEXT("%s%s: null\n"), *Indent, *PropName)
+				: FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *Escape(SoftPtr.ToString()));
+		}
+		else if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper ArrayHelper(ArrayProp, ValuePtr);
+			OutYAML += FString::Printf(TEXT("%s%s:\n"), *Indent, *PropName);
+			OutYAML += FString::Printf(TEXT("%s  count: %d\n"), *Indent, ArrayHelper.Num());
+			OutYAML += FString::Printf(TEXT("%s  items:\n"), *Indent);
+			for (int32 i = 0; i < ArrayHelper.Num(); i++)
+			{
+				const void* ElementPtr = ArrayHelper.GetRawPtr(i);
+				OutYAML += FString::Printf(TEXT("%s    - index: %d\n"), *Indent, i);
+				if (FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProp->Inner))
+				{
+					StructToYAML(ElementPtr, InnerStruct->Struct, OutYAML, IndentLevel + 3);
+				}
+				else
+				{
+					FString ElementStr;
+					ArrayProp->Inner->ExportTextItem_Direct(ElementStr, ElementPtr, nullptr, nullptr, PPF_None);
+					OutYAML += FString::Printf(TEXT("%s      value: %s\n"), *Indent, *Escape(ElementStr));
+				}
+			}
+		}
+		else if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
+		{
+			FScriptMapHelper MapHelper(MapProp, ValuePtr);
+			OutYAML += FString::Printf(TEXT("%s%s:\n"), *Indent, *PropName);
+			OutYAML += FString::Printf(TEXT("%s  count: %d\n"), *Indent, MapHelper.Num());
+			OutYAML += FString::Printf(TEXT("%s  entries:\n"), *Indent);
+			for (auto It = MapHelper.CreateIterator(); It; ++It)
+			{
+				FString KeyStr, ValueStr;
+				MapProp->KeyProp->ExportTextItem_Direct(KeyStr, MapHelper.GetKeyPtr(It.GetInternalIndex()), nullptr, nullptr, PPF_None);
+				MapProp->ValueProp->ExportTextItem_Direct(ValueStr, MapHelper.GetValuePtr(It.GetInternalIndex()), nullptr, nullptr, PPF_None);
+				OutYAML += FString::Printf(TEXT("%s    - key: %s\n"), *Indent, *Escape(KeyStr));
+				OutYAML += FString::Printf(TEXT("%s      value: %s\n"), *Indent, *Escape(ValueStr));
+			}
+		}
+		else if (FTextProperty* TextProp = CastField<FTextProperty>(Property))
+		{
+			OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *Escape(USLFYAMLExporter::FTextToString(TextProp->GetPropertyValue(ValuePtr))));
+		}
+		else if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
+		{
+			OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *Escape(StrProp->GetPropertyValue(ValuePtr)));
+		}
+		else if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
+		{
+			OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *Escape(NameProp->GetPropertyValue(ValuePtr).ToString()));
+		}
+		else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+		{
+			OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, BoolProp->GetPropertyValue(ValuePtr) ? TEXT("true") : TEXT("false"));
+		}
+		else if (FIntProperty* IntProp = CastField<FIntProperty>(Property))
+		{
+			OutYAML += FString::Printf(TEXT("%s%s: %d\n"), *Indent, *PropName, IntProp->GetPropertyValue(ValuePtr));
+		}
+		else if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
+		{
+			OutYAML += FString::Printf(TEXT("%s%s: %f\n"), *Indent, *PropName, FloatProp->GetPropertyValue(ValuePtr));
+		}
+		else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
+		{
+			OutYAML += FString::Printf(TEXT("%s%s: %f\n"), *Indent, *PropName, DoubleProp->GetPropertyValue(ValuePtr));
+		}
+		else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+		{
+			const uint8 ByteValue = ByteProp->GetPropertyValue(ValuePtr);
+			OutYAML += ByteProp->Enum
+				? FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *Escape(ByteProp->Enum->GetNameStringByValue(ByteValue)))
+				: FString::Printf(TEXT("%s%s: %d\n"), *Indent, *PropName, ByteValue);
+		}
+		else
+		{
+			// Enum properties and the generic fallback
+			FString ValueStr;
+			Property->ExportTextItem_Direct(ValueStr, ValuePtr, nullptr, nullptr, PPF_None);
+			OutYAML += FString::Printf(TEXT("%s%s: %s\n"), *Indent, *PropName, *Escape(ValueStr));
+		}
+	}
+
+	void StructToYAML(const void* StructData, const UStruct* StructType, FString& OutYAML, int32 IndentLevel)
+	{
+		for (TFieldIterator<FProperty> PropIt(StructType); PropIt; ++PropIt)
+		{
+			FProperty* Property = *PropIt;
+			if (Property->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient)) continue;
+			PropertyToYAML(Property, Property->ContainerPtrToValuePtr<void>(StructData), OutYAML, IndentLevel);
+		}
+	}
+
+	void ObjectToYAML(UObject* Object, FString& OutYAML, int32 IndentLevel)
+	{
+		const FString Indent = USLFYAMLExporter::GetIndent(IndentLevel);
+		OutYAML += FString::Printf(TEXT("%sclass: %s\n"), *Indent, *Object->GetClass()->GetName());
+		OutYAML += FString::Printf(TEXT("%sname: %s\n"), *Indent, *Object->GetName());
+		OutYAML += FString::Printf(TEXT("%spath: %s\n"), *Indent, *USLFYAMLExporter::EscapeYAMLString(Object->GetPathName()));
+		OutYAML += FString::Printf(TEXT("%sproperties:\n"), *Indent);
+		StructToYAML(Object, Object->GetClass(), OutYAML, IndentLevel + 1);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFYAMLExporterParityTest, "SLF.Pipeline.YAMLExporterParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFYAMLExporterParityTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: YAML exporter parity with the FString exporter"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	auto Matches = [](const FString& Legacy, const TArray<uint8>& Streamed)
+	{
+		const FTCHARToUTF8 LegacyBytes(*Legacy);
+		return Streamed.Num() == LegacyBytes.Length() && FMemory::Memcmp(Streamed.GetData(), LegacyBytes.Get(), Streamed.Num()) == 0;
+	};
+
+	// Default instance of every struct this module declares
+	int32 StructsCompared = 0;
+	int32 StructsDiffering = 0;
+	for (TObjectIterator<UScriptStruct> It; It; ++It)
+	{
+		UScriptStruct* Struct = *It;
+		if (Struct->GetOutermost()->GetName() != TEXT("/Script/SLFConversion"))
+		{
+			continue;
+		}
+
+		uint8* Memory = (uint8*)FMemory::Malloc(FMath::Max(Struct->GetStructureSize(), 1), Struct->GetMinAlignment());
+		Struct->InitializeStruct(Memory);
+
+		FString Legacy;
+		SLFYAMLLegacy::StructToYAML(Memory, Struct, Legacy, 1);
+
+		TArray<uint8> Streamed;
+		{
+			FMemoryWriter Ar(Streamed);
+			FSLFYAMLWriter Writer(Ar);
+			USLFYAMLExporter::StructToYAML(Memory, Struct, Writer, 1);
+		}
+
+		if (!Matches(Legacy, Streamed))
+		{
+			++StructsDiffering;
+			AddError(FString::Printf(TEXT("Struct %s differs from the FString exporter"), *Struct->GetName()));
+		}
+		++StructsCompared;
+
+		Struct->DestroyStruct(Memory);
+		FMemory::Free(Memory);
+	}
+	AddInfo(FString::Printf(TEXT("Compared %d module structs (%d differ)"), StructsCompared, StructsDiffering));
+	TestTrue(TEXT("Module structs found"), StructsCompared > 0);
+
+	// Engine CDOs cover object references, maps, enums and nested structs
+	const TArray<UObject*> Objects = {
+		UStaticMeshComponent::StaticClass()->GetDefaultObject(),
+		UCharacterMovementComponent::StaticClass()->GetDefaultObject(),
+		UDataTable::StaticClass()->GetDefaultObject()
+	};
+	for (UObject* Object : Objects)
+	{
+		FString Legacy;
+		SLFYAMLLegacy::ObjectToYAML(Object, Legacy, 1);
+
+		TArray<uint8> Streamed;
+		{
+			FMemoryWriter Ar(Streamed);
+			FSLFYAMLWriter Writer(Ar);
+			USLFYAMLExporter::ObjectToYAML(Object, Writer, 1);
+		}
+		TestTrue(FString::Printf(TEXT("%s matches the FString exporter"), *Object->GetClass()->GetName()), Matches(Legacy, Streamed));
+	}
+
+	// Throughput on a large table of the same row struct
+	const int32 NumRows = 20000;
+	FSLFDialogEntry Row;
+	Row.Entry = FText::FromString(TEXT("Bring me the ember: it sleeps beneath the old keep."));
+	Row.GameplayEvents.SetNum(3);
+	TArray<FSLFDialogEntry> Rows;
+	Rows.Init(Row, NumRows);
+
+	double StartTime = FPlatformTime::Seconds();
+	FString Legacy;
+	for (const FSLFDialogEntry& Entry : Rows)
+	{
+		Legacy += TEXT("  - row_name: Row\n    columns:\n");
+		SLFYAMLLegacy::StructToYAML(&Entry, FSLFDialogEntry::StaticStruct(), Legacy, 3);
+	}
+	const double LegacySeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	TArray<uint8> Streamed;
+	{
+		FMemoryWriter Ar(Streamed);
+		FSLFYAMLWriter Writer(Ar);
+		for (const FSLFDialogEntry& Entry : Rows)
+		{
+			Writer.Raw("  - row_name: Row\n    columns:\n");
+			USLFYAMLExporter::StructToYAML(&Entry, FSLFDialogEntry::StaticStruct(), Writer, 3);
+		}
+	}
+	const double StreamedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestTrue(TEXT("Large table matches the FString exporter"), Matches(Legacy, Streamed));
+	AddInfo(FString::Printf(TEXT("%d rows, %d bytes: FString %.1f ms, streamed %.1f ms (%.1fx)"),
+		NumRows, Streamed.Num(), LegacySeconds * 1000.0, StreamedSeconds * 1000.0,
+		StreamedSeconds > 0.0 ? LegacySeconds / StreamedSeconds : 0.0));
+
+	return true;
+}
+
+// ============================================================================
+// TEST: Bulk DNA export - batched/worker output matches ExportAssetDNA per
+// asset; a second run skips everything, -force redoes everything
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFBulkDNAExportTest, "SLF.Pipeline.BulkDNAExport",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFBulkDNAExportTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Bulk DNA export vs single-asset export"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	// A handful of saved project assets of the exportable types
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	FARFilter Filter;
+	Filter.PackagePaths.Add(TEXT("/Game/SoulslikeFramework"));
+	Filter.bRecursivePaths = true;
+	Filter.bRecursiveClasses = true;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.ClassPaths.Add(UDataAsset::StaticClass()->GetClassPathName());
+
+	TArray<FAssetData> Found;
+	AssetRegistry.GetAssets(Filter, Found);
+	Found.Sort([](const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
+
+	TArray<FString> AssetPaths;
+	for (int32 Index = 0; Index < Found.Num() && AssetPaths.Num() < 12; Index += FMath::Max(1, Found.Num() / 12))
+	{
+		AssetPaths.Add(Found[Index].GetObjectPathString());
+	}
+	if (AssetPaths.Num() == 0)
+	{
+		AddWarning(TEXT("No Blueprints or data assets under /Game/SoulslikeFramework - skipping"));
+		return true;
+	}
+
+	const FString OutputFolder = FPaths::AutomationTransientDir() / TEXT("SLFBulkDNAExport");
+	IFileManager::Get().DeleteDirectory(*OutputFolder, false, true);
+
+	// Small batches so several load/write rounds overlap
+	const FSLFBulkDNAExportResult First = UPythonBridge::BulkExportAssetDNA(AssetPaths, OutputFolder, false, 4);
+	AddInfo(FString::Printf(TEXT("%d assets exported in %.2fs (%.1f assets/s)"), First.Exported, First.Seconds, First.AssetsPerSecond));
+	TestEqual(TEXT("Every asset exported"), First.Exported, AssetPaths.Num());
+	TestEqual(TEXT("No failures"), First.FailedAssets.Num(), 0);
+
+	for (const FString& AssetPath : AssetPaths)
+	{
+		FString BulkText;
+		const bool bLoaded = FFileHelper::LoadFileToString(BulkText, *UPythonBridge::GetDNAExportFilePath(OutputFolder, AssetPath));
+		const FString SingleText = UPythonBridge::ExportAssetDNA(FSoftObjectPath(AssetPath).TryLoad());
+		TestTrue(FString::Printf(TEXT("%s matches ExportAssetDNA"), *AssetPath),
+			bLoaded && BulkText.Equals(SingleText, ESearchCase::CaseSensitive));
+	}
+
+	// Nothing saved since: every asset is skipped on the hash
+	const FSLFBulkDNAExportResult Second = UPythonBridge::BulkExportAssetDNA(AssetPaths, OutputFolder, false, 4);
+	TestEqual(TEXT("Unchanged assets skipped"), Second.Skipped, AssetPaths.Num());
+	TestEqual(TEXT("Nothing re-exported"), Second.Exported, 0);
+
+	// A missing output file is written again even when the hash matches
+	IFileManager::Get().Delete(*UPythonBridge::GetDNAExportFilePath(OutputFolder, AssetPaths[0]));
+	const FSLFBulkDNAExportResult Third = UPythonBridge::BulkExportAssetDNA(AssetPaths, OutputFolder, false, 4);
+	TestEqual(TEXT("Deleted export rewritten"), Third.Exported, 1);
+
+	const FSLFBulkDNAExportResult Forced = UPythonBridge::BulkExportAssetDNA(AssetPaths, OutputFolder, true, 4);
+	TestEqual(TEXT("Force re-exports everything"), Forced.Exported, AssetPaths.Num());
+
+	// A failed write drops the manifest entry, so the next run retries it even though a file exists
+	const FString StuckFile = UPythonBridge::GetDNAExportFilePath(OutputFolder, AssetPaths[0]);
+	IFileManager::Get().SetReadOnly(*StuckFile, true);
+	const FSLFBulkDNAExportResult Stuck = UPythonBridge::BulkExportAssetDNA(AssetPaths, OutputFolder, true, 4);
+	IFileManager::Get().SetReadOnly(*StuckFile, false);
+	if (Stuck.FailedAssets.Num() == 0)
+	{
+		AddWarning(TEXT("Read-only export file still writable on this platform - skipping failed-write check"));
+	}
+	else
+	{
+		TestTrue(TEXT("Failed write reported"), Stuck.FailedAssets.Contains(FSoftObjectPath(AssetPaths[0]).ToString()));
+		const FSLFBulkDNAExportResult Retried = UPythonBridge::BulkExportAssetDNA(AssetPaths, OutputFolder, false, 4);
+		TestEqual(TEXT("Failed write retried on the next run"), Retried.Exported, 1);
+	}
+
+	const FSLFBulkDNAExportResult Missing = UPythonBridge::BulkExportAssetDNA(
+		TArray<FString>{ FString(TEXT("/Game/SLFBulkDNAExportTest/DoesNotExist")) }, OutputFolder);
+	TestEqual(TEXT("Missing asset reported as failed"), Missing.FailedAssets.Num(), 1);
+
+	IFileManager::Get().DeleteDirectory(*OutputFolder, false, true);
+	return true;
+}
+
+// ============================================================================
+// TEST: Asset dependency graph - closures, impact sets and the class index on
+// a hand-built graph, snapshot round trip, registry parity for real packages
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFAssetDependencyGraphTest, "SLF.Pipeline.AssetDependencyGraph",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFAssetDependencyGraphTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Asset dependency graph queries and snapshot"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	auto SameSet = [this](const TCHAR* What, TArray<FName> Actual, TArray<FName> Expected)
+	{
+		Actual.Sort(FNameLexicalLess());
+		Expected.Sort(FNameLexicalLess());
+		TestTrue(What, Actual == Expected);
+	};
+
+	const FName A(TEXT("/Game/GraphTest/A"));
+	const FName B(TEXT("/Game/GraphTest/B"));
+	const FName C(TEXT("/Game/GraphTest/C"));
+	const FName D(TEXT("/Game/GraphTest/D"));
+	const FName E(TEXT("/Game/GraphTest/E"));
+
+	// A -> B -> C, D -> B, C -> A (cycle), E isolated
+	FSLFAssetDependencyGraph Graph;
+	Graph.SetDependencies(A, TArray<FName>{ B });
+	Graph.SetDependencies(B, TArray<FName>{ C, B });
+	Graph.SetDependencies(C, TArray<FName>{ A });
+	Graph.SetDependencies(D, TArray<FName>{ B });
+	Graph.SetDependencies(E, TArray<FName>());
+
+	TestEqual(TEXT("Five nodes"), Graph.NumNodes(), 5);
+	SameSet(TEXT("Self edges dropped"), Graph.GetDependencies(B), TArray<FName>{ C });
+	SameSet(TEXT("Direct referencers"), Graph.GetReferencers(B), TArray<FName>{ A, D });
+	SameSet(TEXT("Closure through the cycle"), Graph.GetTransitiveDependencies(TArray<FName>{ D }), TArray<FName>{ B, C, A });
+	SameSet(TEXT("Reverse closure"), Graph.GetTransitiveReferencers(TArray<FName>{ C }), TArray<FName>{ B, A, D });
+	SameSet(TEXT("Impact set includes the change"), Graph.GetImpactSet(TArray<FName>{ E, D }), TArray<FName>{ E, D });
+
+	// Edge replacement keeps both directions in step
+	Graph.SetDependencies(D, TArray<FName>{ E });
+	SameSet(TEXT("Old reverse edge gone"), Graph.GetReferencers(B), TArray<FName>{ A });
+	SameSet(TEXT("New reverse edge added"), Graph.GetReferencers(E), TArray<FName>{ D });
+
+	// Removing a package drops its outgoing edges only
+	Graph.RemovePackage(C);
+	SameSet(TEXT("Removed package has no dependencies"), Graph.GetDependencies(C), TArray<FName>());
+	SameSet(TEXT("Referencers still point at it"), Graph.GetReferencers(C), TArray<FName>{ B });
+
+	// Class index: native ancestors come from UClass, Blueprint parents from tags
+	const FName ActorPath(*AActor::StaticClass()->GetClassPathName().ToString());
+	const FName PawnPath(*APawn::StaticClass()->GetClassPathName().ToString());
+	const FName CharacterPath(*ACharacter::StaticClass()->GetClassPathName().ToString());
+	Graph.SetBlueprintClass(A, TEXT("/Game/GraphTest/A.A_C"), ActorPath);
+	Graph.SetBlueprintClass(B, TEXT("/Game/GraphTest/B.B_C"), TEXT("/Game/GraphTest/A.A_C"));
+	Graph.SetBlueprintClass(D, TEXT("/Game/GraphTest/D.D_C"), CharacterPath);
+
+	SameSet(TEXT("Actor descendants"), Graph.GetChildBlueprintPackages(ActorPath), TArray<FName>{ A, B, D });
+	SameSet(TEXT("Pawn descendants via native chain"), Graph.GetChildBlueprintPackages(PawnPath), TArray<FName>{ D });
+	SameSet(TEXT("Blueprint parent"), Graph.GetChildBlueprintPackages(TEXT("/Game/GraphTest/A.A_C")), TArray<FName>{ A, B });
+
+	// Reparenting moves the subtree
+	Graph.SetBlueprintClass(B, TEXT("/Game/GraphTest/B.B_C"), PawnPath);
+	SameSet(TEXT("Reparented child left old parent"), Graph.GetChildBlueprintPackages(TEXT("/Game/GraphTest/A.A_C")), TArray<FName>{ A });
+	SameSet(TEXT("Reparented child under new parent"), Graph.GetChildBlueprintPackages(PawnPath), TArray<FName>{ B, D });
+
+	// Snapshot round trip
+	const FString SnapshotPath = FPaths::AutomationTransientDir() / TEXT("SLFAssetGraph") / TEXT("Graph.bin");
+	TestTrue(TEXT("Snapshot saved"), Graph.SaveSnapshot(SnapshotPath));
+	TestFalse(TEXT("Clean after save"), Graph.IsDirty());
+
+	FSLFAssetDependencyGraph Loaded;
+	TestTrue(TEXT("Snapshot loaded"), Loaded.LoadSnapshot(SnapshotPath));
+	TestEqual(TEXT("Same node count"), Loaded.NumNodes(), Graph.NumNodes());
+	TestEqual(TEXT("Same class count"), Loaded.NumClasses(), Graph.NumClasses());
+	SameSet(TEXT("Loaded reverse edges rebuilt"), Loaded.GetReferencers(E), TArray<FName>{ D });
+	SameSet(TEXT("Loaded closure"), Loaded.GetTransitiveDependencies(TArray<FName>{ A }), Graph.GetTransitiveDependencies(TArray<FName>{ A }));
+	SameSet(TEXT("Loaded class index"), Loaded.GetChildBlueprintPackages(PawnPath), TArray<FName>{ B, D });
+
+	// A truncated file is rejected, not half-loaded
+	TArray<uint8> Bytes;
+	FFileHelper::LoadFileToArray(Bytes, *SnapshotPath);
+	Bytes.SetNum(Bytes.Num() / 2);
+	FFileHelper::SaveArrayToFile(Bytes, *SnapshotPath);
+	FSLFAssetDependencyGraph Truncated;
+	TestFalse(TEXT("Truncated snapshot rejected"), Truncated.LoadSnapshot(SnapshotPath));
+	TestEqual(TEXT("Rejected snapshot leaves graph empty"), Truncated.NumNodes(), 0);
+	IFileManager::Get().Delete(*SnapshotPath);
+
+	// Unsaved Blueprints carry no registry tags - GetChildBlueprints still finds them in memory
+	UPackage* ParentPackage = CreatePackage(TEXT("/Temp/SLFGraphTest/BP_GraphParent"));
+	UPackage* ChildPackage = CreatePackage(TEXT("/Temp/SLFGraphTest/BP_GraphChild"));
+	UBlueprint* ParentBP = FKismetEditorUtilities::CreateBlueprint(AActor::StaticClass(), ParentPackage, TEXT("BP_GraphParent"),
+		BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+	UBlueprint* ChildBP = ParentBP ? FKismetEditorUtilities::CreateBlueprint(ParentBP->GeneratedClass, ChildPackage, TEXT("BP_GraphChild"),
+		BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass()) : nullptr;
+	if (TestNotNull(TEXT("Child Blueprint created"), ChildBP))
+	{
+		const TArray<UBlueprint*> Children = UPythonBridge::GetChildBlueprints(ParentBP->GeneratedClass);
+		TestTrue(TEXT("Unsaved child found"), Children.Contains(ChildBP));
+		TestTrue(TEXT("Parent counts as its own child, as in the class index"), Children.Contains(ParentBP));
+		TestEqual(TEXT("No duplicates"), Children.Num(), 2);
+	}
+	for (UBlueprint* TempBP : { ChildBP, ParentBP })
+	{
+		if (TempBP)
+		{
+			TempBP->MarkAsGarbage();
+		}
+	}
+
+	// Registry parity on real project packages
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetData> Blueprints;
+	AssetRegistry.GetAssetsByPath(TEXT("/Game/SoulslikeFramework"), Blueprints, true);
+	if (Blueprints.Num() == 0)
+	{
+		AddWarning(TEXT("No assets under /Game/SoulslikeFramework - skipping registry parity"));
+		return true;
+	}
+
+	FSLFAssetDependencyGraph& Shared = FSLFAssetDependencyGraph::Get();
+	for (int32 Index = 0; Index < Blueprints.Num(); Index += FMath::Max(1, Blueprints.Num() / 16))
+	{
+		const FName PackageName = Blueprints[Index].PackageName;
+		TArray<FName> Expected;
+		AssetRegistry.GetDependencies(PackageName, Expected, UE::AssetRegistry::EDependencyCategory::Package);
+		Expected.Remove(PackageName);
+		SameSet(*FString::Printf(TEXT("%s dependencies match registry"), *PackageName.ToString()),
+			Shared.GetDependencies(PackageName), Expected);
+	}
+
+	return true;
+}
+
+// ============================================================================
+// TEST: Line diff - an inserted line reports only itself, Myers is minimal
+// against a brute-force LCS, patience reconstructs, large inputs stay cheap
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFLineDiffTest, "SLF.Pipeline.LineDiff",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFLineDiffTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Line diff engine on synthetic inputs"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	// Applying the runs to Old must give New; returns inserted + deleted line count (or -1)
+	auto ApplyRuns = [](const TArray<int32>& Old, const TArray<int32>& New, const TArray<FSLFDiffRun>& Runs)
+	{
+		TArray<int32> Rebuilt;
+		int32 OldIndex = 0;
+		int32 NewIndex = 0;
+		int32 Edits = 0;
+		for (const FSLFDiffRun& Run : Runs)
+		{
+			if (Run.Count <= 0 || Run.OldStart != OldIndex || Run.NewStart != NewIndex)
+			{
+				return -1;
+			}
+			for (int32 Line = 0; Line < Run.Count; ++Line)
+			{
+				if (Run.Op == ESLFDiffOp::Equal)
+				{
+					if (Old[OldIndex + Line] != New[NewIndex + Line])
+					{
+						return -1;
+					}
+					Rebuilt.Add(Old[OldIndex + Line]);
+				}
+				else if (Run.Op == ESLFDiffOp::Insert)
+				{
+					Rebuilt.Add(New[NewIndex + Line]);
+				}
+			}
+			OldIndex += Run.Op == ESLFDiffOp::Insert ? 0 : Run.Count;
+			NewIndex += Run.Op == ESLFDiffOp::Delete ? 0 : Run.Count;
+			Edits += Run.Op == ESLFDiffOp::Equal ? 0 : Run.Count;
+		}
+		return (Rebuilt == New && OldIndex == Old.Num()) ? Edits : -1;
+	};
+
+	auto LCSLength = [](const TArray<int32>& A, const TArray<int32>& B)
+	{
+		TArray<int32> Row;
+		Row.SetNumZeroed(B.Num() + 1);
+		for (int32 I = 1; I <= A.Num(); ++I)
+		{
+			int32 Diagonal = 0;
+			for (int32 J = 1; J <= B.Num(); ++J)
+			{
+				const int32 Above = Row[J];
+				Row[J] = A[I - 1] == B[J - 1] ? Diagonal + 1 : FMath::Max(Row[J], Row[J - 1]);
+				Diagonal = Above;
+			}
+		}
+		return Row[B.Num()];
+	};
+
+	// ========================================================================
+	// TEST: Single inserted property
+	// ========================================================================
+	TArray<FString> OldText, NewText;
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		OldText.Add(FString::Printf(TEXT("  Property_%d: %d"), Index, Index * 3));
+	}
+	NewText = OldText;
+	NewText.Insert(TEXT("  InsertedProperty: true"), 50);
+
+	TArray<FStringView> OldLines(OldText), NewLines(NewText);
+	TArray<int32> OldIds, NewIds;
+	FSLFDiffEngine::InternLines(OldLines, NewLines, OldIds, NewIds);
+	TestEqual(TEXT("Shared lines share ids"), OldIds[60], NewIds[61]);
+
+	for (const ESLFDiffAlgorithm Algorithm : { ESLFDiffAlgorithm::Myers, ESLFDiffAlgorithm::Patience })
+	{
+		const TArray<FSLFDiffRun> Runs = FSLFDiffEngine::Diff(OldIds, NewIds, Algorithm);
+		TestEqual(TEXT("Insert splits one equal run"), Runs.Num(), 3);
+		TestEqual(TEXT("Only the inserted line differs"), ApplyRuns(OldIds, NewIds, Runs), 1);
+	}
+
+	TArray<uint8> ReportBytes;
+	FMemoryWriter ReportWriter(ReportBytes);
+	const FSLFDiffStats Stats = FSLFDiffEngine::WriteLineDiff(OldLines, NewLines, ReportWriter, 3);
+	TestEqual(TEXT("One line added"), Stats.Added, 1);
+	TestEqual(TEXT("Nothing removed"), Stats.Removed, 0);
+	TestEqual(TEXT("One hunk"), Stats.Hunks, 1);
+	const FString Report(FUTF8ToTCHAR(reinterpret_cast<const UTF8CHAR*>(ReportBytes.GetData()), ReportBytes.Num()));
+	TestTrue(TEXT("Hunk header"), Report.StartsWith(TEXT("@@ -48,6 +48,7 @@\n")));
+	TestTrue(TEXT("Added line marked"), Report.Contains(TEXT("\n+  InsertedProperty: true\n"), ESearchCase::CaseSensitive));
+
+	// Case differences are real differences
+	TArray<int32> CaseOld, CaseNew;
+	FSLFDiffEngine::InternLines(TArray<FStringView>{ FStringView(TEXT("Name")) }, TArray<FStringView>{ FStringView(TEXT("name")) }, CaseOld, CaseNew);
+	TestNotEqual(TEXT("Interning is case-sensitive"), CaseOld[0], CaseNew[0]);
+
+	TestEqual(TEXT("Empty inputs give no runs"), FSLFDiffEngine::Diff(TArray<int32>(), TArray<int32>()).Num(), 0);
+
+	// ========================================================================
+	// TEST: Random sequences - Myers minimal, both algorithms reconstruct New
+	// ========================================================================
+	FRandomStream Random(0x5EED);
+	int32 NonMinimal = 0;
+	int32 Broken = 0;
+	for (int32 Case = 0; Case < 500; ++Case)
+	{
+		TArray<int32> Old, New;
+		const int32 Alphabet = Random.RandRange(1, 6);
+		for (int32 Index = Random.RandRange(0, 30); Index > 0; --Index)
+		{
+			Old.Add(Random.RandRange(0, Alphabet - 1));
+		}
+		for (int32 Index = Random.RandRange(0, 30); Index > 0; --Index)
+		{
+			New.Add(Random.RandRange(0, Alphabet - 1));
+		}
+
+		const int32 MyersEdits = ApplyRuns(Old, New, FSLFDiffEngine::Diff(Old, New, ESLFDiffAlgorithm::Myers));
+		const int32 PatienceEdits = ApplyRuns(Old, New, FSLFDiffEngine::Diff(Old, New, ESLFDiffAlgorithm::Patience));
+		Broken += (MyersEdits < 0 || PatienceEdits < 0) ? 1 : 0;
+		NonMinimal += MyersEdits != Old.Num() + New.Num() - 2 * LCSLength(Old, New) ? 1 : 0;
+	}
+	TestEqual(TEXT("Every edit script rebuilds New"), Broken, 0);
+	TestEqual(TEXT("Myers edit scripts are minimal"), NonMinimal, 0);
+
+	// ========================================================================
+	// TEST: Large input with a few scattered edits
+	// ========================================================================
+	TArray<int32> LargeOld, LargeNew;
+	for (int32 Index = 0; Index < 200000; ++Index)
+	{
+		LargeOld.Add(Index % 5000);
+	}
+	LargeNew = LargeOld;
+	for (int32 Edit = 0; Edit < 10; ++Edit)
+	{
+		LargeNew.Insert(1000000 + Edit, Edit * 15000 + 7);
+		LargeNew.RemoveAt(Edit * 15000 + 5000);
+	}
+
+	for (const ESLFDiffAlgorithm Algorithm : { ESLFDiffAlgorithm::Myers, ESLFDiffAlgorithm::Patience })
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		const int32 Edits = ApplyRuns(LargeOld, LargeNew, FSLFDiffEngine::Diff(LargeOld, LargeNew, Algorithm));
+		AddInfo(FString::Printf(TEXT("%s: 200k lines, %d edits in %.1f ms"),
+			Algorithm == ESLFDiffAlgorithm::Myers ? TEXT("Myers") : TEXT("Patience"), Edits, (FPlatformTime::Seconds() - StartTime) * 1000.0));
+		TestEqual(TEXT("Large diff finds the 20 edits"), Edits, 20);
+	}
+
+	// ========================================================================
+	// TEST: CompareExports end to end
+	// ========================================================================
+	const FString Folder = FPaths::AutomationTransientDir() / TEXT("SLFLineDiff");
+	const FString File1 = Folder / TEXT("Before.txt");
+	const FString File2 = Folder / TEXT("After.txt");
+	const FString DiffFile = Folder / TEXT("Diff.txt");
+	FFileHelper::SaveStringArrayToFile(OldText, *File1);
+	FFileHelper::SaveStringArrayToFile(NewText, *File2);
+
+	TestTrue(TEXT("CompareExports succeeds"), USLFAssetValidator::CompareExports(File1, File2, DiffFile));
+	FString DiffText;
+	FFileHelper::LoadFileToString(DiffText, *DiffFile);
+	TestTrue(TEXT("Report lists the insertion"), DiffText.Contains(TEXT("+  InsertedProperty: true"), ESearchCase::CaseSensitive));
+	TestTrue(TEXT("Report counts one difference"), DiffText.Contains(TEXT("Total differences: 1"), ESearchCase::CaseSensitive));
+	TestFalse(TEXT("Shifted lines are not reported"), DiffText.Contains(TEXT("-  Property_60"), ESearchCase::CaseSensitive));
+
+	IFileManager::Get().DeleteDirectory(*Folder, false, true);
+	return true;
+}
+
+// ============================================================================
+// TEST: Structural JSON diff - array elements keyed by NodeGuid / GraphName /
+// PinName, reordering is not a change, DiffBlueprintStates streams to disk
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFStructuralDiffTest, "SLF.Pipeline.StructuralDiff",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFStructuralDiffTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Structural diff of Blueprint state exports"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	const FString BeforeJson = TEXT(
+		"{\"BlueprintName\": \"B_Test\", \"Graphs\": [{\"GraphName\": \"EventGraph\", \"Nodes\": ["
+		"{\"NodeGuid\": \"G1\", \"NodeName\": \"K2Node_Event_0\", \"Pins\": [{\"PinName\": \"then\", \"LinkedTo\": [\"K2Node_CallFunction_0.execute\"]}]},"
+		"{\"NodeGuid\": \"G2\", \"NodeName\": \"K2Node_CallFunction_0\", \"Pins\": [{\"PinName\": \"execute\", \"LinkedTo\": []}, {\"PinName\": \"Damage\", \"DefaultValue\": \"1\"}]}"
+		"]}], \"Tags\": [{\"Value\": 1}, {\"Value\": 1}]}");
+
+	// Nodes swapped, one default changed, one node added
+	const FString AfterJson = TEXT(
+		"{\"BlueprintName\": \"B_Test\", \"Graphs\": [{\"GraphName\": \"EventGraph\", \"Nodes\": ["
+		"{\"NodeGuid\": \"G2\", \"NodeName\": \"K2Node_CallFunction_0\", \"Pins\": [{\"PinName\": \"Damage\", \"DefaultValue\": \"2\"}, {\"PinName\": \"execute\", \"LinkedTo\": []}]},"
+		"{\"NodeGuid\": \"G1\", \"NodeName\": \"K2Node_Event_0\", \"Pins\": [{\"PinName\": \"then\", \"LinkedTo\": [\"K2Node_CallFunction_0.execute\"]}]},"
+		"{\"NodeGuid\": \"G3\", \"NodeName\": \"K2Node_VariableGet_0\", \"Pins\": []}"
+		"]}], \"Tags\": [{\"Value\": 1}, {\"Value\": 2}]}");
+
+	TSharedPtr<FJsonObject> Before, After;
+	TestTrue(TEXT("Before parses"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BeforeJson), Before) && Before.IsValid());
+	TestTrue(TEXT("After parses"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(AfterJson), After) && After.IsValid());
+	if (!Before.IsValid() || !After.IsValid())
+	{
+		return false;
+	}
+
+	TArray<TPair<FString, FString>> Flat;
+	FSLFDiffEngine::FlattenJson(*Before, Flat);
+	const TPair<FString, FString>* LinkedTo = Flat.FindByPredicate([](const TPair<FString, FString>& Entry)
+	{
+		return Entry.Key == TEXT("Graphs[EventGraph].Nodes[G1].Pins[then].LinkedTo");
+	});
+	TestTrue(TEXT("Keyed path for pin links"), LinkedTo != nullptr);
+	TestEqual(TEXT("Scalar arrays flatten to one value"), LinkedTo ? LinkedTo->Value : FString(), FString(TEXT("[\"K2Node_CallFunction_0.execute\"]")));
+
+	TArray<FSLFStructuralChange> Changes;
+	FSLFDiffEngine::DiffJson(*Before, *After, Changes);
+
+	int32 Added = 0, Removed = 0, Changed = 0;
+	for (const FSLFStructuralChange& Change : Changes)
+	{
+		AddInfo(FString::Printf(TEXT("  %d %s: %s -> %s"), (int32)Change.Op, *Change.Path, *Change.OldValue, *Change.NewValue));
+		Added += Change.Op == ESLFDiffOp::Insert ? 1 : 0;
+		Removed += Change.Op == ESLFDiffOp::Delete ? 1 : 0;
+		Changed += Change.Op == ESLFDiffOp::Changed ? 1 : 0;
+		TestTrue(TEXT("Unchanged values are not reported"), Change.Op != ESLFDiffOp::Equal);
+		if (Change.Op == ESLFDiffOp::Insert)
+		{
+			TestTrue(TEXT("Additions belong to the new node"), Change.Path.StartsWith(TEXT("Graphs[EventGraph].Nodes[G3]")));
+		}
+	}
+	TestEqual(TEXT("Reordering removes nothing"), Removed, 0);
+	TestEqual(TEXT("Two values changed (pin default, unkeyed tag)"), Changed, 2);
+	TestTrue(TEXT("New node reported"), Added > 0);
+	TestTrue(TEXT("Pin default change keyed by GUID and pin name"), Changes.ContainsByPredicate([](const FSLFStructuralChange& Change)
+	{
+		return Change.Path == TEXT("Graphs[EventGraph].Nodes[G2].Pins[Damage].DefaultValue")
+			&& Change.OldValue == TEXT("\"1\"") && Change.NewValue == TEXT("\"2\"");
+	}));
+	TestTrue(TEXT("Elements without a unique key fall back to indices"), Changes.ContainsByPredicate([](const FSLFStructuralChange& Change)
+	{
+		return Change.Path == TEXT("Tags[1].Value");
+	}));
+
+	// ========================================================================
+	// TEST: DiffBlueprintStates streams the structural report, falls back to lines
+	// ========================================================================
+	const FString Folder = FPaths::AutomationTransientDir() / TEXT("SLFStructuralDiff");
+	const FString BeforeFile = Folder / TEXT("Before.json");
+	const FString AfterFile = Folder / TEXT("After.json");
+	const FString BrokenFile = Folder / TEXT("Broken.json");
+	const FString ReportFile = Folder / TEXT("Diff.txt");
+	FFileHelper::SaveStringToFile(BeforeJson, *BeforeFile);
+	FFileHelper::SaveStringToFile(AfterJson, *AfterFile);
+	FFileHelper::SaveStringToFile(TEXT("{\n  \"Nodes\": [\n,\n  ]\n}\n"), *BrokenFile);
+
+	const FString Summary = USLFAutomationLibrary::DiffBlueprintStates(BeforeFile, AfterFile, ReportFile);
+	TestTrue(TEXT("Summary returned"), Summary.Contains(TEXT("Changed: 2")));
+	FString ReportText;
+	FFileHelper::LoadFileToString(ReportText, *ReportFile);
+	TestTrue(TEXT("Report written by path"), ReportText.Contains(TEXT("~ Graphs[EventGraph].Nodes[G2].Pins[Damage].DefaultValue: \"1\" -> \"2\""), ESearchCase::CaseSensitive));
+
+	const FString Fallback = USLFAutomationLibrary::DiffBlueprintStates(BrokenFile, AfterFile);
+	TestTrue(TEXT("Unparsable export uses the line diff"), Fallback.Contains(TEXT("=== CHANGES (by line) ===")));
+
+	IFileManager::Get().DeleteDirectory(*Folder, false, true);
+	return true;
+}
+
+// ============================================================================
+// TEST: Animation frame dump - binary round trip is exact, damaged files are
+// rejected, the JSON converter keeps the DumpAnimAllFrames layout
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFAnimFrameDumpTest, "SLF.Pipeline.AnimFrameDump",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFAnimFrameDumpTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Binary animation frame dump"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	const FString Folder = FPaths::AutomationTransientDir() / TEXT("SLFAnimFrameDump");
+	const FString DumpFile = Folder / TEXT("Walk.slfanim");
+	const FString DamagedFile = Folder / TEXT("Damaged.slfanim");
+	const FString JsonFile = Folder / TEXT("Walk.json");
+
+	FSLFAnimFrameDump Dump;
+	Dump.AnimationPath = TEXT("/Game/Test/A_Walk.A_Walk");
+	Dump.SkeletonPath = TEXT("/Game/Test/SK_Test.SK_Test");
+	Dump.Duration = 1.0;
+	Dump.FrameRate = FFrameRate(30, 1);
+	Dump.BoneNames = { FName(TEXT("root")), FName(TEXT("pelvis")), FName(TEXT("spine_01")) };
+	Dump.ParentIndices = { INDEX_NONE, 0, 1 };
+	Dump.RefPose = { FTransform::Identity, FTransform(FVector(0.0, 0.0, 95.0)), FTransform(FVector(0.0, 0.0, 12.0)) };
+	Dump.TrackNames = { FName(TEXT("pelvis")), FName(TEXT("spine_01")) };
+	Dump.Reset(31);
+
+	// ========================================================================
+	// TEST: Reset fills identity, SetTransform writes columns
+	// ========================================================================
+	TestTrue(TEXT("Reset samples are identity"), Dump.GetTransform(1, 30).Equals(FTransform::Identity, 0.0));
+
+	FRandomStream Random(45);
+	for (int32 Track = 0; Track < Dump.TrackNames.Num(); ++Track)
+	{
+		for (int32 Frame = 0; Frame < Dump.GetNumFrames(); ++Frame)
+		{
+			const FQuat Rotation = FQuat(FRotator(Random.FRandRange(-90.0, 90.0), Random.FRandRange(-180.0, 180.0), Random.FRandRange(-180.0, 180.0)));
+			Dump.SetTransform(Track, Frame, FTransform(Rotation, Random.GetUnitVector() * 50.0, FVector(1.0, 1.0, 1.0 + Frame * 0.01)));
+		}
+	}
+	const TConstArrayView<float> ScaleZ = Dump.GetChannel(0, ESLFAnimChannel::ScaleZ);
+	TestEqual(TEXT("Channel spans every frame"), ScaleZ.Num(), 31);
+	TestEqual(TEXT("Channel is contiguous per frame"), ScaleZ[10], 1.1f);
+	TestEqual(TEXT("FindTrack"), Dump.FindTrack(TEXT("spine_01")), 1);
+	TestEqual(TEXT("FindTrack misses untracked bones"), Dump.FindTrack(TEXT("root")), INDEX_NONE);
+
+	// ========================================================================
+	// TEST: Save / Load round trip is bit exact
+	// ========================================================================
+	TestTrue(TEXT("Saved"), Dump.Save(DumpFile));
+
+	FSLFAnimFrameDump Loaded;
+	FString LoadError;
+	TestTrue(TEXT("Loaded"), Loaded.Load(DumpFile, &LoadError));
+	TestEqual(TEXT("Animation path"), Loaded.AnimationPath, Dump.AnimationPath);
+	TestEqual(TEXT("Skeleton path"), Loaded.SkeletonPath, Dump.SkeletonPath);
+	TestTrue(TEXT("Frame rate"), Loaded.FrameRate == Dump.FrameRate);
+	TestEqual(TEXT("Frame count"), Loaded.GetNumFrames(), Dump.GetNumFrames());
+	TestTrue(TEXT("Bone names"), Loaded.BoneNames == Dump.BoneNames);
+	TestTrue(TEXT("Parents"), Loaded.ParentIndices == Dump.ParentIndices);
+	TestTrue(TEXT("Track names"), Loaded.TrackNames == Dump.TrackNames);
+	TestTrue(TEXT("Ref pose"), Loaded.RefPose.Num() == 3 && Loaded.RefPose[1].Equals(Dump.RefPose[1], 0.0));
+
+	bool bSamplesEqual = Loaded.TrackNames.Num() == Dump.TrackNames.Num();
+	for (int32 Track = 0; bSamplesEqual && Track < Dump.TrackNames.Num(); ++Track)
+	{
+		for (int32 Channel = 0; bSamplesEqual && Channel < FSLFAnimFrameDump::NumChannels; ++Channel)
+		{
+			const TConstArrayView<float> Expected = Dump.GetChannel(Track, (ESLFAnimChannel)Channel);
+			const TConstArrayView<float> Actual = Loaded.GetChannel(Track, (ESLFAnimChannel)Channel);
+			bSamplesEqual = FMemory::Memcmp(Expected.GetData(), Actual.GetData(), Expected.Num() * sizeof(float)) == 0;
+		}
+	}
+	TestTrue(TEXT("Samples bit exact"), bSamplesEqual);
+
+	// ========================================================================
+	// TEST: Truncated and foreign files are rejected
+	// ========================================================================
+	TArray<uint8> Bytes;
+	FFileHelper::LoadFileToArray(Bytes, *DumpFile);
+	TArray<uint8> Truncated(Bytes.GetData(), Bytes.Num() - 64);
+	FFileHelper::SaveArrayToFile(Truncated, *DamagedFile);
+	TestFalse(TEXT("Truncated sample block rejected"), Loaded.Load(DamagedFile, &LoadError));
+	TestEqual(TEXT("Rejected dump left empty"), Loaded.TrackNames.Num(), 0);
+
+	Bytes[0] ^= 0xFF;
+	FFileHelper::SaveArrayToFile(Bytes, *DamagedFile);
+	TestFalse(TEXT("Bad magic rejected"), Loaded.Load(DamagedFile, &LoadError));
+	TestFalse(TEXT("Missing file rejected"), Loaded.Load(Folder / TEXT("Missing.slfanim"), &LoadError));
+
+	// ========================================================================
+	// TEST: JSON converter keeps the DumpAnimAllFrames layout
+	// ========================================================================
+	const FString ConvertSummary = USLFAutomationLibrary::ConvertAnimFrameDumpToJson(DumpFile, JsonFile);
+	TestTrue(TEXT("Converted"), ConvertSummary.StartsWith(TEXT("SUCCESS")));
+
+	FString JsonText;
+	FFileHelper::LoadFileToString(JsonText, *JsonFile);
+	TSharedPtr<FJsonObject> Json;
+	TestTrue(TEXT("JSON parses"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonText), Json) && Json.IsValid());
+	if (Json.IsValid())
+	{
+		TestEqual(TEXT("frame_count"), (int32)Json->GetNumberField(TEXT("frame_count")), 31);
+		TestEqual(TEXT("bone_count"), (int32)Json->GetNumberField(TEXT("bone_count")), 3);
+		const TArray<TSharedPtr<FJsonValue>>& Frames = Json->GetArrayField(TEXT("frames"));
+		TestEqual(TEXT("One entry per frame"), Frames.Num(), 31);
+		if (Frames.Num() == 31)
+		{
+			const TSharedPtr<FJsonObject> Spine = Frames[10]->AsObject()->GetObjectField(TEXT("bones"))->GetObjectField(TEXT("spine_01"));
+			const TArray<TSharedPtr<FJsonValue>>& Pos = Spine->GetArrayField(TEXT("pos"));
+			TestTrue(TEXT("Sample values written"), Pos.Num() == 3
+				&& FMath::IsNearlyEqual(Pos[0]->AsNumber(), Dump.GetTransform(1, 10).GetTranslation().X, 1e-6));
+		}
+	}
+
+	// ========================================================================
+	// TEST: Sampling a real AnimSequence (skipped when the project has none)
+	// ========================================================================
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	TArray<FAssetData> Anims;
+	AssetRegistryModule.Get().GetAssetsByClass(UAnimSequence::StaticClass()->GetClassPathName(), Anims);
+	if (Anims.Num() > 0)
+	{
+		const FString AnimPath = Anims[0].GetObjectPathString();
+		const FString Summary = USLFAutomationLibrary::DumpAnimAllFramesBinary(AnimPath, DumpFile);
+		TestTrue(FString::Printf(TEXT("Dumped %s"), *AnimPath), Summary.StartsWith(TEXT("SUCCESS")));
+
+		FSLFAnimFrameDump Sampled;
+		TestTrue(TEXT("Sampled dump loads"), Sampled.Load(DumpFile, &LoadError));
+		TestTrue(TEXT("Sampled dump has frames"), Sampled.GetNumFrames() > 0 && Sampled.BoneNames.Num() > 0);
+
+		// Sample() must agree with serial per-frame evaluation of the data model
+		UAnimSequence* Anim = Cast<UAnimSequence>(Anims[0].GetAsset());
+		const IAnimationDataModel* DataModel = Anim ? Anim->GetDataModel() : nullptr;
+		FSLFAnimFrameDump Direct;
+		FString SampleError;
+		if (DataModel && TestTrue(TEXT("Sample succeeds"), Direct.Sample(*Anim, SampleError)))
+		{
+			int32 Mismatches = 0;
+			for (int32 Track = 0; Track < Direct.TrackNames.Num(); ++Track)
+			{
+				for (int32 Frame = 0; Frame < Direct.GetNumFrames(); ++Frame)
+				{
+					const FTransform Expected = DataModel->GetBoneTrackTransform(Direct.TrackNames[Track], FFrameNumber(Frame));
+					const FTransform Actual = Direct.GetTransform(Track, Frame);
+					if (!Actual.GetTranslation().Equals(Expected.GetTranslation(), 1e-2)
+						|| !Actual.GetRotation().Equals(Expected.GetRotation(), 1e-5)
+						|| !Actual.GetScale3D().Equals(Expected.GetScale3D(), 1e-5))
+					{
+						++Mismatches;
+					}
+				}
+			}
+			TestEqual(TEXT("Sample matches serial GetBoneTrackTransform"), Mismatches, 0);
+		}
+	}
+	else
+	{
+		AddWarning(TEXT("No AnimSequence in the asset registry; skipped sampling test"));
+	}
+
+	IFileManager::Get().DeleteDirectory(*Folder, false, true);
+	return true;
+}
+
+// ============================================================================
+// TEST: Animation comparison - identical dumps give zero error, known
+// perturbations are measured per bone and per frame, bone mapping and
+// common frame rate resampling
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFAnimComparisonTest, "SLF.Pipeline.AnimComparison",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFAnimComparisonTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Numeric animation comparison"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	// Synthetic walk: pelvis bobs and translates, spine twists; frame F at time F / Rate
+	auto MakeDump = [](int32 Rate, FName PelvisName)
+	{
+		FSLFAnimFrameDump Dump;
+		Dump.FrameRate = FFrameRate(Rate, 1);
+		Dump.Duration = 1.0;
+		Dump.BoneNames = { FName(TEXT("root")), PelvisName, FName(TEXT("spine_01")) };
+		Dump.ParentIndices = { INDEX_NONE, 0, 1 };
+		Dump.RefPose = { FTransform::Identity, FTransform(FVector(0.0, 0.0, 95.0)), FTransform(FVector(0.0, 0.0, 12.0)) };
+		Dump.TrackNames = { PelvisName, FName(TEXT("spine_01")) };
+		Dump.Reset(Rate + 1);
+		for (int32 Frame = 0; Frame <= Rate; ++Frame)
+		{
+			const double Time = (double)Frame / Rate;
+			Dump.SetTransform(0, Frame, FTransform(FVector(Time * 30.0, 0.0, 95.0)));
+			Dump.SetTransform(1, Frame, FTransform(FQuat(FVector::UpVector, FMath::DegreesToRadians(20.0 * Time)), FVector(0.0, 0.0, 12.0)));
+		}
+		return Dump;
+	};
+
+	const FSLFAnimFrameDump Source = MakeDump(30, TEXT("pelvis"));
+	FSLFAnimCompareOptions Options;
+	FSLFAnimComparisonResult Result;
+	FString Error;
+
+	// ========================================================================
+	// TEST: Identical sequences
+	// ========================================================================
+	TestTrue(TEXT("Identical compared"), FSLFAnimComparison::Compare(Source, Source, Options, Result, Error));
+	TestEqual(TEXT("Common frames"), Result.NumFrames, 31);
+	TestEqual(TEXT("Both animated bones paired"), Result.Bones.Num(), 2);
+	TestEqual(TEXT("One entry per frame"), Result.Frames.Num(), 31);
+	TestEqual(TEXT("Identical max position error"), Result.Overall.MaxPosition, 0.0f);
+	TestEqual(TEXT("Identical max rotation error"), Result.Overall.MaxRotationDegrees, 0.0f);
+	TestTrue(TEXT("Identical is within zero tolerance"), Result.IsWithin(0.0f, 0.0f));
+
+	// ========================================================================
+	// TEST: Perturbed sequence, paired through the bone name mapping
+	// ========================================================================
+	FSLFAnimFrameDump Perturbed = MakeDump(30, TEXT("Hips"));
+	for (int32 Frame = 0; Frame < Perturbed.GetNumFrames(); ++Frame)
+	{
+		FTransform Pelvis = Perturbed.GetTransform(0, Frame);
+		Pelvis.AddToTranslation(FVector(0.0, 2.0, 0.0));
+		Perturbed.SetTransform(0, Frame, Pelvis);
+	}
+	FTransform Spine = Perturbed.GetTransform(1, 10);
+	Spine.SetRotation(FQuat(FVector::ForwardVector, FMath::DegreesToRadians(5.0)) * Spine.GetRotation());
+	Perturbed.SetTransform(1, 10, Spine);
+
+	TestTrue(TEXT("Unmapped compared"), FSLFAnimComparison::Compare(Source, Perturbed, Options, Result, Error));
+	TestTrue(TEXT("Renamed bone unmatched on B"), Result.UnmatchedB.Contains(FName(TEXT("Hips"))));
+	TestTrue(TEXT("Renamed bone unmatched on A"), Result.UnmatchedA.Contains(FName(TEXT("pelvis"))));
+
+	Options.BoneNameMapping.Add(TEXT("Hips"), TEXT("pelvis"));
+	TestTrue(TEXT("Mapped compared"), FSLFAnimComparison::Compare(Source, Perturbed, Options, Result, Error));
+	TestEqual(TEXT("Mapping pairs every animated bone"), Result.UnmatchedB.Num() + Result.UnmatchedA.Num(), 0);
+	if (Result.Bones.Num() == 2)
+	{
+		const FSLFBoneErrorStats& Hips = Result.Bones[0];
+		const FSLFBoneErrorStats& SpineStats = Result.Bones[1];
+		TestEqual(TEXT("Bones listed in B order"), Hips.BoneB, FName(TEXT("Hips")));
+		TestEqual(TEXT("Mapped to the source bone"), Hips.BoneA, FName(TEXT("pelvis")));
+		TestEqual(TEXT("Constant offset: max"), Hips.MaxPosition, 2.0f, 1e-3f);
+		TestEqual(TEXT("Constant offset: RMS"), Hips.RmsPosition, 2.0f, 1e-3f);
+		TestEqual(TEXT("Offset bone keeps its rotation"), Hips.MaxRotationDegrees, 0.0f, 1e-2f);
+		TestEqual(TEXT("Single-frame twist: max degrees"), SpineStats.MaxRotationDegrees, 5.0f, 1e-2f);
+		TestEqual(TEXT("Single-frame twist: RMS degrees"), SpineStats.RmsRotationDegrees, 5.0f / FMath::Sqrt(31.0f), 1e-2f);
+		TestEqual(TEXT("Single-frame twist: worst frame"), SpineStats.WorstFrame, 10);
+	}
+	TestEqual(TEXT("Per-frame rotation error at the twist"), Result.Frames[10].MaxRotationDegrees, 5.0f, 1e-2f);
+	TestEqual(TEXT("Per-frame rotation error elsewhere"), Result.Frames[11].MaxRotationDegrees, 0.0f, 1e-2f);
+	TestEqual(TEXT("Per-frame position error"), Result.Frames[0].MaxPosition, 2.0f, 1e-3f);
+	TestEqual(TEXT("Overall max rotation"), Result.Overall.MaxRotationDegrees, 5.0f, 1e-2f);
+	TestFalse(TEXT("Perturbation exceeds tolerance"), Result.IsWithin(0.5f, 1.0f));
+	TestTrue(TEXT("Summary lists the twisted bone"), Result.ToSummary(1).Contains(TEXT("spine_01 -> spine_01")));
+
+	// ========================================================================
+	// TEST: Different frame rates are resampled to a common rate
+	// ========================================================================
+	const FSLFAnimFrameDump Source60 = MakeDump(60, TEXT("pelvis"));
+	Options.BoneNameMapping.Reset();
+	TestTrue(TEXT("30 vs 60 fps compared"), FSLFAnimComparison::Compare(Source, Source60, Options, Result, Error));
+	TestEqual(TEXT("Sampled at the higher rate"), Result.NumFrames, 61);
+	TestEqual(TEXT("Linear motion survives resampling (position)"), Result.Overall.MaxPosition, 0.0f, 1e-3f);
+	TestEqual(TEXT("Linear motion survives resampling (rotation)"), Result.Overall.MaxRotationDegrees, 0.0f, 5e-2f);
+
+	// ========================================================================
+	// TEST: CSV reports
+	// ========================================================================
+	const FString Folder = FPaths::AutomationTransientDir() / TEXT("SLFAnimComparison");
+	TestTrue(TEXT("Bone CSV written"), FSLFAnimComparison::SaveBoneCsv(Result, Folder / TEXT("Bones.csv")));
+	TestTrue(TEXT("Frame CSV written"), FSLFAnimComparison::SaveFrameCsv(Result, Folder / TEXT("Frames.csv")));
+	FString CsvText;
+	FFileHelper::LoadFileToString(CsvText, *(Folder / TEXT("Frames.csv")));
+	TArray<FString> CsvLines;
+	CsvText.ParseIntoArrayLines(CsvLines);
+	TestEqual(TEXT("Frame CSV has a header and one row per frame"), CsvLines.Num(), 62);
+
+	FSLFAnimFrameDump Empty;
+	TestFalse(TEXT("Empty dump rejected"), FSLFAnimComparison::Compare(Source, Empty, Options, Result, Error));
+
+	IFileManager::Get().DeleteDirectory(*Folder, false, true);
+	return true;
+}
+
+// ============================================================================
+// TEST: Batch bake - same keys as a single bake for the same seed,
+// different seeds give different variants
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFAnimBakeBatchTest, "SLF.Pipeline.AnimBakeBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFAnimBakeBatchTest::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT(""));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("   TEST: Batch animation bake determinism"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	TArray<FAssetData> Anims;
+	AssetRegistryModule.Get().GetAssetsByClass(UAnimSequence::StaticClass()->GetClassPathName(), Anims);
+	if (Anims.Num() == 0)
+	{
+		AddWarning(TEXT("No AnimSequence in the asset registry; skipped"));
+		return true;
+	}
+
+	const FString SourcePath = Anims[0].GetObjectPathString();
+	const FString OutputDir = TEXT("/Game/Temp/SLFAnimBakeBatchTest");
+	const TMap<FName, FName> NoMapping;
+	AddInfo(FString::Printf(TEXT("Source: %s"), *SourcePath));
+
+	const FString Single = USLFAutomationLibrary::BakeAnimWithBoneMapping(SourcePath, OutputDir, TEXT("A_Single"), TEXT(""), NoMapping,
+		2.0f, 0.15f, FVector(0.f, 10.f, 0.f), 24.0f, 1234);
+	TestTrue(TEXT("Single bake saved"), Single.Contains(TEXT("Save: SUCCESS")));
+
+	TArray<FSLFAnimBakeItem> Items;
+	Items.Add({ SourcePath, OutputDir, TEXT("A_Batch_1234"), 1234 });
+	Items.Add({ SourcePath, OutputDir, TEXT("A_Batch_99"), 99 });
+	Items.Add({ TEXT("/Game/Missing/A_Missing.A_Missing"), OutputDir, TEXT("A_Missing"), 5 });
+	const FString Batch = USLFAutomationLibrary::BakeAnimationBatch(Items, TEXT(""), NoMapping,
+		2.0f, 0.15f, FVector(0.f, 10.f, 0.f), 24.0f, 2);
+	TestTrue(TEXT("Two of three baked"), Batch.Contains(TEXT("Baked 2/3 animations")));
+	TestTrue(TEXT("Per-animation timings reported"), Batch.Contains(TEXT("compute")) && Batch.Contains(TEXT("anims/sec")));
+	TestTrue(TEXT("Missing source reported"), Batch.Contains(TEXT("Source animation not found")));
+
+	auto Sample = [this](const FString& Path, FSLFAnimFrameDump& Dump)
+	{
+		UAnimSequence* Anim = LoadObject<UAnimSequence>(nullptr, *Path);
+		FString Error;
+		return TestTrue(FString::Printf(TEXT("Sampled %s"), *Path), Anim && Dump.Sample(*Anim, Error));
+	};
+
+	FSLFAnimFrameDump SingleDump;
+	FSLFAnimFrameDump SameSeedDump;
+	FSLFAnimFrameDump OtherSeedDump;
+	if (Sample(OutputDir / TEXT("A_Single.A_Single"), SingleDump)
+		&& Sample(OutputDir / TEXT("A_Batch_1234.A_Batch_1234"), SameSeedDump)
+		&& Sample(OutputDir / TEXT("A_Batch_99.A_Batch_99"), OtherSeedDump))
+	{
+		FSLFAnimComparisonResult Result;
+		FString Error;
+		TestTrue(TEXT("Same seed compared"), FSLFAnimComparison::Compare(SingleDump, SameSeedDump, FSLFAnimCompareOptions(), Result, Error));
+		TestTrue(TEXT("Same seed gives the same keys"), Result.IsWithin(0.0f, 0.0f));
+
+		TestTrue(TEXT("Other seed compared"), FSLFAnimComparison::Compare(SingleDump, OtherSeedDump, FSLFAnimCompareOptions(), Result, Error));
+		TestTrue(TEXT("Other seed gives another variant"), Result.Overall.MaxRotationDegrees > 0.0f);
+	}
+
+	UEditorAssetLibrary::DeleteDirectory(OutputDir);
+	return true;
+}
+
+// ============================================================================
+// TEST: Streaming retarget dump - same document as the FJsonObject DOM dump
+// it replaced, with names that need escaping
+// ============================================================================
+
+/** First difference between two parsed JSON values (numbers within Tolerance), empty if they match */
+static FString FindJsonMismatch(const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B, const FString& Path, double Tolerance)
+{
+	if (!A.IsValid() || !B.IsValid() || A->Type != B->Type)
+	{
+		return FString::Printf(TEXT("%s: type differs"), *Path);
+	}
+
+	switch (A->Type)
+	{
+	case EJson::Number:
+		return FMath::IsNearlyEqual(A->AsNumber(), B->AsNumber(), Tolerance)
+			? FString() : FString::Printf(TEXT("%s: %f vs %f"), *Path, A->AsNumber(), B->AsNumber());
+	case EJson::String:
+		return A->AsString() == B->AsString()
+			? FString() : FString::Printf(TEXT("%s: \"%s\" vs \"%s\""), *Path, *A->AsString(), *B->AsString());
+	case EJson::Array:
+	{
+		const TArray<TSharedPtr<FJsonValue>>& ArrayA = A->AsArray();
+		const TArray<TSharedPtr<FJsonValue>>& ArrayB = B->AsArray();
+		if (ArrayA.Num() != ArrayB.Num())
+		{
+			return FString::Printf(TEXT("%s: %d vs %d elements"), *Path, ArrayA.Num(), ArrayB.Num());
+		}
+		for (int32 Index = 0; Index < ArrayA.Num(); ++Index)
+		{
+			FString Mismatch = FindJsonMismatch(ArrayA[Index], ArrayB[Index], FString::Printf(TEXT("%s[%d]"), *Path, Index), Tolerance);
+			if (!Mismatch.IsEmpty())
+			{
+				return Mismatch;
+			}
+		}
+		return FString();
+	}
+	case EJson::Object:
+	{
+		const TMap<FString, TSharedPtr<FJsonValue>>& FieldsA = A->AsObject()->Values;
+		const TMap<FString, TSharedPtr<FJsonValue>>& FieldsB = B->AsObject()->Values;
+		if (FieldsA.Num() != FieldsB.Num())
+		{
+			return FString::Printf(TEXT("%s: %d vs %d fields"), *Path, FieldsA.Num(), FieldsB.Num());
+		}
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : FieldsA)
+		{
+			FString Mismatch = FindJsonMismatch(Field.Value, FieldsB.FindRef(Field.Key), Path + TEXT(".") + Field.Key, Tolerance);
+			if (!Mismatch.IsEmpty())
+			{
+				return Mismatch;
+			}
+		}
+		return FString();
+	}
+	default:
+		return FString();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFRetargetDumpWriterTest, "SLF.Pipeline.RetargetDumpWriter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFRetargetDumpWriterTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(48);
+	auto RandomTransform = [&Random]()
+	{
+		return FTransform(FQuat(Random.VRand(), Random.FRandRange(-PI, PI)), Random.VRand() * Random.FRandRange(0.0f, 100.0f),
+			FVector(Random.FRandRange(0.5f, 2.0f)));
+	};
+
+	FReferenceSkeleton RefSkel;
+	{
+		FReferenceSkeletonModifier Modifier(RefSkel, nullptr);
+		Modifier.Add(FMeshBoneInfo(TEXT("root"), TEXT("root"), INDEX_NONE), RandomTransform());
+		Modifier.Add(FMeshBoneInfo(TEXT("spine \"upper\""), TEXT("spine"), 0), RandomTransform());
+		Modifier.Add(FMeshBoneInfo(TEXT("hand\\l"), TEXT("hand_l"), 1), RandomTransform());
+	}
+	const int32 NumBones = RefSkel.GetRawBoneNum();
+
+	struct FDumpAnim
+	{
+		FString Name;
+		double Duration = 0.0;
+		int32 NumKeys = 0;
+		TArray<TArray<FVector>> PosKeys;
+		TArray<TArray<FQuat>> RotKeys;
+	};
+	TArray<FDumpAnim> Anims;
+	const TCHAR* Names[] = { TEXT("Attack \"Heavy\""), TEXT("Dir\\Name\twith tab") };
+	for (const TCHAR* Name : Names)
+	{
+		const int32 AnimIndex = Anims.Num();
+		FDumpAnim& Anim = Anims.AddDefaulted_GetRef();
+		Anim.Name = Name;
+		Anim.Duration = 1.5 + AnimIndex;
+		Anim.NumKeys = 3 + AnimIndex;
+		Anim.PosKeys.SetNum(NumBones);
+		Anim.RotKeys.SetNum(NumBones);
+		for (int32 Bone = 0; Bone < NumBones; ++Bone)
+		{
+			for (int32 Key = 0; Key < Anim.NumKeys; ++Key)
+			{
+				const FTransform Transform = RandomTransform();
+				Anim.PosKeys[Bone].Add(Transform.GetTranslation());
+				Anim.RotKeys[Bone].Add(Transform.GetRotation());
+			}
+		}
+	}
+
+	// Streamed
+	TArray<uint8> Bytes;
+	FSLFRetargetDumpWriter Writer;
+	TestTrue(TEXT("Writer opened"), Writer.Open(MakeUnique<FMemoryWriter>(Bytes), RefSkel));
+	for (const FDumpAnim& Anim : Anims)
+	{
+		Writer.AddAnimation(Anim.Name, Anim.Duration, Anim.NumKeys, Anim.PosKeys, Anim.RotKeys);
+	}
+	TestEqual(TEXT("Animations written"), Writer.Num(), Anims.Num());
+	TestTrue(TEXT("Writer closed"), Writer.Close());
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+	const FString Streamed(Converted.Length(), Converted.Get());
+
+	// DOM, built the way the old DumpRetargetedAnimsToJSON did
+	auto NumberArray = [](std::initializer_list<double> Values)
+	{
+		TArray<TSharedPtr<FJsonValue>> Array;
+		for (const double Value : Values)
+		{
+			Array.Add(MakeShared<FJsonValueNumber>(Value));
+		}
+		return Array;
+	};
+	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> BonesArray;
+	for (int32 i = 0; i < NumBones; i++)
+	{
+		const FTransform& RefLocal = RefSkel.GetRefBonePose()[i];
+		const FVector P = RefLocal.GetTranslation();
+		const FQuat R = RefLocal.GetRotation();
+		const FVector S = RefLocal.GetScale3D();
+		TSharedPtr<FJsonObject> BoneObj = MakeShared<FJsonObject>();
+		BoneObj->SetStringField(TEXT("name"), RefSkel.GetBoneName(i).ToString());
+		BoneObj->SetNumberField(TEXT("parent"), RefSkel.GetParentIndex(i));
+		BoneObj->SetArrayField(TEXT("pos"), NumberArray({ P.X, P.Y, P.Z }));
+		BoneObj->SetArrayField(TEXT("rot"), NumberArray({ R.X, R.Y, R.Z, R.W }));
+		BoneObj->SetArrayField(TEXT("scale"), NumberArray({ S.X, S.Y, S.Z }));
+		BonesArray.Add(MakeShared<FJsonValueObject>(BoneObj));
+	}
+	Root->SetArrayField(TEXT("skeleton"), BonesArray);
+
+	TSharedPtr<FJsonObject> AnimsObj = MakeShared<FJsonObject>();
+	for (const FDumpAnim& Anim : Anims)
+	{
+		TSharedPtr<FJsonObject> AnimObj = MakeShared<FJsonObject>();
+		AnimObj->SetNumberField(TEXT("duration"), Anim.Duration);
+		AnimObj->SetNumberField(TEXT("num_keys"), Anim.NumKeys);
+		TArray<TSharedPtr<FJsonValue>> FramesArray;
+		for (int32 Key = 0; Key < Anim.NumKeys; Key++)
+		{
+			TSharedPtr<FJsonObject> FrameObj = MakeShared<FJsonObject>();
+			FrameObj->SetNumberField(TEXT("frame"), Key);
+			TArray<TSharedPtr<FJsonValue>> BoneLocals;
+			for (int32 Bone = 0; Bone < NumBones; Bone++)
+			{
+				const FVector& P = Anim.PosKeys[Bone][Key];
+				const FQuat& R = Anim.RotKeys[Bone][Key];
+				BoneLocals.Add(MakeShared<FJsonValueArray>(NumberArray({ P.X, P.Y, P.Z, R.X, R.Y, R.Z, R.W })));
+			}
+			FrameObj->SetArrayField(TEXT("local"), BoneLocals);
+			FramesArray.Add(MakeShared<FJsonValueObject>(FrameObj));
+		}
+		AnimObj->SetArrayField(TEXT("frames"), FramesArray);
+		AnimsObj->SetObjectField(Anim.Name, AnimObj);
+	}
+	Root->SetObjectField(TEXT("animations"), AnimsObj);
+
+	FString Dom;
+	FJsonSerializer::Serialize(Root.ToSharedRef(), TJsonWriterFactory<>::Create(&Dom));
+
+	// Both must parse (names with quotes and backslashes are escaped) to the same document
+	TSharedPtr<FJsonObject> StreamedRoot;
+	TSharedPtr<FJsonObject> DomRoot;
+	if (!TestTrue(TEXT("Streamed dump is valid JSON"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Streamed), StreamedRoot) && StreamedRoot.IsValid())
+		|| !TestTrue(TEXT("DOM dump is valid JSON"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Dom), DomRoot) && DomRoot.IsValid()))
+	{
+		return false;
+	}
+
+	const FString Mismatch = FindJsonMismatch(MakeShared<FJsonValueObject>(StreamedRoot), MakeShared<FJsonValueObject>(DomRoot), TEXT("$"), 1e-6);
+	TestTrue(FString::Printf(TEXT("Streamed dump matches the DOM dump%s%s"), Mismatch.IsEmpty() ? TEXT("") : TEXT(" - "), *Mismatch), Mismatch.IsEmpty());
+	TestTrue(TEXT("Escaped animation name round-trips"), StreamedRoot->GetObjectField(TEXT("animations"))->HasField(Names[1]));
+
+	return true;
+}
+
+#endif // WITH_EDITOR
@@ -784,3 +784,35 @@ bool FSLFSpawnSentinelTest::RunTest(const FString& Parameters)
 	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
 	return true;
 }
+
+// ============================================================================
+// TEST: Deferred soft-asset plays (staleness window, looping remainder)
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFSoftPlayStalenessTest, "SLF.Spawn.SoftPlayStaleness",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFSoftPlayStalenessTest::RunTest(const FString& Parameters)
+{
+	const float Window = 0.25f;
+	double Duration = 0.0;
+
+	// One-shots play inside the window and are dropped after it
+	TestTrue(TEXT("One-shot on time plays"), ASLFBaseCharacter::ResolveDeferredSoftPlay(0.0, Window, false, Duration));
+	TestTrue(TEXT("One-shot at the window edge plays"), ASLFBaseCharacter::ResolveDeferredSoftPlay(0.25, Window, false, Duration));
+	TestFalse(TEXT("Stale one-shot dropped"), ASLFBaseCharacter::ResolveDeferredSoftPlay(0.3, Window, false, Duration));
+	TestFalse(TEXT("Zero window drops any late one-shot"), ASLFBaseCharacter::ResolveDeferredSoftPlay(0.01, 0.0f, false, Duration));
+
+	// Looping plays ignore the window and keep what is left of their duration
+	Duration = 3.0;
+	TestTrue(TEXT("Late looping play still plays"), ASLFBaseCharacter::ResolveDeferredSoftPlay(1.0, Window, true, Duration));
+	TestEqual(TEXT("Looping play keeps the remaining duration"), Duration, 2.0);
+
+	Duration = 3.0;
+	TestFalse(TEXT("Looping play whose duration elapsed is dropped"), ASLFBaseCharacter::ResolveDeferredSoftPlay(3.0, Window, true, Duration));
+
+	Duration = 0.0;
+	TestTrue(TEXT("Unbounded looping play always plays"), ASLFBaseCharacter::ResolveDeferredSoftPlay(60.0, Window, true, Duration));
+	TestEqual(TEXT("Unbounded looping play stays unbounded"), Duration, 0.0);
+
+	return true;
+}
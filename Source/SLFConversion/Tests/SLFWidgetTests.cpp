@@ -0,0 +1,528 @@
+// SLFWidgetTests.cpp
+// Widget tests - pooled slot grids used by W_Inventory / W_Equipment / W_NPC_Window_Vendor / W_Crafting
+// Benchmarks the recycled pool against the old clear-and-recreate pattern at 50 / 500 / 5000 items
+// Map marker registry + batched radar / world map projection
+// Trailing back bar driver (USLFBarAnimationSubsystem)
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Components/UniformGridPanel.h"
+#include "Widgets/SLFSlotGridPool.h"
+#include "Widgets/W_InventorySlot.h"
+#include "SLFPrimaryDataAssets.h"
+#include "Components/SLFMapMarkerSubsystem.h"
+#include "Widgets/SLFMarkerLayer.h"
+#include "Widgets/SLFBarAnimationSubsystem.h"
+#include "Components/ProgressBar.h"
+#include "GameFramework/Actor.h"
+#include "Math/RandomStream.h"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+static UWorld* GetWidgetTestWorld()
+{
+	if (GEngine)
+	{
+		// Try to get PIE world first
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if (Context.WorldType == EWorldType::PIE || Context.WorldType == EWorldType::Game)
+			{
+				return Context.World();
+			}
+		}
+		// Fall back to editor world
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if (Context.WorldType == EWorldType::Editor)
+			{
+				return Context.World();
+			}
+		}
+	}
+	return nullptr;
+}
+
+/** Same bind logic the widgets use: clear / change amount / occupy */
+static void BindBenchmarkSlot(UUserWidget* SlotWidget, const FSLFSlotGridEntry* Entry)
+{
+	UW_InventorySlot* InvSlot = Cast<UW_InventorySlot>(SlotWidget);
+	if (!InvSlot)
+	{
+		return;
+	}
+
+	UPDA_Item* Item = Entry ? Cast<UPDA_Item>(Entry->Item) : nullptr;
+	if (!Item)
+	{
+		if (InvSlot->IsOccupied)
+		{
+			InvSlot->EventClearSlot(false);
+		}
+		return;
+	}
+
+	if (InvSlot->IsOccupied && InvSlot->AssignedItem == Item)
+	{
+		InvSlot->EventChangeAmount(Entry->Count);
+		return;
+	}
+
+	if (InvSlot->IsOccupied)
+	{
+		InvSlot->EventClearSlot(false);
+	}
+	InvSlot->EventOccupySlot(Item, Entry->Count);
+}
+
+// ============================================================================
+// TEST: Pool Recycles Widgets and Diffs Bindings
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFSlotGridPoolTest, "SLF.UI.SlotGridPool",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFSlotGridPoolTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GetWidgetTestWorld();
+	if (!World)
+	{
+		AddError(TEXT("Could not get test world"));
+		return false;
+	}
+
+	UUniformGridPanel* Grid = NewObject<UUniformGridPanel>(GetTransientPackage());
+	USLFSlotGridPool* Pool = NewObject<USLFSlotGridPool>(World);
+	Pool->OnBindSlot.BindStatic(&BindBenchmarkSlot);
+
+	TArray<UPDA_Item*> Items;
+	for (int32 Index = 0; Index < 40; ++Index)
+	{
+		Items.Add(NewObject<UPDA_Item>(GetTransientPackage()));
+	}
+
+	auto MakeEntries = [&Items](int32 Num, int32 CountBase)
+	{
+		TArray<FSLFSlotGridEntry> Entries;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Entries.Emplace(Items[Index], CountBase + Index);
+		}
+		return Entries;
+	};
+
+	// Windowed: 2 rows x 4 columns over 40 items
+	Pool->Initialize(Grid, UW_InventorySlot::StaticClass(), 4, 2, 8);
+	Pool->SetEntries(MakeEntries(40, 1));
+	TestEqual(TEXT("Windowed pool creates only the window"), Pool->GetNumWidgetsCreated(), 8);
+	TestEqual(TEXT("First fill binds every slot"), Pool->GetNumSlotBinds(), 8);
+	TestEqual(TEXT("Grid holds the window"), Grid->GetChildrenCount(), 8);
+	TestEqual(TEXT("Max first row"), Pool->GetMaxFirstVisibleRow(), 8);
+
+	// Identical refresh touches nothing
+	Pool->SetEntries(MakeEntries(40, 1));
+	TestEqual(TEXT("Unchanged refresh binds nothing"), Pool->GetNumSlotBinds(), 8);
+
+	// Scroll one row - all 8 slots now show different items
+	TestTrue(TEXT("Scroll down"), Pool->ScrollByRows(1));
+	TestEqual(TEXT("Scroll rebinds the window"), Pool->GetNumSlotBinds(), 16);
+	UW_InventorySlot* FirstSlot = Cast<UW_InventorySlot>(Pool->GetSlots()[0]);
+	TestTrue(TEXT("Slot 0 shows entry 4 after scroll"), FirstSlot && FirstSlot->AssignedItem == Items[4]);
+	Pool->ScrollByRows(-5);
+	TestEqual(TEXT("Scroll clamps at the top"), Pool->GetFirstVisibleRow(), 0);
+	TestFalse(TEXT("Cannot scroll above the top"), Pool->ScrollByRows(-1));
+
+	// ScrollToEntry brings the last item into the window
+	const int32 SlotIndex = Pool->ScrollToEntry(39);
+	TestEqual(TEXT("Last item lands in last window row"), SlotIndex, 7);
+	TestEqual(TEXT("Window at the end"), Pool->GetFirstVisibleRow(), 8);
+
+	// Shrinking the list clamps the window
+	Pool->SetEntries(MakeEntries(6, 1));
+	TestEqual(TEXT("Window clamped after shrink"), Pool->GetFirstVisibleRow(), 0);
+	UW_InventorySlot* LastSlot = Cast<UW_InventorySlot>(Pool->GetSlots()[7]);
+	TestTrue(TEXT("Slots past the list are empty"), LastSlot && !LastSlot->IsOccupied);
+
+	// Count change on a single entry rebinds a single slot
+	const int32 BindsBefore = Pool->GetNumSlotBinds();
+	TArray<FSLFSlotGridEntry> Changed = MakeEntries(6, 1);
+	Changed[2].Count = 99;
+	Pool->SetEntries(MoveTemp(Changed));
+	TestEqual(TEXT("One changed entry -> one bind"), Pool->GetNumSlotBinds() - BindsBefore, 1);
+
+	// Windowed without MinSlots (equipment/crafting): only the entries inside the window are active
+	UUniformGridPanel* ListGrid = NewObject<UUniformGridPanel>(GetTransientPackage());
+	USLFSlotGridPool* ListPool = NewObject<USLFSlotGridPool>(World);
+	ListPool->OnBindSlot.BindStatic(&BindBenchmarkSlot);
+	ListPool->Initialize(ListGrid, UW_InventorySlot::StaticClass(), 4, 2, 0);
+	ListPool->SetEntries(MakeEntries(10, 1));
+	TestEqual(TEXT("List pool creates only the window"), ListPool->GetNumWidgetsCreated(), 8);
+	TestEqual(TEXT("Full window active"), ListPool->GetNumActiveSlots(), 8);
+	TestEqual(TEXT("Last entry lands in slot 5"), ListPool->ScrollToEntry(9), 5);
+	TestEqual(TEXT("Partial last window"), ListPool->GetNumActiveSlots(), 6);
+	TestTrue(TEXT("Slot past the list collapsed"), ListPool->GetSlots()[6]->GetVisibility() == ESlateVisibility::Collapsed);
+
+	// StepSelection wraps or clamps over the whole list, scrolling as needed
+	TestEqual(TEXT("Wrap past the end selects entry 0"), ListPool->StepSelection(5, 1, true), 0);
+	TestEqual(TEXT("Wrap scrolled back to the top"), ListPool->GetFirstVisibleRow(), 0);
+	TestEqual(TEXT("Clamp at the start"), ListPool->StepSelection(0, -1, false), 0);
+	TestEqual(TEXT("Clamp past the end selects the last entry"), ListPool->StepSelection(0, 20, false), 5);
+	TestEqual(TEXT("Clamp scrolled to the end"), ListPool->GetFirstVisibleRow(), 1);
+
+	// SyncEntry records a slot's own change without rebinding it, and the change survives a scroll
+	const int32 SyncBindsBefore = ListPool->GetNumSlotBinds();
+	UW_InventorySlot* SyncSlot = Cast<UW_InventorySlot>(ListPool->GetSlots()[1]);
+	SyncSlot->EventChangeAmount(50);
+	ListPool->SyncEntry(ListPool->GetEntryIndexForSlot(1), FSLFSlotGridEntry(Items[5], 50));
+	TestEqual(TEXT("Synced entry does not rebind"), ListPool->GetNumSlotBinds(), SyncBindsBefore);
+	ListPool->ScrollByRows(-1);
+	ListPool->ScrollByRows(1);
+	TestEqual(TEXT("Synced count survives a scroll"), SyncSlot->Count, 50);
+
+	// Unwindowed: grows to fit, never shrinks, collapses surplus
+	UUniformGridPanel* OpenGrid = NewObject<UUniformGridPanel>(GetTransientPackage());
+	USLFSlotGridPool* OpenPool = NewObject<USLFSlotGridPool>(World);
+	OpenPool->OnBindSlot.BindStatic(&BindBenchmarkSlot);
+	OpenPool->Initialize(OpenGrid, UW_InventorySlot::StaticClass(), 4, 0, 0);
+	OpenPool->SetEntries(MakeEntries(12, 1));
+	OpenPool->SetEntries(MakeEntries(5, 1));
+	OpenPool->SetEntries(MakeEntries(12, 1));
+	TestEqual(TEXT("Unwindowed pool created 12 widgets total"), OpenPool->GetNumWidgetsCreated(), 12);
+	TestEqual(TEXT("Active slots track entries"), OpenPool->GetNumActiveSlots(), 12);
+	OpenPool->SetEntries(MakeEntries(5, 1));
+	TestTrue(TEXT("Surplus slot collapsed"), OpenPool->GetSlots()[11]->GetVisibility() == ESlateVisibility::Collapsed);
+
+	TArray<UW_InventorySlot*> ActiveSlots;
+	OpenPool->GetActiveSlotsAs(ActiveSlots);
+	TestEqual(TEXT("Active slot list excludes parked slots"), ActiveSlots.Num(), 5);
+
+	return true;
+}
+
+// ============================================================================
+// BENCHMARK: Recreate vs Pool at 50 / 500 / 5000 Items
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFSlotGridPoolBenchmark, "SLF.UI.SlotGridPoolBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFSlotGridPoolBenchmark::RunTest(const FString& Parameters)
+{
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	AddInfo(TEXT("SLOT GRID POOL BENCHMARK (open menu / category switch)"));
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+
+	UWorld* World = GetWidgetTestWorld();
+	if (!World)
+	{
+		AddError(TEXT("Could not get test world"));
+		return false;
+	}
+
+	const int32 SlotsPerRow = 10;
+	const int32 VisibleRows = 5;
+	const int32 Opens = 3;
+	const int32 ItemCounts[] = { 50, 500, 5000 };
+
+	for (const int32 NumItems : ItemCounts)
+	{
+		TArray<FSLFSlotGridEntry> AllEntries;
+		TArray<FSLFSlotGridEntry> HalfEntries;
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			UPDA_Item* Item = NewObject<UPDA_Item>(GetTransientPackage());
+			AllEntries.Emplace(Item, 1 + (Index % 7));
+			if (Index % 2 == 0)
+			{
+				HalfEntries.Emplace(Item, 1 + (Index % 7));
+			}
+		}
+
+		// Legacy: ClearChildren + CreateWidget per item on every open / filter switch
+		UUniformGridPanel* LegacyGrid = NewObject<UUniformGridPanel>(GetTransientPackage());
+		int32 LegacyWidgets = 0;
+		auto LegacyFill = [&](const TArray<FSLFSlotGridEntry>& Entries)
+		{
+			LegacyGrid->ClearChildren();
+			for (int32 Index = 0; Index < Entries.Num(); ++Index)
+			{
+				UW_InventorySlot* NewSlot = CreateWidget<UW_InventorySlot>(World, UW_InventorySlot::StaticClass());
+				if (!NewSlot)
+				{
+					continue;
+				}
+				NewSlot->EventOccupySlot(Cast<UPDA_Item>(Entries[Index].Item), Entries[Index].Count);
+				LegacyGrid->AddChildToUniformGrid(NewSlot, Index / SlotsPerRow, Index % SlotsPerRow);
+				++LegacyWidgets;
+			}
+		};
+
+		const double LegacyStart = FPlatformTime::Seconds();
+		for (int32 Open = 0; Open < Opens; ++Open)
+		{
+			LegacyFill(AllEntries);
+			LegacyFill(HalfEntries);
+		}
+		const double LegacyMs = (FPlatformTime::Seconds() - LegacyStart) * 1000.0;
+
+		// Pooled: fixed window, rebinding only changed slots
+		UUniformGridPanel* PoolGrid = NewObject<UUniformGridPanel>(GetTransientPackage());
+		USLFSlotGridPool* Pool = NewObject<USLFSlotGridPool>(World);
+		Pool->OnBindSlot.BindStatic(&BindBenchmarkSlot);
+
+		const double PoolStart = FPlatformTime::Seconds();
+		for (int32 Open = 0; Open < Opens; ++Open)
+		{
+			Pool->Initialize(PoolGrid, UW_InventorySlot::StaticClass(), SlotsPerRow, VisibleRows, SlotsPerRow * VisibleRows);
+			Pool->SetEntries(TArray<FSLFSlotGridEntry>(AllEntries));
+			Pool->SetEntries(TArray<FSLFSlotGridEntry>(HalfEntries), true);
+		}
+		const double PoolMs = (FPlatformTime::Seconds() - PoolStart) * 1000.0;
+
+		AddInfo(FString::Printf(TEXT("  %5d items | recreate: %8.2f ms, %6d widgets | pool: %8.2f ms, %3d widgets, %5d binds"),
+			NumItems, LegacyMs, LegacyWidgets, PoolMs, Pool->GetNumWidgetsCreated(), Pool->GetNumSlotBinds()));
+
+		TestEqual(FString::Printf(TEXT("%d items: pool widget count is bounded by the window"), NumItems),
+			Pool->GetNumWidgetsCreated(), SlotsPerRow * VisibleRows);
+		TestTrue(FString::Printf(TEXT("%d items: binds bounded by window per refresh"), NumItems),
+			Pool->GetNumSlotBinds() <= Opens * 2 * SlotsPerRow * VisibleRows);
+
+		LegacyGrid->ClearChildren();
+		PoolGrid->ClearChildren();
+	}
+
+	AddInfo(TEXT("═══════════════════════════════════════════════════════════════"));
+	return true;
+}
+
+// ============================================================================
+// TEST: Marker Registry Bookkeeping + Batched Projection
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFMapMarkerTest, "SLF.UI.MapMarkers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFMapMarkerTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GetWidgetTestWorld();
+	if (!World)
+	{
+		AddError(TEXT("Could not get test world"));
+		return false;
+	}
+
+	auto SpawnAt = [World](const FVector& Location)
+	{
+		AActor* Actor = World->SpawnActor<AActor>();
+		USceneComponent* Root = NewObject<USceneComponent>(Actor);
+		Actor->SetRootComponent(Root);
+		Root->RegisterComponent();
+		Actor->SetActorLocation(Location);
+		return Actor;
+	};
+
+	USLFMapMarkerSubsystem* Markers = NewObject<USLFMapMarkerSubsystem>(World);
+
+	// --- Registry ---
+	AActor* RadarA = SpawnAt(FVector(100.0, 0.0, 0.0));
+	AActor* RadarB = SpawnAt(FVector(0.0, 200.0, 0.0));
+	AActor* MapOnly = SpawnAt(FVector(-300.0, 0.0, 0.0));
+
+	FSLFMapMarkerDesc Desc;
+	Desc.Channels = ESLFMapMarkerChannel::Radar;
+	Desc.Source = RadarA;
+	FSLFMapMarkerHandle HandleA = Markers->RegisterMarker(Desc);
+	Desc.Source = RadarB;
+	FSLFMapMarkerHandle HandleB = Markers->RegisterMarker(Desc);
+	Desc.Source = MapOnly;
+	Desc.Channels = ESLFMapMarkerChannel::WorldMap;
+	Desc.bStatic = true;
+	FSLFMapMarkerHandle HandleMap = Markers->RegisterMarker(Desc);
+
+	FSLFMapMarkerSnapshot Snapshot;
+	TestEqual(TEXT("Radar channel gathers 2 markers"), Markers->GatherMarkers(ESLFMapMarkerChannel::Radar, Snapshot), 2);
+	TestEqual(TEXT("Map channel gathers 1 marker"), Markers->GatherMarkers(ESLFMapMarkerChannel::WorldMap, Snapshot), 1);
+
+	// Dynamic markers follow their actor, static ones keep the registered location
+	RadarB->SetActorLocation(FVector(0.0, 500.0, 0.0));
+	MapOnly->SetActorLocation(FVector(-900.0, 0.0, 0.0));
+	Markers->GatherMarkers(ESLFMapMarkerChannel::Radar | ESLFMapMarkerChannel::WorldMap, Snapshot);
+	TestEqual(TEXT("Dynamic marker moved"), Snapshot.Y[1], 500.0f);
+	TestEqual(TEXT("Static marker kept its location"), Snapshot.X[2], -300.0f);
+
+	// A handle gather returns only the given markers, in handle order, skipping stale handles
+	FSLFMapMarkerHandle StaleHandle = HandleA;
+	StaleHandle.Serial += 1;
+	const FSLFMapMarkerHandle Subset[] = { HandleB, StaleHandle };
+	TestEqual(TEXT("Handle gather skips unlisted and stale markers"), Markers->GatherMarkers(Subset, Snapshot), 1);
+	TestEqual(TEXT("Handle gather follows its actor"), Snapshot.Y[0], 500.0f);
+
+	// Removing A swaps the map marker into its slot - B's handle stays valid
+	const uint32 RevisionBefore = Markers->GetRevision();
+	Markers->UnregisterMarker(HandleA);
+	TestFalse(TEXT("Unregister resets the handle"), HandleA.IsValid());
+	TestTrue(TEXT("Revision bumped on remove"), Markers->GetRevision() != RevisionBefore);
+	TestTrue(TEXT("Other handles survive a swap-remove"), Markers->IsRegistered(HandleB) && Markers->IsRegistered(HandleMap));
+	TestEqual(TEXT("Two markers left"), Markers->GetNumMarkers(), 2);
+
+	// Destroyed sources are pruned on the next gather
+	RadarB->Destroy();
+	TestEqual(TEXT("Destroyed radar source pruned"), Markers->GatherMarkers(ESLFMapMarkerChannel::Radar, Snapshot), 0);
+	TestFalse(TEXT("Pruned handle no longer registered"), Markers->IsRegistered(HandleB));
+
+	// Freed ids are reused, but a stale handle to the old marker does not match the new one
+	const FSLFMapMarkerHandle StaleB = HandleB;
+	Desc.Source = RadarA;
+	Desc.Channels = ESLFMapMarkerChannel::Radar;
+	FSLFMapMarkerHandle Reused = Markers->RegisterMarker(Desc);
+	TestTrue(TEXT("Freed id reused"), Reused.IsValid() && Reused.Id <= 2);
+	TestEqual(TEXT("Pruned id reused first"), Reused.Id, StaleB.Id);
+	TestFalse(TEXT("Stale handle is not registered"), Markers->IsRegistered(StaleB));
+
+	FSLFMapMarkerHandle StaleCopy = StaleB;
+	Markers->UnregisterMarker(StaleCopy);
+	TestTrue(TEXT("Stale handle cannot unregister the id's new marker"), Markers->IsRegistered(Reused));
+	TestEqual(TEXT("Stale unregister removes nothing"), Markers->GetNumMarkers(), 2);
+
+	Markers->UnregisterMarker(Reused);
+	Markers->UnregisterMarker(HandleMap);
+	RadarA->Destroy();
+	MapOnly->Destroy();
+
+	// --- Radar projection matches URadarManagerComponent::CalculateRadarPosition ---
+	const int32 NumPoints = 1024;
+	const float Radius = 5000.0f;
+	const float ClampLength = 100.0f;
+	const FVector Origin(12000.0, -3400.0, 0.0);
+	FRandomStream Random(29);
+
+	TArray<float> X, Y;
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		X.Add(static_cast<float>(Origin.X) + Random.FRandRange(-8000.0f, 8000.0f));
+		Y.Add(static_cast<float>(Origin.Y) + Random.FRandRange(-8000.0f, 8000.0f));
+	}
+
+	int32 RadarMismatches = 0;
+	const float Yaws[] = { 0.0f, 37.5f, -90.0f, 181.0f };
+	for (const float Yaw : Yaws)
+	{
+		TArray<FVector2f> Out;
+		Out.SetNumUninitialized(NumPoints);
+		USLFMapMarkerSubsystem::ProjectToRadar(X.GetData(), Y.GetData(), NumPoints,
+			FVector2f(static_cast<float>(Origin.X), static_cast<float>(Origin.Y)), Yaw, Radius, ClampLength, Out.GetData());
+
+		const FRotator CameraRotation(0.0f, Yaw, 0.0f);
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			const FVector Rotated = CameraRotation.UnrotateVector(FVector(static_cast<double>(X[Index]), static_cast<double>(Y[Index]), 0.0) - Origin);
+			FVector2D Expected(Rotated.Y / Radius * ClampLength, -Rotated.X / Radius * ClampLength);
+			if (Expected.Size() > ClampLength)
+			{
+				Expected = Expected.GetSafeNormal() * ClampLength;
+			}
+			if (!FVector2D(Out[Index]).Equals(Expected, 0.01))
+			{
+				++RadarMismatches;
+			}
+		}
+	}
+	TestEqual(TEXT("Batched radar projection matches the scalar path"), RadarMismatches, 0);
+
+	// --- Map projection ---
+	const FVector2f MapUV[] = { FVector2f(0.5f, 0.5f), FVector2f(0.25f, 0.75f) };
+	FVector2f MapOut[2];
+	USLFMapMarkerSubsystem::ProjectToMapView(MapUV, 2, FVector2f(0.25f, 0.75f), 4.0f, MapOut);
+	TestTrue(TEXT("View center lands at 0.5,0.5"), MapOut[1].Equals(FVector2f(0.5f, 0.5f), 1e-5f));
+	TestTrue(TEXT("Zoomed offset"), MapOut[0].Equals(FVector2f(1.5f, -0.5f), 1e-5f));
+
+	// --- Marker layer brushes ---
+	USLFMarkerLayer* Layer = NewObject<USLFMarkerLayer>(GetTransientPackage());
+	UTexture2D* Texture = NewObject<UTexture2D>(GetTransientPackage());
+	const uint16 First = Layer->FindOrAddBrush(Texture);
+	TestEqual(TEXT("Brush reused per texture"), Layer->FindOrAddBrush(Texture), First);
+	TestEqual(TEXT("Null texture draws a plain box"), Layer->FindOrAddBrush(nullptr), USLFMarkerLayer::NoBrush);
+
+	// Timing: 1000 radar markers per refresh
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<FVector2f> BenchOut;
+	BenchOut.SetNumUninitialized(NumPoints);
+	for (int32 Iteration = 0; Iteration < 1000; ++Iteration)
+	{
+		USLFMapMarkerSubsystem::ProjectToRadar(X.GetData(), Y.GetData(), NumPoints,
+			FVector2f(static_cast<float>(Origin.X), static_cast<float>(Origin.Y)), Iteration * 0.36f, Radius, ClampLength, BenchOut.GetData());
+	}
+	AddInfo(FString::Printf(TEXT("ProjectToRadar: %d markers in %.2f us per refresh"),
+		NumPoints, (FPlatformTime::Seconds() - StartTime) * 1000.0));
+
+	return true;
+}
+
+// ============================================================================
+// TEST: Trailing Back Bar Driver
+// Bar waits out its delay, moves toward the target at the given speed, snaps on heal,
+// and the driver drops the trail (stops ticking) the moment the bar reaches its target
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFBarAnimationTest, "SLF.UI.BarAnimation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFBarAnimationTest::RunTest(const FString& Parameters)
+{
+	// The driver only exists in game worlds
+	UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestWorld)
+	{
+		AddError(TEXT("Failed to create test world"));
+		return false;
+	}
+
+	USLFBarAnimationSubsystem* Driver = USLFBarAnimationSubsystem::Get(TestWorld);
+	if (!TestNotNull(TEXT("Game world has a bar driver"), Driver))
+	{
+		TestWorld->DestroyWorld(false);
+		return false;
+	}
+	TestFalse(TEXT("Idle driver does not tick"), Driver->IsTickable());
+
+	UProgressBar* BackBar = NewObject<UProgressBar>(GetTransientPackage());
+	BackBar->SetPercent(1.0f);
+
+	// Damage: 1.0 -> 0.4 at 0.5/s after a 0.25 s delay
+	USLFBarAnimationSubsystem::SetTrailTarget(TestWorld, BackBar, 0.4f, 0.5f, 0.25f);
+	TestEqual(TEXT("Trail started"), Driver->GetNumActiveTrails(), 1);
+	TestTrue(TEXT("Driver ticks while a bar moves"), Driver->IsTickable());
+
+	Driver->Tick(0.1f);
+	Driver->Tick(0.1f);
+	Driver->Tick(0.1f);
+	TestEqual(TEXT("Bar holds during the delay"), BackBar->GetPercent(), 1.0f);
+
+	// Interpolates toward the target at Speed per second
+	Driver->Tick(0.5f);
+	TestTrue(FString::Printf(TEXT("Bar moved 0.25 in 0.5 s (at %.3f)"), BackBar->GetPercent()),
+		FMath::IsNearlyEqual(BackBar->GetPercent(), 0.75f, 0.001f));
+	TestEqual(TEXT("Still trailing before the target"), Driver->GetNumActiveTrails(), 1);
+
+	// Overshooting tick lands exactly on the target and stops right there
+	Driver->Tick(1.0f);
+	TestEqual(TEXT("Bar reaches the target exactly"), BackBar->GetPercent(), 0.4f);
+	TestEqual(TEXT("Trail dropped once the target is reached"), Driver->GetNumActiveTrails(), 0);
+	TestFalse(TEXT("Driver stops ticking once every bar settled"), Driver->IsTickable());
+
+	// A settled bar is no longer driven
+	BackBar->SetPercent(0.3f);
+	Driver->Tick(0.5f);
+	TestEqual(TEXT("Settled bar left alone"), BackBar->GetPercent(), 0.3f);
+
+	// Healing snaps without starting a trail
+	USLFBarAnimationSubsystem::SetTrailTarget(TestWorld, BackBar, 0.9f, 0.5f, 0.25f);
+	TestEqual(TEXT("Heal snaps the back bar"), BackBar->GetPercent(), 0.9f);
+	TestEqual(TEXT("Heal starts no trail"), Driver->GetNumActiveTrails(), 0);
+
+	TestWorld->DestroyWorld(false);
+	return true;
+}
@@ -36,6 +36,11 @@
 #include "Components/ProgressBar.h"
 #include "Camera/CameraActor.h"
 
+// VFX includes
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Utilities/SLFNiagaraOneShotSubsystem.h"
+
 // ============================================================================
 // HELPER: Get editor world for testing
 // ============================================================================
@@ -606,3 +611,108 @@ bool FSLFWidgetStateTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// ============================================================================
+// TEST: Niagara One-Shot Pooling (merge, caps, culling, free-list reuse)
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSLFNiagaraOneShotTest, "SLF.World.NiagaraOneShots",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSLFNiagaraOneShotTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GetTestWorld();
+	if (!World)
+	{
+		AddError(TEXT("Could not get test world"));
+		return false;
+	}
+
+	UNiagaraSystem* System = LoadObject<UNiagaraSystem>(nullptr, TEXT("/Niagara/DefaultAssets/Templates/Systems/SimpleSpriteBurst.SimpleSpriteBurst"));
+	if (!System)
+	{
+		AddWarning(TEXT("Niagara SimpleSpriteBurst template not found - skipping"));
+		return true;
+	}
+
+	USLFNiagaraOneShotSubsystem* OneShots = NewObject<USLFNiagaraOneShotSubsystem>(World);
+
+	// Far from any player camera so only the test view decides distance culling
+	const FVector Base(1.0e6, 1.0e6, 1.0e5);
+	OneShots->ExtraViewLocations.Add(Base);
+	OneShots->MergeRadius = 15.0f;
+
+	FSLFNiagaraOneShotLimits Limits;
+	Limits.MaxConcurrent = 3;
+	Limits.CullDistance = 5000.0f;
+	Limits.MinSignificance = 0.25f;
+	Limits.MaxPooled = 2;
+	OneShots->SetSystemLimits(System, Limits);
+
+	auto FinishActive = [World, System]()
+	{
+		TArray<UNiagaraComponent*> Components;
+		for (TObjectIterator<UNiagaraComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && It->GetAsset() == System && It->IsActive())
+			{
+				Components.Add(*It);
+			}
+		}
+		for (UNiagaraComponent* Component : Components)
+		{
+			Component->DeactivateImmediate();
+		}
+		return Components.Num();
+	};
+
+	// --- Frame 1: merge, distance, significance and concurrency culling ---
+	OneShots->QueueOneShot(System, Base + FVector(100.0, 0.0, 0.0), FRotator::ZeroRotator, FVector(1.0f), 1.0f);
+	OneShots->QueueOneShot(System, Base + FVector(105.0, 0.0, 0.0), FRotator::ZeroRotator, FVector(1.0f), 1.0f);
+	OneShots->QueueOneShot(System, Base + FVector(20000.0, 0.0, 0.0), FRotator::ZeroRotator, FVector(1.0f), 1.0f);
+	OneShots->QueueOneShot(System, Base + FVector(0.0, 300.0, 0.0), FRotator::ZeroRotator, FVector(1.0f), 0.5f);
+	OneShots->QueueOneShot(System, Base + FVector(0.0, -300.0, 0.0), FRotator::ZeroRotator, FVector(1.0f), 0.4f);
+	OneShots->QueueOneShot(System, Base + FVector(300.0, 300.0, 0.0), FRotator::ZeroRotator, FVector(1.0f), 0.3f);
+	OneShots->QueueOneShot(System, Base + FVector(0.0, 0.0, 300.0), FRotator::ZeroRotator, FVector(1.0f), 0.1f);
+	OneShots->Tick(0.0f);
+
+	const FSLFNiagaraOneShotStats& Stats = OneShots->GetStats();
+	TestEqual(TEXT("Every request counted"), Stats.Requested, 7);
+	TestEqual(TEXT("Request inside the merge radius merged"), Stats.Merged, 1);
+	TestEqual(TEXT("Request beyond the cull distance culled"), Stats.CulledDistance, 1);
+	TestEqual(TEXT("Request below min significance culled"), Stats.CulledSignificance, 1);
+	TestEqual(TEXT("Least significant request over the cap culled"), Stats.CulledConcurrency, 1);
+	TestEqual(TEXT("Total culled"), Stats.GetCulled(), 3);
+	TestEqual(TEXT("Cold pool misses for each spawn"), Stats.PoolMisses, 3);
+	TestEqual(TEXT("No pool hits on a cold pool"), Stats.PoolHits, 0);
+
+	if (OneShots->GetNumActive(System) == 0)
+	{
+		AddWarning(TEXT("SimpleSpriteBurst did not activate in this world - skipping free-list checks"));
+		return true;
+	}
+	TestEqual(TEXT("Spawned components are active"), OneShots->GetNumActive(System), 3);
+	TestEqual(TEXT("Nothing pooled while active"), OneShots->GetNumPooled(System), 0);
+
+	// --- Finished components return to the free list up to MaxPooled ---
+	TestEqual(TEXT("Three components finished"), FinishActive(), 3);
+	TestEqual(TEXT("No active components after finish"), OneShots->GetNumActive(System), 0);
+	TestEqual(TEXT("Free list capped at MaxPooled"), OneShots->GetNumPooled(System), 2);
+
+	// --- Frame 2: free-list reuse ---
+	OneShots->QueueOneShot(System, Base + FVector(0.0, 600.0, 0.0));
+	OneShots->QueueOneShot(System, Base + FVector(0.0, -600.0, 0.0));
+	OneShots->Tick(0.0f);
+	TestEqual(TEXT("Both spawns reused pooled components"), Stats.PoolHits, 2);
+	TestEqual(TEXT("No new components allocated"), Stats.PoolMisses, 3);
+	TestEqual(TEXT("Reused components active"), OneShots->GetNumActive(System), 2);
+	TestEqual(TEXT("Free list drained"), OneShots->GetNumPooled(System), 0);
+
+	// Without pooling the finished components are destroyed and the pool is dropped
+	Limits.MaxPooled = 0;
+	OneShots->SetSystemLimits(System, Limits);
+	FinishActive();
+	TestEqual(TEXT("No active components at the end"), OneShots->GetNumActive(System), 0);
+	TestEqual(TEXT("Nothing pooled with MaxPooled 0"), OneShots->GetNumPooled(System), 0);
+
+	return true;
+}
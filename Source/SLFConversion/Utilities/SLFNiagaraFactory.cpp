@@ -8,12 +8,52 @@
 #include "NiagaraSystem.h"
 #include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
+#include "Utilities/SLFNiagaraOneShotSubsystem.h"
+
+namespace
+{
+	/** Arguments a generated system was built from; compared field by field, not by hash alone */
+	struct FRecipeKey
+	{
+		FName Recipe;
+		FLinearColor Color;
+		float ParticleSize = 0.0f;
+		float Amount = 0.0f;
+
+		bool operator==(const FRecipeKey& Other) const
+		{
+			return Recipe == Other.Recipe && Color == Other.Color
+				&& ParticleSize == Other.ParticleSize && Amount == Other.Amount;
+		}
+
+		friend uint32 GetTypeHash(const FRecipeKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.Recipe), GetTypeHash(Key.Color));
+			Hash = HashCombine(Hash, GetTypeHash(Key.ParticleSize));
+			return HashCombine(Hash, GetTypeHash(Key.Amount));
+		}
+	};
+
+	/**
+	 * Generated systems by recipe. Returning the same system for the same arguments keeps
+	 * one-shot pools (which are per system) warm instead of duplicating a system per call.
+	 * Weak here, but USLFNiagaraOneShotSubsystem keeps a system alive while it has live or
+	 * pooled components; once nothing references it, the recipe is regenerated on next use.
+	 */
+	TMap<FRecipeKey, TWeakObjectPtr<UNiagaraSystem>> GeneratedSystems;
+}
 
 UNiagaraSystem* USLFNiagaraFactory::CreateMagicProjectileEffect(
 	FLinearColor Color,
 	float ParticleSize,
 	float SpawnRate)
 {
+	const FRecipeKey RecipeKey{TEXT("MagicProjectile"), Color, ParticleSize, SpawnRate};
+	if (UNiagaraSystem* Cached = GeneratedSystems.FindRef(RecipeKey).Get())
+	{
+		return Cached;
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("[SLFNiagaraFactory] Creating Magic Projectile Effect - Color: %s, Size: %.1f, Rate: %.1f"),
 		*Color.ToString(), ParticleSize, SpawnRate);
 
@@ -49,6 +89,7 @@ UNiagaraSystem* USLFNiagaraFactory::CreateMagicProjectileEffect(
 		{
 			NewSystem->SetFlags(RF_Transient);
 			UE_LOG(LogTemp, Log, TEXT("[SLFNiagaraFactory] Created magic effect from template: %s"), *NewSystem->GetName());
+			GeneratedSystems.Add(RecipeKey, NewSystem);
 			return NewSystem;
 		}
 	}
@@ -65,6 +106,7 @@ UNiagaraSystem* USLFNiagaraFactory::CreateMagicProjectileEffect(
 	{
 		NewSystem->SetFlags(RF_Transient);
 		UE_LOG(LogTemp, Log, TEXT("[SLFNiagaraFactory] Created minimal system (may not render without proper modules)"));
+		GeneratedSystems.Add(RecipeKey, NewSystem);
 	}
 
 	return NewSystem;
@@ -75,6 +117,12 @@ UNiagaraSystem* USLFNiagaraFactory::CreateImpactBurstEffect(
 	float ParticleSize,
 	int32 BurstCount)
 {
+	const FRecipeKey RecipeKey{TEXT("ImpactBurst"), Color, ParticleSize, (float)BurstCount};
+	if (UNiagaraSystem* Cached = GeneratedSystems.FindRef(RecipeKey).Get())
+	{
+		return Cached;
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("[SLFNiagaraFactory] Creating Impact Burst Effect - Color: %s, Size: %.1f, Count: %d"),
 		*Color.ToString(), ParticleSize, BurstCount);
 
@@ -107,12 +155,29 @@ UNiagaraSystem* USLFNiagaraFactory::CreateImpactBurstEffect(
 		{
 			NewSystem->SetFlags(RF_Transient);
 			UE_LOG(LogTemp, Log, TEXT("[SLFNiagaraFactory] Created impact effect: %s"), *NewSystem->GetName());
+			GeneratedSystems.Add(RecipeKey, NewSystem);
 			return NewSystem;
 		}
 	}
 
 	UE_LOG(LogTemp, Warning, TEXT("[SLFNiagaraFactory] Could not find burst template, using magic effect as fallback"));
-	return CreateMagicProjectileEffect(Color, ParticleSize, (float)BurstCount);
+	UNiagaraSystem* Fallback = CreateMagicProjectileEffect(Color, ParticleSize, (float)BurstCount);
+	GeneratedSystems.Add(RecipeKey, Fallback);
+	return Fallback;
+}
+
+void USLFNiagaraFactory::SpawnImpactBurstAt(
+	const UObject* WorldContextObject,
+	FVector Location,
+	FRotator Rotation,
+	FLinearColor Color,
+	float ParticleSize,
+	int32 BurstCount)
+{
+	if (UNiagaraSystem* System = CreateImpactBurstEffect(Color, ParticleSize, BurstCount))
+	{
+		USLFNiagaraOneShotSubsystem::SpawnOneShot(WorldContextObject, System, Location, Rotation);
+	}
 }
 
 UNiagaraSystem* USLFNiagaraFactory::CreateFireSpellEffect()
@@ -27,7 +27,7 @@ public:
 	 * @param Color - Base color of the effect
 	 * @param ParticleSize - Size of particles
 	 * @param SpawnRate - Particles per second
-	 * @return The created Niagara System (transient, not saved to disk)
+	 * @return The created Niagara System (transient, not saved to disk; shared by calls with the same arguments)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SLF|Niagara Factory")
 	static UNiagaraSystem* CreateMagicProjectileEffect(
@@ -37,7 +37,7 @@ public:
 
 	/**
 	 * Create a hit/impact burst effect
-	 * Spawns a burst of particles on impact
+	 * Spawns a burst of particles on impact (shared by calls with the same arguments)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SLF|Niagara Factory")
 	static UNiagaraSystem* CreateImpactBurstEffect(
@@ -45,6 +45,19 @@ public:
 		float ParticleSize = 20.0f,
 		int32 BurstCount = 30);
 
+	/**
+	 * Spawn a one-shot impact burst through the pooled one-shot subsystem
+	 * The burst system is generated once per recipe and reused, so repeated hits share one pool
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SLF|Niagara Factory", meta = (WorldContext = "WorldContextObject"))
+	static void SpawnImpactBurstAt(
+		const UObject* WorldContextObject,
+		FVector Location,
+		FRotator Rotation,
+		FLinearColor Color = FLinearColor(1.0f, 0.5f, 0.0f, 1.0f),
+		float ParticleSize = 20.0f,
+		int32 BurstCount = 30);
+
 	/**
 	 * Create a simple fire spell effect
 	 */
@@ -0,0 +1,341 @@
+// SLFNiagaraOneShotSubsystem.cpp
+// Pooled, batched spawning of fire-and-forget Niagara effects
+
+#include "Utilities/SLFNiagaraOneShotSubsystem.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+DECLARE_STATS_GROUP(TEXT("SLF Niagara One-Shots"), STATGROUP_SLFNiagaraOneShots, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Hits"), STAT_SLFNiagaraOneShotPoolHits, STATGROUP_SLFNiagaraOneShots);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Misses"), STAT_SLFNiagaraOneShotPoolMisses, STATGROUP_SLFNiagaraOneShots);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Merged"), STAT_SLFNiagaraOneShotMerged, STATGROUP_SLFNiagaraOneShots);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Culled (Distance)"), STAT_SLFNiagaraOneShotCulledDistance, STATGROUP_SLFNiagaraOneShots);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Culled (Significance)"), STAT_SLFNiagaraOneShotCulledSignificance, STATGROUP_SLFNiagaraOneShots);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Culled (Concurrency)"), STAT_SLFNiagaraOneShotCulledConcurrency, STATGROUP_SLFNiagaraOneShots);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Components"), STAT_SLFNiagaraOneShotActive, STATGROUP_SLFNiagaraOneShots);
+
+USLFNiagaraOneShotSubsystem* USLFNiagaraOneShotSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<USLFNiagaraOneShotSubsystem>() : nullptr;
+}
+
+void USLFNiagaraOneShotSubsystem::SpawnOneShot(const UObject* WorldContextObject, UNiagaraSystem* System,
+	FVector Location, FRotator Rotation, FVector Scale, float Significance)
+{
+	if (!System)
+	{
+		return;
+	}
+
+	if (USLFNiagaraOneShotSubsystem* Subsystem = Get(WorldContextObject))
+	{
+		Subsystem->QueueOneShot(System, Location, Rotation, Scale, Significance);
+		return;
+	}
+
+	UNiagaraFunctionLibrary::SpawnSystemAtLocation(WorldContextObject, System, Location, Rotation, Scale, true, true);
+}
+
+void USLFNiagaraOneShotSubsystem::QueueOneShot(UNiagaraSystem* System, const FVector& Location, const FRotator& Rotation,
+	const FVector& Scale, float Significance)
+{
+	// Nothing renders on a dedicated server
+	if (!System || GetWorld()->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	FRequest& Request = PendingRequests.AddDefaulted_GetRef();
+	Request.System = System;
+	Request.Location = Location;
+	Request.Rotation = Rotation;
+	Request.Scale = Scale;
+	Request.Significance = Significance;
+	++Stats.Requested;
+}
+
+void USLFNiagaraOneShotSubsystem::SetSystemLimits(const UNiagaraSystem* System, const FSLFNiagaraOneShotLimits& Limits)
+{
+	if (System)
+	{
+		SystemLimits.Add(System, Limits);
+	}
+}
+
+const FSLFNiagaraOneShotLimits& USLFNiagaraOneShotSubsystem::GetSystemLimits(const UNiagaraSystem* System) const
+{
+	const FSLFNiagaraOneShotLimits* Limits = SystemLimits.Find(System);
+	return Limits ? *Limits : DefaultLimits;
+}
+
+int32 USLFNiagaraOneShotSubsystem::GetNumActive(const UNiagaraSystem* System) const
+{
+	const FSLFNiagaraOneShotPool* Pool = Pools.Find(const_cast<UNiagaraSystem*>(System));
+	return Pool ? Pool->Active.Num() : 0;
+}
+
+int32 USLFNiagaraOneShotSubsystem::GetNumPooled(const UNiagaraSystem* System) const
+{
+	const FSLFNiagaraOneShotPool* Pool = Pools.Find(const_cast<UNiagaraSystem*>(System));
+	return Pool ? Pool->Free.Num() : 0;
+}
+
+bool USLFNiagaraOneShotSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USLFNiagaraOneShotSubsystem::Deinitialize()
+{
+	for (TPair<TObjectPtr<UNiagaraSystem>, FSLFNiagaraOneShotPool>& Pair : Pools)
+	{
+		for (UNiagaraComponent* Component : Pair.Value.Active)
+		{
+			if (IsValid(Component))
+			{
+				Component->OnSystemFinished.RemoveAll(this);
+				Component->DestroyComponent();
+			}
+		}
+		for (UNiagaraComponent* Component : Pair.Value.Free)
+		{
+			if (IsValid(Component))
+			{
+				Component->DestroyComponent();
+			}
+		}
+		DEC_DWORD_STAT_BY(STAT_SLFNiagaraOneShotActive, Pair.Value.Active.Num());
+	}
+	Pools.Empty();
+	PendingRequests.Empty();
+
+	Super::Deinitialize();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// BATCHED SPAWN
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void USLFNiagaraOneShotSubsystem::Tick(float DeltaTime)
+{
+	FlushRequests();
+}
+
+void USLFNiagaraOneShotSubsystem::FlushRequests()
+{
+	UWorld* World = GetWorld();
+	if (!World || PendingRequests.Num() == 0)
+	{
+		return;
+	}
+
+	TGuardValue<bool> FlushingGuard(bFlushing, true);
+
+	TArray<FVector> ViewLocations;
+	GatherViewLocations(ViewLocations);
+
+	for (FRequest& Request : PendingRequests)
+	{
+		Request.DistanceSquared = 0.0;
+		if (ViewLocations.Num() > 0)
+		{
+			Request.DistanceSquared = TNumericLimits<double>::Max();
+			for (const FVector& View : ViewLocations)
+			{
+				Request.DistanceSquared = FMath::Min(Request.DistanceSquared, FVector::DistSquared(View, Request.Location));
+			}
+		}
+	}
+
+	// Group by system; within a system the most significant, then nearest, requests claim the cap first
+	PendingRequests.Sort([](const FRequest& A, const FRequest& B)
+	{
+		const UPTRINT SystemA = reinterpret_cast<UPTRINT>(A.System.Get());
+		const UPTRINT SystemB = reinterpret_cast<UPTRINT>(B.System.Get());
+		if (SystemA != SystemB)
+		{
+			return SystemA < SystemB;
+		}
+		if (A.Significance != B.Significance)
+		{
+			return A.Significance > B.Significance;
+		}
+		return A.DistanceSquared < B.DistanceSquared;
+	});
+
+	const double MergeRadiusSquared = FMath::Square((double)MergeRadius);
+	TArray<FVector, TInlineAllocator<16>> Spawned;
+
+	for (int32 GroupStart = 0; GroupStart < PendingRequests.Num();)
+	{
+		UNiagaraSystem* System = PendingRequests[GroupStart].System.Get();
+		int32 GroupEnd = GroupStart + 1;
+		while (GroupEnd < PendingRequests.Num() && PendingRequests[GroupEnd].System.Get() == System)
+		{
+			++GroupEnd;
+		}
+
+		if (System)
+		{
+			const FSLFNiagaraOneShotLimits& Limits = GetSystemLimits(System);
+			const double CullDistanceSquared = FMath::Square((double)Limits.CullDistance);
+			const bool bDistanceCull = Limits.CullDistance > 0.0f && ViewLocations.Num() > 0;
+			FSLFNiagaraOneShotPool& Pool = Pools.FindOrAdd(System);
+			Spawned.Reset();
+
+			for (int32 Index = GroupStart; Index < GroupEnd; ++Index)
+			{
+				const FRequest& Request = PendingRequests[Index];
+				if (Request.Significance < Limits.MinSignificance)
+				{
+					++Stats.CulledSignificance;
+					INC_DWORD_STAT(STAT_SLFNiagaraOneShotCulledSignificance);
+					continue;
+				}
+				if (bDistanceCull && Request.DistanceSquared > CullDistanceSquared)
+				{
+					++Stats.CulledDistance;
+					INC_DWORD_STAT(STAT_SLFNiagaraOneShotCulledDistance);
+					continue;
+				}
+
+				// Several hits on one spot in one frame (AoE, multi-hit traces) read as one effect
+				const bool bDuplicate = Spawned.ContainsByPredicate([&Request, MergeRadiusSquared](const FVector& Location)
+				{
+					return FVector::DistSquared(Location, Request.Location) <= MergeRadiusSquared;
+				});
+				if (bDuplicate)
+				{
+					++Stats.Merged;
+					INC_DWORD_STAT(STAT_SLFNiagaraOneShotMerged);
+					continue;
+				}
+
+				if (Pool.Active.Num() >= Limits.MaxConcurrent)
+				{
+					++Stats.CulledConcurrency;
+					INC_DWORD_STAT(STAT_SLFNiagaraOneShotCulledConcurrency);
+					continue;
+				}
+
+				UNiagaraComponent* Component = AcquireComponent(System, Pool);
+				if (!Component)
+				{
+					continue;
+				}
+
+				// Tracked before activation: a system that fails to start finishes inside Activate
+				Pool.Active.Add(Component);
+				Spawned.Add(Request.Location);
+				INC_DWORD_STAT(STAT_SLFNiagaraOneShotActive);
+
+				Component->SetWorldLocationAndRotation(Request.Location, Request.Rotation);
+				Component->SetWorldScale3D(Request.Scale);
+				Component->Activate(true);
+			}
+		}
+
+		GroupStart = GroupEnd;
+	}
+
+	PendingRequests.Reset();
+	PruneEmptyPools();
+}
+
+void USLFNiagaraOneShotSubsystem::PruneEmptyPools()
+{
+	for (auto It = Pools.CreateIterator(); It; ++It)
+	{
+		if (!It->Key || (It->Value.Active.Num() == 0 && It->Value.Free.Num() == 0))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+UNiagaraComponent* USLFNiagaraOneShotSubsystem::AcquireComponent(UNiagaraSystem* System, FSLFNiagaraOneShotPool& Pool)
+{
+	while (Pool.Free.Num() > 0)
+	{
+		UNiagaraComponent* Component = Pool.Free.Pop(EAllowShrinking::No);
+		if (IsValid(Component))
+		{
+			++Stats.PoolHits;
+			INC_DWORD_STAT(STAT_SLFNiagaraOneShotPoolHits);
+			return Component;
+		}
+	}
+
+	++Stats.PoolMisses;
+	INC_DWORD_STAT(STAT_SLFNiagaraOneShotPoolMisses);
+
+	UNiagaraComponent* Component = NewObject<UNiagaraComponent>(GetWorld());
+	Component->SetAutoDestroy(false);
+	Component->bAutoActivate = false;
+	Component->SetAbsolute(true, true, true);
+	Component->SetAsset(System);
+	Component->OnSystemFinished.AddUniqueDynamic(this, &USLFNiagaraOneShotSubsystem::OnComponentFinished);
+	Component->RegisterComponentWithWorld(GetWorld());
+	return Component;
+}
+
+void USLFNiagaraOneShotSubsystem::OnComponentFinished(UNiagaraComponent* Component)
+{
+	UNiagaraSystem* System = Component ? Component->GetAsset() : nullptr;
+	FSLFNiagaraOneShotPool* Pool = System ? Pools.Find(System) : nullptr;
+	if (!Pool || Pool->Active.RemoveSingleSwap(Component, EAllowShrinking::No) == 0)
+	{
+		return;
+	}
+	DEC_DWORD_STAT(STAT_SLFNiagaraOneShotActive);
+
+	if (Pool->Free.Num() < GetSystemLimits(System).MaxPooled)
+	{
+		Pool->Free.Add(Component);
+	}
+	else
+	{
+		Component->OnSystemFinished.RemoveAll(this);
+		Component->DestroyComponent();
+
+		if (!bFlushing && Pool->Active.Num() == 0 && Pool->Free.Num() == 0)
+		{
+			Pools.Remove(System);
+		}
+	}
+}
+
+void USLFNiagaraOneShotSubsystem::GatherViewLocations(TArray<FVector>& OutLocations) const
+{
+	OutLocations.Append(ExtraViewLocations);
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController() && PC->PlayerCameraManager)
+		{
+			OutLocations.Add(PC->PlayerCameraManager->GetCameraLocation());
+		}
+	}
+}
+
+ETickableTickType USLFNiagaraOneShotSubsystem::GetTickableTickType() const
+{
+	// CDO never ticks; instances tick only while requests are queued
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool USLFNiagaraOneShotSubsystem::IsTickable() const
+{
+	return PendingRequests.Num() > 0;
+}
+
+TStatId USLFNiagaraOneShotSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USLFNiagaraOneShotSubsystem, STATGROUP_Tickables);
+}
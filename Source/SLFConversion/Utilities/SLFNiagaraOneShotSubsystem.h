@@ -0,0 +1,148 @@
+// SLFNiagaraOneShotSubsystem.h
+// Pooled, batched spawning of fire-and-forget Niagara effects
+//
+// Hit sparks, blood, guard flashes and footstep dust used to spawn through
+// SpawnSystemAtLocation with auto-destroy, allocating and destroying a component per
+// effect. Callers now queue one-shots here; once per frame the queue is sorted per
+// system (significance, then distance to the nearest local view), near-duplicate
+// requests are merged, requests beyond the system's cull distance or concurrency cap
+// are dropped, and the rest reuse finished components from a per-system free list.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SLFNiagaraOneShotSubsystem.generated.h"
+
+class UNiagaraComponent;
+class UNiagaraSystem;
+
+/** Per-system limits (SetSystemLimits; systems without an entry use the subsystem defaults) */
+struct FSLFNiagaraOneShotLimits
+{
+	/** Live instances of the system; further requests in a frame are culled */
+	int32 MaxConcurrent = 16;
+
+	/** Requests farther than this from every local view are culled (0 = no distance culling) */
+	float CullDistance = 8000.0f;
+
+	/** Requests below this significance are culled */
+	float MinSignificance = 0.0f;
+
+	/** Finished components kept for reuse; extras are destroyed */
+	int32 MaxPooled = 16;
+};
+
+/** Totals since the subsystem was created (also reported under "stat SLFNiagaraOneShots") */
+struct FSLFNiagaraOneShotStats
+{
+	int32 Requested = 0;
+	int32 PoolHits = 0;
+	int32 PoolMisses = 0;
+	int32 Merged = 0;
+	int32 CulledDistance = 0;
+	int32 CulledSignificance = 0;
+	int32 CulledConcurrency = 0;
+
+	int32 GetCulled() const { return CulledDistance + CulledSignificance + CulledConcurrency; }
+};
+
+/** Components of one system: finished ones ready for reuse and live ones */
+USTRUCT()
+struct FSLFNiagaraOneShotPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> Free;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> Active;
+};
+
+UCLASS()
+class SLFCONVERSION_API USLFNiagaraOneShotSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Subsystem for the given object's world (nullptr outside game / PIE worlds) */
+	static USLFNiagaraOneShotSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Queue a one-shot at a world transform, spawned (pooled) at the end of this frame.
+	 * Significance (0-1) orders requests competing for the same system's cap.
+	 * Without a subsystem (editor preview worlds) the effect is spawned directly.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SLF|Niagara", meta = (WorldContext = "WorldContextObject"))
+	static void SpawnOneShot(const UObject* WorldContextObject, UNiagaraSystem* System,
+		FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), float Significance = 1.0f);
+
+	void QueueOneShot(UNiagaraSystem* System, const FVector& Location, const FRotator& Rotation,
+		const FVector& Scale = FVector(1.0f), float Significance = 1.0f);
+
+	/** Override the limits for one system */
+	void SetSystemLimits(const UNiagaraSystem* System, const FSLFNiagaraOneShotLimits& Limits);
+	const FSLFNiagaraOneShotLimits& GetSystemLimits(const UNiagaraSystem* System) const;
+
+	/** Limits for systems without an override */
+	FSLFNiagaraOneShotLimits DefaultLimits;
+
+	/** Same-frame requests of one system closer than this (cm) spawn once */
+	float MergeRadius = 15.0f;
+
+	/** Views besides the local player cameras used for distance culling (spectator cameras, tests) */
+	TArray<FVector> ExtraViewLocations;
+
+	int32 GetNumActive(const UNiagaraSystem* System) const;
+	int32 GetNumPooled(const UNiagaraSystem* System) const;
+	const FSLFNiagaraOneShotStats& GetStats() const { return Stats; }
+
+	// UWorldSubsystem
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FRequest
+	{
+		TWeakObjectPtr<UNiagaraSystem> System;
+		FVector Location;
+		FRotator Rotation;
+		FVector Scale;
+		float Significance = 1.0f;
+		double DistanceSquared = 0.0;
+	};
+
+	/** Spawn this frame's queue (sorted per system, merged, culled) */
+	void FlushRequests();
+
+	/** Drop pools with neither live nor free components so they stop referencing their system */
+	void PruneEmptyPools();
+
+	/** Free-list component for System, or a new one */
+	UNiagaraComponent* AcquireComponent(UNiagaraSystem* System, FSLFNiagaraOneShotPool& Pool);
+
+	UFUNCTION()
+	void OnComponentFinished(UNiagaraComponent* Component);
+
+	void GatherViewLocations(TArray<FVector>& OutLocations) const;
+
+	TArray<FRequest> PendingRequests;
+
+	/** Keys are strong references: a system stays loaded while it has live or pooled components */
+	UPROPERTY()
+	TMap<TObjectPtr<UNiagaraSystem>, FSLFNiagaraOneShotPool> Pools;
+
+	/** Set while FlushRequests holds a pool reference (components can finish inside Activate) */
+	bool bFlushing = false;
+
+	TMap<TObjectKey<UNiagaraSystem>, FSLFNiagaraOneShotLimits> SystemLimits;
+
+	FSLFNiagaraOneShotStats Stats;
+};
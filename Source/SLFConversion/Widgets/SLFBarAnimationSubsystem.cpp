@@ -0,0 +1,120 @@
+// SLFBarAnimationSubsystem.cpp
+// Shared driver for trailing "back bar" animations
+
+#include "Widgets/SLFBarAnimationSubsystem.h"
+#include "Components/ProgressBar.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+USLFBarAnimationSubsystem* USLFBarAnimationSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<USLFBarAnimationSubsystem>() : nullptr;
+}
+
+void USLFBarAnimationSubsystem::SetTrailTarget(const UObject* WorldContextObject, UProgressBar* BackBar, float Target, float Speed, float Delay)
+{
+	if (!BackBar)
+	{
+		return;
+	}
+
+	USLFBarAnimationSubsystem* Driver = Get(WorldContextObject);
+	const float Current = BackBar->GetPercent();
+
+	// Healing (or no driver): back bar matches front immediately
+	if (!Driver || Target >= Current || Speed <= 0.0f)
+	{
+		if (Driver)
+		{
+			Driver->CancelTrail(BackBar);
+		}
+		if (Current != Target)
+		{
+			BackBar->SetPercent(Target);
+		}
+		return;
+	}
+
+	Driver->AddTrail(BackBar, Target, Speed, Delay);
+}
+
+void USLFBarAnimationSubsystem::AddTrail(UProgressBar* BackBar, float Target, float Speed, float Delay)
+{
+	for (FSLFTrailingBar& Trail : Trails)
+	{
+		if (Trail.Bar.Get() == BackBar)
+		{
+			// Already trailing - retarget, keep the running delay
+			Trail.Target = Target;
+			Trail.Speed = Speed;
+			return;
+		}
+	}
+
+	FSLFTrailingBar& Trail = Trails.AddDefaulted_GetRef();
+	Trail.Bar = BackBar;
+	Trail.Current = BackBar->GetPercent();
+	Trail.Target = Target;
+	Trail.Speed = Speed;
+	Trail.DelayRemaining = FMath::Max(0.0f, Delay);
+}
+
+void USLFBarAnimationSubsystem::CancelTrail(const UProgressBar* BackBar)
+{
+	Trails.RemoveAllSwap([BackBar](const FSLFTrailingBar& Trail)
+	{
+		return !Trail.Bar.IsValid() || Trail.Bar.Get() == BackBar;
+	});
+}
+
+bool USLFBarAnimationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USLFBarAnimationSubsystem::Tick(float DeltaTime)
+{
+	for (int32 Index = Trails.Num() - 1; Index >= 0; --Index)
+	{
+		FSLFTrailingBar& Trail = Trails[Index];
+		UProgressBar* Bar = Trail.Bar.Get();
+		if (!Bar)
+		{
+			Trails.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (Trail.DelayRemaining > 0.0f)
+		{
+			Trail.DelayRemaining -= DeltaTime;
+			continue;
+		}
+
+		Trail.Current = FMath::FInterpConstantTo(Trail.Current, Trail.Target, DeltaTime, Trail.Speed);
+		if (FMath::IsNearlyEqual(Trail.Current, Trail.Target, 0.001f))
+		{
+			Bar->SetPercent(Trail.Target);
+			Trails.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		Bar->SetPercent(Trail.Current);
+	}
+}
+
+ETickableTickType USLFBarAnimationSubsystem::GetTickableTickType() const
+{
+	// CDO never ticks; instances tick only while IsTickable() (a bar is moving)
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool USLFBarAnimationSubsystem::IsTickable() const
+{
+	return Trails.Num() > 0;
+}
+
+TStatId USLFBarAnimationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USLFBarAnimationSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,61 @@
+// SLFBarAnimationSubsystem.h
+// Shared driver for trailing "back bar" animations (any front/back progress bar pair)
+//
+// Widgets hand a back bar and its target percent to the driver when a stat drops.
+// The driver moves every active bar from one world tick and stops ticking as soon
+// as all bars have settled, so an idle HUD costs nothing per frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SLFBarAnimationSubsystem.generated.h"
+
+class UProgressBar;
+
+/** One back bar catching up with its front bar */
+struct FSLFTrailingBar
+{
+	TWeakObjectPtr<UProgressBar> Bar;
+	float Current = 0.0f;
+	float Target = 0.0f;
+	float Speed = 0.0f;
+	float DelayRemaining = 0.0f;
+};
+
+UCLASS()
+class SLFCONVERSION_API USLFBarAnimationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Driver for the widget's world (nullptr in the UMG designer / editor preview) */
+	static USLFBarAnimationSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Move BackBar toward Target at Speed (percent per second) after Delay seconds.
+	 * A target at or above the bar's current value snaps immediately (healing).
+	 * Without a driver (designer preview) the bar is snapped.
+	 */
+	static void SetTrailTarget(const UObject* WorldContextObject, UProgressBar* BackBar, float Target, float Speed, float Delay = 0.0f);
+
+	/** Stop animating BackBar (widget destruct) */
+	void CancelTrail(const UProgressBar* BackBar);
+
+	/** Number of bars still moving (0 = driver asleep) */
+	int32 GetNumActiveTrails() const { return Trails.Num(); }
+
+	// UWorldSubsystem
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	void AddTrail(UProgressBar* BackBar, float Target, float Speed, float Delay);
+
+	TArray<FSLFTrailingBar> Trails;
+};
@@ -0,0 +1,154 @@
+// SLFMarkerLayer.cpp
+// Retained marker layer for the radar and world map
+
+#include "Widgets/SLFMarkerLayer.h"
+#include "Engine/Texture2D.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+
+DECLARE_CYCLE_STAT(TEXT("SLF Marker Layer Paint"), STAT_SLFMarkerLayerPaint, STATGROUP_Slate);
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// SLATE
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void SSLFMarkerLayer::Construct(const FArguments& InArgs, const TSharedRef<FSLFMarkerLayerData>& InData)
+{
+	Data = InData;
+	SetCanTick(false);
+}
+
+FVector2D SSLFMarkerLayer::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	// Fills whatever slot it is given; markers never drive layout
+	return FVector2D::ZeroVector;
+}
+
+int32 SSLFMarkerLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SLFMarkerLayerPaint);
+
+	const FSLFMarkerLayerData& Layer = *Data;
+	const FSLFMarkerDrawList& Markers = Layer.Markers;
+	const int32 Num = Markers.Num();
+	Layer.NumPainted = 0;
+	if (Num == 0)
+	{
+		return LayerId;
+	}
+
+	const FSlateBrush* FallbackBrush = FCoreStyle::Get().GetBrush(TEXT("GenericWhiteBox"));
+	const FLinearColor InheritedTint = InWidgetStyle.GetColorAndOpacityTint();
+	const FVector2f LocalSize = FVector2f(AllottedGeometry.GetLocalSize());
+
+	// Pixel offsets hang off the origin anchor; normalized positions scale by the layer size
+	const FVector2f PositionScale = Layer.bNormalizedPositions ? LocalSize : FVector2f::UnitVector;
+	const FVector2f PositionOffset = Layer.bNormalizedPositions ? FVector2f::ZeroVector : Layer.Origin * LocalSize;
+
+	const FVector2f* Positions = Markers.Positions.GetData();
+	const FVector2f* Sizes = Markers.Sizes.GetData();
+	const FLinearColor* Tints = Markers.Tints.GetData();
+	const uint16* BrushIndices = Markers.BrushIndices.GetData();
+
+	int32 NumPainted = 0;
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const FVector2f Size = Sizes[Index];
+		const FVector2f TopLeft = Positions[Index] * PositionScale + PositionOffset - Size * Layer.Pivot;
+
+		if (Layer.bCullOutside &&
+			(TopLeft.X > LocalSize.X || TopLeft.Y > LocalSize.Y || TopLeft.X + Size.X < 0.0f || TopLeft.Y + Size.Y < 0.0f))
+		{
+			continue;
+		}
+
+		const uint16 BrushIndex = BrushIndices[Index];
+		const FSlateBrush* Brush = Layer.Brushes.IsValidIndex(BrushIndex) ? &Layer.Brushes[BrushIndex] : FallbackBrush;
+
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(Size, FSlateLayoutTransform(TopLeft)),
+			Brush,
+			ESlateDrawEffect::None,
+			Tints[Index] * InheritedTint);
+		++NumPainted;
+	}
+
+	Layer.NumPainted = NumPainted;
+	return LayerId;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// UMG WRAPPER
+// ═══════════════════════════════════════════════════════════════════════════════
+
+USLFMarkerLayer::USLFMarkerLayer(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, Data(MakeShared<FSLFMarkerLayerData>())
+{
+	// Purely visual - clicks go to the owning widget
+	SetVisibility(ESlateVisibility::HitTestInvisible);
+}
+
+TSharedRef<SWidget> USLFMarkerLayer::RebuildWidget()
+{
+	MyMarkerLayer = SNew(SSLFMarkerLayer, Data);
+	return MyMarkerLayer.ToSharedRef();
+}
+
+void USLFMarkerLayer::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+	MyMarkerLayer.Reset();
+}
+
+void USLFMarkerLayer::SetLayout(const FVector2f& InOrigin, const FVector2f& InPivot, bool bInNormalizedPositions, bool bInCullOutside)
+{
+	Data->Origin = InOrigin;
+	Data->Pivot = InPivot;
+	Data->bNormalizedPositions = bInNormalizedPositions;
+	Data->bCullOutside = bInCullOutside;
+	CommitMarkers();
+}
+
+uint16 USLFMarkerLayer::FindOrAddBrush(UTexture2D* Texture)
+{
+	if (!Texture)
+	{
+		return NoBrush;
+	}
+
+	const int32 Existing = BrushTextures.IndexOfByKey(Texture);
+	if (Existing != INDEX_NONE)
+	{
+		return static_cast<uint16>(Existing);
+	}
+
+	if (BrushTextures.Num() >= NoBrush)
+	{
+		return NoBrush;
+	}
+
+	FSlateBrush& Brush = Data->Brushes.AddDefaulted_GetRef();
+	Brush.DrawAs = ESlateBrushDrawType::Image;
+	Brush.SetResourceObject(Texture);
+	Brush.ImageSize = FVector2D(Texture->GetSizeX(), Texture->GetSizeY());
+
+	return static_cast<uint16>(BrushTextures.Add(Texture));
+}
+
+void USLFMarkerLayer::CommitMarkers()
+{
+	if (MyMarkerLayer.IsValid())
+	{
+		MyMarkerLayer->Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void USLFMarkerLayer::ClearMarkers()
+{
+	Data->Markers.SetNum(0);
+	CommitMarkers();
+}
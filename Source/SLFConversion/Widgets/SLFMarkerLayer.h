@@ -0,0 +1,120 @@
+// SLFMarkerLayer.h
+// Retained marker layer for the radar and world map
+//
+// One Slate leaf widget draws every marker as a box from packed arrays in a single
+// OnPaint pass - no per-marker UUserWidget, slot or render transform. Owners edit the
+// draw list (usually just the positions) and commit, which invalidates paint only.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "Widgets/SLeafWidget.h"
+#include "Styling/SlateBrush.h"
+#include "SLFMarkerLayer.generated.h"
+
+class UTexture2D;
+
+/** Packed marker draw data (parallel arrays, one entry per marker) */
+struct FSLFMarkerDrawList
+{
+	/** Pixel offset from the layer origin, or viewport UV when the layer uses normalized positions */
+	TArray<FVector2f> Positions;
+	TArray<FVector2f> Sizes;
+	TArray<FLinearColor> Tints;
+
+	/** Index into the layer's brushes (USLFMarkerLayer::NoBrush = plain box) */
+	TArray<uint16> BrushIndices;
+
+	int32 Num() const { return Positions.Num(); }
+
+	void SetNum(int32 NewNum)
+	{
+		Positions.SetNumZeroed(NewNum, EAllowShrinking::No);
+		Sizes.SetNumZeroed(NewNum, EAllowShrinking::No);
+		Tints.SetNumZeroed(NewNum, EAllowShrinking::No);
+		BrushIndices.SetNumZeroed(NewNum, EAllowShrinking::No);
+	}
+};
+
+/** State shared between the UMG wrapper and its Slate widget (survives Slate rebuilds) */
+struct FSLFMarkerLayerData
+{
+	FSLFMarkerDrawList Markers;
+	TArray<FSlateBrush> Brushes;
+
+	/** Layer-relative anchor the pixel offsets are measured from (0.5,0 = top center) */
+	FVector2f Origin = FVector2f(0.5f, 0.5f);
+
+	/** Point of each marker box placed at its position (0.5,0.5 = centered) */
+	FVector2f Pivot = FVector2f(0.5f, 0.5f);
+
+	/** Positions are viewport UV (0..1 across the layer) instead of pixel offsets */
+	bool bNormalizedPositions = false;
+
+	/** Skip markers entirely outside the layer */
+	bool bCullOutside = true;
+
+	/** Markers drawn by the last paint pass (profiling) */
+	mutable int32 NumPainted = 0;
+};
+
+class SLFCONVERSION_API SSLFMarkerLayer : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSLFMarkerLayer) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<FSLFMarkerLayerData>& InData);
+
+	// SWidget
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+	TSharedPtr<FSLFMarkerLayerData> Data;
+};
+
+UCLASS()
+class SLFCONVERSION_API USLFMarkerLayer : public UWidget
+{
+	GENERATED_BODY()
+
+public:
+	USLFMarkerLayer(const FObjectInitializer& ObjectInitializer);
+
+	static constexpr uint16 NoBrush = MAX_uint16;
+
+	/** Placement mode - see FSLFMarkerLayerData */
+	void SetLayout(const FVector2f& InOrigin, const FVector2f& InPivot, bool bInNormalizedPositions, bool bInCullOutside);
+
+	/** Brush index for Texture, adding it on first use (NoBrush for nullptr) */
+	uint16 FindOrAddBrush(UTexture2D* Texture);
+
+	/** Mutable draw list - call CommitMarkers after editing */
+	FSLFMarkerDrawList& EditMarkers() { return Data->Markers; }
+	const FSLFMarkerDrawList& GetMarkers() const { return Data->Markers; }
+
+	/** Request a repaint (paint invalidation only, no layout) */
+	void CommitMarkers();
+
+	/** Remove every marker (brushes are kept) */
+	void ClearMarkers();
+
+	int32 GetNumPainted() const { return Data->NumPainted; }
+
+	// UWidget
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+protected:
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+private:
+	/** Keeps brush textures alive (FSlateBrush only holds a raw resource pointer) */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UTexture2D>> BrushTextures;
+
+	TSharedRef<FSLFMarkerLayerData> Data;
+	TSharedPtr<SSLFMarkerLayer> MyMarkerLayer;
+};
@@ -0,0 +1,239 @@
+// SLFSlotGridPool.cpp
+// Recycled, windowed slot widgets for uniform item grids
+
+#include "Widgets/SLFSlotGridPool.h"
+#include "Blueprint/UserWidget.h"
+#include "Components/UniformGridPanel.h"
+#include "Components/UniformGridSlot.h"
+#include "Engine/World.h"
+
+void USLFSlotGridPool::Initialize(UUniformGridPanel* InGrid, TSubclassOf<UUserWidget> InSlotClass, int32 InSlotsPerRow, int32 InVisibleRows, int32 InMinSlots)
+{
+	// Re-initializing onto a different grid or class invalidates the pool
+	if (Grid && (Grid != InGrid || SlotClass != InSlotClass))
+	{
+		Grid->ClearChildren();
+		Slots.Empty();
+		BoundEntries.Empty();
+		BoundValid.Empty();
+	}
+
+	// First use of this grid - drop designer placeholders / legacy children
+	if (Slots.Num() == 0 && InGrid)
+	{
+		InGrid->ClearChildren();
+	}
+
+	const int32 NewSlotsPerRow = FMath::Max(1, InSlotsPerRow);
+	const bool bRelayout = Slots.Num() > 0 && NewSlotsPerRow != SlotsPerRow;
+
+	Grid = InGrid;
+	SlotClass = InSlotClass;
+	SlotsPerRow = NewSlotsPerRow;
+	VisibleRows = FMath::Max(0, InVisibleRows);
+	MinSlots = FMath::Max(0, InMinSlots);
+	FirstVisibleRow = 0;
+
+	// Column count changed (e.g. different vendor) - move the existing widgets instead of recreating them
+	if (bRelayout)
+	{
+		for (int32 Index = 0; Index < Slots.Num(); ++Index)
+		{
+			if (UUniformGridSlot* GridSlot = Slots[Index] ? Cast<UUniformGridSlot>(Slots[Index]->Slot) : nullptr)
+			{
+				GridSlot->SetRow(Index / SlotsPerRow);
+				GridSlot->SetColumn(Index % SlotsPerRow);
+			}
+		}
+	}
+
+	const int32 WindowSlots = VisibleRows > 0 ? VisibleRows * SlotsPerRow : MinSlots;
+	EnsurePoolSize(WindowSlots);
+
+	// Callers follow up with SetEntries, which binds every slot once
+	InvalidateBindings();
+}
+
+int32 USLFSlotGridPool::GetNumActiveSlots() const
+{
+	if (VisibleRows > 0)
+	{
+		const int32 WindowSlots = VisibleRows * SlotsPerRow;
+		return MinSlots > 0 ? WindowSlots : FMath::Clamp(Entries.Num() - FirstVisibleRow * SlotsPerRow, 0, WindowSlots);
+	}
+	return FMath::Max(MinSlots, Entries.Num());
+}
+
+int32 USLFSlotGridPool::GetMaxFirstVisibleRow() const
+{
+	if (VisibleRows <= 0)
+	{
+		return 0;
+	}
+	const int32 TotalRows = FMath::DivideAndRoundUp(Entries.Num(), SlotsPerRow);
+	return FMath::Max(0, TotalRows - VisibleRows);
+}
+
+void USLFSlotGridPool::SetEntries(TArray<FSLFSlotGridEntry>&& NewEntries, bool bResetScroll)
+{
+	Entries = MoveTemp(NewEntries);
+	if (bResetScroll)
+	{
+		FirstVisibleRow = 0;
+	}
+
+	// Keep the window valid when the list shrinks (filter switch, items consumed)
+	FirstVisibleRow = FMath::Clamp(FirstVisibleRow, 0, GetMaxFirstVisibleRow());
+
+	EnsurePoolSize(GetNumActiveSlots());
+	RebindWindow();
+}
+
+bool USLFSlotGridPool::ScrollByRows(int32 DeltaRows)
+{
+	const int32 NewFirstRow = FMath::Clamp(FirstVisibleRow + DeltaRows, 0, GetMaxFirstVisibleRow());
+	if (NewFirstRow == FirstVisibleRow)
+	{
+		return false;
+	}
+
+	FirstVisibleRow = NewFirstRow;
+	RebindWindow();
+	return true;
+}
+
+int32 USLFSlotGridPool::ScrollToEntry(int32 EntryIndex)
+{
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		return INDEX_NONE;
+	}
+
+	if (VisibleRows > 0)
+	{
+		const int32 EntryRow = EntryIndex / SlotsPerRow;
+		if (EntryRow < FirstVisibleRow)
+		{
+			ScrollByRows(EntryRow - FirstVisibleRow);
+		}
+		else if (EntryRow >= FirstVisibleRow + VisibleRows)
+		{
+			ScrollByRows(EntryRow - (FirstVisibleRow + VisibleRows - 1));
+		}
+	}
+
+	return EntryIndex - FirstVisibleRow * SlotsPerRow;
+}
+
+void USLFSlotGridPool::SyncEntry(int32 EntryIndex, const FSLFSlotGridEntry& Entry)
+{
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	Entries[EntryIndex] = Entry;
+
+	const int32 SlotIndex = EntryIndex - FirstVisibleRow * SlotsPerRow;
+	if (BoundValid.IsValidIndex(SlotIndex) && SlotIndex < GetNumActiveSlots())
+	{
+		BoundEntries[SlotIndex] = Entry;
+	}
+}
+
+int32 USLFSlotGridPool::StepSelection(int32 SlotIndex, int32 DeltaEntries, bool bWrap)
+{
+	const int32 NumEntries = Entries.Num();
+	if (NumEntries == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 EntryIndex = FMath::Clamp(GetEntryIndexForSlot(FMath::Max(SlotIndex, 0)), 0, NumEntries - 1) + DeltaEntries;
+	EntryIndex = bWrap ? ((EntryIndex % NumEntries) + NumEntries) % NumEntries : FMath::Clamp(EntryIndex, 0, NumEntries - 1);
+
+	return ScrollToEntry(EntryIndex);
+}
+
+void USLFSlotGridPool::InvalidateBindings()
+{
+	BoundValid.Init(false, Slots.Num());
+}
+
+void USLFSlotGridPool::EnsurePoolSize(int32 NumSlots)
+{
+	if (!Grid || !SlotClass || Slots.Num() >= NumSlots)
+	{
+		return;
+	}
+
+	// Owner is the widget (or world, for benchmarks) that created the pool
+	UObject* Owner = GetOuter();
+	Slots.Reserve(NumSlots);
+
+	while (Slots.Num() < NumSlots)
+	{
+		UUserWidget* NewSlot = nullptr;
+		if (UWidget* OwnerWidget = Cast<UWidget>(Owner))
+		{
+			NewSlot = CreateWidget<UUserWidget>(OwnerWidget, SlotClass);
+		}
+		else if (UWorld* OwnerWorld = Cast<UWorld>(Owner))
+		{
+			NewSlot = CreateWidget<UUserWidget>(OwnerWorld, SlotClass);
+		}
+
+		if (!NewSlot)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SLFSlotGridPool] Failed to create slot widget %d (%s)"),
+				Slots.Num(), *GetNameSafe(SlotClass));
+			break;
+		}
+
+		const int32 Index = Slots.Num();
+		Grid->AddChildToUniformGrid(NewSlot, Index / SlotsPerRow, Index % SlotsPerRow);
+		Slots.Add(NewSlot);
+		BoundEntries.AddDefaulted();
+		BoundValid.Add(false);
+		++NumWidgetsCreated;
+
+		OnSlotCreated.ExecuteIfBound(NewSlot);
+	}
+}
+
+void USLFSlotGridPool::RebindWindow()
+{
+	const int32 ActiveSlots = FMath::Min(GetNumActiveSlots(), Slots.Num());
+	const int32 FirstEntry = FirstVisibleRow * SlotsPerRow;
+	static const FSLFSlotGridEntry EmptyEntry;
+
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		UUserWidget* SlotWidget = Slots[SlotIndex];
+		if (!SlotWidget)
+		{
+			continue;
+		}
+
+		// Surplus slots (unwindowed pools after a shrink, a partial last window) are parked, not destroyed
+		const bool bActive = SlotIndex < ActiveSlots;
+		const ESlateVisibility WantedVisibility = bActive ? ESlateVisibility::Visible : ESlateVisibility::Collapsed;
+		if (SlotWidget->GetVisibility() != WantedVisibility)
+		{
+			SlotWidget->SetVisibility(WantedVisibility);
+		}
+
+		const int32 EntryIndex = FirstEntry + SlotIndex;
+		const FSLFSlotGridEntry& Wanted = (bActive && Entries.IsValidIndex(EntryIndex)) ? Entries[EntryIndex] : EmptyEntry;
+
+		if (BoundValid[SlotIndex] && BoundEntries[SlotIndex] == Wanted)
+		{
+			continue;
+		}
+
+		OnBindSlot.ExecuteIfBound(SlotWidget, Wanted.Item ? &Wanted : nullptr);
+		BoundEntries[SlotIndex] = Wanted;
+		BoundValid[SlotIndex] = true;
+		++NumSlotBinds;
+	}
+}
@@ -0,0 +1,182 @@
+// SLFSlotGridPool.h
+// Recycled, windowed slot widgets for uniform item grids
+//
+// Shared by W_Inventory, W_Equipment, W_NPC_Window_Vendor and W_Crafting.
+// Slot widgets are created once (a fixed window of VisibleRows x SlotsPerRow, or
+// grown on demand when unwindowed) and rebound to item data on refresh, filter
+// or scroll. Each slot remembers the entry it was last bound to, so a refresh
+// only touches slots whose item/count/state actually changed.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "SLFSlotGridPool.generated.h"
+
+class UUserWidget;
+class UUniformGridPanel;
+
+/** One item shown in a pooled grid */
+USTRUCT()
+struct SLFCONVERSION_API FSLFSlotGridEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UObject* Item = nullptr;
+
+	UPROPERTY()
+	int32 Count = 0;
+
+	/** Widget-specific state folded into the diff key (price, craftable, equipped...) */
+	UPROPERTY()
+	int32 UserData = 0;
+
+	/** Extra widget-specific bits (e.g. vendor infinite stock) */
+	UPROPERTY()
+	int32 UserFlags = 0;
+
+	FSLFSlotGridEntry() {}
+	FSLFSlotGridEntry(UObject* InItem, int32 InCount, int32 InUserData = 0, int32 InUserFlags = 0)
+		: Item(InItem), Count(InCount), UserData(InUserData), UserFlags(InUserFlags) {}
+
+	bool operator==(const FSLFSlotGridEntry& Other) const
+	{
+		return Item == Other.Item && Count == Other.Count && UserData == Other.UserData && UserFlags == Other.UserFlags;
+	}
+	bool operator!=(const FSLFSlotGridEntry& Other) const { return !(*this == Other); }
+};
+
+/** Called once per newly created slot widget (bind dispatchers, set flags) */
+DECLARE_DELEGATE_OneParam(FSLFOnGridSlotCreated, UUserWidget* /*SlotWidget*/);
+
+/** Called when a slot must show Entry (nullptr = show empty) */
+DECLARE_DELEGATE_TwoParams(FSLFOnBindGridSlot, UUserWidget* /*SlotWidget*/, const FSLFSlotGridEntry* /*Entry*/);
+
+UCLASS()
+class SLFCONVERSION_API USLFSlotGridPool : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @param InGrid         Grid panel the slots live in
+	 * @param InSlotClass    Slot widget class
+	 * @param InSlotsPerRow  Columns
+	 * @param InVisibleRows  Rows in the viewport window (0 = unwindowed, pool grows to fit all entries)
+	 * @param InMinSlots     Slots always shown, even when empty (inventory look). A windowed pool
+	 *                       with MinSlots shows its whole window; without, only the entries in it.
+	 *
+	 * Safe to call again on the same grid: existing widgets are kept (and re-laid out if
+	 * the column count changed). All bindings are invalidated - call SetEntries next.
+	 */
+	void Initialize(UUniformGridPanel* InGrid, TSubclassOf<UUserWidget> InSlotClass, int32 InSlotsPerRow, int32 InVisibleRows, int32 InMinSlots);
+
+	bool IsInitialized() const { return Grid != nullptr && SlotClass != nullptr; }
+
+	/** Replace the item list and rebind only the slots whose entry changed (optionally jumping back to the first row) */
+	void SetEntries(TArray<FSLFSlotGridEntry>&& NewEntries, bool bResetScroll = false);
+
+	/**
+	 * Record a change a slot widget already made to itself (e.g. a vendor slot after a purchase),
+	 * so the entry survives scrolling away and back. A visible slot is not rebound.
+	 */
+	void SyncEntry(int32 EntryIndex, const FSLFSlotGridEntry& Entry);
+
+	/** Drop every entry (slots are kept for reuse) */
+	void ClearEntries() { SetEntries(TArray<FSLFSlotGridEntry>()); }
+
+	/** Scroll the window by whole rows. Returns true if the window moved. */
+	bool ScrollByRows(int32 DeltaRows);
+
+	/** Scroll so EntryIndex is inside the window. Returns the slot index now showing it (INDEX_NONE if invalid). */
+	int32 ScrollToEntry(int32 EntryIndex);
+
+	/**
+	 * Move a selection DeltaEntries away from the entry shown in SlotIndex, scrolling the window to it.
+	 * bWrap wraps around the entry list, otherwise a step past either end stops at that end.
+	 * Returns the slot index now showing the target (INDEX_NONE if there is nothing to select).
+	 */
+	int32 StepSelection(int32 SlotIndex, int32 DeltaEntries, bool bWrap);
+
+	/** Force every visible slot to rebind on the next refresh (e.g. widget-side state was reset) */
+	void InvalidateBindings();
+
+	const TArray<UUserWidget*>& GetSlots() const { return Slots; }
+
+	template <typename SlotType>
+	void GetSlotsAs(TArray<SlotType*>& OutSlots) const
+	{
+		OutSlots.Reset(Slots.Num());
+		for (UUserWidget* SlotWidget : Slots)
+		{
+			if (SlotType* Typed = Cast<SlotType>(SlotWidget))
+			{
+				OutSlots.Add(Typed);
+			}
+		}
+	}
+
+	/** Only the slots in use (surplus slots of an unwindowed pool are collapsed and skipped) */
+	template <typename SlotType>
+	void GetActiveSlotsAs(TArray<SlotType*>& OutSlots) const
+	{
+		const int32 NumActive = FMath::Min(GetNumActiveSlots(), Slots.Num());
+		OutSlots.Reset(NumActive);
+		for (int32 SlotIndex = 0; SlotIndex < NumActive; ++SlotIndex)
+		{
+			if (SlotType* Typed = Cast<SlotType>(Slots[SlotIndex]))
+			{
+				OutSlots.Add(Typed);
+			}
+		}
+	}
+
+	/** Slots currently in use (windowed: whole window, or the entries in it without MinSlots; unwindowed: max(MinSlots, entries)) */
+	int32 GetNumActiveSlots() const;
+
+	const TArray<FSLFSlotGridEntry>& GetEntries() const { return Entries; }
+	int32 GetEntryIndexForSlot(int32 SlotIndex) const { return FirstVisibleRow * SlotsPerRow + SlotIndex; }
+	int32 GetFirstVisibleRow() const { return FirstVisibleRow; }
+	int32 GetMaxFirstVisibleRow() const;
+	int32 GetSlotsPerRow() const { return SlotsPerRow; }
+
+	FSLFOnGridSlotCreated OnSlotCreated;
+	FSLFOnBindGridSlot OnBindSlot;
+
+	/** Counters for profiling (benchmarks and `stat` style logging) */
+	int32 GetNumWidgetsCreated() const { return NumWidgetsCreated; }
+	int32 GetNumSlotBinds() const { return NumSlotBinds; }
+	void ResetCounters() { NumWidgetsCreated = 0; NumSlotBinds = 0; }
+
+private:
+	void EnsurePoolSize(int32 NumSlots);
+	void RebindWindow();
+
+	UPROPERTY()
+	UUniformGridPanel* Grid = nullptr;
+
+	UPROPERTY()
+	TSubclassOf<UUserWidget> SlotClass;
+
+	UPROPERTY()
+	TArray<UUserWidget*> Slots;
+
+	UPROPERTY()
+	TArray<FSLFSlotGridEntry> Entries;
+
+	/** What each slot currently shows (diff baseline) */
+	UPROPERTY()
+	TArray<FSLFSlotGridEntry> BoundEntries;
+
+	/** Whether BoundEntries[i] is trustworthy */
+	TBitArray<> BoundValid;
+
+	int32 SlotsPerRow = 8;
+	int32 VisibleRows = 0;
+	int32 MinSlots = 0;
+	int32 FirstVisibleRow = 0;
+
+	int32 NumWidgetsCreated = 0;
+	int32 NumSlotBinds = 0;
+};
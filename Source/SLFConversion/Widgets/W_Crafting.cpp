@@ -9,6 +9,7 @@
 #include "Widgets/W_Crafting.h"
 #include "Widgets/W_InventorySlot.h"
 #include "Widgets/W_CraftingAction.h"
+#include "Widgets/SLFSlotGridPool.h"
 #include "Components/InventoryManagerComponent.h"
 #include "Components/TextBlock.h"
 #include "Components/Image.h"
@@ -28,10 +29,12 @@ UW_Crafting::UW_Crafting(const FObjectInitializer& ObjectInitializer)
 	, SelectedSlot(nullptr)
 	, ActiveSlot(nullptr)
 	, NavigationIndex(0)
+	, CraftingGridVisibleRows(4)
 	, CraftingActionPopup(nullptr)
 	, ItemInfoBoxSwitcher(nullptr)
 	, UniformCraftingItemsGrid(nullptr)
 	, W_CraftingAction(nullptr)
+	, CraftingSlotPool(nullptr)
 {
 }
 
@@ -202,6 +205,16 @@ FReply UW_Crafting::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent
 	return Super::NativeOnKeyDown(InGeometry, InKeyEvent);
 }
 
+FReply UW_Crafting::NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	const float WheelDelta = InMouseEvent.GetWheelDelta();
+	if (WheelDelta != 0.0f && ScrollCraftingGrid(WheelDelta > 0.0f ? -1 : 1))
+	{
+		return FReply::Handled();
+	}
+	return Super::NativeOnMouseWheel(InGeometry, InMouseEvent);
+}
+
 void UW_Crafting::CacheWidgetReferences()
 {
 	// Cache CraftingActionPopup (Overlay)
@@ -404,27 +417,41 @@ bool UW_Crafting::CheckIfCraftable_Implementation(UPrimaryDataAsset* ItemAsset)
  *    - Add to grid at calculated row/column (4 columns)
  *    - Add to CraftingSlots and UnlockedCraftableEntries arrays
  * 5. After loop, if slots exist, select first slot
+ *
+ * Slot widgets come from CraftingSlotPool: they are created once, and a refresh
+ * only rebinds slots whose item or craftable state changed.
  */
 void UW_Crafting::RefreshCraftables_Implementation()
 {
 	UE_LOG(LogTemp, Log, TEXT("UW_Crafting::RefreshCraftables"));
 
-	// Clear existing slots
-	CraftingSlots.Empty();
-	UnlockedCraftableEntries.Empty();
+	const int32 ColumnsPerRow = 4;
 
-	// Clear grid children
-	if (UniformCraftingItemsGrid)
+	if (!CraftingSlotPool)
 	{
-		UniformCraftingItemsGrid->ClearChildren();
+		CraftingSlotPool = NewObject<USLFSlotGridPool>(this);
+		CraftingSlotPool->OnSlotCreated.BindUObject(this, &UW_Crafting::HandleCraftingSlotCreated);
+		CraftingSlotPool->OnBindSlot.BindUObject(this, &UW_Crafting::BindCraftingSlot);
+	}
+
+	if (!CraftingSlotPool->IsInitialized() && UniformCraftingItemsGrid)
+	{
+		TSubclassOf<UUserWidget> SlotClass = SlotWidgetClass;
+		if (!SlotClass)
+		{
+			// Fallback to loading class from path
+			SlotClass = LoadClass<UW_InventorySlot>(nullptr, TEXT("/Game/SoulslikeFramework/Widgets/Inventory/W_InventorySlot.W_InventorySlot_C"));
+		}
+		// Windowed: only CraftingGridVisibleRows rows of slot widgets exist, however many recipes unlock
+		CraftingSlotPool->Initialize(UniformCraftingItemsGrid, SlotClass, ColumnsPerRow, FMath::Max(CraftingGridVisibleRows, 1), 0);
 	}
 
 	// Get all values from UnlockedCraftables map
 	TArray<UPrimaryDataAsset*> CraftableItems;
 	UnlockedCraftables.GenerateValueArray(CraftableItems);
 
-	const int32 ColumnsPerRow = 4;
-	int32 Index = 0;
+	TArray<FSLFSlotGridEntry> Entries;
+	Entries.Reserve(CraftableItems.Num());
 
 	// Process each unlocked craftable
 	for (UPrimaryDataAsset* ItemAsset : CraftableItems)
@@ -440,73 +467,132 @@ void UW_Crafting::RefreshCraftables_Implementation()
 		UE_LOG(LogTemp, Log, TEXT("  Item: %s, CanCraft: %s"),
 			*ItemAsset->GetName(), bCanCraft ? TEXT("true") : TEXT("false"));
 
-		// Create slot widget
-		UW_InventorySlot* SlotWidget = nullptr;
-		if (SlotWidgetClass)
-		{
-			SlotWidget = CreateWidget<UW_InventorySlot>(GetOwningPlayer(), SlotWidgetClass);
-		}
-		else
-		{
-			// Fallback to loading class from path
-			UClass* SlotClass = LoadClass<UW_InventorySlot>(nullptr, TEXT("/Game/SoulslikeFramework/Widgets/Inventory/W_InventorySlot.W_InventorySlot_C"));
-			if (SlotClass)
-			{
-				SlotWidget = CreateWidget<UW_InventorySlot>(GetOwningPlayer(), SlotClass);
-			}
-		}
+		// Craftable state is part of the diff key so toggles rebind the slot
+		Entries.Emplace(ItemAsset, 1, bCanCraft ? 1 : 0);
+	}
 
-		if (!SlotWidget)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[W_Crafting] Failed to create slot widget for %s"), *ItemAsset->GetName());
-			continue;
-		}
+	const int32 BindsBefore = CraftingSlotPool->GetNumSlotBinds();
+	// Selection restarts at the first craftable, so the window does too
+	CraftingSlotPool->SetEntries(MoveTemp(Entries), true);
+	SyncCraftingSlots();
 
-		// Mark as crafting related
-		SlotWidget->CraftingRelated = true;
+	// Broadcast update event
+	EventOnCraftablesUpdated();
 
-		// Bind dispatchers
-		SlotWidget->OnSelected.AddDynamic(this, &UW_Crafting::EventOnCraftingSlotSelected);
-		SlotWidget->OnPressed.AddDynamic(this, &UW_Crafting::EventOnCraftingSlotPressed);
+	// Select first slot if any exist
+	if (CraftingSlots.Num() > 0)
+	{
+		NavigationIndex = 0;
+		ActiveSlot = CraftingSlots[0];
+		EventOnCraftingSlotSelected(true, ActiveSlot);
+	}
 
-		// Occupy slot with item
-		if (UPDA_Item* Item = Cast<UPDA_Item>(ItemAsset))
-		{
-			SlotWidget->EventOccupySlot(Item, 1);
-		}
+	UE_LOG(LogTemp, Log, TEXT("  Refreshed %d craftables, %d slots active, %d rebound"),
+		UnlockedCraftables.Num(), CraftingSlots.Num(), CraftingSlotPool->GetNumSlotBinds() - BindsBefore);
+}
 
-		// Enable/disable based on craftability
-		SlotWidget->CraftingSlotEnabled = bCanCraft;
-		SlotWidget->EventToggleSlot(bCanCraft);
+/**
+ * SyncCraftingSlots - Tracking arrays mirror the active pooled slots
+ */
+void UW_Crafting::SyncCraftingSlots()
+{
+	CraftingSlotPool->GetActiveSlotsAs(CraftingSlots);
+	UnlockedCraftableEntries = CraftingSlots;
+}
 
-		// Add to grid at calculated position
-		if (UniformCraftingItemsGrid)
-		{
-			int32 Row = Index / ColumnsPerRow;
-			int32 Column = Index % ColumnsPerRow;
-			UniformCraftingItemsGrid->AddChildToUniformGrid(SlotWidget, Row, Column);
-		}
+/**
+ * StepCraftingSelection - Move the selection through every craftable, not just the visible window
+ */
+void UW_Crafting::StepCraftingSelection(int32 DeltaEntries)
+{
+	if (!CraftingSlotPool)
+	{
+		return;
+	}
 
-		// Add to tracking arrays
-		CraftingSlots.Add(SlotWidget);
-		UnlockedCraftableEntries.Add(SlotWidget);
+	const int32 SlotIndex = CraftingSlotPool->StepSelection(NavigationIndex, DeltaEntries, false);
+	SyncCraftingSlots();
 
-		Index++;
+	if (UnlockedCraftableEntries.IsValidIndex(SlotIndex))
+	{
+		NavigationIndex = SlotIndex;
+		ActiveSlot = UnlockedCraftableEntries[NavigationIndex];
+		EventOnCraftingSlotSelected(true, ActiveSlot);
 	}
+}
 
-	// Broadcast update event
-	EventOnCraftablesUpdated();
+/**
+ * ScrollCraftingGrid - Scroll the craftables window by whole rows
+ */
+bool UW_Crafting::ScrollCraftingGrid(int32 DeltaRows)
+{
+	if (!CraftingSlotPool || !CraftingSlotPool->ScrollByRows(DeltaRows))
+	{
+		return false;
+	}
 
-	// Select first slot if any exist
-	if (CraftingSlots.Num() > 0)
+	// Slot widgets keep their index; re-run selection so the info panel shows the new item
+	SyncCraftingSlots();
+	if (UnlockedCraftableEntries.Num() > 0)
 	{
-		NavigationIndex = 0;
-		ActiveSlot = CraftingSlots[0];
+		NavigationIndex = FMath::Clamp(NavigationIndex, 0, UnlockedCraftableEntries.Num() - 1);
+		ActiveSlot = UnlockedCraftableEntries[NavigationIndex];
 		EventOnCraftingSlotSelected(true, ActiveSlot);
 	}
+	return true;
+}
+
+/**
+ * HandleCraftingSlotCreated - One-time setup for a pooled craftable slot
+ */
+void UW_Crafting::HandleCraftingSlotCreated(UUserWidget* SlotWidget)
+{
+	UW_InventorySlot* CraftSlot = Cast<UW_InventorySlot>(SlotWidget);
+	if (!CraftSlot)
+	{
+		return;
+	}
+
+	// Mark as crafting related
+	CraftSlot->CraftingRelated = true;
 
-	UE_LOG(LogTemp, Log, TEXT("  Refreshed %d craftables, %d slots created"),
-		UnlockedCraftables.Num(), CraftingSlots.Num());
+	// Bind dispatchers
+	CraftSlot->OnSelected.AddDynamic(this, &UW_Crafting::EventOnCraftingSlotSelected);
+	CraftSlot->OnPressed.AddDynamic(this, &UW_Crafting::EventOnCraftingSlotPressed);
+}
+
+/**
+ * BindCraftingSlot - Show a craftable (UserData = craftable flag) in a pooled slot
+ */
+void UW_Crafting::BindCraftingSlot(UUserWidget* SlotWidget, const FSLFSlotGridEntry* Entry)
+{
+	UW_InventorySlot* CraftSlot = Cast<UW_InventorySlot>(SlotWidget);
+	if (!CraftSlot)
+	{
+		return;
+	}
+
+	UPDA_Item* Item = Entry ? Cast<UPDA_Item>(Entry->Item) : nullptr;
+	if (CraftSlot->IsOccupied && CraftSlot->AssignedItem != Item)
+	{
+		CraftSlot->EventClearSlot(false);
+	}
+
+	if (!Entry)
+	{
+		return;
+	}
+
+	// Occupy slot with item
+	if (Item && !CraftSlot->IsOccupied)
+	{
+		CraftSlot->EventOccupySlot(Item, Entry->Count);
+	}
+
+	// Enable/disable based on craftability
+	const bool bCanCraft = Entry->UserData != 0;
+	CraftSlot->CraftingSlotEnabled = bCanCraft;
+	CraftSlot->EventToggleSlot(bCanCraft);
 }
 
 void UW_Crafting::EventAsyncLoadCraftables_Implementation()
@@ -663,34 +749,20 @@ void UW_Crafting::EventNavigateDown_Implementation()
 		return;
 	}
 
-	// Move to next row (based on slots per row)
-	int32 SlotsPerRow = 4; // Would be configured
-	NavigationIndex = FMath::Min(NavigationIndex + SlotsPerRow, UnlockedCraftableEntries.Num() - 1);
-
-	// Update selection
-	if (UnlockedCraftableEntries.IsValidIndex(NavigationIndex))
-	{
-		ActiveSlot = UnlockedCraftableEntries[NavigationIndex];
-		EventOnCraftingSlotSelected(true, ActiveSlot);
-	}
+	// Move to next row (stops at the last craftable)
+	StepCraftingSelection(CraftingSlotPool ? CraftingSlotPool->GetSlotsPerRow() : 1);
 }
 
 void UW_Crafting::EventNavigateLeft_Implementation()
 {
 	UE_LOG(LogTemp, Log, TEXT("UW_Crafting::EventNavigateLeft"));
 
-	if (UnlockedCraftableEntries.Num() == 0 || NavigationIndex <= 0)
+	if (UnlockedCraftableEntries.Num() == 0)
 	{
 		return;
 	}
 
-	NavigationIndex--;
-
-	if (UnlockedCraftableEntries.IsValidIndex(NavigationIndex))
-	{
-		ActiveSlot = UnlockedCraftableEntries[NavigationIndex];
-		EventOnCraftingSlotSelected(true, ActiveSlot);
-	}
+	StepCraftingSelection(-1);
 }
 
 void UW_Crafting::EventNavigateOk_Implementation()
@@ -713,13 +785,7 @@ void UW_Crafting::EventNavigateRight_Implementation()
 		return;
 	}
 
-	NavigationIndex = FMath::Min(NavigationIndex + 1, UnlockedCraftableEntries.Num() - 1);
-
-	if (UnlockedCraftableEntries.IsValidIndex(NavigationIndex))
-	{
-		ActiveSlot = UnlockedCraftableEntries[NavigationIndex];
-		EventOnCraftingSlotSelected(true, ActiveSlot);
-	}
+	StepCraftingSelection(1);
 }
 
 void UW_Crafting::EventNavigateUp_Implementation()
@@ -731,15 +797,8 @@ void UW_Crafting::EventNavigateUp_Implementation()
 		return;
 	}
 
-	// Move to previous row
-	int32 SlotsPerRow = 4;
-	NavigationIndex = FMath::Max(0, NavigationIndex - SlotsPerRow);
-
-	if (UnlockedCraftableEntries.IsValidIndex(NavigationIndex))
-	{
-		ActiveSlot = UnlockedCraftableEntries[NavigationIndex];
-		EventOnCraftingSlotSelected(true, ActiveSlot);
-	}
+	// Move to previous row (stops at the first craftable)
+	StepCraftingSelection(CraftingSlotPool ? -CraftingSlotPool->GetSlotsPerRow() : -1);
 }
 
 void UW_Crafting::EventOnCraftablesUpdated_Implementation()
@@ -26,6 +26,8 @@
 class UW_EquipmentSlot;
 class UW_InventorySlot;
 class UW_CraftingAction;
+class USLFSlotGridPool;
+struct FSLFSlotGridEntry;
 class UOverlay;
 class UWidgetSwitcher;
 class UUniformGridPanel;
@@ -54,9 +56,10 @@ public:
 
 	// Input handling (replaces Blueprint EventGraph input bindings)
 	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
+	virtual FReply NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 
 	// ═══════════════════════════════════════════════════════════════════════
-	// VARIABLES (7)
+	// VARIABLES (8)
 	// ═══════════════════════════════════════════════════════════════════════
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Default")
@@ -74,6 +77,9 @@ public:
 	TMap<FGameplayTag, UPrimaryDataAsset*> UnlockedCraftables;
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Default")
 	int32 NavigationIndex;
+	/** Rows of craftable slots kept alive; longer craftable lists scroll through this window */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Config", meta = (ClampMin = "1"))
+	int32 CraftingGridVisibleRows;
 
 	// ═══════════════════════════════════════════════════════════════════════
 	// WIDGET REFERENCES (from WidgetTree)
@@ -188,4 +194,21 @@ protected:
 	// Handler for W_CraftingAction's OnCraftingActionClosed delegate
 	UFUNCTION()
 	void HandleCraftingActionClosed();
+
+	// Pool callbacks for the craftables grid
+	void HandleCraftingSlotCreated(UUserWidget* SlotWidget);
+	void BindCraftingSlot(UUserWidget* SlotWidget, const FSLFSlotGridEntry* Entry);
+
+	// Move the selection DeltaEntries craftables (clamped), scrolling the slot window to it
+	void StepCraftingSelection(int32 DeltaEntries);
+
+	// Scroll the craftables window by whole rows, keeping the selected slot index
+	bool ScrollCraftingGrid(int32 DeltaRows);
+
+	// Re-read the active pooled slots after the window moved
+	void SyncCraftingSlots();
+
+	// Recycled craftable slots - RefreshCraftables rebinds instead of recreating
+	UPROPERTY(Transient)
+	USLFSlotGridPool* CraftingSlotPool;
 };
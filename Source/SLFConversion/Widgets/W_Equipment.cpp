@@ -8,6 +8,7 @@
 #include "Widgets/W_Equipment.h"
 #include "Widgets/W_EquipmentSlot.h"
 #include "Widgets/W_InventorySlot.h"
+#include "Widgets/SLFSlotGridPool.h"
 #include "Widgets/W_GenericError.h"
 #include "Widgets/W_Equipment_Item_AttackPower.h"
 #include "Widgets/W_Equipment_Item_StatScaling.h"
@@ -53,6 +54,8 @@ UW_Equipment::UW_Equipment(const FObjectInitializer& ObjectInitializer)
 	, CurrentGridRow(0)
 	, CurrentGridColumn(0)
 	, EquipmentSlotClass(nullptr)
+	, ItemGridVisibleRows(5)
+	, EquipmentItemSlotPool(nullptr)
 {
 }
 
@@ -213,15 +216,8 @@ void UW_Equipment::NativeDestruct()
 		}
 	}
 
-	// Clear inventory slot bindings
-	for (UW_InventorySlot* InvSlot : EquipmentInventorySlots)
-	{
-		if (IsValid(InvSlot))
-		{
-			InvSlot->OnSelected.RemoveAll(this);
-			InvSlot->OnPressed.RemoveAll(this);
-		}
-	}
+	// Item selection slots are pooled children of this widget - their bindings are made
+	// once at creation and must survive a destruct/construct cycle, so they are kept.
 
 	OnVisibilityChanged.RemoveAll(this);
 
@@ -295,6 +291,16 @@ FReply UW_Equipment::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEven
 	return Super::NativeOnKeyDown(InGeometry, InKeyEvent);
 }
 
+FReply UW_Equipment::NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	const float WheelDelta = InMouseEvent.GetWheelDelta();
+	if (WheelDelta != 0.0f && EquipmentInventorySlots.Num() > 0 && ScrollItemGrid(WheelDelta > 0.0f ? -1 : 1))
+	{
+		return FReply::Handled();
+	}
+	return Super::NativeOnMouseWheel(InGeometry, InMouseEvent);
+}
+
 void UW_Equipment::CacheWidgetReferences()
 {
 	// BindWidgetOptional handles most caching automatically
@@ -1254,24 +1260,8 @@ void UW_Equipment::EventNavigateUp_Implementation()
 	// Check if we're in item selection view (has inventory slots to navigate)
 	if (EquipmentInventorySlots.Num() > 0)
 	{
-		// Navigate through inventory items
-		if (ActiveItemSlot)
-		{
-			ActiveItemSlot->EventOnSelected(false);
-		}
-
-		ItemNavigationIndex--;
-		if (ItemNavigationIndex < 0)
-		{
-			ItemNavigationIndex = EquipmentInventorySlots.Num() - 1;
-		}
-
-		ActiveItemSlot = EquipmentInventorySlots[ItemNavigationIndex];
-		if (ActiveItemSlot)
-		{
-			ActiveItemSlot->EventOnSelected(true);
-			UE_LOG(LogTemp, Log, TEXT("[W_Equipment] EventNavigateUp - Selected item %d of %d"), ItemNavigationIndex + 1, EquipmentInventorySlots.Num());
-		}
+		// Navigate through inventory items (scrolls the slot window past its edges)
+		StepItemSelection(-1);
 		return;
 	}
 
@@ -1305,24 +1295,8 @@ void UW_Equipment::EventNavigateDown_Implementation()
 	// Check if we're in item selection view (has inventory slots to navigate)
 	if (EquipmentInventorySlots.Num() > 0)
 	{
-		// Navigate through inventory items
-		if (ActiveItemSlot)
-		{
-			ActiveItemSlot->EventOnSelected(false);
-		}
-
-		ItemNavigationIndex++;
-		if (ItemNavigationIndex >= EquipmentInventorySlots.Num())
-		{
-			ItemNavigationIndex = 0;
-		}
-
-		ActiveItemSlot = EquipmentInventorySlots[ItemNavigationIndex];
-		if (ActiveItemSlot)
-		{
-			ActiveItemSlot->EventOnSelected(true);
-			UE_LOG(LogTemp, Log, TEXT("[W_Equipment] EventNavigateDown - Selected item %d of %d"), ItemNavigationIndex + 1, EquipmentInventorySlots.Num());
-		}
+		// Navigate through inventory items (scrolls the slot window past its edges)
+		StepItemSelection(1);
 		return;
 	}
 
@@ -1356,23 +1330,8 @@ void UW_Equipment::EventNavigateLeft_Implementation()
 	// If viewing item list, navigate in items (grid: move left by 1 slot)
 	if (EquipmentInventorySlots.Num() > 0)
 	{
-		// Deselect current item
-		if (ActiveItemSlot)
-		{
-			ActiveItemSlot->EventOnSelected(false);
-		}
-
-		ItemNavigationIndex--;
-		if (ItemNavigationIndex < 0)
-		{
-			ItemNavigationIndex = EquipmentInventorySlots.Num() - 1;
-		}
-
-		ActiveItemSlot = EquipmentInventorySlots[ItemNavigationIndex];
-		if (ActiveItemSlot)
-		{
-			ActiveItemSlot->EventOnSelected(true);
-		}
+		// Move left by 1 slot (scrolls the slot window past its edges)
+		StepItemSelection(-1);
 		return;
 	}
 
@@ -1407,23 +1366,8 @@ void UW_Equipment::EventNavigateRight_Implementation()
 	// If viewing item list, navigate in items (grid: move right by 1 slot)
 	if (EquipmentInventorySlots.Num() > 0)
 	{
-		// Deselect current item
-		if (ActiveItemSlot)
-		{
-			ActiveItemSlot->EventOnSelected(false);
-		}
-
-		ItemNavigationIndex++;
-		if (ItemNavigationIndex >= EquipmentInventorySlots.Num())
-		{
-			ItemNavigationIndex = 0;
-		}
-
-		ActiveItemSlot = EquipmentInventorySlots[ItemNavigationIndex];
-		if (ActiveItemSlot)
-		{
-			ActiveItemSlot->EventOnSelected(true);
-		}
+		// Move right by 1 slot (scrolls the slot window past its edges)
+		StepItemSelection(1);
 		return;
 	}
 
@@ -1461,11 +1405,7 @@ void UW_Equipment::EventNavigateOk_Implementation()
 		EquipItemAtSlot(ActiveItemSlot);
 
 		// After equipping, switch back to equipment slots view
-		EquipmentInventorySlots.Empty();
-		if (UniformEquipmentItemsGrid)
-		{
-			UniformEquipmentItemsGrid->ClearChildren();
-		}
+		ClearEquipmentItemSlots();
 		ActiveItemSlot = nullptr;
 		ItemNavigationIndex = 0;
 
@@ -1495,11 +1435,7 @@ void UW_Equipment::EventNavigateCancel_Implementation()
 	if (EquipmentInventorySlots.Num() > 0)
 	{
 		// Clear item list
-		EquipmentInventorySlots.Empty();
-		if (UniformEquipmentItemsGrid)
-		{
-			UniformEquipmentItemsGrid->ClearChildren();
-		}
+		ClearEquipmentItemSlots();
 
 		// Switch back to equipment slots view (index 0)
 		if (EquipmentSwitcher)
@@ -1713,13 +1649,6 @@ void UW_Equipment::EventOnEquipmentSlotPressed_Implementation(UW_EquipmentSlot*
 		UniformEquipmentItemsGrid ? TEXT("valid") : TEXT("NULL"),
 		InventorySlotClass ? TEXT("valid") : TEXT("NULL"));
 
-	// Clear existing item slots
-	EquipmentInventorySlots.Empty();
-	if (UniformEquipmentItemsGrid)
-	{
-		UniformEquipmentItemsGrid->ClearChildren();
-	}
-
 	// Switch to item selection view (index 1)
 	if (EquipmentSwitcher)
 	{
@@ -1727,54 +1656,50 @@ void UW_Equipment::EventOnEquipmentSlotPressed_Implementation(UW_EquipmentSlot*
 		UE_LOG(LogTemp, Log, TEXT("[W_Equipment] Switched to item selection view"));
 	}
 
-	// Populate item grid
-	if (UniformEquipmentItemsGrid)
+	// Populate item grid from the slot pool (widgets are reused across slot presses)
+	if (UniformEquipmentItemsGrid && InventorySlotClass)
 	{
-		int32 Column = 0;
-		int32 Row = 0;
-		int32 SlotsPerRow = 4;
+		const int32 SlotsPerRow = 4;
+
+		if (!EquipmentItemSlotPool)
+		{
+			EquipmentItemSlotPool = NewObject<USLFSlotGridPool>(this);
+			EquipmentItemSlotPool->OnSlotCreated.BindUObject(this, &UW_Equipment::HandleEquipmentItemSlotCreated);
+			EquipmentItemSlotPool->OnBindSlot.BindUObject(this, &UW_Equipment::BindEquipmentItemSlot);
+		}
+		if (!EquipmentItemSlotPool->IsInitialized())
+		{
+			// Windowed: only ItemGridVisibleRows rows of slot widgets exist, however many items qualify
+			EquipmentItemSlotPool->Initialize(UniformEquipmentItemsGrid, InventorySlotClass, SlotsPerRow, FMath::Max(ItemGridVisibleRows, 1), 0);
+		}
+
+		TArray<FSLFSlotGridEntry> Entries;
+		Entries.Reserve(AvailableItems.Num());
 
 		for (const FSLFInventoryItem& InvItem : AvailableItems)
 		{
 			if (UPDA_Item* Item = Cast<UPDA_Item>(InvItem.ItemAsset))
 			{
-				if (InventorySlotClass)
+				// bp_only: Check if this item is already equipped to the active slot
+				// If so, show the equipped indicator (X overlay)
+				bool bIsEquipped = false;
+				if (EquipmentComponent && ActiveEquipmentSlot)
 				{
-					UW_InventorySlot* NewSlot = CreateWidget<UW_InventorySlot>(this, InventorySlotClass);
-					if (NewSlot)
-					{
-						NewSlot->EquipmentRelated = true;
-
-						// Use the amount from the inventory item
-						int32 Amount = InvItem.Amount;
-
-						NewSlot->EventOccupySlot(Item, Amount);
-
-						// bp_only: Check if this item is already equipped to the active slot
-						// If so, show the equipped indicator (X overlay)
-						if (EquipmentComponent && ActiveEquipmentSlot)
-						{
-							bool bIsEquipped = EquipmentComponent->IsItemEquippedToSlot(Item->ItemInformation, ActiveEquipmentSlot->EquipmentSlot);
-							NewSlot->EventToggleEquippedVisual(bIsEquipped);
-						}
-
-						// Bind events
-						NewSlot->OnSelected.AddDynamic(this, &UW_Equipment::EventOnEquipmentSelected);
-						NewSlot->OnPressed.AddDynamic(this, &UW_Equipment::EventOnEquipmentPressed);
-
-						UniformEquipmentItemsGrid->AddChildToUniformGrid(NewSlot, Row, Column);
-						EquipmentInventorySlots.Add(NewSlot);
-
-						Column++;
-						if (Column >= SlotsPerRow)
-						{
-							Column = 0;
-							Row++;
-						}
-					}
+					bIsEquipped = EquipmentComponent->IsItemEquippedToSlot(Item->ItemInformation, ActiveEquipmentSlot->EquipmentSlot);
 				}
+
+				// Use the amount from the inventory item; equipped state is part of the diff key
+				Entries.Emplace(Item, InvItem.Amount, bIsEquipped ? 1 : 0);
 			}
 		}
+
+		// Selection restarts at the first item, so the window does too
+		EquipmentItemSlotPool->SetEntries(MoveTemp(Entries), true);
+		EquipmentItemSlotPool->GetActiveSlotsAs(EquipmentInventorySlots);
+	}
+	else
+	{
+		EquipmentInventorySlots.Empty();
 	}
 
 	// Select first item if available and show item info panel
@@ -1937,7 +1862,7 @@ void UW_Equipment::EventOnVisibilityChanged_Implementation(ESlateVisibility InVi
 		}
 
 		// Clear any leftover item slots from previous session
-		EquipmentInventorySlots.Empty();
+		ClearEquipmentItemSlots();
 		ActiveItemSlot = nullptr;
 		ItemNavigationIndex = 0;
 
@@ -2096,3 +2021,143 @@ void UW_Equipment::HandleInventoryUpdated()
 		EventOnEquipmentSlotPressed(ActiveEquipmentSlot);
 	}
 }
+
+/**
+ * HandleEquipmentItemSlotCreated - One-time setup for a pooled item selection slot
+ */
+void UW_Equipment::HandleEquipmentItemSlotCreated(UUserWidget* SlotWidget)
+{
+	UW_InventorySlot* NewSlot = Cast<UW_InventorySlot>(SlotWidget);
+	if (!NewSlot)
+	{
+		return;
+	}
+
+	NewSlot->EquipmentRelated = true;
+
+	// Bind events
+	NewSlot->OnSelected.AddDynamic(this, &UW_Equipment::EventOnEquipmentSelected);
+	NewSlot->OnPressed.AddDynamic(this, &UW_Equipment::EventOnEquipmentPressed);
+}
+
+/**
+ * BindEquipmentItemSlot - Show an equippable item (UserData = equipped flag) in a pooled slot
+ */
+void UW_Equipment::BindEquipmentItemSlot(UUserWidget* SlotWidget, const FSLFSlotGridEntry* Entry)
+{
+	UW_InventorySlot* ItemSlot = Cast<UW_InventorySlot>(SlotWidget);
+	if (!ItemSlot)
+	{
+		return;
+	}
+
+	UPDA_Item* Item = Entry ? Cast<UPDA_Item>(Entry->Item) : nullptr;
+	if (!Item)
+	{
+		if (ItemSlot->IsOccupied)
+		{
+			ItemSlot->EventClearSlot(false);
+		}
+		ItemSlot->EventToggleEquippedVisual(false);
+		return;
+	}
+
+	if (ItemSlot->IsOccupied && ItemSlot->AssignedItem == Item)
+	{
+		ItemSlot->EventChangeAmount(Entry->Count);
+	}
+	else
+	{
+		if (ItemSlot->IsOccupied)
+		{
+			ItemSlot->EventClearSlot(false);
+		}
+		ItemSlot->EventOccupySlot(Item, Entry->Count);
+	}
+
+	ItemSlot->EventToggleEquippedVisual(Entry->UserData != 0);
+}
+
+/**
+ * ClearEquipmentItemSlots - Leave item selection: empty and collapse the pooled slots
+ */
+void UW_Equipment::ClearEquipmentItemSlots()
+{
+	for (UW_InventorySlot* ItemSlot : EquipmentInventorySlots)
+	{
+		// Drop the highlight without broadcasting - the slot will be reused
+		if (IsValid(ItemSlot))
+		{
+			ItemSlot->SetSlotSelected(false);
+		}
+	}
+	EquipmentInventorySlots.Empty();
+
+	if (EquipmentItemSlotPool)
+	{
+		EquipmentItemSlotPool->ClearEntries();
+	}
+}
+
+/**
+ * StepItemSelection - Move the item selection through the full item list, not just the visible window
+ */
+void UW_Equipment::StepItemSelection(int32 DeltaItems)
+{
+	if (!EquipmentItemSlotPool)
+	{
+		return;
+	}
+
+	if (ActiveItemSlot)
+	{
+		ActiveItemSlot->EventOnSelected(false);
+	}
+
+	const int32 SlotIndex = EquipmentItemSlotPool->StepSelection(ItemNavigationIndex, DeltaItems, true);
+
+	// The window may have scrolled - a partial last window has fewer active slots
+	EquipmentItemSlotPool->GetActiveSlotsAs(EquipmentInventorySlots);
+	if (!EquipmentInventorySlots.IsValidIndex(SlotIndex))
+	{
+		ActiveItemSlot = nullptr;
+		return;
+	}
+
+	ItemNavigationIndex = SlotIndex;
+	ActiveItemSlot = EquipmentInventorySlots[SlotIndex];
+	if (ActiveItemSlot)
+	{
+		ActiveItemSlot->EventOnSelected(true);
+		UE_LOG(LogTemp, Log, TEXT("[W_Equipment] StepItemSelection - Selected item %d of %d"),
+			EquipmentItemSlotPool->GetEntryIndexForSlot(SlotIndex) + 1, EquipmentItemSlotPool->GetEntries().Num());
+	}
+}
+
+/**
+ * ScrollItemGrid - Scroll the item selection window by whole rows
+ */
+bool UW_Equipment::ScrollItemGrid(int32 DeltaRows)
+{
+	if (!EquipmentItemSlotPool || !EquipmentItemSlotPool->ScrollByRows(DeltaRows))
+	{
+		return false;
+	}
+
+	// Slot widgets keep their index; re-run selection so the info panel shows the new item
+	EquipmentItemSlotPool->GetActiveSlotsAs(EquipmentInventorySlots);
+	if (EquipmentInventorySlots.Num() > 0)
+	{
+		ItemNavigationIndex = FMath::Clamp(ItemNavigationIndex, 0, EquipmentInventorySlots.Num() - 1);
+		if (ActiveItemSlot && ActiveItemSlot != EquipmentInventorySlots[ItemNavigationIndex])
+		{
+			ActiveItemSlot->EventOnSelected(false);
+		}
+		ActiveItemSlot = EquipmentInventorySlots[ItemNavigationIndex];
+		if (ActiveItemSlot)
+		{
+			ActiveItemSlot->EventOnSelected(true);
+		}
+	}
+	return true;
+}
@@ -39,6 +39,8 @@ class UAC_EquipmentManager;
 class UAC_InventoryManager;
 class UPDA_Item;
 class UInventoryManagerComponent;
+class USLFSlotGridPool;
+struct FSLFSlotGridEntry;
 
 // Forward declarations for SaveGame types
 
@@ -60,6 +62,7 @@ public:
 
 	// Input handling (replaces Blueprint EventGraph input bindings)
 	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
+	virtual FReply NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 
 	// ═══════════════════════════════════════════════════════════════════════
 	// BIND WIDGETS - Direct access via BindWidgetOptional
@@ -169,6 +172,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Config")
 	TSubclassOf<UW_EquipmentSlot> EquipmentSlotClass;
 
+	// Rows of item selection slots kept alive; longer item lists scroll through this window
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Config", meta = (ClampMin = "1"))
+	int32 ItemGridVisibleRows;
+
 	// ═══════════════════════════════════════════════════════════════════════
 	// EVENT DISPATCHERS (1)
 	// ═══════════════════════════════════════════════════════════════════════
@@ -311,4 +318,21 @@ protected:
 
 	UFUNCTION()
 	void HandleInventoryUpdated();
+
+	// Pool callbacks for the item selection grid
+	void HandleEquipmentItemSlotCreated(UUserWidget* SlotWidget);
+	void BindEquipmentItemSlot(UUserWidget* SlotWidget, const FSLFSlotGridEntry* Entry);
+
+	// Hide the item selection grid (slots stay pooled for the next slot press)
+	void ClearEquipmentItemSlots();
+
+	// Move the item selection DeltaItems entries (wrapping), scrolling the slot window to it
+	void StepItemSelection(int32 DeltaItems);
+
+	// Scroll the item selection window by whole rows, keeping the selected slot index
+	bool ScrollItemGrid(int32 DeltaRows);
+
+	// Recycled item selection slots - reused every time an equipment slot is pressed
+	UPROPERTY(Transient)
+	USLFSlotGridPool* EquipmentItemSlotPool;
 };
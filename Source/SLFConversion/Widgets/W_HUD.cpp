@@ -47,6 +47,10 @@
 #include "Components/OverlaySlot.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
+#include "Components/InvalidationBox.h"
+#include "Blueprint/WidgetTree.h"
+#include "UObject/UObjectIterator.h"
+#include "HAL/IConsoleManager.h"
 #include "Animation/WidgetAnimation.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetSystemLibrary.h"
@@ -58,6 +62,38 @@
 #include "GameFramework/PC_SoulslikeFramework.h"
 #include "Framework/SLFPlayerController.h"
 
+namespace
+{
+	/** Assign Out from the name -> widget table unless it is already set */
+	template <typename T>
+	void BindHudWidget(const TMap<FName, UWidget*>& Widgets, const TCHAR* Name, T*& Out)
+	{
+		if (!Out)
+		{
+			if (UWidget* const* Found = Widgets.Find(FName(Name)))
+			{
+				Out = Cast<T>(*Found);
+			}
+		}
+	}
+
+	TAutoConsoleVariable<int32> CVarHudInvalidation(
+		TEXT("SLF.HUD.Invalidation"),
+		1,
+		TEXT("Cache the HUD's invalidation panels (0 = every HUD region repaints each frame)"),
+		FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* Variable)
+		{
+			for (TObjectIterator<UW_HUD> It; It; ++It)
+			{
+				if (!It->IsTemplate())
+				{
+					It->SetInvalidationEnabled(Variable->GetInt() != 0);
+				}
+			}
+		}),
+		ECVF_Default);
+}
+
 UW_HUD::UW_HUD(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -82,6 +118,11 @@ UW_HUD::UW_HUD(const FObjectInitializer& ObjectInitializer)
 	StatusEffectBarWidgetClass = nullptr;
 	CachedWorldMap = nullptr;
 	CachedItemWheelTools = nullptr;
+	CachedW_Dialog = nullptr;
+	CachedViewportSwitcher = nullptr;
+	CachedWindowsCanvas = nullptr;
+	CachedW_BigScreenMessage = nullptr;
+	CachedAutoSaveIcon = nullptr;
 	IsDialogActive = false;
 	CinematicMode = false;
 }
@@ -89,7 +130,6 @@ UW_HUD::UW_HUD(const FObjectInitializer& ObjectInitializer)
 void UW_HUD::NativeConstruct()
 {
 	Super::NativeConstruct();
-	CacheWidgetReferences();
 	InitializeBindings();
 
 	// CRITICAL: Collapse all menu/window widgets on init.
@@ -120,167 +160,146 @@ void UW_HUD::NativeDestruct()
 	UE_LOG(LogTemp, Log, TEXT("UW_HUD::NativeDestruct"));
 }
 
-void UW_HUD::CacheWidgetReferences()
+void UW_HUD::NativeOnInitialized()
 {
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - START"));
+	Super::NativeOnInitialized();
 
-	if (!LoadingScreen)
-	{
-		LoadingScreen = Cast<UW_LoadingScreen>(GetWidgetFromName(TEXT("LoadingScreen")));
-	}
-
-	if (!CachedW_Interaction)
-	{
-		CachedW_Interaction = Cast<UW_Interaction>(GetWidgetFromName(TEXT("W_Interaction")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_Interaction: %s"),
-		CachedW_Interaction ? TEXT("Found") : TEXT("NOT FOUND"));
-
-	// Find CachedW_GameMenu if not already set
-	if (!CachedW_GameMenu)
-	{
-		CachedW_GameMenu = Cast<UW_GameMenu>(GetWidgetFromName(TEXT("W_GameMenu")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_GameMenu: %s"),
-		CachedW_GameMenu ? TEXT("Found") : TEXT("NOT FOUND"));
-
-	// Find child menu widgets
-	if (!CachedW_Inventory)
-	{
-		CachedW_Inventory = Cast<UW_Inventory>(GetWidgetFromName(TEXT("W_Inventory")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_Inventory: %s"),
-		CachedW_Inventory ? TEXT("Found") : TEXT("NOT FOUND"));
-
-	if (!CachedW_Equipment)
-	{
-		CachedW_Equipment = Cast<UW_Equipment>(GetWidgetFromName(TEXT("W_Equipment")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_Equipment: %s"),
-		CachedW_Equipment ? TEXT("Found") : TEXT("NOT FOUND"));
+	// Runs once per HUD instance before its Slate widgets exist, so the widget tree can
+	// still be restructured without a rebuild
+	CacheWidgetReferences();
+	ApplyInvalidationLayout();
+}
 
-	if (!CachedW_Crafting)
+void UW_HUD::CacheWidgetReferences()
+{
+	if (!WidgetTree)
 	{
-		CachedW_Crafting = Cast<UW_Crafting>(GetWidgetFromName(TEXT("W_Crafting")));
+		UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - No widget tree"));
+		return;
 	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_Crafting: %s"),
-		CachedW_Crafting ? TEXT("Found") : TEXT("NOT FOUND"));
 
-	if (!CachedW_Status)
-	{
-		CachedW_Status = Cast<UW_Status>(GetWidgetFromName(TEXT("W_Status")));
+	// One walk over the tree instead of a full GetWidgetFromName search per widget.
+	// (Compile-time BindWidget is not an option: the Blueprint already owns these variable names.)
+	TMap<FName, UWidget*> Widgets;
+	WidgetTree->ForEachWidget([&Widgets](UWidget* Widget)
+	{
+		Widgets.Add(Widget->GetFName(), Widget);
+	});
+
+	BindHudWidget(Widgets, TEXT("LoadingScreen"), LoadingScreen);
+	BindHudWidget(Widgets, TEXT("W_Interaction"), CachedW_Interaction);
+	BindHudWidget(Widgets, TEXT("W_GameMenu"), CachedW_GameMenu);
+	BindHudWidget(Widgets, TEXT("W_Inventory"), CachedW_Inventory);
+	BindHudWidget(Widgets, TEXT("W_Equipment"), CachedW_Equipment);
+	BindHudWidget(Widgets, TEXT("W_Crafting"), CachedW_Crafting);
+	BindHudWidget(Widgets, TEXT("W_Status"), CachedW_Status);
+	BindHudWidget(Widgets, TEXT("W_Settings"), CachedW_Settings);
+	BindHudWidget(Widgets, TEXT("W_Resources"), CachedW_Resources);
+	BindHudWidget(Widgets, TEXT("RestMenu"), CachedW_RestMenu);
+	BindHudWidget(Widgets, TEXT("W_Radar"), CachedW_Radar);
+	BindHudWidget(Widgets, TEXT("W_NPC_Window"), CachedW_NPC_Window);
+	BindHudWidget(Widgets, TEXT("W_Dialog"), CachedW_Dialog);
+	BindHudWidget(Widgets, TEXT("ItemLootNotificationsBox"), CachedItemLootNotificationsBox);
+	BindHudWidget(Widgets, TEXT("W_FirstLootNotification"), CachedW_FirstLootNotification);
+	BindHudWidget(Widgets, TEXT("StatusEffectBox"), CachedStatusEffectBox);
+	BindHudWidget(Widgets, TEXT("W_StatusEffectNotification"), CachedW_StatusEffectNotification);
+	BindHudWidget(Widgets, TEXT("W_Boss_Healthbar"), CachedBossHealthbar);
+	BindHudWidget(Widgets, TEXT("ItemWheel_Tools"), CachedItemWheelTools);
+	BindHudWidget(Widgets, TEXT("ViewportSwitcher"), CachedViewportSwitcher);
+	BindHudWidget(Widgets, TEXT("WindowsCanvas"), CachedWindowsCanvas);
+	BindHudWidget(Widgets, TEXT("W_BigScreenMessage"), CachedW_BigScreenMessage);
+	BindHudWidget(Widgets, TEXT("AutoSaveIcon"), CachedAutoSaveIcon);
+
+	// Report everything that failed to bind in one line
+	FString Missing;
+	auto CheckBound = [&Missing](const UObject* Widget, const TCHAR* Name)
+	{
+		if (!Widget)
+		{
+			if (!Missing.IsEmpty())
+			{
+				Missing += TEXT(", ");
+			}
+			Missing += Name;
+		}
+	};
+	CheckBound(CachedW_Interaction, TEXT("W_Interaction"));
+	CheckBound(CachedW_GameMenu, TEXT("W_GameMenu"));
+	CheckBound(CachedW_Inventory, TEXT("W_Inventory"));
+	CheckBound(CachedW_Equipment, TEXT("W_Equipment"));
+	CheckBound(CachedW_Crafting, TEXT("W_Crafting"));
+	CheckBound(CachedW_Status, TEXT("W_Status"));
+	CheckBound(CachedW_Settings, TEXT("W_Settings"));
+	CheckBound(CachedW_Resources, TEXT("W_Resources"));
+	CheckBound(CachedW_RestMenu, TEXT("RestMenu"));
+	CheckBound(CachedW_Radar, TEXT("W_Radar"));
+	CheckBound(CachedW_Dialog, TEXT("W_Dialog"));
+	CheckBound(CachedItemLootNotificationsBox, TEXT("ItemLootNotificationsBox"));
+	CheckBound(CachedW_FirstLootNotification, TEXT("W_FirstLootNotification"));
+	CheckBound(CachedStatusEffectBox, TEXT("StatusEffectBox"));
+	CheckBound(CachedW_StatusEffectNotification, TEXT("W_StatusEffectNotification"));
+	CheckBound(CachedBossHealthbar, TEXT("W_Boss_Healthbar"));
+	CheckBound(CachedItemWheelTools, TEXT("ItemWheel_Tools"));
+	CheckBound(CachedViewportSwitcher, TEXT("ViewportSwitcher"));
+	CheckBound(CachedWindowsCanvas, TEXT("WindowsCanvas"));
+	CheckBound(CachedW_BigScreenMessage, TEXT("W_BigScreenMessage"));
+	CheckBound(CachedAutoSaveIcon, TEXT("AutoSaveIcon"));
+
+	if (!Missing.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - NOT FOUND: %s"), *Missing);
+	}
+	if (UWidget* const* RawDialog = Widgets.Find(TEXT("W_Dialog")); RawDialog && !CachedW_Dialog)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - W_Dialog is %s, not a UW_Dialog"),
+			*(*RawDialog)->GetClass()->GetPathName());
 	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_Status: %s"),
-		CachedW_Status ? TEXT("Found") : TEXT("NOT FOUND"));
 
 	// Bind to CachedW_GameMenu's OnGameMenuWidgetRequest dispatcher
 	if (CachedW_GameMenu)
 	{
 		CachedW_GameMenu->OnGameMenuWidgetRequest.AddUniqueDynamic(this, &UW_HUD::OnGameMenuWidgetRequestHandler);
-		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Bound to OnGameMenuWidgetRequest"));
 	}
 
 	// Bind to child widget closed dispatchers
 	if (CachedW_Inventory)
 	{
 		CachedW_Inventory->OnInventoryClosed.AddUniqueDynamic(this, &UW_HUD::OnInventoryClosedHandler);
-		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Bound to CachedW_Inventory::OnInventoryClosed"));
 	}
 
 	if (CachedW_Equipment)
 	{
 		CachedW_Equipment->OnEquipmentClosed.AddUniqueDynamic(this, &UW_HUD::OnEquipmentClosedHandler);
-		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Bound to CachedW_Equipment::OnEquipmentClosed"));
 	}
 
 	if (CachedW_Crafting)
 	{
 		CachedW_Crafting->OnCraftingClosed.AddUniqueDynamic(this, &UW_HUD::OnCraftingClosedHandler);
-		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Bound to CachedW_Crafting::OnCraftingClosed"));
 	}
 
 	if (CachedW_Status)
 	{
 		CachedW_Status->OnStatusClosed.AddUniqueDynamic(this, &UW_HUD::OnStatusClosedHandler);
-		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Bound to CachedW_Status::OnStatusClosed"));
-	}
-
-	// Find CachedW_Settings widget
-	if (!CachedW_Settings)
-	{
-		CachedW_Settings = Cast<UW_Settings>(GetWidgetFromName(TEXT("W_Settings")));
 	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_Settings: %s"),
-		CachedW_Settings ? TEXT("Found") : TEXT("NOT FOUND"));
-
-	// Find CachedW_Resources widget (stat bars)
-	if (!CachedW_Resources)
-	{
-		CachedW_Resources = Cast<UW_Resources>(GetWidgetFromName(TEXT("W_Resources")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_Resources: %s"),
-		CachedW_Resources ? TEXT("Found") : TEXT("NOT FOUND"));
-
-	// Find CachedW_RestMenu widget
-	if (!CachedW_RestMenu)
-	{
-		CachedW_RestMenu = Cast<UW_RestMenu>(GetWidgetFromName(TEXT("RestMenu")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_RestMenu: %s"),
-		CachedW_RestMenu ? TEXT("Found") : TEXT("NOT FOUND"));
 
 	// Bind to RestMenu's OnStorageRequested event
 	if (CachedW_RestMenu)
 	{
 		CachedW_RestMenu->OnStorageRequested.AddUniqueDynamic(this, &UW_HUD::OnStorageRequestedHandler);
-		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Bound to CachedW_RestMenu::OnStorageRequested"));
 	}
 
 	if (CachedW_Settings)
 	{
 		CachedW_Settings->OnSettingsClosed.AddUniqueDynamic(this, &UW_HUD::OnSettingsClosedHandler);
 		CachedW_Settings->OnQuitRequested.AddUniqueDynamic(this, &UW_HUD::OnQuitRequestedHandler);
-		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Bound to CachedW_Settings::OnSettingsClosed and OnQuitRequested"));
 	}
 
-	// Cache loot notification widgets
-	if (!CachedItemLootNotificationsBox)
-	{
-		CachedItemLootNotificationsBox = Cast<UVerticalBox>(GetWidgetFromName(TEXT("ItemLootNotificationsBox")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedItemLootNotificationsBox: %s"),
-		CachedItemLootNotificationsBox ? TEXT("Found") : TEXT("NOT FOUND"));
-
-	if (!CachedW_FirstLootNotification)
-	{
-		CachedW_FirstLootNotification = Cast<UW_FirstLootNotification>(GetWidgetFromName(TEXT("W_FirstLootNotification")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_FirstLootNotification: %s"),
-		CachedW_FirstLootNotification ? TEXT("Found") : TEXT("NOT FOUND"));
-
 	// Pre-load loot notification widget class
 	if (!LootNotificationWidgetClass)
 	{
 		LootNotificationWidgetClass = LoadClass<UW_LootNotification>(nullptr,
 			TEXT("/Game/SoulslikeFramework/Widgets/HUD/W_LootNotification.W_LootNotification_C"));
 	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - LootNotificationWidgetClass: %s"),
-		LootNotificationWidgetClass ? TEXT("Loaded") : TEXT("NOT LOADED"));
-
-	// Cache status effect widgets
-	if (!CachedStatusEffectBox)
-	{
-		CachedStatusEffectBox = Cast<UVerticalBox>(GetWidgetFromName(TEXT("StatusEffectBox")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedStatusEffectBox: %s"),
-		CachedStatusEffectBox ? TEXT("Found") : TEXT("NOT FOUND"));
-
-	if (!CachedW_StatusEffectNotification)
-	{
-		CachedW_StatusEffectNotification = Cast<UW_StatusEffectNotification>(GetWidgetFromName(TEXT("W_StatusEffectNotification")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_StatusEffectNotification: %s"),
-		CachedW_StatusEffectNotification ? TEXT("Found") : TEXT("NOT FOUND"));
 
 	// Pre-load status effect bar widget class
 	if (!StatusEffectBarWidgetClass)
@@ -288,135 +307,66 @@ void UW_HUD::CacheWidgetReferences()
 		StatusEffectBarWidgetClass = LoadClass<UW_StatusEffectBar>(nullptr,
 			TEXT("/Game/SoulslikeFramework/Widgets/HUD/W_StatusEffectBar.W_StatusEffectBar_C"));
 	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - StatusEffectBarWidgetClass: %s"),
-		StatusEffectBarWidgetClass ? TEXT("Loaded") : TEXT("NOT LOADED"));
 
-	// Cache boss health bar widget
-	if (!CachedBossHealthbar)
-	{
-		CachedBossHealthbar = Cast<UW_Boss_Healthbar>(GetWidgetFromName(TEXT("W_Boss_Healthbar")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedBossHealthbar: %s"),
-		CachedBossHealthbar ? TEXT("Found") : TEXT("NOT FOUND"));
-
-	// Cache W_Radar widget for radar/compass functionality
-	if (!CachedW_Radar)
-	{
-		CachedW_Radar = Cast<UW_Radar>(GetWidgetFromName(TEXT("W_Radar")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_Radar: %s"),
-		CachedW_Radar ? TEXT("Found") : TEXT("NOT FOUND"));
+	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Bound %d named widgets, LootNotificationWidgetClass: %s, StatusEffectBarWidgetClass: %s"),
+		Widgets.Num(),
+		LootNotificationWidgetClass ? TEXT("Loaded") : TEXT("NOT LOADED"),
+		StatusEffectBarWidgetClass ? TEXT("Loaded") : TEXT("NOT LOADED"));
 
-	// Cache W_NPC_Window widget for NPC dialog
+	// If W_NPC_Window is not in the widget tree, create it dynamically
 	if (!CachedW_NPC_Window)
 	{
-		CachedW_NPC_Window = Cast<UW_NPC_Window>(GetWidgetFromName(TEXT("W_NPC_Window")));
+		UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - W_NPC_Window not in widget tree, creating dynamically"));
 
-		// If widget not found in tree, create it dynamically
-		if (!CachedW_NPC_Window)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - W_NPC_Window not in widget tree, creating dynamically"));
+		// Load the Blueprint class
+		UClass* NPCWindowClass = LoadClass<UW_NPC_Window>(nullptr,
+			TEXT("/Game/SoulslikeFramework/Widgets/Vendor/W_NPC_Window.W_NPC_Window_C"));
 
-			// Load the Blueprint class
-			UClass* NPCWindowClass = LoadClass<UW_NPC_Window>(nullptr,
-				TEXT("/Game/SoulslikeFramework/Widgets/Vendor/W_NPC_Window.W_NPC_Window_C"));
+		if (NPCWindowClass)
+		{
+			CachedW_NPC_Window = CreateWidget<UW_NPC_Window>(GetOwningPlayer(), NPCWindowClass);
 
-			if (NPCWindowClass)
+			if (CachedW_NPC_Window)
 			{
-				CachedW_NPC_Window = CreateWidget<UW_NPC_Window>(GetOwningPlayer(), NPCWindowClass);
-
-				if (CachedW_NPC_Window)
+				// Find the root Overlay and add the widget
+				UOverlay* RootOverlay = nullptr;
+				BindHudWidget(Widgets, TEXT("Overlay_0"), RootOverlay);
+				if (!RootOverlay)
 				{
-					// Find the root Overlay and add the widget
-					UOverlay* RootOverlay = Cast<UOverlay>(GetWidgetFromName(TEXT("Overlay_0")));
-					if (!RootOverlay)
-					{
-						// Try alternate name patterns
-						RootOverlay = Cast<UOverlay>(GetRootWidget());
-					}
+					// Try alternate name patterns
+					RootOverlay = Cast<UOverlay>(GetRootWidget());
+				}
 
-					if (RootOverlay)
-					{
-						UOverlaySlot* OverlaySlot = RootOverlay->AddChildToOverlay(CachedW_NPC_Window);
-						if (OverlaySlot)
-						{
-							OverlaySlot->SetHorizontalAlignment(HAlign_Fill);
-							OverlaySlot->SetVerticalAlignment(VAlign_Fill);
-						}
-						CachedW_NPC_Window->SetVisibility(ESlateVisibility::Collapsed);
-						UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Created W_NPC_Window dynamically and added to Overlay"));
-					}
-					else
+				if (RootOverlay)
+				{
+					UOverlaySlot* OverlaySlot = RootOverlay->AddChildToOverlay(CachedW_NPC_Window);
+					if (OverlaySlot)
 					{
-						UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - Could not find root Overlay to add W_NPC_Window"));
+						OverlaySlot->SetHorizontalAlignment(HAlign_Fill);
+						OverlaySlot->SetVerticalAlignment(VAlign_Fill);
 					}
+					CachedW_NPC_Window->SetVisibility(ESlateVisibility::Collapsed);
+					UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Created W_NPC_Window dynamically and added to Overlay"));
 				}
 				else
 				{
-					UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - CreateWidget failed for W_NPC_Window"));
+					UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - Could not find root Overlay to add W_NPC_Window"));
 				}
 			}
 			else
 			{
-				UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - Could not load W_NPC_Window Blueprint class"));
+				UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - CreateWidget failed for W_NPC_Window"));
 			}
 		}
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_NPC_Window: %s"),
-		CachedW_NPC_Window ? TEXT("Found") : TEXT("NOT FOUND"));
-
-	// Cache W_Dialog widget for dialog text display (named "W_Dialog" in UMG)
-	if (!CachedW_Dialog)
-	{
-		UWidget* RawDialogWidget = GetWidgetFromName(TEXT("W_Dialog"));
-		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - GetWidgetFromName(W_Dialog) returned: %s"),
-			RawDialogWidget ? TEXT("VALID pointer") : TEXT("nullptr"));
-
-		if (RawDialogWidget)
+		else
 		{
-			UClass* WidgetClass = RawDialogWidget->GetClass();
-			UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - W_Dialog raw widget class: %s"),
-				WidgetClass ? *WidgetClass->GetName() : TEXT("null"));
-			UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - W_Dialog raw widget class path: %s"),
-				WidgetClass ? *WidgetClass->GetPathName() : TEXT("null"));
-
-			// Check if it's a subclass of UW_Dialog
-			UClass* ExpectedClass = UW_Dialog::StaticClass();
-			bool bIsSubclass = WidgetClass && WidgetClass->IsChildOf(ExpectedClass);
-			UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - IsChildOf(UW_Dialog): %s"),
-				bIsSubclass ? TEXT("YES") : TEXT("NO"));
-
-			// Log the class hierarchy
-			if (WidgetClass)
-			{
-				FString Hierarchy;
-				UClass* CurrentClass = WidgetClass;
-				while (CurrentClass)
-				{
-					if (!Hierarchy.IsEmpty()) Hierarchy += TEXT(" -> ");
-					Hierarchy += CurrentClass->GetName();
-					CurrentClass = CurrentClass->GetSuperClass();
-				}
-				UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - W_Dialog class hierarchy: %s"), *Hierarchy);
-			}
+			UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - Could not load W_NPC_Window Blueprint class"));
 		}
-
-		CachedW_Dialog = Cast<UW_Dialog>(RawDialogWidget);
 	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedW_Dialog: %s"),
-		CachedW_Dialog ? TEXT("Found") : TEXT("NOT FOUND"));
-
-	// Cache ItemWheel_Tools and configure SlotsToTrack if empty
-	// This fixes throwing knives not appearing in item wheel after C++ migration
-	if (!CachedItemWheelTools)
-	{
-		CachedItemWheelTools = Cast<UW_ItemWheelSlot>(GetWidgetFromName(TEXT("ItemWheel_Tools")));
-	}
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - CachedItemWheelTools: %s"),
-		CachedItemWheelTools ? TEXT("Found") : TEXT("NOT FOUND"));
 
 	// If SlotsToTrack is empty, configure it with tool slot tags
 	// SlotsToTrack is an instance-editable property that may have been lost during Blueprint reparenting
+	// This fixes throwing knives not appearing in item wheel after C++ migration
 	if (CachedItemWheelTools && CachedItemWheelTools->SlotsToTrack.Num() == 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("UW_HUD::CacheWidgetReferences - ItemWheel_Tools SlotsToTrack is EMPTY! Configuring with tool slots..."));
@@ -437,20 +387,76 @@ void UW_HUD::CacheWidgetReferences()
 		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Configured ItemWheel_Tools with %d tool slots"),
 			CachedItemWheelTools->SlotsToTrack.Num());
 	}
-	else if (CachedItemWheelTools)
-	{
-		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - ItemWheel_Tools already has %d slots configured"),
-			CachedItemWheelTools->SlotsToTrack.Num());
-	}
 
 	// Bind to ItemWheel_Tools::OnItemWheelSlotSelected to update ActiveToolSlot
 	if (CachedItemWheelTools)
 	{
-		CachedItemWheelTools->OnItemWheelSlotSelected.AddDynamic(this, &UW_HUD::OnItemWheelToolsSlotSelected);
-		UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - Bound to ItemWheel_Tools::OnItemWheelSlotSelected"));
+		CachedItemWheelTools->OnItemWheelSlotSelected.AddUniqueDynamic(this, &UW_HUD::OnItemWheelToolsSlotSelected);
+	}
+}
+
+void UW_HUD::ApplyInvalidationLayout()
+{
+	if (!WidgetTree || InvalidationPanels.Num() > 0)
+	{
+		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("UW_HUD::CacheWidgetReferences - END"));
+	// Swap Child for Wrapper in the same parent slot (keeps anchors / padding), then parent Child to it
+	auto Wrap = [](UWidget* Child, UContentWidget* Wrapper) -> bool
+	{
+		UPanelWidget* Parent = Child ? Child->GetParent() : nullptr;
+		const int32 ChildIndex = Parent ? Parent->GetChildIndex(Child) : INDEX_NONE;
+		if (ChildIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		Parent->ReplaceChildAt(ChildIndex, Wrapper);
+		Wrapper->SetContent(Child);
+		return true;
+	};
+
+	// Stat bars, currency, ability icons and the item wheels only change on gameplay events - cache
+	// their prepass and draw elements; a child SetPercent / SetText / slot cycle invalidates just that
+	// child, so the change still shows on the same frame
+	const TCHAR* InvalidationRegions[] = { TEXT("W_Resources"), TEXT("W_CurrencyContainer"), TEXT("W_AbilityDisplay"),
+		TEXT("StatusEffectBox"), TEXT("ItemWheelGrid") };
+	for (const TCHAR* RegionName : InvalidationRegions)
+	{
+		UWidget* Region = WidgetTree->FindWidget(FName(RegionName));
+		UInvalidationBox* Box = WidgetTree->ConstructWidget<UInvalidationBox>(UInvalidationBox::StaticClass(),
+			FName(*FString::Printf(TEXT("%s_Invalidation"), RegionName)));
+		if (Region && Wrap(Region, Box))
+		{
+			InvalidationPanels.Add(Box);
+		}
+	}
+
+	// Radar compass and boss bar change every frame - volatile skips cache bookkeeping for them
+	if (CachedW_Radar)
+	{
+		CachedW_Radar->ForceVolatile(true);
+	}
+	if (CachedBossHealthbar)
+	{
+		CachedBossHealthbar->ForceVolatile(true);
+	}
+
+	SetInvalidationEnabled(CVarHudInvalidation.GetValueOnGameThread() != 0);
+
+	UE_LOG(LogTemp, Log, TEXT("UW_HUD::ApplyInvalidationLayout - %d invalidation panels"), InvalidationPanels.Num());
+}
+
+void UW_HUD::SetInvalidationEnabled(bool bEnabled)
+{
+	for (UInvalidationBox* Box : InvalidationPanels)
+	{
+		if (Box)
+		{
+			Box->SetCanCache(bEnabled);
+		}
+	}
 }
 
 bool UW_HUD::GetTargetWidgetVisibility_Implementation(UUserWidget* Widget)
@@ -1443,9 +1449,9 @@ void UW_HUD::EventFade_Implementation(ESLFFadeTypes FadeType, float PlayRate)
 void UW_HUD::EventSwitchViewport_Implementation(int32 InIndex)
 {
 	UE_LOG(LogTemp, Log, TEXT("UW_HUD::EventSwitchViewport - Index: %d"), InIndex);
-	if (UWidgetSwitcher* ViewportSwitcher = Cast<UWidgetSwitcher>(GetWidgetFromName(TEXT("ViewportSwitcher"))))
+	if (CachedViewportSwitcher)
 	{
-		ViewportSwitcher->SetActiveWidgetIndex(InIndex);
+		CachedViewportSwitcher->SetActiveWidgetIndex(InIndex);
 	}
 }
 
@@ -1461,11 +1467,10 @@ void UW_HUD::EventBigScreenMessage_Implementation(const FText& InMessage, UMater
 		*InMessage.ToString(), AnimationRateScale);
 
 	// Find and show the W_BigScreenMessage widget
-	UW_BigScreenMessage* BigScreenMsg = Cast<UW_BigScreenMessage>(GetWidgetFromName(TEXT("W_BigScreenMessage")));
-	if (BigScreenMsg)
+	if (CachedW_BigScreenMessage)
 	{
 		// Call EventShowMessage on the widget
-		BigScreenMsg->EventShowMessage(InMessage, GradientMaterial, bHasBackdrop, AnimationRateScale);
+		CachedW_BigScreenMessage->EventShowMessage(InMessage, GradientMaterial, bHasBackdrop, AnimationRateScale);
 		UE_LOG(LogTemp, Log, TEXT("[W_HUD] Forwarded to W_BigScreenMessage"));
 	}
 	else
@@ -1516,9 +1521,9 @@ void UW_HUD::HideDeathScreen()
 	UE_LOG(LogTemp, Log, TEXT("UW_HUD::HideDeathScreen - Hiding death screen"));
 
 	// Hide the big screen message widget (use correct widget name "W_BigScreenMessage")
-	if (UWidget* BigScreenMessage = GetWidgetFromName(TEXT("W_BigScreenMessage")))
+	if (CachedW_BigScreenMessage)
 	{
-		BigScreenMessage->SetVisibility(ESlateVisibility::Collapsed);
+		CachedW_BigScreenMessage->SetVisibility(ESlateVisibility::Collapsed);
 		UE_LOG(LogTemp, Log, TEXT("[W_HUD] Hid W_BigScreenMessage widget"));
 	}
 	else
@@ -1536,18 +1541,18 @@ void UW_HUD::HideDeathScreen()
 void UW_HUD::EventShowAutoSaveIcon_Implementation(float InDuration)
 {
 	UE_LOG(LogTemp, Log, TEXT("UW_HUD::EventShowAutoSaveIcon - Duration: %f"), InDuration);
-	if (UWidget* SaveIcon = GetWidgetFromName(TEXT("AutoSaveIcon")))
+	if (CachedAutoSaveIcon)
 	{
-		SaveIcon->SetVisibility(ESlateVisibility::Visible);
+		CachedAutoSaveIcon->SetVisibility(ESlateVisibility::Visible);
 	}
 }
 
 void UW_HUD::EventRemoveAutoSaveIcon_Implementation()
 {
 	UE_LOG(LogTemp, Log, TEXT("UW_HUD::EventRemoveAutoSaveIcon"));
-	if (UWidget* SaveIcon = GetWidgetFromName(TEXT("AutoSaveIcon")))
+	if (CachedAutoSaveIcon)
 	{
-		SaveIcon->SetVisibility(ESlateVisibility::Collapsed);
+		CachedAutoSaveIcon->SetVisibility(ESlateVisibility::Collapsed);
 	}
 }
 
@@ -1578,9 +1583,9 @@ void UW_HUD::EventToggleCinematicMode_Implementation(bool bActive, bool bFadeOut
 	CinematicMode = bActive;
 
 	// bp_only: Use ViewportSwitcher to swap between MainHUD (index 0) and CinematicHUD (index 1)
-	if (UWidgetSwitcher* ViewportSwitcher = Cast<UWidgetSwitcher>(GetWidgetFromName(TEXT("ViewportSwitcher"))))
+	if (CachedViewportSwitcher)
 	{
-		ViewportSwitcher->SetActiveWidgetIndex(bActive ? 1 : 0);
+		CachedViewportSwitcher->SetActiveWidgetIndex(bActive ? 1 : 0);
 		UE_LOG(LogTemp, Log, TEXT("UW_HUD::EventToggleCinematicMode - ViewportSwitcher set to index %d"), bActive ? 1 : 0);
 	}
 
@@ -1588,9 +1593,9 @@ void UW_HUD::EventToggleCinematicMode_Implementation(bool bActive, bool bFadeOut
 	// WindowsCanvas contains WindowsOL which holds RestMenu, Inventory, Equipment, etc.
 	// These are siblings of ViewportSwitcher (not children), so switching ViewportSwitcher
 	// index doesn't affect them. We must explicitly hide/show the entire windows layer.
-	if (UWidget* WindowsCanvas = GetWidgetFromName(TEXT("WindowsCanvas")))
+	if (CachedWindowsCanvas)
 	{
-		WindowsCanvas->SetVisibility(bActive ? ESlateVisibility::Collapsed : ESlateVisibility::SelfHitTestInvisible);
+		CachedWindowsCanvas->SetVisibility(bActive ? ESlateVisibility::Collapsed : ESlateVisibility::SelfHitTestInvisible);
 		UE_LOG(LogTemp, Log, TEXT("UW_HUD::EventToggleCinematicMode - WindowsCanvas %s"),
 			bActive ? TEXT("HIDDEN") : TEXT("VISIBLE"));
 	}
@@ -50,6 +50,9 @@ class UW_StatusEffectNotification;
 class UW_WorldMap;
 class UVerticalBox;
 class UW_Radar;
+class UW_BigScreenMessage;
+class UWidgetSwitcher;
+class UInvalidationBox;
 
 // Forward declarations for Blueprint types
 class UB_Stat;
@@ -75,6 +78,7 @@ public:
 	UW_HUD(const FObjectInitializer& ObjectInitializer);
 
 	// Widget lifecycle
+	virtual void NativeOnInitialized() override;
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
 
@@ -84,7 +88,7 @@ public:
 	// NOTE: Widget pointers (W_Interaction, W_GameMenu, etc.) are NOT declared here
 	// because the Blueprint UMG designer already has BindWidget variables with these names.
 	// Declaring them in C++ causes "property already exists" compiler errors.
-	// These widgets are cached via GetWidgetFromName in CacheWidgetReferences().
+	// These widgets are bound by name in one widget tree pass in CacheWidgetReferences().
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Default")
 	UW_LoadingScreen* LoadingScreen;
@@ -136,6 +140,16 @@ protected:
 	// Item wheel widgets - cached to configure SlotsToTrack if needed
 	UW_ItemWheelSlot* CachedItemWheelTools;
 
+	// Layout / message widgets toggled by HUD events - cached from UMG
+	UWidgetSwitcher* CachedViewportSwitcher;
+	UWidget* CachedWindowsCanvas;
+	UW_BigScreenMessage* CachedW_BigScreenMessage;
+	UWidget* CachedAutoSaveIcon;
+
+	// Invalidation panels wrapped around rarely changing HUD regions (see ApplyInvalidationLayout)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UInvalidationBox>> InvalidationPanels;
+
 public:
 
 	// ═══════════════════════════════════════════════════════════════════════
@@ -425,6 +439,18 @@ public:
 	UW_RestMenu* GetCachedRestMenu() const { return CachedW_RestMenu; }
 	UW_Radar* GetCachedRadar() const { return CachedW_Radar; }
 
+	// ═══════════════════════════════════════════════════════════════════════
+	// INVALIDATION
+	// ═══════════════════════════════════════════════════════════════════════
+
+	/**
+	 * Enable or disable caching on the HUD's invalidation panels.
+	 * Disabled panels behave like plain containers (A/B profiling with SLF.HUD.Invalidation).
+	 */
+	void SetInvalidationEnabled(bool bEnabled);
+
+	int32 GetNumInvalidationPanels() const { return InvalidationPanels.Num(); }
+
 	// Death Screen
 	UFUNCTION(BlueprintCallable, Category = "W_HUD|Death")
 	void ShowDeathScreen();
@@ -440,6 +466,12 @@ protected:
 	// Cache references
 	void CacheWidgetReferences();
 
+	/**
+	 * Wrap the rarely changing HUD regions in invalidation panels and mark the
+	 * per-frame widgets (radar, boss bar) volatile. Runs once before the Slate tree is built.
+	 */
+	void ApplyInvalidationLayout();
+
 	/** Internal handler bound to InventoryManager::OnItemLooted - bridges to EventOnItemLooted */
 	UFUNCTION()
 	void OnItemLootedHandler(UDataAsset* ItemAsset, int32 Amount);
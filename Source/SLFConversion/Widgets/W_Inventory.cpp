@@ -24,6 +24,7 @@
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
 #include "SLFPrimaryDataAssets.h"
+#include "Widgets/SLFSlotGridPool.h"
 
 UW_Inventory::UW_Inventory(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -36,6 +37,8 @@ UW_Inventory::UW_Inventory(const FObjectInitializer& ObjectInitializer)
 	, StorageMode(false)
 	, CategoryNavigationIndex(0)
 	, ItemNavigationIndex(0)
+	, InventorySlotPool(nullptr)
+	, StorageSlotPool(nullptr)
 	, bFocusedOnStoragePanel(false)
 {
 }
@@ -372,19 +375,13 @@ void UW_Inventory::CacheWidgetReferences()
 
 /**
  * CreateInventorySlots - Create inventory slots dynamically
- * Per Blueprint Construct logic: For loop 0 to SlotCount-1, create W_InventorySlot, add to grid
+ * Per Blueprint Construct logic: SlotCount W_InventorySlot widgets in UniformInventoryGrid.
+ * The slots come from a recycled pool: they are created once and rebound to items on
+ * refresh/filter/scroll, and the SlotCount window scrolls when there are more items.
  */
 void UW_Inventory::CreateInventorySlots()
 {
-	// Clear existing slots
-	InventorySlots.Empty();
-
-	// Clear the grid if it exists
-	if (UniformInventoryGrid)
-	{
-		UniformInventoryGrid->ClearChildren();
-	}
-	else
+	if (!UniformInventoryGrid)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] UniformInventoryGrid is NULL - cannot create slots!"));
 		return;
@@ -403,81 +400,40 @@ void UW_Inventory::CreateInventorySlots()
 		if (SlotsPerRow <= 0) SlotsPerRow = 10;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] CreateInventorySlots - Creating %d slots, %d per row"), NumSlots, SlotsPerRow);
+	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] CreateInventorySlots - %d slots, %d per row"), NumSlots, SlotsPerRow);
 
-	// Determine the slot widget class to use
-	TSubclassOf<UW_InventorySlot> SlotClass = InventorySlotClass;
+	TSubclassOf<UW_InventorySlot> SlotClass = ResolveInventorySlotClass();
 	if (!SlotClass)
 	{
-		// Try to load the Blueprint class
-		SlotClass = LoadClass<UW_InventorySlot>(nullptr,
-			TEXT("/Game/SoulslikeFramework/Widgets/Inventory/W_InventorySlot.W_InventorySlot_C"));
-
-		if (!SlotClass)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] Could not load W_InventorySlot class - cannot create slots!"));
-			return;
-		}
+		UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] Could not load W_InventorySlot class - cannot create slots!"));
+		return;
 	}
 
-	// Create slots in a loop (matching Blueprint For Loop 0 to SlotCount-1)
-	for (int32 Index = 0; Index < NumSlots; ++Index)
+	if (!InventorySlotPool)
 	{
-		// Create the slot widget
-		UW_InventorySlot* NewSlot = CreateWidget<UW_InventorySlot>(GetOwningPlayer(), SlotClass);
-		if (!NewSlot)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] Failed to create slot at index %d"), Index);
-			continue;
-		}
-
-		// Set slot properties (per Blueprint Create Widget node)
-		NewSlot->StorageRelated = false;
-		NewSlot->CraftingRelated = false;
-		NewSlot->EquipmentRelated = false;
-		// SlotColor is set via default value in Blueprint
-
-		// Calculate grid position
-		int32 Row = Index / SlotsPerRow;
-		int32 Column = Index % SlotsPerRow;
-
-		// Add to grid (per Blueprint AddChildToUniformGrid)
-		UUniformGridSlot* GridSlot = UniformInventoryGrid->AddChildToUniformGrid(NewSlot, Row, Column);
-		if (GridSlot)
-		{
-			// Grid slot created successfully
-		}
-
-		// Add to InventorySlots array
-		InventorySlots.Add(NewSlot);
-
-		// Bind slot events (per Blueprint Assign OnSelected, OnPressed, etc.)
-		NewSlot->OnSelected.AddDynamic(this, &UW_Inventory::HandleSlotSelected);
-		NewSlot->OnPressed.AddDynamic(this, &UW_Inventory::HandleSlotPressed);
-		NewSlot->OnSlotCleared.AddDynamic(this, &UW_Inventory::HandleSlotCleared);
-		NewSlot->OnSlotAssigned.AddDynamic(this, &UW_Inventory::HandleSlotAssigned);
+		InventorySlotPool = NewObject<USLFSlotGridPool>(this);
+		InventorySlotPool->OnSlotCreated.BindUObject(this, &UW_Inventory::HandleInventorySlotCreated);
+		InventorySlotPool->OnBindSlot.BindUObject(this, &UW_Inventory::BindPooledSlot);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] Created %d inventory slots"), InventorySlots.Num());
+	// Window = designed SlotCount (whole rows); existing widgets are reused
+	InventorySlotPool->Initialize(UniformInventoryGrid, SlotClass, SlotsPerRow,
+		FMath::DivideAndRoundUp(NumSlots, SlotsPerRow), NumSlots);
+	InventorySlotPool->GetSlotsAs(InventorySlots);
+
+	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] %d inventory slots ready (%d widgets created so far)"),
+		InventorySlots.Num(), InventorySlotPool->GetNumWidgetsCreated());
 
 	// Populate slots with items from inventory
 	PopulateSlotsWithItems();
 }
 
 /**
- * CreateStorageSlots - Create storage slots dynamically
+ * CreateStorageSlots - Create storage slots dynamically (pooled, like inventory slots)
  */
 void UW_Inventory::CreateStorageSlots()
 {
-	// Clear existing storage slots
-	StorageSlots.Empty();
-
-	// Clear the grid if it exists
-	if (UniformStorageGrid)
-	{
-		UniformStorageGrid->ClearChildren();
-	}
-	else
+	if (!UniformStorageGrid)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] UniformStorageGrid is NULL - cannot create storage slots!"));
 		return;
@@ -496,56 +452,195 @@ void UW_Inventory::CreateStorageSlots()
 		if (SlotsPerRow <= 0) SlotsPerRow = 10;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] CreateStorageSlots - Creating %d slots, %d per row"), NumSlots, SlotsPerRow);
+	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] CreateStorageSlots - %d slots, %d per row"), NumSlots, SlotsPerRow);
 
-	// Determine the slot widget class to use
-	TSubclassOf<UW_InventorySlot> SlotClass = InventorySlotClass;
+	TSubclassOf<UW_InventorySlot> SlotClass = ResolveInventorySlotClass();
 	if (!SlotClass)
 	{
-		SlotClass = LoadClass<UW_InventorySlot>(nullptr,
-			TEXT("/Game/SoulslikeFramework/Widgets/Inventory/W_InventorySlot.W_InventorySlot_C"));
+		UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] Could not load W_InventorySlot class for storage slots!"));
+		return;
+	}
 
-		if (!SlotClass)
+	if (!StorageSlotPool)
+	{
+		StorageSlotPool = NewObject<USLFSlotGridPool>(this);
+		StorageSlotPool->OnSlotCreated.BindUObject(this, &UW_Inventory::HandleStorageSlotCreated);
+		StorageSlotPool->OnBindSlot.BindUObject(this, &UW_Inventory::BindPooledSlot);
+	}
+
+	StorageSlotPool->Initialize(UniformStorageGrid, SlotClass, SlotsPerRow,
+		FMath::DivideAndRoundUp(NumSlots, SlotsPerRow), NumSlots);
+	StorageSlotPool->GetSlotsAs(StorageSlots);
+
+	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] %d storage slots ready"), StorageSlots.Num());
+}
+
+/**
+ * ResolveInventorySlotClass - Configured slot class, else the W_InventorySlot Blueprint
+ */
+TSubclassOf<UW_InventorySlot> UW_Inventory::ResolveInventorySlotClass() const
+{
+	if (InventorySlotClass)
+	{
+		return InventorySlotClass;
+	}
+
+	// Fallback: load the Blueprint slot class (already resident after the first open)
+	return LoadClass<UW_InventorySlot>(nullptr,
+		TEXT("/Game/SoulslikeFramework/Widgets/Inventory/W_InventorySlot.W_InventorySlot_C"));
+}
+
+/**
+ * HandleInventorySlotCreated - Configure a freshly pooled inventory slot (runs once per widget)
+ */
+void UW_Inventory::HandleInventorySlotCreated(UUserWidget* SlotWidget)
+{
+	UW_InventorySlot* NewSlot = Cast<UW_InventorySlot>(SlotWidget);
+	if (!NewSlot)
+	{
+		return;
+	}
+
+	// Set slot properties (per Blueprint Create Widget node)
+	NewSlot->StorageRelated = false;
+	NewSlot->CraftingRelated = false;
+	NewSlot->EquipmentRelated = false;
+	// SlotColor is set via default value in Blueprint
+
+	// Bind slot events (per Blueprint Assign OnSelected, OnPressed, etc.)
+	NewSlot->OnSelected.AddDynamic(this, &UW_Inventory::HandleSlotSelected);
+	NewSlot->OnPressed.AddDynamic(this, &UW_Inventory::HandleSlotPressed);
+	NewSlot->OnSlotCleared.AddDynamic(this, &UW_Inventory::HandleSlotCleared);
+	NewSlot->OnSlotAssigned.AddDynamic(this, &UW_Inventory::HandleSlotAssigned);
+}
+
+/**
+ * HandleStorageSlotCreated - Configure a freshly pooled storage slot (runs once per widget)
+ */
+void UW_Inventory::HandleStorageSlotCreated(UUserWidget* SlotWidget)
+{
+	UW_InventorySlot* NewSlot = Cast<UW_InventorySlot>(SlotWidget);
+	if (!NewSlot)
+	{
+		return;
+	}
+
+	// Storage slots have StorageRelated = true
+	NewSlot->StorageRelated = true;
+	NewSlot->CraftingRelated = false;
+	NewSlot->EquipmentRelated = false;
+
+	// bp_only: Storage slots use a darker color than inventory slots
+	// Inventory color: (R=0.105882, G=0.090196, B=0.074510, A=0.901961) - brownish
+	// Storage color: (R=0.039216, G=0.043137, B=0.066667, A=0.901961) - darker bluish
+	NewSlot->SlotColor = FLinearColor(0.039216f, 0.043137f, 0.066667f, 0.901961f);
+
+	// Bind events
+	NewSlot->OnSelected.AddDynamic(this, &UW_Inventory::HandleSlotSelected);
+	NewSlot->OnPressed.AddDynamic(this, &UW_Inventory::HandleSlotPressed);
+	NewSlot->OnSlotCleared.AddDynamic(this, &UW_Inventory::HandleSlotCleared);
+	NewSlot->OnSlotAssigned.AddDynamic(this, &UW_Inventory::HandleSlotAssigned);
+}
+
+/**
+ * BindPooledSlot - Show Entry in a pooled slot (nullptr = empty)
+ * Only called by the pool for slots whose item/count changed.
+ */
+void UW_Inventory::BindPooledSlot(UUserWidget* SlotWidget, const FSLFSlotGridEntry* Entry)
+{
+	UW_InventorySlot* InvSlot = Cast<UW_InventorySlot>(SlotWidget);
+	if (!InvSlot)
+	{
+		return;
+	}
+
+	UPDA_Item* Item = Entry ? Cast<UPDA_Item>(Entry->Item) : nullptr;
+	if (!Item)
+	{
+		if (InvSlot->IsOccupied)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] Could not load W_InventorySlot class for storage slots!"));
-			return;
+			InvSlot->EventClearSlot(false);
 		}
+		return;
+	}
+
+	// Same item, new stack size - just update the amount text
+	if (InvSlot->IsOccupied && InvSlot->AssignedItem == Item)
+	{
+		InvSlot->EventChangeAmount(Entry->Count);
+		return;
 	}
 
-	// Create storage slots
-	for (int32 Index = 0; Index < NumSlots; ++Index)
+	if (InvSlot->IsOccupied)
 	{
-		UW_InventorySlot* NewSlot = CreateWidget<UW_InventorySlot>(GetOwningPlayer(), SlotClass);
-		if (!NewSlot)
+		InvSlot->EventClearSlot(false);
+	}
+	InvSlot->EventOccupySlot(Item, Entry->Count);
+}
+
+/**
+ * BuildInventoryEntries - Item list for the inventory grid (optionally category filtered)
+ */
+void UW_Inventory::BuildInventoryEntries(bool bApplyFilter, TArray<FSLFSlotGridEntry>& OutEntries) const
+{
+	OutEntries.Reset();
+	if (!InventoryComponent)
+	{
+		return;
+	}
+
+	TArray<FSLFInventoryItem> AllItems = InventoryComponent->GetAllItems();
+	OutEntries.Reserve(AllItems.Num());
+
+	for (const FSLFInventoryItem& InvItem : AllItems)
+	{
+		UPDA_Item* Item = Cast<UPDA_Item>(InvItem.ItemAsset);
+		if (!Item)
 		{
 			continue;
 		}
 
-		// Storage slots have StorageRelated = true
-		NewSlot->StorageRelated = true;
-		NewSlot->CraftingRelated = false;
-		NewSlot->EquipmentRelated = false;
-
-		// bp_only: Storage slots use a darker color than inventory slots
-		// Inventory color: (R=0.105882, G=0.090196, B=0.074510, A=0.901961) - brownish
-		// Storage color: (R=0.039216, G=0.043137, B=0.066667, A=0.901961) - darker bluish
-		NewSlot->SlotColor = FLinearColor(0.039216f, 0.043137f, 0.066667f, 0.901961f);
-
-		int32 Row = Index / SlotsPerRow;
-		int32 Column = Index % SlotsPerRow;
+		// If no filter (None), show all items; otherwise filter by category
+		if (bApplyFilter && ActiveFilterCategory != ESLFItemCategory::None &&
+			Item->ItemInformation.Category.Category != ActiveFilterCategory)
+		{
+			continue;
+		}
 
-		UniformStorageGrid->AddChildToUniformGrid(NewSlot, Row, Column);
+		OutEntries.Emplace(Item, InvItem.Amount > 0 ? InvItem.Amount : 1);
+	}
+}
 
-		StorageSlots.Add(NewSlot);
+/**
+ * ScrollActiveGrid - Scroll the focused grid's slot window by whole rows
+ */
+bool UW_Inventory::ScrollActiveGrid(int32 DeltaRows)
+{
+	USLFSlotGridPool* Pool = (StorageMode && bFocusedOnStoragePanel) ? StorageSlotPool : InventorySlotPool;
+	if (!Pool || !Pool->ScrollByRows(DeltaRows))
+	{
+		return false;
+	}
 
-		// Bind events
-		NewSlot->OnSelected.AddDynamic(this, &UW_Inventory::HandleSlotSelected);
-		NewSlot->OnPressed.AddDynamic(this, &UW_Inventory::HandleSlotPressed);
-		NewSlot->OnSlotCleared.AddDynamic(this, &UW_Inventory::HandleSlotCleared);
-		NewSlot->OnSlotAssigned.AddDynamic(this, &UW_Inventory::HandleSlotAssigned);
+	// Slot widgets keep their index; re-run selection so the info panel shows the new item
+	ReinitOccupiedInventorySlots();
+	TArray<UW_InventorySlot*>& ActiveSlots = (StorageMode && bFocusedOnStoragePanel) ? StorageSlots : InventorySlots;
+	if (ActiveSlots.IsValidIndex(ItemNavigationIndex))
+	{
+		SelectedSlot = ActiveSlots[ItemNavigationIndex];
+		EventSetupItemInfoPanel(SelectedSlot);
 	}
+	return true;
+}
 
-	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] Created %d storage slots"), StorageSlots.Num());
+FReply UW_Inventory::NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	const float WheelDelta = InMouseEvent.GetWheelDelta();
+	if (WheelDelta != 0.0f && ScrollActiveGrid(WheelDelta > 0.0f ? -1 : 1))
+	{
+		return FReply::Handled();
+	}
+	return Super::NativeOnMouseWheel(InGeometry, InMouseEvent);
 }
 
 /**
@@ -560,47 +655,30 @@ void UW_Inventory::PopulateStorageSlotsWithItems()
 		return;
 	}
 
-	// Clear storage slots first
-	for (UW_InventorySlot* StorageSlot : StorageSlots)
+	if (!StorageSlotPool)
 	{
-		if (StorageSlot && StorageSlot->IsOccupied)
-		{
-			StorageSlot->EventClearSlot(false);
-		}
+		return;
 	}
 
 	// Get stored items using the new GetStoredItems() function
 	TArray<FSLFInventoryItem> StoredItemsList = InventoryComponent->GetStoredItems();
 
-	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] PopulateStorageSlotsWithItems - %d stored items, %d slots"),
-		StoredItemsList.Num(), StorageSlots.Num());
-
-	int32 SlotIndex = 0;
+	TArray<FSLFSlotGridEntry> Entries;
+	Entries.Reserve(StoredItemsList.Num());
 	for (const FSLFInventoryItem& StoredItem : StoredItemsList)
 	{
-		if (SlotIndex >= StorageSlots.Num())
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] Not enough storage slots for all stored items!"));
-			break;
-		}
-
-		UPDA_Item* Item = Cast<UPDA_Item>(StoredItem.ItemAsset);
-		if (!Item)
+		if (UPDA_Item* Item = Cast<UPDA_Item>(StoredItem.ItemAsset))
 		{
-			continue;
+			Entries.Emplace(Item, StoredItem.Amount > 0 ? StoredItem.Amount : 1);
 		}
-
-		if (StorageSlots[SlotIndex])
-		{
-			int32 ItemCount = StoredItem.Amount > 0 ? StoredItem.Amount : 1;
-			StorageSlots[SlotIndex]->EventOccupySlot(Item, ItemCount);
-			UE_LOG(LogTemp, Log, TEXT("[W_Inventory] Populated storage slot %d with %s x%d"),
-				SlotIndex, *Item->GetName(), ItemCount);
-		}
-		SlotIndex++;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] PopulateStorageSlotsWithItems complete - populated %d slots"), SlotIndex);
+	// Pool diffs against what each slot already shows - unchanged slots are untouched
+	const int32 BindsBefore = StorageSlotPool->GetNumSlotBinds();
+	StorageSlotPool->SetEntries(MoveTemp(Entries));
+
+	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] PopulateStorageSlotsWithItems - %d stored items, %d slots rebound"),
+		StorageSlotPool->GetEntries().Num(), StorageSlotPool->GetNumSlotBinds() - BindsBefore);
 }
 
 /**
@@ -691,74 +769,29 @@ void UW_Inventory::PopulateSlotsWithItems()
 		return;
 	}
 
-	// Clear all slots first
-	for (UW_InventorySlot* InvSlot : InventorySlots)
+	if (!InventorySlotPool)
 	{
-		if (InvSlot && InvSlot->IsOccupied)
-		{
-			InvSlot->EventClearSlot(false);
-		}
+		return;
 	}
 
-	// Get all items from inventory using the GetAllItems function
-	TArray<FSLFInventoryItem> AllItems = InventoryComponent->GetAllItems();
-
-	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] PopulateSlotsWithItems - %d items in inventory, %d slots available"),
-		AllItems.Num(), InventorySlots.Num());
-
-	int32 SlotIndex = 0;
-	for (const FSLFInventoryItem& InvItem : AllItems)
-	{
-		if (SlotIndex >= InventorySlots.Num())
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] Not enough slots for all items!"));
-			break;
-		}
-
-		UObject* ItemAsset = InvItem.ItemAsset;
-		if (!ItemAsset)
-		{
-			continue;
-		}
-
-		// Cast to UPDA_Item for EventOccupySlot
-		UPDA_Item* Item = Cast<UPDA_Item>(ItemAsset);
-		if (!Item)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] Item is not UPDA_Item: %s"), *ItemAsset->GetName());
-			continue;
-		}
-
-		// Get item count from the inventory item struct
-		int32 ItemCount = InvItem.Amount;
-		if (ItemCount <= 0)
-		{
-			ItemCount = 1;
-		}
+	TArray<FSLFSlotGridEntry> Entries;
+	BuildInventoryEntries(false, Entries);
 
-		// Find next available slot
-		UW_InventorySlot* InvSlot = InventorySlots[SlotIndex];
-		if (InvSlot)
-		{
-			InvSlot->EventOccupySlot(Item, ItemCount);
-			UE_LOG(LogTemp, Log, TEXT("[W_Inventory] Populated slot %d with %s x%d"),
-				SlotIndex, *Item->GetName(), ItemCount);
-		}
+	// Pool diffs against what each slot already shows - unchanged slots are untouched
+	const int32 BindsBefore = InventorySlotPool->GetNumSlotBinds();
+	InventorySlotPool->SetEntries(MoveTemp(Entries));
 
-		SlotIndex++;
-	}
-
-	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] PopulateSlotsWithItems complete - populated %d slots"), SlotIndex);
+	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] PopulateSlotsWithItems - %d items, %d slots rebound"),
+		InventorySlotPool->GetEntries().Num(), InventorySlotPool->GetNumSlotBinds() - BindsBefore);
 }
 
 /**
  * RefreshFilteredDisplay - Repopulate slots showing only items that match the active category filter
  *
  * When a category filter is applied, this function:
- * 1. Clears all inventory slot displays
- * 2. Gets all items from the InventoryComponent
- * 3. Filters items by ActiveFilterCategory
- * 4. Repopulates slots with only matching items
+ * 1. Gets all items from the InventoryComponent
+ * 2. Filters items by ActiveFilterCategory
+ * 3. Hands the list to the slot pool, which rebinds only the slots that changed
  */
 void UW_Inventory::RefreshFilteredDisplay()
 {
@@ -768,78 +801,20 @@ void UW_Inventory::RefreshFilteredDisplay()
 		return;
 	}
 
-	// Clear all slots first
-	for (UW_InventorySlot* InvSlot : InventorySlots)
+	if (!InventorySlotPool)
 	{
-		if (InvSlot && InvSlot->IsOccupied)
-		{
-			InvSlot->EventClearSlot(false);
-		}
+		return;
 	}
 
-	// Get all items from inventory
-	TArray<FSLFInventoryItem> AllItems = InventoryComponent->GetAllItems();
-
-	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] RefreshFilteredDisplay - Filter: %d, Total items: %d"),
-		(int32)ActiveFilterCategory, AllItems.Num());
-
-	int32 SlotIndex = 0;
-	int32 MatchingItems = 0;
-
-	for (const FSLFInventoryItem& InvItem : AllItems)
-	{
-		if (SlotIndex >= InventorySlots.Num())
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[W_Inventory] Not enough slots for filtered items!"));
-			break;
-		}
-
-		UObject* ItemAsset = InvItem.ItemAsset;
-		if (!ItemAsset)
-		{
-			continue;
-		}
-
-		// Cast to UPDA_Item for category check
-		UPDA_Item* Item = Cast<UPDA_Item>(ItemAsset);
-		if (!Item)
-		{
-			continue;
-		}
+	TArray<FSLFSlotGridEntry> Entries;
+	BuildInventoryEntries(true, Entries);
 
-		// Check category filter
-		ESLFItemCategory ItemCategory = Item->ItemInformation.Category.Category;
+	// Filter switch starts at the top of the list
+	const int32 BindsBefore = InventorySlotPool->GetNumSlotBinds();
+	InventorySlotPool->SetEntries(MoveTemp(Entries), true);
 
-		// If no filter (None), show all items; otherwise filter by category
-		if (ActiveFilterCategory != ESLFItemCategory::None && ItemCategory != ActiveFilterCategory)
-		{
-			// Item doesn't match filter - skip it
-			UE_LOG(LogTemp, Verbose, TEXT("[W_Inventory] Filtering out %s (Category: %d, Filter: %d)"),
-				*Item->GetName(), (int32)ItemCategory, (int32)ActiveFilterCategory);
-			continue;
-		}
-
-		// Item matches filter - populate slot
-		int32 ItemCount = InvItem.Amount;
-		if (ItemCount <= 0)
-		{
-			ItemCount = 1;
-		}
-
-		UW_InventorySlot* InvSlot = InventorySlots[SlotIndex];
-		if (InvSlot)
-		{
-			InvSlot->EventOccupySlot(Item, ItemCount);
-			MatchingItems++;
-			UE_LOG(LogTemp, Verbose, TEXT("[W_Inventory] Populated slot %d with %s (matches filter)"),
-				SlotIndex, *Item->GetName());
-		}
-
-		SlotIndex++;
-	}
-
-	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] RefreshFilteredDisplay complete - %d items match filter, populated %d slots"),
-		MatchingItems, SlotIndex);
+	UE_LOG(LogTemp, Log, TEXT("[W_Inventory] RefreshFilteredDisplay - Filter: %d, %d items match, %d slots rebound"),
+		(int32)ActiveFilterCategory, InventorySlotPool->GetEntries().Num(), InventorySlotPool->GetNumSlotBinds() - BindsBefore);
 }
 
 /**
@@ -1132,6 +1107,11 @@ void UW_Inventory::EventNavigateUp_Implementation()
 			EventSetupItemInfoPanel(SelectedSlot);
 		}
 	}
+	else
+	{
+		// Top row of the slot window - scroll earlier items into view
+		ScrollActiveGrid(-1);
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("  New index: %d"), ItemNavigationIndex);
 }
@@ -1191,6 +1171,11 @@ void UW_Inventory::EventNavigateDown_Implementation()
 			EventSetupItemInfoPanel(SelectedSlot);
 		}
 	}
+	else
+	{
+		// Bottom row of the slot window - scroll later items into view
+		ScrollActiveGrid(1);
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("  New index: %d"), ItemNavigationIndex);
 }
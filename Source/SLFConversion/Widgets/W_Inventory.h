@@ -26,6 +26,8 @@
 class UW_InventorySlot;
 class UW_Inventory_CategoryEntry;
 class UW_InventoryAction;
+class USLFSlotGridPool;
+struct FSLFSlotGridEntry;
 
 // Forward declarations for UMG types
 class UScrollBox;
@@ -59,6 +61,7 @@ public:
 
 	// Input handling (replaces Blueprint EventGraph input bindings)
 	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
+	virtual FReply NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 
 	// ═══════════════════════════════════════════════════════════════════════
 	// BIND WIDGETS (Grid panels for slot containers)
@@ -298,6 +301,27 @@ protected:
 	// Refresh display with filtered items (used when category changes)
 	void RefreshFilteredDisplay();
 
+	// Build pooled-grid entries from the inventory (optionally applying ActiveFilterCategory)
+	void BuildInventoryEntries(bool bApplyFilter, TArray<FSLFSlotGridEntry>& OutEntries) const;
+
+	// Resolve InventorySlotClass, falling back to the W_InventorySlot Blueprint
+	TSubclassOf<UW_InventorySlot> ResolveInventorySlotClass() const;
+
+	// Scroll the focused grid by whole rows (items past the slot window). Returns true if it moved.
+	bool ScrollActiveGrid(int32 DeltaRows);
+
+	// Pool callbacks: configure new slot widgets / rebind a slot to an entry
+	void HandleInventorySlotCreated(UUserWidget* SlotWidget);
+	void HandleStorageSlotCreated(UUserWidget* SlotWidget);
+	void BindPooledSlot(UUserWidget* SlotWidget, const FSLFSlotGridEntry* Entry);
+
+	// Recycled slot widgets - created once, rebound on refresh/filter/scroll
+	UPROPERTY(Transient)
+	USLFSlotGridPool* InventorySlotPool;
+
+	UPROPERTY(Transient)
+	USLFSlotGridPool* StorageSlotPool;
+
 	// Default slot widget class for dynamic creation
 	UPROPERTY(EditDefaultsOnly, Category = "Config")
 	TSubclassOf<UW_InventorySlot> InventorySlotClass;
@@ -6,6 +6,7 @@
 #include "Widgets/W_NPC_Window_Vendor.h"
 #include "Widgets/W_VendorSlot.h"
 #include "Widgets/W_VendorAction.h"
+#include "Widgets/SLFSlotGridPool.h"
 #include "Interfaces/BPI_Controller.h"
 #include "Components/InventoryManagerComponent.h"
 #include "Components/UniformGridPanel.h"
@@ -33,6 +34,7 @@ UW_NPC_Window_Vendor::UW_NPC_Window_Vendor(const FObjectInitializer& ObjectIniti
 	, CachedVendorActionPopup(nullptr)
 	, CachedCharacterStatsOverlay(nullptr)
 	, bActionMenuOpen(false)
+	, VendorSlotPool(nullptr)
 {
 }
 
@@ -58,10 +60,10 @@ void UW_NPC_Window_Vendor::NativeConstruct()
 
 void UW_NPC_Window_Vendor::NativeDestruct()
 {
-	// Unbind from all slot events
+	// Unbind from slot events (pooled slots are bound once at creation and keep their bindings)
 	for (UW_VendorSlot* VendorSlotWidget : VendorSlots)
 	{
-		if (VendorSlotWidget)
+		if (VendorSlotWidget && !(VendorSlotPool && VendorSlotPool->GetSlots().Contains(VendorSlotWidget)))
 		{
 			VendorSlotWidget->OnSelected.RemoveAll(this);
 			VendorSlotWidget->OnPressed.RemoveAll(this);
@@ -201,6 +203,16 @@ FReply UW_NPC_Window_Vendor::NativeOnKeyDown(const FGeometry& InGeometry, const
 	return Super::NativeOnKeyDown(InGeometry, InKeyEvent);
 }
 
+FReply UW_NPC_Window_Vendor::NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	const float WheelDelta = InMouseEvent.GetWheelDelta();
+	if (WheelDelta != 0.0f && !bActionMenuOpen && ScrollVendorGrid(WheelDelta > 0.0f ? -1 : 1))
+	{
+		return FReply::Handled();
+	}
+	return Super::NativeOnMouseWheel(InGeometry, InMouseEvent);
+}
+
 void UW_NPC_Window_Vendor::CacheWidgetReferences()
 {
 	// Cache UniformGridPanel for vendor slots
@@ -265,6 +277,37 @@ void UW_NPC_Window_Vendor::BindSlotEvents(UW_VendorSlot* VendorSlotWidget)
 	VendorSlotWidget->OnSlotAssigned.AddDynamic(this, &UW_NPC_Window_Vendor::EventOnVendorSlotAssigned);
 }
 
+/**
+ * HandleVendorSlotCreated - One-time setup for a pooled vendor slot
+ */
+void UW_NPC_Window_Vendor::HandleVendorSlotCreated(UUserWidget* SlotWidget)
+{
+	BindSlotEvents(Cast<UW_VendorSlot>(SlotWidget));
+}
+
+/**
+ * BindVendorSlot - Show a vendor entry (UserData = price, UserFlags = infinite) in a pooled slot
+ */
+void UW_NPC_Window_Vendor::BindVendorSlot(UUserWidget* SlotWidget, const FSLFSlotGridEntry* Entry)
+{
+	UW_VendorSlot* VendorSlotWidget = Cast<UW_VendorSlot>(SlotWidget);
+	if (!VendorSlotWidget)
+	{
+		return;
+	}
+
+	if (VendorSlotWidget->IsOccupied)
+	{
+		VendorSlotWidget->EventClearSlot(false);
+	}
+
+	UPDA_Item* ItemData = Entry ? Cast<UPDA_Item>(Entry->Item) : nullptr;
+	if (ItemData)
+	{
+		VendorSlotWidget->EventOccupySlot(ItemData, Entry->Count, Entry->UserData, Entry->UserFlags != 0, static_cast<uint8>(VendorType));
+	}
+}
+
 void UW_NPC_Window_Vendor::UpdateSlotSelection(int32 NewIndex)
 {
 	UE_LOG(LogTemp, Warning, TEXT("[W_NPC_Window_Vendor] UpdateSlotSelection - NewIndex: %d, OccupiedSlots: %d, CurrentNavIndex: %d"),
@@ -328,6 +371,109 @@ void UW_NPC_Window_Vendor::UpdateSlotSelection(int32 NewIndex)
 	UE_LOG(LogTemp, Warning, TEXT("[W_NPC_Window_Vendor] UpdateSlotSelection END - NavigationIndex is now: %d"), NavigationIndex);
 }
 
+/**
+ * StepVendorSelection - Move through the vendor's full stock list, not just the visible window
+ */
+void UW_NPC_Window_Vendor::StepVendorSelection(int32 DeltaEntries)
+{
+	const int32 SlotIndex = VendorSlots.Find(SelectedSlot);
+	if (!VendorSlotPool || SlotIndex == INDEX_NONE || DeltaEntries == 0)
+	{
+		return;
+	}
+
+	// Step over empty entries (sold out, invalid items); stepping off either end is refused
+	const TArray<FSLFSlotGridEntry>& Entries = VendorSlotPool->GetEntries();
+	int32 TargetEntry = VendorSlotPool->GetEntryIndexForSlot(SlotIndex) + DeltaEntries;
+	while (Entries.IsValidIndex(TargetEntry) && !Entries[TargetEntry].Item)
+	{
+		TargetEntry += DeltaEntries;
+	}
+	if (!Entries.IsValidIndex(TargetEntry))
+	{
+		return;
+	}
+
+	// Rebinding a scrolled window clears and re-occupies slots - drop the selection first so
+	// EventOnSellSlotCleared does not try to move it
+	SelectedSlot->EventOnSelected(false);
+	SelectedSlot = nullptr;
+
+	const int32 TargetSlot = VendorSlotPool->ScrollToEntry(TargetEntry);
+	RebuildOccupiedVendorSlots();
+
+	const int32 OccupiedIndex = VendorSlots.IsValidIndex(TargetSlot) ? OccupiedVendorSlots.Find(VendorSlots[TargetSlot]) : INDEX_NONE;
+	UpdateSlotSelection(OccupiedIndex != INDEX_NONE ? OccupiedIndex : NavigationIndex);
+}
+
+/**
+ * ScrollVendorGrid - Scroll the vendor window by whole rows
+ */
+bool UW_NPC_Window_Vendor::ScrollVendorGrid(int32 DeltaRows)
+{
+	if (!VendorSlotPool || VendorSlotPool->GetFirstVisibleRow() + DeltaRows < 0
+		|| VendorSlotPool->GetFirstVisibleRow() + DeltaRows > VendorSlotPool->GetMaxFirstVisibleRow())
+	{
+		return false;
+	}
+
+	const int32 SlotIndex = VendorSlots.Find(SelectedSlot);
+	if (SelectedSlot)
+	{
+		SelectedSlot->EventOnSelected(false);
+		SelectedSlot = nullptr;
+	}
+
+	VendorSlotPool->ScrollByRows(DeltaRows);
+	RebuildOccupiedVendorSlots();
+
+	// Slot widgets keep their index; reselect whatever now sits in the selected slot
+	const int32 OccupiedIndex = VendorSlots.IsValidIndex(SlotIndex) ? OccupiedVendorSlots.Find(VendorSlots[SlotIndex]) : INDEX_NONE;
+	UpdateSlotSelection(OccupiedIndex != INDEX_NONE ? OccupiedIndex : NavigationIndex);
+	return true;
+}
+
+/**
+ * RebuildOccupiedVendorSlots - OnSlotAssigned appends in bind order; a scroll rebinds out of order
+ */
+void UW_NPC_Window_Vendor::RebuildOccupiedVendorSlots()
+{
+	OccupiedVendorSlots.Reset();
+	for (UW_VendorSlot* VendorSlotWidget : VendorSlots)
+	{
+		if (VendorSlotWidget && VendorSlotWidget->IsOccupied)
+		{
+			OccupiedVendorSlots.Add(VendorSlotWidget);
+		}
+	}
+}
+
+/**
+ * SyncVendorSlotEntry - Keep the pool entry in step with a slot that changed its own count
+ */
+void UW_NPC_Window_Vendor::SyncVendorSlotEntry(UW_VendorSlot* VendorSlotWidget)
+{
+	const int32 SlotIndex = VendorSlots.Find(VendorSlotWidget);
+	if (!VendorSlotPool || SlotIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 EntryIndex = VendorSlotPool->GetEntryIndexForSlot(SlotIndex);
+	if (!VendorSlotPool->GetEntries().IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	FSLFSlotGridEntry Entry;
+	if (VendorSlotWidget->IsOccupied)
+	{
+		Entry = VendorSlotPool->GetEntries()[EntryIndex];
+		Entry.Count = VendorSlotWidget->Count;
+	}
+	VendorSlotPool->SyncEntry(EntryIndex, Entry);
+}
+
 int32 UW_NPC_Window_Vendor::GetSlotsPerRow() const
 {
 	if (UPDA_Vendor* VendorAsset = Cast<UPDA_Vendor>(CurrentVendorAsset))
@@ -431,23 +577,31 @@ void UW_NPC_Window_Vendor::EventInitializeVendor_Implementation(const FText& Npc
 		CachedVendorTitleText->SetText(NpcName);
 	}
 
+	// Slots added ad hoc by AddNewSlots are not pooled - drop them
+	for (UW_VendorSlot* VendorSlotWidget : VendorSlots)
+	{
+		if (VendorSlotWidget && !(VendorSlotPool && VendorSlotPool->GetSlots().Contains(VendorSlotWidget)))
+		{
+			VendorSlotWidget->RemoveFromParent();
+		}
+	}
+
 	// Clear existing slots
 	VendorSlots.Empty();
 	OccupiedVendorSlots.Empty();
 	SelectedSlot = nullptr;
 	NavigationIndex = 0;
 
-	if (CachedUniformInventoryGrid)
-	{
-		CachedUniformInventoryGrid->ClearChildren();
-	}
-
 	// Cast to C++ UPDA_Vendor (Blueprint is now reparented to C++ class)
 	UPDA_Vendor* VendorData = Cast<UPDA_Vendor>(InVendorAsset);
 	if (!VendorData)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[W_NPC_Window_Vendor] EventInitializeVendor - VendorAsset cast to UPDA_Vendor failed! Class: %s"),
 			InVendorAsset ? *InVendorAsset->GetClass()->GetName() : TEXT("null"));
+		if (VendorSlotPool)
+		{
+			VendorSlotPool->ClearEntries();
+		}
 		return;
 	}
 
@@ -464,12 +618,27 @@ void UW_NPC_Window_Vendor::EventInitializeVendor_Implementation(const FText& Npc
 		return;
 	}
 
-	UWorld* World = GetWorld();
-	if (!World)
+	if (!CachedUniformInventoryGrid)
 	{
 		return;
 	}
 
+	if (!VendorSlotPool)
+	{
+		VendorSlotPool = NewObject<USLFSlotGridPool>(this);
+		VendorSlotPool->OnSlotCreated.BindUObject(this, &UW_NPC_Window_Vendor::HandleVendorSlotCreated);
+		VendorSlotPool->OnBindSlot.BindUObject(this, &UW_NPC_Window_Vendor::BindVendorSlot);
+	}
+
+	// Reuses existing widgets. Vendor slots change their own state during a session (purchases,
+	// sales), so Initialize invalidates the bindings and every slot is rebound once below.
+	// Windowed like the inventory: DefaultSlotCount slots exist and longer stock lists scroll.
+	const int32 VisibleRows = FMath::Max(1, FMath::DivideAndRoundUp(VendorData->DefaultSlotCount, SlotsPerRow));
+	VendorSlotPool->Initialize(CachedUniformInventoryGrid, SlotClass, SlotsPerRow, VisibleRows, VendorData->DefaultSlotCount);
+
+	// Entry layout: Count = amount/stock, UserData = price, UserFlags = infinite stock
+	TArray<FSLFSlotGridEntry> Entries;
+
 	// Determine what items to show based on VendorType
 	// Buy (0) = show vendor's items for sale
 	// Sell (1) = show player's inventory items to sell
@@ -501,61 +670,31 @@ void UW_NPC_Window_Vendor::EventInitializeVendor_Implementation(const FText& Npc
 				TArray<FSLFInventoryItem> AllItems = InventoryComp->GetAllItems();
 				UE_LOG(LogTemp, Log, TEXT("[W_NPC_Window_Vendor] Found %d inventory items"), AllItems.Num());
 
-				int32 SlotCount = FMath::Max(VendorData->DefaultSlotCount, AllItems.Num());
-
-				// Create slots
-				for (int32 i = 0; i < SlotCount; i++)
+				Entries.Reserve(AllItems.Num());
+				for (const FSLFInventoryItem& InvItem : AllItems)
 				{
-					UW_VendorSlot* NewSlot = CreateWidget<UW_VendorSlot>(World, SlotClass);
-					if (NewSlot)
+					UPDA_Item* ItemData = Cast<UPDA_Item>(InvItem.ItemAsset);
+					if (!ItemData)
 					{
-						VendorSlots.Add(NewSlot);
-						BindSlotEvents(NewSlot);
-
-						if (CachedUniformInventoryGrid)
-						{
-							int32 Row = i / SlotsPerRow;
-							int32 Column = i % SlotsPerRow;
-							CachedUniformInventoryGrid->AddChildToUniformGrid(NewSlot, Row, Column);
-						}
+						// Keep the slot position empty, as the per-slot loop did
+						Entries.AddDefaulted();
+						continue;
 					}
-				}
 
-				// Populate slots with inventory items
-				int32 SlotIndex = 0;
-				for (const FSLFInventoryItem& InvItem : AllItems)
-				{
-					if (SlotIndex < VendorSlots.Num() && InvItem.ItemAsset)
+					// Use item's SellPrice, with fallback if not set
+					// Default sell price = 10 if SellPrice is 0 (common in Soulslike games)
+					int32 ItemSellPrice = ItemData->SellPrice;
+					if (ItemSellPrice <= 0)
 					{
-						UPDA_Item* ItemData = Cast<UPDA_Item>(InvItem.ItemAsset);
-						if (ItemData)
-						{
-							UW_VendorSlot* CurrentSlot = VendorSlots[SlotIndex];
-
-							// Use item's SellPrice, with fallback if not set
-							// Default sell price = 10 if SellPrice is 0 (common in Soulslike games)
-							int32 ItemSellPrice = ItemData->SellPrice;
-							if (ItemSellPrice <= 0)
-							{
-								// Fallback: use a default sell value
-								// Could be enhanced to use item category or rarity
-								ItemSellPrice = 10;
-								UE_LOG(LogTemp, Log, TEXT("[W_NPC_Window_Vendor] Item %s has no SellPrice, using default: %d"),
-									*ItemData->GetName(), ItemSellPrice);
-							}
-
-							CurrentSlot->EventOccupySlot(
-								ItemData,
-								InvItem.Amount,
-								ItemSellPrice,
-								false,  // Not infinite - player has limited amount
-								InVendorType
-							);
-							// NOTE: Don't add here - EventOccupySlot broadcasts OnSlotAssigned
-							// which triggers EventOnVendorSlotAssigned to add it (avoids duplicates)
-						}
+						// Fallback: use a default sell value
+						// Could be enhanced to use item category or rarity
+						ItemSellPrice = 10;
+						UE_LOG(LogTemp, Log, TEXT("[W_NPC_Window_Vendor] Item %s has no SellPrice, using default: %d"),
+							*ItemData->GetName(), ItemSellPrice);
 					}
-					SlotIndex++;
+
+					// Not infinite - player has limited amount
+					Entries.Emplace(ItemData, InvItem.Amount, ItemSellPrice, 0);
 				}
 			}
 			else
@@ -569,60 +708,31 @@ void UW_NPC_Window_Vendor::EventInitializeVendor_Implementation(const FText& Npc
 		// BUY/TRADE MODE: Show vendor's items
 		UE_LOG(LogTemp, Log, TEXT("[W_NPC_Window_Vendor] BUY/TRADE MODE - Showing vendor items"));
 
-		int32 SlotCount = FMath::Max(VendorData->DefaultSlotCount, VendorData->Items.Num());
-
-		// Create slots
-		for (int32 i = 0; i < SlotCount; i++)
-		{
-			UW_VendorSlot* NewSlot = CreateWidget<UW_VendorSlot>(World, SlotClass);
-			if (NewSlot)
-			{
-				VendorSlots.Add(NewSlot);
-				BindSlotEvents(NewSlot);
-
-				if (CachedUniformInventoryGrid)
-				{
-					int32 Row = i / SlotsPerRow;
-					int32 Column = i % SlotsPerRow;
-					CachedUniformInventoryGrid->AddChildToUniformGrid(NewSlot, Row, Column);
-				}
-			}
-		}
-
-		// Populate slots with vendor items from TSet
-		int32 SlotIndex = 0;
+		// Populate entries with vendor items from TSet
+		Entries.Reserve(VendorData->Items.Num());
 		for (const FSLFVendorItems& VendorItem : VendorData->Items)
 		{
-			if (SlotIndex >= VendorSlots.Num())
+			UPDA_Item* ItemAsset = Cast<UPDA_Item>(VendorItem.Item);
+			if (!ItemAsset)
 			{
-				AddNewSlots();
+				Entries.AddDefaulted();
+				continue;
 			}
 
-			if (SlotIndex < VendorSlots.Num() && VendorItem.Item)
-			{
-				UPDA_Item* ItemAsset = Cast<UPDA_Item>(VendorItem.Item);
-				if (ItemAsset)
-				{
-					UW_VendorSlot* CurrentSlot = VendorSlots[SlotIndex];
-					UE_LOG(LogTemp, Log, TEXT("[W_NPC_Window_Vendor] Adding vendor item: %s (Stock: %d, Price: %d, Infinite: %s)"),
-						*ItemAsset->GetName(), VendorItem.StockAmount, VendorItem.Price,
-						VendorItem.bInfiniteStock ? TEXT("Yes") : TEXT("No"));
-
-					CurrentSlot->EventOccupySlot(
-						ItemAsset,
-						VendorItem.StockAmount,
-						VendorItem.Price,
-						VendorItem.bInfiniteStock,
-						InVendorType
-					);
-					// NOTE: Don't add here - EventOccupySlot broadcasts OnSlotAssigned
-					// which triggers EventOnVendorSlotAssigned to add it (avoids duplicates)
-				}
-			}
-			SlotIndex++;
+			UE_LOG(LogTemp, Log, TEXT("[W_NPC_Window_Vendor] Adding vendor item: %s (Stock: %d, Price: %d, Infinite: %s)"),
+				*ItemAsset->GetName(), VendorItem.StockAmount, VendorItem.Price,
+				VendorItem.bInfiniteStock ? TEXT("Yes") : TEXT("No"));
+
+			Entries.Emplace(ItemAsset, VendorItem.StockAmount, VendorItem.Price, VendorItem.bInfiniteStock ? 1 : 0);
 		}
 	}
 
+	// Binding occupies the slots in order; EventOccupySlot broadcasts OnSlotAssigned,
+	// which triggers EventOnVendorSlotAssigned to fill OccupiedVendorSlots
+	VendorSlotPool->SetEntries(MoveTemp(Entries), true);
+	VendorSlotPool->GetActiveSlotsAs(VendorSlots);
+	RebuildOccupiedVendorSlots();
+
 	// Select first slot if available
 	if (OccupiedVendorSlots.Num() > 0)
 	{
@@ -652,16 +762,8 @@ void UW_NPC_Window_Vendor::EventNavigateUp_Implementation()
 		return;
 	}
 
-	// Move up one row
-	int32 SlotsPerRow = GetSlotsPerRow();
-	int32 NewIndex = NavigationIndex - SlotsPerRow;
-
-	UE_LOG(LogTemp, Log, TEXT("[W_NPC_Window_Vendor] NavigateUp: SlotsPerRow=%d, NewIndex=%d"), SlotsPerRow, NewIndex);
-
-	if (NewIndex >= 0)
-	{
-		UpdateSlotSelection(NewIndex);
-	}
+	// Move up one row (scrolls the slot window at its top edge)
+	StepVendorSelection(-GetSlotsPerRow());
 }
 
 void UW_NPC_Window_Vendor::EventNavigateDown_Implementation()
@@ -679,17 +781,8 @@ void UW_NPC_Window_Vendor::EventNavigateDown_Implementation()
 		return;
 	}
 
-	// Move down one row
-	int32 SlotsPerRow = GetSlotsPerRow();
-	int32 NewIndex = NavigationIndex + SlotsPerRow;
-
-	UE_LOG(LogTemp, Log, TEXT("[W_NPC_Window_Vendor] NavigateDown: SlotsPerRow=%d, NewIndex=%d, MaxIndex=%d"),
-		SlotsPerRow, NewIndex, OccupiedVendorSlots.Num() - 1);
-
-	if (NewIndex < OccupiedVendorSlots.Num())
-	{
-		UpdateSlotSelection(NewIndex);
-	}
+	// Move down one row (scrolls the slot window at its bottom edge)
+	StepVendorSelection(GetSlotsPerRow());
 }
 
 void UW_NPC_Window_Vendor::EventNavigateLeft_Implementation()
@@ -708,14 +801,7 @@ void UW_NPC_Window_Vendor::EventNavigateLeft_Implementation()
 	}
 
 	// Move left one slot
-	int32 NewIndex = NavigationIndex - 1;
-
-	UE_LOG(LogTemp, Log, TEXT("[W_NPC_Window_Vendor] NavigateLeft: NewIndex=%d"), NewIndex);
-
-	if (NewIndex >= 0)
-	{
-		UpdateSlotSelection(NewIndex);
-	}
+	StepVendorSelection(-1);
 }
 
 void UW_NPC_Window_Vendor::EventNavigateRight_Implementation()
@@ -734,14 +820,7 @@ void UW_NPC_Window_Vendor::EventNavigateRight_Implementation()
 	}
 
 	// Move right one slot
-	int32 NewIndex = NavigationIndex + 1;
-
-	UE_LOG(LogTemp, Log, TEXT("[W_NPC_Window_Vendor] NavigateRight: NewIndex=%d, MaxIndex=%d"), NewIndex, OccupiedVendorSlots.Num() - 1);
-
-	if (NewIndex < OccupiedVendorSlots.Num())
-	{
-		UpdateSlotSelection(NewIndex);
-	}
+	StepVendorSelection(1);
 }
 
 void UW_NPC_Window_Vendor::EventNavigateOk_Implementation()
@@ -1023,6 +1102,7 @@ void UW_NPC_Window_Vendor::HandleVendorItemPurchased(UW_VendorSlot* TargetSlot,
 			// Update the count
 			TargetSlot->EventChangeAmount(NewCount);
 		}
+		SyncVendorSlotEntry(TargetSlot);
 
 		// Update item info panel
 		EventSetupItemInfoPanel(TargetSlot);
@@ -1041,20 +1121,23 @@ void UW_NPC_Window_Vendor::HandleVendorItemSold(UPrimaryDataAsset* Item, int32 A
 	// Find the slot with this item and update its count
 	if (SelectedSlot && SelectedSlot->AssignedItem == Item)
 	{
-		int32 NewCount = SelectedSlot->Count - Amount;
+		// Clearing moves the selection (EventOnSellSlotCleared), so keep the sold slot
+		UW_VendorSlot* SoldSlot = SelectedSlot;
+		int32 NewCount = SoldSlot->Count - Amount;
 
 		if (NewCount <= 0)
 		{
 			// Clear the slot if all items sold
-			SelectedSlot->EventClearSlot(false);
+			SoldSlot->EventClearSlot(false);
 			UE_LOG(LogTemp, Log, TEXT("  Slot cleared - all items sold"));
 		}
 		else
 		{
 			// Update the count
-			SelectedSlot->EventChangeAmount(NewCount);
+			SoldSlot->EventChangeAmount(NewCount);
 			UE_LOG(LogTemp, Log, TEXT("  Slot count updated to: %d"), NewCount);
 		}
+		SyncVendorSlotEntry(SoldSlot);
 
 		// Update item info panel
 		EventSetupItemInfoPanel(SelectedSlot);
@@ -32,6 +32,8 @@ class UScrollBox;
 class UTextBlock;
 class UImage;
 class UOverlay;
+class USLFSlotGridPool;
+struct FSLFSlotGridEntry;
 
 // Forward declarations for Blueprint types
 
@@ -56,6 +58,7 @@ public:
 
 	// Input handling - CRITICAL for keyboard/gamepad navigation
 	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
+	virtual FReply NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 
 	// ═══════════════════════════════════════════════════════════════════════
 	// VARIABLES (9)
@@ -183,6 +186,26 @@ protected:
 	// Get slots per row from vendor asset
 	int32 GetSlotsPerRow() const;
 
+	// Pool callbacks for the vendor grid
+	void HandleVendorSlotCreated(UUserWidget* SlotWidget);
+	void BindVendorSlot(UUserWidget* SlotWidget, const FSLFSlotGridEntry* Entry);
+
+	// Move the selection DeltaEntries vendor entries (skipping empty ones), scrolling the slot window to it
+	void StepVendorSelection(int32 DeltaEntries);
+
+	// Scroll the vendor window by whole rows, keeping the selection index
+	bool ScrollVendorGrid(int32 DeltaRows);
+
+	// Refill OccupiedVendorSlots in slot order after the window was rebound
+	void RebuildOccupiedVendorSlots();
+
+	// Write a slot's own count/clear back to the pool entry it shows
+	void SyncVendorSlotEntry(UW_VendorSlot* VendorSlotWidget);
+
+	// Recycled vendor slots - reused across vendors and Buy/Sell switches
+	UPROPERTY(Transient)
+	USLFSlotGridPool* VendorSlotPool;
+
 	// ═══════════════════════════════════════════════════════════════════════
 	// CACHED WIDGET REFERENCES (prefixed to avoid collision with Blueprint widgets)
 	// ═══════════════════════════════════════════════════════════════════════
@@ -7,6 +7,8 @@
 #include "Widgets/W_Radar.h"
 #include "Widgets/W_Radar_TrackedElement.h"
 #include "Widgets/W_Radar_Cardinal.h"
+#include "Widgets/SLFMarkerLayer.h"
+#include "Blueprint/WidgetTree.h"
 #include "Components/Overlay.h"
 #include "Components/OverlaySlot.h"
 #include "Components/Image.h"
@@ -20,6 +22,7 @@ UW_Radar::UW_Radar(const FObjectInitializer& ObjectInitializer)
 	, PlayerIcon(nullptr)
 	, IconSizer(nullptr)
 	, CardinalContainer(nullptr)
+	, MarkerLayer(nullptr)
 {
 }
 
@@ -29,6 +32,7 @@ void UW_Radar::NativeConstruct()
 
 	// Cache widget references
 	CacheWidgetReferences();
+	EnsureMarkerLayer();
 
 	UE_LOG(LogTemp, Log, TEXT("UW_Radar::NativeConstruct - RadarOL: %s, PlayerIcon: %s"),
 		RadarOL ? TEXT("Found") : TEXT("Missing"),
@@ -64,6 +68,25 @@ void UW_Radar::CacheWidgetReferences()
 	}
 }
 
+void UW_Radar::EnsureMarkerLayer()
+{
+	if (MarkerLayer || !RadarOL || !WidgetTree)
+	{
+		return;
+	}
+
+	MarkerLayer = WidgetTree->ConstructWidget<USLFMarkerLayer>(USLFMarkerLayer::StaticClass(), TEXT("MarkerLayer"));
+	if (UOverlaySlot* OverlaySlot = RadarOL->AddChildToOverlay(MarkerLayer))
+	{
+		OverlaySlot->SetHorizontalAlignment(EHorizontalAlignment::HAlign_Fill);
+		OverlaySlot->SetVerticalAlignment(EVerticalAlignment::VAlign_Fill);
+	}
+
+	// Offsets are relative to top center, like the old top-aligned tracked element widgets.
+	// No culling - markers are clamped to RadarClampLength, which may exceed the overlay.
+	MarkerLayer->SetLayout(FVector2f(0.5f, 0.0f), FVector2f(0.5f, 0.0f), false, false);
+}
+
 void UW_Radar::AddCardinal_Implementation(const FSLFCardinalData& InData, int32 MaxAllowedNameLength)
 {
 	if (UWorld* World = GetWorld())
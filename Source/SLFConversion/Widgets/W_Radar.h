@@ -29,6 +29,7 @@ class UOverlay;
 class UImage;
 class USizeBox;
 class UHorizontalBox;
+class USLFMarkerLayer;
 
 // Forward declarations for Blueprint types
 
@@ -73,6 +74,9 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Widgets", meta = (BindWidgetOptional))
 	class UHorizontalBox* CardinalContainer;
 
+	/** Draws every tracked element in one paint pass (created in RadarOL at construct) */
+	USLFMarkerLayer* GetMarkerLayer() const { return MarkerLayer; }
+
 	// ═══════════════════════════════════════════════════════════════════════
 	// EVENT DISPATCHERS (0)
 	// ═══════════════════════════════════════════════════════════════════════
@@ -99,4 +103,10 @@ public:
 protected:
 	// Cache references
 	void CacheWidgetReferences();
+
+	/** Add the marker layer to RadarOL (once) */
+	void EnsureMarkerLayer();
+
+	UPROPERTY(Transient)
+	USLFMarkerLayer* MarkerLayer;
 };
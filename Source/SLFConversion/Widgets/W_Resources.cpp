@@ -6,7 +6,7 @@
 #include "Widgets/W_Resources.h"
 #include "Components/ProgressBar.h"
 #include "Components/SizeBox.h"
-#include "TimerManager.h"
+#include "Widgets/SLFBarAnimationSubsystem.h"
 
 UW_Resources::UW_Resources(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -75,35 +75,16 @@ void UW_Resources::NativeConstruct()
 	double InitialWidthFp = BaseWidthFp * (DefaultMaxFp / ScalingFactorFp);
 	double InitialWidthStamina = BaseWidthStamina * (DefaultMaxStamina / ScalingFactorStamina);
 
-	if (CachedHealthbarSizer)
-	{
-		CachedHealthbarSizer->SetWidthOverride(static_cast<float>(InitialWidthHp));
-	}
-	if (CachedFocusbarSizer)
-	{
-		CachedFocusbarSizer->SetWidthOverride(static_cast<float>(InitialWidthFp));
-	}
-	if (CachedStaminabarSizer)
-	{
-		CachedStaminabarSizer->SetWidthOverride(static_cast<float>(InitialWidthStamina));
-	}
+	SetBarWidth(EResourceBar::Health, InitialWidthHp);
+	SetBarWidth(EResourceBar::Focus, InitialWidthFp);
+	SetBarWidth(EResourceBar::Stamina, InitialWidthStamina);
 
 	// Hide the slider widgets that create white lines
 	HideBarSeparators();
 
-	// Start the tick timer for back bar lerp (60fps like bp_only)
-	// bp_only comment: "We use a custom TimerTick() event running on 60 fps"
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().SetTimer(
-			TickTimer,
-			this,
-			&UW_Resources::EventTimerTick,
-			1.0f / 60.0f, // 60fps
-			true // loop
-		);
-		UE_LOG(LogTemp, Log, TEXT("[W_Resources] Started TickTimer for back bar lerp (60fps)"));
-	}
+	// bp_only ran a looping 60 fps TimerTick() to lerp the back bars. The HUD is now purely
+	// event driven: EventUpdateStat hands dropping back bars to USLFBarAnimationSubsystem,
+	// which only ticks while a bar is still moving.
 
 	UE_LOG(LogTemp, Log, TEXT("[W_Resources] NativeConstruct - Forced BaseWidths: HP=%.1f, FP=%.1f, Stamina=%.1f -> Widths: HP=%.0f, FP=%.0f, Stamina=%.0f"),
 		BaseWidthHp, BaseWidthFp, BaseWidthStamina, InitialWidthHp, InitialWidthFp, InitialWidthStamina);
@@ -128,10 +109,12 @@ void UW_Resources::HideBarSeparators()
 
 void UW_Resources::NativeDestruct()
 {
-	// Clear the tick timer
-	if (UWorld* World = GetWorld())
+	// Stop any back bar still trailing
+	if (USLFBarAnimationSubsystem* Driver = USLFBarAnimationSubsystem::Get(this))
 	{
-		World->GetTimerManager().ClearTimer(TickTimer);
+		Driver->CancelTrail(CachedHealthBar_Back);
+		Driver->CancelTrail(CachedFocusBar_Back);
+		Driver->CancelTrail(CachedStaminaBar_Back);
 	}
 
 	Super::NativeDestruct();
@@ -202,34 +185,102 @@ void UW_Resources::AdjustBarWidth_Implementation(FStatInfo Stat)
 	constexpr double ScalingFactorFp = 50.0;
 	constexpr double ScalingFactorStamina = 70.0;
 
-	FString TagString = Stat.Tag.ToString();
-	double MaxValue = Stat.MaxValue;
+	const double MaxValue = Stat.MaxValue;
+
+	switch (GetBarForTag(Stat.Tag))
+	{
+	case EResourceBar::Health:
+		SetBarWidth(EResourceBar::Health, BaseWidthHp * (MaxValue / ScalingFactorHp));
+		break;
+	case EResourceBar::Focus:
+		SetBarWidth(EResourceBar::Focus, BaseWidthFp * (MaxValue / ScalingFactorFp));
+		break;
+	case EResourceBar::Stamina:
+		SetBarWidth(EResourceBar::Stamina, BaseWidthStamina * (MaxValue / ScalingFactorStamina));
+		break;
+	default:
+		break;
+	}
+}
+
+UW_Resources::EResourceBar UW_Resources::GetBarForTag(const FGameplayTag& Tag)
+{
+	if (const EResourceBar* Found = BarByTag.Find(Tag))
+	{
+		return *Found;
+	}
 
+	// Same matching rules as the Blueprint (HP/Health, FP/Focus, Stamina)
+	const FString TagString = Tag.ToString();
+	EResourceBar Bar = EResourceBar::None;
 	if (TagString.Contains(TEXT("HP")) || TagString.Contains(TEXT("Health")))
 	{
-		if (CachedHealthbarSizer)
-		{
-			double Width = BaseWidthHp * (MaxValue / ScalingFactorHp);
-			CachedHealthbarSizer->SetWidthOverride(static_cast<float>(Width));
-		}
+		Bar = EResourceBar::Health;
 	}
 	else if (TagString.Contains(TEXT("FP")) || TagString.Contains(TEXT("Focus")))
 	{
-		if (CachedFocusbarSizer)
-		{
-			double Width = BaseWidthFp * (MaxValue / ScalingFactorFp);
-			CachedFocusbarSizer->SetWidthOverride(static_cast<float>(Width));
-		}
+		Bar = EResourceBar::Focus;
 	}
 	else if (TagString.Contains(TEXT("Stamina")))
 	{
-		if (CachedStaminabarSizer)
-		{
-			double Width = BaseWidthStamina * (MaxValue / ScalingFactorStamina);
-			CachedStaminabarSizer->SetWidthOverride(static_cast<float>(Width));
-		}
+		Bar = EResourceBar::Stamina;
+	}
+
+	BarByTag.Add(Tag, Bar);
+	return Bar;
+}
+
+UProgressBar* UW_Resources::GetFrontBar(EResourceBar Bar) const
+{
+	switch (Bar)
+	{
+	case EResourceBar::Health:  return CachedHealthBar_Front;
+	case EResourceBar::Focus:   return CachedFocusBar_Front;
+	case EResourceBar::Stamina: return CachedStaminaBar_Front;
+	default:                    return nullptr;
+	}
+}
+
+UProgressBar* UW_Resources::GetBackBar(EResourceBar Bar) const
+{
+	switch (Bar)
+	{
+	case EResourceBar::Health:  return CachedHealthBar_Back;
+	case EResourceBar::Focus:   return CachedFocusBar_Back;
+	case EResourceBar::Stamina: return CachedStaminaBar_Back;
+	default:                    return nullptr;
+	}
+}
+
+void UW_Resources::SetPercentIfChanged(UProgressBar* ProgressBar, float Percent)
+{
+	if (ProgressBar && ProgressBar->GetPercent() != Percent)
+	{
+		ProgressBar->SetPercent(Percent);
+	}
+}
+
+void UW_Resources::SetBarWidth(EResourceBar Bar, double Width)
+{
+	USizeBox* Sizer = nullptr;
+	switch (Bar)
+	{
+	case EResourceBar::Health:  Sizer = CachedHealthbarSizer; break;
+	case EResourceBar::Focus:   Sizer = CachedFocusbarSizer; break;
+	case EResourceBar::Stamina: Sizer = CachedStaminabarSizer; break;
+	default: break;
+	}
+
+	// Width only changes with MaxValue (level up, buffs) - skip the relayout otherwise
+	const float NewWidth = static_cast<float>(Width);
+	float& LastWidth = LastBarWidth[static_cast<int32>(Bar)];
+	if (Sizer && LastWidth != NewWidth)
+	{
+		Sizer->SetWidthOverride(NewWidth);
+		LastWidth = NewWidth;
 	}
 }
+
 void UW_Resources::EventAddBuff_Implementation(UPDA_Buff* Buff)
 {
 	UE_LOG(LogTemp, Log, TEXT("UW_Resources::EventAddBuff_Implementation"));
@@ -262,49 +313,16 @@ void UW_Resources::EventRemoveBuff_Implementation(UPDA_Buff* Buff)
 
 void UW_Resources::EventTimerTick_Implementation()
 {
-	// bp_only: This is called every frame (60fps) to lerp back bars toward front bars
-	// The back bar (yellow/damage preview) gradually catches up to the front bar (actual value)
-
-	const float DeltaTime = 1.0f / 60.0f; // 60fps tick rate
-	const float InterpSpeed = 2.0f; // Speed at which back bar catches up
-
-	// Health bar - lerp back to front
-	if (CachedHealthBar_Front && CachedHealthBar_Back)
-	{
-		float FrontPercent = CachedHealthBar_Front->GetPercent();
-		float BackPercent = CachedHealthBar_Back->GetPercent();
-
-		// Back bar should always catch up to front bar
-		if (!FMath::IsNearlyEqual(BackPercent, FrontPercent, 0.001f))
-		{
-			float NewBack = FMath::FInterpConstantTo(BackPercent, FrontPercent, DeltaTime, InterpSpeed);
-			CachedHealthBar_Back->SetPercent(NewBack);
-		}
-	}
-
-	// Focus bar - lerp back to front
-	if (CachedFocusBar_Front && CachedFocusBar_Back)
+	// bp_only called this from a looping 60 fps timer. Back bars are now animated by the
+	// shared USLFBarAnimationSubsystem; calling this just re-syncs each back bar with its
+	// front bar (useful after Blueprint code sets the front percent directly).
+	for (EResourceBar Bar : { EResourceBar::Health, EResourceBar::Focus, EResourceBar::Stamina })
 	{
-		float FrontPercent = CachedFocusBar_Front->GetPercent();
-		float BackPercent = CachedFocusBar_Back->GetPercent();
-
-		if (!FMath::IsNearlyEqual(BackPercent, FrontPercent, 0.001f))
+		UProgressBar* Front = GetFrontBar(Bar);
+		UProgressBar* Back = GetBackBar(Bar);
+		if (Front && Back)
 		{
-			float NewBack = FMath::FInterpConstantTo(BackPercent, FrontPercent, DeltaTime, InterpSpeed);
-			CachedFocusBar_Back->SetPercent(NewBack);
-		}
-	}
-
-	// Stamina bar - lerp back to front
-	if (CachedStaminaBar_Front && CachedStaminaBar_Back)
-	{
-		float FrontPercent = CachedStaminaBar_Front->GetPercent();
-		float BackPercent = CachedStaminaBar_Back->GetPercent();
-
-		if (!FMath::IsNearlyEqual(BackPercent, FrontPercent, 0.001f))
-		{
-			float NewBack = FMath::FInterpConstantTo(BackPercent, FrontPercent, DeltaTime, InterpSpeed);
-			CachedStaminaBar_Back->SetPercent(NewBack);
+			USLFBarAnimationSubsystem::SetTrailTarget(this, Back, Front->GetPercent(), BackBarInterpSpeed);
 		}
 	}
 }
@@ -312,6 +330,12 @@ void UW_Resources::EventTimerTick_Implementation()
 
 void UW_Resources::EventUpdateStat_Implementation(FStatInfo InStat)
 {
+	const EResourceBar Bar = GetBarForTag(InStat.Tag);
+	if (Bar == EResourceBar::None)
+	{
+		return;
+	}
+
 	// FIRST: Adjust bar WIDTH based on MaxValue (bars scale with max stat value)
 	// This must happen before setting percent so the bar size is correct
 	AdjustBarWidth(InStat);
@@ -324,63 +348,17 @@ void UW_Resources::EventUpdateStat_Implementation(FStatInfo InStat)
 		Percent = FMath::Clamp(Percent, 0.0f, 1.0f);
 	}
 
-	FString TagString = InStat.Tag.ToString();
-
-	// Update the appropriate bar based on the stat tag
 	// FRONT bar = actual value, updates immediately
-	// BACK bar = damage preview (yellow), updated by TickTimer to catch up to front
-	// When healing (front > back), back bar immediately jumps to front
-	if (TagString.Contains(TEXT("HP")) || TagString.Contains(TEXT("Health")))
-	{
-		// Front bar updates immediately
-		if (CachedHealthBar_Front)
-		{
-			CachedHealthBar_Front->SetPercent(Percent);
-		}
-		// Back bar: only update immediately if healing (percent > current back)
-		// Otherwise, let the TickTimer gradually move it down
-		if (CachedHealthBar_Back)
-		{
-			float CurrentBack = CachedHealthBar_Back->GetPercent();
-			if (Percent > CurrentBack)
-			{
-				// Healing - back bar matches front immediately
-				CachedHealthBar_Back->SetPercent(Percent);
-			}
-			// Damage case: back bar stays where it is, TickTimer will catch up
-		}
-		HealthPercentCache = Percent;
-	}
-	else if (TagString.Contains(TEXT("FP")) || TagString.Contains(TEXT("Focus")))
-	{
-		if (CachedFocusBar_Front)
-		{
-			CachedFocusBar_Front->SetPercent(Percent);
-		}
-		if (CachedFocusBar_Back)
-		{
-			float CurrentBack = CachedFocusBar_Back->GetPercent();
-			if (Percent > CurrentBack)
-			{
-				CachedFocusBar_Back->SetPercent(Percent);
-			}
-		}
-		FocusPercentCache = Percent;
-	}
-	else if (TagString.Contains(TEXT("Stamina")))
+	// BACK bar = damage preview (yellow). When healing (front > back) it jumps to the front;
+	// on damage the shared bar animation driver moves it down, then goes back to sleep.
+	SetPercentIfChanged(GetFrontBar(Bar), Percent);
+	USLFBarAnimationSubsystem::SetTrailTarget(this, GetBackBar(Bar), Percent, BackBarInterpSpeed);
+
+	switch (Bar)
 	{
-		if (CachedStaminaBar_Front)
-		{
-			CachedStaminaBar_Front->SetPercent(Percent);
-		}
-		if (CachedStaminaBar_Back)
-		{
-			float CurrentBack = CachedStaminaBar_Back->GetPercent();
-			if (Percent > CurrentBack)
-			{
-				CachedStaminaBar_Back->SetPercent(Percent);
-			}
-		}
-		StaminaPercentCache = Percent;
+	case EResourceBar::Health:  HealthPercentCache = Percent; break;
+	case EResourceBar::Focus:   FocusPercentCache = Percent; break;
+	case EResourceBar::Stamina: StaminaPercentCache = Percent; break;
+	default: break;
 	}
 }
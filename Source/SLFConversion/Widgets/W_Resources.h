@@ -58,6 +58,7 @@ public:
 	double FocusPercentCache;
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Caches")
 	double StaminaPercentCache;
+	/** Unused - back bars are animated by USLFBarAnimationSubsystem (kept for Blueprint compatibility) */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Default")
 	FTimerHandle TickTimer;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Config")
@@ -137,6 +138,24 @@ protected:
 	// Hide white separator lines between bars
 	void HideBarSeparators();
 
+	enum class EResourceBar : uint8 { None, Health, Focus, Stamina };
+
+	// Stat tag -> bar (tag string matching runs once per tag, not per update)
+	EResourceBar GetBarForTag(const FGameplayTag& Tag);
+
+	UProgressBar* GetFrontBar(EResourceBar Bar) const;
+	UProgressBar* GetBackBar(EResourceBar Bar) const;
+
+	// Set only when different - every SetPercent/SetWidthOverride invalidates the bar
+	static void SetPercentIfChanged(UProgressBar* ProgressBar, float Percent);
+	void SetBarWidth(EResourceBar Bar, double Width);
+
+	TMap<FGameplayTag, EResourceBar> BarByTag;
+	float LastBarWidth[4] = { -1.0f, -1.0f, -1.0f, -1.0f };
+
+	// Back bar catch-up speed (percent per second, matches the old 60 Hz timer step)
+	static constexpr float BackBarInterpSpeed = 2.0f;
+
 	// Cached widget references for stat bars (no UPROPERTY to avoid Blueprint conflict)
 	// NOTE: Widget names from Blueprint use lowercase 'b' (Focusbar, Staminabar)
 	UProgressBar* CachedHealthBar_Front;
@@ -13,9 +13,24 @@
 #include "Components/SLFZoneManagerComponent.h"
 #include "Framework/SLFPlayerController.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
 #include "Blueprints/SLFRestingPointBase.h"
 #include "Blueprints/Actors/SLFBossDoor.h"
-#include "EngineUtils.h"
+#include "Components/SLFMapMarkerSubsystem.h"
+#include "Widgets/SLFMarkerLayer.h"
+
+namespace
+{
+	constexpr float RestPointMarkerSize = 44.0f;
+	constexpr float SelectedMarkerSize = 56.0f;
+	constexpr float PlayerMarkerSize = 32.0f;
+
+	const FLinearColor PlayerMarkerColor(0.0f, 0.8f, 1.0f, 1.0f);        // Cyan
+	const FLinearColor RestPointColor(1.0f, 0.75f, 0.0f, 1.0f);          // Gold
+	const FLinearColor RestPointSelectedColor(1.0f, 0.15f, 0.15f, 1.0f); // Bright red
+	const FLinearColor DungeonColor(0.0f, 0.85f, 0.4f, 1.0f);            // Emerald green
+	const FLinearColor DungeonSelectedColor(0.2f, 1.0f, 0.6f, 1.0f);     // Bright green
+}
 
 UW_WorldMap::UW_WorldMap(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -24,7 +39,7 @@ UW_WorldMap::UW_WorldMap(const FObjectInitializer& ObjectInitializer)
 	, LocationNameText(nullptr)
 	, ConfirmPromptText(nullptr)
 	, EmptyHintText(nullptr)
-	, PlayerMarker(nullptr)
+	, MarkerLayer(nullptr)
 	, SelectedMarkerIndex(-1)
 	, bConfirmMode(false)
 	, ZoomLevel(1.0f)
@@ -64,6 +79,16 @@ TSharedRef<SWidget> UW_WorldMap::RebuildWidget()
 			PanelSlot->SetOffsets(FMargin(0.0f));
 		}
 
+		// All rest point / player markers, drawn in one pass at viewport UV positions
+		MarkerLayer = WidgetTree->ConstructWidget<USLFMarkerLayer>(USLFMarkerLayer::StaticClass(), TEXT("MarkerLayer"));
+		MarkerCanvas->AddChild(MarkerLayer);
+		if (UCanvasPanelSlot* PanelSlot = Cast<UCanvasPanelSlot>(MarkerLayer->Slot))
+		{
+			PanelSlot->SetAnchors(FAnchors(0.0f, 0.0f, 1.0f, 1.0f));
+			PanelSlot->SetOffsets(FMargin(0.0f));
+		}
+		MarkerLayer->SetLayout(FVector2f(0.0f, 0.0f), FVector2f(0.5f, 0.5f), true, true);
+
 		// Location name text (top center)
 		LocationNameText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("LocationNameText"));
 		RootCanvas->AddChild(LocationNameText);
@@ -354,16 +379,8 @@ void UW_WorldMap::EventNavigateCancel()
 
 void UW_WorldMap::RefreshMarkers()
 {
-	for (UImage* Marker : MarkerWidgets)
-	{
-		if (Marker && MarkerCanvas) MarkerCanvas->RemoveChild(Marker);
-	}
-	MarkerWidgets.Empty();
-	if (PlayerMarker && MarkerCanvas)
-	{
-		MarkerCanvas->RemoveChild(PlayerMarker);
-		PlayerMarker = nullptr;
-	}
+	if (MarkerLayer) MarkerLayer->ClearMarkers();
+	MarkerMapUV.Reset();
 	CachedRestPoints.Empty();
 	SelectedMarkerIndex = -1;
 	bConfirmMode = false;
@@ -377,73 +394,73 @@ void UW_WorldMap::RefreshMarkers()
 
 	CachedRestPoints = SaveMgr->GetDiscoveredRestPoints();
 
-	// Scan world for all placed resting points — add undiscovered ones too (for testing/map visibility)
+	// Placed resting points / dungeon doors from the marker registry - add undiscovered ones too (for testing/map visibility)
 	UWorld* World = PC->GetWorld();
-	if (World)
+	USLFMapMarkerSubsystem* Markers = USLFMapMarkerSubsystem::Get(this);
+	if (World && Markers)
 	{
 		int32 RPCount = 0;
-		for (TActorIterator<ASLFRestingPointBase> It(World); It; ++It)
+		int32 DoorCount = 0;
+		Markers->ForEachMarker(ESLFMapMarkerChannel::WorldMap, [&](const FSLFMapMarkerDesc& Desc)
 		{
-			ASLFRestingPointBase* RP = *It;
-			if (!RP) continue;
-
-			// Check if already in discovered list
-			bool bAlreadyExists = false;
-			for (const FSLFRestPointSaveInfo& Existing : CachedRestPoints)
+			if (Desc.Kind == ESLFMapMarkerKind::RestPoint)
 			{
-				if (FVector::DistSquared(Existing.WorldLocation, RP->GetActorLocation()) < 10000.0f)
+				ASLFRestingPointBase* RP = Cast<ASLFRestingPointBase>(Desc.Source.Get());
+				if (!RP) return;
+
+				// Check if already in discovered list
+				for (const FSLFRestPointSaveInfo& Existing : CachedRestPoints)
 				{
-					bAlreadyExists = true;
-					break;
+					if (FVector::DistSquared(Existing.WorldLocation, RP->GetActorLocation()) < 10000.0f)
+					{
+						return;
+					}
 				}
+
+				FSLFRestPointSaveInfo Info;
+				Info.RestPointId = FGuid::NewGuid();
+				Info.LocationName = RP->LocationName.IsEmpty() ? FText::FromString(RP->GetName()) : RP->LocationName;
+				Info.WorldLocation = RP->GetActorLocation();
+				// Trace from high above to find terrain surface (resting point may be underground)
+				FVector TraceStart = FVector(RP->GetActorLocation().X, RP->GetActorLocation().Y, 50000.0f);
+				FVector TraceEnd = FVector(RP->GetActorLocation().X, RP->GetActorLocation().Y, -100000.0f);
+				FHitResult Hit;
+				FCollisionQueryParams TraceParams;
+				TraceParams.AddIgnoredActor(RP);
+				if (World->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_Visibility, TraceParams))
+				{
+					Info.SpawnLocation = Hit.ImpactPoint + FVector(0, 0, 200);
+					UE_LOG(LogTemp, Warning, TEXT("[W_WorldMap] RestPoint %s: actor Z=%.0f, terrain Z=%.0f, spawn Z=%.0f"),
+						*RP->GetName(), RP->GetActorLocation().Z, Hit.ImpactPoint.Z, Info.SpawnLocation.Z);
+				}
+				else
+				{
+					Info.SpawnLocation = RP->GetActorLocation() + FVector(0, 0, 500);
+				}
+				Info.SpawnRotation = RP->GetActorRotation();
+				Info.bIsDungeonEntrance = false;
+				CachedRestPoints.Add(Info);
+				RPCount++;
 			}
-			if (bAlreadyExists) continue;
-
-			FSLFRestPointSaveInfo Info;
-			Info.RestPointId = FGuid::NewGuid();
-			Info.LocationName = RP->LocationName.IsEmpty() ? FText::FromString(RP->GetName()) : RP->LocationName;
-			Info.WorldLocation = RP->GetActorLocation();
-			// Trace from high above to find terrain surface (resting point may be underground)
-			FVector TraceStart = FVector(RP->GetActorLocation().X, RP->GetActorLocation().Y, 50000.0f);
-			FVector TraceEnd = FVector(RP->GetActorLocation().X, RP->GetActorLocation().Y, -100000.0f);
-			FHitResult Hit;
-			FCollisionQueryParams TraceParams;
-			TraceParams.AddIgnoredActor(RP);
-			if (World->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_Visibility, TraceParams))
-			{
-				Info.SpawnLocation = Hit.ImpactPoint + FVector(0, 0, 200);
-				UE_LOG(LogTemp, Warning, TEXT("[W_WorldMap] RestPoint %s: actor Z=%.0f, terrain Z=%.0f, spawn Z=%.0f"),
-					*RP->GetName(), RP->GetActorLocation().Z, Hit.ImpactPoint.Z, Info.SpawnLocation.Z);
-			}
-			else
+			else if (Desc.Kind == ESLFMapMarkerKind::DungeonEntrance)
 			{
-				Info.SpawnLocation = RP->GetActorLocation() + FVector(0, 0, 500);
+				// Dungeon entrance doors (ASLFBossDoor with bIsDungeonEntrance=true)
+				ASLFBossDoor* Door = Cast<ASLFBossDoor>(Desc.Source.Get());
+				if (!Door || !Door->bIsDungeonEntrance) return;
+
+				FSLFRestPointSaveInfo DungeonRP;
+				DungeonRP.RestPointId = FGuid::NewGuid();
+				DungeonRP.LocationName = FText::FromString(Door->GetName());
+				DungeonRP.WorldLocation = Door->GetActorLocation();
+				DungeonRP.SpawnLocation = Door->GetActorLocation();
+				DungeonRP.SpawnRotation = Door->GetActorRotation();
+				DungeonRP.bIsDungeonEntrance = true;
+				DungeonRP.DungeonLevelName = Door->DungeonLevelPath;
+				DungeonRP.DungeonWorldOffset = FVector::ZeroVector;
+				CachedRestPoints.Add(DungeonRP);
+				DoorCount++;
 			}
-			Info.SpawnRotation = RP->GetActorRotation();
-			Info.bIsDungeonEntrance = false;
-			CachedRestPoints.Add(Info);
-			RPCount++;
-		}
-
-		// Scan for dungeon entrance doors (ASLFBossDoor with bIsDungeonEntrance=true)
-		int32 DoorCount = 0;
-		for (TActorIterator<ASLFBossDoor> It(World); It; ++It)
-		{
-			ASLFBossDoor* Door = *It;
-			if (!Door || !Door->bIsDungeonEntrance) continue;
-
-			FSLFRestPointSaveInfo DungeonRP;
-			DungeonRP.RestPointId = FGuid::NewGuid();
-			DungeonRP.LocationName = FText::FromString(Door->GetName());
-			DungeonRP.WorldLocation = Door->GetActorLocation();
-			DungeonRP.SpawnLocation = Door->GetActorLocation();
-			DungeonRP.SpawnRotation = Door->GetActorRotation();
-			DungeonRP.bIsDungeonEntrance = true;
-			DungeonRP.DungeonLevelName = Door->DungeonLevelPath;
-			DungeonRP.DungeonWorldOffset = FVector::ZeroVector;
-			CachedRestPoints.Add(DungeonRP);
-			DoorCount++;
-		}
+		});
 
 		UE_LOG(LogTemp, Warning, TEXT("[W_WorldMap] Found %d resting points + %d dungeon doors in world (total %d markers)"),
 			RPCount, DoorCount, CachedRestPoints.Num());
@@ -459,12 +476,7 @@ void UW_WorldMap::RefreshMarkers()
 	if (EmptyHintText) EmptyHintText->SetVisibility(ESlateVisibility::Collapsed);
 
 	// Create markers
-	for (int32 i = 0; i < CachedRestPoints.Num(); ++i)
-	{
-		UImage* Marker = CreateMarkerWidget(false, i);
-		if (Marker) MarkerWidgets.Add(Marker);
-	}
-	PlayerMarker = CreateMarkerWidget(true);
+	BuildMarkerLayer();
 
 	// Auto-zoom to fit
 	AutoFitZoomToMarkers();
@@ -552,38 +564,28 @@ void UW_WorldMap::UpdateMapImageTransform()
 
 void UW_WorldMap::RepositionAllMarkers()
 {
-	for (int32 i = 0; i < MarkerWidgets.Num() && i < CachedRestPoints.Num(); ++i)
+	if (MarkerLayer)
 	{
-		if (!MarkerWidgets[i]) continue;
-		FVector2D MapUV = WorldToFullMapUV(CachedRestPoints[i].WorldLocation);
-		FVector2D ViewUV = FullMapUVToViewport(MapUV);
+		FSLFMarkerDrawList& DrawList = MarkerLayer->EditMarkers();
+		const int32 NumRestPoints = MarkerMapUV.Num();
 
-		if (UCanvasPanelSlot* PanelSlot = Cast<UCanvasPanelSlot>(MarkerWidgets[i]->Slot))
-		{
-			PanelSlot->SetAnchors(FAnchors(ViewUV.X, ViewUV.Y, ViewUV.X, ViewUV.Y));
-		}
-
-		bool bOnScreen = (ViewUV.X > -0.05f && ViewUV.X < 1.05f && ViewUV.Y > -0.05f && ViewUV.Y < 1.05f);
-		MarkerWidgets[i]->SetVisibility(bOnScreen ? ESlateVisibility::SelfHitTestInvisible : ESlateVisibility::Collapsed);
-	}
-
-	if (PlayerMarker)
-	{
-		if (APlayerController* PC = GetOwningPlayer())
+		if (DrawList.Num() == NumRestPoints + 1)
 		{
-			if (APawn* Pawn = PC->GetPawn())
+			// Zoom / pan is a single multiply-add over every marker
+			USLFMapMarkerSubsystem::ProjectToMapView(MarkerMapUV.GetData(), NumRestPoints,
+				FVector2f(ViewCenterUV), ZoomLevel, DrawList.Positions.GetData());
+
+			// Player marker (last entry) - hidden while there is no pawn
+			APawn* Pawn = GetOwningPlayer() ? GetOwningPlayer()->GetPawn() : nullptr;
+			DrawList.Sizes[NumRestPoints] = Pawn ? FVector2f(PlayerMarkerSize) : FVector2f::ZeroVector;
+			if (Pawn)
 			{
-				FVector2D MapUV = WorldToFullMapUV(Pawn->GetActorLocation());
-				FVector2D ViewUV = FullMapUVToViewport(MapUV);
-
-				if (UCanvasPanelSlot* PanelSlot = Cast<UCanvasPanelSlot>(PlayerMarker->Slot))
-				{
-					PanelSlot->SetAnchors(FAnchors(ViewUV.X, ViewUV.Y, ViewUV.X, ViewUV.Y));
-				}
-
-				bool bOnScreen = (ViewUV.X > -0.05f && ViewUV.X < 1.05f && ViewUV.Y > -0.05f && ViewUV.Y < 1.05f);
-				PlayerMarker->SetVisibility(bOnScreen ? ESlateVisibility::SelfHitTestInvisible : ESlateVisibility::Collapsed);
+				const FVector2f PlayerUV(WorldToFullMapUV(Pawn->GetActorLocation()));
+				USLFMapMarkerSubsystem::ProjectToMapView(&PlayerUV, 1,
+					FVector2f(ViewCenterUV), ZoomLevel, &DrawList.Positions[NumRestPoints]);
 			}
+
+			MarkerLayer->CommitMarkers();
 		}
 	}
 
@@ -624,96 +626,55 @@ FVector2D UW_WorldMap::ViewportToFullMapUV(const FVector2D& ViewportUV) const
 // MARKER CREATION & SELECTION
 // ═══════════════════════════════════════════════════════════════════
 
-UImage* UW_WorldMap::CreateMarkerWidget(bool bIsPlayer, int32 RestPointIndex)
+void UW_WorldMap::BuildMarkerLayer()
 {
-	if (!WidgetTree || !MarkerCanvas) return nullptr;
+	if (!MarkerLayer) return;
 
-	UImage* Marker = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass());
-	if (!Marker) return nullptr;
-
-	MarkerCanvas->AddChild(Marker);
-	Marker->SetVisibility(ESlateVisibility::SelfHitTestInvisible); // Don't eat mouse events
-
-	float MarkerSize = bIsPlayer ? 32.0f : 44.0f;
-
-	if (UCanvasPanelSlot* PanelSlot = Cast<UCanvasPanelSlot>(Marker->Slot))
+	const int32 NumRestPoints = CachedRestPoints.Num();
+	MarkerMapUV.SetNumUninitialized(NumRestPoints);
+	for (int32 i = 0; i < NumRestPoints; ++i)
 	{
-		PanelSlot->SetAnchors(FAnchors(0.5f, 0.5f, 0.5f, 0.5f));
-		PanelSlot->SetAlignment(FVector2D(0.5f, 0.5f));
-		PanelSlot->SetOffsets(FMargin(0.0f, 0.0f, MarkerSize, MarkerSize));
-		PanelSlot->SetAutoSize(false);
+		MarkerMapUV[i] = FVector2f(WorldToFullMapUV(CachedRestPoints[i].WorldLocation));
 	}
 
 	// T_Target crosshair icon tinted with color
 	UTexture2D* MarkerTex = LoadObject<UTexture2D>(nullptr,
 		TEXT("/Game/SoulslikeFramework/Textures/_Misc/T_Target.T_Target"));
-	if (MarkerTex)
-	{
-		Marker->SetBrushFromTexture(MarkerTex);
-	}
+	const uint16 MarkerBrush = MarkerLayer->FindOrAddBrush(MarkerTex);
 
-	if (bIsPlayer)
+	FSLFMarkerDrawList& DrawList = MarkerLayer->EditMarkers();
+	DrawList.SetNum(NumRestPoints + 1);
+	for (int32 i = 0; i <= NumRestPoints; ++i)
 	{
-		Marker->SetColorAndOpacity(FLinearColor(0.0f, 0.8f, 1.0f, 1.0f)); // Cyan
-	}
-	else
-	{
-		// Dungeon entrances: emerald green. Regular rest points: gold.
-		bool bIsDungeon = RestPointIndex >= 0 && RestPointIndex < CachedRestPoints.Num()
-			&& CachedRestPoints[RestPointIndex].bIsDungeonEntrance;
-		if (bIsDungeon)
-		{
-			Marker->SetColorAndOpacity(FLinearColor(0.0f, 0.85f, 0.4f, 1.0f)); // Emerald green
-		}
-		else
-		{
-			Marker->SetColorAndOpacity(FLinearColor(1.0f, 0.75f, 0.0f, 1.0f)); // Gold
-		}
+		DrawList.BrushIndices[i] = MarkerBrush;
 	}
 
-	return Marker;
+	DrawList.Sizes[NumRestPoints] = FVector2f(PlayerMarkerSize);
+	DrawList.Tints[NumRestPoints] = PlayerMarkerColor;
+
+	// Rest point sizes / colors are set by UpdateMarkerSelection
 }
 
 void UW_WorldMap::UpdateMarkerSelection()
 {
-	for (int32 i = 0; i < MarkerWidgets.Num(); ++i)
+	if (MarkerLayer)
 	{
-		if (!MarkerWidgets[i]) continue;
-
-		bool bIsDungeon = i < CachedRestPoints.Num() && CachedRestPoints[i].bIsDungeonEntrance;
+		FSLFMarkerDrawList& DrawList = MarkerLayer->EditMarkers();
+		const int32 NumRestPoints = FMath::Min(CachedRestPoints.Num(), DrawList.Num() - 1);
 
-		if (i == SelectedMarkerIndex)
+		for (int32 i = 0; i < NumRestPoints; ++i)
 		{
-			// Selected: bright version of the marker type color
-			if (bIsDungeon)
-			{
-				MarkerWidgets[i]->SetColorAndOpacity(FLinearColor(0.2f, 1.0f, 0.6f, 1.0f)); // Bright green
-			}
-			else
-			{
-				MarkerWidgets[i]->SetColorAndOpacity(FLinearColor(1.0f, 0.15f, 0.15f, 1.0f)); // Bright red
-			}
-			if (UCanvasPanelSlot* PanelSlot = Cast<UCanvasPanelSlot>(MarkerWidgets[i]->Slot))
-			{
-				PanelSlot->SetOffsets(FMargin(0.0f, 0.0f, 56.0f, 56.0f));
-			}
-		}
-		else
-		{
-			// Unselected: normal marker color
-			if (bIsDungeon)
-			{
-				MarkerWidgets[i]->SetColorAndOpacity(FLinearColor(0.0f, 0.85f, 0.4f, 1.0f)); // Emerald green
-			}
-			else
-			{
-				MarkerWidgets[i]->SetColorAndOpacity(FLinearColor(1.0f, 0.75f, 0.0f, 1.0f)); // Gold
-			}
-			if (UCanvasPanelSlot* PanelSlot = Cast<UCanvasPanelSlot>(MarkerWidgets[i]->Slot))
-			{
-				PanelSlot->SetOffsets(FMargin(0.0f, 0.0f, 44.0f, 44.0f));
-			}
+			// Selected: bright version of the marker type color. Dungeon entrances: green. Regular rest points: gold.
+			const bool bIsDungeon = CachedRestPoints[i].bIsDungeonEntrance;
+			const bool bSelected = i == SelectedMarkerIndex;
+
+			DrawList.Tints[i] = bIsDungeon
+				? (bSelected ? DungeonSelectedColor : DungeonColor)
+				: (bSelected ? RestPointSelectedColor : RestPointColor);
+			DrawList.Sizes[i] = FVector2f(bSelected ? SelectedMarkerSize : RestPointMarkerSize);
 		}
+
+		MarkerLayer->CommitMarkers();
 	}
 
 	if (LocationNameText && SelectedMarkerIndex >= 0 && SelectedMarkerIndex < CachedRestPoints.Num())
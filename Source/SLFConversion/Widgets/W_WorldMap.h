@@ -12,6 +12,7 @@
 class UImage;
 class UCanvasPanel;
 class UTextBlock;
+class USLFMarkerLayer;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnMapClosed);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFastTravelRequested, const FSLFRestPointSaveInfo&, Destination);
@@ -57,10 +58,10 @@ protected:
 	UPROPERTY() UTextBlock* ConfirmPromptText;
 	UPROPERTY() UTextBlock* EmptyHintText;
 
-	// Marker state
+	// Marker state - rest point markers are entries [0, N) of the marker layer, the player is entry N
 	TArray<FSLFRestPointSaveInfo> CachedRestPoints;
-	TArray<UImage*> MarkerWidgets;
-	UPROPERTY() UImage* PlayerMarker;
+	UPROPERTY() USLFMarkerLayer* MarkerLayer;
+	TArray<FVector2f> MarkerMapUV; // full map UV per rest point (fixed until the next refresh)
 	int32 SelectedMarkerIndex = -1;
 	bool bConfirmMode = false;
 
@@ -90,7 +91,7 @@ protected:
 	FVector2D ViewportToFullMapUV(const FVector2D& ViewportUV) const;
 	void RepositionAllMarkers();
 	void UpdateMapImageTransform();
-	UImage* CreateMarkerWidget(bool bIsPlayer, int32 RestPointIndex = -1);
+	void BuildMarkerLayer();
 	void UpdateMarkerSelection();
 	int32 FindNearestMarkerInDirection(const FVector2D& Direction) const;
 	int32 FindMarkerNearScreenPosition(const FVector2D& LocalPosition, const FGeometry& Geometry) const;